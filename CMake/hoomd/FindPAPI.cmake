@@ -0,0 +1,24 @@
+find_path(PAPI_INCLUDE_DIR papi.h)
+
+find_library(PAPI_LIBRARY papi
+             HINTS ${PAPI_INCLUDE_DIR}/../lib )
+
+if(PAPI_INCLUDE_DIR AND EXISTS "${PAPI_INCLUDE_DIR}/papi.h")
+    file(STRINGS "${PAPI_INCLUDE_DIR}/papi.h" PAPI_H REGEX "^#define PAPI_VERSION +PAPI_VERSION_NUMBER\\(.*$")
+
+    string(REGEX REPLACE ".*PAPI_VERSION_NUMBER\\( *([0-9]+), *([0-9]+), *([0-9]+).*$" "\\1.\\2.\\3" PAPI_VERSION_STRING "${PAPI_H}")
+endif()
+
+# handle the QUIETLY and REQUIRED arguments and set PAPI_FOUND to TRUE if
+# all listed variables are TRUE
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(PAPI
+                                  REQUIRED_VARS PAPI_LIBRARY PAPI_INCLUDE_DIR
+                                  VERSION_VAR PAPI_VERSION_STRING)
+
+if(PAPI_LIBRARY AND NOT TARGET PAPI::papi)
+    add_library(PAPI::papi UNKNOWN IMPORTED)
+    set_target_properties(PAPI::papi PROPERTIES
+        IMPORTED_LOCATION "${PAPI_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${PAPI_INCLUDE_DIR}")
+endif()
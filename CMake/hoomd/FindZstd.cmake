@@ -0,0 +1,27 @@
+find_path(Zstd_INCLUDE_DIR zstd.h)
+
+find_library(Zstd_LIBRARY zstd
+             HINTS ${Zstd_INCLUDE_DIR}/../lib )
+
+if(Zstd_INCLUDE_DIR AND EXISTS "${Zstd_INCLUDE_DIR}/zstd.h")
+    file(STRINGS "${Zstd_INCLUDE_DIR}/zstd.h" Zstd_H REGEX "^#define ZSTD_VERSION_(MAJOR|MINOR|RELEASE) .*$")
+
+    string(REGEX REPLACE ".*#define ZSTD_VERSION_MAJOR +([0-9]+).*$" "\\1" Zstd_VERSION_MAJOR "${Zstd_H}")
+    string(REGEX REPLACE ".*#define ZSTD_VERSION_MINOR +([0-9]+).*$" "\\1" Zstd_VERSION_MINOR "${Zstd_H}")
+    string(REGEX REPLACE ".*#define ZSTD_VERSION_RELEASE +([0-9]+).*$" "\\1" Zstd_VERSION_RELEASE "${Zstd_H}")
+    set(Zstd_VERSION_STRING "${Zstd_VERSION_MAJOR}.${Zstd_VERSION_MINOR}.${Zstd_VERSION_RELEASE}")
+endif()
+
+# handle the QUIETLY and REQUIRED arguments and set Zstd_FOUND to TRUE if
+# all listed variables are TRUE
+include(FindPackageHandleStandardArgs)
+find_package_handle_standard_args(Zstd
+                                  REQUIRED_VARS Zstd_LIBRARY Zstd_INCLUDE_DIR
+                                  VERSION_VAR Zstd_VERSION_STRING)
+
+if(Zstd_LIBRARY AND NOT TARGET zstd::zstd)
+    add_library(zstd::zstd UNKNOWN IMPORTED)
+    set_target_properties(zstd::zstd PROPERTIES
+        IMPORTED_LOCATION "${Zstd_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${Zstd_INCLUDE_DIR}")
+endif()
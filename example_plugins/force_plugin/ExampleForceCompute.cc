@@ -0,0 +1,113 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ExampleForceCompute.h"
+#ifdef ENABLE_HIP
+#include "ExampleForceCompute.cuh"
+#endif
+
+#include <string.h>
+
+/*! \file ExampleForceCompute.cc
+    \brief Definition of ExampleForceCompute
+*/
+
+// ********************************
+// here follows the code for ExampleForceCompute on the CPU
+
+namespace hoomd
+    {
+/*! \param sysdef System to compute forces on
+    \param k Spring constant
+ */
+ExampleForceCompute::ExampleForceCompute(std::shared_ptr<SystemDefinition> sysdef, Scalar k)
+    : ForceCompute(sysdef), m_k(k)
+    {
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ExampleForceCompute::computeForces(uint64_t timestep)
+    {
+    // access the particle data for reading and the force arrays for writing on the CPU
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+
+    // an external field does not contribute to the virial
+    memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        const Scalar4 pos = h_pos.data[i];
+        const Scalar r2 = pos.x * pos.x + pos.y * pos.y + pos.z * pos.z;
+        h_force.data[i]
+            = make_scalar4(-m_k * pos.x, -m_k * pos.y, -m_k * pos.z, Scalar(0.5) * m_k * r2);
+        }
+    }
+
+namespace detail
+    {
+/* Export the CPU force compute to be visible in the python module
+ */
+void export_ExampleForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<ExampleForceCompute, ForceCompute, std::shared_ptr<ExampleForceCompute>>(
+        m,
+        "ExampleForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("k", &ExampleForceCompute::getK, &ExampleForceCompute::setK);
+    }
+
+    } // end namespace detail
+
+// ********************************
+// here follows the code for ExampleForceCompute on the GPU
+
+#ifdef ENABLE_HIP
+
+/*! \param sysdef System to compute forces on
+    \param k Spring constant
+ */
+ExampleForceComputeGPU::ExampleForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef, Scalar k)
+    : ExampleForceCompute(sysdef, k)
+    {
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ExampleForceComputeGPU::computeForces(uint64_t timestep)
+    {
+    // access the particle data for reading and the force arrays for writing on the GPU
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar> d_virial(m_virial, access_location::device, access_mode::overwrite);
+
+    // an external field does not contribute to the virial
+    hipMemset(d_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    // call the kernel defined in ExampleForceCompute.cu
+    kernel::gpu_compute_example_forces(d_force.data, d_pos.data, m_pdata->getN(), m_k);
+
+    // check for error codes from the GPU if error checking is enabled
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+/* Export the GPU force compute to be visible in the python module
+ */
+void export_ExampleForceComputeGPU(pybind11::module& m)
+    {
+    pybind11::class_<ExampleForceComputeGPU,
+                     ExampleForceCompute,
+                     std::shared_ptr<ExampleForceComputeGPU>>(m, "ExampleForceComputeGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>());
+    }
+
+    } // end namespace detail
+
+#endif // ENABLE_HIP
+
+    } // end namespace hoomd
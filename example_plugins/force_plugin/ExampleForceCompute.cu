@@ -0,0 +1,68 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+
+#include "ExampleForceCompute.cuh"
+
+/*! \file ExampleForceCompute.cu
+    \brief CUDA kernels for ExampleForceCompute
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Kernel that computes the harmonic well forces on the GPU
+/*! \param d_force Force and potential energy array to write
+    \param d_pos Position and type array from the ParticleData
+    \param N Number of particles
+    \param k Spring constant
+
+    This kernel executes one thread per particle. It can be run with any 1D block size as long as
+    block_size * num_blocks is >= the number of particles.
+*/
+__global__ void
+gpu_compute_example_forces_kernel(Scalar4* d_force, const Scalar4* d_pos, unsigned int N, Scalar k)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx < N)
+        {
+        // pos.w is the type, which the force does not depend on
+        const Scalar4 pos = d_pos[idx];
+        const Scalar r2 = pos.x * pos.x + pos.y * pos.y + pos.z * pos.z;
+        d_force[idx] = make_scalar4(-k * pos.x, -k * pos.y, -k * pos.z, Scalar(0.5) * k * r2);
+        }
+    }
+
+/*! \param d_force Force and potential energy array to write
+    \param d_pos Position and type array from the ParticleData
+    \param N Number of particles
+    \param k Spring constant
+    This is just a driver for gpu_compute_example_forces_kernel(), see it for the details
+*/
+hipError_t
+gpu_compute_example_forces(Scalar4* d_force, const Scalar4* d_pos, unsigned int N, Scalar k)
+    {
+    // setup the grid to run the kernel
+    unsigned int block_size = 256;
+    dim3 grid(N / block_size + 1, 1, 1);
+    dim3 threads(block_size, 1, 1);
+
+    // run the kernel
+    hipLaunchKernelGGL(gpu_compute_example_forces_kernel,
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_force,
+                       d_pos,
+                       N,
+                       k);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace hoomd
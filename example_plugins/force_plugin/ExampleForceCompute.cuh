@@ -0,0 +1,25 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _EXAMPLE_FORCE_COMPUTE_CUH_
+#define _EXAMPLE_FORCE_COMPUTE_CUH_
+
+// need to include the particle data definition
+#include <hoomd/ParticleData.cuh>
+
+/*! \file ExampleForceCompute.cuh
+    \brief Declaration of CUDA kernels for ExampleForceCompute
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Computes the harmonic well forces on the GPU
+hipError_t
+gpu_compute_example_forces(Scalar4* d_force, const Scalar4* d_pos, unsigned int N, Scalar k);
+
+    } // end namespace kernel
+    } // end namespace hoomd
+
+#endif // _EXAMPLE_FORCE_COMPUTE_CUH_
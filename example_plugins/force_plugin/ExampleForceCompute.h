@@ -0,0 +1,88 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+// **********************
+// This is a simple example code written for no function purpose other then to demonstrate the steps
+// needed to write a c++ source code plugin for HOOMD-Blue. It implements a per-particle force as a
+// compiled ForceCompute, which HOOMD-blue evaluates every time step without calling into Python.
+
+// inclusion guard
+#ifndef _EXAMPLE_FORCE_COMPUTE_H_
+#define _EXAMPLE_FORCE_COMPUTE_H_
+
+/*! \file ExampleForceCompute.h
+    \brief Declaration of ExampleForceCompute
+*/
+
+#include <hoomd/ForceCompute.h>
+
+// pybind11 is used to create the python bindings to the C++ object,
+// but not if we are compiling GPU kernels
+#ifndef __HIPCC__
+#include <pybind11/pybind11.h>
+#endif
+
+namespace hoomd
+    {
+//! A harmonic well written to demonstrate how to write a force plugin
+/*! This force compute pulls every particle towards the origin with the force F = -k r and the
+    potential energy U = k r^2 / 2, where r is the particle position in the (wrapped) box.
+ */
+class ExampleForceCompute : public ForceCompute
+    {
+    public:
+    //! Constructor
+    ExampleForceCompute(std::shared_ptr<SystemDefinition> sysdef, Scalar k);
+
+    //! Set the spring constant
+    void setK(Scalar k)
+        {
+        m_k = k;
+        }
+
+    //! Get the spring constant
+    Scalar getK()
+        {
+        return m_k;
+        }
+
+    protected:
+    //! Compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    Scalar m_k; //!< Spring constant
+    };
+
+namespace detail
+    {
+//! Export the ExampleForceCompute class to python
+void export_ExampleForceCompute(pybind11::module& m);
+
+    } // end namespace detail
+
+#ifdef ENABLE_HIP
+
+//! The harmonic well evaluated on the GPU
+class ExampleForceComputeGPU : public ExampleForceCompute
+    {
+    public:
+    //! Constructor
+    ExampleForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef, Scalar k);
+
+    protected:
+    //! Compute the forces on the GPU
+    virtual void computeForces(uint64_t timestep);
+    };
+
+namespace detail
+    {
+//! Export the ExampleForceComputeGPU class to python
+void export_ExampleForceComputeGPU(pybind11::module& m);
+
+    } // end namespace detail
+
+#endif // ENABLE_HIP
+
+    } // end namespace hoomd
+
+#endif // _EXAMPLE_FORCE_COMPUTE_H_
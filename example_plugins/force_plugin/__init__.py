@@ -0,0 +1,6 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Example python module."""
+
+from hoomd.force_plugin import force
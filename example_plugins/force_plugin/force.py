@@ -0,0 +1,39 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Example force."""
+
+# Import the C++ module.
+from hoomd.force_plugin import _force_plugin
+
+# Import the hoomd Python package and other necessary components.
+import hoomd
+from hoomd.md import force
+from hoomd.data.parameterdicts import ParameterDict
+
+
+class ExampleForce(force.Force):
+    """Example force: a harmonic well at the origin.
+
+    Args:
+        k (float): Spring constant :math:`[\\mathrm{energy} \\cdot
+          \\mathrm{length}^{-2}]`.
+
+    The force on each particle is :math:`\\vec{F} = -k \\vec{r}` and its
+    potential energy is :math:`U = \\frac{1}{2} k r^2`. The force is compiled
+    C++ code, so HOOMD-blue evaluates it every time step without calling into
+    Python, unlike `hoomd.md.force.Custom`.
+    """
+
+    def __init__(self, k):
+        super().__init__()
+        self._param_dict.update(ParameterDict(k=float(k)))
+
+    def _attach_hook(self):
+        # initialize the reflected c++ class
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _force_plugin.ExampleForceCompute
+        else:
+            cpp_class = _force_plugin.ExampleForceComputeGPU
+
+        self._cpp_obj = cpp_class(self._simulation.state._cpp_sys_def, self.k)
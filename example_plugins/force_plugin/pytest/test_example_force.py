@@ -0,0 +1,41 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+# Import the plugin module.
+from hoomd import force_plugin
+
+# Import the hoomd Python package.
+import hoomd
+
+import pytest
+import numpy as np
+
+# Positions and spring constants to test against.
+positions = [(0.0, 0.0, 0.0), (1.0, -2.0, 3.0), (-4.5, 0.5, 2.0)]
+spring_constants = [0.0, 1.0, 2.5]
+
+
+# Use pytest decorator to automate testing over the sequence of parameters.
+@pytest.mark.parametrize("pos", positions)
+@pytest.mark.parametrize("k", spring_constants)
+def test_force(simulation_factory, one_particle_snapshot_factory, pos, k):
+
+    # `one_particle_snapshot_factory` and `simulation_factory` are pytest
+    # fixtures defined in hoomd/conftest.py. These factories automatically
+    # handle iterating tests over different CPU and GPU devices.
+    sim = simulation_factory(one_particle_snapshot_factory(position=pos))
+
+    # Add our plugin to the simulation.
+    example_force = force_plugin.force.ExampleForce(k=k)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                    forces=[example_force])
+    sim.run(0)
+    assert example_force.k == k
+
+    forces = example_force.forces
+    energies = example_force.energies
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(forces[0], -k * np.array(pos), atol=1e-6)
+        np.testing.assert_allclose(energies[0],
+                                   0.5 * k * np.dot(pos, pos),
+                                   atol=1e-6)
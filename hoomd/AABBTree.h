@@ -73,6 +73,10 @@ struct PYBIND11_EXPORT AABBNode
    periodically instead of continually updated.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each
    particle.
+    - Refit : Recompute the AABBs of all nodes from a complete set of AABBs, one for each particle,
+   without changing the tree topology. Runs in O(N) time. Refit shrinks nodes as well as growing
+   them, but the tree quality degrades as particles move away from the partition it was built for.
+   Compare getSurfaceArea() to its value after buildTree() to decide when to rebuild.
 
     **Implementation details**
 
@@ -161,6 +165,18 @@ class PYBIND11_EXPORT AABBTree
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Refit the tree to a new list of AABBs
+    inline void refit(const AABB* aabbs, unsigned int N);
+
+    //! Get the number of particles in the tree
+    inline unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_mapping.size();
+        }
+
+    //! Get the total surface area of all nodes
+    inline Scalar getSurfaceArea() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
@@ -357,6 +373,56 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
         }
     }
 
+/*! \param aabbs List of AABBs for each particle
+    \param N Number of AABBs in the list, must match the number of particles in the tree
+
+    refit() sets the AABB of each leaf node to enclose the AABBs of its particles and then merges
+   the AABBs of the internal nodes bottom up. buildNode() allocates every node before its children,
+   so a reverse pass over the node array visits the children before their parents. refit() does not
+   change the tree topology, so the tree remains efficient only when the particles have moved a
+   small distance since the last buildTree().
+*/
+inline void AABBTree::refit(const AABB* aabbs, unsigned int N)
+    {
+    assert(N == m_mapping.size());
+
+    for (unsigned int i = m_num_nodes; i > 0; i--)
+        {
+        AABBNode& node = m_nodes[i - 1];
+        if (node.left == INVALID_NODE)
+            {
+            node.aabb = aabbs[node.particles[0]];
+            node.particle_tags[0] = aabbs[node.particles[0]].tag;
+            for (unsigned int j = 1; j < node.num_particles; j++)
+                {
+                node.aabb = merge(node.aabb, aabbs[node.particles[j]]);
+                node.particle_tags[j] = aabbs[node.particles[j]].tag;
+                }
+            }
+        else
+            {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+        }
+    }
+
+/*! \returns The sum of the surface areas of the AABBs of all nodes
+
+    The total surface area estimates the cost of a query: each node is tested with a probability
+   proportional to its surface area. A tree refit many times has a larger total surface area than a
+   freshly built tree, so the ratio of the two measures how much the quality has degraded.
+*/
+inline Scalar AABBTree::getSurfaceArea() const
+    {
+    Scalar area = 0;
+    for (unsigned int i = 0; i < m_num_nodes; i++)
+        {
+        vec3<Scalar> length = m_nodes[i].aabb.getUpper() - m_nodes[i].aabb.getLower();
+        area += Scalar(2.0) * (length.x * length.y + length.y * length.z + length.z * length.x);
+        }
+    return area;
+    }
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "Autotuned.h"
+#include "OperationTimer.h"
 #include "SharedSignal.h"
 #include "SystemDefinition.h"
 
@@ -25,6 +26,10 @@ namespace hoomd
     and interact with these autotuners, Action provides a pybind11 interface to get and set
     autotuner parameters for all child classes. Derived classes must add all autotuners to
     m_autotuners for the base class API to be effective.
+
+    Each Action also owns an OperationTimer that accumulates the wall time, number of calls, and
+    bytes moved by the action. System times the update(), analyze(), and integrator calls it makes,
+    and the main Compute implementations time their compute() calls.
 */
 class Action : public Autotuned
     {
@@ -34,6 +39,12 @@ class Action : public Autotuned
         {
         }
 
+    /// Get the timer that accumulates the cost of this action.
+    OperationTimer& getTimer()
+        {
+        return m_timer;
+        }
+
     protected:
     /// The system definition this action is associated with.
     const std::shared_ptr<SystemDefinition> m_sysdef;
@@ -44,6 +55,9 @@ class Action : public Autotuned
     /// The simulation's execution configuration.
     std::shared_ptr<const ExecutionConfiguration> m_exec_conf;
 
+    /// Accumulates the wall time, calls, and bytes moved by this action.
+    OperationTimer m_timer;
+
     /// Stored shared ptr to the system signals
     std::vector<std::shared_ptr<hoomd::detail::SignalSlot>> m_slots;
 
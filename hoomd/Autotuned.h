@@ -10,6 +10,8 @@
 #include <memory>
 #include <pybind11/pybind11.h>
 #include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "Autotuner.h"
@@ -63,6 +65,19 @@ class PYBIND11_EXPORT Autotuned
             }
         }
 
+    /// Get the current parameter of each autotuner as a (name, parameter) string pair.
+    /*! Unlike getAutotunerParameters(), this method does not require the Python interpreter.
+     */
+    std::vector<std::pair<std::string, std::string>> getAutotunerParameterStrings()
+        {
+        std::vector<std::pair<std::string, std::string>> params;
+        for (const auto& tuner : m_autotuners)
+            {
+            params.push_back(std::make_pair(tuner->getName(), tuner->getParameterString()));
+            }
+        return params;
+        }
+
     /// Start an autotuning sequence.
     virtual void startAutotuning()
         {
@@ -20,6 +20,7 @@
 #include <cfloat>
 #include <functional>
 #include <iostream>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -68,6 +69,12 @@ class PYBIND11_EXPORT AutotunerBase
         return m_name;
         }
 
+    /// Get the current parameter formatted as a string.
+    virtual std::string getParameterString()
+        {
+        return "()";
+        }
+
 #ifndef __HIPCC__
     /// Get the autotuner parameters as a Python tuple.
     virtual pybind11::tuple getParameterPython()
@@ -149,6 +156,20 @@ class PYBIND11_EXPORT AutotunerBase
     Once tuning is complete isComplete() will return true and getParam() returns the best performing
     paremeter.
 
+    When successive halving is enabled in the execution configuration, each sweep samples only the
+    remaining candidate parameters (m_candidates). After each sweep, the slower half of the
+    candidates (by the sampling mode applied to the samples taken so far) is discarded, so a scan
+    takes roughly 2 launches per parameter instead of m_n_samples. The scan ends when one candidate
+    remains or every remaining candidate has m_n_samples samples. Successive halving applies only to
+    tuners that do not synchronize over MPI, as ranks would otherwise discard different candidates.
+
+    When a retune threshold is set in the execution configuration, an IDLE autotuner times one
+    launch out of every s_retune_check_period to track the performance of the optimal parameter.
+    When m_n_samples consecutive checks are slower than the baseline (the sample center of the
+    optimal parameter) by more than the threshold, the autotuner starts a new scan. This checks for
+    parameters that become stale as the system changes. Tuners that synchronize over MPI and
+    parameters set by the user are not checked.
+
     Each Autotuner instance has a string name to help identify it's output on the notice stream.
 
     Autotuner is not useful in non-GPU builds. Timing is performed with CUDA events and requires
@@ -193,9 +214,15 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     virtual void startScan()
         {
         m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " starting scan." << std::endl;
+        m_successive_halving = m_exec_conf->isAutotunerSuccessiveHalvingEnabled();
+        m_baseline = 0.0f;
+        m_idle_launches = 0;
+        m_n_slow = 0;
+        m_candidates.resize(m_parameters.size());
+        std::iota(m_candidates.begin(), m_candidates.end(), size_t(0));
         m_current_element = 0;
         m_current_sample = 0;
-        m_current_param = m_parameters[m_current_element];
+        m_current_param = m_parameters[m_candidates[m_current_element]];
 
         if (m_optional)
             {
@@ -216,8 +243,21 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
             }
 
 #ifdef ENABLE_HIP
+        // periodically time the optimal parameter when retuning is enabled
+        m_checking = false;
+        if (m_state == IDLE && m_baseline > 0.0f
+            && m_exec_conf->getAutotunerRetuneThreshold() > 0.0f)
+            {
+            m_idle_launches++;
+            if (m_idle_launches >= s_retune_check_period)
+                {
+                m_idle_launches = 0;
+                m_checking = true;
+                }
+            }
+
         // if we are scanning, record a cuda event - otherwise do nothing
-        if (m_state == SCANNING)
+        if (m_state == SCANNING || m_checking)
             {
             hipEventRecord(m_start, 0);
             if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -240,6 +280,12 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         return m_current_param;
         }
 
+    /// Get the current parameter formatted as a string.
+    virtual std::string getParameterString()
+        {
+        return formatParam(m_current_param);
+        }
+
     /// Get the autotuner parameters as a Python tuple.
     virtual pybind11::tuple getParameterPython()
         {
@@ -283,6 +329,7 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
         m_current_param = cpp_param;
         m_state = IDLE;
         m_current_sample = 0;
+        m_baseline = 0.0f;
 
         m_exec_conf->msg->notice(4) << "Autotuner " << m_name << " setting user-defined parameter "
                                     << formatParam(cpp_param) << std::endl;
@@ -342,6 +389,12 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     protected:
     size_t computeOptimalParameterIndex();
 
+    /// Sort the candidates from fastest to slowest using their first n_samples samples
+    void rankCandidates(unsigned int n_samples);
+
+    /// Summarize a set of samples with the sampling mode
+    float computeSampleCenter(std::vector<float> v) const;
+
     /// State names
     enum State
         {
@@ -362,7 +415,7 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// Current sample counter.
     unsigned int m_current_sample;
 
-    /// Current element of the parameter array in the sample.
+    /// Current element of the candidate array in the sample.
     unsigned int m_current_element;
 
     /// The current parameter value being sampled (when SCANNING) or optimal (when IDLE).
@@ -391,6 +444,27 @@ template<size_t n_dimensions> class PYBIND11_EXPORT Autotuner : public Autotuner
     /// True when this is an optional tuner.
     bool m_optional;
 
+    /// Indices of the parameters sampled in each sweep.
+    std::vector<size_t> m_candidates;
+
+    /// True when the current scan discards the slower half of the candidates after each sweep.
+    bool m_successive_halving;
+
+    /// Sample center of the optimal parameter, or 0 when the parameter is not checked.
+    float m_baseline;
+
+    /// Number of IDLE launches since the last retune check.
+    unsigned int m_idle_launches;
+
+    /// Number of consecutive retune checks slower than the threshold.
+    unsigned int m_n_slow;
+
+    /// True when the current IDLE launch is timed.
+    bool m_checking;
+
+    /// Number of IDLE launches between retune checks.
+    static constexpr unsigned int s_retune_check_period = 1000;
+
     /// Helper method to initialize multi-dimensional arrays recursively.
     void initializeParameters(
         const std::vector<std::vector<unsigned int>>& dimension_ranges,
@@ -440,7 +514,8 @@ Autotuner<n_dimensions>::Autotuner(
     bool optional,
     std::function<bool(const std::array<unsigned int, n_dimensions>&)> is_parameter_valid)
     : AutotunerBase(name), m_n_samples(n_samples), m_exec_conf(exec_conf), m_sync(false),
-      m_mode(mode_median), m_optional(optional)
+      m_mode(mode_median), m_optional(optional), m_successive_halving(false), m_baseline(0.0f),
+      m_idle_launches(0), m_n_slow(0), m_checking(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing Autotuner " << name << " with " << n_samples
                                 << " samples." << std::endl;
@@ -509,16 +584,51 @@ template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
         {
         hipEventRecord(m_stop, 0);
         hipEventSynchronize(m_stop);
-        hipEventElapsedTime(&m_samples[m_current_element][m_current_sample], m_start, m_stop);
+        float& sample = m_samples[m_candidates[m_current_element]][m_current_sample];
+        hipEventElapsedTime(&sample, m_start, m_stop);
 
         m_exec_conf->msg->notice(9)
             << "Autotuner " << m_name << ": t[" << formatParam(m_current_param) << ","
-            << m_current_sample << "] = " << m_samples[m_current_element][m_current_sample]
-            << std::endl;
+            << m_current_sample << "] = " << sample << std::endl;
 
         if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
         }
+
+    // compare the optimal parameter to its baseline and start a new scan when it is stale
+    if (m_checking)
+        {
+        hipEventRecord(m_stop, 0);
+        hipEventSynchronize(m_stop);
+        float t;
+        hipEventElapsedTime(&t, m_start, m_stop);
+        m_checking = false;
+
+        if (t > m_baseline * (1.0f + m_exec_conf->getAutotunerRetuneThreshold()))
+            {
+            m_n_slow++;
+            }
+        else
+            {
+            m_n_slow = 0;
+            }
+
+        if (m_n_slow >= m_n_samples)
+            {
+            m_exec_conf->msg->notice(4)
+                << "Autotuner " << m_name << " parameter " << formatParam(m_current_param)
+                << " is slower than tuned (" << t << " > " << m_baseline << "), retuning."
+                << std::endl;
+            startScan();
+            if (m_state == INACTIVE)
+                {
+                m_state = SCANNING;
+                }
+
+            // this launch was not a scan sample
+            return;
+            }
+        }
 #endif
 
     // Handle state data updates and transitions.
@@ -528,27 +638,52 @@ template<size_t n_dimensions> void Autotuner<n_dimensions>::end()
         m_current_element++;
 
         // If we hit the end of the elements
-        if (m_current_element >= m_parameters.size())
+        if (m_current_element >= m_candidates.size())
             {
             // Move on to the next sample.
             m_current_sample++;
             m_current_element = 0;
 
+            const bool halving = m_successive_halving && !m_sync;
+            if (halving)
+                {
+                // Keep the faster half of the candidates.
+                rankCandidates(m_current_sample);
+                if (m_current_sample < m_n_samples)
+                    {
+                    m_candidates.resize((m_candidates.size() + 1) / 2);
+                    }
+                }
+
             // If this is the last sample, go to the idle state and compute the optimal parameter.
-            if (m_current_sample >= m_n_samples)
+            if (m_current_sample >= m_n_samples || (halving && m_candidates.size() == 1))
                 {
                 m_state = IDLE;
                 m_current_sample = 0;
-                m_current_param = m_parameters[computeOptimalParameterIndex()];
+                if (halving)
+                    {
+                    m_current_param = m_parameters[m_candidates[0]];
+                    m_baseline = m_sample_center[m_candidates[0]];
+                    m_exec_conf->msg->notice(4)
+                        << "Autotuner " << m_name << " found optimal parameter "
+                        << formatParam(m_current_param) << " by successive halving."
+                        << std::endl;
+                    }
+                else
+                    {
+                    const size_t optimal = computeOptimalParameterIndex();
+                    m_current_param = m_parameters[optimal];
+                    m_baseline = m_sync ? 0.0f : m_sample_center[optimal];
+                    }
                 }
             else
                 {
-                m_current_param = m_parameters[m_current_element];
+                m_current_param = m_parameters[m_candidates[m_current_element]];
                 }
             }
         else
             {
-            m_current_param = m_parameters[m_current_element];
+            m_current_param = m_parameters[m_candidates[m_current_element]];
             }
         }
     }
@@ -595,33 +730,7 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
 #endif
         if (is_root)
             {
-            if (m_mode == mode_avg)
-                {
-                // Compute average.
-                float sum = 0.0f;
-                for (std::vector<float>::iterator it = v.begin(); it != v.end(); ++it)
-                    sum += *it;
-                m_sample_center[i] = sum / float(v.size());
-                }
-            else if (m_mode == mode_max)
-                {
-                // Compute maximum.
-                m_sample_center[i] = -FLT_MIN;
-                for (std::vector<float>::iterator it = v.begin(); it != v.end(); ++it)
-                    {
-                    if (*it > m_sample_center[i])
-                        {
-                        m_sample_center[i] = *it;
-                        }
-                    }
-                }
-            else
-                {
-                // Compute median.
-                size_t n = v.size() / 2;
-                nth_element(v.begin(), v.begin() + n, v.end());
-                m_sample_center[i] = v[n];
-                }
+            m_sample_center[i] = computeSampleCenter(v);
             }
         }
 
@@ -664,6 +773,65 @@ template<size_t n_dimensions> size_t Autotuner<n_dimensions>::computeOptimalPara
     return min_idx;
     }
 
+/*! \param n_samples Number of samples taken for each candidate.
+
+    The candidates are ordered by their sample center, with the lowest parameter index breaking a
+    tie so that the ranking matches computeOptimalParameterIndex().
+*/
+template<size_t n_dimensions>
+void Autotuner<n_dimensions>::rankCandidates(unsigned int n_samples)
+    {
+    for (auto i : m_candidates)
+        {
+        m_sample_center[i] = computeSampleCenter(
+            std::vector<float>(m_samples[i].begin(), m_samples[i].begin() + n_samples));
+        }
+
+    std::sort(m_candidates.begin(),
+              m_candidates.end(),
+              [this](size_t a, size_t b)
+              {
+                  return m_sample_center[a] < m_sample_center[b]
+                         || (m_sample_center[a] == m_sample_center[b] && a < b);
+              });
+    }
+
+/*! \param v Samples to summarize.
+    \returns The average, maximum, or median of the samples, depending on the sampling mode.
+*/
+template<size_t n_dimensions>
+float Autotuner<n_dimensions>::computeSampleCenter(std::vector<float> v) const
+    {
+    if (m_mode == mode_avg)
+        {
+        // Compute average.
+        float sum = 0.0f;
+        for (std::vector<float>::iterator it = v.begin(); it != v.end(); ++it)
+            sum += *it;
+        return sum / float(v.size());
+        }
+    else if (m_mode == mode_max)
+        {
+        // Compute maximum.
+        float max_value = -FLT_MIN;
+        for (std::vector<float>::iterator it = v.begin(); it != v.end(); ++it)
+            {
+            if (*it > max_value)
+                {
+                max_value = *it;
+                }
+            }
+        return max_value;
+        }
+    else
+        {
+        // Compute median.
+        size_t n = v.size() / 2;
+        nth_element(v.begin(), v.begin() + n, v.end());
+        return v[n];
+        }
+    }
+
     } // end namespace hoomd
 
 #endif // _AUTOTUNER_H_
@@ -11,6 +11,9 @@
 
 #include <pybind11/numpy.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 #ifdef ENABLE_HIP
 #include "BondedGroupData.cuh"
 #include "CachedAllocator.h"
@@ -62,9 +65,9 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
 
     // connect to particle sort signal
     m_pdata->getParticleSortSignal()
-        .template connect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                          &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template connect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -104,9 +107,9 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::BondedGroupData(
 
     // connect to particle sort signal
     m_pdata->getParticleSortSignal()
-        .template connect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                          &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template connect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 
     // initialize from snapshot
     initializeFromSnapshot(snapshot);
@@ -128,9 +131,9 @@ template<unsigned int group_size, typename Group, const char* name, bool has_typ
 BondedGroupData<group_size, Group, name, has_type_mapping>::~BondedGroupData()
     {
     m_pdata->getParticleSortSignal()
-        .template disconnect<BondedGroupData<group_size, Group, name, has_type_mapping>,
-                             &BondedGroupData<group_size, Group, name, has_type_mapping>::setDirty>(
-            this);
+        .template disconnect<
+            BondedGroupData<group_size, Group, name, has_type_mapping>,
+            &BondedGroupData<group_size, Group, name, has_type_mapping>::slotParticleSort>(this);
 #ifdef ENABLE_MPI
     m_pdata->getSingleParticleMoveSignal()
         .template disconnect<
@@ -229,7 +232,7 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromS
     const Snapshot& snapshot)
     {
     // check that all fields in the snapshot have correct length
-    if (m_exec_conf->getRank() == 0)
+    if (m_exec_conf->getRank() == 0 || snapshot.is_distributed)
         {
         snapshot.validate();
         }
@@ -247,7 +250,11 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromS
     initialize();
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->getDomainDecomposition() && snapshot.is_distributed)
+        {
+        initializeFromDistributedSnapshot(snapshot);
+        }
+    else if (m_pdata->getDomainDecomposition())
         {
         // broadcast to all processors (temporarily)
         std::vector<members_t> all_groups;
@@ -318,6 +325,188 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromS
         }
     }
 
+#ifdef ENABLE_MPI
+/*! \param snapshot The slice of the groups on this rank
+
+    The groups on rank r follow those on rank r - 1 in tag order. Each rank sends its groups only to
+    the ranks that own a member particle. To find these ranks, every rank records the owners of a
+    contiguous block of particle tags, so no rank needs the full list of groups or particles.
+
+    \pre The particle data is initialized.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::initializeFromDistributedSnapshot(
+    const Snapshot& snapshot)
+    {
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    const unsigned int n_ranks = m_exec_conf->getNRanks();
+    const unsigned int my_rank = m_exec_conf->getRank();
+
+    m_type_mapping = snapshot.type_mapping;
+    bcast(m_type_mapping, 0, mpi_comm);
+
+    // the tags of the groups on this rank follow those on the lower ranks
+    unsigned int n_local = (unsigned int)snapshot.groups.size();
+    unsigned int tag_offset = 0;
+    MPI_Exscan(&n_local, &tag_offset, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+    if (my_rank == 0)
+        tag_offset = 0;
+    unsigned int n_global = n_local;
+    MPI_Allreduce(MPI_IN_PLACE, &n_global, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+
+    // validate the groups on all ranks before communicating, then fail together
+    const unsigned int n_particles = m_pdata->getNGlobal();
+    unsigned int n_invalid = 0;
+    for (unsigned int i = 0; i < n_local; i++)
+        {
+        const members_t& members = snapshot.groups[i];
+        for (unsigned int j = 0; j < group_size; j++)
+            {
+            if (members.tag[j] >= n_particles)
+                n_invalid++;
+            for (unsigned int k = 0; k < j; k++)
+                if (members.tag[j] == members.tag[k])
+                    n_invalid++;
+            }
+        if (has_type_mapping && snapshot.type_id[i] >= m_type_mapping.size())
+            n_invalid++;
+        }
+    MPI_Allreduce(MPI_IN_PLACE, &n_invalid, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+    if (n_invalid > 0)
+        {
+        std::ostringstream s;
+        s << "Invalid particle tags, repeated particles, or invalid types in " << n_invalid << " "
+          << name << " members of the distributed snapshot.";
+        throw runtime_error(s.str());
+        }
+
+    // rank r records the owners of the particle tags [r * block, (r + 1) * block)
+    const unsigned int block = std::max(1u, (n_particles + n_ranks - 1) / n_ranks);
+    std::vector<std::vector<unsigned int>> owned_tags(n_ranks);
+        {
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
+        for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+            owned_tags[h_tag.data[idx] / block].push_back(h_tag.data[idx]);
+        }
+    std::vector<std::vector<unsigned int>> recv_owned_tags;
+    all_to_all_v(owned_tags, recv_owned_tags, mpi_comm);
+    owned_tags.clear();
+
+    std::vector<unsigned int> block_owner(block, 0);
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        for (unsigned int tag : recv_owned_tags[rank])
+            block_owner[tag - my_rank * block] = rank;
+    recv_owned_tags.clear();
+
+    // look up the owners of the member particles
+    std::vector<std::vector<unsigned int>> queries(n_ranks);
+    for (const members_t& members : snapshot.groups)
+        for (unsigned int j = 0; j < group_size; j++)
+            queries[members.tag[j] / block].push_back(members.tag[j]);
+    for (auto& rank_queries : queries)
+        {
+        std::sort(rank_queries.begin(), rank_queries.end());
+        rank_queries.erase(std::unique(rank_queries.begin(), rank_queries.end()),
+                           rank_queries.end());
+        }
+
+    std::vector<std::vector<unsigned int>> recv_queries;
+    all_to_all_v(queries, recv_queries, mpi_comm);
+    std::vector<std::vector<unsigned int>> answers(n_ranks);
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        for (unsigned int tag : recv_queries[rank])
+            answers[rank].push_back(block_owner[tag - my_rank * block]);
+    recv_queries.clear();
+    block_owner.clear();
+
+    std::vector<std::vector<unsigned int>> recv_answers;
+    all_to_all_v(answers, recv_answers, mpi_comm);
+    answers.clear();
+
+    std::unordered_map<unsigned int, unsigned int> member_rank;
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        for (unsigned int i = 0; i < queries[rank].size(); i++)
+            member_rank[queries[rank][i]] = recv_answers[rank][i];
+    queries.clear();
+    recv_answers.clear();
+
+    // send each group once to every rank that owns one of its members
+    std::vector<std::vector<unsigned int>> send_group_tags(n_ranks);
+    std::vector<std::vector<members_t>> send_groups(n_ranks);
+    std::vector<std::vector<typeval_t>> send_typevals(n_ranks);
+    for (unsigned int i = 0; i < n_local; i++)
+        {
+        const members_t& members = snapshot.groups[i];
+        typeval_t t;
+        if (has_type_mapping)
+            t.type = snapshot.type_id[i];
+        else
+            t.val = snapshot.val[i];
+
+        unsigned int ranks[group_size];
+        for (unsigned int j = 0; j < group_size; j++)
+            {
+            ranks[j] = member_rank[members.tag[j]];
+            if (std::find(ranks, ranks + j, ranks[j]) != ranks + j)
+                continue;
+
+            send_group_tags[ranks[j]].push_back(tag_offset + i);
+            send_groups[ranks[j]].push_back(members);
+            send_typevals[ranks[j]].push_back(t);
+            }
+        }
+
+    std::vector<std::vector<unsigned int>> recv_group_tags;
+    std::vector<std::vector<members_t>> recv_groups;
+    std::vector<std::vector<typeval_t>> recv_typevals;
+    all_to_all_v(send_group_tags, recv_group_tags, mpi_comm);
+    all_to_all_v(send_groups, recv_groups, mpi_comm);
+    all_to_all_v(send_typevals, recv_typevals, mpi_comm);
+
+    // store the local groups in tag order
+    std::vector<std::pair<unsigned int, std::pair<unsigned int, unsigned int>>> order;
+    for (unsigned int rank = 0; rank < n_ranks; rank++)
+        for (unsigned int i = 0; i < recv_group_tags[rank].size(); i++)
+            order.push_back(std::make_pair(recv_group_tags[rank][i], std::make_pair(rank, i)));
+    std::sort(order.begin(), order.end());
+
+    m_nglobal = n_global;
+    m_group_rtag.resize(n_global, GROUP_NOT_LOCAL);
+    for (unsigned int tag = 0; tag < n_global; tag++)
+        m_tag_set.insert(m_tag_set.end(), tag);
+
+        {
+        ArrayHandle<unsigned int> h_group_rtag(m_group_rtag,
+                                               access_location::host,
+                                               access_mode::readwrite);
+        ranks_t r;
+        for (unsigned int j = 0; j < group_size; j++)
+            r.idx[j] = 0;
+
+        for (const auto& entry : order)
+            {
+            unsigned int rank = entry.second.first;
+            unsigned int i = entry.second.second;
+
+            h_group_rtag.data[entry.first] = m_n_groups;
+            m_groups.push_back(recv_groups[rank][i]);
+            m_group_typeval.push_back(recv_typevals[rank][i]);
+            m_group_tag.push_back(entry.first);
+            m_group_ranks.push_back(r);
+            m_n_groups++;
+            }
+        }
+
+    m_invalid_cached_tags = true;
+
+    // notify observers
+    m_group_num_change_signal.emit();
+    notifyGroupReorder();
+    }
+#endif
+
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 unsigned int BondedGroupData<group_size, Group, name, has_type_mapping>::addBondedGroup(Group g)
     {
@@ -880,6 +1069,107 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable
         }
     }
 
+/*! The particle sort places particles that are close in space next to each other in memory.
+    Reordering the local groups the same way lets the group loops on the CPU, and the GPU table
+    built from the groups, read the particle data in nearly sequential order. Ghost groups are
+    appended after the local groups and keep their order.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::sortGroups()
+    {
+    unsigned int n_groups = m_n_groups;
+    if (n_groups < 2)
+        return;
+
+    // sort keys: particle index of the first member, then the current group index
+    std::vector<std::pair<unsigned int, unsigned int>> order(n_groups);
+        {
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+
+        for (unsigned int group_idx = 0; group_idx < n_groups; ++group_idx)
+            {
+            order[group_idx]
+                = std::make_pair(h_rtag.data[h_groups.data[group_idx].tag[0]], group_idx);
+            }
+        }
+
+    if (std::is_sorted(order.begin(), order.end()))
+        return;
+
+    std::sort(order.begin(), order.end());
+
+    unsigned int n_total = (unsigned int)m_groups.size();
+    m_groups_alt.resize(n_total);
+    m_group_typeval_alt.resize(n_total);
+    m_group_tag_alt.resize(n_total);
+
+        {
+        ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+        ArrayHandle<typeval_t> h_typeval(m_group_typeval, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_group_tag(m_group_tag,
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<members_t> h_groups_alt(m_groups_alt,
+                                            access_location::host,
+                                            access_mode::overwrite);
+        ArrayHandle<typeval_t> h_typeval_alt(m_group_typeval_alt,
+                                             access_location::host,
+                                             access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_tag_alt(m_group_tag_alt,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+        ArrayHandle<unsigned int> h_group_rtag(m_group_rtag,
+                                               access_location::host,
+                                               access_mode::readwrite);
+
+        for (unsigned int group_idx = 0; group_idx < n_total; ++group_idx)
+            {
+            unsigned int old_idx = group_idx < n_groups ? order[group_idx].second : group_idx;
+            h_groups_alt.data[group_idx] = h_groups.data[old_idx];
+            h_typeval_alt.data[group_idx] = h_typeval.data[old_idx];
+
+            unsigned int tag = h_group_tag.data[old_idx];
+            h_group_tag_alt.data[group_idx] = tag;
+            if (group_idx < n_groups)
+                h_group_rtag.data[tag] = group_idx;
+            }
+        }
+
+    m_groups.swap(m_groups_alt);
+    m_group_typeval.swap(m_group_typeval_alt);
+    m_group_tag.swap(m_group_tag_alt);
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        m_group_ranks_alt.resize(n_total);
+
+            {
+            ArrayHandle<ranks_t> h_group_ranks(m_group_ranks,
+                                               access_location::host,
+                                               access_mode::read);
+            ArrayHandle<ranks_t> h_group_ranks_alt(m_group_ranks_alt,
+                                                   access_location::host,
+                                                   access_mode::overwrite);
+
+            for (unsigned int group_idx = 0; group_idx < n_total; ++group_idx)
+                {
+                unsigned int old_idx = group_idx < n_groups ? order[group_idx].second : group_idx;
+                h_group_ranks_alt.data[group_idx] = h_group_ranks.data[old_idx];
+                }
+            }
+
+        m_group_ranks.swap(m_group_ranks_alt);
+        }
+#endif
+
+    // the tag cache is ordered by tag and does not depend on the group order
+    notifyGroupReorder();
+    }
+
 #ifdef ENABLE_HIP
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTableGPU()
@@ -1134,6 +1424,39 @@ BondedGroupData<group_size, Group, name, has_type_mapping>::takeSnapshot(Snapsho
     return index;
     }
 
+/*! \param snapshot Snapshot to compare with
+    \returns true when initializeFromSnapshot(snapshot) would leave the groups unchanged
+
+    Call on all ranks, the result is only valid on the root rank in domain decomposition.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+bool BondedGroupData<group_size, Group, name, has_type_mapping>::matchesSnapshot(
+    const Snapshot& snapshot) const
+    {
+    Snapshot current;
+    takeSnapshot(current);
+
+    if (snapshot.is_distributed || snapshot.size != current.size
+        || snapshot.groups.size() != current.groups.size()
+        || (has_type_mapping && snapshot.type_mapping != current.type_mapping)
+        || (has_type_mapping && snapshot.type_id != current.type_id)
+        || (!has_type_mapping && snapshot.val != current.val))
+        {
+        return false;
+        }
+
+    for (unsigned int group_idx = 0; group_idx < current.size; group_idx++)
+        {
+        for (unsigned int j = 0; j < group_size; j++)
+            {
+            if (snapshot.groups[group_idx].tag[j] != current.groups[group_idx].tag[j])
+                return false;
+            }
+        }
+
+    return true;
+    }
+
 #ifdef ENABLE_MPI
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::moveParticleGroups(
@@ -1367,39 +1690,65 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::Snapshot::repli
     unsigned int n,
     unsigned int old_n_particles)
     {
-    unsigned int old_size = size;
+    replicateImages(old_n_particles, 0, n);
+    }
+
+/*! \param old_n_particles Number of particles in system to be replicated
+    \param image_begin First image to keep
+    \param image_end One past the last image to keep
+
+    The copies of the groups in image j refer to the particle tags offset by j * old_n_particles.
+    The snapshot keeps only the images [image_begin, image_end) in image order.
+*/
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::Snapshot::replicateImages(
+    unsigned int old_n_particles,
+    unsigned int image_begin,
+    unsigned int image_end)
+    {
+    assert(image_begin <= image_end);
+    const unsigned int old_size = size;
+    const unsigned int n = image_end - image_begin;
+
+    // copy the unit cell, the images overwrite it
+    const std::vector<members_t> old_groups(groups.begin(), groups.begin() + old_size);
+    std::vector<unsigned int> old_type_id;
+    std::vector<Scalar> old_val;
+
     groups.resize(n * old_size);
     if (has_type_mapping)
         {
+        old_type_id.assign(type_id.begin(), type_id.begin() + old_size);
         type_id.resize(n * old_size);
         }
     else
         {
+        old_val.assign(val.begin(), val.begin() + old_size);
         val.resize(n * old_size);
         }
 
     for (unsigned int i = 0; i < old_size; ++i)
         {
-        typename BondedGroupData<group_size, Group, name, has_type_mapping>::members_t g;
-        g = groups[i];
+        const members_t& g = old_groups[i];
 
         // replicate bonded group
-        for (unsigned int j = 0; j < n; ++j)
+        for (unsigned int j = image_begin; j < image_end; ++j)
             {
-            typename BondedGroupData<group_size, Group, name, has_type_mapping>::members_t h;
+            members_t h;
 
             // update particle tags
             for (unsigned int k = 0; k < group_size; ++k)
                 h.tag[k] = g.tag[k] + old_n_particles * j;
 
-            groups[old_size * j + i] = h;
+            const unsigned int out = old_size * (j - image_begin) + i;
+            groups[out] = h;
             if (has_type_mapping)
                 {
-                type_id[old_size * j + i] = type_id[i];
+                type_id[out] = old_type_id[i];
                 }
             else
                 {
-                val[old_size * j + i] = val[i];
+                val[out] = old_val[i];
                 }
             }
         }
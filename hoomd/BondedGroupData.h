@@ -220,6 +220,11 @@ class BondedGroupData
          */
         void replicate(unsigned int n, unsigned int old_n_particles);
 
+        //! Replicate this snapshot and keep a contiguous range of the images
+        void replicateImages(unsigned int old_n_particles,
+                             unsigned int image_begin,
+                             unsigned int image_end);
+
 #ifdef ENABLE_MPI
         //! Broadcast the snapshot
         /*! \param root the processor to send from
@@ -252,6 +257,9 @@ class BondedGroupData
         std::vector<members_t> groups;         //!< Stores the data for each group
         std::vector<std::string> type_mapping; //!< Names of group types
         unsigned int size;                     //!< Number of bonds in the snapshot
+
+        //! True when every rank holds a slice of the groups, in rank order
+        bool is_distributed = false;
         };
 
     //! Constructor for MeshGroupData
@@ -274,6 +282,9 @@ class BondedGroupData
     //! Take a snapshot
     std::map<unsigned int, unsigned int> takeSnapshot(Snapshot& snapshot) const;
 
+    //! Test if a snapshot holds the same groups as this object
+    bool matchesSnapshot(const Snapshot& snapshot) const;
+
     //! Get local number of bonded groups
     unsigned int getN() const
         {
@@ -627,6 +638,16 @@ class BondedGroupData
         m_groups_dirty = true;
         }
 
+    //! Sort the local groups by the particle index of their first member
+    void sortGroups();
+
+    //! Reorder the groups and rebuild the GPU table after the particles are sorted
+    void slotParticleSort()
+        {
+        sortGroups();
+        setDirty();
+        }
+
 #ifdef ENABLE_MPI
     //! Helper function to transfer bonded groups connected to a single particle
     /*! \param tag Tag of particle that moves between domains
@@ -634,6 +655,9 @@ class BondedGroupData
         \param new_rank New MPI rank
      */
     virtual void moveParticleGroups(unsigned int tag, unsigned int old_rank, unsigned int new_rank);
+
+    //! Initialize from a snapshot that is distributed over the ranks
+    void initializeFromDistributedSnapshot(const Snapshot& snapshot);
 #endif
 
     protected:
@@ -0,0 +1,140 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "BufferedLogWriter.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string.h>
+
+/*! \file BufferedLogWriter.cc
+    \brief Defines the BufferedLogWriter class
+*/
+
+namespace hoomd
+    {
+/*! \param sysdef System definition
+    \param trigger Trigger that selects the frames to log
+    \param writer Python writer with the `flags` and `buffer_size` attributes and the `_log()`
+    and `_write_columns()` methods
+*/
+BufferedLogWriter::BufferedLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<Trigger> trigger,
+                                     pybind11::object writer)
+    : PythonAnalyzer(sysdef, trigger, writer)
+    {
+    m_buffer_size = writer.attr("buffer_size").cast<unsigned int>();
+    if (m_buffer_size == 0)
+        {
+        throw std::domain_error("buffer_size must be positive.");
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void BufferedLogWriter::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+    pybind11::gil_scoped_acquire acquire;
+
+    // loggables may need all ranks
+    pybind11::dict values = m_analyzer.attr("_log")().cast<pybind11::dict>();
+    if (!m_exec_conf->isRoot())
+        {
+        return;
+        }
+
+    // the first frame determines the layout of the columns
+    bool first_frame = m_columns.empty() && m_n_frames == 0;
+    if (!first_frame && values.size() != m_columns.size())
+        {
+        throw std::runtime_error("The logged quantities cannot change within a file.");
+        }
+    if (first_frame)
+        {
+        m_columns.resize(values.size());
+        }
+
+    size_t i = 0;
+    for (auto item = values.begin(); item != values.end(); ++item, ++i)
+        {
+        Column& column = m_columns[i];
+        std::string name = pybind11::cast<std::string>(item->first);
+        pybind11::array value = pybind11::array::ensure(item->second, pybind11::array::c_style);
+        if (!value || std::string("biufc").find(value.dtype().kind()) == std::string::npos)
+            {
+            throw std::runtime_error("Cannot log " + name + ", it is not numeric.");
+            }
+
+        if (first_frame)
+            {
+            column.name = name;
+            column.dtype = value.dtype();
+            column.shape.assign(value.shape(), value.shape() + value.ndim());
+            column.value_size = value.nbytes();
+            }
+        else if (name != column.name || size_t(value.ndim()) != column.shape.size()
+                 || !std::equal(column.shape.begin(), column.shape.end(), value.shape()))
+            {
+            throw std::runtime_error("The logged quantities cannot change within a file.");
+            }
+
+        // store the values with the type of the first frame
+        if (value.dtype().kind() != column.dtype.kind()
+            || value.dtype().itemsize() != column.dtype.itemsize())
+            {
+            value = pybind11::array::ensure(value.attr("astype")(column.dtype),
+                                            pybind11::array::c_style);
+            }
+
+        size_t offset = column.data.size();
+        column.data.resize(offset + column.value_size);
+        memcpy(column.data.data() + offset, value.data(), column.value_size);
+        }
+
+    m_n_frames++;
+    if (m_n_frames >= m_buffer_size)
+        {
+        flush();
+        }
+    }
+
+/*! Pass each buffered column to the writer as a numpy array with one row per frame. The column
+    buffers keep their capacity, so buffering the next chunk does not allocate memory.
+*/
+void BufferedLogWriter::flush()
+    {
+    if (m_n_frames == 0)
+        {
+        return;
+        }
+
+    pybind11::dict columns;
+    for (Column& column : m_columns)
+        {
+        std::vector<ssize_t> shape(1, m_n_frames);
+        shape.insert(shape.end(), column.shape.begin(), column.shape.end());
+        columns[column.name.c_str()] = pybind11::array(column.dtype, shape, column.data.data());
+        column.data.resize(0);
+        }
+
+    unsigned int n_frames = m_n_frames;
+    m_n_frames = 0;
+    m_analyzer.attr("_write_columns")(columns, n_frames);
+    }
+
+namespace detail
+    {
+void export_BufferedLogWriter(pybind11::module& m)
+    {
+    pybind11::class_<BufferedLogWriter, PythonAnalyzer, std::shared_ptr<BufferedLogWriter>>(
+        m,
+        "BufferedLogWriter")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            pybind11::object>())
+        .def("flush", &BufferedLogWriter::flush)
+        .def_property_readonly("num_buffered_frames", &BufferedLogWriter::getNumBufferedFrames);
+    }
+    } // end namespace detail
+    } // end namespace hoomd
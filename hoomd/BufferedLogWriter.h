@@ -0,0 +1,77 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "PythonAnalyzer.h"
+
+#include <string>
+#include <vector>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+/*! \file BufferedLogWriter.h
+    \brief Declares the BufferedLogWriter class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+/// Buffer logged quantities in memory and pass them to a python writer in chunks.
+/** On each call to analyze(), BufferedLogWriter evaluates the loggables with the writer's `_log()`
+    method, which returns a dict that maps names to scalar or array values. BufferedLogWriter
+    appends each value to a typed column buffer. After `buffer_size` frames, or when flush() is
+    called, it passes the buffered frames to the writer's `_write_columns(columns, n_frames)` method.
+    Each column is a numpy array with one row per frame. The writer then pays the cost of writing
+    to the file once per chunk instead of once per frame.
+
+    The loggables are evaluated on all ranks. Only the root rank buffers the values and writes them.
+
+    The names, shapes, and types of the logged quantities must not change from frame to frame.
+*/
+class PYBIND11_EXPORT BufferedLogWriter : public PythonAnalyzer
+    {
+    public:
+    /// Construct the writer.
+    BufferedLogWriter(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<Trigger> trigger,
+                      pybind11::object writer);
+
+    /// Buffer the logged quantities of the current frame.
+    void analyze(uint64_t timestep) override;
+
+    /// Pass the buffered frames to the writer.
+    void flush();
+
+    /// Get the number of buffered frames.
+    unsigned int getNumBufferedFrames() const
+        {
+        return m_n_frames;
+        }
+
+    protected:
+    /// Buffered values of a single logged quantity.
+    struct Column
+        {
+        std::string name;           //!< Name of the quantity
+        pybind11::dtype dtype;      //!< Type of the values
+        std::vector<ssize_t> shape; //!< Shape of a single value, empty for scalars
+        size_t value_size;          //!< Size of a single value in bytes
+        std::vector<char> data;     //!< Values of the buffered frames
+        };
+
+    std::vector<Column> m_columns; //!< Buffered quantities
+    unsigned int m_buffer_size;    //!< Number of frames to buffer before writing
+    unsigned int m_n_frames = 0;   //!< Number of buffered frames
+    };
+
+namespace detail
+    {
+/// Export BufferedLogWriter to python.
+void export_BufferedLogWriter(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace hoomd
@@ -19,7 +19,8 @@ namespace hoomd
 CellList::CellList(std::shared_ptr<SystemDefinition> sysdef)
     : Compute(sysdef), m_nominal_width(Scalar(1.0)), m_radius(1), m_compute_xyzf(true),
       m_compute_type_body(false), m_compute_orientation(false), m_compute_idx(false),
-      m_flag_charge(false), m_flag_type(false), m_sort_cell_list(false), m_compute_adj_list(true)
+      m_flag_charge(false), m_flag_type(false), m_sort_cell_list(false), m_compute_adj_list(true),
+      m_filter_types(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing CellList" << endl;
 
@@ -133,6 +134,7 @@ uint3 CellList::computeDimensions()
 void CellList::compute(uint64_t timestep)
     {
     Compute::compute(timestep);
+    ScopedOperationTimer timer(m_timer, typeid(*this));
     bool force = false;
 
     m_exec_conf->msg->notice(10) << "Cell list compute" << endl;
@@ -199,6 +201,41 @@ void CellList::compute(uint64_t timestep)
         }
     }
 
+/*! \param type_mask One entry per particle type, nonzero to place the particles of that type in
+    the cell list. An empty mask places all particles in the cell list.
+
+    Several cell lists with disjoint masks partition the particles, so that each can use a cell
+    width suited to the types it holds.
+*/
+void CellList::setTypeMask(const std::vector<unsigned int>& type_mask)
+    {
+    if (type_mask.empty())
+        {
+        m_filter_types = false;
+        m_params_changed = true;
+        return;
+        }
+
+    if (type_mask.size() != m_pdata->getNTypes())
+        {
+        throw std::runtime_error("Cell list type mask must have one entry per particle type.");
+        }
+
+    if (m_type_mask.getNumElements() != type_mask.size())
+        {
+        GlobalArray<unsigned int> new_type_mask(type_mask.size(), m_exec_conf);
+        m_type_mask.swap(new_type_mask);
+        TAG_ALLOCATION(m_type_mask);
+        }
+
+    ArrayHandle<unsigned int> h_type_mask(m_type_mask,
+                                          access_location::host,
+                                          access_mode::overwrite);
+    std::copy(type_mask.begin(), type_mask.end(), h_type_mask.data);
+    m_filter_types = true;
+    m_params_changed = true;
+    }
+
 void CellList::initializeAll()
     {
     initializeWidth();
@@ -230,7 +267,13 @@ void CellList::initializeMemory()
     m_exec_conf->msg->notice(10) << "Cell list initialize memory" << endl;
 
     // if it is still set at 0, estimate Nmax
-    if (m_Nmax == 0)
+    if (m_Nmax == 0 && m_filter_types)
+        {
+        // the average occupancy of all particles would overestimate a cell list that holds only
+        // some types, the first compute() grows Nmax to the peak occupancy instead
+        m_Nmax = 1;
+        }
+    else if (m_Nmax == 0)
         {
         unsigned int estim_Nmax
             = (unsigned int)(ceil(double((m_pdata->getN() + m_pdata->getNGhosts()) * 1.0
@@ -424,6 +467,7 @@ void CellList::computeCellList()
                                             access_mode::overwrite);
     ArrayHandle<unsigned int> h_cell_idx(m_idx, access_location::host, access_mode::overwrite);
     ArrayHandle<uint2> h_type_body(m_type_body, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_type_mask(m_type_mask, access_location::host, access_mode::read);
     uint3 conditions = make_uint3(0, 0, 0);
 
     // shorthand copies of the indexers
@@ -492,6 +536,10 @@ void CellList::computeCellList()
             continue;
             }
 
+        // skip the types that are not placed in this cell list
+        if (m_filter_types && !h_type_mask.data[__scalar_as_int(h_pos.data[n].w)])
+            continue;
+
         // setup the flag value to store
         Scalar flag;
         if (m_flag_charge)
@@ -553,10 +601,17 @@ bool CellList::checkConditions()
     uint3 conditions;
     conditions = readConditions();
 
-    // up m_Nmax to the overflow value, reallocate memory and set the overflow condition
+    // up m_Nmax past the overflow value, reallocate memory and set the overflow condition
     if (conditions.x > m_Nmax)
         {
-        m_Nmax = conditions.x;
+        // amortized resizing (growth factor: 9/8) so that a slowly growing cluster does not
+        // overflow and reallocate the cell list on every step
+        unsigned int Nmax = m_Nmax;
+        while (conditions.x > Nmax)
+            {
+            Nmax = ((unsigned int)(((float)Nmax) * 1.125f)) + 1;
+            }
+        m_Nmax = Nmax;
         result = true;
         }
 
@@ -9,6 +9,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 /*! \file CellList.h
     \brief Declares the CellList class
@@ -215,6 +216,9 @@ class PYBIND11_EXPORT CellList : public Compute
         m_params_changed = true;
         }
 
+    //! Only place particles of selected types in the cell list
+    void setTypeMask(const std::vector<unsigned int>& type_mask);
+
     //! Request a multi-GPU cell list
     virtual void setPerDevice(bool per_device)
         {
@@ -268,6 +272,16 @@ class PYBIND11_EXPORT CellList : public Compute
         return m_Nmax;
         }
 
+    //! Release the cell capacity reserved for a previous peak occupancy
+    /*! The next compute() estimates the capacity from the average occupancy and grows it to the
+        current peak occupancy.
+    */
+    void compactMemory()
+        {
+        m_Nmax = 0;
+        m_params_changed = true;
+        }
+
     //! Get width of ghost cells
     const Scalar3 getGhostWidth() const
         {
@@ -391,6 +405,9 @@ class PYBIND11_EXPORT CellList : public Compute
     bool m_sort_cell_list;   //!< If true, sort cell list
     bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
 
+    GlobalArray<unsigned int> m_type_mask; //!< Nonzero for the types placed in the cell list
+    bool m_filter_types;                   //!< If true, only place the types in m_type_mask
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
@@ -51,6 +51,10 @@ void CellListGPU::computeCellList()
                                      access_location::device,
                                      access_mode::read);
 
+    ArrayHandle<unsigned int> d_type_mask(m_type_mask,
+                                          access_location::device,
+                                          access_mode::read);
+
     BoxDim box = m_pdata->getBox();
     unsigned int ngpu = m_exec_conf->getNumActiveGPUs();
 
@@ -130,6 +134,7 @@ void CellListGPU::computeCellList()
             d_charge.data,
             d_diameter.data,
             d_body.data,
+            m_filter_types ? d_type_mask.data : NULL,
             m_pdata->getN(),
             m_pdata->getNGhosts(),
             m_Nmax,
@@ -27,6 +27,7 @@ namespace hoomd
     \param d_charge Particle charge array
     \param d_diameter Particle diameter array
     \param d_body Particle body array
+    \param d_type_mask Nonzero for the types to place in the cell list (NULL places all types)
     \param N Number of particles
     \param n_ghost Number of ghost particles
     \param Nmax Maximum number of particles that can be placed in a single cell
@@ -50,6 +51,7 @@ __global__ void gpu_compute_cell_list_kernel(unsigned int* d_cell_size,
                                              const Scalar* d_charge,
                                              const Scalar* d_diameter,
                                              const unsigned int* d_body,
+                                             const unsigned int* d_type_mask,
                                              const unsigned int N,
                                              const unsigned int n_ghost,
                                              const unsigned int Nmax,
@@ -145,6 +147,10 @@ __global__ void gpu_compute_cell_list_kernel(unsigned int* d_cell_size,
         return;
         }
 
+    // skip the types that are not placed in this cell list
+    if (d_type_mask != NULL && !d_type_mask[__scalar_as_int(type)])
+        return;
+
     unsigned int size = atomicInc(&d_cell_size[bin], 0xffffffff);
 
     if (size < Nmax)
@@ -181,6 +187,7 @@ void gpu_compute_cell_list(unsigned int* d_cell_size,
                            const Scalar* d_charge,
                            const Scalar* d_diameter,
                            const unsigned int* d_body,
+                           const unsigned int* d_type_mask,
                            const unsigned int N,
                            const unsigned int n_ghost,
                            const unsigned int Nmax,
@@ -229,6 +236,7 @@ void gpu_compute_cell_list(unsigned int* d_cell_size,
                            d_charge,
                            d_diameter,
                            d_body,
+                           d_type_mask,
                            N,
                            n_ghost,
                            Nmax,
@@ -55,6 +55,8 @@ void CellListStencil::compute(uint64_t timestep)
     if (!shouldCompute(timestep))
         return;
 
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+
     // sanity check that rstencil is correctly sized
     assert(m_rstencil.size() >= m_pdata->getNTypes());
 
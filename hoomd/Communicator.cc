@@ -12,6 +12,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdlib>
 #include <pybind11/stl.h>
 
 using namespace std;
@@ -44,6 +45,65 @@ void Communicator::GroupCommunicator<group_data>::setGroupData(std::shared_ptr<g
     assert(sizeof(unsigned int) * 8 >= group_data::size);
     }
 
+/*! \param send_lists Per-neighbor lists of elements to send, cleared on return
+    \param sendbuf Output: Concatenated send lists in neighbor order
+
+    Sets m_comm.m_begin and m_comm.m_end to the range of each neighbor in \a sendbuf.
+*/
+template<class group_data>
+template<class element_t>
+void Communicator::GroupCommunicator<group_data>::flattenSendLists(
+    std::vector<std::vector<element_t>>& send_lists,
+    std::vector<element_t>& sendbuf)
+    {
+    ArrayHandle<unsigned int> h_begin(m_comm.m_begin,
+                                      access_location::host,
+                                      access_mode::overwrite);
+    ArrayHandle<unsigned int> h_end(m_comm.m_end, access_location::host, access_mode::overwrite);
+
+    sendbuf.clear();
+    for (unsigned int ineigh = 0; ineigh < m_comm.m_n_unique_neigh; ++ineigh)
+        {
+        h_begin.data[ineigh] = (unsigned int)sendbuf.size();
+        sendbuf.insert(sendbuf.end(), send_lists[ineigh].begin(), send_lists[ineigh].end());
+        h_end.data[ineigh] = (unsigned int)sendbuf.size();
+
+        // keep the capacity for the next call
+        send_lists[ineigh].clear();
+        }
+    }
+
+/*! \param rank Rank to look up
+    \returns The index of \a rank in the list of unique neighbors, or m_comm.m_n_unique_neigh if
+             \a rank is not a neighbor
+*/
+template<class group_data>
+unsigned int Communicator::GroupCommunicator<group_data>::getNeighborIndex(unsigned int rank) const
+    {
+    auto it = std::lower_bound(m_neighbor_index.begin(),
+                               m_neighbor_index.end(),
+                               std::make_pair(rank, 0u));
+    if (it != m_neighbor_index.end() && it->first == rank)
+        return it->second;
+    return m_comm.m_n_unique_neigh;
+    }
+
+template<class group_data>
+void Communicator::GroupCommunicator<group_data>::updateNeighborIndex()
+    {
+    ArrayHandle<unsigned int> h_unique_neighbors(m_comm.m_unique_neighbors,
+                                                 access_location::host,
+                                                 access_mode::read);
+
+    m_neighbor_index.resize(m_comm.m_n_unique_neigh);
+    for (unsigned int ineigh = 0; ineigh < m_comm.m_n_unique_neigh; ++ineigh)
+        m_neighbor_index[ineigh] = std::make_pair(h_unique_neighbors.data[ineigh], ineigh);
+    std::sort(m_neighbor_index.begin(), m_neighbor_index.end());
+
+    m_ranks_send_lists.resize(m_comm.m_n_unique_neigh);
+    m_groups_send_lists.resize(m_comm.m_n_unique_neigh);
+    }
+
 template<class group_data>
 void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                                                                 bool local_multiple)
@@ -69,9 +129,8 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
         // remove ghost groups
         m_gdata->removeAllGhostGroups();
 
-        // send map for rank updates
-        typedef std::multimap<unsigned int, rank_element_t> map_t;
-        map_t send_map;
+        // per-neighbor send lists for rank updates
+        updateNeighborIndex();
 
             {
             ArrayHandle<unsigned int> h_comm_flags(m_comm.m_pdata->getCommFlags(),
@@ -206,7 +265,7 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                     if (incomplete)
                         // in initialization, send to all neighbors
                         for (unsigned int ineigh = 0; ineigh < m_comm.m_n_unique_neigh; ineigh++)
-                            send_map.insert(std::make_pair(h_unique_neighbors.data[ineigh], el));
+                            m_ranks_send_lists[ineigh].push_back(el);
                     else
                         // send to other ranks owning the bonded group
                         for (unsigned int j = 0; j < group_size; ++j)
@@ -215,41 +274,18 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                             bool rank_updated = mask & (1 << j);
                             // send out to ranks different from ours
                             if (rank != my_rank && !rank_updated)
-                                send_map.insert(std::make_pair(rank, el));
+                                {
+                                unsigned int ineigh = getNeighborIndex(rank);
+                                if (ineigh < m_comm.m_n_unique_neigh)
+                                    m_ranks_send_lists[ineigh].push_back(el);
+                                }
                             }
                     }
                 } // end loop over groups
             }     // end ArrayHandle scope
 
-        // clear send buffer
-        m_ranks_sendbuf.clear();
-
-            {
-            // output send data sorted by rank
-            for (typename map_t::iterator it = send_map.begin(); it != send_map.end(); ++it)
-                {
-                m_ranks_sendbuf.push_back(it->second);
-                }
-
-            ArrayHandle<unsigned int> h_unique_neighbors(m_comm.m_unique_neighbors,
-                                                         access_location::host,
-                                                         access_mode::read);
-            ArrayHandle<unsigned int> h_begin(m_comm.m_begin,
-                                              access_location::host,
-                                              access_mode::overwrite);
-            ArrayHandle<unsigned int> h_end(m_comm.m_end,
-                                            access_location::host,
-                                            access_mode::overwrite);
-
-            // Find start and end indices
-            for (unsigned int i = 0; i < m_comm.m_n_unique_neigh; ++i)
-                {
-                typename map_t::iterator lower = send_map.lower_bound(h_unique_neighbors.data[i]);
-                typename map_t::iterator upper = send_map.upper_bound(h_unique_neighbors.data[i]);
-                h_begin.data[i] = (unsigned int)std::distance(send_map.begin(), lower);
-                h_end.data[i] = (unsigned int)std::distance(send_map.begin(), upper);
-                }
-            }
+        // output send data in neighbor order
+        flattenSendLists(m_ranks_send_lists, m_ranks_sendbuf);
 
         /*
          * communicate rank information (phase 1)
@@ -395,9 +431,6 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                 }
             }
 
-        // send map for groups
-        typedef std::multimap<unsigned int, group_element_t> group_map_t;
-        group_map_t group_send_map;
 
             {
             ArrayHandle<typename group_data::members_t> h_groups(m_gdata->getMembersArray(),
@@ -455,7 +488,11 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
                     for (unsigned int i = 0; i < group_size; ++i)
                         // are we sending to this rank?
                         if (mask & (1 << i))
-                            group_send_map.insert(std::make_pair(el.ranks.idx[i], el));
+                            {
+                            unsigned int ineigh = getNeighborIndex(el.ranks.idx[i]);
+                            if (ineigh < m_comm.m_n_unique_neigh)
+                                m_groups_send_lists[ineigh].push_back(el);
+                            }
 
                     // does this group still have local members
                     bool is_local = false;
@@ -550,38 +587,8 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
 
         assert(m_gdata->getN() == new_ngroups);
 
-        // reset send buf
-        m_groups_sendbuf.clear();
-
-        // output groups to send buffer in rank-sorted order
-        for (typename group_map_t::iterator it = group_send_map.begin(); it != group_send_map.end();
-             ++it)
-            {
-            m_groups_sendbuf.push_back(it->second);
-            }
-
-            {
-            ArrayHandle<unsigned int> h_unique_neighbors(m_comm.m_unique_neighbors,
-                                                         access_location::host,
-                                                         access_mode::read);
-            ArrayHandle<unsigned int> h_begin(m_comm.m_begin,
-                                              access_location::host,
-                                              access_mode::overwrite);
-            ArrayHandle<unsigned int> h_end(m_comm.m_end,
-                                            access_location::host,
-                                            access_mode::overwrite);
-
-            // Find start and end indices
-            for (unsigned int i = 0; i < m_comm.m_n_unique_neigh; ++i)
-                {
-                typename group_map_t::iterator lower
-                    = group_send_map.lower_bound(h_unique_neighbors.data[i]);
-                typename group_map_t::iterator upper
-                    = group_send_map.upper_bound(h_unique_neighbors.data[i]);
-                h_begin.data[i] = (unsigned int)std::distance(group_send_map.begin(), lower);
-                h_end.data[i] = (unsigned int)std::distance(group_send_map.begin(), upper);
-                }
-            }
+        // output groups to send buffer in neighbor order
+        flattenSendLists(m_groups_send_lists, m_groups_sendbuf);
 
         /*
          * communicate groups (phase 2)
@@ -693,18 +700,18 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
             MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &stats.front());
             }
 
-        // use a std::map, i.e. single-key, to filter out duplicate groups in input buffer
-        typedef std::map<unsigned int, group_element_t> recv_map_t;
-        recv_map_t recv_map;
-
-        for (unsigned int recv_idx = 0; recv_idx < n_recv_tot; recv_idx++)
-            {
-            group_element_t el = m_groups_recvbuf[recv_idx];
-            unsigned int tag = el.group_tag;
-            recv_map.insert(std::make_pair(tag, el));
-            }
+        // sort by group tag and filter out duplicate groups in input buffer, keeping the first copy
+        std::stable_sort(m_groups_recvbuf.begin(),
+                         m_groups_recvbuf.end(),
+                         [](const group_element_t& a, const group_element_t& b)
+                         { return a.group_tag < b.group_tag; });
+        auto recv_end = std::unique(m_groups_recvbuf.begin(),
+                                    m_groups_recvbuf.end(),
+                                    [](const group_element_t& a, const group_element_t& b)
+                                    { return a.group_tag == b.group_tag; });
+        m_groups_recvbuf.erase(recv_end, m_groups_recvbuf.end());
 
-        unsigned int n_recv_unique = (unsigned int)recv_map.size();
+        unsigned int n_recv_unique = (unsigned int)m_groups_recvbuf.size();
 
         unsigned int old_ngroups = m_gdata->getN();
 
@@ -740,9 +747,9 @@ void Communicator::GroupCommunicator<group_data>::migrateGroups(bool incomplete,
 
             // add non-duplicate groups to group data
             unsigned int add_idx = old_ngroups;
-            for (typename recv_map_t::iterator it = recv_map.begin(); it != recv_map.end(); ++it)
+            for (unsigned int recv_idx = 0; recv_idx < n_recv_unique; recv_idx++)
                 {
-                typename group_data::packed_t el = it->second;
+                typename group_data::packed_t el = m_groups_recvbuf[recv_idx];
 
                 unsigned int tag = el.group_tag;
                 unsigned int group_rtag = h_group_rtag.data[tag];
@@ -1296,48 +1303,148 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
     m_end.swap(end);
 
     initializeNeighborArrays();
+    initializeSharedMemory();
 
     /* create a type for pdata_element */
-    const int nitems = 14;
-    int blocklengths[14] = {4, 4, 3, 1, 1, 3, 1, 4, 4, 3, 1, 4, 4, 6};
-    MPI_Datatype types[14] = {MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_INT,
-                              MPI_UNSIGNED,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_UNSIGNED,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR,
-                              MPI_HOOMD_SCALAR};
-    MPI_Aint offsets[14];
-
-    offsets[0] = offsetof(detail::pdata_element, pos);
-    offsets[1] = offsetof(detail::pdata_element, vel);
-    offsets[2] = offsetof(detail::pdata_element, accel);
-    offsets[3] = offsetof(detail::pdata_element, charge);
-    offsets[4] = offsetof(detail::pdata_element, diameter);
-    offsets[5] = offsetof(detail::pdata_element, image);
-    offsets[6] = offsetof(detail::pdata_element, body);
-    offsets[7] = offsetof(detail::pdata_element, orientation);
-    offsets[8] = offsetof(detail::pdata_element, angmom);
-    offsets[9] = offsetof(detail::pdata_element, inertia);
-    offsets[10] = offsetof(detail::pdata_element, tag);
-    offsets[11] = offsetof(detail::pdata_element, net_force);
-    offsets[12] = offsetof(detail::pdata_element, net_torque);
-    offsets[13] = offsetof(detail::pdata_element, net_virial);
+    m_mpi_pdata_element = createPdataElementType(migrate_all);
+    }
+
+/*! \param fields Bitwise or of the migrate_field values to include
+
+    The datatype always includes the position, velocity, acceleration, image, tag, and net force.
+*/
+MPI_Datatype Communicator::createPdataElementType(unsigned int fields)
+    {
+    std::vector<int> blocklengths;
+    std::vector<MPI_Datatype> types;
+    std::vector<MPI_Aint> offsets;
+    auto add = [&](int blocklength, MPI_Datatype type, size_t offset)
+    {
+        blocklengths.push_back(blocklength);
+        types.push_back(type);
+        offsets.push_back(offset);
+    };
+
+    add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, pos));
+    add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, vel));
+    add(3, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, accel));
+    if (fields & migrate_charge)
+        add(1, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, charge));
+    if (fields & migrate_diameter)
+        add(1, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, diameter));
+    add(3, MPI_INT, offsetof(detail::pdata_element, image));
+    if (fields & migrate_body)
+        add(1, MPI_UNSIGNED, offsetof(detail::pdata_element, body));
+    if (fields & migrate_orientation)
+        add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, orientation));
+    if (fields & migrate_angmom)
+        add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, angmom));
+    if (fields & migrate_inertia)
+        add(3, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, inertia));
+    add(1, MPI_UNSIGNED, offsetof(detail::pdata_element, tag));
+    add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, net_force));
+    if (fields & migrate_net_torque)
+        add(4, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, net_torque));
+    if (fields & migrate_net_virial)
+        add(6, MPI_HOOMD_SCALAR, offsetof(detail::pdata_element, net_virial));
 
     MPI_Datatype tmp;
-    MPI_Type_create_struct(nitems, blocklengths, offsets, types, &tmp);
+    MPI_Type_create_struct((int)blocklengths.size(),
+                           &blocklengths.front(),
+                           &offsets.front(),
+                           &types.front(),
+                           &tmp);
     MPI_Type_commit(&tmp);
 
-    MPI_Type_create_resized(tmp, 0, sizeof(detail::pdata_element), &m_mpi_pdata_element);
-    MPI_Type_commit(&m_mpi_pdata_element);
+    MPI_Datatype result;
+    MPI_Type_create_resized(tmp, 0, sizeof(detail::pdata_element), &result);
+    MPI_Type_commit(&result);
     MPI_Type_free(&tmp);
+    return result;
+    }
+
+/*! \param fields Bitwise or of the migrate_field values to include
+ */
+MPI_Datatype Communicator::getPdataElementType(unsigned int fields)
+    {
+    if (fields == migrate_all)
+        return m_mpi_pdata_element;
+
+    auto it = m_mpi_pdata_element_fields.find(fields);
+    if (it == m_mpi_pdata_element_fields.end())
+        {
+        it = m_mpi_pdata_element_fields.emplace(fields, createPdataElementType(fields)).first;
+        }
+    return it->second;
+    }
+
+/*! \param buf Particles to send
+    \returns Bitwise or of the migrate_field values that differ from their defaults in \a buf
+*/
+unsigned int Communicator::getMigrateFields(const std::vector<detail::pdata_element>& buf)
+    {
+    unsigned int fields = 0;
+    for (const detail::pdata_element& p : buf)
+        {
+        if (p.charge != Scalar(0.0))
+            fields |= migrate_charge;
+        if (p.diameter != Scalar(1.0))
+            fields |= migrate_diameter;
+        if (p.body != NO_BODY)
+            fields |= migrate_body;
+        if (p.orientation.x != Scalar(1.0) || p.orientation.y != Scalar(0.0)
+            || p.orientation.z != Scalar(0.0) || p.orientation.w != Scalar(0.0))
+            fields |= migrate_orientation;
+        if (p.angmom.x != Scalar(0.0) || p.angmom.y != Scalar(0.0) || p.angmom.z != Scalar(0.0)
+            || p.angmom.w != Scalar(0.0))
+            fields |= migrate_angmom;
+        if (p.inertia.x != Scalar(0.0) || p.inertia.y != Scalar(0.0) || p.inertia.z != Scalar(0.0))
+            fields |= migrate_inertia;
+        if (p.net_torque.x != Scalar(0.0) || p.net_torque.y != Scalar(0.0)
+            || p.net_torque.z != Scalar(0.0) || p.net_torque.w != Scalar(0.0))
+            fields |= migrate_net_torque;
+        for (unsigned int i = 0; i < 6; ++i)
+            {
+            if (p.net_virial[i] != Scalar(0.0))
+                fields |= migrate_net_virial;
+            }
+
+        if (fields == migrate_all)
+            break;
+        }
+    return fields;
+    }
+
+/*! \param buf Received particles
+    \param fields Bitwise or of the migrate_field values that were received
+*/
+void Communicator::setMigrateDefaults(std::vector<detail::pdata_element>& buf, unsigned int fields)
+    {
+    if (fields == migrate_all)
+        return;
+
+    for (detail::pdata_element& p : buf)
+        {
+        if (!(fields & migrate_charge))
+            p.charge = Scalar(0.0);
+        if (!(fields & migrate_diameter))
+            p.diameter = Scalar(1.0);
+        if (!(fields & migrate_body))
+            p.body = NO_BODY;
+        if (!(fields & migrate_orientation))
+            p.orientation = make_scalar4(1, 0, 0, 0);
+        if (!(fields & migrate_angmom))
+            p.angmom = make_scalar4(0, 0, 0, 0);
+        if (!(fields & migrate_inertia))
+            p.inertia = make_scalar3(0, 0, 0);
+        if (!(fields & migrate_net_torque))
+            p.net_torque = make_scalar4(0, 0, 0, 0);
+        if (!(fields & migrate_net_virial))
+            {
+            for (unsigned int i = 0; i < 6; ++i)
+                p.net_virial[i] = Scalar(0.0);
+            }
+        }
     }
 
 //! Destructor
@@ -1378,7 +1485,15 @@ Communicator::~Communicator()
             .disconnect<Communicator, &Communicator::setMeshtrianglesChanged>(this);
         }
 
+    for (unsigned int dir = 0; dir < 6; dir++)
+        freeGhostUpdateRequests(dir);
+    freeSharedMemory();
+    if (m_node_comm != MPI_COMM_NULL)
+        MPI_Comm_free(&m_node_comm);
+
     MPI_Type_free(&m_mpi_pdata_element);
+    for (auto& type : m_mpi_pdata_element_fields)
+        MPI_Type_free(&type.second);
     }
 
 void Communicator::updateMeshDefinition()
@@ -1509,9 +1624,17 @@ void Communicator::initializeNeighborArrays()
 //! Interface to the communication methods.
 void Communicator::communicate(uint64_t timestep)
     {
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+
     // Guard to prevent recursive triggering of migration
     m_is_communicating = true;
 
+    // complete a ghost update left in flight by the previous call
+    finishUpdateGhosts(timestep);
+
+    bool defer_finish = m_defer_finish_update_ghosts;
+    m_defer_finish_update_ghosts = false;
+
     // update ghost communication flags
     m_flags = CommFlags(0);
     m_requested_flags.emit_accumulate([&](CommFlags f) { m_flags |= f; }, timestep);
@@ -1520,9 +1643,11 @@ void Communicator::communicate(uint64_t timestep)
         {
         // do an obligatory update before determining whether to migrate
         beginUpdateGhosts(timestep);
-        finishUpdateGhosts(timestep);
+        if (!defer_finish)
+            finishUpdateGhosts(timestep);
 
-        // call subscribers after ghost update, but before distance check
+        // call subscribers after ghost update, but before distance check. With a deferred
+        // update, the ghosts are still in flight and subscribers that need them complete it.
         m_compute_callbacks.emit(timestep);
 
         // by now, local particles may have moved outside the box due to the rigid body update
@@ -1533,7 +1658,8 @@ void Communicator::communicate(uint64_t timestep)
     if (!m_force_migrate)
         {
         // distance check, may not be called directly after particle reorder (such as
-        // due to SFCPackUpdater running before)
+        // due to SFCPackUpdater running before). It only looks at the local particles, so it
+        // does not wait for a deferred ghost update.
         m_migrate_requests.emit_accumulate([&](bool r) { migrate_request = migrate_request || r; },
                                            timestep);
         }
@@ -1545,12 +1671,18 @@ void Communicator::communicate(uint64_t timestep)
         {
         beginUpdateGhosts(timestep);
 
-        finishUpdateGhosts(timestep);
+        // when requested, the caller completes the update after it has done work that does not
+        // need the ghosts
+        if (!defer_finish)
+            finishUpdateGhosts(timestep);
         }
 
     // Check if migration of particles is requested
     if (migrate)
         {
+        // the migration replaces the ghosts, complete any update still in flight first
+        finishUpdateGhosts(timestep);
+
         m_force_migrate = false;
 
         // If so, migrate atoms
@@ -1679,18 +1811,27 @@ void Communicator::migrateParticles()
         else
             recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
 
-        unsigned int n_recv_ptls;
-
-        // communicate size of the message that will contain the particle data
+        // communicate size of the message that will contain the particle data, along with the
+        // optional fields that it includes
         m_reqs.resize(2);
         m_stats.resize(2);
 
-        unsigned int n_send_ptls = (unsigned int)m_sendbuf.size();
+        unsigned int send_header[2] = {(unsigned int)m_sendbuf.size(), getMigrateFields(m_sendbuf)};
+        unsigned int recv_header[2];
+        unsigned int n_send_ptls = send_header[0];
 
-        MPI_Isend(&n_send_ptls, 1, MPI_UNSIGNED, send_neighbor, 0, m_mpi_comm, &m_reqs[0]);
-        MPI_Irecv(&n_recv_ptls, 1, MPI_UNSIGNED, recv_neighbor, 0, m_mpi_comm, &m_reqs[1]);
+        MPI_Isend(send_header, 2, MPI_UNSIGNED, send_neighbor, 0, m_mpi_comm, &m_reqs[0]);
+        MPI_Irecv(recv_header, 2, MPI_UNSIGNED, recv_neighbor, 0, m_mpi_comm, &m_reqs[1]);
         MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
 
+        unsigned int n_recv_ptls = recv_header[0];
+        MPI_Datatype send_type = getPdataElementType(send_header[1]);
+        MPI_Datatype recv_type = getPdataElementType(recv_header[1]);
+
+        int send_type_size;
+        MPI_Type_size(send_type, &send_type_size);
+        m_timer.addBytes(uint64_t(n_send_ptls) * send_type_size);
+
         // Resize receive buffer
         m_recvbuf.resize(n_recv_ptls);
 
@@ -1699,20 +1840,23 @@ void Communicator::migrateParticles()
         m_stats.resize(2);
         MPI_Isend(&m_sendbuf.front(),
                   n_send_ptls,
-                  m_mpi_pdata_element,
+                  send_type,
                   send_neighbor,
                   1,
                   m_mpi_comm,
                   &m_reqs[0]);
         MPI_Irecv(&m_recvbuf.front(),
                   n_recv_ptls,
-                  m_mpi_pdata_element,
+                  recv_type,
                   recv_neighbor,
                   1,
                   m_mpi_comm,
                   &m_reqs[1]);
         MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
 
+        // the sender omits fields that have their default values
+        setMigrateDefaults(m_recvbuf, recv_header[1]);
+
         // wrap received particles across a global boundary back into global box
         const BoxDim shifted_box = getShiftedBox();
         for (unsigned int idx = 0; idx < n_recv_ptls; idx++)
@@ -2316,6 +2460,24 @@ void Communicator::exchangeGhosts()
             MPI_Waitall((unsigned int)m_reqs.size(), &m_reqs.front(), &m_stats.front());
             }
 
+        // count the plan, tag, and requested fields sent to the neighbor
+        uint64_t ghost_bytes = 2 * sizeof(unsigned int);
+        if (flags[comm_flag::position])
+            ghost_bytes += sizeof(Scalar4);
+        if (flags[comm_flag::charge])
+            ghost_bytes += sizeof(Scalar);
+        if (flags[comm_flag::diameter])
+            ghost_bytes += sizeof(Scalar);
+        if (flags[comm_flag::velocity])
+            ghost_bytes += sizeof(Scalar4);
+        if (flags[comm_flag::orientation])
+            ghost_bytes += sizeof(Scalar4);
+        if (flags[comm_flag::body])
+            ghost_bytes += sizeof(unsigned int);
+        if (flags[comm_flag::image])
+            ghost_bytes += sizeof(int3);
+        m_timer.addBytes(m_num_copy_ghosts[dir] * ghost_bytes);
+
         // wrap particle positions
         if (flags[comm_flag::position])
             {
@@ -2357,6 +2519,7 @@ void Communicator::exchangeGhosts()
         } // end dir loop
 
     m_ghosts_added = m_pdata->getNGhosts();
+    updateSharedMemoryCapacity();
 
     // exchange ghost constraints along with ghost particles
     m_constraint_comm.exchangeGhostGroups(m_plan, mask);
@@ -2637,6 +2800,15 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
     unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
 
+    // ghosts received in the last direction are not forwarded to other neighbors, leave that
+    // exchange in flight until finishUpdateGhosts()
+    unsigned int last_dir = 6;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (isCommunicating(dir))
+            last_dir = dir;
+        }
+
     for (unsigned int dir = 0; dir < 6; dir++)
         {
         if (!isCommunicating(dir))
@@ -2644,6 +2816,10 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         CommFlags flags = getFlags();
 
+        // ghosts for a neighbor on the same node are packed directly into the shared memory window
+        const bool send_shm = m_shm_enabled && m_shm_send_rank[dir] >= 0;
+        const bool recv_shm = m_shm_enabled && m_shm_recv_rank[dir] >= 0;
+
         if (flags[comm_flag::position])
             {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
@@ -2659,6 +2835,9 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_location::host,
                                              access_mode::read);
 
+            Scalar4* pos_out
+                = send_shm ? getSharedMemorySlot(m_node_rank, dir, 0) : h_pos_copybuf.data;
+
             // copy positions of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
                 {
@@ -2667,7 +2846,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
                 // copy position into send buffer
-                h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                pos_out[ghost_idx] = h_pos.data[idx];
                 }
             }
 
@@ -2686,6 +2865,9 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_location::host,
                                              access_mode::read);
 
+            Scalar4* vel_out
+                = send_shm ? getSharedMemorySlot(m_node_rank, dir, 1) : h_velocity_copybuf.data;
+
             // copy velocity of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
                 {
@@ -2694,7 +2876,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
                 // copy velocity into send buffer
-                h_velocity_copybuf.data[ghost_idx] = h_vel.data[idx];
+                vel_out[ghost_idx] = h_vel.data[idx];
                 }
             }
 
@@ -2713,6 +2895,9 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_location::host,
                                              access_mode::read);
 
+            Scalar4* orientation_out = send_shm ? getSharedMemorySlot(m_node_rank, dir, 2)
+                                                : h_orientation_copybuf.data;
+
             // copy orientation of ghost particles
             for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
                 {
@@ -2721,7 +2906,7 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                 assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
                 // copy orientation into send buffer
-                h_orientation_copybuf.data[ghost_idx] = h_orientation.data[idx];
+                orientation_out[ghost_idx] = h_orientation.data[idx];
                 }
             }
 
@@ -2740,96 +2925,162 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
         num_tot_recv_ghosts += m_num_recv_ghosts[dir];
 
+        uint64_t ghost_bytes = 0;
+        if (flags[comm_flag::position])
+            ghost_bytes += sizeof(Scalar4);
+        if (flags[comm_flag::velocity])
+            ghost_bytes += sizeof(Scalar4);
+        if (flags[comm_flag::orientation])
+            ghost_bytes += sizeof(Scalar4);
+        m_timer.addBytes(m_num_copy_ghosts[dir] * ghost_bytes);
+
         // only non-permanent fields (position, velocity, orientation) need to be considered here
         // charge, body, image and diameter are not updated between neighbor list builds
-        if (flags[comm_flag::position])
+        std::vector<std::tuple<const void*, void*, int>> buffers;
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+            // exchange particle data, write directly to the particle data arrays
+            if (flags[comm_flag::position])
+                {
+                ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+                ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
+                                                   access_location::host,
+                                                   access_mode::read);
+                buffers.emplace_back(send_shm ? nullptr : h_pos_copybuf.data,
+                                     recv_shm ? nullptr : h_pos.data + start_idx,
+                                     1);
+                }
 
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+            if (flags[comm_flag::velocity])
+                {
+                ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+                ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
+                                                   access_location::host,
+                                                   access_mode::read);
+                buffers.emplace_back(send_shm ? nullptr : h_vel_copybuf.data,
+                                     recv_shm ? nullptr : h_vel.data + start_idx,
+                                     2);
+                }
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            if (flags[comm_flag::orientation])
+                {
+                ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                                   access_location::host,
+                                                   access_mode::readwrite);
+                ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
+                                                           access_location::host,
+                                                           access_mode::read);
+                buffers.emplace_back(send_shm ? nullptr : h_orientation_copybuf.data,
+                                     recv_shm ? nullptr : h_orientation.data + start_idx,
+                                     3);
+                }
             }
 
-        if (flags[comm_flag::velocity])
+        // reuse the persistent requests of the previous update if they are bound to the same
+        // buffers, this saves the MPI setup cost of every step between ghost exchanges
+        GhostUpdateRequests& update_reqs = m_ghost_update_reqs[dir];
+        if (buffers != update_reqs.buffers || m_num_copy_ghosts[dir] != update_reqs.n_send
+            || m_num_recv_ghosts[dir] != update_reqs.n_recv)
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+            freeGhostUpdateRequests(dir);
+            update_reqs.buffers = buffers;
+            update_reqs.n_send = m_num_copy_ghosts[dir];
+            update_reqs.n_recv = m_num_recv_ghosts[dir];
 
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
-
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+            for (unsigned int i = 0; i < buffers.size(); i++)
+                {
+                int tag = std::get<2>(buffers[i]);
+                MPI_Request req;
+                if (std::get<0>(buffers[i]))
+                    {
+                    MPI_Send_init(std::get<0>(buffers[i]),
+                                  (unsigned int)(update_reqs.n_send * sizeof(Scalar4)),
+                                  MPI_BYTE,
+                                  send_neighbor,
+                                  tag,
+                                  m_mpi_comm,
+                                  &req);
+                    update_reqs.reqs.push_back(req);
+                    }
+                if (std::get<1>(buffers[i]))
+                    {
+                    MPI_Recv_init(std::get<1>(buffers[i]),
+                                  (unsigned int)(update_reqs.n_recv * sizeof(Scalar4)),
+                                  MPI_BYTE,
+                                  recv_neighbor,
+                                  tag,
+                                  m_mpi_comm,
+                                  &req);
+                    update_reqs.reqs.push_back(req);
+                    }
+                }
             }
 
-        if (flags[comm_flag::orientation])
+        if (!update_reqs.reqs.empty())
+            MPI_Startall((unsigned int)update_reqs.reqs.size(), &update_reqs.reqs.front());
+
+        if (m_shm_enabled)
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+            // wait until all ranks on the node have packed their ghosts in this direction
+            MPI_Win_sync(m_shm_win);
+            MPI_Barrier(m_node_comm);
+            MPI_Win_sync(m_shm_win);
 
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+            // the slot is not overwritten before the barrier of the next direction
+            if (recv_shm)
+                {
+                const unsigned int n = m_num_recv_ghosts[dir];
+                if (flags[comm_flag::position])
+                    {
+                    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                                access_location::host,
                                                access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
+                    std::copy(getSharedMemorySlot(m_shm_recv_rank[dir], dir, 0),
+                              getSharedMemorySlot(m_shm_recv_rank[dir], dir, 0) + n,
+                              h_pos.data + start_idx);
+                    }
+                if (flags[comm_flag::velocity])
+                    {
+                    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                               access_location::host,
+                                               access_mode::readwrite);
+                    std::copy(getSharedMemorySlot(m_shm_recv_rank[dir], dir, 1),
+                              getSharedMemorySlot(m_shm_recv_rank[dir], dir, 1) + n,
+                              h_vel.data + start_idx);
+                    }
+                if (flags[comm_flag::orientation])
+                    {
+                    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                                        access_location::host,
-                                                       access_mode::read);
+                                                       access_mode::readwrite);
+                    std::copy(getSharedMemorySlot(m_shm_recv_rank[dir], dir, 2),
+                              getSharedMemorySlot(m_shm_recv_rank[dir], dir, 2) + n,
+                              h_orientation.data + start_idx);
+                    }
+                }
+            }
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      3,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+        if (dir == last_dir)
+            {
+            // finishUpdateGhosts() accesses the received ghosts again, so force computes may hold
+            // handles to the particle data meanwhile
+            m_pending_ghost_start = start_idx;
+            m_pending_ghost_flags = flags;
+            m_n_pending_ghosts = m_num_recv_ghosts[dir];
+            m_pending_ghost_dir = dir;
+            m_comm_pending = true;
+            break;
+            }
+
+        if (!update_reqs.reqs.empty())
+            {
+            m_stats.resize(update_reqs.reqs.size());
+            MPI_Waitall((unsigned int)update_reqs.reqs.size(),
+                        &update_reqs.reqs.front(),
+                        &m_stats.front());
             }
 
         // wrap particle positions (only if copying positions)
@@ -2838,19 +3089,215 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::readwrite);
+            wrapGhostPositions(h_pos.data + start_idx, m_num_recv_ghosts[dir]);
+            }
+        } // end dir loop
+    }
 
-            const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
-                {
-                Scalar4& pos = h_pos.data[idx];
+void Communicator::finishUpdateGhosts(uint64_t timestep)
+    {
+    if (!m_comm_pending)
+        return;
 
-                // wrap particles received across a global boundary
-                int3 img = make_int3(0, 0, 0);
-                shifted_box.wrap(pos, img);
-                }
+    m_comm_pending = false;
+
+    // complete the exchange in the last direction
+    std::vector<MPI_Request>& reqs = m_ghost_update_reqs[m_pending_ghost_dir].reqs;
+    if (!reqs.empty())
+        {
+        m_stats.resize(reqs.size());
+        MPI_Waitall((unsigned int)reqs.size(), &reqs.front(), &m_stats.front());
+        }
+
+    // MPI wrote the ghosts behind the back of the particle data, acquire the received fields for
+    // writing so that their cached copies (such as ParticleData::getPositionsSoA()) are refreshed
+    if (m_pending_ghost_flags[comm_flag::position])
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        wrapGhostPositions(h_pos.data + m_pending_ghost_start, m_n_pending_ghosts);
+        }
+
+    if (m_pending_ghost_flags[comm_flag::velocity])
+        {
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        }
+
+    if (m_pending_ghost_flags[comm_flag::orientation])
+        {
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::readwrite);
+        }
+    }
+
+/*! \param pos Positions of the received ghosts
+    \param n Number of received ghosts
+*/
+void Communicator::wrapGhostPositions(Scalar4* pos, unsigned int n)
+    {
+    const BoxDim shifted_box = getShiftedBox();
+    for (unsigned int idx = 0; idx < n; idx++)
+        {
+        // wrap particles received across a global boundary
+        int3 img = make_int3(0, 0, 0);
+        shifted_box.wrap(pos[idx], img);
+        }
+    }
+
+/*! Set the environment variable HOOMD_MPI_SHARED_MEMORY to 1 to enable shared memory ghost
+    updates. Ranks on the same node then pack the ghost positions, velocities, and orientations
+    for each other into an MPI-3 shared memory window and copy them out directly, instead of sending
+    MPI messages. Messages to ranks on other nodes are not affected.
+*/
+void Communicator::initializeSharedMemory()
+    {
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_shm_send_rank[dir] = -1;
+        m_shm_recv_rank[dir] = -1;
+        }
+
+    // the window operations are collective, so all ranks must agree
+    const char* env = getenv("HOOMD_MPI_SHARED_MEMORY");
+    int enable = env != NULL && std::string(env) != "0" && !m_exec_conf->isCUDAEnabled();
+    int all_enable = 0;
+    MPI_Allreduce(&enable, &all_enable, 1, MPI_INT, MPI_LAND, m_mpi_comm);
+    if (!all_enable)
+        return;
+
+    MPI_Comm_split_type(m_mpi_comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &m_node_comm);
+    MPI_Comm_rank(m_node_comm, &m_node_rank);
+
+    MPI_Group group, node_group;
+    MPI_Comm_group(m_mpi_comm, &group);
+    MPI_Comm_group(m_node_comm, &node_group);
+
+    int has_node_neighbor = 0;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        if (!isCommunicating(dir))
+            continue;
+
+        int send_neighbor = m_decomposition->getNeighborRank(dir);
+        int recv_neighbor = m_decomposition->getNeighborRank(dir % 2 == 0 ? dir + 1 : dir - 1);
+
+        int send_node_rank, recv_node_rank;
+        MPI_Group_translate_ranks(group, 1, &send_neighbor, node_group, &send_node_rank);
+        MPI_Group_translate_ranks(group, 1, &recv_neighbor, node_group, &recv_node_rank);
+
+        if (send_node_rank != MPI_UNDEFINED)
+            {
+            m_shm_send_rank[dir] = send_node_rank;
+            has_node_neighbor = 1;
             }
+        if (recv_node_rank != MPI_UNDEFINED)
+            {
+            m_shm_recv_rank[dir] = recv_node_rank;
+            has_node_neighbor = 1;
+            }
+        }
 
-        } // end dir loop
+    MPI_Group_free(&group);
+    MPI_Group_free(&node_group);
+
+    // every ghost update synchronizes the node, which only pays off if there are neighbors on it
+    int any_node_neighbor = 0;
+    MPI_Allreduce(&has_node_neighbor, &any_node_neighbor, 1, MPI_INT, MPI_LOR, m_node_comm);
+    m_shm_enabled = any_node_neighbor;
+
+    if (m_shm_enabled)
+        {
+        m_exec_conf->msg->notice(2)
+            << "Communicator: using shared memory for ghost updates between ranks on a node"
+            << std::endl;
+        }
+    else
+        {
+        for (unsigned int dir = 0; dir < 6; dir++)
+            {
+            m_shm_send_rank[dir] = -1;
+            m_shm_recv_rank[dir] = -1;
+            }
+        }
+    }
+
+/*! The window holds one slot per direction and field for every rank on the node. All ranks on the
+    node use the same slot size, so that they can locate the slots of their neighbors.
+
+    \note All ranks on the node must call updateSharedMemoryCapacity() since it may reallocate the
+    window.
+*/
+void Communicator::updateSharedMemoryCapacity()
+    {
+    if (!m_shm_enabled)
+        return;
+
+    unsigned int capacity = 0;
+    for (unsigned int dir = 0; dir < 6; dir++)
+        capacity = std::max(capacity, m_num_copy_ghosts[dir]);
+
+    unsigned int max_capacity = 0;
+    MPI_Allreduce(&capacity, &max_capacity, 1, MPI_UNSIGNED, MPI_MAX, m_node_comm);
+
+    if (m_shm_win != MPI_WIN_NULL && max_capacity <= m_shm_capacity)
+        return;
+
+    freeSharedMemory();
+
+    // leave room to grow so that the window is not reallocated on every ghost exchange
+    m_shm_capacity = std::max(max_capacity + max_capacity / 4, 1u);
+
+    Scalar4* base = nullptr;
+    MPI_Win_allocate_shared(MPI_Aint(6 * 3 * m_shm_capacity * sizeof(Scalar4)),
+                            sizeof(Scalar4),
+                            MPI_INFO_NULL,
+                            m_node_comm,
+                            &base,
+                            &m_shm_win);
+
+    int node_size;
+    MPI_Comm_size(m_node_comm, &node_size);
+    m_shm_base.resize(node_size);
+    for (int i = 0; i < node_size; i++)
+        {
+        MPI_Aint size;
+        int disp_unit;
+        MPI_Win_shared_query(m_shm_win, i, &size, &disp_unit, &m_shm_base[i]);
+        }
+
+    // keep a passive target epoch open, synchronization is done with MPI_Win_sync and barriers
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, m_shm_win);
+    }
+
+void Communicator::freeSharedMemory()
+    {
+    if (m_shm_win == MPI_WIN_NULL)
+        return;
+
+    MPI_Win_unlock_all(m_shm_win);
+    MPI_Win_free(&m_shm_win);
+    m_shm_base.clear();
+    m_shm_capacity = 0;
+    }
+
+/*! \param dir Direction of the ghost update
+*/
+void Communicator::freeGhostUpdateRequests(unsigned int dir)
+    {
+    GhostUpdateRequests& update_reqs = m_ghost_update_reqs[dir];
+    for (MPI_Request& req : update_reqs.reqs)
+        {
+        if (req != MPI_REQUEST_NULL)
+            MPI_Request_free(&req);
+        }
+    update_reqs.reqs.clear();
+    update_reqs.buffers.clear();
+    update_reqs.n_send = 0;
+    update_reqs.n_recv = 0;
     }
 
 void Communicator::updateNetForce(uint64_t timestep)
@@ -3405,11 +3852,14 @@ namespace detail
 //! Export Communicator class to python
 void export_Communicator(pybind11::module& m)
     {
-    pybind11::class_<Communicator, std::shared_ptr<Communicator>>(m, "Communicator")
+    pybind11::class_<Communicator, Autotuned, std::shared_ptr<Communicator>>(m, "Communicator")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<DomainDecomposition>>())
         .def("addMeshDefinition", &Communicator::addMeshDefinition)
-        .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition);
+        .def_property_readonly("domain_decomposition", &Communicator::getDomainDecomposition)
+        .def_property_readonly("timer",
+                               &Communicator::getTimer,
+                               pybind11::return_value_policy::reference_internal);
     }
     } // end namespace detail
 
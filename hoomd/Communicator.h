@@ -17,15 +17,19 @@
 #include "HOOMDMath.h"
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
+#include "OperationTimer.h"
 #include "ParticleData.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
+#include <map>
 #include <memory>
+#include <tuple>
 
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
 #endif
 
+#include "Autotuned.h"
 #include "Autotuner.h"
 
 /*! \ingroup hoomd_lib
@@ -145,7 +149,7 @@ template<typename ranks_t> struct rank_element
  * the local ghost atom lists, and they maybe replicated to more neighboring processors by the
  * communication pattern described above. \ingroup communication
  */
-class PYBIND11_EXPORT Communicator
+class PYBIND11_EXPORT Communicator : public Autotuned
     {
     public:
     //! Constructor
@@ -205,6 +209,15 @@ class PYBIND11_EXPORT Communicator
         return m_decomposition;
         }
 
+    /// Get the timer that accumulates the cost of communicate()
+    /*! The timer counts the bytes of particle data that migrateParticles(), exchangeGhosts(), and
+        beginUpdateGhosts() send on the CPU.
+    */
+    OperationTimer& getTimer()
+        {
+        return m_timer;
+        }
+
     //! Subscribe to list of call-backs for ghost communication
     /*!
      * A subscribing function is passed a reference to the ghost plans array
@@ -221,7 +234,9 @@ class PYBIND11_EXPORT Communicator
     //! Subscribe to list of *optional* call-backs for computation using ghost particles
     /*!
      * Subscribe to a list of call-backs that precompute quantities using information about ghost
-     * particles before awaiting the result of the particle migration check.
+     * particles before awaiting the result of the particle migration check. When the caller of
+     * communicate() deferred the ghost update, the call-backs run while it is in flight and must
+     * call finishUpdateGhosts() before they access ghost data.
      *
      * \param subscriber The callback
      * \return A Nano::Signal object reference to be used for connect and disconnect calls.
@@ -319,13 +334,28 @@ class PYBIND11_EXPORT Communicator
     virtual void beginUpdateGhosts(uint64_t timestep);
 
     /*! Finish ghost update
+     *
+     * Does nothing when no update is in flight.
      *
      * \param timestep The time step
      */
-    virtual void finishUpdateGhosts(uint64_t timestep)
+    virtual void finishUpdateGhosts(uint64_t timestep);
+
+    //! Leave the ghost update of the next communicate() call in flight
+    /*! When communicate() does not migrate particles, it returns after beginUpdateGhosts(). The
+     *  compute callbacks and the caller can then compute on the local particles while the messages
+     *  are in transit, and must call finishUpdateGhosts() before they access ghost data. The
+     *  migration requests only check the local particles and run before the update completes.
+     */
+    void deferFinishUpdateGhosts()
         {
-        // the base class implementation is currently empty
-        m_comm_pending = false;
+        m_defer_finish_update_ghosts = true;
+        }
+
+    //! Returns true while a ghost update started by beginUpdateGhosts() is in flight
+    bool isGhostUpdatePending() const
+        {
+        return m_comm_pending;
         }
 
     /*! Communicate the net particle force
@@ -442,6 +472,24 @@ class PYBIND11_EXPORT Communicator
             m_groups_sendbuf; //!< Send buffer for group elements
         std::vector<typename group_data::packed_t>
             m_groups_recvbuf; //!< Receive buffer for group elements
+
+        std::vector<std::vector<rank_element_t>>
+            m_ranks_send_lists; //!< Per-neighbor lists of rank elements to send
+        std::vector<std::vector<group_element_t>>
+            m_groups_send_lists; //!< Per-neighbor lists of group elements to send
+        std::vector<std::pair<unsigned int, unsigned int>>
+            m_neighbor_index; //!< (rank, neighbor index) pairs sorted by rank
+
+        //! Build the rank to neighbor index lookup and size the send lists
+        void updateNeighborIndex();
+
+        //! Find the index of a rank in the list of unique neighbors
+        unsigned int getNeighborIndex(unsigned int rank) const;
+
+        //! Concatenate the per-neighbor send lists into a send buffer
+        template<class element_t>
+        void flattenSendLists(std::vector<std::vector<element_t>>& send_lists,
+                              std::vector<element_t>& sendbuf);
         };
 
     //! Returns true if we are communicating particles along a given direction
@@ -477,6 +525,8 @@ class PYBIND11_EXPORT Communicator
     bool m_is_communicating; //!< Whether we are currently communicating
     bool m_force_migrate;    //!< True if particle migration is forced
 
+    OperationTimer m_timer; //!< Accumulates the cost of communication
+
     unsigned int m_is_at_boundary[6]; //!< Array of flags indicating whether this box lies at a
                                       //!< global boundary
 
@@ -563,6 +613,35 @@ class PYBIND11_EXPORT Communicator
 
     MPI_Datatype m_mpi_pdata_element; //!< A datatype for the (non-packed) pdata_element struct
 
+    //! Optional fields of pdata_element that migrateParticles() sends only when they are used
+    enum migrate_field
+        {
+        migrate_charge = 1,
+        migrate_diameter = 2,
+        migrate_body = 4,
+        migrate_orientation = 8,
+        migrate_angmom = 16,
+        migrate_inertia = 32,
+        migrate_net_torque = 64,
+        migrate_net_virial = 128,
+        migrate_all = 255
+        };
+
+    /// Datatypes for pdata_element with a subset of the optional fields, by field mask
+    std::map<unsigned int, MPI_Datatype> m_mpi_pdata_element_fields;
+
+    //! Create a datatype for pdata_element with the given optional fields
+    MPI_Datatype createPdataElementType(unsigned int fields);
+
+    //! Get the (cached) datatype for pdata_element with the given optional fields
+    MPI_Datatype getPdataElementType(unsigned int fields);
+
+    //! Determine the optional fields with non-default values in a buffer
+    static unsigned int getMigrateFields(const std::vector<detail::pdata_element>& buf);
+
+    //! Set the optional fields that were not sent to their default values
+    static void setMigrateDefaults(std::vector<detail::pdata_element>& buf, unsigned int fields);
+
     //! Update the ghost width array
     void updateGhostWidth();
 
@@ -592,6 +671,39 @@ class PYBIND11_EXPORT Communicator
     std::vector<MPI_Request> m_reqs; //!< Container for all MPI communication requests
     std::vector<MPI_Status> m_stats; //!< Container for all MPI communication statuses
 
+    bool m_defer_finish_update_ghosts = false;      //!< Leave the next ghost update in flight
+    unsigned int m_pending_ghost_start = 0;         //!< Index of the first pending ghost
+    CommFlags m_pending_ghost_flags = CommFlags(0); //!< Fields received by the pending update
+    unsigned int m_n_pending_ghosts = 0;            //!< Number of ghosts of the pending update
+    unsigned int m_pending_ghost_dir = 0;           //!< Direction of the pending update
+
+    //! Persistent MPI requests of the ghost updates in one direction
+    /*! The requests are bound to the send and receive buffers. They remain valid until the ghost
+        counts or the buffer addresses change, which only happens when ghosts are exchanged.
+    */
+    struct GhostUpdateRequests
+        {
+        std::vector<MPI_Request> reqs; //!< Persistent send and receive requests
+
+        //! Send buffer, receive buffer, and tag of each field
+        std::vector<std::tuple<const void*, void*, int>> buffers;
+
+        unsigned int n_send = 0; //!< Number of ghosts sent
+        unsigned int n_recv = 0; //!< Number of ghosts received
+        };
+
+    GhostUpdateRequests m_ghost_update_reqs[6]; //!< Persistent requests per direction
+
+    /* Intra-node shared memory ghost updates */
+    bool m_shm_enabled = false;           //!< True if ghost updates use shared memory on the node
+    MPI_Comm m_node_comm = MPI_COMM_NULL; //!< Ranks on the same node
+    MPI_Win m_shm_win = MPI_WIN_NULL;     //!< Shared memory window holding the ghost send slots
+    int m_node_rank = 0;                  //!< Rank of this process in m_node_comm
+    unsigned int m_shm_capacity = 0;      //!< Number of ghosts per slot, the same on all node ranks
+    std::vector<Scalar4*> m_shm_base;     //!< Start of the window segment of each node rank
+    int m_shm_send_rank[6]; //!< Node rank of the send neighbor in each direction, -1 if off node
+    int m_shm_recv_rank[6]; //!< Node rank of the recv neighbor in each direction, -1 if off node
+
     /* Bonds communication */
     bool m_bonds_changed; //!< True if bond information needs to be refreshed
     void setBondsChanged()
@@ -717,6 +829,31 @@ class PYBIND11_EXPORT Communicator
     //! Helper function to initialize adjacency arrays
     void initializeNeighborArrays();
 
+    //! Wrap received ghost positions into the shifted box
+    void wrapGhostPositions(Scalar4* pos, unsigned int n);
+
+    //! Free the persistent ghost update requests in one direction
+    void freeGhostUpdateRequests(unsigned int dir);
+
+    //! Find the neighbors on the same node for shared memory ghost updates
+    void initializeSharedMemory();
+
+    //! Grow the shared memory window to hold the current ghosts
+    void updateSharedMemoryCapacity();
+
+    //! Free the shared memory window
+    void freeSharedMemory();
+
+    //! Get the shared memory slot of a node rank for one direction and field
+    /*! \param node_rank Rank in m_node_comm
+        \param dir Direction of the ghost update
+        \param field 0 for positions, 1 for velocities, 2 for orientations
+    */
+    Scalar4* getSharedMemorySlot(int node_rank, unsigned int dir, unsigned int field)
+        {
+        return m_shm_base[node_rank] + (dir * 3 + field) * m_shm_capacity;
+        }
+
     //! Method that is called when ghost particles are requested to be removed
     void slotGhostParticlesRemoved()
         {
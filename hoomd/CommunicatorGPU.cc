@@ -12,9 +12,22 @@
 #include "System.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <string>
+
+#if __has_include(<mpi-ext.h>)
+#include <mpi-ext.h>
+#endif
 
 namespace hoomd
     {
+namespace
+    {
+/// MPI tag of the particle counts in migrateParticles(), distinct from the tags of the group
+/// communicators that exchange messages during the same stage
+const int MIGRATE_COUNT_TAG = 10;
+    } // end anonymous namespace
+
 //! Constructor
 CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef,
                                  std::shared_ptr<DomainDecomposition> decomposition)
@@ -42,6 +55,39 @@ CommunicatorGPU::CommunicatorGPU(std::shared_ptr<SystemDefinition> sysdef,
 
     // create cuda event
     hipEventCreateWithFlags(&m_event, hipEventDisableTiming);
+
+    // with a GPU-aware MPI, choose between host staging and device pointers at runtime
+    m_gpu_aware_mpi = detectGPUAwareMPI();
+    if (m_gpu_aware_mpi)
+        {
+        m_exec_conf->msg->notice(2) << "CommunicatorGPU: MPI accepts device pointers." << std::endl;
+        m_tuner_ghost_update.reset(
+            new Autotuner<1>({{0, 1}}, m_exec_conf, "comm_ghost_update_device_mpi"));
+        // all ranks must pass the same kind of pointers
+        m_tuner_ghost_update->setSync(true);
+        m_autotuners.push_back(m_tuner_ghost_update);
+        }
+    }
+
+/*! Set the environment variable HOOMD_GPU_AWARE_MPI to 0 or 1 to override the detection. Without
+    it, query the MPI library when it provides the MPIX_Query_cuda_support() extension and assume
+    host staging otherwise.
+
+    \returns True if the MPI library accepts device pointers
+*/
+bool CommunicatorGPU::detectGPUAwareMPI()
+    {
+    const char* env = getenv("HOOMD_GPU_AWARE_MPI");
+    if (env != NULL)
+        {
+        return std::string(env) != "0";
+        }
+
+#if defined(__HIP_PLATFORM_NVCC__) && defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
+    return MPIX_Query_cuda_support() == 1;
+#else
+    return false;
+#endif
     }
 
 //! Destructor
@@ -1763,9 +1809,45 @@ void CommunicatorGPU::migrateParticles()
     // remove ghost particles from system
     m_pdata->removeAllGhostParticles();
 
+    // pass device pointers to MPI when it accepts them, so the buffers stay on the device
+    const access_location::Enum mpi_location
+        = m_gpu_aware_mpi ? access_location::device : access_location::host;
+
     // main communication loop
     for (unsigned int stage = 0; stage < m_num_stages; stage++)
         {
+        unsigned int n_send_ptls[m_n_unique_neigh];
+        unsigned int n_recv_ptls[m_n_unique_neigh];
+        unsigned int send_begin[m_n_unique_neigh];
+        unsigned int offs[m_n_unique_neigh];
+        unsigned int n_recv_tot = 0;
+
+        MPI_Request count_req[2 * m_n_unique_neigh];
+        MPI_Status count_stat[2 * m_n_unique_neigh];
+        unsigned int n_count_req = 0;
+
+            {
+            // post the receives of the particle counts first, so that the counts of neighbors that
+            // finish packing earlier arrive while this rank is still packing on the GPU
+            ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                         access_location::host,
+                                                         access_mode::read);
+            for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
+                {
+                n_recv_ptls[ineigh] = 0;
+                if (m_stages[ineigh] != (int)stage)
+                    continue;
+
+                MPI_Irecv(&n_recv_ptls[ineigh],
+                          1,
+                          MPI_UNSIGNED,
+                          h_unique_neighbors.data[ineigh],
+                          MIGRATE_COUNT_TAG,
+                          m_mpi_comm,
+                          &count_req[n_count_req++]);
+                }
+            }
+
             {
             ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                        access_location::device,
@@ -1883,29 +1965,29 @@ void CommunicatorGPU::migrateParticles()
                 CHECK_CUDA_ERROR();
             }
 
-        unsigned int n_send_ptls[m_n_unique_neigh];
-        unsigned int n_recv_ptls[m_n_unique_neigh];
-        unsigned int offs[m_n_unique_neigh];
-        unsigned int n_recv_tot = 0;
-
             {
-            ArrayHandle<unsigned int> h_begin(m_begin, access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_end(m_end, access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
-                                                         access_location::host,
-                                                         access_mode::read);
+            ArrayHandleAsync<unsigned int> h_begin(m_begin,
+                                                   access_location::host,
+                                                   access_mode::read);
+            ArrayHandleAsync<unsigned int> h_end(m_end, access_location::host, access_mode::read);
 
-            unsigned int send_bytes = 0;
-            unsigned int recv_bytes = 0;
+            // lump the count download and the packing kernels together into one synchronization
+            hipEventRecord(m_event);
+            hipEventSynchronize(m_event);
 
-            // compute send counts
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
-                n_send_ptls[ineigh] = h_end.data[ineigh] - h_begin.data[ineigh];
-
-            MPI_Request req[2 * m_n_unique_neigh];
-            MPI_Status stat[2 * m_n_unique_neigh];
+                {
+                send_begin[ineigh] = h_begin.data[ineigh];
+                n_send_ptls[ineigh] = (m_stages[ineigh] == (int)stage)
+                                          ? h_end.data[ineigh] - h_begin.data[ineigh]
+                                          : 0;
+                }
+            }
 
-            unsigned int nreq = 0;
+            {
+            ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
+                                                         access_location::host,
+                                                         access_mode::read);
 
             // loop over neighbors
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
@@ -1913,33 +1995,19 @@ void CommunicatorGPU::migrateParticles()
                 if (m_stages[ineigh] != (int)stage)
                     {
                     // skip neighbor if not participating in this communication stage
-                    n_send_ptls[ineigh] = 0;
-                    n_recv_ptls[ineigh] = 0;
                     continue;
                     }
 
-                // rank of neighbor processor
-                unsigned int neighbor = h_unique_neighbors.data[ineigh];
-
                 MPI_Isend(&n_send_ptls[ineigh],
                           1,
                           MPI_UNSIGNED,
-                          neighbor,
-                          0,
-                          m_mpi_comm,
-                          &req[nreq++]);
-                MPI_Irecv(&n_recv_ptls[ineigh],
-                          1,
-                          MPI_UNSIGNED,
-                          neighbor,
-                          0,
+                          h_unique_neighbors.data[ineigh],
+                          MIGRATE_COUNT_TAG,
                           m_mpi_comm,
-                          &req[nreq++]);
-                send_bytes += (unsigned int)sizeof(unsigned int);
-                recv_bytes += (unsigned int)sizeof(unsigned int);
+                          &count_req[n_count_req++]);
                 } // end neighbor loop
 
-            MPI_Waitall(nreq, req, stat);
+            MPI_Waitall(n_count_req, count_req, count_stat);
 
             // sum up receive counts
             for (unsigned int ineigh = 0; ineigh < m_n_unique_neigh; ineigh++)
@@ -1957,16 +2025,14 @@ void CommunicatorGPU::migrateParticles()
         m_gpu_recvbuf.resize(n_recv_tot);
 
             {
-            ArrayHandle<unsigned int> h_begin(m_begin, access_location::host, access_mode::read);
-            ArrayHandle<unsigned int> h_end(m_end, access_location::host, access_mode::read);
             ArrayHandle<unsigned int> h_unique_neighbors(m_unique_neighbors,
                                                          access_location::host,
                                                          access_mode::read);
             ArrayHandle<detail::pdata_element> gpu_sendbuf_handle(m_gpu_sendbuf,
-                                                                  access_location::host,
+                                                                  mpi_location,
                                                                   access_mode::read);
             ArrayHandle<detail::pdata_element> gpu_recvbuf_handle(m_gpu_recvbuf,
-                                                                  access_location::host,
+                                                                  mpi_location,
                                                                   access_mode::overwrite);
             std::vector<MPI_Request> reqs;
             MPI_Request req;
@@ -1983,7 +2049,7 @@ void CommunicatorGPU::migrateParticles()
                 // exchange particle data
                 if (n_send_ptls[ineigh])
                     {
-                    MPI_Isend(gpu_sendbuf_handle.data + h_begin.data[ineigh],
+                    MPI_Isend(gpu_sendbuf_handle.data + send_begin[ineigh],
                               n_send_ptls[ineigh],
                               m_mpi_pdata_element,
                               neighbor,
@@ -2009,7 +2075,7 @@ void CommunicatorGPU::migrateParticles()
                 }
 
             std::vector<MPI_Status> stats(reqs.size());
-            MPI_Waitall((unsigned int)(reqs.size()), &reqs.front(), &stats.front());
+            MPI_Waitall((unsigned int)(reqs.size()), reqs.data(), stats.data());
             }
 
             {
@@ -2930,6 +2996,16 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
 
     CommFlags flags = getFlags();
 
+    // pass device pointers to MPI when that is faster than staging through host memory
+    bool device_mpi = false;
+    if (m_tuner_ghost_update)
+        {
+        m_tuner_ghost_update->begin();
+        device_mpi = m_tuner_ghost_update->getParam()[0];
+        }
+    const access_location::Enum mpi_location
+        = device_mpi ? access_location::device : access_location::host;
+
     // main communication loop
     for (unsigned int stage = 0; stage < m_num_stages; ++stage)
         {
@@ -3021,24 +3097,24 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
             // access particle data
             // recv buffers
             ArrayHandle<Scalar4> pos_ghost_recvbuf_handle(m_pos_ghost_recvbuf,
-                                                          access_location::host,
+                                                          mpi_location,
                                                           access_mode::overwrite);
             ArrayHandle<Scalar4> vel_ghost_recvbuf_handle(m_vel_ghost_recvbuf,
-                                                          access_location::host,
+                                                          mpi_location,
                                                           access_mode::overwrite);
             ArrayHandle<Scalar4> orientation_ghost_recvbuf_handle(m_orientation_ghost_recvbuf,
-                                                                  access_location::host,
+                                                                  mpi_location,
                                                                   access_mode::overwrite);
 
             // send buffers
             ArrayHandleAsync<Scalar4> pos_ghost_sendbuf_handle(m_pos_ghost_sendbuf,
-                                                               access_location::host,
+                                                               mpi_location,
                                                                access_mode::read);
             ArrayHandleAsync<Scalar4> vel_ghost_sendbuf_handle(m_vel_ghost_sendbuf,
-                                                               access_location::host,
+                                                               mpi_location,
                                                                access_mode::read);
             ArrayHandleAsync<Scalar4> orientation_ghost_sendbuf_handle(m_orientation_ghost_sendbuf,
-                                                                       access_location::host,
+                                                                       mpi_location,
                                                                        access_mode::read);
 
             ArrayHandleAsync<unsigned int> h_unique_neighbors(m_unique_neighbors,
@@ -3229,6 +3305,9 @@ void CommunicatorGPU::beginUpdateGhosts(uint64_t timestep)
                 }
             }
         } // end main communication loop
+
+    if (m_tuner_ghost_update && !m_comm_pending)
+        m_tuner_ghost_update->end();
     }
 
 /*! Finish ghost update
@@ -3303,6 +3382,9 @@ void CommunicatorGPU::finishUpdateGhosts(uint64_t timestep)
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
             }
+
+        if (m_tuner_ghost_update)
+            m_tuner_ghost_update->end();
         }
     }
 
@@ -264,6 +264,14 @@ class PYBIND11_EXPORT CommunicatorGPU : public Communicator
 
     hipEvent_t m_event; //!< CUDA event for synchronization
 
+    bool m_gpu_aware_mpi; //!< True if MPI accepts device pointers
+
+    /// Autotuner that chooses between host staging (0) and device pointers (1) in ghost updates
+    std::shared_ptr<Autotuner<1>> m_tuner_ghost_update;
+
+    //! Test whether the MPI library accepts device pointers
+    bool detectGPUAwareMPI();
+
     //! Helper function to allocate various buffers
     void allocateBuffers();
 
@@ -11,8 +11,15 @@
 
 #ifdef ENABLE_MPI
 #include "Communicator.h"
+#include "HOOMDMPI.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 #include <stdexcept>
 
@@ -46,6 +53,57 @@ static unsigned int read_int(fstream& file)
     file.read((char*)&val, sizeof(unsigned int));
     return val;
     }
+
+//! simple helper function to append bytes to a buffer
+/*! \param buffer buffer to append to
+    \param data bytes to append
+    \param size number of bytes to append
+*/
+static void append_bytes(std::vector<char>& buffer, const void* data, size_t size)
+    {
+    const char* bytes = static_cast<const char*>(data);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+//! simple helper function to append an integer to a buffer
+/*! \param buffer buffer to append to
+    \param val integer to append
+*/
+static void append_int(std::vector<char>& buffer, unsigned int val)
+    {
+    append_bytes(buffer, &val, sizeof(unsigned int));
+    }
+
+//! Call f(i) for all i in [0, n), in parallel when TBB is enabled
+/*! \param exec_conf Execution configuration that provides the task arena
+    \param n Number of iterations
+    \param f Function to call
+*/
+template<class F>
+static void
+parallel_loop(std::shared_ptr<const ExecutionConfiguration> exec_conf, unsigned int n, const F& f)
+    {
+#ifdef ENABLE_TBB
+    if (exec_conf->getNumThreads() > 1)
+        {
+        exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                          f(i);
+                                  });
+            });
+        }
+    else
+#endif
+        {
+        for (unsigned int i = 0; i < n; i++)
+            f(i);
+        }
+    }
     } // end namespace detail
 
 /*! Constructs the DCDDumpWriter. After construction, settings are set. No file operations are
@@ -80,7 +138,6 @@ DCDDumpWriter::DCDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
 //! Initializes the output file for writing
 void DCDDumpWriter::initFileIO(uint64_t timestep)
     {
-    m_staging_buffer = new float[m_pdata->getNGlobal()];
     m_is_initialized = true;
 
     m_nglobal = m_pdata->getNGlobal();
@@ -137,7 +194,6 @@ DCDDumpWriter::~DCDDumpWriter()
     if (m_is_initialized)
         {
         m_file.close();
-        delete[] m_staging_buffer;
         }
     }
 
@@ -149,10 +205,8 @@ DCDDumpWriter::~DCDDumpWriter()
 void DCDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    // take particle data snapshot
-    SnapshotParticleData<Scalar> snapshot;
-
-    m_pdata->takeSnapshot(snapshot);
+    // unwrap the positions and collect them on the root rank
+    gather_coordinates();
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
@@ -190,9 +244,17 @@ void DCDDumpWriter::analyze(uint64_t timestep)
             << " + i * " << m_period << endl;
 
     // write the data for the current time step
+    m_frame_buffer.clear();
+    write_frame_header();
+    write_frame_data();
     m_file.seekp(0, std::ios_base::end);
-    write_frame_header(m_file);
-    write_frame_data(m_file, snapshot);
+    m_file.write(m_frame_buffer.data(), m_frame_buffer.size());
+
+    // check for errors
+    if (!m_file.good())
+        {
+        throw runtime_error("I/O error while writing DCD frame data.");
+        }
 
     // update the header with the number of frames written
     m_num_frames_written++;
@@ -269,11 +331,133 @@ void DCDDumpWriter::write_file_header(std::fstream& file)
         }
     }
 
-/*! \param file File to write to
-    Writes the header that precedes each snapshot in the file. This header
+/*! Unwraps the positions of the local group members, converts them to float, and stores the x,
+    y, and z coordinates of all group members in tag order in m_staging_buffer on the root rank.
+    Only the coordinates (and not a full particle data snapshot) are communicated.
+*/
+void DCDDumpWriter::gather_coordinates()
+    {
+    BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int nparticles = m_group->getNumMembersGlobal();
+    const unsigned int n_local = m_pdata->getN() + m_pdata->getNGhosts();
+
+    // access the group arrays first, they may rebuild and access the particle tags
+    const GlobalArray<unsigned int>& member_tags = m_group->getMemberTagArray();
+    const GlobalArray<unsigned int>& member_idx = m_group->getIndexArray();
+    ArrayHandle<unsigned int> h_member_tags(member_tags, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_member_idx(member_idx, access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+
+    // compute the coordinates to write for the particle with index idx
+    auto get_coordinates = [&](unsigned int idx, float* coords)
+        {
+        vec3<Scalar> pos(h_pos.data[idx]);
+
+        if (m_unwrap_full)
+            {
+            pos = box.shift(pos, h_image.data[idx]);
+            }
+        else if (m_unwrap_rigid && h_body.data[idx] < MIN_FLOPPY)
+            {
+            // the central particle is local or a ghost, leave the particle wrapped otherwise
+            unsigned int central_idx = h_rtag.data[h_body.data[idx]];
+            if (central_idx < n_local)
+                {
+                int3 body_img = h_image.data[central_idx];
+                int3 particle_img = h_image.data[idx];
+                int3 img_diff = make_int3(particle_img.x - body_img.x,
+                                          particle_img.y - body_img.y,
+                                          particle_img.z - body_img.z);
+
+                pos = box.shift(pos, img_diff);
+                }
+            }
+
+        coords[0] = float(pos.x);
+        coords[1] = float(pos.y);
+        coords[2] = float(pos.z);
+
+        // m_angle set to True turns on a hack where the particle orientation angle is written out
+        // to the z component this only works in 2D simulations, obviously
+        if (m_angle)
+            {
+            quat<Scalar> orientation(h_orientation.data[idx]);
+            coords[2] = float(atan2(orientation.v.z, orientation.s) * 2);
+            }
+        };
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        // find the output index of each local member and compute its coordinates
+        const unsigned int n_local_members = m_group->getNumMembers();
+        m_send_index.resize(n_local_members);
+        m_send_coords.resize(3 * size_t(n_local_members));
+        detail::parallel_loop(m_exec_conf,
+                              n_local_members,
+                              [&](unsigned int j)
+                              {
+                                  unsigned int idx = h_member_idx.data[j];
+                                  const unsigned int* tag = std::lower_bound(h_member_tags.data,
+                                                                             h_member_tags.data
+                                                                                 + nparticles,
+                                                                             h_tag.data[idx]);
+                                  m_send_index[j] = (unsigned int)(tag - h_member_tags.data);
+                                  get_coordinates(idx, &m_send_coords[3 * size_t(j)]);
+                              });
+
+        std::vector<std::vector<unsigned int>> recv_index;
+        std::vector<std::vector<float>> recv_coords;
+        gather_v(m_send_index, recv_index, 0, m_exec_conf->getMPICommunicator());
+        gather_v(m_send_coords, recv_coords, 0, m_exec_conf->getMPICommunicator());
+
+        if (m_exec_conf->isRoot())
+            {
+            m_staging_buffer.resize(3 * size_t(nparticles));
+            for (unsigned int rank = 0; rank < recv_index.size(); rank++)
+                {
+                for (size_t k = 0; k < recv_index[rank].size(); k++)
+                    {
+                    unsigned int group_idx = recv_index[rank][k];
+                    for (unsigned int d = 0; d < 3; d++)
+                        {
+                        m_staging_buffer[d * size_t(nparticles) + group_idx]
+                            = recv_coords[rank][3 * k + d];
+                        }
+                    }
+                }
+            }
+        return;
+        }
+#endif
+
+    // all members are local, loop in tag order
+    m_staging_buffer.resize(3 * size_t(nparticles));
+    detail::parallel_loop(m_exec_conf,
+                          nparticles,
+                          [&](unsigned int group_idx)
+                          {
+                              float coords[3];
+                              get_coordinates(h_rtag.data[h_member_tags.data[group_idx]], coords);
+                              for (unsigned int d = 0; d < 3; d++)
+                                  m_staging_buffer[d * size_t(nparticles) + group_idx] = coords[d];
+                          });
+    }
+
+/*! Appends the header that precedes each snapshot in the file to the frame buffer. This header
     includes information on the box size of the simulation.
 */
-void DCDDumpWriter::write_frame_header(std::fstream& file)
+void DCDDumpWriter::write_frame_header()
     {
     double unitcell[6];
     BoxDim box = m_pdata->getGlobalBox();
@@ -297,104 +481,27 @@ void DCDDumpWriter::write_frame_header(std::fstream& file)
     unitcell[3] = beta;
     unitcell[4] = alpha;
 
-    detail::write_int(file, 48);
-    file.write((char*)unitcell, 48);
-    detail::write_int(file, 48);
-
-    // check for errors
-    if (!file.good())
-        {
-        throw runtime_error("DCD: I/O error while writing DCD frame header.");
-        }
+    detail::append_int(m_frame_buffer, 48);
+    detail::append_bytes(m_frame_buffer, unitcell, 48);
+    detail::append_int(m_frame_buffer, 48);
     }
 
-/*! \param file File to write to
-    \param snapshot Snapshot to write
-    Writes the actual particle positions for all particles at the current time step
+/*! Appends the x, y, and z coordinates in m_staging_buffer to the frame buffer, each as one
+    Fortran record.
 */
-void DCDDumpWriter::write_frame_data(std::fstream& file,
-                                     const SnapshotParticleData<Scalar>& snapshot)
+void DCDDumpWriter::write_frame_data()
     {
-    // we need to unsort the positions and write in tag order
-    assert(m_staging_buffer);
-
-    BoxDim box = m_pdata->getGlobalBox();
-
     unsigned int nparticles = m_group->getNumMembersGlobal();
+    unsigned int record_size = (unsigned int)(nparticles * sizeof(float));
+    m_frame_buffer.reserve(m_frame_buffer.size() + 3 * (size_t(record_size) + 8));
 
-    // Create a tmp copy of the particle data and unwrap particles
-    std::vector<vec3<Scalar>> tmp_pos(snapshot.pos);
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
+    for (unsigned int d = 0; d < 3; d++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
-
-        if (m_unwrap_full)
-            {
-            tmp_pos[i] = box.shift(tmp_pos[i], snapshot.image[i]);
-            }
-        else if (m_unwrap_rigid && snapshot.body[i] < MIN_FLOPPY)
-            {
-            unsigned int central_ptl_tag = snapshot.body[i];
-            int body_ix = snapshot.image[central_ptl_tag].x;
-            int body_iy = snapshot.image[central_ptl_tag].y;
-            int body_iz = snapshot.image[central_ptl_tag].z;
-            int3 particle_img = snapshot.image[i];
-            int3 img_diff = make_int3(particle_img.x - body_ix,
-                                      particle_img.y - body_iy,
-                                      particle_img.z - body_iz);
-
-            tmp_pos[i] = box.shift(tmp_pos[i], img_diff);
-            }
-        }
-
-    // prepare x coords for writing, looping in tag order
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].x);
-        }
-
-    // write x coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare y coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].y);
-        }
-
-    // write y coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // prepare z coords for writing
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].z);
-
-        // m_angle set to True turns on a hack where the particle orientation angle is written out
-        // to the z component this only works in 2D simulations, obviously
-        if (m_angle)
-            {
-            m_staging_buffer[group_idx]
-                = float(atan2(snapshot.orientation[i].v.z, snapshot.orientation[i].s) * 2);
-            }
-        }
-
-    // write z coords
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-    file.write((char*)m_staging_buffer, nparticles * sizeof(float));
-    detail::write_int(file, (unsigned int)(nparticles * sizeof(float)));
-
-    // check for errors
-    if (!file.good())
-        {
-        throw runtime_error("I/O error while writing DCD frame data.");
+        detail::append_int(m_frame_buffer, record_size);
+        detail::append_bytes(m_frame_buffer,
+                             m_staging_buffer.data() + d * size_t(nparticles),
+                             record_size);
+        detail::append_int(m_frame_buffer, record_size);
         }
     }
 
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*! \file DCDDumpWriter.h
     \brief Declares the DCDDumpWriter class
@@ -45,6 +46,10 @@ namespace hoomd
     Due to a limitation in the DCD format, the time step period between calls to
     analyze() \b must be specified up front. If analyze() detects that this period is
     not being maintained, it will print a warning but continue.
+
+    Each rank unwraps the positions of its local group members and converts them to float (in
+    parallel with TBB). The root rank gathers only these coordinates, assembles the whole frame in
+    one buffer, and writes it with a single call.
     \ingroup analyzers
 */
 class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
@@ -118,17 +123,25 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     bool m_is_initialized;  //!< True if file IO has been initialized
     unsigned int m_nglobal; //!< Initial number of particles
 
-    float* m_staging_buffer; //!< Buffer for staging particle positions in tag order
-    std::fstream m_file;     //!< The file object
+    std::vector<float> m_staging_buffer; //!< x, y, and z coordinates of the group in tag order
+    std::vector<char> m_frame_buffer;    //!< Frame header and data, written in one call
+    std::fstream m_file;                 //!< The file object
+
+#ifdef ENABLE_MPI
+    std::vector<unsigned int> m_send_index; //!< Output index of the local group members
+    std::vector<float> m_send_coords;       //!< Coordinates of the local group members
+#endif
 
     // helper functions
 
     //! Initializes the file header
     void write_file_header(std::fstream& file);
-    //! Writes the frame header
-    void write_frame_header(std::fstream& file);
-    //! Writes the particle positions for a frame
-    void write_frame_data(std::fstream& file, const SnapshotParticleData<Scalar>& snapshot);
+    //! Collects the coordinates to write in m_staging_buffer on the root rank
+    void gather_coordinates();
+    //! Appends the frame header to the frame buffer
+    void write_frame_header();
+    //! Appends the particle positions to the frame buffer
+    void write_frame_data();
     //! Updates the file header
     void write_updated_header(std::fstream& file, uint64_t timestep);
     //! Initializes the output file for writing
@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "ExecutionConfiguration.h"
+#include "GPUArray.h"
 #include "HOOMDVersion.h"
 
 #ifdef ENABLE_HIP
@@ -17,6 +18,7 @@
 #endif
 
 #include <algorithm>
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -98,6 +100,7 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
 #endif
 
     m_in_multigpu_block = false;
+    m_peer_access = false;
 
     // now, exec_mode should be either CPU or GPU - proceed with initialization
 
@@ -195,11 +198,30 @@ ExecutionConfiguration::ExecutionConfiguration(executionMode mode,
                                    << endl;
                     }
                 }
+
+            enablePeerAccess();
             }
 
         // select first device by default
         hipSetDevice(m_gpu_id[0]);
 
+#ifdef HOOMD_STREAM_ORDERED_ALLOCATION
+        // keep memory freed by GPUArray in the device pool so that later allocations reuse it
+        // instead of returning it to the driver at each synchronization
+            {
+            uint64_t release_threshold = UINT64_MAX;
+#ifdef __HIP_PLATFORM_NVCC__
+            cudaMemPool_t pool;
+            cudaDeviceGetDefaultMemPool(&pool, m_gpu_id[0]);
+            cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &release_threshold);
+#else
+            hipMemPool_t pool;
+            hipDeviceGetDefaultMemPool(&pool, m_gpu_id[0]);
+            hipMemPoolSetAttribute(pool, hipMemPoolAttrReleaseThreshold, &release_threshold);
+#endif
+            }
+#endif
+
         hipError_t err_sync = hipPeekAtLastError();
         handleHIPError(err_sync, __FILE__, __LINE__);
 
@@ -411,6 +433,15 @@ void ExecutionConfiguration::scanGPUs()
 
     s_gpu_scan_complete = true;
 
+#if defined(__HIP_PLATFORM_NVCC__)
+    // Load the kernels of a module when they are first launched, not when the CUDA context is
+    // created. The fat binaries hold kernels for every pair potential and shape, most of which a
+    // simulation never launches. The variable takes effect only when it is set before the first
+    // CUDA call in the process, does not replace a value set by the user, and is ignored by CUDA
+    // versions without lazy loading.
+    setenv("CUDA_MODULE_LOADING", "LAZY", 0);
+#endif
+
     // determine the number of GPUs that CUDA thinks there is
     int dev_count;
     hipError_t error = hipGetDeviceCount(&dev_count);
@@ -490,6 +521,51 @@ void ExecutionConfiguration::scanGPUs()
 
 #endif
 
+#if defined(ENABLE_HIP)
+/*! With peer-to-peer access, kernels read managed memory that resides on another GPU directly over
+    NVLink or PCIe through the mappings set up by cudaMemAdviseSetAccessedBy, instead of faulting
+    the pages over to the accessing GPU.
+*/
+void ExecutionConfiguration::enablePeerAccess()
+    {
+    m_peer_access = true;
+    for (unsigned int idev = 0; idev < m_gpu_id.size(); ++idev)
+        {
+        hipSetDevice(m_gpu_id[idev]);
+        for (unsigned int jdev = 0; jdev < m_gpu_id.size(); ++jdev)
+            {
+            if (idev == jdev)
+                continue;
+
+            int can_access = 0;
+            hipDeviceCanAccessPeer(&can_access, m_gpu_id[idev], m_gpu_id[jdev]);
+            if (!can_access)
+                {
+                m_peer_access = false;
+                continue;
+                }
+
+            hipError_t error = hipDeviceEnablePeerAccess(m_gpu_id[jdev], 0);
+            if (error == hipErrorPeerAccessAlreadyEnabled)
+                {
+                // clear the error state
+                hipGetLastError();
+                }
+            else if (error != hipSuccess)
+                {
+                hipGetLastError();
+                m_peer_access = false;
+                }
+            }
+        }
+
+    if (m_peer_access)
+        msg->notice(2) << "Enabled peer-to-peer access between all GPUs" << endl;
+    else
+        msg->notice(2) << "Peer-to-peer access is not available between all GPUs" << endl;
+    }
+#endif
+
 /*! Print out GPU stats if running on the GPU, otherwise determine and print out the CPU stats
  */
 void ExecutionConfiguration::setupStats()
@@ -675,6 +751,15 @@ void export_ExecutionConfiguration(pybind11::module& m)
         .def("isCUDAEnabled", &ExecutionConfiguration::isCUDAEnabled)
         .def("setCUDAErrorChecking", &ExecutionConfiguration::setCUDAErrorChecking)
         .def("isCUDAErrorCheckingEnabled", &ExecutionConfiguration::isCUDAErrorCheckingEnabled)
+        .def("setAutotunerSuccessiveHalving",
+             &ExecutionConfiguration::setAutotunerSuccessiveHalving)
+        .def("isAutotunerSuccessiveHalvingEnabled",
+             &ExecutionConfiguration::isAutotunerSuccessiveHalvingEnabled)
+        .def("setAutotunerRetuneThreshold", &ExecutionConfiguration::setAutotunerRetuneThreshold)
+        .def("getAutotunerRetuneThreshold", &ExecutionConfiguration::getAutotunerRetuneThreshold)
+        .def("setDeterministicReduction", &ExecutionConfiguration::setDeterministicReduction)
+        .def("isDeterministicReductionEnabled",
+             &ExecutionConfiguration::isDeterministicReductionEnabled)
         .def("getNumActiveGPUs", &ExecutionConfiguration::getNumActiveGPUs)
         .def_readonly("msg", &ExecutionConfiguration::msg)
 #if defined(ENABLE_HIP)
@@ -132,6 +132,52 @@ class PYBIND11_EXPORT ExecutionConfiguration
         m_hip_error_checking = hip_error_checking;
         }
 
+    //! Returns true if autotuners scan with successive halving
+    bool isAutotunerSuccessiveHalvingEnabled() const
+        {
+        return m_autotuner_successive_halving;
+        }
+
+    //! Sets the autotuner scan strategy
+    /*! \param successive_halving When true, autotuners discard the slower half of the remaining
+            parameters after each sample instead of sampling every parameter m_n_samples times
+    */
+    void setAutotunerSuccessiveHalving(bool successive_halving)
+        {
+        m_autotuner_successive_halving = successive_halving;
+        }
+
+    //! Get the relative slowdown that triggers a new autotuner scan
+    float getAutotunerRetuneThreshold() const
+        {
+        return m_autotuner_retune_threshold;
+        }
+
+    //! Set the relative slowdown that triggers a new autotuner scan
+    /*! \param threshold Autotuners scan again when the optimal parameter runs slower than its
+            tuned time by more than this fraction. Set to 0 to disable retuning.
+    */
+    void setAutotunerRetuneThreshold(float threshold)
+        {
+        m_autotuner_retune_threshold = threshold;
+        }
+
+    //! Returns true if threaded CPU reductions sum in a fixed order
+    bool isDeterministicReductionEnabled() const
+        {
+        return m_deterministic_reduction;
+        }
+
+    //! Sets the threaded CPU reduction mode
+    /*! \param deterministic When true, threaded loops that accumulate into per-thread arrays
+            assign the work to the arrays in fixed slices and sum the arrays in order, so the
+            results do not depend on the TBB scheduler.
+    */
+    void setDeterministicReduction(bool deterministic)
+        {
+        m_deterministic_reduction = deterministic;
+        }
+
     //! Get the number of active GPUs
     unsigned int getNumActiveGPUs() const
         {
@@ -204,6 +250,12 @@ class PYBIND11_EXPORT ExecutionConfiguration
         return m_concurrent;
         }
 
+    //! Test whether all pairs of active GPUs have peer-to-peer access enabled
+    bool allPeerAccess() const
+        {
+        return m_peer_access;
+        }
+
 #ifdef ENABLE_HIP
     hipDeviceProp_t dev_prop; //!< Cached device properties of the first GPU
 
@@ -346,6 +398,9 @@ class PYBIND11_EXPORT ExecutionConfiguration
     //! Initialize the GPU with the given id (where gpu_id is an index into s_capable_gpu_ids)
     void initializeGPU(int gpu_id);
 
+    //! Enable peer-to-peer access between all pairs of active GPUs
+    void enablePeerAccess();
+
     /// Provide a string that describes a GPU device
     static std::string describeGPU(int id, hipDeviceProp_t prop);
 
@@ -392,6 +447,7 @@ class PYBIND11_EXPORT ExecutionConfiguration
     std::vector<std::string> m_active_device_descriptions;
 
     bool m_concurrent; //!< True if all GPUs have concurrentManagedAccess flag
+    bool m_peer_access; //!< True if all pairs of active GPUs have peer-to-peer access enabled
 
     mutable bool m_in_multigpu_block; //!< Tracks whether we are in a multi-GPU block
 
@@ -410,6 +466,15 @@ class PYBIND11_EXPORT ExecutionConfiguration
     void setupStats();
 
     bool m_memory_tracing = false;
+
+    /// True when autotuners scan with successive halving
+    bool m_autotuner_successive_halving = false;
+
+    /// Relative slowdown that triggers a new autotuner scan (0 disables retuning)
+    float m_autotuner_retune_threshold = 0.0f;
+
+    /// True when threaded CPU reductions sum in a fixed order
+    bool m_deterministic_reduction = false;
     };
 
 #if defined(ENABLE_HIP)
@@ -26,7 +26,7 @@ namespace hoomd
     \post All forces are initialized to 0
 */
 ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
-    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false)
+    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false), m_interval(1)
     {
     assert(m_pdata);
     assert(m_pdata->getMaxN() > 0);
@@ -233,6 +233,20 @@ Scalar ForceCompute::calcEnergySum()
     return Scalar(pe_total);
     }
 
+/*! \param timestep Current time step
+    \returns The total potential energy, including the external energy
+
+    The default implementation computes the forces and sums the energies. Subclasses that can
+    evaluate the energy without the forces and virials override this method. Unlike compute(), the
+    energy is always evaluated, so callers may use it for trial configurations.
+*/
+Scalar ForceCompute::computeEnergy(uint64_t timestep)
+    {
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+    computeForces(timestep);
+    return calcEnergySum();
+    }
+
 /*! Sums the potential energy of a particle group calculated by the last call to compute() and
  * returns it.
  */
@@ -566,7 +580,15 @@ void ForceCompute::compute(uint64_t timestep)
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
+        ScopedOperationTimer timer(m_timer, typeid(*this));
         computeForces(timestep);
+
+        // estimate the traffic of the per-particle arrays: read the positions, write the forces,
+        // energies, and (when requested) the virials
+        uint64_t bytes_per_particle = 2 * sizeof(Scalar4);
+        if (m_pdata->getFlags()[pdata_flag::pressure_tensor])
+            bytes_per_particle += 6 * sizeof(Scalar);
+        m_timer.addBytes(bytes_per_particle * m_pdata->getN());
         }
 
     m_particles_sorted = false;
@@ -687,10 +709,12 @@ void export_ForceCompute(pybind11::module& m)
         .def("getExternalEnergy", &ForceCompute::getExternalEnergy)
         .def("getExternalVirial", &ForceCompute::getExternalVirial)
         .def("calcEnergySum", &ForceCompute::calcEnergySum)
+        .def("computeEnergy", &ForceCompute::computeEnergy)
         .def("getEnergies", &ForceCompute::getEnergiesPython)
         .def("getForces", &ForceCompute::getForcesPython)
         .def("getTorques", &ForceCompute::getTorquesPython)
-        .def("getVirials", &ForceCompute::getVirialsPython);
+        .def("getVirials", &ForceCompute::getVirialsPython)
+        .def_property("interval", &ForceCompute::getInterval, &ForceCompute::setInterval);
     }
     } // end namespace detail
 
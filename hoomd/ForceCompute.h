@@ -18,6 +18,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <stdexcept>
 
 /*! \file ForceCompute.h
     \brief Declares the ForceCompute class
@@ -68,17 +69,47 @@ class PYBIND11_EXPORT ForceCompute : public Compute
 #ifdef ENABLE_MPI
     //! Pre-compute the forces
     /*! This method is called in MPI simulations BEFORE the particles are migrated
-     * and can be used to overlap computation with communication
+     * and can be used to overlap computation with communication. When the integrator overlaps the
+     * ghost update with the force computation, the ghost data may still be in flight, see
+     * Communicator::deferFinishUpdateGhosts().
      */
     virtual void preCompute(uint64_t timestep) { }
+
+    //! Returns true if computeForces() can start while a ghost update is in flight
+    /*! Such force computes call Communicator::finishUpdateGhosts() before they access ghost data.
+     */
+    virtual bool overlapsGhostUpdate()
+        {
+        return false;
+        }
 #endif
 
     //! Computes the forces
     virtual void compute(uint64_t timestep);
 
+    //! Set the number of time steps between applications of the force in the equations of motion
+    /*! Integrator computes the force only on time steps that are multiples of \a interval and
+        applies it with a weight of \a interval (multiple time step integration).
+    */
+    void setInterval(unsigned int interval)
+        {
+        if (interval == 0)
+            throw std::invalid_argument("interval must be positive");
+        m_interval = interval;
+        }
+
+    //! Get the number of time steps between applications of the force
+    unsigned int getInterval() const
+        {
+        return m_interval;
+        }
+
     //! Total the potential energy
     Scalar calcEnergySum();
 
+    //! Compute the total potential energy of the current configuration on all ranks
+    virtual Scalar computeEnergy(uint64_t timestep);
+
     //! Sum the potential energy of a group
     Scalar calcEnergyGroup(std::shared_ptr<ParticleGroup> group);
 
@@ -237,6 +268,8 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     // whether the local force buffers exposed by this class should be read-only
     bool m_buffers_writeable;
 
+    unsigned int m_interval; //!< Number of time steps between applications of the force
+
 #ifdef ENABLE_MPI
     /// Helper class to gather particle forces, energies, and virials
     GatherTagOrder m_gather_tag_order;
@@ -21,6 +21,7 @@
 
 #include "ExecutionConfiguration.h"
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -75,6 +76,54 @@ template<class T> class GPUArray;
 
 namespace detail
     {
+//! Get a new write generation for GPUArray and GlobalArray
+/*! Generations are unique across all arrays. A cache of data derived from an array can store the
+    array's generation and compare it later to find out whether the array may have been written.
+*/
+inline uint64_t nextWriteGeneration()
+    {
+    static std::atomic<uint64_t> generation(0);
+    return ++generation;
+    }
+
+#ifdef ENABLE_HIP
+// Stream-ordered allocation is available in CUDA 11.2 and ROCm 5.3
+#if defined(__HIP_PLATFORM_NVCC__)
+#if CUDART_VERSION >= 11020
+#define HOOMD_STREAM_ORDERED_ALLOCATION
+#endif
+#elif defined(HIP_VERSION) && HIP_VERSION >= 50300000
+#define HOOMD_STREAM_ORDERED_ALLOCATION
+#endif
+
+//! Allocate device memory for a GPUArray
+/*! When the runtime supports it, the allocation is ordered on the default stream and served from
+    the device memory pool, so it does not synchronize the device like hipMalloc does.
+*/
+inline hipError_t device_malloc(void** ptr, size_t num_bytes)
+    {
+#if defined(HOOMD_STREAM_ORDERED_ALLOCATION) && defined(__HIP_PLATFORM_NVCC__)
+    return hipCUDAErrorTohipError(cudaMallocAsync(ptr, num_bytes, 0));
+#elif defined(HOOMD_STREAM_ORDERED_ALLOCATION)
+    return hipMallocAsync(ptr, num_bytes, 0);
+#else
+    return hipMalloc(ptr, num_bytes);
+#endif
+    }
+
+//! Free device memory allocated with device_malloc()
+inline void device_free(void* ptr)
+    {
+#if defined(HOOMD_STREAM_ORDERED_ALLOCATION) && defined(__HIP_PLATFORM_NVCC__)
+    cudaFreeAsync(ptr, 0);
+#elif defined(HOOMD_STREAM_ORDERED_ALLOCATION)
+    hipFreeAsync(ptr, 0);
+#else
+    hipFree(ptr);
+#endif
+    }
+#endif
+
 template<class T> class device_deleter
     {
     public:
@@ -108,7 +157,7 @@ template<class T> class device_deleter
                 << "Freeing " << m_N * sizeof(T) << " bytes of CUDA memory." << std::endl;
 
 #ifdef ENABLE_HIP
-            hipFree(ptr);
+            device_free(ptr);
 #endif
             }
         }
@@ -223,6 +272,16 @@ template<class T, class Derived> class GPUArrayBase
         return static_cast<Derived const&>(*this).getHeight();
         }
 
+    //! Get the write generation
+    /*! The generation changes each time the array is acquired with a mode other than
+        access_mode::read, resized, or assigned. Arrays exchange their generations with their data
+        in swap().
+    */
+    uint64_t getWriteGeneration() const
+        {
+        return static_cast<Derived const&>(*this).getWriteGeneration();
+        }
+
     //! Resize the GPUArray
     void resize(size_t num_elements)
         {
@@ -235,6 +294,14 @@ template<class T, class Derived> class GPUArrayBase
         static_cast<Derived&>(*this).resize(width, height);
         }
 
+#ifdef ENABLE_HIP
+    //! Start copying the data to the host without blocking the host
+    void prefetchHost(hipStream_t stream, hipEvent_t event) const
+        {
+        static_cast<Derived const&>(*this).prefetchHost(stream, event);
+        }
+#endif
+
     protected:
     //! Acquires the data pointer for use
     inline ArrayHandleDispatch<T> acquire(const access_location::Enum location,
@@ -449,7 +516,12 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     //! Constructs a 2-D GPUArray
     GPUArray(size_t width, size_t height, std::shared_ptr<const ExecutionConfiguration> exec_conf);
     //! Frees memory
-    virtual ~GPUArray() { }
+    virtual ~GPUArray()
+        {
+#ifdef ENABLE_HIP
+        waitPendingCopy();
+#endif
+        }
 
 #ifdef ENABLE_HIP
     //! Constructs a 1-D GPUArray
@@ -514,6 +586,12 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
         return m_height;
         }
 
+    //! Get the write generation
+    uint64_t getWriteGeneration() const
+        {
+        return m_write_generation;
+        }
+
     //! Resize the GPUArray
     /*! This method resizes the array by allocating a new array and copying over the elements
         from the old array. This is a slow process.
@@ -525,6 +603,23 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     //! Resize a 2D GPUArray
     void resize(size_t width, size_t height);
 
+#ifdef ENABLE_HIP
+    //! Start copying the data to the host without blocking the host
+    /*! \param stream Stream to order the copy on
+        \param event Event to record on \a stream after the copy
+
+        When the current data is only on the device, prefetchHost() enqueues the device to host
+        copy on \a stream and records \a event after it. The next host ArrayHandle waits only on
+        \a event instead of the whole device, so analyzers and loggers can request their data
+        early and overlap the copy with other work. When the host data is already current,
+        prefetchHost() only records \a event.
+
+        The caller owns \a event, which must remain valid until the array is next acquired,
+        resized, assigned, or destroyed.
+    */
+    void prefetchHost(hipStream_t stream, hipEvent_t event) const;
+#endif
+
     //! Return a string representation of this array
     std::string getRepresentation() const
         {
@@ -603,6 +698,9 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
 
     mutable bool m_acquired;                     //!< Tracks whether the data has been acquired
     mutable data_location::Enum m_data_location; //!< Tracks the current location of the data
+
+    //! Changes when the data may have been written
+    mutable uint64_t m_write_generation = detail::nextWriteGeneration();
 #ifdef ENABLE_HIP
     bool m_mapped; //!< True if we are using mapped memory
 #endif
@@ -629,6 +727,11 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     inline void memcpyDeviceToHost(bool async) const;
     //! Helper function to copy memory from the host to device
     inline void memcpyHostToDevice(bool async) const;
+
+    //! Wait for the copy started by prefetchHost() to complete
+    inline void waitPendingCopy() const;
+
+    mutable hipEvent_t m_pending_copy = nullptr; //!< Event recorded after a prefetchHost() copy
 #endif
 
     //! Helper function to resize host array
@@ -834,6 +937,10 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
         // sanity check
         assert(!m_acquired && !rhs.m_acquired);
 
+#ifdef ENABLE_HIP
+        waitPendingCopy();
+#endif
+
         // copy over basic elements
         m_num_elements = rhs.m_num_elements;
         m_pitch = rhs.m_pitch;
@@ -844,6 +951,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
 #endif
         // initialize state variables
         m_data_location = data_location::host;
+        m_write_generation = detail::nextWriteGeneration();
 
         // copy over the data to the new GPUArray
         if (rhs.h_data)
@@ -879,6 +987,10 @@ GPUArray<T>::GPUArray(GPUArray&& from) noexcept
 #endif
       h_data(std::move(from.h_data)), m_exec_conf(std::move(from.m_exec_conf))
     {
+#ifdef ENABLE_HIP
+    m_pending_copy = from.m_pending_copy;
+    from.m_pending_copy = nullptr;
+#endif
     }
 
 //! Move assignment operator
@@ -886,6 +998,11 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(GPUArray&& rhs) noexcept
     {
     if (&rhs != this)
         {
+#ifdef ENABLE_HIP
+        waitPendingCopy();
+        m_pending_copy = rhs.m_pending_copy;
+        rhs.m_pending_copy = nullptr;
+#endif
         m_num_elements = std::move(rhs.m_num_elements);
         m_pitch = std::move(rhs.m_pitch);
         m_height = std::move(rhs.m_height);
@@ -897,6 +1014,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(GPUArray&& rhs) noexcept
         h_data = std::move(rhs.h_data);
         m_data_location = std::move(rhs.m_data_location);
         m_acquired = std::move(rhs.m_acquired);
+        m_write_generation = detail::nextWriteGeneration();
         }
 
     return *this;
@@ -926,10 +1044,12 @@ template<class T> void GPUArray<T>::swap(GPUArray& from)
     std::swap(m_height, from.m_height);
     std::swap(m_acquired, from.m_acquired);
     std::swap(m_data_location, from.m_data_location);
+    std::swap(m_write_generation, from.m_write_generation);
     std::swap(m_exec_conf, from.m_exec_conf);
 #ifdef ENABLE_HIP
     std::swap(d_data, from.d_data);
     std::swap(m_mapped, from.m_mapped);
+    std::swap(m_pending_copy, from.m_pending_copy);
 #endif
     std::swap(h_data, from.h_data);
     }
@@ -1023,7 +1143,8 @@ template<class T> void GPUArray<T>::allocate()
         else
             {
 #ifdef ENABLE_HIP
-            hipError_t error = hipMalloc(&device_ptr, m_num_elements * sizeof(T));
+            hipError_t error
+                = hoomd::detail::device_malloc(&device_ptr, m_num_elements * sizeof(T));
             if (error == hipErrorMemoryAllocation)
                 {
                 throw std::bad_alloc();
@@ -1147,6 +1268,55 @@ template<class T> void GPUArray<T>::memcpyHostToDevice(bool async) const
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
     }
+
+/*! \param stream Stream to order the copy on
+    \param event Event to record on \a stream after the copy
+
+    \post The data location is data_location::hostdevice when the data was on the device
+*/
+template<class T> void GPUArray<T>::prefetchHost(hipStream_t stream, hipEvent_t event) const
+    {
+    if (m_acquired)
+        {
+        throw std::runtime_error("Cannot prefetch an array in use.");
+        }
+
+    // a previous prefetch may still be writing to the host buffer
+    waitPendingCopy();
+
+    if (!isNull() && m_data_location == data_location::device && !m_mapped)
+        {
+        if (m_exec_conf)
+            m_exec_conf->msg->notice(10)
+                << "GPUArray: Prefetching " << float(m_num_elements * sizeof(T)) / 1024.0f / 1024.0f
+                << " MB device->host" << std::endl;
+
+        hipMemcpyAsync(h_data.get(),
+                       d_data.get(),
+                       sizeof(T) * m_num_elements,
+                       hipMemcpyDeviceToHost,
+                       stream);
+        m_data_location = data_location::hostdevice;
+        }
+
+    hipEventRecord(event, stream);
+    m_pending_copy = event;
+
+    if (m_exec_conf && m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+/*! Every access waits for the pending copy, so host code never reads a partially copied buffer
+    and device code never overwrites the data while it is being copied.
+*/
+template<class T> void GPUArray<T>::waitPendingCopy() const
+    {
+    if (!m_pending_copy)
+        return;
+
+    hipEventSynchronize(m_pending_copy);
+    m_pending_copy = nullptr;
+    }
 #endif
 
 /*! \param location Desired location to access the data
@@ -1175,6 +1345,13 @@ ArrayHandleDispatch<T> GPUArray<T>::acquire(const access_location::Enum location
         }
     m_acquired = true;
 
+    if (mode != access_mode::read)
+        m_write_generation = detail::nextWriteGeneration();
+
+#ifdef ENABLE_HIP
+    waitPendingCopy();
+#endif
+
     // base case - handle acquiring a NULL GPUArray by simply returning NULL to prevent any memcpys
     // from being attempted
     if (isNull())
@@ -1476,7 +1653,7 @@ template<class T> T* GPUArray<T>::resizeDeviceArray(size_t num_elements)
     // allocate resized array
     T* d_tmp;
 #ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, num_elements * sizeof(T));
+    hipError_t error = hoomd::detail::device_malloc((void**)&d_tmp, num_elements * sizeof(T));
     if (error == hipErrorMemoryAllocation)
         {
         throw std::bad_alloc();
@@ -1535,7 +1712,8 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
     // allocate resized array
     T* d_tmp;
 #ifdef ENABLE_HIP
-    hipError_t error = hipMalloc(&d_tmp, new_pitch * new_height * sizeof(T));
+    hipError_t error
+        = hoomd::detail::device_malloc((void**)&d_tmp, new_pitch * new_height * sizeof(T));
     if (error == hipErrorMemoryAllocation)
         {
         throw std::bad_alloc();
@@ -1591,6 +1769,10 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
 template<class T> void GPUArray<T>::resize(size_t num_elements)
     {
     assert(!m_acquired);
+#ifdef ENABLE_HIP
+    waitPendingCopy();
+#endif
+    m_write_generation = detail::nextWriteGeneration();
     assert(num_elements > 0);
 
     // if not allocated, simply allocate
@@ -1632,6 +1814,10 @@ template<class T> void GPUArray<T>::resize(size_t num_elements)
 template<class T> void GPUArray<T>::resize(size_t width, size_t height)
     {
     assert(!m_acquired);
+#ifdef ENABLE_HIP
+    waitPendingCopy();
+#endif
+    m_write_generation = detail::nextWriteGeneration();
 
     // make m_pitch the next multiple of 16 larger or equal to the given width
     size_t new_pitch = (width + (16 - (width & 15)));
@@ -0,0 +1,214 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "GSDCompression.h"
+
+#include <stdexcept>
+#include <string.h>
+
+#ifdef ENABLE_ZSTD
+#include <zstd.h>
+#endif
+
+/*! \file GSDCompression.cc
+    \brief Defines the helpers that compress and decompress GSD chunks
+*/
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace detail
+    {
+#ifdef ENABLE_ZSTD
+//! zstd compression level, favor write bandwidth over the compression ratio
+const int zstd_compression_level = 1;
+#endif
+
+//! Shuffle the bytes of n elements of the given size
+static void shuffleBytes(char* output, const char* input, size_t n, size_t element_size)
+    {
+    for (size_t i = 0; i < n; i++)
+        {
+        for (size_t b = 0; b < element_size; b++)
+            {
+            output[b * n + i] = input[i * element_size + b];
+            }
+        }
+    }
+
+//! Reverse shuffleBytes()
+static void unshuffleBytes(char* output, const char* input, size_t n, size_t element_size)
+    {
+    for (size_t i = 0; i < n; i++)
+        {
+        for (size_t b = 0; b < element_size; b++)
+            {
+            output[i * element_size + b] = input[b * n + i];
+            }
+        }
+    }
+
+GSDCompression::codec GSDCompression::getCodec(const std::string& name)
+    {
+    if (name == "none")
+        {
+        return none;
+        }
+    else if (name == "zstd")
+        {
+        return zstd;
+        }
+
+    throw invalid_argument("Invalid GSD compression codec: " + name);
+    }
+
+std::string GSDCompression::getCodecName(codec value)
+    {
+    return value == zstd ? "zstd" : "none";
+    }
+
+bool GSDCompression::isAvailable(codec value)
+    {
+    if (value == zstd)
+        {
+#ifdef ENABLE_ZSTD
+        return true;
+#else
+        return false;
+#endif
+        }
+
+    return true;
+    }
+
+/*! \param output Output: Header and compressed bytes
+    \param scratch Work buffer for the shuffled bytes
+    \param value Compression codec
+    \param type Type of the chunk data
+    \param N Number of rows in the chunk
+    \param M Number of columns in the chunk
+    \param data Chunk data
+*/
+void GSDCompression::compress(std::vector<char>& output,
+                              std::vector<char>& scratch,
+                              codec value,
+                              gsd_type type,
+                              uint64_t N,
+                              uint32_t M,
+                              const void* data)
+    {
+    if (!isAvailable(value) || value == none)
+        {
+        throw runtime_error("GSD: " + getCodecName(value) + " compression is not available.");
+        }
+
+    size_t element_size = gsd_sizeof_type(type);
+    size_t n_elements = N * M;
+    size_t size = n_elements * element_size;
+
+    Header header;
+    memset(&header, 0, sizeof(Header));
+    header.N = N;
+    header.M = M;
+    header.type = uint8_t(type);
+    header.codec = uint8_t(value);
+    header.shuffle = element_size > 1;
+
+    const char* input = static_cast<const char*>(data);
+    if (header.shuffle)
+        {
+        scratch.resize(size);
+        shuffleBytes(scratch.data(), input, n_elements, element_size);
+        input = scratch.data();
+        }
+
+#ifdef ENABLE_ZSTD
+    output.resize(sizeof(Header) + ZSTD_compressBound(size));
+    memcpy(output.data(), &header, sizeof(Header));
+    size_t compressed_size = ZSTD_compress(output.data() + sizeof(Header),
+                                           output.size() - sizeof(Header),
+                                           input,
+                                           size,
+                                           zstd_compression_level);
+    if (ZSTD_isError(compressed_size))
+        {
+        throw runtime_error(string("GSD: ") + ZSTD_getErrorName(compressed_size));
+        }
+    output.resize(sizeof(Header) + compressed_size);
+#endif
+    }
+
+/*! \param input Header and compressed bytes
+    \param input_size Size of \a input in bytes
+    \returns The header of the compressed chunk
+*/
+GSDCompression::Header GSDCompression::readHeader(const char* input, size_t input_size)
+    {
+    if (input_size < sizeof(Header))
+        {
+        throw runtime_error("GSD: Compressed chunk is too small.");
+        }
+
+    Header header;
+    memcpy(&header, input, sizeof(Header));
+    return header;
+    }
+
+/*! \param data Output: Uncompressed chunk data
+    \param size Size of the uncompressed chunk data in bytes
+    \param input Header and compressed bytes
+    \param input_size Size of \a input in bytes
+    \param scratch Work buffer for the shuffled bytes
+*/
+void GSDCompression::decompress(void* data,
+                                size_t size,
+                                const char* input,
+                                size_t input_size,
+                                std::vector<char>& scratch)
+    {
+    Header header = readHeader(input, input_size);
+    codec value = codec(header.codec);
+    if (value != zstd || !isAvailable(value))
+        {
+        throw runtime_error("GSD: Cannot decompress chunk with codec "
+                            + std::to_string(header.codec)
+                            + ", build HOOMD-blue with ENABLE_ZSTD=on.");
+        }
+
+    size_t element_size = gsd_sizeof_type(gsd_type(header.type));
+    if (size != header.N * header.M * element_size)
+        {
+        throw runtime_error("GSD: Unexpected size of compressed chunk.");
+        }
+
+    char* output = static_cast<char*>(data);
+    if (header.shuffle)
+        {
+        scratch.resize(size);
+        output = scratch.data();
+        }
+
+#ifdef ENABLE_ZSTD
+    size_t decompressed_size = ZSTD_decompress(output,
+                                               size,
+                                               input + sizeof(Header),
+                                               input_size - sizeof(Header));
+    if (ZSTD_isError(decompressed_size))
+        {
+        throw runtime_error(string("GSD: ") + ZSTD_getErrorName(decompressed_size));
+        }
+    if (decompressed_size != size)
+        {
+        throw runtime_error("GSD: Compressed chunk is corrupt.");
+        }
+#endif
+
+    if (header.shuffle)
+        {
+        unshuffleBytes(static_cast<char*>(data), output, header.N * header.M, element_size);
+        }
+    }
+
+    } // end namespace detail
+    } // end namespace hoomd
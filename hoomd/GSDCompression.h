@@ -0,0 +1,126 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "hoomd/extern/gsd.h"
+#include <cmath>
+#include <string>
+#include <vector>
+
+/*! \file GSDCompression.h
+    \brief Declares the helpers that compress and decompress GSD chunks
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+/// Compress and decompress GSD data chunks.
+/** GSDDumpWriter stores a compressed chunk `name` as a GSD_TYPE_UINT8 chunk named
+    `hoomd/compressed/name`. The chunk starts with a GSDCompression::Header that records the type
+    and shape of the uncompressed data, followed by the compressed bytes.
+
+    Before compression, arrays with multi-byte elements are byte shuffled: the first bytes of all
+    elements are stored first, then the second bytes, and so on. Shuffling groups the slowly varying
+    sign and exponent bytes of floating point values together, which makes them compress much
+    better.
+
+    Between position keyframes, GSDDumpWriter stores the positions as GSD_TYPE_INT16 multiples of
+    the position quantum relative to the keyframe in the chunk `hoomd/delta/particles/position`.
+    The chunks `hoomd/delta/keyframe` and `hoomd/delta/quantum` give the index of the keyframe and
+    the quantum.
+
+    Files with compressed or delta encoded chunks use the hoomd schema version
+    GSDCompression::schemaVersion() so that readers that do not understand these chunks reject the
+    file instead of reading default values. GSDReader decodes the chunks transparently.
+*/
+class GSDCompression
+    {
+    public:
+    /// Compression codecs.
+    enum codec
+        {
+        none = 0,
+        zstd = 1
+        };
+
+    /// Header stored at the start of each compressed chunk.
+    struct Header
+        {
+        uint64_t N;       //!< Number of rows in the uncompressed chunk
+        uint32_t M;       //!< Number of columns in the uncompressed chunk
+        uint8_t type;     //!< gsd_type of the uncompressed chunk
+        uint8_t codec;    //!< Compression codec
+        uint8_t shuffle;  //!< Non-zero when the bytes are shuffled before compression
+        uint8_t reserved; //!< Reserved for future use
+        };
+
+    /// Prefix of the compressed chunk names.
+    static std::string chunkName(const std::string& name)
+        {
+        return "hoomd/compressed/" + name;
+        }
+
+    /// Prefix of the delta encoded chunk names.
+    static std::string deltaChunkName(const std::string& name)
+        {
+        return "hoomd/delta/" + name;
+        }
+
+    /// Schema version of files with compressed or delta encoded chunks.
+    static uint32_t schemaVersion()
+        {
+        return gsd_make_version(2, 0);
+        }
+
+    /// Parse the name of a codec.
+    static codec getCodec(const std::string& name);
+
+    /// Get the name of a codec.
+    static std::string getCodecName(codec value);
+
+    /// Test whether a codec is available in this build.
+    static bool isAvailable(codec value);
+
+    /// Compress a chunk.
+    static void compress(std::vector<char>& output,
+                         std::vector<char>& scratch,
+                         codec value,
+                         gsd_type type,
+                         uint64_t N,
+                         uint32_t M,
+                         const void* data);
+
+    /// Read the header of a compressed chunk.
+    static Header readHeader(const char* input, size_t input_size);
+
+    /// Decompress a chunk.
+    static void decompress(void* data,
+                           size_t size,
+                           const char* input,
+                           size_t input_size,
+                           std::vector<char>& scratch);
+
+    /// Get the largest power of 2 that is no larger than precision.
+    static double getQuantum(double precision)
+        {
+        return std::exp2(std::floor(std::log2(precision)));
+        }
+
+    /// Round a value to the nearest multiple of quantum.
+    /** Rounding to a multiple of a power of 2 clears the low order mantissa bits, so that the
+        shuffled bytes that hold them compress to almost nothing.
+    */
+    static double quantize(double value, double quantum)
+        {
+        return std::nearbyint(value / quantum) * quantum;
+        }
+    };
+
+    } // end namespace detail
+    } // end namespace hoomd
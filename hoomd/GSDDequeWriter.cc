@@ -4,6 +4,8 @@
 #include "GSDDequeWriter.h"
 #include "hoomd/GSDDumpWriter.h"
 
+#include <algorithm>
+
 namespace hoomd
     {
 GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
@@ -18,6 +20,11 @@ GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
     : GSDDumpWriter(sysdef, trigger, fname, group, mode), m_queue_size(queue_size)
     {
     setLogWriter(logger);
+    if (m_queue_size > 0)
+        {
+        m_frames.resize(m_queue_size);
+        }
+
     bool file_empty = true;
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
@@ -49,24 +56,53 @@ GSDDequeWriter::GSDDequeWriter(std::shared_ptr<SystemDefinition> sysdef,
 
 void GSDDequeWriter::analyze(uint64_t timestep)
     {
-    m_frame_queue.emplace_front();
-    populateLocalFrame(m_frame_queue.front(), timestep);
-    m_log_queue.push_front(getLogData());
-    if (m_queue_size != -1 && m_frame_queue.size() > static_cast<size_t>(m_queue_size))
+    if (m_queue_size == 0)
+        {
+        return;
+        }
+
+    // an unlimited buffer grows when it is full
+    if (m_n_frames == m_frames.size())
+        {
+        if (m_queue_size == -1)
+            {
+            linearize();
+            m_frames.resize(std::max(size_t(1), m_frames.size() * 2));
+            }
+        else
+            {
+            // overwrite the oldest frame
+            m_first = (m_first + 1) % m_frames.size();
+            m_n_frames--;
+            }
+        }
+
+    BufferedFrame& buffered = m_frames[(m_first + m_n_frames) % m_frames.size()];
+    populateLocalFrame(buffered.frame, timestep);
+
         {
-        m_frame_queue.pop_back();
-        m_log_queue.pop_back();
+        // the logged quantities are python objects and System::run releases the GIL
+        pybind11::gil_scoped_acquire acquire;
+        copyLogChunks(getLogData(), buffered.log_chunks);
         }
+    m_n_frames++;
     }
 
 void GSDDequeWriter::dump()
     {
-    for (auto i {static_cast<long int>(m_frame_queue.size()) - 1}; i >= 0; --i)
+    for (size_t i = 0; i < m_n_frames; i++)
         {
-        write(m_frame_queue[i], m_log_queue[i]);
+        BufferedFrame& buffered = m_frames[(m_first + i) % m_frames.size()];
+        write(buffered.frame, buffered.log_chunks);
         }
-    m_frame_queue.clear();
-    m_log_queue.clear();
+    m_first = 0;
+    m_n_frames = 0;
+    }
+
+void GSDDequeWriter::linearize()
+    {
+    std::rotate(m_frames.begin(), m_frames.begin() + m_first, m_frames.end());
+    m_first = 0;
     }
 
 int GSDDequeWriter::getMaxQueueSize() const
@@ -76,7 +112,7 @@ int GSDDequeWriter::getMaxQueueSize() const
 
 size_t GSDDequeWriter::getCurrentQueueSize() const
     {
-    return m_frame_queue.size();
+    return m_n_frames;
     }
 
 void GSDDequeWriter::setMaxQueueSize(int new_max_size)
@@ -86,11 +122,16 @@ void GSDDequeWriter::setMaxQueueSize(int new_max_size)
         {
         return;
         }
-    while (static_cast<size_t>(m_queue_size) < m_frame_queue.size())
+
+    // drop the oldest frames that do not fit
+    while (static_cast<size_t>(m_queue_size) < m_n_frames)
         {
-        m_frame_queue.pop_back();
-        m_log_queue.pop_back();
+        m_first = (m_first + 1) % m_frames.size();
+        m_n_frames--;
         }
+
+    linearize();
+    m_frames.resize(m_queue_size);
     }
 
 namespace detail
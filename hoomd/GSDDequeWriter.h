@@ -7,7 +7,7 @@
 #error This header cannot be compiled by nvcc
 #endif
 
-#include <deque>
+#include <vector>
 
 #include <pybind11/pybind11.h>
 
@@ -15,6 +15,13 @@
 
 namespace hoomd
     {
+/// Store the last frames in memory and write them to a GSD file on demand.
+/** The frames are kept in a ring buffer. When the buffer is full, analyze() overwrites the oldest
+    frame in place, so its vectors keep their capacity and storing a frame does not allocate memory
+    once every slot has been filled. The logged quantities are copied out of python into typed
+    chunk buffers that are reused in the same way. Only the fields selected by the dynamic flags are
+    stored in each frame.
+*/
 class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
     {
     public:
@@ -39,9 +46,26 @@ class PYBIND11_EXPORT GSDDequeWriter : public GSDDumpWriter
     size_t getCurrentQueueSize() const;
 
     protected:
+    /// Frame stored in the ring buffer.
+    struct BufferedFrame
+        {
+        GSDFrame frame;
+        std::vector<LogChunk> log_chunks;
+        };
+
     int m_queue_size;
-    std::deque<GSDDumpWriter::GSDFrame> m_frame_queue;
-    std::deque<pybind11::dict> m_log_queue;
+
+    /// Ring buffer of frames, the oldest frame is at m_first.
+    std::vector<BufferedFrame> m_frames;
+
+    /// Index of the oldest frame in m_frames.
+    size_t m_first = 0;
+
+    /// Number of frames in the ring buffer.
+    size_t m_n_frames = 0;
+
+    /// Move the oldest frame to the start of m_frames.
+    void linearize();
     };
 
 namespace detail
@@ -13,6 +13,8 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
 #include <list>
 #include <sstream>
@@ -44,6 +46,7 @@ std::list<std::string> GSDDumpWriter::particle_chunks {"particles/position",
     \param mode File open mode ("wb", "xb", or "ab")
     \param truncate If true, truncate the file to 0 frames every time analyze() called, then write
    out one frame
+    \param compression Codec that compresses the per-particle chunks ("none" or "zstd")
 
     If the group does not include all particles, then topology information cannot be written to the
    file.
@@ -53,7 +56,9 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
                              const std::string& fname,
                              std::shared_ptr<ParticleGroup> group,
                              std::string mode,
-                             bool truncate)
+                             bool truncate,
+                             std::string compression,
+                             unsigned int keyframe_interval)
     : Analyzer(sysdef, trigger), m_fname(fname), m_mode(mode), m_truncate(truncate), m_group(group)
     {
     m_exec_conf->msg->notice(5) << "Constructing GSDDumpWriter: " << m_fname << " " << mode << " "
@@ -64,6 +69,19 @@ GSDDumpWriter::GSDDumpWriter(std::shared_ptr<SystemDefinition> sysdef,
         }
     m_log_writer = pybind11::none();
 
+    m_compression = GSDCompression::getCodec(compression);
+    if (!GSDCompression::isAvailable(m_compression))
+        {
+        throw std::runtime_error("GSD: " + compression
+                                 + " compression is not available, build HOOMD-blue with "
+                                   "ENABLE_ZSTD=on.");
+        }
+    if (keyframe_interval == 0)
+        {
+        throw std::domain_error("keyframe_interval must be positive.");
+        }
+    m_keyframe_interval = keyframe_interval;
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -148,6 +166,8 @@ pybind11::tuple GSDDumpWriter::getDynamic()
 
 void GSDDumpWriter::setDynamic(pybind11::object dynamic)
     {
+    waitForQueue();
+
     pybind11::list dynamic_list = dynamic;
     m_dynamic.reset();
     m_write_topology = false;
@@ -220,6 +240,8 @@ void GSDDumpWriter::setDynamic(pybind11::object dynamic)
 
 void GSDDumpWriter::flush()
     {
+    waitForQueue();
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: flush gsd file " << m_fname << endl;
@@ -230,6 +252,8 @@ void GSDDumpWriter::flush()
 
 void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
     {
+    waitForQueue();
+
     if (m_exec_conf->isRoot())
         {
         int retval = gsd_set_maximum_write_buffer_size(&m_handle, size);
@@ -243,6 +267,8 @@ void GSDDumpWriter::setMaximumWriteBufferSize(uint64_t size)
 
 uint64_t GSDDumpWriter::getMaximumWriteBufferSize()
     {
+    waitForQueue();
+
     if (m_exec_conf->isRoot())
         {
         return gsd_get_maximum_write_buffer_size(&m_handle);
@@ -253,6 +279,19 @@ uint64_t GSDDumpWriter::getMaximumWriteBufferSize()
         }
     }
 
+/*! Files with compressed or delta encoded chunks need a schema version that readers of the
+    standard hoomd schema reject.
+*/
+uint32_t GSDDumpWriter::getSchemaVersion()
+    {
+    if (m_compression != GSDCompression::none || m_keyframe_interval > 1)
+        {
+        return GSDCompression::schemaVersion();
+        }
+
+    return gsd_make_version(1, 4);
+    }
+
 //! Initializes the output file for writing
 void GSDDumpWriter::initFileIO()
     {
@@ -269,7 +308,7 @@ void GSDDumpWriter::initFileIO()
                                              m_fname.c_str(),
                                              o.str().c_str(),
                                              "hoomd",
-                                             gsd_make_version(1, 4),
+                                             getSchemaVersion(),
                                              GSD_OPEN_APPEND,
                                              m_mode == "xb");
             GSDUtils::checkError(retval, m_fname);
@@ -298,13 +337,18 @@ void GSDDumpWriter::initFileIO()
                   << "Invalid schema in " << m_fname;
                 throw runtime_error("Error opening GSD file");
                 }
-            if (m_handle.header.schema_version >= gsd_make_version(2, 0))
+            if (m_handle.header.schema_version > GSDCompression::schemaVersion())
                 {
                 std::ostringstream s;
                 s << "GSD: "
                   << "Invalid schema version in " << m_fname;
                 throw runtime_error("Error opening GSD file");
                 }
+            if (m_handle.header.schema_version < getSchemaVersion())
+                {
+                throw runtime_error("GSD: Cannot append compressed or delta encoded frames to "
+                                    + m_fname + ", which was written without them.");
+                }
             }
         else
             {
@@ -327,6 +371,27 @@ GSDDumpWriter::~GSDDumpWriter()
     {
     m_exec_conf->msg->notice(5) << "Destroying GSDDumpWriter" << endl;
 
+    // write the remaining queued frames before closing the file
+    stopIOThread();
+
+#ifdef ENABLE_MPI
+    if (m_mpi_file_open)
+        {
+        MPI_File_close(&m_mpi_file);
+        }
+#endif
+    if (m_io_error)
+        {
+        try
+            {
+            std::rethrow_exception(m_io_error);
+            }
+        catch (const std::exception& e)
+            {
+            m_exec_conf->msg->error() << "GSD: " << e.what() << endl;
+            }
+        }
+
     if (m_exec_conf->isRoot())
         {
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
@@ -349,12 +414,32 @@ pybind11::dict GSDDumpWriter::getLogData() const
     The first call to analyze() will create or overwrite the file and write out the current system
    configuration as frame 0. Subsequent calls will append frames to the file, or keep overwriting
    frame 0 if m_truncate is true.
+
+    In asynchronous mode, analyze() queues frames 1+ for the I/O thread. Frame 0 is always written
+    synchronously because it determines which fields are non-default, and truncating the file
+    requires exclusive access to it.
 */
 void GSDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
     int retval;
 
+    // the logged quantities are python objects
+    pybind11::gil_scoped_acquire acquire;
+
+    bool asynchronous = m_asynchronous && !m_truncate && m_nframes > 0;
+#ifdef ENABLE_MPI
+    // collective writes require all ranks
+    if (m_collective && m_sysdef->isDomainDecomposed())
+        {
+        asynchronous = false;
+        }
+#endif
+    if (!asynchronous)
+        {
+        waitForQueue();
+        }
+
     // truncate the file if requested
     if (m_truncate)
         {
@@ -370,13 +455,71 @@ void GSDDumpWriter::analyze(uint64_t timestep)
 
     populateLocalFrame(m_local_frame, timestep);
     auto log_data = getLogData();
-    write(m_local_frame, log_data);
+    if (asynchronous)
+        {
+        enqueueFrame(m_local_frame, log_data);
+        }
+    else
+        {
+        write(m_local_frame, log_data);
+        }
     }
 
 void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_data)
     {
+    writeFrame(frame, &log_data, nullptr);
+    }
+
+void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, const std::vector<LogChunk>& log_chunks)
+    {
+    writeFrame(frame, nullptr, &log_chunks);
+    }
+
+void GSDDumpWriter::writeLog(pybind11::dict* log_data, const std::vector<LogChunk>* log_chunks)
+    {
+    if (log_data)
+        {
+        writeLogQuantities(*log_data);
+        }
+    else
+        {
+        writeLogChunks(*log_chunks);
+        }
+    }
+
+void GSDDumpWriter::writeFrame(GSDDumpWriter::GSDFrame& frame,
+                               pybind11::dict* log_data,
+                               const std::vector<LogChunk>* log_chunks)
+    {
+    frame.N = m_group->getNumMembersGlobal();
+    frame.index = m_nframes;
+
 #ifdef ENABLE_MPI
-    if (m_sysdef->isDomainDecomposed())
+    if (m_sysdef->isDomainDecomposed() && m_collective)
+        {
+        // every rank writes its local rows of the per-particle chunks
+        setupCollectiveWrite(frame);
+
+        if (m_exec_conf->isRoot())
+            {
+            writeFrameHeader(frame);
+            }
+
+        m_collective_write = true;
+        writeAttributes(frame);
+        writeProperties(frame);
+        writeMomenta(frame);
+        m_collective_write = false;
+
+        if (m_exec_conf->isRoot())
+            {
+            writeLog(log_data, log_chunks);
+            }
+
+        // the chunk data must be in the file before rank 0 writes the index in gsd_end_frame
+        MPI_File_sync(m_mpi_file);
+        }
+    else if (m_sysdef->isDomainDecomposed())
         {
         gatherGlobalFrame(frame);
 
@@ -386,7 +529,7 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
             writeAttributes(m_global_frame);
             writeProperties(m_global_frame);
             writeMomenta(m_global_frame);
-            writeLogQuantities(log_data);
+            writeLog(log_data, log_chunks);
             }
         }
     else
@@ -396,7 +539,7 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
         writeAttributes(frame);
         writeProperties(frame);
         writeMomenta(frame);
-        writeLogQuantities(log_data);
+        writeLog(log_data, log_chunks);
         }
     // topology is only meaningful if this is the all group
     if (m_group->getNumMembersGlobal() == m_pdata->getNGlobal()
@@ -423,6 +566,251 @@ void GSDDumpWriter::write(GSDDumpWriter::GSDFrame& frame, pybind11::dict log_dat
     m_nframes++;
     }
 
+/*! \param frame Populated local frame
+    \param log_data Logged quantities of the frame
+
+    Swap the frame contents into a queued frame and pass it to the I/O thread. The swapped out
+    buffers come from a previously written frame, so the vectors in \a frame keep their capacity and
+    the next call to populateLocalFrame() does not allocate. enqueueFrame() blocks only when
+    max_queued_frames frames are already waiting.
+
+    Rethrows any error that occurred while writing a previous frame.
+*/
+void GSDDumpWriter::enqueueFrame(GSDFrame& frame, pybind11::dict log_data)
+    {
+    frame.N = m_group->getNumMembersGlobal();
+    frame.index = m_nframes;
+    bool write_topology
+        = m_group->getNumMembersGlobal() == m_pdata->getNGlobal() && m_write_topology;
+
+    GSDFrame* output_frame = &frame;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        gatherGlobalFrame(frame);
+        output_frame = &m_global_frame;
+        }
+#endif
+
+    if (m_exec_conf->isRoot())
+        {
+        std::unique_ptr<QueuedFrame> queued;
+
+            {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this] { return m_queue.size() < max_queued_frames; });
+            rethrowIOError();
+
+            if (!m_free_frames.empty())
+                {
+                queued = std::move(m_free_frames.back());
+                m_free_frames.pop_back();
+                }
+            }
+
+        if (!queued)
+            {
+            queued = std::make_unique<QueuedFrame>();
+            }
+
+        std::swap(queued->frame, *output_frame);
+#ifdef ENABLE_MPI
+        // the topology snapshots are global and remain in the local frame
+        if (output_frame != &frame)
+            {
+            std::swap(queued->frame.bond_data, frame.bond_data);
+            std::swap(queued->frame.angle_data, frame.angle_data);
+            std::swap(queued->frame.dihedral_data, frame.dihedral_data);
+            std::swap(queued->frame.improper_data, frame.improper_data);
+            std::swap(queued->frame.constraint_data, frame.constraint_data);
+            std::swap(queued->frame.pair_data, frame.pair_data);
+            }
+#endif
+        queued->write_topology = write_topology;
+
+        // copy the logged quantities out of the python arrays, the I/O thread cannot hold the GIL
+        copyLogChunks(log_data, queued->log_chunks);
+
+        if (!m_io_thread.joinable())
+            {
+            m_io_thread = std::thread(&GSDDumpWriter::ioThreadLoop, this);
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_queue.push_back(std::move(queued));
+            }
+        m_queue_cv.notify_all();
+        }
+
+    m_nframes++;
+    }
+
+/*! Write queued frames to the file until stopIOThread() is called and the queue is empty. After
+    an error, discard the remaining frames and store the error for the main thread to rethrow.
+*/
+void GSDDumpWriter::ioThreadLoop()
+    {
+    while (true)
+        {
+        std::unique_ptr<QueuedFrame> queued;
+
+            {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this] { return !m_queue.empty() || m_stop_io_thread; });
+            if (m_queue.empty())
+                {
+                return;
+                }
+
+            queued = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_writing = !m_io_error;
+            }
+
+        if (m_writing)
+            {
+            try
+                {
+                writeQueuedFrame(*queued);
+                }
+            catch (...)
+                {
+                std::lock_guard<std::mutex> lock(m_queue_mutex);
+                m_io_error = std::current_exception();
+                }
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_writing = false;
+            m_free_frames.push_back(std::move(queued));
+            }
+        m_queue_cv.notify_all();
+        }
+    }
+
+/*! Write a queued frame to the file. Called only on the I/O thread. Queued frames always have
+    index > 0, so this does not modify m_nondefault.
+*/
+void GSDDumpWriter::writeQueuedFrame(QueuedFrame& queued)
+    {
+    GSDFrame& frame = queued.frame;
+    writeFrameHeader(frame);
+    writeAttributes(frame);
+    writeProperties(frame);
+    writeMomenta(frame);
+    writeLogChunks(queued.log_chunks);
+
+    if (queued.write_topology)
+        {
+        writeTopology(frame.bond_data,
+                      frame.angle_data,
+                      frame.dihedral_data,
+                      frame.improper_data,
+                      frame.constraint_data,
+                      frame.pair_data);
+        }
+
+    int retval = gsd_end_frame(&m_handle);
+    GSDUtils::checkError(retval, m_fname);
+    }
+
+/*! \param log_data Logged quantities
+    \param log_chunks Output: Copies of the logged quantities
+
+    Copy the data of each logged quantity into a typed chunk buffer. The buffers already in \a
+    log_chunks are reused, so copying the same quantities again does not allocate memory.
+*/
+void GSDDumpWriter::copyLogChunks(pybind11::dict log_data, std::vector<LogChunk>& log_chunks)
+    {
+    log_chunks.resize(log_data.size());
+    size_t i = 0;
+    for (auto key_iter = log_data.begin(); key_iter != log_data.end(); ++key_iter, ++i)
+        {
+        LogChunk& chunk = log_chunks[i];
+        chunk.name = pybind11::cast<std::string>(key_iter->first);
+        pybind11::array arr = pybind11::array::ensure(key_iter->second, pybind11::array::c_style);
+        getLogChunkLayout(chunk.name, arr, chunk.type, chunk.N, chunk.M);
+        const char* data = static_cast<const char*>(arr.data());
+        chunk.data.assign(data, data + arr.nbytes());
+        }
+    }
+
+/*! \param log_chunks Logged quantities copied by copyLogChunks()
+ */
+void GSDDumpWriter::writeLogChunks(const std::vector<LogChunk>& log_chunks)
+    {
+    for (const auto& chunk : log_chunks)
+        {
+        int retval = gsd_write_chunk(&m_handle,
+                                     chunk.name.c_str(),
+                                     chunk.type,
+                                     chunk.N,
+                                     chunk.M,
+                                     0,
+                                     (void*)chunk.data.data());
+        GSDUtils::checkError(retval, m_fname);
+        }
+    }
+
+/*! Block until the I/O thread has written all queued frames. Rethrows any error that occurred
+    while writing them.
+*/
+void GSDDumpWriter::waitForQueue()
+    {
+    if (!m_io_thread.joinable())
+        {
+        return;
+        }
+
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    m_queue_cv.wait(lock, [this] { return m_queue.empty() && !m_writing; });
+    rethrowIOError();
+    }
+
+/*! Write all queued frames and join the I/O thread.
+ */
+void GSDDumpWriter::stopIOThread()
+    {
+    if (!m_io_thread.joinable())
+        {
+        return;
+        }
+
+        {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_stop_io_thread = true;
+        }
+    m_queue_cv.notify_all();
+    m_io_thread.join();
+    m_stop_io_thread = false;
+    }
+
+/*! Rethrow and clear the stored I/O thread error. The caller must hold m_queue_mutex or have
+    joined the I/O thread.
+*/
+void GSDDumpWriter::rethrowIOError()
+    {
+    if (m_io_error)
+        {
+        std::exception_ptr error = m_io_error;
+        m_io_error = nullptr;
+        std::rethrow_exception(error);
+        }
+    }
+
+void GSDDumpWriter::setAsynchronous(bool asynchronous)
+    {
+    if (!asynchronous)
+        {
+        stopIOThread();
+        rethrowIOError();
+        }
+
+    m_asynchronous = asynchronous;
+    }
+
 void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping)
     {
     int max_len = 0;
@@ -464,7 +852,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
                              (void*)&frame.timestep);
     GSDUtils::checkError(retval, m_fname);
 
-    if (m_nframes == 0)
+    if (frame.index == 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/dimensions" << endl;
         uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
@@ -478,7 +866,7 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::configuration_box])
+    if (frame.index == 0 || m_dynamic[gsd_flag::configuration_box])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/box" << endl;
         float box_a[6];
@@ -498,10 +886,10 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
         GSDUtils::checkError(retval, m_fname);
         }
 
-    if (m_nframes == 0 || m_dynamic[gsd_flag::particles_N])
+    if (frame.index == 0 || m_dynamic[gsd_flag::particles_N])
         {
         m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
-        uint32_t N = m_group->getNumMembersGlobal();
+        uint32_t N = frame.N;
         retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
         GSDUtils::checkError(retval, m_fname);
         }
@@ -512,116 +900,107 @@ void GSDDumpWriter::writeFrameHeader(const GSDDumpWriter::GSDFrame& frame)
 */
 void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
-    if (m_dynamic[gsd_flag::particles_types] || m_nframes == 0)
+    if (m_dynamic[gsd_flag::particles_types] || frame.index == 0)
         {
-        writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+        if (m_exec_conf->isRoot())
+            {
+            writeTypeMapping("particles/types", frame.particle_data.type_mapping);
+            }
         }
 
-    if (frame.particle_data.type.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_type])
         {
-        assert(frame.particle_data.type.size() == N);
+        assert(m_collective_write || frame.particle_data.type.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.type.data());
+        retval = writeParticleChunk("particles/typeid",
+                                    GSD_TYPE_UINT32,
+                                    N,
+                                    1,
+                                    (void*)frame.particle_data.type.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/typeid"] = true;
         }
 
-    if (frame.particle_data.mass.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_mass])
         {
-        assert(frame.particle_data.mass.size() == N);
+        assert(m_collective_write || frame.particle_data.mass.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/mass" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/mass",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.mass.data());
+        retval = writeParticleChunk("particles/mass",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    1,
+                                    (void*)frame.particle_data.mass.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/mass"] = true;
         }
 
-    if (frame.particle_data.charge.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_charge])
         {
-        assert(frame.particle_data.charge.size() == N);
+        assert(m_collective_write || frame.particle_data.charge.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/charge" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/charge",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.charge.data());
+        retval = writeParticleChunk("particles/charge",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    1,
+                                    (void*)frame.particle_data.charge.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/charge"] = true;
         }
 
     if (m_write_diameter)
         {
-        if (frame.particle_data.diameter.size() != 0)
+        if (frame.particle_data_present[gsd_flag::particles_diameter])
             {
-            assert(frame.particle_data.diameter.size() == N);
+            assert(m_collective_write || frame.particle_data.diameter.size() == N);
 
             m_exec_conf->msg->notice(10) << "GSD: writing particles/diameter" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/diameter",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)frame.particle_data.diameter.data());
+            retval = writeParticleChunk("particles/diameter",
+                                        GSD_TYPE_FLOAT,
+                                        N,
+                                        1,
+                                        (void*)frame.particle_data.diameter.data());
             GSDUtils::checkError(retval, m_fname);
-            if (m_nframes == 0)
+            if (frame.index == 0)
                 m_nondefault["particles/diameter"] = true;
             }
         }
 
-    if (frame.particle_data.body.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_body])
         {
-        assert(frame.particle_data.body.size() == N);
+        assert(m_collective_write || frame.particle_data.body.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/body" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/body",
-                                 GSD_TYPE_INT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)frame.particle_data.body.data());
+        retval = writeParticleChunk("particles/body",
+                                    GSD_TYPE_INT32,
+                                    N,
+                                    1,
+                                    (void*)frame.particle_data.body.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/body"] = true;
         }
 
-    if (frame.particle_data.inertia.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_inertia])
         {
-        assert(frame.particle_data.inertia.size() == N);
+        assert(m_collective_write || frame.particle_data.inertia.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/moment_inertia" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/moment_inertia",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.inertia.data());
+        retval = writeParticleChunk("particles/moment_inertia",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    3,
+                                    (void*)frame.particle_data.inertia.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/moment_inertia"] = true;
         }
     }
@@ -630,40 +1009,31 @@ void GSDDumpWriter::writeAttributes(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
-    if (frame.particle_data.pos.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_position])
         {
-        assert(frame.particle_data.pos.size() == N);
+        assert(m_collective_write || frame.particle_data.pos.size() == N);
 
-        m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/position",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.pos.data());
+        retval = writePosition(frame);
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/position"] = true;
         }
 
-    if (frame.particle_data.orientation.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_orientation])
         {
-        assert(frame.particle_data.orientation.size() == N);
+        assert(m_collective_write || frame.particle_data.orientation.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/orientation" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/orientation",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)frame.particle_data.orientation.data());
+        retval = writeParticleChunk("particles/orientation",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    4,
+                                    (void*)frame.particle_data.orientation.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/orientation"] = true;
         }
     }
@@ -672,59 +1042,237 @@ void GSDDumpWriter::writeProperties(const GSDDumpWriter::GSDFrame& frame)
  */
 void GSDDumpWriter::writeMomenta(const GSDDumpWriter::GSDFrame& frame)
     {
-    uint32_t N = m_group->getNumMembersGlobal();
+    uint32_t N = frame.N;
     int retval;
 
-    if (frame.particle_data.vel.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_velocity])
         {
-        assert(frame.particle_data.vel.size() == N);
+        assert(m_collective_write || frame.particle_data.vel.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/velocity" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/velocity",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)frame.particle_data.vel.data());
+        retval = writeParticleChunk("particles/velocity",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    3,
+                                    (void*)frame.particle_data.vel.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/velocity"] = true;
         }
 
-    if (frame.particle_data.angmom.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_angmom])
         {
-        assert(frame.particle_data.angmom.size() == N);
+        assert(m_collective_write || frame.particle_data.angmom.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/angmom" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/angmom",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)frame.particle_data.angmom.data());
+        retval = writeParticleChunk("particles/angmom",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    4,
+                                    (void*)frame.particle_data.angmom.data());
         GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
+        if (frame.index == 0)
             m_nondefault["particles/angmom"] = true;
         }
 
-    if (frame.particle_data.image.size() != 0)
+    if (frame.particle_data_present[gsd_flag::particles_image])
         {
-        assert(frame.particle_data.image.size() == N);
+        assert(m_collective_write || frame.particle_data.image.size() == N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/image" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/image",
-                                 GSD_TYPE_INT32,
+        retval = writeParticleChunk("particles/image",
+                                    GSD_TYPE_INT32,
+                                    N,
+                                    3,
+                                    (void*)frame.particle_data.image.data());
+        GSDUtils::checkError(retval, m_fname);
+        if (frame.index == 0)
+            m_nondefault["particles/image"] = true;
+        }
+    }
+
+/*! \param name Name of the chunk
+    \param type Type of the chunk data
+    \param N Number of rows in the chunk (global)
+    \param M Number of columns in the chunk
+    \param data Rows of the chunk: all rows, or the local rows when writing collectively
+
+    When m_collective_write is set, rank 0 adds the index entry and reserves space for the chunk.
+    Then all ranks write their rows at the offsets set up by setupCollectiveWrite() with one
+    collective MPI-IO call, which lets the MPI library aggregate the scattered rows into large
+    contiguous writes.
+
+    \returns GSD_SUCCESS, or a gsd error code
+*/
+int GSDDumpWriter::writeParticleChunk(const char* name,
+                                      gsd_type type,
+                                      uint64_t N,
+                                      uint32_t M,
+                                      const void* data)
+    {
+#ifdef ENABLE_MPI
+    if (m_collective_write)
+        {
+        // retval and location of the reserved chunk
+        int64_t reserved[2] = {GSD_SUCCESS, 0};
+        if (m_exec_conf->isRoot())
+            {
+            reserved[0] = gsd_reserve_chunk(&m_handle, name, type, N, M, 0, &reserved[1]);
+            }
+        MPI_Bcast(reserved, 2, MPI_INT64_T, 0, m_exec_conf->getMPICommunicator());
+        if (reserved[0] != GSD_SUCCESS)
+            {
+            return int(reserved[0]);
+            }
+
+        size_t row_bytes = M * gsd_sizeof_type(type);
+        for (size_t i = 0; i < m_block_rows.size(); i++)
+            {
+            m_block_offsets[i] = m_block_rows[i] * MPI_Aint(row_bytes);
+            }
+
+        MPI_Datatype row_type, file_type;
+        MPI_Type_contiguous(int(row_bytes), MPI_BYTE, &row_type);
+        MPI_Type_commit(&row_type);
+        MPI_Type_create_hindexed(int(m_block_lengths.size()),
+                                 m_block_lengths.data(),
+                                 m_block_offsets.data(),
+                                 row_type,
+                                 &file_type);
+        MPI_Type_commit(&file_type);
+
+        int result = MPI_File_set_view(m_mpi_file,
+                                       MPI_Offset(reserved[1]),
+                                       row_type,
+                                       file_type,
+                                       "native",
+                                       MPI_INFO_NULL);
+        if (result == MPI_SUCCESS)
+            {
+            result = MPI_File_write_all(m_mpi_file,
+                                        data,
+                                        int(m_n_local_rows),
+                                        row_type,
+                                        MPI_STATUS_IGNORE);
+            }
+
+        MPI_Type_free(&file_type);
+        MPI_Type_free(&row_type);
+        return result == MPI_SUCCESS ? GSD_SUCCESS : GSD_ERROR_IO;
+        }
+#endif
+
+    if (m_compression != GSDCompression::none)
+        {
+        GSDCompression::compress(m_compressed_chunk,
+                                 m_compression_scratch,
+                                 m_compression,
+                                 type,
+                                 N,
+                                 M,
+                                 data);
+        return gsd_write_chunk(&m_handle,
+                               GSDCompression::chunkName(name).c_str(),
+                               GSD_TYPE_UINT8,
+                               m_compressed_chunk.size(),
+                               1,
+                               0,
+                               m_compressed_chunk.data());
+        }
+
+    return gsd_write_chunk(&m_handle, name, type, N, M, 0, data);
+    }
+
+/*! \param frame Frame to write
+
+    Write the displacements of the positions from the last keyframe when the previous keyframe is
+    less than m_keyframe_interval frames ago and has the same box, quantum, and number of particles.
+    Each displacement is the minimum image vector in units of the quantum, rounded to the nearest
+    integer. Write a new keyframe when any displacement component does not fit in 16 bits.
+
+    Positions decoded from the displacements differ from the written full positions only by the
+    rounding of particles that wrapped through the box since the keyframe, at most quantum / 2.
+*/
+int GSDDumpWriter::writePosition(const GSDFrame& frame)
+    {
+    const uint32_t N = frame.N;
+    const double quantum
+        = m_position_precision > 0 ? GSDCompression::getQuantum(m_position_precision) : 0;
+    const bool use_keyframes = m_keyframe_interval > 1 && quantum > 0 && !m_collective_write;
+
+    bool write_delta = use_keyframes && frame.index > m_keyframe_index
+                       && frame.index - m_keyframe_index < m_keyframe_interval
+                       && m_keyframe_position.size() == N && m_keyframe_quantum == quantum
+                       && m_keyframe_box == frame.global_box;
+
+    if (write_delta)
+        {
+        m_position_delta.resize(size_t(N) * 3);
+        for (uint32_t i = 0; i < N && write_delta; i++)
+            {
+            vec3<Scalar> delta = frame.global_box.minImage(vec3<Scalar>(frame.particle_data.pos[i])
+                                                           - vec3<Scalar>(m_keyframe_position[i]));
+            Scalar components[3] = {delta.x, delta.y, delta.z};
+            for (unsigned int j = 0; j < 3; j++)
+                {
+                double d = std::nearbyint(components[j] / quantum);
+                if (std::abs(d) > double(std::numeric_limits<int16_t>::max()))
+                    {
+                    write_delta = false;
+                    break;
+                    }
+                m_position_delta[i * 3 + j] = int16_t(d);
+                }
+            }
+        }
+
+    if (write_delta)
+        {
+        m_exec_conf->msg->notice(10) << "GSD: writing hoomd/delta/particles/position" << endl;
+        int retval
+            = writeParticleChunk(GSDCompression::deltaChunkName("particles/position").c_str(),
+                                 GSD_TYPE_INT16,
                                  N,
                                  3,
+                                 m_position_delta.data());
+        if (retval != GSD_SUCCESS)
+            return retval;
+
+        retval = gsd_write_chunk(&m_handle,
+                                 GSDCompression::deltaChunkName("keyframe").c_str(),
+                                 GSD_TYPE_UINT64,
+                                 1,
+                                 1,
                                  0,
-                                 (void*)frame.particle_data.image.data());
-        GSDUtils::checkError(retval, m_fname);
-        if (m_nframes == 0)
-            m_nondefault["particles/image"] = true;
+                                 &m_keyframe_index);
+        if (retval != GSD_SUCCESS)
+            return retval;
+
+        return gsd_write_chunk(&m_handle,
+                               GSDCompression::deltaChunkName("quantum").c_str(),
+                               GSD_TYPE_DOUBLE,
+                               1,
+                               1,
+                               0,
+                               &m_keyframe_quantum);
+        }
+
+    m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
+    int retval = writeParticleChunk("particles/position",
+                                    GSD_TYPE_FLOAT,
+                                    N,
+                                    3,
+                                    (void*)frame.particle_data.pos.data());
+
+    if (use_keyframes && retval == GSD_SUCCESS)
+        {
+        m_keyframe_position = frame.particle_data.pos;
+        m_keyframe_box = frame.global_box;
+        m_keyframe_index = frame.index;
+        m_keyframe_quantum = quantum;
         }
+
+    return retval;
     }
 
 /*! \param bond Bond data snapshot
@@ -936,90 +1484,104 @@ void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
 
         pybind11::array arr = pybind11::array::ensure(key_iter->second, pybind11::array::c_style);
         gsd_type type = GSD_TYPE_UINT8;
-        auto dtype = arr.dtype();
-        if (dtype.kind() == 'u' && dtype.itemsize() == 1)
-            {
-            type = GSD_TYPE_UINT8;
-            }
-        else if (dtype.kind() == 'u' && dtype.itemsize() == 2)
-            {
-            type = GSD_TYPE_UINT16;
-            }
-        else if (dtype.kind() == 'u' && dtype.itemsize() == 4)
-            {
-            type = GSD_TYPE_UINT32;
-            }
-        else if (dtype.kind() == 'u' && dtype.itemsize() == 8)
-            {
-            type = GSD_TYPE_UINT64;
-            }
-        else if (dtype.kind() == 'i' && dtype.itemsize() == 1)
-            {
-            type = GSD_TYPE_INT8;
-            }
-        else if (dtype.kind() == 'i' && dtype.itemsize() == 2)
-            {
-            type = GSD_TYPE_INT16;
-            }
-        else if (dtype.kind() == 'i' && dtype.itemsize() == 4)
-            {
-            type = GSD_TYPE_INT32;
-            }
-        else if (dtype.kind() == 'i' && dtype.itemsize() == 8)
-            {
-            type = GSD_TYPE_INT64;
-            }
-        else if (dtype.kind() == 'f' && dtype.itemsize() == 4)
-            {
-            type = GSD_TYPE_FLOAT;
-            }
-        else if (dtype.kind() == 'f' && dtype.itemsize() == 8)
-            {
-            type = GSD_TYPE_DOUBLE;
-            }
-        else if (dtype.kind() == 'b' && dtype.itemsize() == 1)
-            {
-            type = GSD_TYPE_UINT8;
-            }
-        else
-            {
-            throw range_error("Invalid numpy array format in gsd log data [" + name
-                              + "]: " + string(pybind11::str(arr.dtype())));
-            }
-
-        size_t M = 1;
         size_t N = 1;
-        auto ndim = arr.ndim();
-        if (ndim == 0)
-            {
-            // numpy converts scalars to arrays with zero dimensions
-            // gsd treats them as 1x1 arrays.
-            M = 1;
-            N = 1;
-            }
-        if (ndim == 1)
-            {
-            N = arr.shape(0);
-            M = 1;
-            }
-        if (ndim == 2)
-            {
-            N = arr.shape(0);
-            M = arr.shape(1);
-            if (M > std::numeric_limits<uint32_t>::max())
-                throw runtime_error("Array dimension too large in gsd log data [" + name + "]");
-            }
-        if (ndim > 2)
-            {
-            throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
-            }
+        uint32_t M = 1;
+        getLogChunkLayout(name, arr, type, N, M);
 
-        int retval
-            = gsd_write_chunk(&m_handle, name.c_str(), type, N, (uint32_t)M, 0, (void*)arr.data());
+        int retval = gsd_write_chunk(&m_handle, name.c_str(), type, N, M, 0, (void*)arr.data());
         GSDUtils::checkError(retval, m_fname);
         }
     }
 
+/*! \param name Name of the logged quantity
+    \param arr Array of the logged values
+    \param type Output: GSD type of the array
+    \param N Output: Number of rows in the chunk
+    \param M Output: Number of columns in the chunk
+*/
+void GSDDumpWriter::getLogChunkLayout(const std::string& name,
+                                      const pybind11::array& arr,
+                                      gsd_type& type,
+                                      size_t& N,
+                                      uint32_t& M)
+    {
+    auto dtype = arr.dtype();
+    if (dtype.kind() == 'u' && dtype.itemsize() == 1)
+        {
+        type = GSD_TYPE_UINT8;
+        }
+    else if (dtype.kind() == 'u' && dtype.itemsize() == 2)
+        {
+        type = GSD_TYPE_UINT16;
+        }
+    else if (dtype.kind() == 'u' && dtype.itemsize() == 4)
+        {
+        type = GSD_TYPE_UINT32;
+        }
+    else if (dtype.kind() == 'u' && dtype.itemsize() == 8)
+        {
+        type = GSD_TYPE_UINT64;
+        }
+    else if (dtype.kind() == 'i' && dtype.itemsize() == 1)
+        {
+        type = GSD_TYPE_INT8;
+        }
+    else if (dtype.kind() == 'i' && dtype.itemsize() == 2)
+        {
+        type = GSD_TYPE_INT16;
+        }
+    else if (dtype.kind() == 'i' && dtype.itemsize() == 4)
+        {
+        type = GSD_TYPE_INT32;
+        }
+    else if (dtype.kind() == 'i' && dtype.itemsize() == 8)
+        {
+        type = GSD_TYPE_INT64;
+        }
+    else if (dtype.kind() == 'f' && dtype.itemsize() == 4)
+        {
+        type = GSD_TYPE_FLOAT;
+        }
+    else if (dtype.kind() == 'f' && dtype.itemsize() == 8)
+        {
+        type = GSD_TYPE_DOUBLE;
+        }
+    else if (dtype.kind() == 'b' && dtype.itemsize() == 1)
+        {
+        type = GSD_TYPE_UINT8;
+        }
+    else
+        {
+        throw range_error("Invalid numpy array format in gsd log data [" + name
+                          + "]: " + string(pybind11::str(arr.dtype())));
+        }
+
+    auto ndim = arr.ndim();
+    if (ndim == 0)
+        {
+        // numpy converts scalars to arrays with zero dimensions
+        // gsd treats them as 1x1 arrays.
+        M = 1;
+        N = 1;
+        }
+    if (ndim == 1)
+        {
+        N = arr.shape(0);
+        M = 1;
+        }
+    if (ndim == 2)
+        {
+        N = arr.shape(0);
+        if (size_t(arr.shape(1)) > std::numeric_limits<uint32_t>::max())
+            throw runtime_error("Array dimension too large in gsd log data [" + name + "]");
+        M = uint32_t(arr.shape(1));
+        }
+    if (ndim > 2)
+        {
+        throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
+        }
+    }
+
 /*! Populate the m_nondefault map.
     Set entries to true when they exist in frame 0 of the file, otherwise, set them to false.
 */
@@ -1093,6 +1655,10 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 
             frame.particle_tags.push_back(h_tag.data[index]);
             m_index.push_back(index);
+            if (m_collective)
+                {
+                frame.particle_rows.push_back(group_tag_index);
+                }
             }
         }
 
@@ -1118,6 +1684,12 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
             frame.particle_data_present[gsd_flag::particles_type] = true;
             }
 
+        Scalar quantum = 0;
+        if (m_position_precision > 0)
+            {
+            quantum = Scalar(GSDCompression::getQuantum(m_position_precision));
+            }
+
         for (unsigned int index : m_index)
             {
             vec3<Scalar> position
@@ -1130,6 +1702,14 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
                 image = h_image.data[index];
                 }
 
+            if (m_position_precision > 0)
+                {
+                // quantize before wrapping so that the written positions remain in the box
+                position.x = GSDCompression::quantize(position.x, quantum);
+                position.y = GSDCompression::quantize(position.y, quantum);
+                position.z = GSDCompression::quantize(position.z, quantum);
+                }
+
             frame.global_box.wrap(position, image);
 
             if (m_dynamic[gsd_flag::particles_position] || m_nframes == 0)
@@ -1457,11 +2037,60 @@ void GSDDumpWriter::populateLocalFrame(GSDDumpWriter::GSDFrame& frame, uint64_t
 /*! Gather per-particle data from the local frame and sort it into ascending tag order in
     m_global_frame.
 */
+/*! \param local_frame Local frame to write
+
+    Open the MPI-IO file handle on first use and merge the rows of the local particles into
+    contiguous blocks. The rows are in ascending order because the local frame is sorted by tag.
+*/
+void GSDDumpWriter::setupCollectiveWrite(const GSDFrame& local_frame)
+    {
+    if (m_compression != GSDCompression::none)
+        {
+        throw std::runtime_error("GSD: Collective writes do not support compression.");
+        }
+
+    if (!m_mpi_file_open)
+        {
+        // the file exists after initFileIO(), make sure rank 0 has created it
+        MPI_Barrier(m_exec_conf->getMPICommunicator());
+        int result = MPI_File_open(m_exec_conf->getMPICommunicator(),
+                                   m_fname.c_str(),
+                                   MPI_MODE_WRONLY,
+                                   MPI_INFO_NULL,
+                                   &m_mpi_file);
+        if (result != MPI_SUCCESS)
+            {
+            throw std::runtime_error("GSD: Unable to open " + m_fname + " with MPI-IO.");
+            }
+        m_mpi_file_open = true;
+        }
+
+    m_block_rows.resize(0);
+    m_block_lengths.resize(0);
+    for (unsigned int row : local_frame.particle_rows)
+        {
+        if (!m_block_rows.empty()
+            && m_block_rows.back() + m_block_lengths.back() == static_cast<MPI_Aint>(row))
+            {
+            m_block_lengths.back()++;
+            }
+        else
+            {
+            m_block_rows.push_back(row);
+            m_block_lengths.push_back(1);
+            }
+        }
+    m_block_offsets.resize(m_block_rows.size());
+    m_n_local_rows = local_frame.particle_rows.size();
+    }
+
 void GSDDumpWriter::gatherGlobalFrame(const GSDFrame& local_frame)
     {
     m_global_frame.clear();
 
     m_global_frame.timestep = local_frame.timestep;
+    m_global_frame.N = local_frame.N;
+    m_global_frame.index = local_frame.index;
     m_global_frame.global_box = local_frame.global_box;
     m_global_frame.particle_data.type_mapping = local_frame.particle_data.type_mapping;
     m_global_frame.particle_data_present = local_frame.particle_data_present;
@@ -1540,18 +2169,29 @@ void export_GSDDumpWriter(pybind11::module& m)
                             std::string,
                             std::shared_ptr<ParticleGroup>,
                             std::string,
-                            bool>())
+                            bool,
+                            std::string,
+                            unsigned int>())
         .def_property("log_writer", &GSDDumpWriter::getLogWriter, &GSDDumpWriter::setLogWriter)
         .def_property_readonly("filename", &GSDDumpWriter::getFilename)
         .def_property_readonly("mode", &GSDDumpWriter::getMode)
         .def_property("dynamic", &GSDDumpWriter::getDynamic, &GSDDumpWriter::setDynamic)
         .def_property_readonly("truncate", &GSDDumpWriter::getTruncate)
+        .def_property_readonly("compression", &GSDDumpWriter::getCompression)
+        .def_property_readonly("keyframe_interval", &GSDDumpWriter::getKeyframeInterval)
+        .def_property("position_precision",
+                      &GSDDumpWriter::getPositionPrecision,
+                      &GSDDumpWriter::setPositionPrecision)
         .def_property_readonly("filter",
                                [](const std::shared_ptr<GSDDumpWriter> gsd)
                                { return gsd->getGroup()->getFilter(); })
         .def_property("write_diameter",
                       &GSDDumpWriter::getWriteDiameter,
                       &GSDDumpWriter::setWriteDiameter)
+        .def_property("asynchronous",
+                      &GSDDumpWriter::getAsynchronous,
+                      &GSDDumpWriter::setAsynchronous)
+        .def_property("collective", &GSDDumpWriter::getCollective, &GSDDumpWriter::setCollective)
         .def("flush", &GSDDumpWriter::flush)
         .def_property("maximum_write_buffer_size",
                       &GSDDumpWriter::getMaximumWriteBufferSize,
@@ -4,12 +4,19 @@
 #pragma once
 
 #include "Analyzer.h"
+#include "GSDCompression.h"
 #include "ParticleGroup.h"
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -19,6 +26,7 @@
 #error This header cannot be compiled by nvcc
 #endif
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 namespace hoomd
@@ -30,6 +38,22 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    In asynchronous mode, analyze() swaps the populated frame into a queue and a background I/O
+    thread writes it to the file. analyze() blocks only when the queue is full. Methods that access
+    the file handle wait for the queue to drain first.
+
+    When compression is enabled, the per-particle chunks are byte shuffled and compressed (see
+    detail::GSDCompression). A non-zero position precision rounds the positions before writing them
+    so that they compress better. With a non-zero position precision and a keyframe interval
+    larger than 1, only every keyframe_interval-th frame stores the full positions. The frames in
+    between store the minimum image displacements from the last keyframe as 16 bit multiples of the
+    position quantum, which are small and nearly constant for slow dynamics.
+
+    In collective mode with domain decomposition, each rank writes the rows of its local particles
+    directly into the per-particle chunks with collective MPI-IO instead of gathering the frame on
+    rank 0. Rank 0 reserves the space for each chunk and writes the index and the remaining chunks.
+    The resulting file is a standard GSD file.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -41,7 +65,9 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
                   const std::string& fname,
                   std::shared_ptr<ParticleGroup> group,
                   std::string mode = "ab",
-                  bool truncate = false);
+                  bool truncate = false,
+                  std::string compression = "none",
+                  unsigned int keyframe_interval = 1);
 
     //! Control topology writes
     void setWriteTopology(bool b)
@@ -64,6 +90,16 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         return m_truncate;
         }
 
+    std::string getCompression()
+        {
+        return detail::GSDCompression::getCodecName(m_compression);
+        }
+
+    unsigned int getKeyframeInterval()
+        {
+        return m_keyframe_interval;
+        }
+
     std::shared_ptr<ParticleGroup> getGroup()
         {
         return m_group;
@@ -116,9 +152,48 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Set the write_diameter flag
     void setWriteDiameter(bool write_diameter)
         {
+        waitForQueue();
         m_write_diameter = write_diameter;
         }
 
+    /// Get the asynchronous flag
+    bool getAsynchronous()
+        {
+        return m_asynchronous;
+        }
+
+    /// Set the asynchronous flag
+    void setAsynchronous(bool asynchronous);
+
+    /// Get the position precision
+    double getPositionPrecision()
+        {
+        return m_position_precision;
+        }
+
+    /// Set the position precision
+    void setPositionPrecision(double position_precision)
+        {
+        if (position_precision < 0)
+            {
+            throw std::domain_error("position_precision must not be negative.");
+            }
+        waitForQueue();
+        m_position_precision = position_precision;
+        }
+
+    /// Get the collective flag
+    bool getCollective()
+        {
+        return m_collective;
+        }
+
+    /// Set the collective flag
+    void setCollective(bool collective)
+        {
+        m_collective = collective;
+        }
+
     /// Flush the write buffer
     void flush();
 
@@ -172,8 +247,17 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         uint64_t timestep;
         BoxDim global_box;
 
+        /// Number of particles in the global frame
+        uint32_t N = 0;
+
+        /// Index of the frame in the file
+        uint64_t index = 0;
+
         std::vector<unsigned int> particle_tags;
 
+        /// Row of each particle in the per-particle chunks (only populated in collective mode)
+        std::vector<unsigned int> particle_rows;
+
         SnapshotParticleData<float> particle_data;
         BondData::Snapshot bond_data;
         AngleData::Snapshot angle_data;
@@ -188,6 +272,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         void clear()
             {
             particle_tags.resize(0);
+            particle_rows.resize(0);
             particle_data.resize(0);
             bond_data.resize(0);
             angle_data.resize(0);
@@ -224,18 +309,87 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     GatherTagOrder m_gather_tag_order;
 
     void gatherGlobalFrame(const GSDFrame& local_frame);
+
+    /// Set up the MPI-IO file view blocks for the local particles in the frame.
+    void setupCollectiveWrite(const GSDFrame& local_frame);
 #endif
 
+    /// Logged quantity copied out of python for the I/O thread.
+    struct LogChunk
+        {
+        std::string name;
+        gsd_type type;
+        size_t N;
+        uint32_t M;
+        std::vector<char> data;
+        };
+
+    /// Frame waiting in the queue for the I/O thread.
+    struct QueuedFrame
+        {
+        GSDFrame frame;
+        std::vector<LogChunk> log_chunks;
+        bool write_topology = false;
+        };
+
+    //! Write a frame with logged quantities copied by copyLogChunks() to the GSD file buffer
+    void write(GSDFrame& frame, const std::vector<LogChunk>& log_chunks);
+
+    //! Copy the logged quantities out of python, reusing the buffers in log_chunks
+    void copyLogChunks(pybind11::dict log_data, std::vector<LogChunk>& log_chunks);
+
+    //! Write logged quantities copied by copyLogChunks()
+    void writeLogChunks(const std::vector<LogChunk>& log_chunks);
+
+    //! Determine the gsd type and chunk dimensions of a logged quantity
+    void getLogChunkLayout(const std::string& name,
+                           const pybind11::array& arr,
+                           gsd_type& type,
+                           size_t& N,
+                           uint32_t& M);
+
+    //! Wait for the I/O thread to write all queued frames
+    void waitForQueue();
+
     private:
-    std::string m_fname;           //!< The file name we are writing to
-    std::string m_mode;            //!< The file open mode
-    bool m_truncate = false;       //!< True if we should truncate the file on every analyze()
-    bool m_write_topology = false; //!< True if topology should be written
-    bool m_write_diameter = false; //!< True if the diameter attribute should be written
+    std::string m_fname;             //!< The file name we are writing to
+    std::string m_mode;              //!< The file open mode
+    bool m_truncate = false;         //!< True if we should truncate the file on every analyze()
+    bool m_write_topology = false;   //!< True if topology should be written
+    bool m_write_diameter = false;   //!< True if the diameter attribute should be written
+    bool m_collective = false;       //!< True if ranks should write particle chunks collectively
+    bool m_collective_write = false; //!< True while writing a local frame collectively
 
     /// Flags indicating which particle fields are dynamic.
     std::bitset<n_gsd_flags> m_dynamic;
 
+    /// Codec that compresses the per-particle chunks.
+    detail::GSDCompression::codec m_compression = detail::GSDCompression::none;
+
+    /// Maximum change of the written positions, 0 for lossless.
+    double m_position_precision = 0;
+
+    /// Work buffers for compressed chunks.
+    std::vector<char> m_compressed_chunk, m_compression_scratch;
+
+    /// Number of frames from one position keyframe to the next, 1 writes every frame in full.
+    unsigned int m_keyframe_interval = 1;
+
+    /// Positions of the last position keyframe.
+    std::vector<vec3<float>> m_keyframe_position;
+
+    /// Box of the last position keyframe.
+    BoxDim m_keyframe_box;
+
+    /// Index of the last position keyframe.
+    uint64_t m_keyframe_index = 0;
+
+    /// Position quantum of the last position keyframe.
+    double m_keyframe_quantum = 0;
+
+    /// Work buffer for the position displacements.
+    std::vector<int16_t> m_position_delta;
+
     /// Number of frames written to the file.
     uint64_t m_nframes = 0;
 
@@ -254,6 +408,68 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     /// Working array to sort local particles by tag
     std::vector<unsigned int> m_index;
 
+    /// Maximum number of frames waiting for the I/O thread.
+    static const size_t max_queued_frames = 2;
+
+    bool m_asynchronous = false;   //!< True when frames are written by the I/O thread
+    bool m_writing = false;        //!< True while the I/O thread writes a frame
+    bool m_stop_io_thread = false; //!< Set to request the I/O thread to exit
+
+    std::thread m_io_thread;                                 //!< Background I/O thread
+    std::mutex m_queue_mutex;                                //!< Protects the queue state
+    std::condition_variable m_queue_cv;                      //!< Signals changes to the queue state
+    std::deque<std::unique_ptr<QueuedFrame>> m_queue;        //!< Frames waiting to be written
+    std::vector<std::unique_ptr<QueuedFrame>> m_free_frames; //!< Written frames for reuse
+    std::exception_ptr m_io_error;                           //!< Error raised by the I/O thread
+
+    //! Pass a populated frame to the I/O thread
+    void enqueueFrame(GSDFrame& frame, pybind11::dict log_data);
+
+    //! Write a frame with logged quantities from either log_data or log_chunks
+    void writeFrame(GSDFrame& frame,
+                    pybind11::dict* log_data,
+                    const std::vector<LogChunk>* log_chunks);
+
+    //! Write the logged quantities from either log_data or log_chunks
+    void writeLog(pybind11::dict* log_data, const std::vector<LogChunk>* log_chunks);
+
+    //! Main loop of the I/O thread
+    void ioThreadLoop();
+
+    //! Write a queued frame to the file
+    void writeQueuedFrame(QueuedFrame& queued);
+
+    //! Write all queued frames and join the I/O thread
+    void stopIOThread();
+
+    //! Rethrow the error raised by the I/O thread
+    void rethrowIOError();
+
+#ifdef ENABLE_MPI
+    /// MPI-IO handle to the file, opened on all ranks for collective writes.
+    MPI_File m_mpi_file;
+    bool m_mpi_file_open = false;
+
+    /// First row of each contiguous block of local particles.
+    std::vector<MPI_Aint> m_block_rows;
+
+    /// Number of rows in each block.
+    std::vector<int> m_block_lengths;
+
+    /// Byte offset of each block in the chunk being written.
+    std::vector<MPI_Aint> m_block_offsets;
+
+    /// Number of local rows written by this rank.
+    size_t m_n_local_rows = 0;
+#endif
+
+    //! Write a per-particle chunk, collectively when m_collective_write is set
+    int writeParticleChunk(const char* name,
+                           gsd_type type,
+                           uint64_t N,
+                           uint32_t M,
+                           const void* data);
+
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
 
@@ -266,6 +482,12 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     //! Write particle properties
     void writeProperties(const GSDFrame& frame);
 
+    //! Write the positions in full or as displacements from the last keyframe
+    int writePosition(const GSDFrame& frame);
+
+    //! Get the hoomd schema version of newly created files
+    uint32_t getSchemaVersion();
+
     //! Write particle momenta
     void writeMomenta(const GSDFrame& frame);
 
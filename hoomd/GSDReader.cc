@@ -4,10 +4,12 @@
 #include "GSDReader.h"
 #include "ExecutionConfiguration.h"
 #include "GSD.h"
+#include "GSDCompression.h"
 #include "SnapshotSystemData.h"
 #include "hoomd/extern/gsd.h"
 #include <sstream>
 #include <string.h>
+#include <sys/mman.h>
 
 #include <stdexcept>
 using namespace std;
@@ -19,21 +21,29 @@ namespace hoomd
     \param name File name to read
     \param frame Frame index to read from the file
     \param from_end Count frames back from the end of the file
+    \param distributed Read a slice of the particles and groups on every rank
 
     The GSDReader constructor opens the GSD file, initializes an empty snapshot, and reads the file
    into memory (on the root rank).
+
+    When \a distributed is true and there is more than one rank, every rank opens the file and reads
+    a contiguous slice of the particles and of each type of bonded group into a snapshot marked as
+    distributed. ParticleData and BondedGroupData then exchange the slices directly between the
+    ranks, so no rank reads or holds the whole system.
 */
 GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
                      const std::string& name,
                      const uint64_t frame,
-                     bool from_end)
+                     bool from_end,
+                     bool distributed)
     : m_exec_conf(exec_conf), m_timestep(0), m_name(name), m_frame(frame)
     {
     m_snapshot = std::shared_ptr<SnapshotSystemData<float>>(new SnapshotSystemData<float>);
+    m_distributed = distributed && m_exec_conf->getNRanks() > 1;
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
@@ -72,6 +82,8 @@ GSDReader::GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
         throw runtime_error(s.str());
         }
 
+    mapFile();
+
     readHeader();
     readParticles();
     readTopology();
@@ -81,15 +93,195 @@ GSDReader::~GSDReader()
     {
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
-    if (!m_exec_conf->isRoot())
+    if (!m_exec_conf->isRoot() && !m_distributed)
         {
         return;
         }
 #endif
 
+    if (m_mapped_file != NULL)
+        munmap(m_mapped_file, m_mapped_size);
+
     gsd_close(&m_handle);
     }
 
+/*! Map the whole file into memory so that readChunk() copies (or decompresses) the chunk data
+    directly from the page cache instead of reading it through a separate buffer. Large restart
+    files then only need memory for the snapshot itself. When the file cannot be mapped, read the
+    chunks with gsd_read_chunk().
+*/
+void GSDReader::mapFile()
+    {
+    if (m_handle.file_size <= 0)
+        return;
+
+    void* mapped = mmap(NULL, size_t(m_handle.file_size), PROT_READ, MAP_SHARED, m_handle.fd, 0);
+    if (mapped == MAP_FAILED)
+        {
+        m_exec_conf->msg->notice(3) << "data.gsd_snapshot: cannot map " << m_name
+                                    << ", reading chunks into buffers" << endl;
+        return;
+        }
+
+    m_mapped_file = mapped;
+    m_mapped_size = size_t(m_handle.file_size);
+
+    // the chunks of a frame are contiguous, read ahead
+    madvise(m_mapped_file, m_mapped_size, MADV_SEQUENTIAL);
+    }
+
+/*! \param entry Index entry of the chunk
+    \param buffer Buffer to read the chunk into when the file is not mapped
+
+    \returns A pointer to the chunk data, valid until the next read into \a buffer
+*/
+const char* GSDReader::getChunkData(const gsd_index_entry* entry, std::vector<char>& buffer)
+    {
+    size_t size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (m_mapped_file != NULL && entry->location >= 0
+        && uint64_t(entry->location) + size <= m_mapped_size)
+        {
+        return static_cast<const char*>(m_mapped_file) + entry->location;
+        }
+
+    buffer.resize(size);
+    int retval = gsd_read_chunk(&m_handle, buffer.data(), entry);
+    GSDUtils::checkError(retval, m_name);
+    return buffer.data();
+    }
+
+/*! \param data Pointer to data to read into
+    \param entry Index entry of the chunk
+    \param offset Offset of the first byte to read from the start of the chunk
+    \param size Number of bytes to read
+*/
+void GSDReader::readChunkData(void* data,
+                              const gsd_index_entry* entry,
+                              size_t offset,
+                              size_t size)
+    {
+    size_t chunk_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (offset == 0 && size == chunk_size
+        && (m_mapped_file == NULL || entry->location < 0
+            || uint64_t(entry->location) + chunk_size > m_mapped_size))
+        {
+        int retval = gsd_read_chunk(&m_handle, data, entry);
+        GSDUtils::checkError(retval, m_name);
+        return;
+        }
+
+    const char* chunk_data = getChunkData(entry, m_compressed_chunk);
+    memcpy(data, chunk_data + offset, size);
+    }
+
+/*! \param frame Frame index to search
+    \param name Name of the data chunk
+    \param compressed Output: true when the chunk is stored compressed
+
+    Look for the chunk uncompressed, then compressed, first in this frame and then in frame 0.
+
+    \returns The index entry of the chunk, or NULL when it is not present
+*/
+const gsd_index_entry* GSDReader::findChunk(uint64_t frame, const char* name, bool& compressed)
+    {
+    const std::string compressed_name = detail::GSDCompression::chunkName(name);
+    compressed = false;
+    const struct gsd_index_entry* entry = NULL;
+    for (uint64_t f : {frame, uint64_t(0)})
+        {
+        entry = gsd_find_chunk(&m_handle, f, name);
+        if (entry == NULL)
+            {
+            entry = gsd_find_chunk(&m_handle, f, compressed_name.c_str());
+            compressed = entry != NULL;
+            }
+        if (entry != NULL || frame == 0)
+            break;
+        }
+
+    return entry;
+    }
+
+/*! \param N Number of rows
+
+    Rank r reads the rows [N * r / P, N * (r + 1) / P), where P is the number of ranks.
+*/
+uint64_t GSDReader::getSliceBegin(uint64_t N) const
+    {
+    if (!m_distributed)
+        return 0;
+
+    return N * m_exec_conf->getRank() / m_exec_conf->getNRanks();
+    }
+
+/*! \param N Number of rows
+ */
+unsigned int GSDReader::getSliceSize(uint64_t N) const
+    {
+    if (!m_distributed)
+        return (unsigned int)N;
+
+    uint64_t end = N * (m_exec_conf->getRank() + 1) / m_exec_conf->getNRanks();
+    return (unsigned int)(end - getSliceBegin(N));
+    }
+
+/*! \param data Pointer to data to read into
+    \param frame Frame index to read from
+    \param name Name of the data chunk
+    \param row_size Size of one row of the data chunk in bytes
+    \param N Number of rows in the current frame
+
+    Read the rows getSliceBegin(N) to getSliceBegin(N) + getSliceSize(N) of the chunk into \a
+    data. Without distributed reads, this is the whole chunk. Other than that, readSlice() follows
+    the same rules as readChunk().
+
+    Return true if data is actually read from the file.
+*/
+bool GSDReader::readSlice(void* data,
+                          uint64_t frame,
+                          const char* name,
+                          size_t row_size,
+                          uint64_t N)
+    {
+    if (!m_distributed)
+        return readChunk(data, frame, name, N * row_size, (unsigned int)N);
+
+    bool compressed = false;
+    const struct gsd_index_entry* entry = findChunk(frame, name, compressed);
+    const size_t offset = getSliceBegin(N) * row_size;
+    const size_t size = getSliceSize(N) * row_size;
+
+    // compressed chunks cannot be read in part, decompress the whole chunk
+    if (compressed)
+        {
+        std::vector<char> buffer(N * row_size);
+        if (!readChunk(buffer.data(), frame, name, N * row_size, (unsigned int)N))
+            return false;
+
+        memcpy(data, buffer.data() + offset, size);
+        return true;
+        }
+
+    if (entry == NULL || entry->N != N)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
+    size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    if (actual_size != N * row_size)
+        {
+        std::ostringstream s;
+        s << "Expecting " << N * row_size << " bytes in " << name << " but found " << actual_size
+          << ".";
+        throw runtime_error(s.str());
+        }
+
+    readChunkData(data, entry, offset, size);
+    return true;
+    }
+
 /*! \param data Pointer to data to read into
     \param frame Frame index to read from
     \param name Name of the data chunk
@@ -102,6 +294,9 @@ GSDReader::~GSDReader()
 
     Per the GSD spec, keep the default when the frame 0 N does not match the current N.
 
+    When the file stores the chunk compressed (see GSDDumpWriter), read and decompress the chunk
+    named detail::GSDCompression::chunkName(name).
+
     Return true if data is actually read from the file.
 */
 bool GSDReader::readChunk(void* data,
@@ -110,11 +305,29 @@ bool GSDReader::readChunk(void* data,
                           size_t expected_size,
                           unsigned int cur_n)
     {
-    const struct gsd_index_entry* entry = gsd_find_chunk(&m_handle, frame, name);
-    if (entry == NULL && frame != 0)
-        entry = gsd_find_chunk(&m_handle, 0, name);
+    bool compressed = false;
+    const struct gsd_index_entry* entry = findChunk(frame, name, compressed);
 
-    if (entry == NULL || (cur_n != 0 && entry->N != cur_n))
+    if (entry == NULL)
+        {
+        m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
+        return false;
+        }
+
+    uint64_t N = entry->N;
+    size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
+    const char* compressed_data = NULL;
+    const size_t compressed_size = actual_size;
+    if (compressed)
+        {
+        compressed_data = getChunkData(entry, m_compressed_chunk);
+        detail::GSDCompression::Header header
+            = detail::GSDCompression::readHeader(compressed_data, compressed_size);
+        N = header.N;
+        actual_size = header.N * header.M * gsd_sizeof_type((enum gsd_type)header.type);
+        }
+
+    if (cur_n != 0 && N != cur_n)
         {
         m_exec_conf->msg->notice(10) << "data.gsd_snapshot: chunk not found " << name << endl;
         return false;
@@ -122,7 +335,6 @@ bool GSDReader::readChunk(void* data,
     else
         {
         m_exec_conf->msg->notice(7) << "data.gsd_snapshot: reading chunk " << name << endl;
-        size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
         if (actual_size != expected_size)
             {
             std::ostringstream s;
@@ -130,8 +342,19 @@ bool GSDReader::readChunk(void* data,
               << actual_size << ".";
             throw runtime_error(s.str());
             }
-        int retval = gsd_read_chunk(&m_handle, data, entry);
-        GSDUtils::checkError(retval, m_name);
+
+        if (compressed)
+            {
+            detail::GSDCompression::decompress(data,
+                                               expected_size,
+                                               compressed_data,
+                                               compressed_size,
+                                               m_compression_scratch);
+            }
+        else
+            {
+            readChunkData(data, entry, 0, expected_size);
+            }
 
         return true;
         }
@@ -166,8 +389,7 @@ std::vector<std::string> GSDReader::readTypes(uint64_t frame, const char* name)
         {
         size_t actual_size = entry->N * entry->M * gsd_sizeof_type((enum gsd_type)entry->type);
         std::vector<char> data(actual_size);
-        int retval = gsd_read_chunk(&m_handle, &data[0], entry);
-        GSDUtils::checkError(retval, m_name);
+        readChunkData(&data[0], entry, 0, actual_size);
 
         type_mapping.clear();
         for (unsigned int i = 0; i < entry->N; i++)
@@ -210,37 +432,94 @@ void GSDReader::readHeader()
         s << "Cannot read a file with 0 particles.";
         throw runtime_error(s.str());
         }
-    m_snapshot->particle_data.resize(N);
+    m_snapshot->particle_data.resize(getSliceSize(N));
+    m_snapshot->particle_data.is_distributed = m_distributed;
+    m_n_particles = N;
     }
 
 /*! Read the same data chunks for particles
  */
 void GSDReader::readParticles()
     {
-    unsigned int N = m_snapshot->particle_data.size;
+    unsigned int N = m_n_particles;
     m_snapshot->particle_data.type_mapping = readTypes(m_frame, "particles/types");
 
+    // an empty slice has no data to read
+    if (m_snapshot->particle_data.size == 0)
+        return;
+
     // the snapshot already has default values, if a chunk is not found, the value
     // is already at the default, and the failed read is not a problem
-    readChunk(&m_snapshot->particle_data.type[0], m_frame, "particles/typeid", N * 4, N);
-    readChunk(&m_snapshot->particle_data.mass[0], m_frame, "particles/mass", N * 4, N);
-    readChunk(&m_snapshot->particle_data.charge[0], m_frame, "particles/charge", N * 4, N);
-    readChunk(&m_snapshot->particle_data.diameter[0], m_frame, "particles/diameter", N * 4, N);
-    readChunk(&m_snapshot->particle_data.body[0], m_frame, "particles/body", N * 4, N);
-    readChunk(&m_snapshot->particle_data.inertia[0],
-              m_frame,
-              "particles/moment_inertia",
-              N * 12,
-              N);
-    readChunk(&m_snapshot->particle_data.pos[0], m_frame, "particles/position", N * 12, N);
-    readChunk(&m_snapshot->particle_data.orientation[0],
+    readSlice(&m_snapshot->particle_data.type[0], m_frame, "particles/typeid", 4, N);
+    readSlice(&m_snapshot->particle_data.mass[0], m_frame, "particles/mass", 4, N);
+    readSlice(&m_snapshot->particle_data.charge[0], m_frame, "particles/charge", 4, N);
+    readSlice(&m_snapshot->particle_data.diameter[0], m_frame, "particles/diameter", 4, N);
+    readSlice(&m_snapshot->particle_data.body[0], m_frame, "particles/body", 4, N);
+    readSlice(&m_snapshot->particle_data.inertia[0], m_frame, "particles/moment_inertia", 12, N);
+    if (!readPositionDelta())
+        readSlice(&m_snapshot->particle_data.pos[0], m_frame, "particles/position", 12, N);
+    readSlice(&m_snapshot->particle_data.orientation[0], m_frame, "particles/orientation", 16, N);
+    readSlice(&m_snapshot->particle_data.vel[0], m_frame, "particles/velocity", 12, N);
+    readSlice(&m_snapshot->particle_data.angmom[0], m_frame, "particles/angmom", 16, N);
+    readSlice(&m_snapshot->particle_data.image[0], m_frame, "particles/image", 12, N);
+    }
+
+/*! When the current frame stores the positions as displacements from a keyframe (see
+    GSDDumpWriter::writePosition()), read the positions of the keyframe and add the displacements.
+
+    Return true if the positions are read from the displacements.
+*/
+bool GSDReader::readPositionDelta()
+    {
+    // delta encoded positions apply only to the frame that stores them
+    const std::string keyframe_name = detail::GSDCompression::deltaChunkName("keyframe");
+    if (gsd_find_chunk(&m_handle, m_frame, keyframe_name.c_str()) == NULL)
+        return false;
+
+    unsigned int N = m_n_particles;
+    unsigned int n_slice = m_snapshot->particle_data.size;
+    uint64_t keyframe = 0;
+    double quantum = 0;
+    std::vector<int16_t> delta(size_t(n_slice) * 3);
+    readChunk(&keyframe, m_frame, keyframe_name.c_str(), 8);
+    readChunk(&quantum,
               m_frame,
-              "particles/orientation",
-              N * 16,
-              N);
-    readChunk(&m_snapshot->particle_data.vel[0], m_frame, "particles/velocity", N * 12, N);
-    readChunk(&m_snapshot->particle_data.angmom[0], m_frame, "particles/angmom", N * 16, N);
-    readChunk(&m_snapshot->particle_data.image[0], m_frame, "particles/image", N * 12, N);
+              detail::GSDCompression::deltaChunkName("quantum").c_str(),
+              8);
+    bool found_delta
+        = readSlice(delta.data(),
+                    m_frame,
+                    detail::GSDCompression::deltaChunkName("particles/position").c_str(),
+                    6,
+                    N);
+    bool found_keyframe = keyframe < m_frame
+                          && readSlice(&m_snapshot->particle_data.pos[0],
+                                       keyframe,
+                                       "particles/position",
+                                       12,
+                                       N);
+    if (!found_delta || !found_keyframe)
+        {
+        std::ostringstream s;
+        s << "Invalid position keyframe " << keyframe << " for frame " << m_frame << " in "
+          << m_name << ".";
+        throw runtime_error(s.str());
+        }
+
+    const BoxDim& box = *m_snapshot->global_box;
+    for (unsigned int i = 0; i < n_slice; i++)
+        {
+        vec3<Scalar> position(m_snapshot->particle_data.pos[i]);
+        position.x += Scalar(delta[i * 3] * quantum);
+        position.y += Scalar(delta[i * 3 + 1] * quantum);
+        position.z += Scalar(delta[i * 3 + 2] * quantum);
+
+        int3 image = make_int3(0, 0, 0);
+        box.wrap(position, image);
+        m_snapshot->particle_data.pos[i] = vec3<float>(position);
+        }
+
+    return true;
     }
 
 /*! Read the same data chunks for topology
@@ -250,54 +529,59 @@ void GSDReader::readTopology()
     unsigned int N = 0;
     m_snapshot->bond_data.type_mapping = readTypes(m_frame, "bonds/types");
     readChunk(&N, m_frame, "bonds/N", 4);
-    if (N > 0)
+    m_snapshot->bond_data.is_distributed = m_distributed;
+    if (getSliceSize(N) > 0)
         {
-        m_snapshot->bond_data.resize(N);
-        readChunk(&m_snapshot->bond_data.type_id[0], m_frame, "bonds/typeid", N * 4, N);
-        readChunk(&m_snapshot->bond_data.groups[0], m_frame, "bonds/group", N * 8, N);
+        m_snapshot->bond_data.resize(getSliceSize(N));
+        readSlice(&m_snapshot->bond_data.type_id[0], m_frame, "bonds/typeid", 4, N);
+        readSlice(&m_snapshot->bond_data.groups[0], m_frame, "bonds/group", 8, N);
         }
 
     N = 0;
     m_snapshot->angle_data.type_mapping = readTypes(m_frame, "angles/types");
     readChunk(&N, m_frame, "angles/N", 4);
-    if (N > 0)
+    m_snapshot->angle_data.is_distributed = m_distributed;
+    if (getSliceSize(N) > 0)
         {
-        m_snapshot->angle_data.resize(N);
-        readChunk(&m_snapshot->angle_data.type_id[0], m_frame, "angles/typeid", N * 4, N);
-        readChunk(&m_snapshot->angle_data.groups[0], m_frame, "angles/group", N * 12, N);
+        m_snapshot->angle_data.resize(getSliceSize(N));
+        readSlice(&m_snapshot->angle_data.type_id[0], m_frame, "angles/typeid", 4, N);
+        readSlice(&m_snapshot->angle_data.groups[0], m_frame, "angles/group", 12, N);
         }
 
     N = 0;
     m_snapshot->dihedral_data.type_mapping = readTypes(m_frame, "dihedrals/types");
     readChunk(&N, m_frame, "dihedrals/N", 4);
-    if (N > 0)
+    m_snapshot->dihedral_data.is_distributed = m_distributed;
+    if (getSliceSize(N) > 0)
         {
-        m_snapshot->dihedral_data.resize(N);
-        readChunk(&m_snapshot->dihedral_data.type_id[0], m_frame, "dihedrals/typeid", N * 4, N);
-        readChunk(&m_snapshot->dihedral_data.groups[0], m_frame, "dihedrals/group", N * 16, N);
+        m_snapshot->dihedral_data.resize(getSliceSize(N));
+        readSlice(&m_snapshot->dihedral_data.type_id[0], m_frame, "dihedrals/typeid", 4, N);
+        readSlice(&m_snapshot->dihedral_data.groups[0], m_frame, "dihedrals/group", 16, N);
         }
 
     N = 0;
     m_snapshot->improper_data.type_mapping = readTypes(m_frame, "impropers/types");
     readChunk(&N, m_frame, "impropers/N", 4);
-    if (N > 0)
+    m_snapshot->improper_data.is_distributed = m_distributed;
+    if (getSliceSize(N) > 0)
         {
-        m_snapshot->improper_data.resize(N);
-        readChunk(&m_snapshot->improper_data.type_id[0], m_frame, "impropers/typeid", N * 4, N);
-        readChunk(&m_snapshot->improper_data.groups[0], m_frame, "impropers/group", N * 16, N);
+        m_snapshot->improper_data.resize(getSliceSize(N));
+        readSlice(&m_snapshot->improper_data.type_id[0], m_frame, "impropers/typeid", 4, N);
+        readSlice(&m_snapshot->improper_data.groups[0], m_frame, "impropers/group", 16, N);
         }
 
     N = 0;
     readChunk(&N, m_frame, "constraints/N", 4);
-    if (N > 0)
+    m_snapshot->constraint_data.is_distributed = m_distributed;
+    if (getSliceSize(N) > 0)
         {
-        m_snapshot->constraint_data.resize(N);
-        std::vector<float> data(N);
-        readChunk(&data[0], m_frame, "constraints/value", N * 4, N);
-        for (unsigned int i = 0; i < N; i++)
+        m_snapshot->constraint_data.resize(getSliceSize(N));
+        std::vector<float> data(getSliceSize(N));
+        readSlice(&data[0], m_frame, "constraints/value", 4, N);
+        for (unsigned int i = 0; i < data.size(); i++)
             m_snapshot->constraint_data.val[i] = Scalar(data[i]);
 
-        readChunk(&m_snapshot->constraint_data.groups[0], m_frame, "constraints/group", N * 8, N);
+        readSlice(&m_snapshot->constraint_data.groups[0], m_frame, "constraints/group", 8, N);
         }
 
     if (m_handle.header.schema_version >= gsd_make_version(1, 1))
@@ -305,11 +589,12 @@ void GSDReader::readTopology()
         N = 0;
         m_snapshot->pair_data.type_mapping = readTypes(m_frame, "pairs/types");
         readChunk(&N, m_frame, "pairs/N", 4);
-        if (N > 0)
+        m_snapshot->pair_data.is_distributed = m_distributed;
+        if (getSliceSize(N) > 0)
             {
-            m_snapshot->pair_data.resize(N);
-            readChunk(&m_snapshot->pair_data.type_id[0], m_frame, "pairs/typeid", N * 4, N);
-            readChunk(&m_snapshot->pair_data.groups[0], m_frame, "pairs/group", N * 8, N);
+            m_snapshot->pair_data.resize(getSliceSize(N));
+            readSlice(&m_snapshot->pair_data.type_id[0], m_frame, "pairs/typeid", 4, N);
+            readSlice(&m_snapshot->pair_data.groups[0], m_frame, "pairs/group", 8, N);
             }
         }
     }
@@ -331,6 +616,7 @@ void export_GSDReader(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<const ExecutionConfiguration>,
                             const string&,
                             const uint64_t,
+                            bool,
                             bool>())
         .def("getTimeStep", &GSDReader::getTimeStep)
         .def("getSnapshot", &GSDReader::getSnapshot)
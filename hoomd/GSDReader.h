@@ -8,6 +8,7 @@
 #include "ParticleData.h"
 #include "hoomd/extern/gsd.h"
 #include <string>
+#include <vector>
 
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
@@ -33,7 +34,8 @@ class PYBIND11_EXPORT GSDReader
     GSDReader(std::shared_ptr<const ExecutionConfiguration> exec_conf,
               const std::string& name,
               const uint64_t frame,
-              bool from_end);
+              bool from_end,
+              bool distributed = false);
 
     //! Destructor
     ~GSDReader();
@@ -43,7 +45,7 @@ class PYBIND11_EXPORT GSDReader
         {
         uint64_t timestep = m_timestep;
 
-// timestep is only read on the root, broadcast to the other nodes
+// timestep is read on the root, broadcast to the other nodes
 #ifdef ENABLE_MPI
         const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
         bcast(timestep, 0, mpi_comm);
@@ -90,8 +92,35 @@ class PYBIND11_EXPORT GSDReader
     uint64_t m_timestep;                                       //!< Timestep at the selected frame
     std::string m_name;                                        //!< Cached file name
     uint64_t m_frame;                                          //!< Cached frame
+    unsigned int m_n_particles = 0;                            //!< Particles in the frame
     std::shared_ptr<SnapshotSystemData<float>> m_snapshot;     //!< The snapshot to read
     gsd_handle m_handle;                                       //!< Handle to the file
+    void* m_mapped_file = NULL;                                //!< Memory map of the file
+    size_t m_mapped_size = 0;                                  //!< Size of the memory map
+    std::vector<char> m_compressed_chunk;                      //!< Buffer for compressed chunks
+    std::vector<char> m_compression_scratch;                   //!< Decompression work buffer
+    bool m_distributed = false;                                //!< Read a slice on every rank
+
+    //! Map the file into memory
+    void mapFile();
+
+    //! Get a pointer to the data of a chunk
+    const char* getChunkData(const gsd_index_entry* entry, std::vector<char>& buffer);
+
+    //! Copy the data of a chunk
+    void readChunkData(void* data, const gsd_index_entry* entry, size_t offset, size_t size);
+
+    //! Find a chunk in the given frame or frame 0
+    const gsd_index_entry* findChunk(uint64_t frame, const char* name, bool& compressed);
+
+    //! Get the first row of the slice of N rows read by this rank
+    uint64_t getSliceBegin(uint64_t N) const;
+
+    //! Get the number of rows in the slice of N rows read by this rank
+    unsigned int getSliceSize(uint64_t N) const;
+
+    //! Read the slice of a per-particle or per-group chunk with N rows
+    bool readSlice(void* data, uint64_t frame, const char* name, size_t row_size, uint64_t N);
 
     //! Helper function to read a type list from the file
     std::vector<std::string> readTypes(uint64_t frame, const char* name);
@@ -99,6 +128,7 @@ class PYBIND11_EXPORT GSDReader
     // helper functions to read sections of the file
     void readHeader();
     void readParticles();
+    bool readPositionDelta();
     void readTopology();
     };
 
@@ -303,6 +303,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             m_acquired = false;
             m_align_bytes = rhs.m_align_bytes;
             m_tag = rhs.m_tag;
+            m_write_generation = hoomd::detail::nextWriteGeneration();
 
             if (rhs.m_data.get())
                 {
@@ -370,6 +371,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 #ifdef ENABLE_HIP
             m_event = std::move(other.m_event);
 #endif
+            m_write_generation = hoomd::detail::nextWriteGeneration();
             }
 
         return *this;
@@ -438,6 +440,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 #ifdef ENABLE_HIP
         std::swap(m_event, from.m_event);
 #endif
+        std::swap(m_write_generation, from.m_write_generation);
 
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         m_fallback.swap(from.m_fallback);
@@ -516,6 +519,16 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         return m_height;
         }
 
+    //! Get the write generation
+    uint64_t getWriteGeneration() const
+        {
+#ifndef ALWAYS_USE_MANAGED_MEMORY
+        if (!this->m_exec_conf || !m_is_managed)
+            return m_fallback.getWriteGeneration();
+#endif
+        return m_write_generation;
+        }
+
     //! Resize the GlobalArray
     /*! This method resizes the array by allocating a new array and copying over the elements
         from the old array. Resizing is a slow operation.
@@ -535,6 +548,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
+        m_write_generation = hoomd::detail::nextWriteGeneration();
 
 #ifdef ENABLE_HIP
         if (this->m_exec_conf && this->m_exec_conf->isCUDAEnabled())
@@ -587,6 +601,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
+        m_write_generation = hoomd::detail::nextWriteGeneration();
 
         // make m_pitch the next multiple of 16 larger or equal to the given width
         size_t pitch = (width + (16 - (width & 15)));
@@ -628,6 +643,38 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         outputRepresentation();
         }
 
+#ifdef ENABLE_HIP
+    //! Start copying the data to the host without blocking the host
+    /*! \param stream Stream to order the copy on
+        \param event Event to record on \a stream after the copy
+
+        \sa GPUArray::prefetchHost(). Managed memory is migrated to the host with
+        hipMemPrefetchAsync() when all devices support concurrent managed access.
+    */
+    inline void prefetchHost(hipStream_t stream, hipEvent_t event) const
+        {
+#ifndef ALWAYS_USE_MANAGED_MEMORY
+        if (!this->m_exec_conf || !m_is_managed)
+            {
+            m_fallback.prefetchHost(stream, event);
+            return;
+            }
+#endif
+
+        if (m_acquired)
+            {
+            throw std::runtime_error("Cannot prefetch array in use [" + this->m_tag + "]");
+            }
+
+        if (!isNull() && this->m_exec_conf->isCUDAEnabled()
+            && this->m_exec_conf->allConcurrentManagedAccess())
+            {
+            hipMemPrefetchAsync(m_data.get(), m_num_elements * sizeof(T), hipCpuDeviceId, stream);
+            }
+        hipEventRecord(event, stream);
+        }
+#endif
+
     //! Set an optional tag for memory profiling
     /*! tag The name of this allocation
      */
@@ -745,6 +792,9 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     size_t m_align_bytes; //!< Size of alignment in bytes
     bool m_is_managed;    //!< Whether or not this array is stored using managed memory.
 
+    //! Changes when the data may have been written
+    mutable uint64_t m_write_generation = hoomd::detail::nextWriteGeneration();
+
 #ifdef ENABLE_HIP
     std::unique_ptr<hipEvent_t, hoomd::detail::event_deleter>
         m_event; //! CUDA event for synchronization
@@ -905,6 +955,9 @@ inline ArrayHandleDispatch<T> GlobalArray<T>::acquire(const access_location::Enu
         }
     m_acquired = true;
 
+    if (mode != access_mode::read)
+        m_write_generation = hoomd::detail::nextWriteGeneration();
+
     // make sure a null array can be acquired
     if (!this->m_exec_conf || isNull())
         return GlobalArrayDispatch<T>(nullptr, *this);
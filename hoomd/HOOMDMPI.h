@@ -450,6 +450,80 @@ void all_gather_v(const T& in_value, std::vector<T>& out_values, const MPI_Comm
     delete[] rbuf;
     }
 
+//! Wrapper around MPI_Alltoallv that handles any serializable object
+/*! \param in_values Values to send, one for each rank
+    \param out_values Output: Values received, one from each rank
+    \param mpi_comm The MPI communicator
+*/
+template<typename T>
+void all_to_all_v(const std::vector<T>& in_values,
+                  std::vector<T>& out_values,
+                  const MPI_Comm mpi_comm)
+    {
+    int size;
+    MPI_Comm_size(mpi_comm, &size);
+
+    assert(in_values.size() == (unsigned int)size);
+
+    // serialize the values for each rank
+    std::vector<std::string> str(size);
+    std::vector<int> send_counts(size);
+    std::vector<int> send_displs(size);
+    unsigned int send_len = 0;
+    for (unsigned int i = 0; i < (unsigned int)size; i++)
+        {
+        std::stringstream s(std::ios_base::out | std::ios_base::binary);
+        cereal::BinaryOutputArchive ar(s);
+
+        ar << in_values[i];
+        s.flush();
+        str[i] = s.str();
+
+        send_displs[i] = (i > 0) ? send_displs[i - 1] + send_counts[i - 1] : 0;
+        send_counts[i] = (unsigned int)str[i].length();
+        send_len += send_counts[i];
+        }
+
+    std::vector<char> sbuf(send_len);
+    for (unsigned int i = 0; i < (unsigned int)size; i++)
+        str[i].copy(sbuf.data() + send_displs[i], send_counts[i]);
+
+    // exchange sizes of serialized values
+    std::vector<int> recv_counts(size);
+    MPI_Alltoall(send_counts.data(), 1, MPI_INT, recv_counts.data(), 1, MPI_INT, mpi_comm);
+
+    std::vector<int> recv_displs(size);
+    unsigned int recv_len = 0;
+    for (unsigned int i = 0; i < (unsigned int)size; i++)
+        {
+        recv_displs[i] = (i > 0) ? recv_displs[i - 1] + recv_counts[i - 1] : 0;
+        recv_len += recv_counts[i];
+        }
+    std::vector<char> rbuf(recv_len);
+
+    // exchange actual data
+    MPI_Alltoallv(sbuf.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  MPI_BYTE,
+                  rbuf.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  MPI_BYTE,
+                  mpi_comm);
+
+    // de-serialize data
+    out_values.resize(size);
+    for (unsigned int i = 0; i < (unsigned int)size; i++)
+        {
+        std::stringstream s(std::string(rbuf.data() + recv_displs[i], recv_counts[i]),
+                            std::ios_base::in | std::ios_base::binary);
+        cereal::BinaryInputArchive ar(s);
+
+        ar >> out_values[i];
+        }
+    }
+
 //! Wrapper around MPI_Send that handles any serializable object
 template<typename T> void send(const T& val, const unsigned int dest, const MPI_Comm mpi_comm)
     {
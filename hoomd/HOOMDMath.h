@@ -102,6 +102,26 @@ typedef double4 ShortReal4;
 #error HOOMD_SHORTREAL_SIZE must be 32 or 64.
 #endif
 
+//! Floating point type used to accumulate per-particle forces, energies, and virials
+/*! Pair forces evaluated in LongReal precision are summed into AccumReal accumulators before they
+    are written to the LongReal force arrays. Set HOOMD_ACCUMREAL_SIZE=64 together with
+    HOOMD_LONGREAL_SIZE=32 to evaluate the pair forces in single precision while accumulating them
+    in double precision.
+*/
+#if HOOMD_ACCUMREAL_SIZE == 32
+typedef float AccumReal;
+typedef float4 AccumReal4;
+#elif HOOMD_ACCUMREAL_SIZE == 64
+typedef double AccumReal;
+typedef double4 AccumReal4;
+#else
+#error HOOMD_ACCUMREAL_SIZE must be 32 or 64.
+#endif
+
+#if HOOMD_ACCUMREAL_SIZE < HOOMD_LONGREAL_SIZE
+#error HOOMD_ACCUMREAL_SIZE must not be smaller than HOOMD_LONGREAL_SIZE.
+#endif
+
 //! make a scalar2 value
 HOSTDEVICE inline Scalar2 make_scalar2(Scalar x, Scalar y)
     {
@@ -153,6 +153,33 @@ bool BuildInfo::getEnableTBB()
 #endif
     }
 
+bool BuildInfo::getEnableZstd()
+    {
+#ifdef ENABLE_ZSTD
+    return true;
+#else
+    return false;
+#endif
+    }
+
+bool BuildInfo::getEnablePAPI()
+    {
+#ifdef ENABLE_PAPI
+    return true;
+#else
+    return false;
+#endif
+    }
+
+bool BuildInfo::getEnableTorch()
+    {
+#ifdef ENABLE_TORCH
+    return true;
+#else
+    return false;
+#endif
+    }
+
 bool BuildInfo::getEnableMPI()
     {
 #ifdef ENABLE_MPI
@@ -167,9 +167,23 @@ void Integrator::computeNetForce(uint64_t timestep)
     {
     for (auto& force : m_forces)
         {
+        // forces applied every few steps are not needed on this step
+        if (getForceScale(*force, timestep) == Scalar(0.0))
+            continue;
+
+#ifdef ENABLE_MPI
+        // forces that do not overlap the ghost update need the complete ghosts
+        if (m_comm && !force->overlapsGhostUpdate())
+            m_comm->finishUpdateGhosts(timestep);
+#endif
         force->compute(timestep);
         }
 
+#ifdef ENABLE_MPI
+    if (m_comm)
+        m_comm->finishUpdateGhosts(timestep);
+#endif
+
     Scalar external_virial[6];
     Scalar external_energy;
         {
@@ -204,6 +218,10 @@ void Integrator::computeNetForce(uint64_t timestep)
 
         for (const auto& force : m_forces)
             {
+            Scalar scale = getForceScale(*force, timestep);
+            if (scale == Scalar(0.0))
+                continue;
+
             const GlobalArray<Scalar4>& h_force_array = force->getForceArray();
             const GlobalArray<Scalar>& h_virial_array = force->getVirialArray();
             const GlobalArray<Scalar4>& h_torque_array = force->getTorqueArray();
@@ -219,15 +237,15 @@ void Integrator::computeNetForce(uint64_t timestep)
             size_t virial_pitch = h_virial_array.getPitch();
             for (unsigned int j = 0; j < nparticles; j++)
                 {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
+                h_net_force.data[j].x += scale * h_force.data[j].x;
+                h_net_force.data[j].y += scale * h_force.data[j].y;
+                h_net_force.data[j].z += scale * h_force.data[j].z;
                 h_net_force.data[j].w += h_force.data[j].w;
 
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
+                h_net_torque.data[j].x += scale * h_torque.data[j].x;
+                h_net_torque.data[j].y += scale * h_torque.data[j].y;
+                h_net_torque.data[j].z += scale * h_torque.data[j].z;
+                h_net_torque.data[j].w += scale * h_torque.data[j].w;
 
                 for (unsigned int k = 0; k < 6; k++)
                     {
@@ -352,9 +370,23 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
     for (auto& force : m_forces)
         {
+        // forces applied every few steps are not needed on this step
+        if (getForceScale(*force, timestep) == Scalar(0.0))
+            continue;
+
+#ifdef ENABLE_MPI
+        // forces that do not overlap the ghost update need the complete ghosts
+        if (m_comm && !force->overlapsGhostUpdate())
+            m_comm->finishUpdateGhosts(timestep);
+#endif
         force->compute(timestep);
         }
 
+#ifdef ENABLE_MPI
+    if (m_comm)
+        m_comm->finishUpdateGhosts(timestep);
+#endif
+
     Scalar external_virial[6];
     Scalar external_energy;
 
@@ -387,10 +419,18 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
 
         external_energy = Scalar(0.0);
 
+        // sum only the forces that apply on this step
+        std::vector<std::shared_ptr<ForceCompute>> forces;
+        for (const auto& force : m_forces)
+            {
+            if (getForceScale(*force, timestep) != Scalar(0.0))
+                forces.push_back(force);
+            }
+
         // there is no need to zero out the initial net force and virial here, the first call to the
         // addition kernel will do that ahh!, but we do need to zer out the net force and virial if
         // there are 0 forces!
-        if (m_forces.size() == 0)
+        if (forces.size() == 0)
             {
             // start by zeroing the net force and virial arrays
             hipMemset(d_net_force.data, 0, sizeof(Scalar4) * net_force.getNumElements());
@@ -403,20 +443,20 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         // now, add up the accelerations
         // sum all the forces into the net force
         // perform the sum in groups of 6 to avoid kernel launch and memory access overheads
-        for (unsigned int cur_force = 0; cur_force < m_forces.size(); cur_force += 6)
+        for (unsigned int cur_force = 0; cur_force < forces.size(); cur_force += 6)
             {
             // grab the device pointers for the current set
             kernel::gpu_force_list force_list;
 
-            const GlobalArray<Scalar4>& d_force_array0 = m_forces[cur_force]->getForceArray();
+            const GlobalArray<Scalar4>& d_force_array0 = forces[cur_force]->getForceArray();
             ArrayHandle<Scalar4> d_force0(d_force_array0,
                                           access_location::device,
                                           access_mode::read);
-            const GlobalArray<Scalar>& d_virial_array0 = m_forces[cur_force]->getVirialArray();
+            const GlobalArray<Scalar>& d_virial_array0 = forces[cur_force]->getVirialArray();
             ArrayHandle<Scalar> d_virial0(d_virial_array0,
                                           access_location::device,
                                           access_mode::read);
-            const GlobalArray<Scalar4>& d_torque_array0 = m_forces[cur_force]->getTorqueArray();
+            const GlobalArray<Scalar4>& d_torque_array0 = forces[cur_force]->getTorqueArray();
             ArrayHandle<Scalar4> d_torque0(d_torque_array0,
                                            access_location::device,
                                            access_mode::read);
@@ -424,21 +464,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
             force_list.v0 = d_virial0.data;
             force_list.vpitch0 = d_virial_array0.getPitch();
             force_list.t0 = d_torque0.data;
+            force_list.s0 = getForceScale(*forces[cur_force], timestep);
 
-            if (cur_force + 1 < m_forces.size())
+            if (cur_force + 1 < forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array1
-                    = m_forces[cur_force + 1]->getForceArray();
+                    = forces[cur_force + 1]->getForceArray();
                 ArrayHandle<Scalar4> d_force1(d_force_array1,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array1
-                    = m_forces[cur_force + 1]->getVirialArray();
+                    = forces[cur_force + 1]->getVirialArray();
                 ArrayHandle<Scalar> d_virial1(d_virial_array1,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array1
-                    = m_forces[cur_force + 1]->getTorqueArray();
+                    = forces[cur_force + 1]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque1(d_torque_array1,
                                                access_location::device,
                                                access_mode::read);
@@ -446,21 +487,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v1 = d_virial1.data;
                 force_list.vpitch1 = d_virial_array1.getPitch();
                 force_list.t1 = d_torque1.data;
+                force_list.s1 = getForceScale(*forces[cur_force + 1], timestep);
                 }
-            if (cur_force + 2 < m_forces.size())
+            if (cur_force + 2 < forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array2
-                    = m_forces[cur_force + 2]->getForceArray();
+                    = forces[cur_force + 2]->getForceArray();
                 ArrayHandle<Scalar4> d_force2(d_force_array2,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array2
-                    = m_forces[cur_force + 2]->getVirialArray();
+                    = forces[cur_force + 2]->getVirialArray();
                 ArrayHandle<Scalar> d_virial2(d_virial_array2,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array2
-                    = m_forces[cur_force + 2]->getTorqueArray();
+                    = forces[cur_force + 2]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque2(d_torque_array2,
                                                access_location::device,
                                                access_mode::read);
@@ -468,21 +510,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v2 = d_virial2.data;
                 force_list.vpitch2 = d_virial_array2.getPitch();
                 force_list.t2 = d_torque2.data;
+                force_list.s2 = getForceScale(*forces[cur_force + 2], timestep);
                 }
-            if (cur_force + 3 < m_forces.size())
+            if (cur_force + 3 < forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array3
-                    = m_forces[cur_force + 3]->getForceArray();
+                    = forces[cur_force + 3]->getForceArray();
                 ArrayHandle<Scalar4> d_force3(d_force_array3,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array3
-                    = m_forces[cur_force + 3]->getVirialArray();
+                    = forces[cur_force + 3]->getVirialArray();
                 ArrayHandle<Scalar> d_virial3(d_virial_array3,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array3
-                    = m_forces[cur_force + 3]->getTorqueArray();
+                    = forces[cur_force + 3]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque3(d_torque_array3,
                                                access_location::device,
                                                access_mode::read);
@@ -490,21 +533,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v3 = d_virial3.data;
                 force_list.vpitch3 = d_virial_array3.getPitch();
                 force_list.t3 = d_torque3.data;
+                force_list.s3 = getForceScale(*forces[cur_force + 3], timestep);
                 }
-            if (cur_force + 4 < m_forces.size())
+            if (cur_force + 4 < forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array4
-                    = m_forces[cur_force + 4]->getForceArray();
+                    = forces[cur_force + 4]->getForceArray();
                 ArrayHandle<Scalar4> d_force4(d_force_array4,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array4
-                    = m_forces[cur_force + 4]->getVirialArray();
+                    = forces[cur_force + 4]->getVirialArray();
                 ArrayHandle<Scalar> d_virial4(d_virial_array4,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array4
-                    = m_forces[cur_force + 4]->getTorqueArray();
+                    = forces[cur_force + 4]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque4(d_torque_array4,
                                                access_location::device,
                                                access_mode::read);
@@ -512,21 +556,22 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v4 = d_virial4.data;
                 force_list.vpitch4 = d_virial_array4.getPitch();
                 force_list.t4 = d_torque4.data;
+                force_list.s4 = getForceScale(*forces[cur_force + 4], timestep);
                 }
-            if (cur_force + 5 < m_forces.size())
+            if (cur_force + 5 < forces.size())
                 {
                 const GlobalArray<Scalar4>& d_force_array5
-                    = m_forces[cur_force + 5]->getForceArray();
+                    = forces[cur_force + 5]->getForceArray();
                 ArrayHandle<Scalar4> d_force5(d_force_array5,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar>& d_virial_array5
-                    = m_forces[cur_force + 5]->getVirialArray();
+                    = forces[cur_force + 5]->getVirialArray();
                 ArrayHandle<Scalar> d_virial5(d_virial_array5,
                                               access_location::device,
                                               access_mode::read);
                 const GlobalArray<Scalar4>& d_torque_array5
-                    = m_forces[cur_force + 5]->getTorqueArray();
+                    = forces[cur_force + 5]->getTorqueArray();
                 ArrayHandle<Scalar4> d_torque5(d_torque_array5,
                                                access_location::device,
                                                access_mode::read);
@@ -534,6 +579,7 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
                 force_list.v5 = d_virial5.data;
                 force_list.vpitch5 = d_virial_array5.getPitch();
                 force_list.t5 = d_torque5.data;
+                force_list.s5 = getForceScale(*forces[cur_force + 5], timestep);
                 }
 
             // clear on the first iteration only
@@ -542,6 +588,21 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
             // access flags
             PDataFlags flags = this->m_pdata->getFlags();
 
+            // when all forces fit in one list, the integration method may sum them
+            if (forces.size() <= 6 && m_constraint_forces.size() == 0)
+                {
+                kernel::gpu_net_force_sum net_force_sum;
+                net_force_sum.d_net_force = d_net_force.data;
+                net_force_sum.d_net_virial = d_net_virial.data;
+                net_force_sum.net_virial_pitch = net_virial_pitch;
+                net_force_sum.d_net_torque = d_net_torque.data;
+                net_force_sum.force_list = force_list;
+                net_force_sum.compute_virial = flags[pdata_flag::pressure_tensor];
+
+                if (sumNetForceFusedGPU(timestep, net_force_sum))
+                    continue;
+                }
+
             m_exec_conf->beginMultiGPU();
 
             gpu_integrator_sum_net_force(d_net_force.data,
@@ -564,6 +625,9 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
     // add up external virials and energies
     for (const auto& force : m_forces)
         {
+        if (getForceScale(*force, timestep) == Scalar(0.0))
+            continue;
+
         for (unsigned int k = 0; k < 6; k++)
             external_virial[k] += force->getExternalVirial(k);
         external_energy += force->getExternalEnergy();
@@ -865,7 +929,8 @@ void Integrator::computeCallback(uint64_t timestep)
     // pre-compute all active forces
     for (auto& force : m_forces)
         {
-        force->preCompute(timestep);
+        if (getForceScale(*force, timestep) != Scalar(0.0))
+            force->preCompute(timestep);
         }
     }
 #endif
@@ -28,7 +28,8 @@ struct gpu_force_list
     gpu_force_list()
         : f0(NULL), f1(NULL), f2(NULL), f3(NULL), f4(NULL), f5(NULL), t0(NULL), t1(NULL), t2(NULL),
           t3(NULL), t4(NULL), t5(NULL), v0(NULL), v1(NULL), v2(NULL), v3(NULL), v4(NULL), v5(NULL),
-          vpitch0(0), vpitch1(0), vpitch2(0), vpitch3(0), vpitch4(0), vpitch5(0)
+          vpitch0(0), vpitch1(0), vpitch2(0), vpitch3(0), vpitch4(0), vpitch5(0), s0(1), s1(1),
+          s2(1), s3(1), s4(1), s5(1)
         {
         }
 
@@ -59,8 +60,148 @@ struct gpu_force_list
     size_t vpitch3; //!< Pitch of virial array 3
     size_t vpitch4; //!< Pitch of virial array 4
     size_t vpitch5; //!< Pitch of virial array 5
+
+    Scalar s0; //!< Weight of force and torque array 0
+    Scalar s1; //!< Weight of force and torque array 1
+    Scalar s2; //!< Weight of force and torque array 2
+    Scalar s3; //!< Weight of force and torque array 3
+    Scalar s4; //!< Weight of force and torque array 4
+    Scalar s5; //!< Weight of force and torque array 5
+    };
+
+//! Arguments to sum the net force inside an integration kernel
+/*! When all forces fit in one gpu_force_list, an integration method may sum the net force in its
+    own second step kernel instead of reading the net force written by
+    gpu_integrator_sum_net_force(). The kernel must visit every local particle once.
+*/
+struct gpu_net_force_sum
+    {
+    Scalar4* d_net_force;      //!< Net force to write
+    Scalar* d_net_virial;      //!< Net virial to write
+    size_t net_virial_pitch;   //!< Pitch of the net virial array
+    Scalar4* d_net_torque;     //!< Net torque to write
+    gpu_force_list force_list; //!< Forces to sum
+    bool compute_virial;       //!< Set to true to sum the virial
     };
 
+#ifdef __HIPCC__
+//! helper to add a given force/virial pointer pair
+template<unsigned int compute_virial>
+__device__ inline void add_force_total(Scalar4& net_force,
+                                       Scalar* net_virial,
+                                       Scalar4& net_torque,
+                                       Scalar4* d_f,
+                                       Scalar* d_v,
+                                       const size_t virial_pitch,
+                                       Scalar4* d_t,
+                                       Scalar scale,
+                                       int idx)
+    {
+    if (d_f != NULL && d_v != NULL && d_t != NULL)
+        {
+        Scalar4 f = d_f[idx];
+        Scalar4 t = d_t[idx];
+
+        // the weight applies to the force and torque, not to the energy and virial
+        net_force.x += scale * f.x;
+        net_force.y += scale * f.y;
+        net_force.z += scale * f.z;
+        net_force.w += f.w;
+
+        if (compute_virial)
+            {
+            for (int i = 0; i < 6; i++)
+                net_virial[i] += d_v[i * virial_pitch + idx];
+            }
+
+        net_torque.x += scale * t.x;
+        net_torque.y += scale * t.y;
+        net_torque.z += scale * t.z;
+        net_torque.w += scale * t.w;
+        }
+    }
+
+//! Sum the net force, virial, and torque of one particle
+/*! \param args Arrays to sum and write
+    \param idx Index of the particle
+    \tparam compute_virial When set to 0, the virial sum is not computed
+    \returns The net force on the particle
+*/
+template<unsigned int compute_virial>
+__device__ inline Scalar4 sum_net_force(const gpu_net_force_sum& args, int idx)
+    {
+    const gpu_force_list& list = args.force_list;
+    Scalar4 net_force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+    Scalar net_virial[6] = {0, 0, 0, 0, 0, 0};
+    Scalar4 net_torque = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f0,
+                                    list.v0,
+                                    list.vpitch0,
+                                    list.t0,
+                                    list.s0,
+                                    idx);
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f1,
+                                    list.v1,
+                                    list.vpitch1,
+                                    list.t1,
+                                    list.s1,
+                                    idx);
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f2,
+                                    list.v2,
+                                    list.vpitch2,
+                                    list.t2,
+                                    list.s2,
+                                    idx);
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f3,
+                                    list.v3,
+                                    list.vpitch3,
+                                    list.t3,
+                                    list.s3,
+                                    idx);
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f4,
+                                    list.v4,
+                                    list.vpitch4,
+                                    list.t4,
+                                    list.s4,
+                                    idx);
+    add_force_total<compute_virial>(net_force,
+                                    net_virial,
+                                    net_torque,
+                                    list.f5,
+                                    list.v5,
+                                    list.vpitch5,
+                                    list.t5,
+                                    list.s5,
+                                    idx);
+
+    args.d_net_force[idx] = net_force;
+    if (compute_virial)
+        {
+        for (int i = 0; i < 6; i++)
+            args.d_net_virial[i * args.net_virial_pitch + idx] = net_virial[i];
+        }
+    args.d_net_torque[idx] = net_torque;
+
+    return net_force;
+    }
+#endif
+
 //! Driver for gpu_integrator_sum_net_force_kernel()
 hipError_t gpu_integrator_sum_net_force(Scalar4* d_net_force,
                                         Scalar* d_net_virial,
@@ -17,6 +17,7 @@
 #include <vector>
 
 #ifdef ENABLE_HIP
+#include "Integrator.cuh"
 #include <hip/hip_runtime.h>
 #endif
 
@@ -127,6 +128,15 @@ class PYBIND11_EXPORT Integrator : public Updater
         return 0;
         }
 
+    /// Get the groups whose members determine the degrees of freedom granted to other groups
+    /** When none of these groups change, a group whose own members are unchanged keeps its degrees
+        of freedom. Base class Integrator returns an empty list. Derived classes should override.
+    */
+    virtual std::vector<std::shared_ptr<ParticleGroup>> getDOFGroups()
+        {
+        return std::vector<std::shared_ptr<ParticleGroup>>();
+        }
+
     /// Count the total number of degrees of freedom removed by all constraint forces
     Scalar getNDOFRemoved(std::shared_ptr<ParticleGroup> query);
 
@@ -177,6 +187,18 @@ class PYBIND11_EXPORT Integrator : public Updater
         }
 
     protected:
+    /// Get the weight of a force's force and torque in the net force on the given step
+    /** Forces with an interval k > 1 are applied as impulses: they enter the net force with a
+        weight of k on steps that are multiples of k and are not computed on other steps. With the
+        velocity Verlet style two step methods, this is the impulse form of r-RESPA multiple time
+        step integration.
+    */
+    static Scalar getForceScale(const ForceCompute& force, uint64_t timestep)
+        {
+        unsigned int interval = force.getInterval();
+        return timestep % interval == 0 ? Scalar(interval) : Scalar(0.0);
+        }
+
     /// The step size
     Scalar m_deltaT;
 
@@ -198,6 +220,21 @@ class PYBIND11_EXPORT Integrator : public Updater
 #ifdef ENABLE_HIP
     /// helper function to compute net force/virial on the GPU
     virtual void computeNetForceGPU(uint64_t timestep);
+
+    /// Sum the net force as part of the integration step
+    /** \param timestep Time step of the forces
+        \param net_force_sum Net force arrays and the forces to sum
+
+        computeNetForceGPU calls this when there are no constraint forces and all the forces
+        that apply on \a timestep fit in one kernel::gpu_force_list. Return true after summing
+        the net force, virial, and torque of every local particle, or false to have
+        computeNetForceGPU sum them.
+    */
+    virtual bool sumNetForceFusedGPU(uint64_t timestep,
+                                     const kernel::gpu_net_force_sum& net_force_sum)
+        {
+        return false;
+        }
 #endif
 
 #ifdef ENABLE_MPI
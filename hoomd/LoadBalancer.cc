@@ -11,6 +11,7 @@
 #include "hoomd/extern/BVLSSolver.h"
 #include <Eigen/Dense>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
@@ -34,6 +35,8 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #endif
       m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
       m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
+      m_time_weighted(false), m_particle_weight(Scalar(1.0)), m_last_comm_time(0.0),
+      m_has_last_time(false), m_type_weight(m_pdata->getNTypes(), Scalar(1.0)),
       m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
       m_n_iterations(0), m_n_rebalances(0)
     {
@@ -66,6 +69,27 @@ LoadBalancer::~LoadBalancer()
     m_exec_conf->msg->notice(5) << "Destroying LoadBalancer" << endl;
     }
 
+/*!
+ * \param type_name Name of the particle type
+ * \param weight Relative cost of a particle of this type
+ */
+void LoadBalancer::setWeight(const std::string& type_name, Scalar weight)
+    {
+    if (weight <= Scalar(0.0))
+        {
+        throw std::invalid_argument("LoadBalancer: weight must be positive");
+        }
+    m_type_weight[m_pdata->getTypeByName(type_name)] = weight;
+    }
+
+/*!
+ * \param type_name Name of the particle type
+ */
+Scalar LoadBalancer::getWeight(const std::string& type_name)
+    {
+    return m_type_weight[m_pdata->getTypeByName(type_name)];
+    }
+
 /*!
  * \param timestep Current time step of the simulation
  *
@@ -83,6 +107,7 @@ void LoadBalancer::update(uint64_t timestep)
 
     // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
     resetNOwn(m_pdata->getN());
+    computeParticleWeight();
 
     // figure out which rank is the reduction root for broadcasting
     const Index3D& di = m_decomposition->getDomainIndexer();
@@ -139,10 +164,10 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<Scalar> N_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
+            // reduce the load in the slice along dim
             bool active = reduce(N_i, dim, reduce_root);
 
             // attempt an adjustment
@@ -172,24 +197,91 @@ void LoadBalancer::update(uint64_t timestep)
             resetNOwn(m_pdata->getN());
             m_needs_migrate = false;
 
+            // the type weights of the owned particles are known exactly after the migration
+            if (!m_time_weighted)
+                computeParticleWeight();
+
             // increment the number of rebalances actually performed
             ++m_n_rebalances;
             }
         }
+
+    // start the next measurement after balancing so that its cost is not attributed to the ranks
+    m_last_time = std::chrono::steady_clock::now();
+    m_last_comm_time = m_comm->getTimer().getInclusiveWalltime();
+    m_has_last_time = true;
 #endif // ENABLE_MPI
     }
 
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
- * ranks.
+ * With time weighting, the weight of the particles on this rank is the measured wall time per
+ * particle since the last balancing step, excluding the time spent in the Communicator (which
+ * includes the time spent waiting on slower ranks). Before the first measurement, every particle
+ * has weight 1.
+ *
+ * Otherwise, the weight of the particles on this rank is the average of the per-type weights of
+ * the owned particles. Particles that move to another rank during the balancing iterations take on
+ * the weight of that rank until the next migration.
+ *
+ * In both cases, the weights are normalized so that the weighted number of particles summed over
+ * all ranks is the total number of particles.
+ *
+ * \note All ranks must call computeParticleWeight() since it involves a collective reduction.
+ */
+void LoadBalancer::computeParticleWeight()
+    {
+    m_particle_weight = Scalar(1.0);
+    m_recompute_max_imbalance = true;
+
+    double work(0.0);
+    if (m_time_weighted)
+        {
+        if (!m_has_last_time)
+            return;
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - m_last_time;
+        double comm_time = m_comm->getTimer().getInclusiveWalltime() - m_last_comm_time;
+        work = std::max(elapsed.count() - comm_time, 0.0);
+        }
+    else
+        {
+        // skip the sum when all types have the default weight
+        if (std::all_of(m_type_weight.begin(),
+                        m_type_weight.end(),
+                        [](Scalar w) { return w == Scalar(1.0); }))
+            return;
+
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+            {
+            work += m_type_weight[__scalar_as_int(h_pos.data[i].w)];
+            }
+        }
+
+    double total_work(0.0);
+    MPI_Allreduce(&work, &total_work, 1, MPI_DOUBLE, MPI_SUM, m_mpi_comm);
+
+    // ranks without particles keep the average weight, so that they may receive particles
+    if (total_work > 0.0 && m_pdata->getN() > 0)
+        {
+        m_particle_weight = Scalar(work / double(m_pdata->getN()) * double(m_pdata->getNGlobal())
+                                   / total_work);
+        }
+    }
+
+/*!
+ * Computes the imbalance factor I = N w / <N> for each rank, and computes the maximum among all
+ * ranks. The weight w is 1 unless the load is weighted by time or by type.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
+        Scalar cur_imb = getLoad()
                          / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
@@ -205,12 +297,12 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * \param N_i Vector holding the total load in each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
  * \returns true if the current rank holds the active \a N_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a N_i holds the weighted number of particles in each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
@@ -221,21 +313,26 @@ Scalar LoadBalancer::getMaxImbalance()
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
-                          unsigned int dim,
-                          unsigned int reduce_root)
+bool LoadBalancer::reduce(std::vector<Scalar>& N_i, unsigned int dim, unsigned int reduce_root)
     {
     // do nothing if there is only one rank
     if (N_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<Scalar> N_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the weighted number of particles the current rank owns (the quantity to be reduced)
+    Scalar N_own = getLoad();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&N_own,
+               1,
+               MPI_HOOMD_SCALAR,
+               &N_per_rank[0],
+               1,
+               MPI_HOOMD_SCALAR,
+               reduce_root,
+               m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -245,7 +342,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<Scalar> N_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
         N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
@@ -258,7 +355,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
         N_i.resize(di.getW());
         for (unsigned int i = 0; i < di.getW(); ++i)
             {
-            N_i[i] = 0;
+            N_i[i] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int j = 0; j < di.getH(); ++j)
@@ -274,7 +371,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
         N_i.resize(di.getH());
         for (unsigned int j = 0; j < di.getH(); ++j)
             {
-            N_i[j] = 0;
+            N_i[j] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
@@ -290,7 +387,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
         N_i.resize(di.getD());
         for (unsigned int k = 0; k < di.getD(); ++k)
             {
-            N_i[k] = 0;
+            N_i[k] = Scalar(0.0);
             for (unsigned int j = 0; j < di.getH(); ++j)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
@@ -310,7 +407,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param N_i The reduced (weighted) number of particles along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -329,7 +426,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<Scalar>& N_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
@@ -351,7 +448,7 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     vector<Scalar> new_widths(N_i.size());
     for (unsigned int i = 0; i < N_i.size(); ++i)
         {
-        const Scalar imb_factor = Scalar(N_i[i]) / target;
+        const Scalar imb_factor = N_i[i] / target;
         Scalar scale_factor
             = (N_i[i] > 0)
                   ? Scalar(1.0) / imb_factor
@@ -614,6 +711,9 @@ void LoadBalancer::resetStats()
     m_n_calls = m_n_iterations = m_n_rebalances = 0;
     m_total_max_imbalance = 0.0;
     m_max_max_imbalance = Scalar(1.0);
+
+    // do not attribute the time between runs to the first balancing step
+    m_has_last_time = false;
     }
 
 namespace detail
@@ -628,7 +728,12 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("time_weighted",
+                      &LoadBalancer::getTimeWeighted,
+                      &LoadBalancer::setTimeWeighted)
+        .def("setWeight", &LoadBalancer::setWeight)
+        .def("getWeight", &LoadBalancer::getWeight);
     }
 
     } // end namespace detail
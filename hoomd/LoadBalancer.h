@@ -13,6 +13,7 @@
 #include "Trigger.h"
 #include "Tuner.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <pybind11/pybind11.h>
@@ -37,6 +38,15 @@ namespace hoomd
  * Constraints are satisfied by solving a least-squares problem with box constraints, where the cost
  * function is the deviation of the domain sizes from the proposed rescaled width.
  *
+ * When time weighting is enabled, each particle counts with the measured cost per particle of the
+ * rank that owns it: the wall time spent outside of the Communicator since the previous balancing
+ * step divided by the number of owned particles, normalized so that the average weight is 1. This
+ * balances systems where the cost per particle varies in space, e.g. a dense droplet in a vapor.
+ *
+ * Without time weighting, each particle counts with the weight of its type (1 by default). Use
+ * this to account for particles that cost more than others, e.g. charged particles or rigid body
+ * constituents.
+ *
  * \ingroup updaters
  */
 class PYBIND11_EXPORT LoadBalancer : public Tuner
@@ -81,6 +91,24 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         m_maxiter = maxiter;
         }
 
+    //! Get whether the load is weighted by the measured time per particle
+    bool getTimeWeighted() const
+        {
+        return m_time_weighted;
+        }
+
+    //! Set whether the load is weighted by the measured time per particle
+    void setTimeWeighted(bool time_weighted)
+        {
+        m_time_weighted = time_weighted;
+        }
+
+    //! Set the relative cost of particles of the given type
+    void setWeight(const std::string& type_name, Scalar weight);
+
+    //! Get the relative cost of particles of the given type
+    Scalar getWeight(const std::string& type_name);
+
     //! Enable / disable load balancing along a dimension
     /*!
      * \param dim Dimension along which to balance
@@ -155,8 +183,11 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Reduce the load per rank down to one dimension
+    bool reduce(std::vector<Scalar>& N_i, unsigned int dim, unsigned int reduce_root);
+
+    //! Measure the cost per particle of this rank since the last balancing step
+    void computeParticleWeight();
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,7 +199,7 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<Scalar>& N_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
@@ -185,6 +216,12 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_N_own;
         }
 
+    //! Gets the weighted number of owned particles
+    Scalar getLoad()
+        {
+        return Scalar(getNOwn()) * m_particle_weight;
+        }
+
     //! Force a reset of the number of owned particles without counting
     /*!
      * \param N number of particles owned by the rank
@@ -211,6 +248,16 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
+    bool m_time_weighted;     //!< Flag to weight the load by the measured time per particle
+    Scalar m_particle_weight; //!< Relative cost of each particle owned by this rank
+
+    /// Wall clock time at the end of the last balancing step
+    std::chrono::steady_clock::time_point m_last_time;
+    double m_last_comm_time; //!< Communicator wall time at the end of the last balancing step
+    bool m_has_last_time;    //!< Flag if m_last_time has been set
+
+    std::vector<Scalar> m_type_weight; //!< Relative cost of the particles of each type
+
     private:
     unsigned int m_N_own; //!< Number of particles owned by this rank
 
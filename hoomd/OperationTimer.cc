@@ -0,0 +1,133 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file OperationTimer.cc
+    \brief Defines the OperationTimer and ScopedOperationTimer classes
+*/
+
+#include "OperationTimer.h"
+
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <memory>
+
+#ifdef ENABLE_PAPI
+#include <papi.h>
+#include <thread>
+#endif
+
+namespace hoomd
+    {
+thread_local ScopedOperationTimer* ScopedOperationTimer::s_current = nullptr;
+
+namespace
+    {
+#ifdef ENABLE_PAPI
+//! PAPI event set that counts on the thread that created it
+struct PAPIEventSet
+    {
+    //! Initialize PAPI and start counting the available events
+    PAPIEventSet()
+        {
+        if (PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT
+            || PAPI_create_eventset(&event_set) != PAPI_OK)
+            return;
+
+        int events[] = {PAPI_TOT_CYC, PAPI_TOT_INS, PAPI_L2_TCM, PAPI_L3_TCM};
+        for (int event : events)
+            {
+            // events may be missing on this CPU or conflict with the events already added
+            if (names.size() == max_hardware_counters
+                || PAPI_add_event(event_set, event) != PAPI_OK)
+                continue;
+
+            char name[PAPI_MAX_STR_LEN];
+            PAPI_event_code_to_name(event, name);
+            names.push_back(name);
+            }
+
+        if (names.empty() || PAPI_start(event_set) != PAPI_OK)
+            {
+            names.clear();
+            return;
+            }
+        owner = std::this_thread::get_id();
+        }
+
+    int event_set = PAPI_NULL;      //!< PAPI event set handle
+    std::vector<std::string> names; //!< Names of the events in the set
+    std::thread::id owner;          //!< Thread that counts the events
+    };
+
+//! Get the event set, creating it on the first call
+PAPIEventSet& getPAPIEventSet()
+    {
+    static PAPIEventSet event_set;
+    return event_set;
+    }
+#endif
+    } // end anonymous namespace
+
+/*! \param values Array of max_hardware_counters values to write the counters to
+    \returns false when no counters are available on the calling thread
+*/
+bool HardwareCounters::read(long long* values)
+    {
+#ifdef ENABLE_PAPI
+    PAPIEventSet& event_set = getPAPIEventSet();
+    if (event_set.names.empty() || std::this_thread::get_id() != event_set.owner)
+        return false;
+
+    std::fill(values, values + max_hardware_counters, 0);
+    return PAPI_read(event_set.event_set, values) == PAPI_OK;
+#else
+    return false;
+#endif
+    }
+
+const std::vector<std::string>& HardwareCounters::getNames()
+    {
+#ifdef ENABLE_PAPI
+    return getPAPIEventSet().names;
+#else
+    static const std::vector<std::string> no_names;
+    return no_names;
+#endif
+    }
+
+/*! \param type Type to name
+    \returns The demangled name of \a type, or the mangled name when demangling fails
+*/
+std::string ScopedOperationTimer::demangle(const std::type_info& type)
+    {
+    int status = 0;
+    std::unique_ptr<char, void (*)(void*)> name(
+        abi::__cxa_demangle(type.name(), nullptr, nullptr, &status),
+        std::free);
+    if (status != 0 || !name)
+        return type.name();
+
+    return name.get();
+    }
+
+namespace detail
+    {
+void export_OperationTimer(pybind11::module& m)
+    {
+    pybind11::class_<OperationTimer>(m, "OperationTimer")
+        .def_property_readonly("walltime", &OperationTimer::getWalltime)
+        .def_property_readonly("inclusive_walltime", &OperationTimer::getInclusiveWalltime)
+        .def_property_readonly("calls", &OperationTimer::getCalls)
+        .def_property_readonly("bytes", &OperationTimer::getBytes)
+        .def_property_readonly("hardware_counters", &OperationTimer::getHardwareCounters)
+        .def_property_readonly_static("hardware_counter_names",
+                                      [](pybind11::object) { return HardwareCounters::getNames(); })
+        .def("reset", &OperationTimer::reset);
+    }
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -0,0 +1,236 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file OperationTimer.h
+    \brief Declares the OperationTimer and ScopedOperationTimer classes
+*/
+
+#pragma once
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <chrono>
+#include <stdint.h>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+#ifdef ENABLE_NVTOOLS
+#include <nvToolsExt.h>
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+//! Maximum number of hardware performance counters accumulated by an OperationTimer
+const unsigned int max_hardware_counters = 4;
+
+//! Reads the hardware performance counters of the calling thread
+/*! When HOOMD-blue is built with ENABLE_PAPI, the first call starts a PAPI event set with the
+    available events among total cycles, total instructions, and L2 and L3 cache misses. Counters
+    are only read on the thread that started the event set. Work that TBB distributes to other
+    threads is not counted.
+
+    Without ENABLE_PAPI, no counters are available.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT HardwareCounters
+    {
+    public:
+    //! Read the counters
+    /*! \param values Array of max_hardware_counters values to write the counters to
+        \returns false when no counters are available on the calling thread
+    */
+    static bool read(long long* values);
+
+    //! Get the names of the available counters, in the order that read() writes them
+    static const std::vector<std::string>& getNames();
+    };
+
+//! Accumulates the wall time, call count, and bytes moved of one operation
+/*! Every Action and the Communicator own an OperationTimer. ScopedOperationTimer measures the
+    walltime of each call and adds it to the timer.
+
+    Timers nest: when one timed operation calls another (e.g. a pair force computes its neighbor
+    list), the time spent in the inner operation is subtracted from the outer one. getWalltime()
+    returns this exclusive time so that the sum over all operations approximates the time of the
+    run loop. getInclusiveWalltime() includes the time of nested operations.
+
+    Operations that know how much data they read and write report it with addBytes(). The byte
+    counts are estimates of the minimum memory (or network) traffic, intended for roofline
+    analysis. Operations that do not report bytes leave the count at 0.
+
+    Times are measured on the host. GPU kernels execute asynchronously, so the GPU time of an
+    operation may be attributed to a later operation that waits on the device.
+
+    When HardwareCounters are available, the timer also accumulates the CPU hardware counters
+    over each call, excluding nested operations like the walltime.
+
+    The counters accumulate over the lifetime of the object. Take differences between two reads to
+    measure an interval.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT OperationTimer
+    {
+    public:
+    //! Construct a timer with all counters set to zero
+    OperationTimer() { }
+
+    //! Get the wall time spent in this operation, excluding nested operations (in seconds)
+    double getWalltime() const
+        {
+        return m_total_time - m_nested_time;
+        }
+
+    //! Get the wall time spent in this operation, including nested operations (in seconds)
+    double getInclusiveWalltime() const
+        {
+        return m_total_time;
+        }
+
+    //! Get the number of timed calls
+    uint64_t getCalls() const
+        {
+        return m_calls;
+        }
+
+    //! Get the number of bytes moved
+    uint64_t getBytes() const
+        {
+        return m_bytes;
+        }
+
+    //! Add to the number of bytes moved
+    void addBytes(uint64_t bytes)
+        {
+        m_bytes += bytes;
+        }
+
+    //! Get the hardware counters, excluding nested operations
+    /*! \returns One value for each name in HardwareCounters::getNames()
+     */
+    std::vector<uint64_t> getHardwareCounters() const
+        {
+        std::vector<uint64_t> counters(HardwareCounters::getNames().size());
+        for (unsigned int k = 0; k < counters.size(); k++)
+            counters[k] = m_counters[k] - m_nested_counters[k];
+        return counters;
+        }
+
+    //! Reset all counters to zero
+    void reset()
+        {
+        m_total_time = 0.0;
+        m_nested_time = 0.0;
+        m_calls = 0;
+        m_bytes = 0;
+        for (unsigned int k = 0; k < max_hardware_counters; k++)
+            {
+            m_counters[k] = 0;
+            m_nested_counters[k] = 0;
+            }
+        }
+
+    private:
+    friend class ScopedOperationTimer;
+
+    double m_total_time = 0.0;  //!< Time spent in the operation (seconds)
+    double m_nested_time = 0.0; //!< Time spent in nested timed operations (seconds)
+    uint64_t m_calls = 0;       //!< Number of timed calls
+    uint64_t m_bytes = 0;       //!< Number of bytes moved
+    std::string m_name;         //!< Demangled class name, used to label profiler ranges
+
+    uint64_t m_counters[max_hardware_counters] = {};        //!< Hardware counters
+    uint64_t m_nested_counters[max_hardware_counters] = {}; //!< Counters of nested operations
+    };
+
+//! Times the enclosing scope and adds the result to an OperationTimer
+/*! Construct a ScopedOperationTimer at the start of the code to time. When it goes out of scope,
+    the elapsed time is added to the timer and subtracted from the enclosing ScopedOperationTimer
+    (if any) on the same thread.
+
+    When HOOMD-blue is built with ENABLE_NVTOOLS, ScopedOperationTimer also pushes an NVTX range
+    named after the class of the timed object, so that the operations appear by name in Nsight
+    Systems timelines.
+
+    \ingroup utils
+*/
+class PYBIND11_EXPORT ScopedOperationTimer
+    {
+    public:
+    //! Start timing
+    /*! \param timer Timer to add the elapsed time to
+        \param type Type of the timed object, used to name the profiler range
+    */
+    ScopedOperationTimer(OperationTimer& timer, const std::type_info& type)
+        : m_timer(timer), m_parent(s_current)
+        {
+        s_current = this;
+
+#ifdef ENABLE_NVTOOLS
+        if (m_timer.m_name.empty())
+            m_timer.m_name = demangle(type);
+        nvtxRangePushA(m_timer.m_name.c_str());
+#endif
+
+        m_counting = HardwareCounters::read(m_start_counters);
+        m_start = std::chrono::steady_clock::now();
+        }
+
+    //! Stop timing and accumulate the elapsed time
+    ~ScopedOperationTimer()
+        {
+        double elapsed
+            = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start).count();
+
+        long long end_counters[max_hardware_counters];
+        if (m_counting && HardwareCounters::read(end_counters))
+            {
+            for (unsigned int k = 0; k < max_hardware_counters; k++)
+                {
+                uint64_t delta = uint64_t(end_counters[k] - m_start_counters[k]);
+                m_timer.m_counters[k] += delta;
+                if (m_parent)
+                    m_parent->m_timer.m_nested_counters[k] += delta;
+                }
+            }
+
+#ifdef ENABLE_NVTOOLS
+        nvtxRangePop();
+#endif
+
+        m_timer.m_total_time += elapsed;
+        m_timer.m_calls++;
+        if (m_parent)
+            m_parent->m_timer.m_nested_time += elapsed;
+        s_current = m_parent;
+        }
+
+    ScopedOperationTimer(const ScopedOperationTimer&) = delete;
+    ScopedOperationTimer& operator=(const ScopedOperationTimer&) = delete;
+
+    //! Get a human readable name of a type
+    static std::string demangle(const std::type_info& type);
+
+    private:
+    OperationTimer& m_timer;                             //!< Timer to accumulate into
+    ScopedOperationTimer* m_parent;                      //!< Enclosing timer on this thread
+    std::chrono::steady_clock::time_point m_start;       //!< Time at construction
+    long long m_start_counters[max_hardware_counters];   //!< Hardware counters at construction
+    bool m_counting;                                     //!< True when the counters were read
+    static thread_local ScopedOperationTimer* s_current; //!< Innermost timer on this thread
+    };
+
+namespace detail
+    {
+//! Exports the OperationTimer class to python
+void export_OperationTimer(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace hoomd
@@ -25,6 +25,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <stdlib.h>
+#include <unordered_set>
 
 using namespace std;
 
@@ -718,6 +719,63 @@ void ParticleData::resize(unsigned int new_nparticles)
     m_nparticles = new_nparticles;
     }
 
+/*! \returns The number of bytes allocated for the per-particle arrays, including the alternate
+    arrays and the reverse tag lookup table
+*/
+size_t ParticleData::getMemoryUsage() const
+    {
+    size_t bytes = m_pos.getNumElements() * sizeof(Scalar4)
+                   + m_vel.getNumElements() * sizeof(Scalar4)
+                   + m_accel.getNumElements() * sizeof(Scalar3)
+                   + m_charge.getNumElements() * sizeof(Scalar)
+                   + m_diameter.getNumElements() * sizeof(Scalar)
+                   + m_image.getNumElements() * sizeof(int3)
+                   + m_tag.getNumElements() * sizeof(unsigned int)
+                   + m_body.getNumElements() * sizeof(unsigned int)
+                   + m_orientation.getNumElements() * sizeof(Scalar4)
+                   + m_angmom.getNumElements() * sizeof(Scalar4)
+                   + m_inertia.getNumElements() * sizeof(Scalar3)
+                   + m_net_force.getNumElements() * sizeof(Scalar4)
+                   + m_net_virial.getNumElements() * sizeof(Scalar)
+                   + m_net_torque.getNumElements() * sizeof(Scalar4)
+                   + m_comm_flags.getNumElements() * sizeof(unsigned int)
+                   + m_rtag.getNumElements() * sizeof(unsigned int);
+
+    // the alternate arrays are swapped in by the particle sorter and the integrators
+    if (!m_pos_alt.isNull())
+        bytes += m_pos_alt.getNumElements() * sizeof(Scalar4)
+                 + m_vel_alt.getNumElements() * sizeof(Scalar4)
+                 + m_accel_alt.getNumElements() * sizeof(Scalar3)
+                 + m_charge_alt.getNumElements() * sizeof(Scalar)
+                 + m_diameter_alt.getNumElements() * sizeof(Scalar)
+                 + m_image_alt.getNumElements() * sizeof(int3)
+                 + m_tag_alt.getNumElements() * sizeof(unsigned int)
+                 + m_body_alt.getNumElements() * sizeof(unsigned int)
+                 + m_orientation_alt.getNumElements() * sizeof(Scalar4)
+                 + m_angmom_alt.getNumElements() * sizeof(Scalar4)
+                 + m_inertia_alt.getNumElements() * sizeof(Scalar3)
+                 + m_net_force_alt.getNumElements() * sizeof(Scalar4)
+                 + m_net_virial_alt.getNumElements() * sizeof(Scalar)
+                 + m_net_torque_alt.getNumElements() * sizeof(Scalar4);
+
+    return bytes;
+    }
+
+/*! Particle data arrays grow with amortized resizing and never shrink on their own. After a
+    transient increase in the number of local particles (e.g. particles that migrated into this
+    domain), compactMemory() releases the unused capacity. Classes that hold per-particle arrays
+    resize them in response to the maximum particle number signal.
+*/
+void ParticleData::compactMemory()
+    {
+    if (!m_arrays_allocated)
+        return;
+
+    unsigned int max_n = std::max(m_nparticles + m_nghosts, 1u);
+    if (max_n < m_max_nparticles)
+        reallocate(max_n);
+    }
+
 /*! \param max_n new maximum size of particle data arrays (can be greater or smaller than the
  * current maximum size) To inform classes that allocate arrays for per-particle information of the
  * change of the particle data size, this method issues a m_max_particle_num_signal.emit().
@@ -930,12 +988,41 @@ void ParticleData::maybe_rebuild_tag_cache()
     m_invalid_cached_tags = false;
     }
 
+/*! \param array Scalar4 per-particle array
+    \param cache Structure of arrays cache of \a array to rebuild if necessary
+*/
+void ParticleData::maybeRebuildSoA(const GlobalArray<Scalar4>& array, soa_cache& cache)
+    {
+    const unsigned int n = getN() + getNGhosts();
+    if (cache.valid && cache.write_generation == array.getWriteGeneration() && cache.n == n)
+        return;
+
+    cache.data.x.resize(n);
+    cache.data.y.resize(n);
+    cache.data.z.resize(n);
+    cache.data.w.resize(n);
+
+    ArrayHandle<Scalar4> h_array(array, access_location::host, access_mode::read);
+    for (unsigned int i = 0; i < n; ++i)
+        {
+        const Scalar4 v = h_array.data[i];
+        cache.data.x[i] = v.x;
+        cache.data.y[i] = v.y;
+        cache.data.z[i] = v.z;
+        cache.data.w[i] = v.w;
+        }
+
+    cache.write_generation = array.getWriteGeneration();
+    cache.n = n;
+    cache.valid = true;
+    }
+
 /*! \return true If and only if all particles are in the simulation box
  */
 template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>& snap)
     {
     bool in_box = true;
-    if (m_exec_conf->getRank() == 0)
+    if (m_exec_conf->getRank() == 0 || snap.is_distributed)
         {
         Scalar3 lo = m_global_box->getLo();
         Scalar3 hi = m_global_box->getHi();
@@ -961,7 +1048,16 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
             }
         }
 #ifdef ENABLE_MPI
-    if (m_decomposition)
+    if (m_decomposition && snap.is_distributed)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &in_box,
+                      1,
+                      MPI_C_BOOL,
+                      MPI_LAND,
+                      m_exec_conf->getMPICommunicator());
+        }
+    else if (m_decomposition)
         {
         bcast(in_box, 0, m_exec_conf->getMPICommunicator());
         }
@@ -969,6 +1065,36 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
     return in_box;
     }
 
+#ifdef ENABLE_MPI
+//! Send per-rank values to their ranks
+/*! \param in_values Values for each rank
+    \param out_values Output: Values received by this rank
+    \param distributed True when every rank sends values, false when only \a root does
+    \param root The sending rank when \a distributed is false
+    \param mpi_comm The MPI communicator
+*/
+template<typename T>
+static void distributeToRanks(const std::vector<std::vector<T>>& in_values,
+                              std::vector<T>& out_values,
+                              bool distributed,
+                              unsigned int root,
+                              const MPI_Comm mpi_comm)
+    {
+    if (!distributed)
+        {
+        scatter_v(in_values, out_values, root, mpi_comm);
+        return;
+        }
+
+    // values from the lower ranks come first
+    std::vector<std::vector<T>> received;
+    all_to_all_v(in_values, received, mpi_comm);
+    out_values.clear();
+    for (const auto& values : received)
+        out_values.insert(out_values.end(), values.begin(), values.end());
+    }
+#endif
+
 //! Initialize from a snapshot
 /*! \param snapshot the initial particle data
     \param ignore_bodies If True, ignore particles that have a body flag set
@@ -977,6 +1103,10 @@ template<class Real> bool ParticleData::inBox(const SnapshotParticleData<Real>&
 
     \pre In parallel simulations, the local box size must be set before a call to
    initializeFromSnapshot().
+
+    When snapshot.is_distributed is set, every rank holds a slice of the particles. Each rank
+    places its own particles into the domains and exchanges them with all other ranks, so that no
+    rank holds more than its slice and its domain.
  */
 template<class Real>
 void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snapshot,
@@ -994,7 +1124,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
     removeAllGhostParticles();
 
     // check that all fields in the snapshot have correct length
-    if (m_exec_conf->getRank() == 0)
+    if (m_exec_conf->getRank() == 0 || snapshot.is_distributed)
         {
         snapshot.validate();
         }
@@ -1038,6 +1168,24 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         unsigned int size = m_exec_conf->getNRanks();
         unsigned int my_rank = m_exec_conf->getRank();
 
+        // in a distributed snapshot, every rank places its own particles and sends them to their
+        // domains, the tags of its particles follow those on the lower ranks
+        const bool distributed = snapshot.is_distributed;
+        unsigned int tag_offset = 0;
+        if (distributed)
+            {
+            if (ignore_bodies)
+                {
+                throw std::runtime_error(
+                    "Cannot ignore rigid body constituents in a distributed snapshot.");
+                }
+
+            unsigned int local_size = snapshot.size;
+            MPI_Exscan(&local_size, &tag_offset, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+            if (my_rank == 0)
+                tag_offset = 0;
+            }
+
         pos_proc.resize(size);
         vel_proc.resize(size);
         accel_proc.resize(size);
@@ -1053,7 +1201,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         tag_proc.resize(size);
         N_proc.resize(size, 0);
 
-        if (my_rank == 0)
+        if (my_rank == 0 || distributed)
             {
             ArrayHandle<unsigned int> h_cart_ranks(m_decomposition->getCartRanks(),
                                                    access_location::host,
@@ -1149,7 +1297,7 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
                 orientation_proc[rank].push_back(quat_to_scalar4(snapshot.orientation[snap_idx]));
                 angmom_proc[rank].push_back(quat_to_scalar4(snapshot.angmom[snap_idx]));
                 inertia_proc[rank].push_back(vec_to_scalar3(snapshot.inertia[snap_idx]));
-                tag_proc[rank].push_back(nglobal++);
+                tag_proc[rank].push_back(tag_offset + nglobal++);
                 N_proc[rank]++;
 
                 // determine max typeid on root rank
@@ -1169,7 +1317,10 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         bcast(m_type_mapping, root, mpi_comm);
 
         // broadcast global number of particles
-        bcast(nglobal, root, mpi_comm);
+        if (distributed)
+            MPI_Allreduce(MPI_IN_PLACE, &nglobal, 1, MPI_UNSIGNED, MPI_SUM, mpi_comm);
+        else
+            bcast(nglobal, root, mpi_comm);
 
         // resize array for reverse-lookup tags
         m_rtag.resize(nglobal);
@@ -1190,22 +1341,25 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         std::vector<unsigned int> tag;
 
         // distribute particle data
-        scatter_v(pos_proc, pos, root, mpi_comm);
-        scatter_v(vel_proc, vel, root, mpi_comm);
-        scatter_v(accel_proc, accel, root, mpi_comm);
-        scatter_v(type_proc, type, root, mpi_comm);
-        scatter_v(mass_proc, mass, root, mpi_comm);
-        scatter_v(charge_proc, charge, root, mpi_comm);
-        scatter_v(diameter_proc, diameter, root, mpi_comm);
-        scatter_v(image_proc, image, root, mpi_comm);
-        scatter_v(body_proc, body, root, mpi_comm);
-        scatter_v(orientation_proc, orientation, root, mpi_comm);
-        scatter_v(angmom_proc, angmom, root, mpi_comm);
-        scatter_v(inertia_proc, inertia, root, mpi_comm);
-        scatter_v(tag_proc, tag, root, mpi_comm);
+        distributeToRanks(pos_proc, pos, distributed, root, mpi_comm);
+        distributeToRanks(vel_proc, vel, distributed, root, mpi_comm);
+        distributeToRanks(accel_proc, accel, distributed, root, mpi_comm);
+        distributeToRanks(type_proc, type, distributed, root, mpi_comm);
+        distributeToRanks(mass_proc, mass, distributed, root, mpi_comm);
+        distributeToRanks(charge_proc, charge, distributed, root, mpi_comm);
+        distributeToRanks(diameter_proc, diameter, distributed, root, mpi_comm);
+        distributeToRanks(image_proc, image, distributed, root, mpi_comm);
+        distributeToRanks(body_proc, body, distributed, root, mpi_comm);
+        distributeToRanks(orientation_proc, orientation, distributed, root, mpi_comm);
+        distributeToRanks(angmom_proc, angmom, distributed, root, mpi_comm);
+        distributeToRanks(inertia_proc, inertia, distributed, root, mpi_comm);
+        distributeToRanks(tag_proc, tag, distributed, root, mpi_comm);
 
         // distribute number of particles
-        scatter_v(N_proc, m_nparticles, root, mpi_comm);
+        if (distributed)
+            m_nparticles = (unsigned int)pos.size();
+        else
+            scatter_v(N_proc, m_nparticles, root, mpi_comm);
 
             {
             // reset all reverse lookup tags to NOT_LOCAL flag
@@ -1362,7 +1516,22 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
 // As a convenience, broadcast the values needed to evaluate the condition the same on all
 // ranks.
 #ifdef ENABLE_MPI
-    if (m_decomposition)
+    if (m_decomposition && snapshot.is_distributed)
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_typeid,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &snapshot_size,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+    else if (m_decomposition)
         {
         bcast(max_typeid, 0, m_exec_conf->getMPICommunicator());
         bcast(snapshot_size, 0, m_exec_conf->getMPICommunicator());
@@ -1378,6 +1547,112 @@ void ParticleData::initializeFromSnapshot(const SnapshotParticleData<Real>& snap
         }
     }
 
+//! Update the positions in place when they are the only change in the snapshot
+/*! \param snapshot the new particle data
+
+    \returns true when the particle data was updated, false when the snapshot differs from the
+    current particle data in more than the positions and images
+
+    The positions and images are set when all other fields of the snapshot match the particle data
+    as takeSnapshot() would write them. Unlike initializeFromSnapshot(), this keeps the particle
+    order, the tags and the values that the snapshot can only hold in reduced precision. It emits
+    the particle sort signal, but not the change in the global number of particles, so the members
+    of particle groups and bonded groups remain valid.
+
+    Only implemented without domain decomposition and for contiguous tags, returns false
+    otherwise. The particle data is unchanged when the method returns false.
+ */
+template<class Real>
+bool ParticleData::updatePositionsFromSnapshot(const SnapshotParticleData<Real>& snapshot)
+    {
+#ifdef ENABLE_MPI
+    if (m_decomposition)
+        return false;
+#endif
+
+    if (snapshot.is_distributed || snapshot.size != m_nparticles
+        || snapshot.size != m_tag_set.size()
+        || (snapshot.size > 0 && getMaximumTag() != snapshot.size - 1)
+        || snapshot.type_mapping != m_type_mapping || snapshot.is_accel_set != m_accel_set)
+        {
+        return false;
+        }
+
+    snapshot.validate();
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_accel(m_accel, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_orientation,
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::read);
+        ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read);
+
+        auto same_vec3 = [](const vec3<Real>& a, Scalar x, Scalar y, Scalar z)
+        { return a.x == Real(x) && a.y == Real(y) && a.z == Real(z); };
+        auto same_quat = [](const quat<Real>& a, const Scalar4& b)
+        {
+            return a.s == Real(b.x) && a.v.x == Real(b.y) && a.v.y == Real(b.z)
+                   && a.v.z == Real(b.w);
+        };
+
+        // with contiguous tags, the snapshot index is the tag
+        for (unsigned int tag = 0; tag < snapshot.size; tag++)
+            {
+            const unsigned int idx = h_rtag.data[tag];
+            const Scalar4 vel = h_vel.data[idx];
+            const Scalar3 accel = h_accel.data[idx];
+            const Scalar3 inertia = h_inertia.data[idx];
+
+            if (snapshot.type[tag] != (unsigned int)__scalar_as_int(h_pos.data[idx].w)
+                || !same_vec3(snapshot.vel[tag], vel.x, vel.y, vel.z)
+                || snapshot.mass[tag] != Real(vel.w)
+                || !same_vec3(snapshot.accel[tag], accel.x, accel.y, accel.z)
+                || snapshot.charge[tag] != Real(h_charge.data[idx])
+                || snapshot.diameter[tag] != Real(h_diameter.data[idx])
+                || snapshot.body[tag] != h_body.data[idx]
+                || !same_quat(snapshot.orientation[tag], h_orientation.data[idx])
+                || !same_quat(snapshot.angmom[tag], h_angmom.data[idx])
+                || !same_vec3(snapshot.inertia[tag], inertia.x, inertia.y, inertia.z))
+                {
+                return false;
+                }
+            }
+        }
+
+    m_exec_conf->msg->notice(4) << "ParticleData: updating positions from snapshot" << std::endl;
+
+        {
+        ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::overwrite);
+        ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read);
+
+        for (unsigned int tag = 0; tag < snapshot.size; tag++)
+            {
+            const unsigned int idx = h_rtag.data[tag];
+            h_pos.data[idx].x = snapshot.pos[tag].x;
+            h_pos.data[idx].y = snapshot.pos[tag].y;
+            h_pos.data[idx].z = snapshot.pos[tag].z;
+            h_image.data[idx] = snapshot.image[tag];
+            }
+        }
+
+    // the snapshot positions are relative to the box, not the shifted origin
+    m_origin = make_scalar3(0, 0, 0);
+    m_o_image = make_int3(0, 0, 0);
+
+    // notify listeners that the particle data changed
+    notifyParticleSort();
+
+    return true;
+    }
+
 //! take a particle data snapshot
 /* \param snapshot The snapshot to write to
    \returns a map to lookup the snapshot index from a particle tag
@@ -2430,59 +2705,68 @@ void ParticleData::setMomentsOfInertia(unsigned int tag, const Scalar3& inertia)
  */
 unsigned int ParticleData::addParticle(unsigned int type)
     {
+    return addParticlesByType(std::vector<unsigned int>(1, type))[0];
+    }
+
+/*! \param types Type of each particle to add
+    \returns the unique tags of the newly added particles, in the order of \a types
+
+    Adding a batch of particles is equivalent to calling addParticle() for each of them, but the
+    ghost particles are removed, the arrays are resized, and the subscribers are notified only
+    once per batch.
+*/
+std::vector<unsigned int> ParticleData::addParticlesByType(const std::vector<unsigned int>& types)
+    {
+    const unsigned int n_add = static_cast<unsigned int>(types.size());
+    std::vector<unsigned int> tags(n_add);
+    if (n_add == 0)
+        return tags;
+
     // we are changing the local number of particles, so remove ghosts
     removeAllGhostParticles();
 
-    // the global tag of the newly created particle
-    unsigned int tag;
-
-    // first check if we can recycle a deleted tag
-    if (m_recycled_tags.size())
-        {
-        tag = m_recycled_tags.top();
-        m_recycled_tags.pop();
-        }
-    else
+    for (unsigned int i = 0; i < n_add; i++)
         {
-        // Otherwise, generate a new tag
-        tag = getNGlobal();
+        // first check if we can recycle a deleted tag
+        if (m_recycled_tags.size())
+            {
+            tags[i] = m_recycled_tags.top();
+            m_recycled_tags.pop();
+            }
+        else
+            {
+            // Otherwise, generate a new tag
+            tags[i] = getNGlobal() + i;
+            }
 
-        assert(m_rtag.size() == getNGlobal());
+        // add to set of active tags
+        m_tag_set.insert(tags[i]);
         }
 
-    // add to set of active tags
-    m_tag_set.insert(tag);
-
     // invalidate the active tag cache
     m_invalid_cached_tags = true;
 
     // resize array of global reverse lookup tags
     m_rtag.resize(getMaximumTag() + 1);
 
+    const unsigned int old_nparticles = getN();
         {
-        // update reverse-lookup table
+        // update reverse-lookup table, we add the particles at the end on rank 0
         ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::readwrite);
-        assert((h_rtag.data[tag] = NOT_LOCAL));
-        if (m_exec_conf->getRank() == 0)
-            {
-            // we add the particle at the end
-            h_rtag.data[tag] = getN();
-            }
-        else
+        for (unsigned int i = 0; i < n_add; i++)
             {
-            // not on this processor
-            h_rtag.data[tag] = NOT_LOCAL;
+            if (m_exec_conf->getRank() == 0)
+                h_rtag.data[tags[i]] = old_nparticles + i;
+            else
+                h_rtag.data[tags[i]] = NOT_LOCAL;
             }
         }
 
-    assert(tag <= m_recycled_tags.size() + getNGlobal());
-
     if (m_exec_conf->getRank() == 0)
         {
         // resize particle data using amortized O(1) array resizing
         // and update particle number
-        unsigned int old_nparticles = getN();
-        resize(old_nparticles + 1);
+        resize(old_nparticles + n_add);
 
         // access particle data arrays
         ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
@@ -2512,154 +2796,196 @@ unsigned int ParticleData::addParticle(unsigned int type)
                                               access_location::host,
                                               access_mode::readwrite);
 
-        unsigned int idx = old_nparticles;
-
-        // initialize to some sensible default values
-        h_pos.data[idx] = make_scalar4(0, 0, 0, __int_as_scalar(type));
-        h_vel.data[idx] = make_scalar4(0, 0, 0, 1.0);
-        h_accel.data[idx] = make_scalar3(0, 0, 0);
-        h_charge.data[idx] = 0.0;
-        h_diameter.data[idx] = 1.0;
-        h_image.data[idx] = make_int3(0, 0, 0);
-        h_angmom.data[idx] = make_scalar4(0, 0, 0, 0);
-        h_inertia.data[idx] = make_scalar3(0, 0, 0);
-        h_body.data[idx] = NO_BODY;
-        h_orientation.data[idx] = make_scalar4(1.0, 0.0, 0.0, 0.0);
-        h_tag.data[idx] = tag;
-        h_comm_flag.data[idx] = 0;
+        for (unsigned int i = 0; i < n_add; i++)
+            {
+            unsigned int idx = old_nparticles + i;
+
+            // initialize to some sensible default values
+            h_pos.data[idx] = make_scalar4(0, 0, 0, __int_as_scalar(types[i]));
+            h_vel.data[idx] = make_scalar4(0, 0, 0, 1.0);
+            h_accel.data[idx] = make_scalar3(0, 0, 0);
+            h_charge.data[idx] = 0.0;
+            h_diameter.data[idx] = 1.0;
+            h_image.data[idx] = make_int3(0, 0, 0);
+            h_angmom.data[idx] = make_scalar4(0, 0, 0, 0);
+            h_inertia.data[idx] = make_scalar3(0, 0, 0);
+            h_body.data[idx] = NO_BODY;
+            h_orientation.data[idx] = make_scalar4(1.0, 0.0, 0.0, 0.0);
+            h_tag.data[idx] = tags[i];
+            h_comm_flag.data[idx] = 0;
+            }
         }
 
     // update global number of particles
-    setNGlobal(getNGlobal() + 1);
+    setNGlobal(getNGlobal() + n_add);
 
-    // we have added a particle, notify listeners
+    // we have added particles, notify listeners
     notifyParticleSort();
 
-    return tag;
+    return tags;
     }
 
 /*! \param tag Tag of particle to remove
  */
 void ParticleData::removeParticle(unsigned int tag)
     {
-    if (getNGlobal() == 0)
+    removeParticlesByTag(std::vector<unsigned int>(1, tag));
+    }
+
+/*! \param tags Tags of the particles to remove
+
+    Removing a batch of particles is equivalent to calling removeParticle() for each of them, but
+    the ghost particles are removed, the particles are located on the ranks, the arrays are
+    resized, and the subscribers are notified only once per batch. Each removed particle is
+    replaced by the last local particle, so the arrays remain compact.
+*/
+void ParticleData::removeParticlesByTag(const std::vector<unsigned int>& tags)
+    {
+    const unsigned int n_remove = static_cast<unsigned int>(tags.size());
+    if (n_remove == 0)
+        return;
+
+    if (getNGlobal() < n_remove)
         {
-        throw runtime_error("Trying to remove particle when there are zero particles!");
+        throw runtime_error("Trying to remove more particles than there are in the system!");
         }
 
     // we are changing the local number of particles, so remove ghosts
     removeAllGhostParticles();
 
-    // sanity check
-    if (tag >= m_rtag.size())
+    // local particle number after the removal
+    unsigned int size = getN();
         {
-        std::ostringstream s;
-        s << "Trying to remove particle " << tag << " which does not exist.";
-        throw runtime_error(s.str());
-        }
+        ArrayHandle<unsigned int> h_rtag(getRTags(), access_location::host, access_mode::readwrite);
 
-    // Local particle index
-    unsigned int idx = m_rtag[tag];
+        // sanity check and find the local particles
+        std::vector<int> is_local(n_remove);
+        std::unordered_set<unsigned int> batch_tags;
+        for (unsigned int i = 0; i < n_remove; i++)
+            {
+            const unsigned int tag = tags[i];
+            if (tag >= m_rtag.size())
+                {
+                std::ostringstream s;
+                s << "Trying to remove particle " << tag << " which does not exist.";
+                throw runtime_error(s.str());
+                }
+            if (!batch_tags.insert(tag).second)
+                {
+                std::ostringstream s;
+                s << "Trying to remove particle " << tag << " more than once!";
+                throw runtime_error(s.str());
+                }
 
-    bool is_local = idx < getN();
-    assert(is_local || idx == NOT_LOCAL);
+            unsigned int idx = h_rtag.data[tag];
+            is_local[i] = idx < getN() ? 1 : 0;
+            assert(is_local[i] || idx == NOT_LOCAL);
+            }
 
-    bool is_available = is_local;
+        std::vector<int> is_available(is_local);
 
 #ifdef ENABLE_MPI
-    if (getDomainDecomposition())
-        {
-        int res = is_local ? 1 : 0;
-
-        // check that particle is local on some processor
-        MPI_Allreduce(MPI_IN_PLACE, &res, 1, MPI_INT, MPI_SUM, m_exec_conf->getMPICommunicator());
-
-        assert((unsigned int)res <= 1);
-        is_available = res;
-        }
+        if (getDomainDecomposition())
+            {
+            // check that each particle is local on some processor
+            MPI_Allreduce(MPI_IN_PLACE,
+                          is_available.data(),
+                          n_remove,
+                          MPI_INT,
+                          MPI_SUM,
+                          m_exec_conf->getMPICommunicator());
+            }
 #endif
 
-    if (!is_available)
-        {
-        std::ostringstream s;
-        s << "Trying to remove particle " << tag << " which has been previously removed!";
-        throw runtime_error(s.str());
-        }
-
-    // delete from map
-    m_rtag[tag] = NOT_LOCAL;
-
-    if (is_local)
-        {
-        unsigned int size = getN();
-
-        // If the particle is not the last element of the particle data, move the last element to
-        // to the position of the removed element
-        if (idx < (size - 1))
+        for (unsigned int i = 0; i < n_remove; i++)
             {
-            // access particle data arrays
-            ArrayHandle<Scalar4> h_pos(getPositions(),
+            assert((unsigned int)is_available[i] <= 1);
+            if (!is_available[i])
+                {
+                std::ostringstream s;
+                s << "Trying to remove particle " << tags[i]
+                  << " which has been previously removed!";
+                throw runtime_error(s.str());
+                }
+            }
+
+        // access particle data arrays
+        ArrayHandle<Scalar4> h_pos(getPositions(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(getVelocities(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar3> h_accel(getAccelerations(),
+                                     access_location::host,
+                                     access_mode::readwrite);
+        ArrayHandle<Scalar> h_charge(getCharges(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar> h_diameter(getDiameters(),
                                        access_location::host,
                                        access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel(getVelocities(),
+        ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
+        ArrayHandle<Scalar4> h_angmom(getAngularMomentumArray(),
+                                      access_location::host,
+                                      access_mode::readwrite);
+        ArrayHandle<Scalar3> h_inertia(getMomentsOfInertiaArray(),
                                        access_location::host,
                                        access_mode::readwrite);
-            ArrayHandle<Scalar3> h_accel(getAccelerations(),
-                                         access_location::host,
-                                         access_mode::readwrite);
-            ArrayHandle<Scalar> h_charge(getCharges(),
+        ArrayHandle<unsigned int> h_body(getBodies(),
                                          access_location::host,
                                          access_mode::readwrite);
-            ArrayHandle<Scalar> h_diameter(getDiameters(),
+        ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
-            ArrayHandle<int3> h_image(getImages(), access_location::host, access_mode::readwrite);
-            ArrayHandle<unsigned int> h_body(getBodies(),
-                                             access_location::host,
-                                             access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation(getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::readwrite);
-            ArrayHandle<unsigned int> h_tag(getTags(),
-                                            access_location::host,
-                                            access_mode::readwrite);
-            ArrayHandle<unsigned int> h_rtag(getRTags(),
-                                             access_location::host,
-                                             access_mode::readwrite);
-            ArrayHandle<unsigned int> h_comm_flag(m_comm_flags,
-                                                  access_location::host,
-                                                  access_mode::readwrite);
-
-            h_pos.data[idx] = h_pos.data[size - 1];
-            h_vel.data[idx] = h_vel.data[size - 1];
-            h_accel.data[idx] = h_accel.data[size - 1];
-            h_charge.data[idx] = h_charge.data[size - 1];
-            h_diameter.data[idx] = h_diameter.data[size - 1];
-            h_image.data[idx] = h_image.data[size - 1];
-            h_body.data[idx] = h_body.data[size - 1];
-            h_orientation.data[idx] = h_orientation.data[size - 1];
-            h_tag.data[idx] = h_tag.data[size - 1];
-            h_comm_flag.data[idx] = h_comm_flag.data[size - 1];
-
-            unsigned int last_tag = h_tag.data[size - 1];
-            h_rtag.data[last_tag] = idx;
-            }
+        ArrayHandle<unsigned int> h_tag(getTags(), access_location::host, access_mode::readwrite);
+        ArrayHandle<unsigned int> h_comm_flag(m_comm_flags,
+                                              access_location::host,
+                                              access_mode::readwrite);
 
-        // update particle number
-        resize(getN() - 1);
-        }
+        for (unsigned int i = 0; i < n_remove; i++)
+            {
+            const unsigned int tag = tags[i];
+
+            // remove from set of active tags
+            m_tag_set.erase(tag);
+
+            // maintain a stack of deleted tags for future recycling
+            m_recycled_tags.push(tag);
+
+            if (!is_local[i])
+                continue;
+
+            // the index changes when an earlier particle in the batch moved the last element here
+            unsigned int idx = h_rtag.data[tag];
+            h_rtag.data[tag] = NOT_LOCAL;
 
-    // remove from set of active tags
-    m_tag_set.erase(tag);
+            // If the particle is not the last element of the particle data, move the last element
+            // to the position of the removed element
+            if (idx < (size - 1))
+                {
+                h_pos.data[idx] = h_pos.data[size - 1];
+                h_vel.data[idx] = h_vel.data[size - 1];
+                h_accel.data[idx] = h_accel.data[size - 1];
+                h_charge.data[idx] = h_charge.data[size - 1];
+                h_diameter.data[idx] = h_diameter.data[size - 1];
+                h_image.data[idx] = h_image.data[size - 1];
+                h_angmom.data[idx] = h_angmom.data[size - 1];
+                h_inertia.data[idx] = h_inertia.data[size - 1];
+                h_body.data[idx] = h_body.data[size - 1];
+                h_orientation.data[idx] = h_orientation.data[size - 1];
+                h_tag.data[idx] = h_tag.data[size - 1];
+                h_comm_flag.data[idx] = h_comm_flag.data[size - 1];
+
+                unsigned int last_tag = h_tag.data[size - 1];
+                h_rtag.data[last_tag] = idx;
+                }
+            size--;
+            }
+        }
 
-    // maintain a stack of deleted group tags for future recycling
-    m_recycled_tags.push(tag);
+    // update particle number
+    resize(size);
 
     // invalidate active tag cache
     m_invalid_cached_tags = true;
 
     // update global particle number
-    setNGlobal(getNGlobal() - 1);
+    setNGlobal(getNGlobal() - n_remove);
 
     // local particle number may have changed
     notifyParticleSort();
@@ -2745,6 +3071,8 @@ template ParticleData::ParticleData(const SnapshotParticleData<double>& snapshot
 template void
 ParticleData::initializeFromSnapshot<double>(const SnapshotParticleData<double>& snapshot,
                                              bool ignore_bodies);
+template bool
+ParticleData::updatePositionsFromSnapshot<double>(const SnapshotParticleData<double>& snapshot);
 template void ParticleData::takeSnapshot<double>(SnapshotParticleData<double>& snapshot);
 
 template ParticleData::ParticleData(const SnapshotParticleData<float>& snapshot,
@@ -2754,6 +3082,8 @@ template ParticleData::ParticleData(const SnapshotParticleData<float>& snapshot,
 template void
 ParticleData::initializeFromSnapshot<float>(const SnapshotParticleData<float>& snapshot,
                                             bool ignore_bodies);
+template bool
+ParticleData::updatePositionsFromSnapshot<float>(const SnapshotParticleData<float>& snapshot);
 template void ParticleData::takeSnapshot<float>(SnapshotParticleData<float>& snapshot);
 
 namespace detail
@@ -2775,6 +3105,9 @@ void export_ParticleData(pybind11::module& m)
         .def("setGlobalBox", setGlobalBox_overload)
         .def("getN", &ParticleData::getN)
         .def("getNGhosts", &ParticleData::getNGhosts)
+        .def("getMaxN", &ParticleData::getMaxN)
+        .def("getMemoryUsage", &ParticleData::getMemoryUsage)
+        .def("compactMemory", &ParticleData::compactMemory)
         .def("getNGlobal", &ParticleData::getNGlobal)
         .def("getNTypes", &ParticleData::getNTypes)
         .def("getMaxDiameter", &ParticleData::getMaxDiameter)
@@ -2825,7 +3158,8 @@ void export_ParticleData(pybind11::module& m)
 
 //! Constructor for SnapshotParticleData
 template<class Real>
-SnapshotParticleData<Real>::SnapshotParticleData(unsigned int N) : size(N), is_accel_set(false)
+SnapshotParticleData<Real>::SnapshotParticleData(unsigned int N)
+    : size(N), is_accel_set(false), is_distributed(false)
     {
     resize(N);
     }
@@ -3745,68 +4079,106 @@ void SnapshotParticleData<Real>::replicate(unsigned int nx,
                                            const BoxDim& old_box,
                                            const BoxDim& new_box)
     {
+    replicateImages(nx, ny, nz, old_box, new_box, 0, nx * ny * nz);
+    }
+
+/*! \param nx Number of times to replicate the system along the x direction
+    \param ny Number of times to replicate the system along the y direction
+    \param nz Number of times to replicate the system along the z direction
+    \param old_box Old box dimensions
+    \param new_box Dimensions of replicated box
+    \param image_begin First image to keep
+    \param image_end One past the last image to keep
+
+    Image j = (l * ny + m) * nz + n holds the copies at lattice offset (l, m, n). The snapshot keeps
+    only the images [image_begin, image_end) in image order. Particle k of image j has the tag
+    j * old_size + k in the full replicated system, and the body ids refer to those tags.
+*/
+template<class Real>
+void SnapshotParticleData<Real>::replicateImages(unsigned int nx,
+                                                 unsigned int ny,
+                                                 unsigned int nz,
+                                                 const BoxDim& old_box,
+                                                 const BoxDim& new_box,
+                                                 unsigned int image_begin,
+                                                 unsigned int image_end)
+    {
+    assert(image_begin <= image_end && image_end <= nx * ny * nz);
     unsigned int old_size = size;
 
-    // resize snapshot
-    resize(old_size * nx * ny * nz);
+    // the images after the first overwrite the unit cell, copy the body ids they are offset from
+    const std::vector<unsigned int> old_body(body.begin(), body.begin() + old_size);
+
+    for (unsigned int i = 0; i < old_size; ++i)
+        {
+        if (image_end > image_begin && old_body[i] < MIN_FLOPPY
+            && size_t(image_end - 1) * old_size + old_body[i] >= size_t(MIN_FLOPPY))
+            throw std::runtime_error("Replication would create more distinct rigid "
+                                     "bodies than HOOMD supports!");
+        }
+
+    // resize snapshot, keeping the unit cell in the first old_size entries
+    const unsigned int n_images = image_end - image_begin;
+    SnapshotParticleData<Real> unit_cell;
+    if (image_begin != 0)
+        unit_cell = *this;
+    const SnapshotParticleData<Real>& src = image_begin != 0 ? unit_cell : *this;
+    resize(old_size * std::max(n_images, 1u));
 
     for (unsigned int i = 0; i < old_size; ++i)
         {
         // unwrap position of particle i in old box using image flags
-        vec3<Real> p = pos[i];
-        int3 img = image[i];
+        vec3<Real> p = src.pos[i];
+        int3 img = src.image[i];
 
         // need to cast to a scalar and back because the Box is in Scalars, but we might be in a
         // different type
         p = vec3<Real>(old_box.shift(vec3<Scalar>(p), img));
         vec3<Real> f = old_box.makeFraction(p);
 
-        unsigned int j = 0;
-        for (unsigned int l = 0; l < nx; l++)
-            for (unsigned int m = 0; m < ny; m++)
-                for (unsigned int n = 0; n < nz; n++)
-                    {
-                    Scalar3 f_new;
-                    // replicate particle
-                    f_new.x = f.x / (Real)nx + (Real)l / (Real)nx;
-                    f_new.y = f.y / (Real)ny + (Real)m / (Real)ny;
-                    f_new.z = f.z / (Real)nz + (Real)n / (Real)nz;
-
-                    unsigned int k = j * old_size + i;
-
-                    // coordinates in new box
-                    Scalar3 q = new_box.makeCoordinates(f_new);
-
-                    // wrap by multiple box vectors if necessary
-                    image[k] = new_box.getImage(q);
-                    int3 negimg = make_int3(-image[k].x, -image[k].y, -image[k].z);
-                    q = new_box.shift(q, negimg);
-
-                    // rewrap using wrap so that rounding is consistent
-                    new_box.wrap(q, image[k]);
-
-                    pos[k] = vec3<Real>(q);
-                    vel[k] = vel[i];
-                    accel[k] = accel[i];
-                    type[k] = type[i];
-                    mass[k] = mass[i];
-                    charge[k] = charge[i];
-                    diameter[k] = diameter[i];
-                    // This math also accounts for floppy bodies since body[i]
-                    // is already greater than MIN_FLOPPY, so the new body id
-                    // body[k] is guaranteed to be so as well. However, we
-                    // check to ensure that something that wasn't originally a
-                    // floppy body doesn't overflow into the floppy body tags.
-                    body[k] = (body[i] != NO_BODY ? j * old_size + body[i] : NO_BODY);
-                    if (body[i] < MIN_FLOPPY && body[k] >= MIN_FLOPPY)
-                        throw std::runtime_error("Replication would create more distinct rigid "
-                                                 "bodies than HOOMD supports!");
-                    orientation[k] = orientation[i];
-                    angmom[k] = angmom[i];
-                    inertia[k] = inertia[i];
-                    j++;
-                    }
+        for (unsigned int j = image_begin; j < image_end; j++)
+            {
+            const unsigned int l = j / (ny * nz);
+            const unsigned int m = (j / nz) % ny;
+            const unsigned int n = j % nz;
+
+            Scalar3 f_new;
+            // replicate particle
+            f_new.x = f.x / (Real)nx + (Real)l / (Real)nx;
+            f_new.y = f.y / (Real)ny + (Real)m / (Real)ny;
+            f_new.z = f.z / (Real)nz + (Real)n / (Real)nz;
+
+            unsigned int k = (j - image_begin) * old_size + i;
+
+            // coordinates in new box
+            Scalar3 q = new_box.makeCoordinates(f_new);
+
+            // wrap by multiple box vectors if necessary
+            image[k] = new_box.getImage(q);
+            int3 negimg = make_int3(-image[k].x, -image[k].y, -image[k].z);
+            q = new_box.shift(q, negimg);
+
+            // rewrap using wrap so that rounding is consistent
+            new_box.wrap(q, image[k]);
+
+            pos[k] = vec3<Real>(q);
+            vel[k] = src.vel[i];
+            accel[k] = src.accel[i];
+            type[k] = src.type[i];
+            mass[k] = src.mass[i];
+            charge[k] = src.charge[i];
+            diameter[k] = src.diameter[i];
+            // This math also accounts for floppy bodies since body[i]
+            // is already greater than MIN_FLOPPY, so the new body id
+            // body[k] is guaranteed to be so as well.
+            body[k] = (old_body[i] != NO_BODY ? j * old_size + old_body[i] : NO_BODY);
+            orientation[k] = src.orientation[i];
+            angmom[k] = src.angmom[i];
+            inertia[k] = src.inertia[i];
+            }
         }
+
+    resize(old_size * n_images);
     }
 
 template<class Real>
@@ -133,7 +133,7 @@ std::string getDefaultTypeName(unsigned int id);
 template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
     {
     //! Empty snapshot
-    SnapshotParticleData() : size(0), is_accel_set(false) { }
+    SnapshotParticleData() : size(0), is_accel_set(false), is_distributed(false) { }
 
     //! constructor
     /*! \param N number of particles to allocate memory for
@@ -192,6 +192,15 @@ template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
                    const BoxDim& old_box,
                    const BoxDim& new_box);
 
+    //! Replicate this snapshot and keep a contiguous range of the images
+    void replicateImages(unsigned int nx,
+                         unsigned int ny,
+                         unsigned int nz,
+                         const BoxDim& old_box,
+                         const BoxDim& new_box,
+                         unsigned int image_begin,
+                         unsigned int image_end);
+
     //! Get pos as a Python object
     static pybind11::object getPosNP(pybind11::object self);
     //! Get vel as a Python object
@@ -239,6 +248,12 @@ template<class Real> struct PYBIND11_EXPORT SnapshotParticleData
     std::vector<std::string> type_mapping; //!< Mapping between particle type ids and names
 
     bool is_accel_set; //!< Flag indicating if accel is set
+
+    //! Flag indicating that every rank holds a slice of the particles
+    /*! The particles of rank r follow those of rank r - 1 in tag order. Only
+        ParticleData::initializeFromSnapshot() accepts distributed snapshots.
+    */
+    bool is_distributed;
     };
 
 namespace detail
@@ -264,6 +279,18 @@ struct pdata_element
     Scalar net_virial[6]; //!< net virial
     };
 
+//! Structure of arrays copy of a Scalar4 per-particle array
+/* Host loops that stream one component at a time (e.g. to vectorize over particles) read the
+   components from separate contiguous arrays instead of strided from the Scalar4 array.
+ */
+struct scalar4_soa
+    {
+    std::vector<Scalar> x; //!< x components
+    std::vector<Scalar> y; //!< y components
+    std::vector<Scalar> z; //!< z components
+    std::vector<Scalar> w; //!< w components
+    };
+
     } // end namespace detail
 
 //! Manages all of the data arrays for the particles
@@ -479,6 +506,12 @@ class PYBIND11_EXPORT ParticleData
         return m_max_nparticles;
         }
 
+    //! Get the number of bytes allocated for the per-particle arrays
+    size_t getMemoryUsage() const;
+
+    //! Shrink the particle data arrays to the current number of local and ghost particles
+    void compactMemory();
+
     //! Get current number of ghost particles
     /*\ return Number of ghost particles
      */
@@ -603,6 +636,26 @@ class PYBIND11_EXPORT ParticleData
         return m_vel;
         }
 
+    //! Return a structure of arrays copy of the positions and types of local and ghost particles
+    /*! The copy is rebuilt lazily on the host when the position array has been acquired for writing
+        (or resized or swapped) since the last call, or when the number of particles changed.
+        The returned reference is invalidated by the next call.
+    */
+    const detail::scalar4_soa& getPositionsSoA()
+        {
+        maybeRebuildSoA(m_pos, m_pos_soa);
+        return m_pos_soa.data;
+        }
+
+    //! Return a structure of arrays copy of the velocities and masses of local and ghost particles
+    /*! \sa getPositionsSoA()
+     */
+    const detail::scalar4_soa& getVelocitiesSoA()
+        {
+        maybeRebuildSoA(m_vel, m_vel_soa);
+        return m_vel_soa.data;
+        }
+
     //! Return accelerations
     const GlobalArray<Scalar3>& getAccelerations() const
         {
@@ -1130,6 +1183,10 @@ class PYBIND11_EXPORT ParticleData
     void initializeFromSnapshot(const SnapshotParticleData<Real>& snapshot,
                                 bool ignore_bodies = false);
 
+    //! Update the positions in place when they are the only change in the snapshot
+    template<class Real>
+    bool updatePositionsFromSnapshot(const SnapshotParticleData<Real>& snapshot);
+
     //! Take a snapshot
     template<class Real> void takeSnapshot(SnapshotParticleData<Real>& snapshot);
 
@@ -1210,9 +1267,15 @@ class PYBIND11_EXPORT ParticleData
     //! Add a single particle to the simulation
     unsigned int addParticle(unsigned int type);
 
+    //! Add a batch of particles to the simulation
+    std::vector<unsigned int> addParticlesByType(const std::vector<unsigned int>& types);
+
     //! Remove a particle from the simulation
     void removeParticle(unsigned int tag);
 
+    //! Remove a batch of particles from the simulation
+    void removeParticlesByTag(const std::vector<unsigned int>& tags);
+
     //! Return the nth active global tag
     unsigned int getNthTag(unsigned int n);
 
@@ -1303,6 +1366,18 @@ class PYBIND11_EXPORT ParticleData
         m_cached_tag_set;       //!< Cached constant-time lookup table for tags by active index
     bool m_invalid_cached_tags; //!< true if m_cached_tag_set needs to be rebuilt
 
+    //! Structure of arrays cache of a Scalar4 array
+    struct soa_cache
+        {
+        detail::scalar4_soa data;      //!< The cached components
+        uint64_t write_generation = 0; //!< Write generation of the array when data was built
+        unsigned int n = 0;            //!< Number of particles in data
+        bool valid = false;            //!< True when data has been built
+        };
+
+    soa_cache m_pos_soa; //!< Structure of arrays cache of the positions
+    soa_cache m_vel_soa; //!< Structure of arrays cache of the velocities
+
     /* Alternate particle data arrays are provided for fast swapping in and out of particle data
        The size of these arrays is updated in sync with the main particle data arrays.
 
@@ -1364,6 +1439,9 @@ class PYBIND11_EXPORT ParticleData
     //! Helper function to rebuild the active tag cache if necessary
     void maybe_rebuild_tag_cache();
 
+    //! Helper function to rebuild a structure of arrays cache if necessary
+    void maybeRebuildSoA(const GlobalArray<Scalar4>& array, soa_cache& cache);
+
     //! Helper function to check that particles of a snapshot are in the box
     /*! \return true If and only if all particles are in the simulation box
      * \param Snapshot to check
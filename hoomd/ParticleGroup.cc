@@ -218,14 +218,26 @@ void ParticleGroup::updateMemberTags(bool force_update)
             }
 #endif
 
+        // sort member tags
+        std::sort(member_tags.begin(), member_tags.end());
+
+            {
+            // re-evaluating the filter often selects the same particles
+            ArrayHandle<unsigned int> h_member_tags(m_member_tags,
+                                                    access_location::host,
+                                                    access_mode::read);
+            if (m_member_tags.getNumElements() != member_tags.size()
+                || !std::equal(member_tags.begin(), member_tags.end(), h_member_tags.data))
+                {
+                m_membership_version++;
+                }
+            }
+
         // store member tags in GlobalArray
         GlobalArray<unsigned int> member_tags_array(member_tags.size(), m_pdata->getExecConf());
         m_member_tags.swap(member_tags_array);
         TAG_ALLOCATION(m_member_tags);
 
-        // sort member tags
-        std::sort(member_tags.begin(), member_tags.end());
-
             {
             ArrayHandle<unsigned int> h_member_tags(m_member_tags,
                                                     access_location::host,
@@ -257,6 +269,7 @@ void ParticleGroup::updateMemberTags(bool force_update)
 
     // count the number of central and free particles in the group
     // updateMemberTags cannot call any member function that would result in a checkRebuild() call
+    const unsigned int old_n_central_and_free_global = m_n_central_and_free_global;
     m_n_central_and_free_global = 0;
 
     ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
@@ -288,6 +301,11 @@ void ParticleGroup::updateMemberTags(bool force_update)
                       m_exec_conf->getMPICommunicator());
         }
 #endif
+
+    if (m_n_central_and_free_global != old_n_central_and_free_global)
+        {
+        m_membership_version++;
+        }
     }
 
 void ParticleGroup::reallocate()
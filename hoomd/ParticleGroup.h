@@ -189,6 +189,17 @@ class PYBIND11_EXPORT ParticleGroup
         return m_member_idx;
         }
 
+    //! Direct access to the sorted list of member tags
+    /*! \returns A GPUArray with the tags of all members of the group (on all ranks), in sorted
+        order. \note The caller \b must \b not write to or change the array.
+    */
+    const GlobalArray<unsigned int>& getMemberTagArray()
+        {
+        checkRebuild();
+
+        return m_member_tags;
+        }
+
 #ifdef ENABLE_HIP
     //! Return the load balancing GPU partition
     const GPUPartition& getGPUPartition()
@@ -228,6 +239,7 @@ class PYBIND11_EXPORT ParticleGroup
     void setTranslationalDOF(Scalar dof)
         {
         m_translational_dof = dof;
+        m_dof_version = m_membership_version;
         }
 
     /// Get the number translational degrees of freedom
@@ -240,6 +252,19 @@ class PYBIND11_EXPORT ParticleGroup
     void setRotationalDOF(Scalar dof)
         {
         m_rotational_dof = dof;
+        m_dof_version = m_membership_version;
+        }
+
+    /// Get a counter that increases each time the members of the group change
+    uint64_t getMembershipVersion() const
+        {
+        return m_membership_version;
+        }
+
+    /// Get the membership version the degrees of freedom were last set for
+    uint64_t getDOFVersion() const
+        {
+        return m_dof_version;
         }
 
     /// Get the number of degrees of freedom
@@ -320,6 +345,12 @@ class PYBIND11_EXPORT ParticleGroup
     /// Number of central and free particles in the group (global)
     unsigned int m_n_central_and_free_global = 0;
 
+    /// Incremented when the member tags or the number of central and free particles change
+    uint64_t m_membership_version = 1;
+
+    /// Value of m_membership_version when the degrees of freedom were last set
+    uint64_t m_dof_version = 0;
+
     //! Helper function to resize array of member tags
     void reallocate();
 
@@ -3,8 +3,263 @@
 
 #include "PythonLocalDataAccess.h"
 
+#include <memory>
+#include <stdexcept>
+
 namespace hoomd
     {
+#if ENABLE_HIP
+namespace
+    {
+// Minimal definitions of the DLPack ABI (https://github.com/dmlc/dlpack), version 0.8.
+
+//! DLPack device types
+enum DLDeviceType : int32_t
+    {
+    kDLCUDA = 2,
+    kDLROCM = 10
+    };
+
+//! DLPack data type codes
+enum DLDataTypeCode : uint8_t
+    {
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLBool = 6
+    };
+
+struct DLDevice
+    {
+    int32_t device_type; //!< DLDeviceType
+    int32_t device_id;   //!< Device ordinal
+    };
+
+struct DLDataType
+    {
+    uint8_t code;   //!< DLDataTypeCode
+    uint8_t bits;   //!< Number of bits per element
+    uint16_t lanes; //!< Number of lanes, 1 for scalars
+    };
+
+struct DLTensor
+    {
+    void* data;           //!< Device pointer
+    DLDevice device;      //!< Device that holds the data
+    int32_t ndim;         //!< Number of dimensions
+    DLDataType dtype;     //!< Element type
+    int64_t* shape;       //!< Shape of the tensor
+    int64_t* strides;     //!< Strides of the tensor in elements
+    uint64_t byte_offset; //!< Offset of the first element from data
+    };
+
+struct DLManagedTensor
+    {
+    DLTensor dl_tensor;                     //!< The tensor
+    void* manager_ctx;                      //!< Owner of the shape and strides
+    void (*deleter)(DLManagedTensor* self); //!< Called by the consumer to free the tensor
+    };
+
+//! Owner of a DLManagedTensor and its shape and strides
+struct DLPackContext
+    {
+    DLManagedTensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    };
+
+//! Throw an error when a HIP call fails
+void checkHIPError(hipError_t error, const char* action)
+    {
+    if (error != hipSuccess)
+        {
+        throw std::runtime_error(std::string("Failed to ") + action + ": "
+                                 + std::string(hipGetErrorString(error)));
+        }
+    }
+
+//! Convert a stream handle in the DLPack convention to a hipStream_t
+/*! 1 is the legacy default stream and 2 is the per thread default stream.
+ */
+hipStream_t getStream(intptr_t stream)
+    {
+    if (stream == 2)
+        {
+        return hipStreamPerThread;
+        }
+    if (stream == 1)
+        {
+        return 0;
+        }
+    return reinterpret_cast<hipStream_t>(stream);
+    }
+
+//! Make the stream \a waiting wait for the work queued on \a stream
+/*! Records an event on \a stream and enqueues a wait for it on \a waiting. Neither call blocks
+    the host.
+*/
+void streamWaitStream(hipStream_t waiting, hipStream_t stream)
+    {
+    hipEvent_t event;
+    checkHIPError(hipEventCreateWithFlags(&event, hipEventDisableTiming), "create event");
+    hipError_t error = hipEventRecord(event, stream);
+    if (error == hipSuccess)
+        {
+        error = hipStreamWaitEvent(waiting, event, 0);
+        }
+    // the event is released once the wait completes
+    hipEventDestroy(event);
+    checkHIPError(error, "wait for stream");
+    }
+
+//! Convert a buffer format descriptor to a DLPack data type
+DLDataType getDLDataType(const std::string& typestr)
+    {
+    switch (typestr.size() == 1 ? typestr[0] : 0)
+        {
+    case 'f':
+        return DLDataType {kDLFloat, 32, 1};
+    case 'd':
+        return DLDataType {kDLFloat, 64, 1};
+    case 'b':
+        return DLDataType {kDLInt, 8, 1};
+    case 'B':
+        return DLDataType {kDLUInt, 8, 1};
+    case 'h':
+        return DLDataType {kDLInt, 16, 1};
+    case 'H':
+        return DLDataType {kDLUInt, 16, 1};
+    case 'i':
+        return DLDataType {kDLInt, 32, 1};
+    case 'I':
+        return DLDataType {kDLUInt, 32, 1};
+    case 'l':
+    case 'q':
+        return DLDataType {kDLInt, 64, 1};
+    case 'L':
+    case 'Q':
+        return DLDataType {kDLUInt, 64, 1};
+    case '?':
+        return DLDataType {kDLBool, 8, 1};
+    default:
+        throw std::runtime_error("DLPack does not support the data type " + typestr + ".");
+        }
+    }
+
+//! Get the DLPack device of the given HIP device
+DLDevice getDLPackDeviceValue(int device_id)
+    {
+#ifdef __HIP_PLATFORM_NVCC__
+    return DLDevice {kDLCUDA, device_id};
+#else
+    return DLDevice {kDLROCM, device_id};
+#endif
+    }
+
+//! Free a DLManagedTensor
+void deleteDLManagedTensor(DLManagedTensor* self)
+    {
+    delete static_cast<DLPackContext*>(self->manager_ctx);
+    }
+
+//! Free the tensor of a capsule that no consumer took ownership of
+void deleteDLPackCapsule(PyObject* capsule)
+    {
+    if (PyCapsule_IsValid(capsule, "dltensor"))
+        {
+        auto tensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, "dltensor"));
+        tensor->deleter(tensor);
+        }
+    }
+
+    } // end anonymous namespace
+
+pybind11::capsule HOOMDDeviceBuffer::getDLPack(pybind11::object stream)
+    {
+    if (!stream.is_none())
+        {
+        intptr_t consumer_stream = stream.cast<intptr_t>();
+        if (consumer_stream == 0)
+            {
+            throw pybind11::value_error("stream=0 is ambiguous, use 1 or 2 instead.");
+            }
+        // -1 requests no synchronization, 1 is HOOMD's stream
+        if (consumer_stream != -1 && consumer_stream != 1)
+            {
+            streamWaitStream(getStream(consumer_stream), 0);
+            }
+        }
+
+    auto context = std::make_unique<DLPackContext>();
+    DLDataType dtype = getDLDataType(m_typestr);
+    size_t itemsize = dtype.bits / 8;
+    if (m_shape.size() == 0 || m_shape[0] == 0)
+        {
+        context->shape.push_back(0);
+        context->strides.push_back(1);
+        }
+    else
+        {
+        for (size_t i = 0; i < m_shape.size(); i++)
+            {
+            if (m_strides[i] % itemsize != 0)
+                {
+                throw std::runtime_error("DLPack requires strides that are multiples of the "
+                                         "element size.");
+                }
+            context->shape.push_back(int64_t(m_shape[i]));
+            context->strides.push_back(int64_t(m_strides[i] / itemsize));
+            }
+        }
+
+    int device_id;
+    checkHIPError(hipGetDevice(&device_id), "get device");
+
+    DLTensor& tensor = context->tensor.dl_tensor;
+    tensor.data = m_data;
+    tensor.device = getDLPackDeviceValue(device_id);
+    tensor.ndim = int32_t(context->shape.size());
+    tensor.dtype = dtype;
+    tensor.shape = context->shape.data();
+    tensor.strides = context->strides.data();
+    tensor.byte_offset = 0;
+    context->tensor.manager_ctx = context.get();
+    context->tensor.deleter = deleteDLManagedTensor;
+
+    PyObject* capsule = PyCapsule_New(&context->tensor, "dltensor", deleteDLPackCapsule);
+    if (!capsule)
+        {
+        throw pybind11::error_already_set();
+        }
+    context.release();
+    return pybind11::reinterpret_steal<pybind11::capsule>(capsule);
+    }
+
+pybind11::tuple HOOMDDeviceBuffer::getDLPackDevice()
+    {
+    int device_id;
+    checkHIPError(hipGetDevice(&device_id), "get device");
+    DLDevice device = getDLPackDeviceValue(device_id);
+    return pybind11::make_tuple(device.device_type, device.device_id);
+    }
+
+/*! \param stream User stream (a DLPack stream handle)
+
+    HOOMD launches its kernels on the legacy default stream, which does not implicitly wait for
+    streams created with the non-blocking flag. Call waitForStream on such a stream after queuing
+    work that writes to HOOMD's buffers to order HOOMD's next kernels after it without blocking the
+    host.
+*/
+void waitForStream(uintptr_t stream)
+    {
+    if (stream == 0 || stream == 1)
+        {
+        return;
+        }
+    streamWaitStream(0, getStream(intptr_t(stream)));
+    }
+#endif
+
 namespace detail
     {
 void export_GhostDataFlag(pybind11::module& m)
@@ -30,8 +285,14 @@ void export_HOOMDDeviceBuffer(pybind11::module& m)
     pybind11::class_<HOOMDDeviceBuffer>(m, "HOOMDDeviceBuffer")
         .def_property_readonly("__cuda_array_interface__",
                                &HOOMDDeviceBuffer::getCudaArrayInterface)
+        .def("__dlpack__",
+             &HOOMDDeviceBuffer::getDLPack,
+             pybind11::arg("stream") = pybind11::none())
+        .def("__dlpack_device__", &HOOMDDeviceBuffer::getDLPackDevice)
         .def_property_readonly("read_only", &HOOMDDeviceBuffer::getReadOnly);
     ;
+
+    m.def("wait_for_stream", &waitForStream);
     }
 
 #endif
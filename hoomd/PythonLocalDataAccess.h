@@ -98,9 +98,13 @@ struct HOOMDHostBuffer : public HOOMDBuffer
     };
 
 #if ENABLE_HIP
-/// Represents the data required to implement the __cuda_array_interface__.
+/// Represents the data required to implement the __cuda_array_interface__ and DLPack.
 /** Creates the Python dictionary to represent a GPU array through the
- *  __cuda_array_interface__. Currently supports version 2 of the protocol.
+ *  __cuda_array_interface__. Currently supports version 3 of the protocol. Also exports the
+ *  array as a DLPack capsule through __dlpack__.
+ *
+ *  HOOMD-blue launches all kernels on the legacy default stream. Both protocols report this
+ *  stream so that consumers order their work after HOOMD's without synchronizing the device.
  */
 struct HOOMDDeviceBuffer : public HOOMDBuffer
     {
@@ -126,7 +130,7 @@ struct HOOMDDeviceBuffer : public HOOMDBuffer
                                  read_only);
         }
 
-    /// Convert object to a __cuda_array_interface__ v2 compliant Python dict.
+    /// Convert object to a __cuda_array_interface__ v3 compliant Python dict.
     /** We can't only add the existing values in the HOOMDDeviceBuffer because
      *  CuPy and potentially other packages that use the interface can't handle
      *  a shape where the first dimension is zero and the rest are non-zero. In
@@ -156,13 +160,29 @@ struct HOOMDDeviceBuffer : public HOOMDBuffer
             }
         auto interface = pybind11::dict();
         interface["typestr"] = m_typestr;
-        interface["version"] = 2;
+        interface["version"] = 3;
         interface["data"] = data;
         interface["shape"] = pybind11::tuple(shape);
         interface["strides"] = pybind11::tuple(strides);
+        // the data is valid on the legacy default stream
+        interface["stream"] = 1;
         return interface;
         }
+
+    /// Export the buffer as a DLPack capsule.
+    /** \param stream Consumer stream (a Python int or None)
+     *
+     *  When \a stream is a stream other than the legacy default stream, make it wait for the work
+     *  HOOMD queued before the call. The wait is recorded on the device, the host does not block.
+     */
+    pybind11::capsule getDLPack(pybind11::object stream);
+
+    /// Get the DLPack device type and id of the buffer.
+    pybind11::tuple getDLPackDevice();
     };
+
+/// Make HOOMD's stream wait for the work queued on a user stream.
+void waitForStream(uintptr_t stream);
 #endif
 
 ///
@@ -70,6 +70,9 @@ struct RNGIdentifier
     static const uint8_t HPMCShapeMoveUpdateOrder = 44;
     static const uint8_t BussiThermostat = 45;
     static const uint8_t ConstantPressure = 46;
+    static const uint8_t HPMCMonoCheckerboard = 47;
+    static const uint8_t UpdaterReplicaExchange = 48;
+    static const uint8_t UpdaterTypeSwap = 49;
     };
 
     } // namespace hoomd
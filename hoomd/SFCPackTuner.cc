@@ -14,6 +14,12 @@
 #include <math.h>
 #include <stdexcept>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -116,10 +122,83 @@ void SFCPackTuner::update(uint64_t timestep)
 #endif
     }
 
+namespace detail
+    {
+//! Call work(begin, end) over [0, N), in parallel when TBB provides more than one thread
+template<class Work>
+static void sfc_for_each(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                         unsigned int N,
+                         const Work& work)
+    {
+#ifdef ENABLE_TBB
+    if (exec_conf->getNumThreads() > 1)
+        {
+        exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { work(r.begin(), r.end()); });
+            });
+        return;
+        }
+#endif
+    work(0, N);
+    }
+
+//! Reorder an array so that element i is replaced by element order[i]
+/*! \param exec_conf Execution configuration
+    \param data Array to reorder
+    \param tmp Temporary storage for N elements
+    \param order Sort order
+    \param N Number of elements
+*/
+template<class T>
+static void sfc_reorder(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                        T* data,
+                        T* tmp,
+                        const unsigned int* order,
+                        unsigned int N)
+    {
+    sfc_for_each(exec_conf,
+                 N,
+                 [&](unsigned int begin, unsigned int end)
+                 {
+                     for (unsigned int i = begin; i < end; i++)
+                         tmp[i] = data[order[i]];
+                 });
+    sfc_for_each(exec_conf,
+                 N,
+                 [&](unsigned int begin, unsigned int end)
+                 { std::copy(tmp + begin, tmp + end, data + begin); });
+    }
+
+//! Sort the binned particles, in parallel when TBB provides more than one thread
+/*! The (bin, index) pairs are unique, so the parallel and serial sorts give the same order.
+ */
+static void sfc_sort_bins(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                          std::vector<std::pair<unsigned int, unsigned int>>& particle_bins,
+                          unsigned int N)
+    {
+#ifdef ENABLE_TBB
+    if (exec_conf->getNumThreads() > 1)
+        {
+        exec_conf->getTaskArena()->execute(
+            [&] { tbb::parallel_sort(particle_bins.begin(), particle_bins.begin() + N); });
+        return;
+        }
+#endif
+    std::sort(particle_bins.begin(), particle_bins.begin() + N);
+    }
+    } // end namespace detail
+
 void SFCPackTuner::applySortOrder()
     {
     assert(m_pdata);
     assert(m_sort_order.size() >= m_pdata->getN());
+    const unsigned int N = m_pdata->getN();
+    const unsigned int* order = m_sort_order.data();
+
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                access_location::host,
                                access_mode::readwrite);
@@ -152,54 +231,25 @@ void SFCPackTuner::applySortOrder()
                                      access_location::host,
                                      access_mode::readwrite);
 
-    // construct a temporary holding array for the sorted data
-    Scalar4* scal4_tmp = new Scalar4[m_pdata->getN()];
-
-    // sort positions and types
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal4_tmp[i] = h_pos.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_pos.data[i] = scal4_tmp[i];
-
-    // sort velocities and mass
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal4_tmp[i] = h_vel.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_vel.data[i] = scal4_tmp[i];
-
-    Scalar3* scal3_tmp = new Scalar3[m_pdata->getN()];
-    // sort accelerations
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal3_tmp[i] = h_accel.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_accel.data[i] = scal3_tmp[i];
-
-    Scalar* scal_tmp = new Scalar[m_pdata->getN()];
-    // sort charge
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal_tmp[i] = h_charge.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_charge.data[i] = scal_tmp[i];
-
-    // sort diameter
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal_tmp[i] = h_diameter.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_diameter.data[i] = scal_tmp[i];
-
-    // sort angular momentum
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal4_tmp[i] = h_angmom.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_angmom.data[i] = scal4_tmp[i];
-
-    // sort moment of inertia
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        scal3_tmp[i] = h_inertia.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
-        h_inertia.data[i] = scal3_tmp[i];
-        }
+    // construct temporary holding arrays for the sorted data
+    std::unique_ptr<Scalar4[]> scal4_tmp(new Scalar4[N]);
+    std::unique_ptr<Scalar3[]> scal3_tmp(new Scalar3[N]);
+    std::unique_ptr<Scalar[]> scal_tmp(new Scalar[N]);
+    std::unique_ptr<int3[]> int3_tmp(new int3[N]);
+    std::unique_ptr<unsigned int[]> uint_tmp(new unsigned int[N]);
+
+    // sort positions and types, velocities and mass, and accelerations
+    detail::sfc_reorder(m_exec_conf, h_pos.data, scal4_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_vel.data, scal4_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_accel.data, scal3_tmp.get(), order, N);
+
+    // sort charge and diameter
+    detail::sfc_reorder(m_exec_conf, h_charge.data, scal_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_diameter.data, scal_tmp.get(), order, N);
+
+    // sort angular momentum and moment of inertia
+    detail::sfc_reorder(m_exec_conf, h_angmom.data, scal4_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_inertia.data, scal3_tmp.get(), order, N);
 
         // in case anyone access it from frame to frame, sort the net virial
         {
@@ -210,10 +260,11 @@ void SFCPackTuner::applySortOrder()
 
         for (unsigned int j = 0; j < 6; j++)
             {
-            for (unsigned int i = 0; i < m_pdata->getN(); i++)
-                scal_tmp[i] = h_net_virial.data[j * virial_pitch + m_sort_order[i]];
-            for (unsigned int i = 0; i < m_pdata->getN(); i++)
-                h_net_virial.data[j * virial_pitch + i] = scal_tmp[i];
+            detail::sfc_reorder(m_exec_conf,
+                                h_net_virial.data + j * virial_pitch,
+                                scal_tmp.get(),
+                                order,
+                                N);
             }
         }
 
@@ -222,66 +273,38 @@ void SFCPackTuner::applySortOrder()
         ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
                                          access_location::host,
                                          access_mode::readwrite);
-
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            scal4_tmp[i] = h_net_force.data[m_sort_order[i]];
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            h_net_force.data[i] = scal4_tmp[i];
+        detail::sfc_reorder(m_exec_conf, h_net_force.data, scal4_tmp.get(), order, N);
         }
 
         {
         ArrayHandle<Scalar4> h_net_torque(m_pdata->getNetTorqueArray(),
                                           access_location::host,
                                           access_mode::readwrite);
-
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            scal4_tmp[i] = h_net_torque.data[m_sort_order[i]];
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            h_net_torque.data[i] = scal4_tmp[i];
+        detail::sfc_reorder(m_exec_conf, h_net_torque.data, scal4_tmp.get(), order, N);
         }
 
         {
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
-
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            scal4_tmp[i] = h_orientation.data[m_sort_order[i]];
-        for (unsigned int i = 0; i < m_pdata->getN(); i++)
-            h_orientation.data[i] = scal4_tmp[i];
+        detail::sfc_reorder(m_exec_conf, h_orientation.data, scal4_tmp.get(), order, N);
         }
 
-    // sort image
-    int3* int3_tmp = new int3[m_pdata->getN()];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        int3_tmp[i] = h_image.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_image.data[i] = int3_tmp[i];
-
-    // sort body
-    unsigned int* uint_tmp = new unsigned int[m_pdata->getN()];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        uint_tmp[i] = h_body.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_body.data[i] = uint_tmp[i];
-
-    // sort global tag
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        uint_tmp[i] = h_tag.data[m_sort_order[i]];
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        h_tag.data[i] = uint_tmp[i];
+    // sort image, body, and global tag
+    detail::sfc_reorder(m_exec_conf, h_image.data, int3_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_body.data, uint_tmp.get(), order, N);
+    detail::sfc_reorder(m_exec_conf, h_tag.data, uint_tmp.get(), order, N);
 
     // rebuild global rtag
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
-        {
-        h_rtag.data[h_tag.data[i]] = i;
-        }
-
-    delete[] scal_tmp;
-    delete[] scal4_tmp;
-    delete[] scal3_tmp;
-    delete[] uint_tmp;
-    delete[] int3_tmp;
+    detail::sfc_for_each(m_exec_conf,
+                         N,
+                         [&](unsigned int begin, unsigned int end)
+                         {
+                             for (unsigned int i = begin; i < end; i++)
+                                 {
+                                 h_rtag.data[h_tag.data[i]] = i;
+                                 }
+                         });
     }
 
 namespace detail
@@ -502,40 +525,51 @@ void SFCPackTuner::getSortedOrder2D()
                                    access_mode::read);
 
         // for each particle
-        for (unsigned int n = 0; n < m_pdata->getN(); n++)
+        detail::sfc_for_each(
+            m_exec_conf,
+            m_pdata->getN(),
+            [&](unsigned int begin, unsigned int end)
             {
-            // find the bin each particle belongs in
-            Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
-            Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
-            int ib = (unsigned int)(f.x * m_grid) % m_grid;
-            int jb = (unsigned int)(f.y * m_grid) % m_grid;
-
-            // if the particle is slightly outside, move back into grid
-            if (ib < 0)
-                ib = 0;
-            if (ib >= (int)m_grid)
-                ib = m_grid - 1;
-
-            if (jb < 0)
-                jb = 0;
-            if (jb >= (int)m_grid)
-                jb = m_grid - 1;
-
-            // record its bin
-            unsigned int bin = ib * m_grid + jb;
-
-            m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
-            }
+                for (unsigned int n = begin; n < end; n++)
+                    {
+                    // find the bin each particle belongs in
+                    Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
+                    Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
+                    int ib = (unsigned int)(f.x * m_grid) % m_grid;
+                    int jb = (unsigned int)(f.y * m_grid) % m_grid;
+
+                    // if the particle is slightly outside, move back into grid
+                    if (ib < 0)
+                        ib = 0;
+                    if (ib >= (int)m_grid)
+                        ib = m_grid - 1;
+
+                    if (jb < 0)
+                        jb = 0;
+                    if (jb >= (int)m_grid)
+                        jb = m_grid - 1;
+
+                    // record its bin
+                    unsigned int bin = ib * m_grid + jb;
+
+                    m_particle_bins[n] = std::pair<unsigned int, unsigned int>(bin, n);
+                    }
+            });
         }
 
     // sort the tuples
-    sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
+    detail::sfc_sort_bins(m_exec_conf, m_particle_bins, m_pdata->getN());
 
     // translate the sorted order
-    for (unsigned int j = 0; j < m_pdata->getN(); j++)
-        {
-        m_sort_order[j] = m_particle_bins[j].second;
-        }
+    detail::sfc_for_each(m_exec_conf,
+                         m_pdata->getN(),
+                         [&](unsigned int begin, unsigned int end)
+                         {
+                             for (unsigned int j = begin; j < end; j++)
+                                 {
+                                 m_sort_order[j] = m_particle_bins[j].second;
+                                 }
+                         });
     }
 
 void SFCPackTuner::getSortedOrder3D()
@@ -609,44 +643,56 @@ void SFCPackTuner::getSortedOrder3D()
                                                 access_mode::read);
 
     // for each particle
-    for (unsigned int n = 0; n < m_pdata->getN(); n++)
+    detail::sfc_for_each(
+        m_exec_conf,
+        m_pdata->getN(),
+        [&](unsigned int begin, unsigned int end)
         {
-        Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
-        Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
-        int ib = (unsigned int)(f.x * m_grid) % m_grid;
-        int jb = (unsigned int)(f.y * m_grid) % m_grid;
-        int kb = (unsigned int)(f.z * m_grid) % m_grid;
-
-        // if the particle is slightly outside, move back into grid
-        if (ib < 0)
-            ib = 0;
-        if (ib >= (int)m_grid)
-            ib = m_grid - 1;
-
-        if (jb < 0)
-            jb = 0;
-        if (jb >= (int)m_grid)
-            jb = m_grid - 1;
-
-        if (kb < 0)
-            kb = 0;
-        if (kb >= (int)m_grid)
-            kb = m_grid - 1;
-
-        // record its bin
-        unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
-
-        m_particle_bins[n] = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
-        }
+            for (unsigned int n = begin; n < end; n++)
+                {
+                Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
+                Scalar3 f = box.makeFraction(p, make_scalar3(0.0, 0.0, 0.0));
+                int ib = (unsigned int)(f.x * m_grid) % m_grid;
+                int jb = (unsigned int)(f.y * m_grid) % m_grid;
+                int kb = (unsigned int)(f.z * m_grid) % m_grid;
+
+                // if the particle is slightly outside, move back into grid
+                if (ib < 0)
+                    ib = 0;
+                if (ib >= (int)m_grid)
+                    ib = m_grid - 1;
+
+                if (jb < 0)
+                    jb = 0;
+                if (jb >= (int)m_grid)
+                    jb = m_grid - 1;
+
+                if (kb < 0)
+                    kb = 0;
+                if (kb >= (int)m_grid)
+                    kb = m_grid - 1;
+
+                // record its bin
+                unsigned int bin = ib * (m_grid * m_grid) + jb * m_grid + kb;
+
+                m_particle_bins[n]
+                    = std::pair<unsigned int, unsigned int>(h_traversal_order.data[bin], n);
+                }
+        });
 
     // sort the tuples
-    sort(m_particle_bins.begin(), m_particle_bins.begin() + m_pdata->getN());
+    detail::sfc_sort_bins(m_exec_conf, m_particle_bins, m_pdata->getN());
 
     // translate the sorted order
-    for (unsigned int j = 0; j < m_pdata->getN(); j++)
-        {
-        m_sort_order[j] = m_particle_bins[j].second;
-        }
+    detail::sfc_for_each(m_exec_conf,
+                         m_pdata->getN(),
+                         [&](unsigned int begin, unsigned int end)
+                         {
+                             for (unsigned int j = begin; j < end; j++)
+                                 {
+                                 m_sort_order[j] = m_particle_bins[j].second;
+                                 }
+                         });
     }
 
 void SFCPackTuner::writeTraversalOrder(const std::string& fname,
@@ -13,6 +13,31 @@ namespace hoomd
 template<class Real>
 void SnapshotSystemData<Real>::replicate(unsigned int nx, unsigned int ny, unsigned int nz)
     {
+#ifdef BUILD_MPCD
+    BoxDim old_box = *global_box;
+#endif
+    replicateImages(nx, ny, nz, 0, nx * ny * nz);
+#ifdef BUILD_MPCD
+    mpcd_data.replicate(nx, ny, nz, old_box, *global_box);
+#endif
+    }
+
+/*! \param nx Number of times to replicate the system along the x direction
+    \param ny Number of times to replicate the system along the y direction
+    \param nz Number of times to replicate the system along the z direction
+    \param image_begin First image to keep
+    \param image_end One past the last image to keep
+
+    Expands the box and replaces the particles and bonded groups with the images
+    [image_begin, image_end) of the replicated system. The MPCD particles are left unchanged.
+*/
+template<class Real>
+void SnapshotSystemData<Real>::replicateImages(unsigned int nx,
+                                               unsigned int ny,
+                                               unsigned int nz,
+                                               unsigned int image_begin,
+                                               unsigned int image_end)
+    {
     assert(nx > 0);
     assert(ny > 0);
     assert(nz > 0);
@@ -26,19 +51,81 @@ void SnapshotSystemData<Real>::replicate(unsigned int nx, unsigned int ny, unsig
     global_box->setL(L);
 
     unsigned int old_n = particle_data.size;
-    unsigned int n = nx * ny * nz;
 
     // replicate snapshots
-    particle_data.replicate(nx, ny, nz, old_box, *global_box);
-    bond_data.replicate(n, old_n);
-    angle_data.replicate(n, old_n);
-    dihedral_data.replicate(n, old_n);
-    improper_data.replicate(n, old_n);
-    constraint_data.replicate(n, old_n);
-    pair_data.replicate(n, old_n);
+    particle_data.replicateImages(nx, ny, nz, old_box, *global_box, image_begin, image_end);
+    bond_data.replicateImages(old_n, image_begin, image_end);
+    angle_data.replicateImages(old_n, image_begin, image_end);
+    dihedral_data.replicateImages(old_n, image_begin, image_end);
+    improper_data.replicateImages(old_n, image_begin, image_end);
+    constraint_data.replicateImages(old_n, image_begin, image_end);
+    pair_data.replicateImages(old_n, image_begin, image_end);
+    }
+
+/*! \param nx Number of times to replicate the system along the x direction
+    \param ny Number of times to replicate the system along the y direction
+    \param nz Number of times to replicate the system along the z direction
+    \param exec_conf The execution configuration
+
+    Broadcasts the snapshot on rank 0 to all ranks. Rank r of R then keeps the contiguous images
+    [r * n / R, (r + 1) * n / R) of the n = nx * ny * nz images, and the snapshot is marked as
+    distributed. The particle and group tags of the slices follow in rank order, so initializing
+    the system from the distributed snapshot gives the same tags as replicate(). No rank holds
+    more than its slice of the replicated system.
+
+    The MPCD particles are replicated on rank 0 only.
+*/
+template<class Real>
+void SnapshotSystemData<Real>::replicateDistributed(
+    unsigned int nx,
+    unsigned int ny,
+    unsigned int nz,
+    std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+#ifdef ENABLE_MPI
+    const unsigned int n_ranks = exec_conf->getNRanks();
+    if (n_ranks > 1)
+        {
+        const unsigned int rank = exec_conf->getRank();
+        auto communicator = exec_conf->getMPICommunicator();
+
+        // the unit cell is small, send it to every rank
+        broadcast_box(exec_conf->getMPIConfig());
+        particle_data.bcast(0, communicator);
+        bond_data.bcast(0, communicator);
+        angle_data.bcast(0, communicator);
+        dihedral_data.bcast(0, communicator);
+        improper_data.bcast(0, communicator);
+        constraint_data.bcast(0, communicator);
+        pair_data.bcast(0, communicator);
+
 #ifdef BUILD_MPCD
-    mpcd_data.replicate(nx, ny, nz, old_box, *global_box);
+        BoxDim old_box = *global_box;
 #endif
+        const uint64_t n = uint64_t(nx) * ny * nz;
+        replicateImages(nx,
+                        ny,
+                        nz,
+                        static_cast<unsigned int>(n * rank / n_ranks),
+                        static_cast<unsigned int>(n * (rank + 1) / n_ranks));
+
+        particle_data.is_distributed = true;
+        bond_data.is_distributed = true;
+        angle_data.is_distributed = true;
+        dihedral_data.is_distributed = true;
+        improper_data.is_distributed = true;
+        constraint_data.is_distributed = true;
+        pair_data.is_distributed = true;
+
+#ifdef BUILD_MPCD
+        if (rank == 0)
+            mpcd_data.replicate(nx, ny, nz, old_box, *global_box);
+#endif
+        return;
+        }
+#endif
+
+    replicate(nx, ny, nz);
     }
 
 template<class Real> void SnapshotSystemData<Real>::wrap()
@@ -161,6 +248,7 @@ void export_SnapshotSystemData(pybind11::module& m)
         .def_readonly("mpcd", &SnapshotSystemData<float>::mpcd_data)
 #endif
         .def("replicate", &SnapshotSystemData<float>::replicate)
+        .def("_replicate_distributed", &SnapshotSystemData<float>::replicateDistributed)
         .def("wrap", &SnapshotSystemData<float>::wrap)
         .def("_broadcast_box", &SnapshotSystemData<float>::broadcast_box)
         .def("_broadcast", &SnapshotSystemData<float>::broadcast)
@@ -183,6 +271,7 @@ void export_SnapshotSystemData(pybind11::module& m)
         .def_readonly("mpcd", &SnapshotSystemData<double>::mpcd_data)
 #endif
         .def("replicate", &SnapshotSystemData<double>::replicate)
+        .def("_replicate_distributed", &SnapshotSystemData<double>::replicateDistributed)
         .def("wrap", &SnapshotSystemData<double>::wrap)
         .def("_broadcast_box", &SnapshotSystemData<double>::broadcast_box)
         .def("_broadcast", &SnapshotSystemData<double>::broadcast)
@@ -67,6 +67,24 @@ template<class Real> struct SnapshotSystemData
      */
     void replicate(unsigned int nx, unsigned int ny, unsigned int nz);
 
+    //! Replicate the system and keep a contiguous range of the images
+    void replicateImages(unsigned int nx,
+                         unsigned int ny,
+                         unsigned int nz,
+                         unsigned int image_begin,
+                         unsigned int image_end);
+
+    // Replicate the snapshot on rank 0 into a snapshot distributed over all ranks
+    /*! \param nx Number of times to replicate the system along the x direction
+     *  \param ny Number of times to replicate the system along the y direction
+     *  \param nz Number of times to replicate the system along the z direction
+     *  \param exec_conf The execution configuration
+     */
+    void replicateDistributed(unsigned int nx,
+                              unsigned int ny,
+                              unsigned int nz,
+                              std::shared_ptr<ExecutionConfiguration> exec_conf);
+
     //! Move the snapshot's particle positions back into the box. Update particle images based on
     //! the number of wrapped images.
     void wrap();
@@ -79,6 +79,10 @@ void System::setCommunicator(std::shared_ptr<Communicator> comm)
 
 void System::run(uint64_t nsteps, bool write_at_start)
     {
+    // Release the GIL so that other Python threads can run alongside the simulation. Operations
+    // that call into Python acquire the GIL themselves.
+    pybind11::gil_scoped_release release;
+
     m_start_tstep = m_cur_tstep;
     m_end_tstep = m_cur_tstep + nsteps;
 
@@ -88,6 +92,7 @@ void System::run(uint64_t nsteps, bool write_at_start)
     m_last_TPS = 0.0;
 
     resetStats();
+    double last_signal_check = 0.0;
 
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
@@ -104,6 +109,12 @@ void System::run(uint64_t nsteps, bool write_at_start)
         {
         updateGroupDOF();
         m_update_group_dof_next_step = false;
+        m_check_group_dof_next_step = false;
+        }
+    else if (m_check_group_dof_next_step)
+        {
+        updateGroupDOF(false);
+        m_check_group_dof_next_step = false;
         }
 
     // Prepare the run
@@ -123,7 +134,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedOperationTimer timer(analyzer->getTimer(), typeid(*analyzer));
                 analyzer->analyze(m_cur_tstep);
+                }
             }
         }
 
@@ -133,7 +147,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& tuner : m_tuners)
             {
             if ((*tuner->getTrigger())(m_cur_tstep))
+                {
+                ScopedOperationTimer timer(tuner->getTimer(), typeid(*tuner));
                 tuner->update(m_cur_tstep);
+                }
             }
 
         // execute updaters
@@ -141,8 +158,9 @@ void System::run(uint64_t nsteps, bool write_at_start)
             {
             if ((*updater->getTrigger())(m_cur_tstep))
                 {
+                ScopedOperationTimer timer(updater->getTimer(), typeid(*updater));
                 updater->update(m_cur_tstep);
-                m_update_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
+                m_check_group_dof_next_step |= updater->mayChangeDegreesOfFreedom(m_cur_tstep);
                 }
             }
 
@@ -150,6 +168,12 @@ void System::run(uint64_t nsteps, bool write_at_start)
             {
             updateGroupDOF();
             m_update_group_dof_next_step = false;
+            m_check_group_dof_next_step = false;
+            }
+        else if (m_check_group_dof_next_step)
+            {
+            updateGroupDOF(false);
+            m_check_group_dof_next_step = false;
             }
 
         // look ahead to the next time step and see which analyzers and updaters will be executed
@@ -159,7 +183,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
 
         // execute the integrator
         if (m_integrator)
+            {
+            ScopedOperationTimer timer(m_integrator->getTimer(), typeid(*m_integrator));
             m_integrator->update(m_cur_tstep);
+            }
 
         m_cur_tstep++;
 
@@ -167,15 +194,24 @@ void System::run(uint64_t nsteps, bool write_at_start)
         for (auto& analyzer : m_analyzers)
             {
             if ((*analyzer->getTrigger())(m_cur_tstep))
+                {
+                ScopedOperationTimer timer(analyzer->getTimer(), typeid(*analyzer));
                 analyzer->analyze(m_cur_tstep);
+                }
             }
 
         updateTPS();
 
-        // propagate Python exceptions related to signals
-        if (PyErr_CheckSignals() != 0)
+        // propagate Python exceptions related to signals, at most every 10 ms so that the run loop
+        // does not wait on other Python threads for the GIL every step
+        if (m_last_walltime - last_signal_check >= 0.01 || count + 1 == nsteps)
             {
-            throw pybind11::error_already_set();
+            last_signal_check = m_last_walltime;
+            pybind11::gil_scoped_acquire acquire;
+            if (PyErr_CheckSignals() != 0)
+                {
+                throw pybind11::error_already_set();
+                }
             }
         }
     }
@@ -206,6 +242,10 @@ void System::resetStats()
     // computes
     for (auto compute : m_computes)
         compute->resetStats();
+
+    // tuners
+    for (auto& tuner : m_tuners)
+        tuner->resetStats();
     }
 
 /*! \param tstep Time step for which to determine the flags
@@ -240,12 +280,35 @@ PDataFlags System::determineFlags(uint64_t tstep)
     return flags;
     }
 
-/*! Apply the degrees of freedom given by the integrator to all groups in the cache.
- */
-void System::updateGroupDOF()
+/*! Apply the degrees of freedom given by the integrator to the groups in the cache.
+
+    \param all When false, only update the groups whose members have changed since their degrees of
+    freedom were last set. All groups are updated anyway when the members of the integrator's groups
+    or the number of particles in the system have changed.
+*/
+void System::updateGroupDOF(bool all)
     {
+    std::vector<std::pair<const ParticleGroup*, uint64_t>> dof_groups;
+    if (m_integrator)
+        {
+        for (auto& group : m_integrator->getDOFGroups())
+            {
+            dof_groups.emplace_back(group.get(), group->getMembershipVersion());
+            }
+        }
+    const unsigned int n_global = m_sysdef->getParticleData()->getNGlobal();
+
+    all = all || dof_groups != m_dof_groups || n_global != m_dof_n_global;
+    m_dof_groups = std::move(dof_groups);
+    m_dof_n_global = n_global;
+
     for (auto group : m_group_cache)
         {
+        if (!all && group->getDOFVersion() == group->getMembershipVersion())
+            {
+            continue;
+            }
+
         if (m_integrator)
             {
             m_integrator->updateGroupDOF(group);
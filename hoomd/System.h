@@ -190,7 +190,7 @@ class PYBIND11_EXPORT System
 
     private:
     /// Update the number of degrees of freedom in cached groups
-    void updateGroupDOF();
+    void updateGroupDOF(bool all = true);
 
     std::vector<std::shared_ptr<Analyzer>>
         m_analyzers; //!< List of analyzers belonging to this System
@@ -245,6 +245,15 @@ class PYBIND11_EXPORT System
 
     /// Flag to trigger update of group degrees of freedom
     bool m_update_group_dof_next_step = false;
+
+    /// Flag to trigger update of the degrees of freedom of groups that have changed
+    bool m_check_group_dof_next_step = false;
+
+    /// Integrator groups and their membership versions at the last degrees of freedom update
+    std::vector<std::pair<const ParticleGroup*, uint64_t>> m_dof_groups;
+
+    /// Global number of particles at the last degrees of freedom update
+    unsigned int m_dof_n_global = 0;
     };
 
 namespace detail
@@ -194,6 +194,10 @@ template<class Real> std::shared_ptr<SnapshotSystemData<Real>> SystemDefinition:
     }
 
 //! Re-initialize the system from a snapshot
+/*! When the snapshot changes only the box, the particle positions and images, the particle data
+    is updated in place and the bonded data is left as is. This avoids reallocating and resorting
+    the particle data and rebuilding the members of groups and bonded groups.
+*/
 template<class Real>
 void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData<Real>> snapshot)
     {
@@ -207,14 +211,30 @@ void SystemDefinition::initializeFromSnapshot(std::shared_ptr<SnapshotSystemData
         bcast(m_n_dimensions, 0, exec_conf->getMPICommunicator());
 #endif
 
+    bool in_place = true;
+#ifdef ENABLE_MPI
+    // the in place update is only implemented without domain decomposition
+    if (m_particle_data->getDomainDecomposition())
+        in_place = false;
+#endif
+    in_place = in_place && m_bond_data->matchesSnapshot(snapshot->bond_data)
+               && m_angle_data->matchesSnapshot(snapshot->angle_data)
+               && m_dihedral_data->matchesSnapshot(snapshot->dihedral_data)
+               && m_improper_data->matchesSnapshot(snapshot->improper_data)
+               && m_constraint_data->matchesSnapshot(snapshot->constraint_data)
+               && m_pair_data->matchesSnapshot(snapshot->pair_data);
+
     m_particle_data->setGlobalBox(snapshot->global_box);
-    m_particle_data->initializeFromSnapshot(snapshot->particle_data);
-    m_bond_data->initializeFromSnapshot(snapshot->bond_data);
-    m_angle_data->initializeFromSnapshot(snapshot->angle_data);
-    m_dihedral_data->initializeFromSnapshot(snapshot->dihedral_data);
-    m_improper_data->initializeFromSnapshot(snapshot->improper_data);
-    m_constraint_data->initializeFromSnapshot(snapshot->constraint_data);
-    m_pair_data->initializeFromSnapshot(snapshot->pair_data);
+    if (!in_place || !m_particle_data->updatePositionsFromSnapshot(snapshot->particle_data))
+        {
+        m_particle_data->initializeFromSnapshot(snapshot->particle_data);
+        m_bond_data->initializeFromSnapshot(snapshot->bond_data);
+        m_angle_data->initializeFromSnapshot(snapshot->angle_data);
+        m_dihedral_data->initializeFromSnapshot(snapshot->dihedral_data);
+        m_improper_data->initializeFromSnapshot(snapshot->improper_data);
+        m_constraint_data->initializeFromSnapshot(snapshot->constraint_data);
+        m_pair_data->initializeFromSnapshot(snapshot->pair_data);
+        }
 #ifdef BUILD_MPCD
     if (!m_mpcd_data)
         {
@@ -0,0 +1,163 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __THREAD_BUFFERS_H__
+#define __THREAD_BUFFERS_H__
+
+#ifdef ENABLE_TBB
+
+#include "ExecutionConfiguration.h"
+
+#include <memory>
+#include <vector>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
+/*! \file ThreadBuffers.h
+    \brief Declares per-thread accumulation arrays for threaded CPU loops
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+//! Accumulation arrays for threaded loops that write to shared elements
+/*! Threaded loops whose work items add to the same elements (for example, Newton's third law
+    forces or charge spreading) accumulate into one array per thread and sum the arrays
+    afterwards. Iterating over a ThreadBuffers visits the arrays in a fixed order. Loops that
+    accumulate into several ThreadBuffers of the same execution configuration pass the index of
+    the array to use to their work function, and that index selects the matching array of each.
+
+    By default, parallel_for() splits the range with the TBB auto partitioner and each thread
+    adds to its own array. Which items end up in which array then depends on the scheduler, so
+    the floating point sums vary from run to run. When
+    ExecutionConfiguration::isDeterministicReductionEnabled() is true, parallel_for() instead
+    splits the range into one contiguous slice per array and processes each slice in order. The
+    results are then reproducible for a given number of threads, at the cost of static load
+    balancing.
+
+    Construct and use ThreadBuffers inside the task arena of the execution configuration.
+*/
+template<class T> class ThreadBuffers
+    {
+    public:
+    //! Allocate one array of \a n elements set to \a value for each thread
+    ThreadBuffers(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                  size_t n,
+                  const T& value)
+        : m_deterministic(exec_conf->isDeterministicReductionEnabled()),
+          m_buffers(exec_conf->getTaskArena()->max_concurrency(), std::vector<T>(n, value))
+        {
+        }
+
+    //! Call compute(begin, end, k) on subranges of [begin, end) in parallel
+    /*! \param begin First item
+        \param end One past the last item
+        \param compute Callable that processes items [begin, end) and adds to the arrays with
+            index \a k
+    */
+    template<class Compute>
+    void parallel_for(unsigned int begin, unsigned int end, const Compute& compute)
+        {
+        if (m_deterministic)
+            {
+            const size_t n_slices = m_buffers.size();
+            const size_t n_items = end - begin;
+            tbb::parallel_for(
+                tbb::blocked_range<size_t>(0, n_slices, 1),
+                [&](const tbb::blocked_range<size_t>& r)
+                {
+                    for (size_t slice = r.begin(); slice != r.end(); ++slice)
+                        {
+                        compute(begin + static_cast<unsigned int>(n_items * slice / n_slices),
+                                begin
+                                    + static_cast<unsigned int>(n_items * (slice + 1) / n_slices),
+                                static_cast<unsigned int>(slice));
+                        }
+                },
+                tbb::simple_partitioner());
+            }
+        else
+            {
+            tbb::parallel_for(tbb::blocked_range<unsigned int>(begin, end),
+                              [&](const tbb::blocked_range<unsigned int>& r)
+                              {
+                                  compute(r.begin(),
+                                          r.end(),
+                                          static_cast<unsigned int>(
+                                              tbb::this_task_arena::current_thread_index()));
+                              });
+            }
+        }
+
+    //! Get the array with index k
+    std::vector<T>& operator[](unsigned int k)
+        {
+        return m_buffers[k];
+        }
+
+    //! Get the first array
+    typename std::vector<std::vector<T>>::const_iterator begin() const
+        {
+        return m_buffers.begin();
+        }
+
+    //! Get one past the last array
+    typename std::vector<std::vector<T>>::const_iterator end() const
+        {
+        return m_buffers.end();
+        }
+
+    private:
+    bool m_deterministic;                  //!< True when the slices are fixed
+    std::vector<std::vector<T>> m_buffers; //!< One array per thread or slice
+    };
+
+//! Sum f(begin, end) over subranges of [begin, end) in parallel
+/*! \param exec_conf Execution configuration
+    \param begin First item
+    \param end One past the last item
+    \param f Callable that returns the sum over items [begin, end)
+
+    With deterministic reductions enabled, the subranges and the order of the partial sums depend
+    only on the range.
+*/
+template<class Sum>
+double parallel_sum(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                    unsigned int begin,
+                    unsigned int end,
+                    const Sum& f)
+    {
+    auto range_sum = [&](const tbb::blocked_range<unsigned int>& r, double partial)
+        {
+        return partial + f(r.begin(), r.end());
+        };
+    auto join = [](double a, double b)
+        {
+        return a + b;
+        };
+
+    if (exec_conf->isDeterministicReductionEnabled())
+        {
+        return tbb::parallel_deterministic_reduce(tbb::blocked_range<unsigned int>(begin, end, 64),
+                                                  0.0,
+                                                  range_sum,
+                                                  join);
+        }
+    return tbb::parallel_reduce(tbb::blocked_range<unsigned int>(begin, end), 0.0, range_sum, join);
+    }
+
+    } // end namespace detail
+    } // end namespace hoomd
+
+#endif // ENABLE_TBB
+
+#endif // __THREAD_BUFFERS_H__
@@ -50,6 +50,21 @@ class PYBIND11_EXPORT Trigger
 
     virtual bool compute(uint64_t timestep) = 0;
 
+    /** Find the next time step on which the trigger may fire
+     *
+     *  @param timestep Time step to start the search from
+     *  @returns The earliest time step >= `timestep` on which compute() may return `true`, or
+     *      `UINT64_MAX` when the trigger never fires again.
+     *
+     *  Composite triggers use this lower bound to skip evaluating their operands, which may be
+     *  custom triggers implemented in Python. Triggers that cannot predict when they fire return
+     *  `timestep`.
+     */
+    virtual uint64_t nextTimestep(uint64_t timestep)
+        {
+        return timestep;
+        }
+
     private:
     /// Caches the last time step at which the trigger was computed
     uint64_t m_last_timestep;
@@ -83,6 +98,12 @@ class PYBIND11_EXPORT PeriodicTrigger : public Trigger
         return (timestep - m_phase) % m_period == 0;
         }
 
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        uint64_t remainder = (timestep - m_phase) % m_period;
+        return remainder == 0 ? timestep : timestep + (m_period - remainder);
+        }
+
     /// Set the period
     void setPeriod(uint64_t period)
         {
@@ -128,6 +149,11 @@ class PYBIND11_EXPORT BeforeTrigger : public Trigger
         return timestep < m_timestep;
         }
 
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        return timestep < m_timestep ? timestep : UINT64_MAX;
+        }
+
     /// Get the timestep before which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -160,6 +186,11 @@ class PYBIND11_EXPORT OnTrigger : public Trigger
         return timestep == m_timestep;
         }
 
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        return timestep <= m_timestep ? m_timestep : UINT64_MAX;
+        }
+
     /// Get the timestep when the trigger is active.
     uint64_t getTimestep() const
         {
@@ -192,6 +223,15 @@ class PYBIND11_EXPORT AfterTrigger : public Trigger
         return timestep > m_timestep;
         }
 
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        if (timestep > m_timestep)
+            {
+            return timestep;
+            }
+        return m_timestep == UINT64_MAX ? UINT64_MAX : m_timestep + 1;
+        }
+
     /// Get the timestep after which the trigger is active.
     uint64_t getTimestep() const
         {
@@ -260,12 +300,29 @@ class PYBIND11_EXPORT AndTrigger : public Trigger
 
     bool compute(uint64_t timestep)
         {
+        // check all operands that can predict their firing before evaluating any of them
+        if (nextTimestep(timestep) != timestep)
+            {
+            return false;
+            }
+
         return std::all_of(m_triggers.begin(),
                            m_triggers.end(),
                            [timestep](std::shared_ptr<Trigger> t)
                            { return t->operator()(timestep); });
         }
 
+    /// All operands must fire, so no step before the latest next step of any operand fires
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        uint64_t next = timestep;
+        for (auto& t : m_triggers)
+            {
+            next = std::max(next, t->nextTimestep(timestep));
+            }
+        return next;
+        }
+
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
         {
         return m_triggers;
@@ -296,10 +353,22 @@ class PYBIND11_EXPORT OrTrigger : public Trigger
 
     bool compute(uint64_t timestep)
         {
+        // skip the operands that are known not to fire on this step
         return std::any_of(m_triggers.begin(),
                            m_triggers.end(),
                            [timestep](std::shared_ptr<Trigger> t)
-                           { return t->operator()(timestep); });
+                           { return t->nextTimestep(timestep) == timestep && (*t)(timestep); });
+        }
+
+    /// Fires on the earliest next step of any operand
+    uint64_t nextTimestep(uint64_t timestep)
+        {
+        uint64_t next = UINT64_MAX;
+        for (auto& t : m_triggers)
+            {
+            next = std::min(next, t->nextTimestep(timestep));
+            }
+        return next;
         }
 
     const std::vector<std::shared_ptr<Trigger>>& getTriggers() const
@@ -12,6 +12,7 @@
 #include "hoomd/Updater.h"
 
 #ifndef __HIPCC__
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #endif
 
@@ -35,7 +36,7 @@ class UpdaterRemoveDrift : public Updater
         }
 
     //! Set reference positions from a (N_particles, 3) numpy array
-    void setReferencePositions(const pybind11::array_t<double> ref_pos)
+    virtual void setReferencePositions(const pybind11::array_t<double> ref_pos)
         {
         if (ref_pos.ndim() != 2)
             {
@@ -141,13 +142,13 @@ class UpdaterRemoveDrift : public Updater
         }
 
     protected:
-    std::vector<vec3<Scalar>> m_ref_positions;
+    std::vector<vec3<Scalar>> m_ref_positions; //!< Reference positions indexed by tag
     };
 
 namespace detail
     {
 /// Export the UpdaterRemoveDrift to python
-void export_UpdaterRemoveDrift(pybind11::module& m)
+inline void export_UpdaterRemoveDrift(pybind11::module& m)
     {
     pybind11::class_<UpdaterRemoveDrift, Updater, std::shared_ptr<UpdaterRemoveDrift>>(
         m,
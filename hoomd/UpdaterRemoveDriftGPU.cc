@@ -0,0 +1,145 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file UpdaterRemoveDriftGPU.cc
+    \brief Defines the UpdaterRemoveDriftGPU class
+*/
+
+#include "UpdaterRemoveDriftGPU.h"
+#include "UpdaterRemoveDriftGPU.cuh"
+
+namespace hoomd
+    {
+UpdaterRemoveDriftGPU::UpdaterRemoveDriftGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                             std::shared_ptr<Trigger> trigger,
+                                             pybind11::array_t<double> ref_positions)
+    : UpdaterRemoveDrift(sysdef, trigger, ref_positions)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Cannot initialize UpdaterRemoveDriftGPU on a CPU device.");
+        }
+
+    GlobalArray<Scalar4> sum(1, m_exec_conf);
+    m_sum.swap(sum);
+    TAG_ALLOCATION(m_sum);
+
+    // the base class constructor set m_ref_positions before the GPU array existed
+    copyReferencePositions();
+
+    m_tuner_sum.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                       m_exec_conf,
+                                       "remove_drift_sum"));
+    m_tuner_shift.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "remove_drift_shift"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_sum, m_tuner_shift});
+    }
+
+void UpdaterRemoveDriftGPU::setReferencePositions(const pybind11::array_t<double> ref_pos)
+    {
+    UpdaterRemoveDrift::setReferencePositions(ref_pos);
+    copyReferencePositions();
+    }
+
+void UpdaterRemoveDriftGPU::copyReferencePositions()
+    {
+    if (m_ref_positions_gpu.getNumElements() != m_ref_positions.size())
+        {
+        GlobalArray<Scalar3> ref_positions(m_ref_positions.size(), m_exec_conf);
+        m_ref_positions_gpu.swap(ref_positions);
+        TAG_ALLOCATION(m_ref_positions_gpu);
+        }
+
+    ArrayHandle<Scalar3> h_ref_positions(m_ref_positions_gpu,
+                                         access_location::host,
+                                         access_mode::overwrite);
+    for (size_t i = 0; i < m_ref_positions.size(); i++)
+        {
+        h_ref_positions.data[i] = vec_to_scalar3(m_ref_positions[i]);
+        }
+    }
+
+void UpdaterRemoveDriftGPU::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+
+        {
+        ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar3> d_ref_positions(m_ref_positions_gpu,
+                                             access_location::device,
+                                             access_mode::read);
+
+        m_tuner_sum->begin();
+        kernel::gpu_remove_drift_sum(d_sum.data,
+                                     d_pos.data,
+                                     d_tag.data,
+                                     d_ref_positions.data,
+                                     m_pdata->getN(),
+                                     box,
+                                     m_pdata->getOrigin(),
+                                     m_exec_conf->getCachedAllocator(),
+                                     m_tuner_sum->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_sum->end();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        ArrayHandle<Scalar4> h_sum(m_sum, access_location::host, access_mode::readwrite);
+        Scalar r[3] = {h_sum.data[0].x, h_sum.data[0].y, h_sum.data[0].z};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &r[0],
+                      3,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        h_sum.data[0] = make_scalar4(r[0], r[1], r[2], Scalar(0.0));
+        }
+#endif
+
+    ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<int3> d_image(m_pdata->getImages(),
+                              access_location::device,
+                              access_mode::readwrite);
+
+    m_tuner_shift->begin();
+    kernel::gpu_remove_drift_shift(d_pos.data,
+                                   d_image.data,
+                                   d_sum.data,
+                                   m_pdata->getN(),
+                                   m_pdata->getNGlobal(),
+                                   box,
+                                   m_tuner_shift->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_shift->end();
+    }
+
+namespace detail
+    {
+void export_UpdaterRemoveDriftGPU(pybind11::module& m)
+    {
+    pybind11::class_<UpdaterRemoveDriftGPU,
+                     UpdaterRemoveDrift,
+                     std::shared_ptr<UpdaterRemoveDriftGPU>>(m, "UpdaterRemoveDriftGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            pybind11::array_t<double>>());
+    }
+
+    } // end namespace detail
+    } // end namespace hoomd
@@ -0,0 +1,193 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "UpdaterRemoveDriftGPU.cuh"
+
+#include <hipcub/hipcub.hpp>
+
+/*! \file UpdaterRemoveDriftGPU.cu
+    \brief Defines GPU kernel code for removing the average drift. Used by UpdaterRemoveDriftGPU.
+*/
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Component-wise sum of Scalar4 values
+struct remove_drift_sum_op
+    {
+    __host__ __device__ Scalar4 operator()(const Scalar4& a, const Scalar4& b) const
+        {
+        return make_scalar4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+        }
+    };
+
+//! Compute the minimum image displacement of each particle from its reference position
+__global__ void gpu_remove_drift_displacement_kernel(Scalar4* d_dr,
+                                                     const Scalar4* d_pos,
+                                                     const unsigned int* d_tag,
+                                                     const Scalar3* d_ref_pos,
+                                                     const unsigned int N,
+                                                     const BoxDim box,
+                                                     const Scalar3 origin)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    Scalar4 postype = d_pos[idx];
+    Scalar3 pos = make_scalar3(postype.x - origin.x, postype.y - origin.y, postype.z - origin.z);
+    int3 image = make_int3(0, 0, 0);
+    box.wrap(pos, image);
+
+    Scalar3 ref_pos = d_ref_pos[d_tag[idx]];
+    Scalar3 dr = box.minImage(
+        make_scalar3(pos.x - ref_pos.x, pos.y - ref_pos.y, pos.z - ref_pos.z));
+    d_dr[idx] = make_scalar4(dr.x, dr.y, dr.z, Scalar(0.0));
+    }
+
+//! Subtract the average displacement from each particle
+__global__ void gpu_remove_drift_shift_kernel(Scalar4* d_pos,
+                                              int3* d_image,
+                                              const Scalar4* d_sum,
+                                              const unsigned int N,
+                                              const unsigned int N_global,
+                                              const BoxDim box)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    const Scalar4 sum = *d_sum;
+    const Scalar inv_N = Scalar(1.0) / Scalar(N_global);
+
+    Scalar4 postype = d_pos[idx];
+    postype.x -= sum.x * inv_N;
+    postype.y -= sum.y * inv_N;
+    postype.z -= sum.z * inv_N;
+
+    int3 image = d_image[idx];
+    box.wrap(postype, image);
+    d_pos[idx] = postype;
+    d_image[idx] = image;
+    }
+
+/*! \param d_sum Device memory to write the sum to (x, y, z)
+    \param d_pos Particle positions
+    \param d_tag Particle tags
+    \param d_ref_pos Reference positions, indexed by tag
+    \param N Number of local particles
+    \param box Global simulation box
+    \param origin Origin of the global box
+    \param alloc Allocator for temporary storage
+    \param block_size Number of threads per block
+
+    The sum stays on the device. Its w component is zero.
+*/
+hipError_t gpu_remove_drift_sum(Scalar4* d_sum,
+                                const Scalar4* d_pos,
+                                const unsigned int* d_tag,
+                                const Scalar3* d_ref_pos,
+                                const unsigned int N,
+                                const BoxDim& box,
+                                const Scalar3 origin,
+                                CachedAllocator& alloc,
+                                const unsigned int block_size)
+    {
+    ScopedAllocation<Scalar4> d_dr(alloc, N > 0 ? N : 1);
+
+    if (N > 0)
+        {
+        unsigned int max_block_size;
+        hipFuncAttributes attr;
+        hipFuncGetAttributes(&attr, (const void*)gpu_remove_drift_displacement_kernel);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid((N / run_block_size) + 1, 1, 1);
+        dim3 threads(run_block_size, 1, 1);
+
+        hipLaunchKernelGGL((gpu_remove_drift_displacement_kernel),
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_dr.data,
+                           d_pos,
+                           d_tag,
+                           d_ref_pos,
+                           N,
+                           box,
+                           origin);
+        }
+
+    const Scalar4 zero = make_scalar4(0, 0, 0, 0);
+    void* d_temp_storage = NULL;
+    size_t temp_storage_bytes = 0;
+    hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_dr.data,
+                                 d_sum,
+                                 N,
+                                 remove_drift_sum_op(),
+                                 zero);
+    d_temp_storage = alloc.allocate(temp_storage_bytes);
+    hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_dr.data,
+                                 d_sum,
+                                 N,
+                                 remove_drift_sum_op(),
+                                 zero);
+    alloc.deallocate((char*)d_temp_storage);
+
+    return hipSuccess;
+    }
+
+/*! \param d_pos Particle positions
+    \param d_image Particle images
+    \param d_sum Summed displacement of all particles, read on the device
+    \param N Number of local particles
+    \param N_global Number of particles in the system
+    \param box Global simulation box
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_remove_drift_shift(Scalar4* d_pos,
+                                  int3* d_image,
+                                  const Scalar4* d_sum,
+                                  const unsigned int N,
+                                  const unsigned int N_global,
+                                  const BoxDim& box,
+                                  const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_remove_drift_shift_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_remove_drift_shift_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_pos,
+                       d_image,
+                       d_sum,
+                       N,
+                       N_global,
+                       box);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace hoomd
@@ -0,0 +1,42 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file UpdaterRemoveDriftGPU.cuh
+    \brief Declares GPU kernel code for removing the average drift. Used by UpdaterRemoveDriftGPU.
+*/
+
+#ifndef __UPDATER_REMOVE_DRIFT_GPU_CUH__
+#define __UPDATER_REMOVE_DRIFT_GPU_CUH__
+
+namespace hoomd
+    {
+namespace kernel
+    {
+//! Sum the minimum image displacements of the local particles from their reference positions
+hipError_t gpu_remove_drift_sum(Scalar4* d_sum,
+                                const Scalar4* d_pos,
+                                const unsigned int* d_tag,
+                                const Scalar3* d_ref_pos,
+                                const unsigned int N,
+                                const BoxDim& box,
+                                const Scalar3 origin,
+                                CachedAllocator& alloc,
+                                const unsigned int block_size);
+
+//! Subtract the average displacement from the local particles and wrap them into the box
+hipError_t gpu_remove_drift_shift(Scalar4* d_pos,
+                                  int3* d_image,
+                                  const Scalar4* d_sum,
+                                  const unsigned int N,
+                                  const unsigned int N_global,
+                                  const BoxDim& box,
+                                  const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace hoomd
+
+#endif // __UPDATER_REMOVE_DRIFT_GPU_CUH__
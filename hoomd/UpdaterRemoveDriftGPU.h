@@ -0,0 +1,65 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file UpdaterRemoveDriftGPU.h
+    \brief Declares the GPU implementation of UpdaterRemoveDrift
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "UpdaterRemoveDrift.h"
+#include "hoomd/Autotuner.h"
+#include "hoomd/GlobalArray.h"
+
+#ifndef __UPDATER_REMOVE_DRIFT_GPU_H__
+#define __UPDATER_REMOVE_DRIFT_GPU_H__
+
+namespace hoomd
+    {
+/// Removes the average particle drift from the reference positions on the GPU
+/** The displacements are summed with a device wide reduction and the shift kernel reads the sum
+ * from device memory, so a single process update does not synchronize with the host. With domain
+ * decomposition, the sum is copied to the host for the MPI reduction.
+ * \ingroup updaters
+ */
+class PYBIND11_EXPORT UpdaterRemoveDriftGPU : public UpdaterRemoveDrift
+    {
+    public:
+    /// Constructor
+    UpdaterRemoveDriftGPU(std::shared_ptr<SystemDefinition> sysdef,
+                          std::shared_ptr<Trigger> trigger,
+                          pybind11::array_t<double> ref_positions);
+
+    /// Set reference positions from a (N_particles, 3) numpy array
+    virtual void setReferencePositions(const pybind11::array_t<double> ref_pos);
+
+    /// Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    protected:
+    /// Reference positions on the GPU, indexed by tag
+    GlobalArray<Scalar3> m_ref_positions_gpu;
+
+    /// Summed displacement of the particles
+    GlobalArray<Scalar4> m_sum;
+
+    /// Autotuner for block size (sum kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_sum;
+
+    /// Autotuner for block size (shift kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_shift;
+
+    /// Copy m_ref_positions to m_ref_positions_gpu
+    void copyReferencePositions();
+    };
+
+namespace detail
+    {
+/// Export the UpdaterRemoveDriftGPU to python
+void export_UpdaterRemoveDriftGPU(pybind11::module& m);
+    } // end namespace detail
+    } // end namespace hoomd
+
+#endif // __UPDATER_REMOVE_DRIFT_GPU_H__
@@ -3,6 +3,8 @@
 
 #include "Variant.h"
 
+#include <pybind11/stl.h>
+
 namespace hoomd
     {
 //* Trampoline for classes inherited in python
@@ -178,6 +180,32 @@ void export_Variant(pybind11::module& m)
                                     params[4].cast<uint64_t>());
             }));
 
+    pybind11::class_<VariantPiecewise, Variant, std::shared_ptr<VariantPiecewise>>(
+        m,
+        "VariantPiecewise")
+        .def(pybind11::init<const std::vector<std::pair<uint64_t, Scalar>>&>(),
+             pybind11::arg("points"))
+        .def_property("points", &VariantPiecewise::getPoints, &VariantPiecewise::setPoints)
+        .def(pybind11::pickle(
+            [](const VariantPiecewise& variant)
+            { return pybind11::make_tuple(variant.getPoints()); },
+            [](pybind11::tuple params)
+            {
+                return VariantPiecewise(
+                    params[0].cast<std::vector<std::pair<uint64_t, Scalar>>>());
+            }));
+
+    pybind11::class_<VariantSequence, Variant, std::shared_ptr<VariantSequence>>(
+        m,
+        "VariantSequence")
+        .def(pybind11::init<const std::vector<std::shared_ptr<Variant>>&,
+                            const std::vector<uint64_t>&>(),
+             pybind11::arg("variants"),
+             pybind11::arg("t_switch"))
+        .def_property_readonly("_variants", &VariantSequence::getVariants)
+        .def_property_readonly("_t_switch", &VariantSequence::getTSwitch)
+        .def("_set_sequence", &VariantSequence::setSequence);
+
     m.def("_test_variant_call", &testVariantCall);
     m.def("_test_variant_min", &testVariantMin);
     m.def("_test_variant_max", &testVariantMax);
@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <pybind11/pybind11.h>
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 #include "HOOMDMath.h"
 
@@ -593,6 +597,209 @@ class PYBIND11_EXPORT VariantPower : public Variant
     double m_inv_end;
     };
 
+/** Piecewise linear variant
+
+    Variant that interpolates linearly between a list of (time step, value) points. It holds the
+    first value before the first point and the last value after the last point.
+*/
+class PYBIND11_EXPORT VariantPiecewise : public Variant
+    {
+    public:
+    /** Construct a VariantPiecewise.
+
+        @param points The (time step, value) points in increasing time step order.
+    */
+    VariantPiecewise(const std::vector<std::pair<uint64_t, Scalar>>& points)
+        {
+        setPoints(points);
+        }
+
+    /// Evaluate the piecewise linear function.
+    Scalar operator()(uint64_t timestep)
+        {
+        // find the first point after the time step
+        size_t k = std::upper_bound(m_timesteps.begin(), m_timesteps.end(), timestep)
+                   - m_timesteps.begin();
+
+        if (k == 0)
+            {
+            return m_values.front();
+            }
+        else if (k == m_timesteps.size())
+            {
+            return m_values.back();
+            }
+        else
+            {
+            // interpolate between points k-1 and k
+            double s = double(timestep - m_timesteps[k - 1])
+                       / double(m_timesteps[k] - m_timesteps[k - 1]);
+            return m_values[k] * s + m_values[k - 1] * (1.0 - s);
+            }
+        }
+
+    /// Set the points.
+    void setPoints(const std::vector<std::pair<uint64_t, Scalar>>& points)
+        {
+        if (points.empty())
+            {
+            throw std::invalid_argument("points must not be empty");
+            }
+
+        for (size_t k = 1; k < points.size(); k++)
+            {
+            if (points[k].first <= points[k - 1].first)
+                {
+                throw std::invalid_argument("point time steps must be strictly increasing");
+                }
+            // doubles can only represent integers accuracy up to 2**53.
+            if (points[k].first - points[k - 1].first >= 9007199254740992ull)
+                {
+                throw std::invalid_argument("point time steps must be less than 2**53 apart");
+                }
+            }
+
+        m_timesteps.resize(points.size());
+        m_values.resize(points.size());
+        for (size_t k = 0; k < points.size(); k++)
+            {
+            m_timesteps[k] = points[k].first;
+            m_values[k] = points[k].second;
+            }
+        }
+
+    /// Get the points.
+    std::vector<std::pair<uint64_t, Scalar>> getPoints() const
+        {
+        std::vector<std::pair<uint64_t, Scalar>> points(m_timesteps.size());
+        for (size_t k = 0; k < points.size(); k++)
+            {
+            points[k] = std::make_pair(m_timesteps[k], m_values[k]);
+            }
+        return points;
+        }
+
+    /// Return min
+    Scalar min()
+        {
+        return *std::min_element(m_values.begin(), m_values.end());
+        }
+
+    /// Return max
+    Scalar max()
+        {
+        return *std::max_element(m_values.begin(), m_values.end());
+        }
+
+    protected:
+    /// Time steps of the points.
+    std::vector<uint64_t> m_timesteps;
+
+    /// Values of the points.
+    std::vector<Scalar> m_values;
+    };
+
+/** Sequence variant
+
+    Variant that evaluates one of several variants depending on the time step. Variant k is active
+    from t_switch[k-1] until t_switch[k] and is evaluated at the global time step. The minimum and
+    maximum are the extremes over all the variants in the sequence.
+*/
+class PYBIND11_EXPORT VariantSequence : public Variant
+    {
+    public:
+    /** Construct a VariantSequence.
+
+        @param variants The variants in the sequence.
+        @param t_switch The time steps at which the next variant becomes active.
+    */
+    VariantSequence(const std::vector<std::shared_ptr<Variant>>& variants,
+                    const std::vector<uint64_t>& t_switch)
+        {
+        setSequence(variants, t_switch);
+        }
+
+    /// Evaluate the active variant.
+    Scalar operator()(uint64_t timestep)
+        {
+        size_t k = std::upper_bound(m_t_switch.begin(), m_t_switch.end(), timestep)
+                   - m_t_switch.begin();
+        return (*m_variants[k])(timestep);
+        }
+
+    /// Set the variants and switching time steps.
+    void setSequence(const std::vector<std::shared_ptr<Variant>>& variants,
+                     const std::vector<uint64_t>& t_switch)
+        {
+        if (variants.empty())
+            {
+            throw std::invalid_argument("variants must not be empty");
+            }
+        if (t_switch.size() != variants.size() - 1)
+            {
+            throw std::invalid_argument("t_switch must have one fewer element than variants");
+            }
+        for (const auto& variant : variants)
+            {
+            if (!variant)
+                {
+                throw std::invalid_argument("variants must not be None");
+                }
+            }
+        for (size_t k = 1; k < t_switch.size(); k++)
+            {
+            if (t_switch[k] <= t_switch[k - 1])
+                {
+                throw std::invalid_argument("t_switch must be strictly increasing");
+                }
+            }
+
+        m_variants = variants;
+        m_t_switch = t_switch;
+        }
+
+    /// Get the variants.
+    const std::vector<std::shared_ptr<Variant>>& getVariants() const
+        {
+        return m_variants;
+        }
+
+    /// Get the switching time steps.
+    const std::vector<uint64_t>& getTSwitch() const
+        {
+        return m_t_switch;
+        }
+
+    /// Return min
+    Scalar min()
+        {
+        Scalar result = m_variants[0]->min();
+        for (const auto& variant : m_variants)
+            {
+            result = std::min(result, variant->min());
+            }
+        return result;
+        }
+
+    /// Return max
+    Scalar max()
+        {
+        Scalar result = m_variants[0]->max();
+        for (const auto& variant : m_variants)
+            {
+            result = std::max(result, variant->max());
+            }
+        return result;
+        }
+
+    protected:
+    /// The variants in the sequence.
+    std::vector<std::shared_ptr<Variant>> m_variants;
+
+    /// The time steps at which the next variant becomes active.
+    std::vector<uint64_t> m_t_switch;
+    };
+
 namespace detail
     {
 /// Export Variant classes to Python
@@ -0,0 +1,414 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "HOOMDMath.h"
+#include "VectorMath.h"
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "AABB.h"
+#include "AABBTree.h"
+
+#ifndef __WIDE_AABB_TREE_H__
+#define __WIDE_AABB_TREE_H__
+
+/*! \file WideAABBTree.h
+    \brief WideAABBTree build and query methods
+*/
+
+#if !defined(__HIPCC__) && defined(__SSE__)
+#include <immintrin.h>
+#endif
+
+namespace hoomd
+    {
+namespace detail
+    {
+const unsigned int WIDE_NODE_WIDTH = 4; //!< Number of children of a node in a WideAABBTree
+
+#ifndef __HIPCC__
+
+//! Node in a WideAABBTree
+/*! Stores the bounding boxes of all children of the node in structure of arrays layout, so that one
+    SIMD instruction tests the query box against one coordinate of all children at once. A child is
+    either another node, or a leaf that references a contiguous range of particles. Unused children
+    have empty bounds (lower > upper) and never overlap a query.
+*/
+struct alignas(16) WideAABBNode
+    {
+    //! Default constructor
+    WideAABBNode()
+        {
+        for (unsigned int s = 0; s < WIDE_NODE_WIDTH; s++)
+            {
+            lower_x[s] = lower_y[s] = lower_z[s] = std::numeric_limits<float>::infinity();
+            upper_x[s] = upper_y[s] = upper_z[s] = -std::numeric_limits<float>::infinity();
+            child[s] = INVALID_NODE;
+            num_particles[s] = 0;
+            }
+        parent = INVALID_NODE;
+        parent_slot = 0;
+        }
+
+    float lower_x[WIDE_NODE_WIDTH]; //!< x coordinate of the lower corner of each child
+    float lower_y[WIDE_NODE_WIDTH]; //!< y coordinate of the lower corner of each child
+    float lower_z[WIDE_NODE_WIDTH]; //!< z coordinate of the lower corner of each child
+    float upper_x[WIDE_NODE_WIDTH]; //!< x coordinate of the upper corner of each child
+    float upper_y[WIDE_NODE_WIDTH]; //!< y coordinate of the upper corner of each child
+    float upper_z[WIDE_NODE_WIDTH]; //!< z coordinate of the upper corner of each child
+
+    /// Index of the child node, or of the first particle of a leaf child
+    unsigned int child[WIDE_NODE_WIDTH];
+
+    /// Number of particles in a leaf child, 0 for internal children
+    unsigned int num_particles[WIDE_NODE_WIDTH];
+
+    unsigned int parent;      //!< Index of the parent node
+    unsigned int parent_slot; //!< Child slot of this node in the parent node
+    };
+
+//! Wide AABB tree
+/*! A WideAABBTree is a 4-ary bounding volume hierarchy built by collapsing the levels of a binary
+    AABBTree. Each node holds the bounds of its four children in single precision, and a query
+    tests all four with a handful of SSE instructions before descending. Compared to the stackless
+    traversal of the binary tree, a query visits about half as many nodes and evaluates the node
+    overlaps four at a time.
+
+    The single precision bounds are rounded outward, so the tree reports a superset of the particles
+    that the binary tree reports. Callers always perform their own exact distance or overlap check
+    on the returned particles.
+
+    The tree supports the following operations:
+
+    - build : Collapse a binary AABBTree. Runs in O(N) time. Call it after every buildTree() or
+      refit() of the binary tree.
+    - query : Call a function for every particle in a leaf that overlaps the query AABB.
+    - update : Grow the bounds of the leaf that contains a particle and its parents, as
+      AABBTree::update() does.
+
+    **Implementation details**
+
+    Each wide node is formed by starting with the two children of a binary node and repeatedly
+    replacing the internal child with the largest surface area by its own two children until there
+    are WIDE_NODE_WIDTH children or all are leaves. The particles of all leaves are stored in one
+    contiguous array in traversal order. Queries use a local stack sized from the tree depth.
+*/
+class PYBIND11_EXPORT WideAABBTree
+    {
+    public:
+    //! Construct an empty WideAABBTree
+    WideAABBTree() : m_max_depth(0) { }
+
+    //! Build the tree from a binary AABBTree
+    inline void build(const AABBTree& tree);
+
+    //! Call a function for each particle in the leaves that overlap the query AABB
+    template<class Callback> inline unsigned int query(const AABB& aabb, Callback&& callback) const;
+
+    //! Update the AABB of a particle
+    inline void update(unsigned int idx, const AABB& aabb);
+
+    //! Get the number of particles in the tree
+    inline unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_particle_slot.size();
+        }
+
+    //! Get the number of nodes
+    inline unsigned int getNumNodes() const
+        {
+        return (unsigned int)m_nodes.size();
+        }
+
+    private:
+    std::vector<WideAABBNode> m_nodes;        //!< The nodes of the tree, the root is node 0
+    std::vector<unsigned int> m_particles;    //!< Particle indices of all leaves
+    std::vector<unsigned int> m_tags;         //!< Particle tags of all leaves
+    std::vector<unsigned int> m_particle_slot; //!< node * WIDE_NODE_WIDTH + slot of each particle
+    unsigned int m_max_depth;                 //!< Number of node levels in the tree
+
+    /// Number of stack entries available without dynamic allocation in query()
+    static const unsigned int STACK_SIZE = 128;
+
+    //! Round a lower bound down to single precision
+    static inline float roundDown(Scalar x)
+        {
+        float f = float(x);
+        if (Scalar(f) > x)
+            f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+        return f;
+        }
+
+    //! Round an upper bound up to single precision
+    static inline float roundUp(Scalar x)
+        {
+        float f = float(x);
+        if (Scalar(f) < x)
+            f = std::nextafter(f, std::numeric_limits<float>::infinity());
+        return f;
+        }
+
+    //! Grow the bounds of a child of a node to include an AABB
+    /*! \returns true if the bounds changed
+     */
+    inline bool growSlot(WideAABBNode& node, unsigned int s, const AABB& aabb)
+        {
+        vec3<Scalar> lower = aabb.getLower();
+        vec3<Scalar> upper = aabb.getUpper();
+        float lx = roundDown(lower.x), ly = roundDown(lower.y), lz = roundDown(lower.z);
+        float ux = roundUp(upper.x), uy = roundUp(upper.y), uz = roundUp(upper.z);
+
+        if (lx >= node.lower_x[s] && ly >= node.lower_y[s] && lz >= node.lower_z[s]
+            && ux <= node.upper_x[s] && uy <= node.upper_y[s] && uz <= node.upper_z[s])
+            return false;
+
+        node.lower_x[s] = std::min(node.lower_x[s], lx);
+        node.lower_y[s] = std::min(node.lower_y[s], ly);
+        node.lower_z[s] = std::min(node.lower_z[s], lz);
+        node.upper_x[s] = std::max(node.upper_x[s], ux);
+        node.upper_y[s] = std::max(node.upper_y[s], uy);
+        node.upper_z[s] = std::max(node.upper_z[s], uz);
+        return true;
+        }
+
+    //! Get the surface area of an AABB
+    static inline Scalar surfaceArea(const AABB& aabb)
+        {
+        vec3<Scalar> length = aabb.getUpper() - aabb.getLower();
+        return Scalar(2.0) * (length.x * length.y + length.y * length.z + length.z * length.x);
+        }
+    };
+
+/*! \param tree Binary tree to collapse
+
+    The nodes are built breadth first from a work list, so no recursive calls are needed. Every
+    wide node is allocated before its children.
+*/
+inline void WideAABBTree::build(const AABBTree& tree)
+    {
+    m_nodes.clear();
+    m_particles.clear();
+    m_tags.clear();
+    m_particle_slot.assign(tree.getNumParticles(), INVALID_NODE);
+    m_max_depth = 0;
+
+    if (tree.getNumNodes() == 0)
+        return;
+
+    m_particles.reserve(tree.getNumParticles());
+    m_tags.reserve(tree.getNumParticles());
+
+    struct WorkItem
+        {
+        unsigned int binary_node; //!< Binary node that the wide node collapses
+        unsigned int wide_node;   //!< Index of the wide node
+        unsigned int depth;       //!< Depth of the wide node
+        };
+
+    std::vector<WorkItem> work;
+    m_nodes.push_back(WideAABBNode());
+    work.push_back({0, 0, 1});
+
+    for (size_t w = 0; w < work.size(); w++)
+        {
+        const WorkItem item = work[w];
+        m_max_depth = std::max(m_max_depth, item.depth);
+
+        // collect up to WIDE_NODE_WIDTH children by expanding the largest internal candidate
+        unsigned int candidates[WIDE_NODE_WIDTH];
+        unsigned int n_candidates = 0;
+        if (tree.isNodeLeaf(item.binary_node))
+            {
+            candidates[n_candidates++] = item.binary_node;
+            }
+        else
+            {
+            candidates[n_candidates++] = tree.getNode(item.binary_node).left;
+            candidates[n_candidates++] = tree.getNode(item.binary_node).right;
+            }
+
+        while (n_candidates < WIDE_NODE_WIDTH)
+            {
+            unsigned int expand = INVALID_NODE;
+            Scalar max_area = -1;
+            for (unsigned int c = 0; c < n_candidates; c++)
+                {
+                if (!tree.isNodeLeaf(candidates[c]))
+                    {
+                    Scalar area = surfaceArea(tree.getNodeAABB(candidates[c]));
+                    if (area > max_area)
+                        {
+                        max_area = area;
+                        expand = c;
+                        }
+                    }
+                }
+
+            if (expand == INVALID_NODE)
+                break;
+
+            const AABBNode& expanded = tree.getNode(candidates[expand]);
+            candidates[expand] = expanded.left;
+            candidates[n_candidates++] = expanded.right;
+            }
+
+        // fill in the child slots, allocating nodes for the internal children
+        for (unsigned int s = 0; s < n_candidates; s++)
+            {
+            const unsigned int b = candidates[s];
+            growSlot(m_nodes[item.wide_node], s, tree.getNodeAABB(b));
+
+            if (tree.isNodeLeaf(b))
+                {
+                m_nodes[item.wide_node].child[s] = (unsigned int)m_particles.size();
+                m_nodes[item.wide_node].num_particles[s] = tree.getNodeNumParticles(b);
+                for (unsigned int j = 0; j < tree.getNodeNumParticles(b); j++)
+                    {
+                    const unsigned int particle = tree.getNodeParticle(b, j);
+                    m_particles.push_back(particle);
+                    m_tags.push_back(tree.getNodeParticleTag(b, j));
+                    m_particle_slot[particle] = item.wide_node * WIDE_NODE_WIDTH + s;
+                    }
+                }
+            else
+                {
+                const unsigned int child = (unsigned int)m_nodes.size();
+                m_nodes.push_back(WideAABBNode());
+                m_nodes[child].parent = item.wide_node;
+                m_nodes[child].parent_slot = s;
+                m_nodes[item.wide_node].child[s] = child;
+                work.push_back({b, child, item.depth + 1});
+                }
+            }
+        }
+    }
+
+/*! \param aabb The AABB to query
+    \param callback Function called as callback(particle, tag) for every particle in an overlapping
+           leaf. Return false to stop the traversal early.
+    \returns the number of nodes tested during the traversal
+*/
+template<class Callback>
+inline unsigned int WideAABBTree::query(const AABB& aabb, Callback&& callback) const
+    {
+    if (m_nodes.empty())
+        return 0;
+
+    const vec3<Scalar> lower = aabb.getLower();
+    const vec3<Scalar> upper = aabb.getUpper();
+
+    // the stack holds at most WIDE_NODE_WIDTH - 1 entries per level plus the root
+    unsigned int local_stack[STACK_SIZE];
+    std::vector<unsigned int> heap_stack;
+    unsigned int* stack = local_stack;
+    if ((WIDE_NODE_WIDTH - 1) * m_max_depth + 1 > STACK_SIZE)
+        {
+        heap_stack.resize((WIDE_NODE_WIDTH - 1) * m_max_depth + 1);
+        stack = heap_stack.data();
+        }
+
+#if defined(__SSE__)
+    const __m128 q_lower_x = _mm_set1_ps(roundDown(lower.x));
+    const __m128 q_lower_y = _mm_set1_ps(roundDown(lower.y));
+    const __m128 q_lower_z = _mm_set1_ps(roundDown(lower.z));
+    const __m128 q_upper_x = _mm_set1_ps(roundUp(upper.x));
+    const __m128 q_upper_y = _mm_set1_ps(roundUp(upper.y));
+    const __m128 q_upper_z = _mm_set1_ps(roundUp(upper.z));
+#else
+    const float q_lower_x = roundDown(lower.x);
+    const float q_lower_y = roundDown(lower.y);
+    const float q_lower_z = roundDown(lower.z);
+    const float q_upper_x = roundUp(upper.x);
+    const float q_upper_y = roundUp(upper.y);
+    const float q_upper_z = roundUp(upper.z);
+#endif
+
+    unsigned int node_tests = 0;
+    unsigned int stack_size = 0;
+    stack[stack_size++] = 0;
+
+    while (stack_size > 0)
+        {
+        const WideAABBNode& node = m_nodes[stack[--stack_size]];
+        node_tests++;
+
+        // test the query against all children of the node at once
+#if defined(__SSE__)
+        __m128 overlap = _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.lower_x), q_upper_x),
+                                    _mm_cmpge_ps(_mm_load_ps(node.upper_x), q_lower_x));
+        overlap = _mm_and_ps(overlap,
+                             _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.lower_y), q_upper_y),
+                                        _mm_cmpge_ps(_mm_load_ps(node.upper_y), q_lower_y)));
+        overlap = _mm_and_ps(overlap,
+                             _mm_and_ps(_mm_cmple_ps(_mm_load_ps(node.lower_z), q_upper_z),
+                                        _mm_cmpge_ps(_mm_load_ps(node.upper_z), q_lower_z)));
+        const unsigned int mask = (unsigned int)_mm_movemask_ps(overlap);
+#else
+        unsigned int mask = 0;
+        for (unsigned int s = 0; s < WIDE_NODE_WIDTH; s++)
+            {
+            if (node.lower_x[s] <= q_upper_x && node.upper_x[s] >= q_lower_x
+                && node.lower_y[s] <= q_upper_y && node.upper_y[s] >= q_lower_y
+                && node.lower_z[s] <= q_upper_z && node.upper_z[s] >= q_lower_z)
+                mask |= 1u << s;
+            }
+#endif
+
+        // visit the children in slot order: report leaves now, defer nodes to the stack
+        for (unsigned int s = WIDE_NODE_WIDTH; s > 0; s--)
+            {
+            const unsigned int slot = s - 1;
+            if (!(mask & (1u << slot)) || node.num_particles[slot] != 0)
+                continue;
+            stack[stack_size++] = node.child[slot];
+            }
+
+        for (unsigned int slot = 0; slot < WIDE_NODE_WIDTH; slot++)
+            {
+            if (!(mask & (1u << slot)) || node.num_particles[slot] == 0)
+                continue;
+
+            const unsigned int first = node.child[slot];
+            const unsigned int last = first + node.num_particles[slot];
+            for (unsigned int k = first; k < last; k++)
+                {
+                if (!callback(m_particles[k], m_tags[k]))
+                    return node_tests;
+                }
+            }
+        }
+
+    return node_tests;
+    }
+
+/*! \param idx Particle index to update
+    \param aabb New AABB for particle *idx*
+
+    Grow the bounds of the leaf containing particle *idx* and of all its parents to include *aabb*.
+    Like AABBTree::update(), this never shrinks the bounds, so the tree should be built again from
+    the binary tree after it is rebuilt or refit.
+*/
+inline void WideAABBTree::update(unsigned int idx, const AABB& aabb)
+    {
+    assert(idx < m_particle_slot.size());
+    assert(m_particle_slot[idx] != INVALID_NODE);
+
+    unsigned int node = m_particle_slot[idx] / WIDE_NODE_WIDTH;
+    unsigned int slot = m_particle_slot[idx] % WIDE_NODE_WIDTH;
+
+    // the bounds of the parents contain the bounds of their children, so stop at the first slot
+    // that already contains the AABB
+    while (node != INVALID_NODE && growSlot(m_nodes[node], slot, aabb))
+        {
+        slot = m_nodes[node].parent_slot;
+        node = m_nodes[node].parent;
+        }
+    }
+
+#endif // __HIPCC__
+
+    } // end namespace detail
+    } // end namespace hoomd
+
+#endif // __WIDE_AABB_TREE_H__
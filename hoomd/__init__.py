@@ -27,6 +27,10 @@ methods, and variables in the API.
 * `hoomd.hpmc` - Hard particle Monte Carlo.
 * `hoomd.md` - Molecular dynamics.
 
+`hoomd` imports these subpackages and their extension modules on first access,
+such as ``hoomd.md.Integrator`` or ``import hoomd.md``, so that scripts only
+pay the import time of the subpackages they use.
+
 See Also:
     Tutorial: :doc:`tutorial/00-Introducing-HOOMD-blue/00-index`
 
@@ -38,6 +42,7 @@ so that open gsd files have a chance to flush write buffers
 `signal.signal` to adjust this behavior as needed.
 """
 import sys
+import importlib
 import pathlib
 import os
 import signal
@@ -75,10 +80,6 @@ from hoomd import _hoomd
 from hoomd import tune
 from hoomd import logging
 from hoomd import custom
-if version.md_built:
-    from hoomd import md
-if version.hpmc_built:
-    from hoomd import hpmc
 # if version.metal_built:
 #     from hoomd import metal
 # if version.mpcd_built:
@@ -89,6 +90,26 @@ from hoomd.state import State
 from hoomd.operations import Operations
 from hoomd.snapshot import Snapshot
 
+# Subpackages that load large extension modules are imported on first access.
+_lazy_subpackages = set()
+if version.md_built:
+    _lazy_subpackages.add('md')
+if version.hpmc_built:
+    _lazy_subpackages.add('hpmc')
+
+
+def __getattr__(name):
+    """Import the lazily loaded subpackages on first access."""
+    if name in _lazy_subpackages:
+        return importlib.import_module('hoomd.' + name)
+    raise AttributeError(f"module 'hoomd' has no attribute '{name}'")
+
+
+def __dir__():
+    """List the module attributes, including the lazy subpackages."""
+    return sorted(set(globals()) | _lazy_subpackages)
+
+
 _default_excepthook = sys.excepthook
 
 
@@ -0,0 +1,83 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/Communicator.h"
+#include "hoomd/DomainDecomposition.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/CommunicatorGPU.h"
+#endif
+
+/*! \file benchmark_communicator.cc
+    \brief Times the particle migration and ghost exchange of the Communicator
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::benchmarks;
+
+//! Supplies a constant ghost layer width to the communicator
+struct ghost_layer_width
+    {
+    ghost_layer_width(Scalar width) : w(width) { }
+
+    Scalar get(unsigned int type)
+        {
+        return w;
+        }
+
+    Scalar w; //!< Ghost layer width
+    };
+
+//! Time the communicator in a LJ liquid decomposed over all ranks
+/*! The ghost layer width is the LJ cutoff plus the neighbor list buffer.
+ */
+void benchmark_lj_liquid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                         const BenchmarkOptions& options,
+                         BenchmarkReport& report)
+    {
+    const std::string system = "lj_liquid";
+    auto snapshot = makeLatticeSnapshot(options.n, Scalar(0.85), Scalar(0.1));
+    auto decomposition
+        = std::make_shared<DomainDecomposition>(exec_conf, snapshot->global_box->getL());
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf, decomposition);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    std::shared_ptr<Communicator> comm;
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        comm = std::make_shared<CommunicatorGPU>(sysdef, decomposition);
+    else
+#endif
+        comm = std::make_shared<Communicator>(sysdef, decomposition);
+    sysdef->setCommunicator(comm);
+
+    ghost_layer_width g(Scalar(2.9));
+    comm->getGhostLayerWidthRequestSignal().connect<ghost_layer_width, &ghost_layer_width::get>(g);
+
+    CommFlags flags(0);
+    flags[comm_flag::position] = 1;
+    flags[comm_flag::tag] = 1;
+    comm->setFlags(flags);
+
+    report.run("Communicator",
+               system,
+               N,
+               [&](uint64_t timestep)
+               {
+                   comm->migrateParticles();
+                   comm->exchangeGhosts();
+               });
+    }
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         { benchmark_lj_liquid(exec_conf, options, report); });
+    }
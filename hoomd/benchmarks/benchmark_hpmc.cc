@@ -0,0 +1,61 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/hpmc/IntegratorHPMCMono.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+
+/*! \file benchmark_hpmc.cc
+    \brief Times the HPMC sphere integrator in a hard sphere fluid
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::hpmc;
+using namespace hoomd::benchmarks;
+
+//! Time IntegratorHPMCMono<ShapeSphere> in a hard sphere fluid
+/*! The spheres have unit diameter and a packing fraction of 0.45. The benchmark always runs on
+    the CPU because the GPU integrator requires a cell list and auxiliary arrays that are managed by
+    the python layer.
+*/
+void benchmark_hard_sphere_fluid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                 const BenchmarkOptions& options,
+                                 BenchmarkReport& report)
+    {
+    const std::string system = "hard_sphere_fluid";
+    const Scalar packing_fraction = Scalar(0.45);
+    const Scalar density = packing_fraction / (Scalar(M_PI) / Scalar(6.0));
+
+    // the lattice spacing is 1.05, so small displacements do not create overlaps
+    auto snapshot = makeLatticeSnapshot(options.n, density, Scalar(0.02));
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    auto mc = std::make_shared<IntegratorHPMCMono<ShapeSphere>>(sysdef);
+    SphereParams params;
+    params.radius = ShortReal(0.5);
+    params.ignore = false;
+    params.isOriented = false;
+    mc->setParam(0, params);
+    mc->setD("A", Scalar(0.1));
+    mc->prepRun(0);
+
+    report.run(
+        "IntegratorHPMCMonoSphere",
+        system,
+        N,
+        [&](uint64_t timestep) { mc->update(timestep); },
+        {mc});
+    }
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         { benchmark_hard_sphere_fluid(exec_conf, options, report); });
+    }
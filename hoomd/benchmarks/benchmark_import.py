@@ -0,0 +1,106 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Benchmark the time to import hoomd and create the first Simulation.
+
+Each stage runs in a fresh Python interpreter, so the measured time includes
+loading the extension modules from the file system. Run from the build
+directory with the hoomd package on the Python path, for example::
+
+    PYTHONPATH=. python3 hoomd/benchmarks/benchmark_import.py --repeat 10 \\
+        --output import.json
+
+The JSON report lists the minimum and mean time of each stage over the
+repeats.
+"""
+
+import argparse
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+
+# name, code, and the subpackage the stage requires
+STAGES = [
+    ('import hoomd', 'import hoomd', None),
+    ('import hoomd.md', 'import hoomd.md', 'md'),
+    ('import hoomd.hpmc', 'import hoomd.hpmc', 'hpmc'),
+    ('create Simulation', 'import hoomd\n'
+     'hoomd.Simulation(device=hoomd.device.CPU(), seed=1)', None),
+]
+
+TIMER = """import time
+_start = time.perf_counter()
+{code}
+print(time.perf_counter() - _start)
+"""
+
+
+def run_python(code):
+    """Run code in a fresh interpreter and return its last line of output."""
+    # run outside of the source directory so that the built package is used
+    result = subprocess.run([sys.executable, '-c', code],
+                            cwd=tempfile.gettempdir(),
+                            env=dict(os.environ),
+                            capture_output=True,
+                            text=True,
+                            check=True)
+    return result.stdout.strip().splitlines()[-1]
+
+
+def main():
+    """Time the stages and write the report."""
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--repeat',
+                        type=int,
+                        default=5,
+                        help='Number of fresh interpreters per stage')
+    parser.add_argument('--output',
+                        default='',
+                        help='File to write the JSON report to, stdout when '
+                        'empty')
+    args = parser.parse_args()
+    if args.repeat <= 0:
+        parser.error('--repeat must be positive')
+
+    version, md_built, hpmc_built = run_python(
+        'import hoomd\n'
+        'print(hoomd.version.version, hoomd.version.md_built, '
+        'hoomd.version.hpmc_built)').split()
+    built = {'md': md_built == 'True', 'hpmc': hpmc_built == 'True'}
+
+    benchmarks = []
+    for name, code, subpackage in STAGES:
+        if subpackage is not None and not built[subpackage]:
+            continue
+
+        seconds = [
+            float(run_python(TIMER.format(code=code)))
+            for i in range(args.repeat)
+        ]
+        benchmarks.append({
+            'name': name,
+            'seconds': min(seconds),
+            'seconds_mean': statistics.mean(seconds),
+        })
+        print(f'{name}: {min(seconds):.3f} s', file=sys.stderr)
+
+    report = json.dumps(
+        {
+            'hoomd_version': version,
+            'repeat': args.repeat,
+            'benchmarks': benchmarks
+        },
+        indent=2)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write(report + '\n')
+    else:
+        print(report)
+
+
+if __name__ == '__main__':
+    main()
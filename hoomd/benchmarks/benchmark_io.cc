@@ -0,0 +1,73 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/DCDDumpWriter.h"
+#include "hoomd/GSDDumpWriter.h"
+#include "hoomd/Trigger.h"
+#include "hoomd/filter/ParticleFilterAll.h"
+
+#include <pybind11/embed.h>
+
+#include <cstdio>
+
+/*! \file benchmark_io.cc
+    \brief Times the trajectory writers
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::benchmarks;
+
+//! Time the GSD and DCD writers writing a frame of a LJ liquid on every step
+/*! The files are written to the current directory and removed after the benchmark. GSDDumpWriter
+    holds the logged quantities in Python objects, so this benchmark starts an embedded interpreter.
+*/
+void benchmark_lj_liquid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                         const BenchmarkOptions& options,
+                         BenchmarkReport& report)
+    {
+    pybind11::scoped_interpreter guard;
+
+    const std::string system = "lj_liquid";
+    const std::string gsd_filename = "benchmark_io.gsd";
+    const std::string dcd_filename = "benchmark_io.dcd";
+    auto snapshot = makeLatticeSnapshot(options.n, Scalar(0.85), Scalar(0.1));
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+    auto group = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+    auto trigger = std::make_shared<PeriodicTrigger>(1);
+
+        {
+        auto gsd = std::make_shared<GSDDumpWriter>(sysdef, trigger, gsd_filename, group, "wb");
+        report.run("GSDDumpWriter",
+                   system,
+                   N,
+                   [&](uint64_t timestep) { gsd->analyze(timestep); });
+        }
+
+        {
+        auto dcd = std::make_shared<DCDDumpWriter>(sysdef, trigger, dcd_filename, 1, group, true);
+        report.run("DCDDumpWriter",
+                   system,
+                   N,
+                   [&](uint64_t timestep) { dcd->analyze(timestep); });
+        }
+
+    if (exec_conf->isRoot())
+        {
+        std::remove(gsd_filename.c_str());
+        std::remove(dcd_filename.c_str());
+        }
+    }
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         { benchmark_lj_liquid(exec_conf, options, report); });
+    }
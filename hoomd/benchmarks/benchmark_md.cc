@@ -0,0 +1,289 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/CellList.h"
+#include "hoomd/filter/ParticleFilterAll.h"
+#include "hoomd/md/EvaluatorBondHarmonic.h"
+#include "hoomd/md/EvaluatorPairEwald.h"
+#include "hoomd/md/EvaluatorPairLJ.h"
+#include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListStencil.h"
+#include "hoomd/md/NeighborListTree.h"
+#include "hoomd/md/PPPMForceCompute.h"
+#include "hoomd/md/PotentialBond.h"
+#include "hoomd/md/PotentialPair.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/CellListGPU.h"
+#include "hoomd/md/NeighborListGPUBinned.h"
+#include "hoomd/md/NeighborListGPUStencil.h"
+#include "hoomd/md/NeighborListGPUTree.h"
+#include "hoomd/md/PPPMForceComputeGPU.h"
+#include "hoomd/md/PotentialBondGPU.h"
+#include "hoomd/md/PotentialPairGPU.h"
+#endif
+
+/*! \file benchmark_md.cc
+    \brief Times the MD cell lists, neighbor lists, and force computes on standard systems
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::benchmarks;
+
+//! Number density of the LJ liquid and polymer melt
+const Scalar liquid_density = Scalar(0.85);
+
+//! Cutoff radius of the LJ potential
+const Scalar lj_r_cut = Scalar(2.5);
+
+//! Neighbor list buffer
+const Scalar r_buff = Scalar(0.4);
+
+//! Number of monomers in each polymer chain
+const unsigned int chain_length = 10;
+
+//! Construct a neighbor list on the CPU or GPU
+/*! \param sysdef System definition
+    \param method Neighbor list method: Binned, Stencil, or Tree
+*/
+std::shared_ptr<NeighborList> make_nlist(std::shared_ptr<SystemDefinition> sysdef,
+                                         const std::string& method)
+    {
+#ifdef ENABLE_HIP
+    if (sysdef->getParticleData()->getExecConf()->isCUDAEnabled())
+        {
+        if (method == "Binned")
+            return std::make_shared<NeighborListGPUBinned>(sysdef, r_buff);
+        if (method == "Stencil")
+            return std::make_shared<NeighborListGPUStencil>(sysdef, r_buff);
+        return std::make_shared<NeighborListGPUTree>(sysdef, r_buff);
+        }
+#endif
+    if (method == "Binned")
+        return std::make_shared<NeighborListBinned>(sysdef, r_buff);
+    if (method == "Stencil")
+        return std::make_shared<NeighborListStencil>(sysdef, r_buff);
+    return std::make_shared<NeighborListTree>(sysdef, r_buff);
+    }
+
+//! Construct a pair potential on the CPU or GPU
+template<class evaluator>
+std::shared_ptr<PotentialPair<evaluator>> make_pair(std::shared_ptr<SystemDefinition> sysdef,
+                                                    std::shared_ptr<NeighborList> nlist)
+    {
+#ifdef ENABLE_HIP
+    if (sysdef->getParticleData()->getExecConf()->isCUDAEnabled())
+        return std::make_shared<PotentialPairGPU<evaluator>>(sysdef, nlist);
+#endif
+    return std::make_shared<PotentialPair<evaluator>>(sysdef, nlist);
+    }
+
+//! Construct the LJ pair potential used by the liquid and the polymer melt
+std::shared_ptr<PotentialPair<EvaluatorPairLJ>> make_lj(std::shared_ptr<SystemDefinition> sysdef,
+                                                        std::shared_ptr<NeighborList> nlist)
+    {
+    auto lj = make_pair<EvaluatorPairLJ>(sysdef, nlist);
+    bool managed = sysdef->getParticleData()->getExecConf()->isCUDAEnabled();
+    lj->setParams(0, 0, EvaluatorPairLJ::param_type(Scalar(1.0), Scalar(1.0), managed));
+    lj->setRcut(0, 0, lj_r_cut);
+    return lj;
+    }
+
+//! Time the cell list, neighbor lists, and LJ force compute in a LJ liquid
+void benchmark_lj_liquid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                         const BenchmarkOptions& options,
+                         BenchmarkReport& report)
+    {
+    const std::string system = "lj_liquid";
+    auto snapshot = makeLatticeSnapshot(options.n, liquid_density, Scalar(0.1));
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+        {
+        std::shared_ptr<CellList> cl;
+#ifdef ENABLE_HIP
+        if (exec_conf->isCUDAEnabled())
+            cl = std::make_shared<CellListGPU>(sysdef);
+        else
+#endif
+            cl = std::make_shared<CellList>(sysdef);
+        cl->setNominalWidth(lj_r_cut + r_buff);
+        report.run(
+            "CellList",
+            system,
+            N,
+            [&](uint64_t timestep) { cl->compute(timestep); },
+            {cl});
+        }
+
+    for (const std::string method : {"Binned", "Stencil", "Tree"})
+        {
+        std::shared_ptr<NeighborList> nlist = make_nlist(sysdef, method);
+        auto lj = make_lj(sysdef, nlist);
+
+        // rebuild the neighbor list on every step
+        report.run("NeighborList" + method,
+                   system,
+                   N,
+                   [&](uint64_t timestep)
+                   {
+                       nlist->forceUpdate();
+                       nlist->compute(timestep);
+                   },
+                   {nlist});
+
+        // particles do not move, so the neighbor list is only built on the first step
+        if (method == "Binned")
+            {
+            report.run(
+                "PotentialPairLJ",
+                system,
+                N,
+                [&](uint64_t timestep) { lj->compute(timestep); },
+                {lj, nlist});
+            }
+        }
+    }
+
+//! Time the bond and LJ force computes in a melt of linear polymers
+void benchmark_polymer_melt(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+    {
+    const std::string system = "polymer_melt";
+    if (options.n % chain_length != 0)
+        throw std::invalid_argument("--n must be a multiple of the chain length "
+                                    + std::to_string(chain_length));
+
+    // chains run along the x rows of the lattice
+    auto snapshot = makeLatticeSnapshot(options.n, liquid_density, Scalar(0.05));
+    const unsigned int n_chains = snapshot->particle_data.size / chain_length;
+    snapshot->bond_data.type_mapping.push_back("A");
+    snapshot->bond_data.resize(n_chains * (chain_length - 1));
+    unsigned int n_bonds = 0;
+    for (unsigned int chain = 0; chain < n_chains; chain++)
+        {
+        for (unsigned int monomer = 0; monomer + 1 < chain_length; monomer++)
+            {
+            unsigned int i = chain * chain_length + monomer;
+            snapshot->bond_data.groups[n_bonds].tag[0] = i;
+            snapshot->bond_data.groups[n_bonds].tag[1] = i + 1;
+            snapshot->bond_data.type_id[n_bonds] = 0;
+            n_bonds++;
+            }
+        }
+
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+
+    std::shared_ptr<PotentialBond<EvaluatorBondHarmonic, BondData>> bond;
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        bond = std::make_shared<PotentialBondGPU<EvaluatorBondHarmonic, BondData>>(sysdef);
+    else
+#endif
+        bond = std::make_shared<PotentialBond<EvaluatorBondHarmonic, BondData>>(sysdef);
+    bond->setParams(0, harmonic_params(Scalar(300.0), std::cbrt(Scalar(1.0) / liquid_density)));
+    report.run(
+        "PotentialBondHarmonic",
+        system,
+        N,
+        [&](uint64_t timestep) { bond->compute(timestep); },
+        {bond});
+
+    auto nlist = make_nlist(sysdef, "Binned");
+    for (unsigned int i = 0; i < snapshot->bond_data.size; i++)
+        {
+        const BondData::members_t& bond_members = snapshot->bond_data.groups[i];
+        nlist->addExclusion(bond_members.tag[0], bond_members.tag[1]);
+        }
+    auto lj = make_lj(sysdef, nlist);
+    report.run(
+        "PotentialPairLJ",
+        system,
+        N,
+        [&](uint64_t timestep) { lj->compute(timestep); },
+        {lj, nlist});
+    }
+
+//! Time the PPPM and real space Ewald force computes in a charged system
+/*! The system is a rock salt lattice of +1 and -1 charges at the density of SPC/E water sites.
+ */
+void benchmark_charged(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                       const BenchmarkOptions& options,
+                       BenchmarkReport& report)
+    {
+    const std::string system = "charged";
+    if (options.n % 2 != 0)
+        throw std::invalid_argument("--n must be even");
+
+    const Scalar density = Scalar(0.1);
+    const Scalar r_cut = Scalar(3.0);
+    const Scalar kappa = Scalar(1.0);
+    const unsigned int order = 5;
+
+    auto snapshot = makeLatticeSnapshot(options.n, density, Scalar(0.1));
+    for (unsigned int i = 0; i < snapshot->particle_data.size; i++)
+        {
+        unsigned int x = i % options.n;
+        unsigned int y = (i / options.n) % options.n;
+        unsigned int z = i / (options.n * options.n);
+        snapshot->particle_data.charge[i] = ((x + y + z) % 2 == 0) ? Scalar(1.0) : Scalar(-1.0);
+        }
+
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getParticleData()->getNGlobal();
+    auto nlist = make_nlist(sysdef, "Binned");
+
+    auto ewald = make_pair<EvaluatorPairEwald>(sysdef, nlist);
+    EvaluatorPairEwald::param_type ewald_params;
+    ewald_params.kappa = kappa;
+    ewald_params.alpha = Scalar(0.0);
+    ewald->setParams(0, 0, ewald_params);
+    ewald->setRcut(0, 0, r_cut);
+    report.run(
+        "PotentialPairEwald",
+        system,
+        N,
+        [&](uint64_t timestep) { ewald->compute(timestep); },
+        {ewald, nlist});
+
+    auto group = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+    std::shared_ptr<PPPMForceCompute> pppm;
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        pppm = std::make_shared<PPPMForceComputeGPU>(sysdef, nlist, group);
+    else
+#endif
+        pppm = std::make_shared<PPPMForceCompute>(sysdef, nlist, group);
+
+    // choose a mesh spacing of about one particle spacing
+    unsigned int n_mesh = 1;
+    while (n_mesh < options.n)
+        n_mesh *= 2;
+    pppm->setParams(n_mesh, n_mesh, n_mesh, order, kappa, r_cut);
+    report.run(
+        "PPPMForceCompute",
+        system,
+        N,
+        [&](uint64_t timestep) { pppm->compute(timestep); },
+        {pppm});
+    }
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         {
+                             benchmark_lj_liquid(exec_conf, options, report);
+                             benchmark_polymer_melt(exec_conf, options, report);
+                             benchmark_charged(exec_conf, options, report);
+                         });
+    }
@@ -0,0 +1,134 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/mpcd/CellList.h"
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
+#include "hoomd/mpcd/SRDCollisionMethod.h"
+#include "hoomd/mpcd/Sorter.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/mpcd/CellListGPU.h"
+#include "hoomd/mpcd/ConfinedStreamingMethodGPU.h"
+#include "hoomd/mpcd/SRDCollisionMethodGPU.h"
+#include "hoomd/mpcd/SorterGPU.h"
+#endif
+
+/*! \file benchmark_mpcd.cc
+    \brief Times the MPCD cell list, sorter, streaming, and collision methods in a bulk solvent
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::benchmarks;
+
+//! Number of MPCD particles per cell
+const unsigned int particles_per_cell = 5;
+
+//! Time the MPCD methods in a bulk SRD solvent
+/*! The box has --n cells of unit size along each edge, filled with MPCD particles at random
+    positions with velocities drawn from the Maxwell-Boltzmann distribution at kT = 1.
+*/
+void benchmark_srd_solvent(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                           const BenchmarkOptions& options,
+                           BenchmarkReport& report)
+    {
+    const std::string system = "srd_solvent";
+    const Scalar L = Scalar(options.n);
+
+    auto snapshot = std::make_shared<SnapshotSystemData<Scalar>>();
+    snapshot->global_box = std::make_shared<BoxDim>(L);
+    snapshot->particle_data.type_mapping.push_back("A");
+    snapshot->mpcd_data.type_mapping.push_back("A");
+    snapshot->mpcd_data.resize(particles_per_cell * options.n * options.n * options.n);
+
+    std::mt19937 rng(12);
+    std::uniform_real_distribution<Scalar> uniform(-L / Scalar(2.0), L / Scalar(2.0));
+    std::normal_distribution<Scalar> normal(Scalar(0.0), Scalar(1.0));
+    for (unsigned int i = 0; i < snapshot->mpcd_data.size; i++)
+        {
+        snapshot->mpcd_data.position[i] = vec3<Scalar>(uniform(rng), uniform(rng), uniform(rng));
+        snapshot->mpcd_data.velocity[i] = vec3<Scalar>(normal(rng), normal(rng), normal(rng));
+        }
+
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf);
+    const unsigned int N = sysdef->getMPCDParticleData()->getNGlobal();
+    auto geom = std::make_shared<const mpcd::detail::BulkGeometry>();
+
+    std::shared_ptr<mpcd::CellList> cl;
+    std::shared_ptr<mpcd::Sorter> sorter;
+    std::shared_ptr<mpcd::StreamingMethod> stream;
+    std::shared_ptr<mpcd::SRDCollisionMethod> collide;
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        {
+        cl = std::make_shared<mpcd::CellListGPU>(sysdef);
+        sorter = std::make_shared<mpcd::SorterGPU>(sysdef, 0, 1);
+        stream = std::make_shared<mpcd::ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>>(
+            sysdef,
+            0,
+            1,
+            0,
+            geom);
+        collide = std::make_shared<mpcd::SRDCollisionMethodGPU>(sysdef, 0, 1, 0, 42);
+        }
+    else
+#endif
+        {
+        cl = std::make_shared<mpcd::CellList>(sysdef);
+        sorter = std::make_shared<mpcd::Sorter>(sysdef, 0, 1);
+        stream = std::make_shared<mpcd::ConfinedStreamingMethod<mpcd::detail::BulkGeometry>>(
+            sysdef,
+            0,
+            1,
+            0,
+            geom);
+        collide = std::make_shared<mpcd::SRDCollisionMethod>(sysdef, 0, 1, 0, 42);
+        }
+    sorter->setCellList(cl);
+    stream->setCellList(cl);
+    stream->setDeltaT(Scalar(0.1));
+    collide->setCellList(cl);
+    collide->setRotationAngle(130.0 * M_PI / 180.0);
+
+    report.run(
+        "mpcd::CellList",
+        system,
+        N,
+        [&](uint64_t timestep) { cl->compute(timestep); },
+        {cl});
+
+    report.run(
+        "mpcd::Sorter",
+        system,
+        N,
+        [&](uint64_t timestep) { sorter->update(timestep); },
+        {sorter, cl});
+
+    report.run(
+        "mpcd::ConfinedStreamingMethodBulk",
+        system,
+        N,
+        [&](uint64_t timestep) { stream->stream(timestep); },
+        {stream});
+
+    // the collision includes the cell list and the cell thermo compute
+    report.run(
+        "mpcd::SRDCollisionMethod",
+        system,
+        N,
+        [&](uint64_t timestep) { collide->collide(timestep); },
+        {collide, cl});
+    }
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         { benchmark_srd_solvent(exec_conf, options, report); });
+    }
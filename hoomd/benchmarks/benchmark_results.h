@@ -0,0 +1,178 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file benchmark_results.h
+    \brief Build metadata and the append-only results database of the C++ benchmarks
+    \note This file should be included only by files that compile into a benchmark executable
+*/
+
+#pragma once
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDVersion.h"
+
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// the benchmark CMakeLists.txt sets the git revision of the build
+#ifndef HOOMD_GIT_SHA1
+#define HOOMD_GIT_SHA1 "unknown"
+#endif
+
+namespace hoomd
+    {
+namespace benchmarks
+    {
+//! Description of the build and device that produced a benchmark result
+struct BuildMetadata
+    {
+    std::string git_sha1;             //!< Git revision of the source
+    std::string compiler;             //!< C++ compiler name and version
+    unsigned int long_real_size = 0;  //!< HOOMD_LONGREAL_SIZE
+    unsigned int short_real_size = 0; //!< HOOMD_SHORTREAL_SIZE
+    std::string gpu_platform;         //!< CUDA, ROCm, or empty in CPU builds
+    std::string gpu_arch;             //!< Architecture of the first GPU, empty on the CPU
+    };
+
+//! Collect the build metadata
+/*! \param exec_conf Execution configuration
+ */
+inline BuildMetadata getBuildMetadata(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    BuildMetadata build;
+    build.git_sha1 = HOOMD_GIT_SHA1;
+    build.compiler = BuildInfo::getCXXCompiler();
+    std::pair<unsigned int, unsigned int> precision = BuildInfo::getFloatingPointPrecision();
+    build.long_real_size = precision.first;
+    build.short_real_size = precision.second;
+    build.gpu_platform = BuildInfo::getGPUPlatform();
+
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        {
+#if defined(__HIP_PLATFORM_HCC__)
+        build.gpu_arch = exec_conf->dev_prop.gcnArchName;
+#else
+        std::pair<unsigned int, unsigned int> cc = exec_conf->getComputeCapability();
+        build.gpu_arch = "sm_" + std::to_string(cc.first) + std::to_string(cc.second);
+#endif
+        }
+#endif
+
+    return build;
+    }
+
+//! Get the current UTC time in ISO 8601 format
+inline std::string getTimestamp()
+    {
+    std::time_t now = std::time(nullptr);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+    return std::string(buffer);
+    }
+
+//! Quote and escape a string for JSON
+inline std::string jsonString(const std::string& value)
+    {
+    std::string result = "\"";
+    for (char c : value)
+        {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+        }
+    return result + "\"";
+    }
+
+//! Find the value of a top level key in a single line JSON object
+/*! \param line JSON object written by BenchmarkReport
+    \param key Key to find
+
+    \returns The unquoted value, or an empty string when \a line does not have \a key
+
+    This is not a general JSON parser. It reads only the flat records that BenchmarkReport appends
+    to the results database and ignores the nested autotuners object, which is always last.
+*/
+inline std::string findJSONValue(const std::string& line, const std::string& key)
+    {
+    const std::string flat = line.substr(0, line.find("\"autotuners\""));
+    const std::string pattern = jsonString(key) + ": ";
+    size_t pos = flat.find(pattern);
+    if (pos == std::string::npos)
+        return std::string();
+    pos += pattern.size();
+
+    std::string value;
+    if (pos < flat.size() && flat[pos] == '"')
+        {
+        for (pos++; pos < flat.size() && flat[pos] != '"'; pos++)
+            {
+            if (flat[pos] == '\\')
+                pos++;
+            if (pos < flat.size())
+                value += flat[pos];
+            }
+        }
+    else
+        {
+        size_t end = flat.find_first_of(",}", pos);
+        value = flat.substr(pos, end - pos);
+        }
+    return value;
+    }
+
+//! Get the key that identifies comparable records in the results database
+/*! Two records are comparable when they time the same class on the same system with the same
+    resources and floating point precision. The git revision and compiler may differ, as finding
+    the performance change between them is the purpose of the comparison.
+*/
+inline std::string getRecordKey(const std::string& line)
+    {
+    std::string key;
+    for (const std::string field : {"name",
+                                    "system",
+                                    "n_particles",
+                                    "mode",
+                                    "gpu_arch",
+                                    "n_ranks",
+                                    "n_threads",
+                                    "long_real_size",
+                                    "short_real_size"})
+        {
+        key += findJSONValue(line, field) + "/";
+        }
+    return key;
+    }
+
+//! Read the steps per second of each record in a baseline results database
+/*! \param filename Results database written with --results
+    \returns The steps per second of the last record for each record key
+*/
+inline std::map<std::string, double> readBaseline(const std::string& filename)
+    {
+    std::ifstream file(filename);
+    if (!file)
+        throw std::runtime_error("Unable to open " + filename);
+
+    std::map<std::string, double> baseline;
+    std::string line;
+    while (std::getline(file, line))
+        {
+        std::string steps_per_second = findJSONValue(line, "steps_per_second");
+        if (steps_per_second.empty())
+            continue;
+
+        // later records replace earlier ones, so the baseline is the most recent run
+        baseline[getRecordKey(line)] = std::stod(steps_per_second);
+        }
+
+    return baseline;
+    }
+
+    } // end namespace benchmarks
+    } // end namespace hoomd
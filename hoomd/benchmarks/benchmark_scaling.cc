@@ -0,0 +1,313 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "benchmark_utils.h"
+
+#include "hoomd/Communicator.h"
+#include "hoomd/DomainDecomposition.h"
+#include "hoomd/filter/ParticleFilterAll.h"
+#include "hoomd/md/EvaluatorPairEwald.h"
+#include "hoomd/md/EvaluatorPairLJ.h"
+#include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/PPPMForceCompute.h"
+#include "hoomd/md/PotentialPair.h"
+
+#ifdef ENABLE_HIP
+#include "hoomd/CommunicatorGPU.h"
+#include "hoomd/md/NeighborListGPUBinned.h"
+#include "hoomd/md/PPPMForceComputeGPU.h"
+#include "hoomd/md/PotentialPairGPU.h"
+#endif
+
+#ifdef BUILD_HPMC
+#include "hoomd/hpmc/IntegratorHPMCMono.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+#endif
+
+/*! \file benchmark_scaling.cc
+    \brief Times the phases of domain decomposed MD and HPMC steps on each rank
+
+    Run with an increasing number of ranks and a fixed --n for strong scaling, or with
+    --particles-per-rank for weak scaling. The report lists the time of each phase on every rank.
+*/
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::benchmarks;
+
+//! Neighbor list buffer
+const Scalar r_buff = Scalar(0.4);
+
+//! Maximum displacement of each particle along each axis between two MD steps
+/*! The MD benchmarks do not integrate the equations of motion. Random displacements of about the
+    distance a particle moves in a LJ liquid step keep particles migrating between the ranks.
+*/
+const Scalar md_displacement = Scalar(0.01);
+
+//! Decompose the snapshot over all ranks and construct the communicator
+/*! \param snapshot System snapshot
+    \param exec_conf Execution configuration
+    \param comm Set to the constructed communicator
+
+    \returns The decomposed system definition. Computes constructed afterwards connect to the
+    communicator.
+*/
+std::shared_ptr<SystemDefinition>
+make_decomposed_system(std::shared_ptr<SnapshotSystemData<Scalar>> snapshot,
+                       std::shared_ptr<ExecutionConfiguration> exec_conf,
+                       std::shared_ptr<Communicator>& comm)
+    {
+    auto decomposition
+        = std::make_shared<DomainDecomposition>(exec_conf, snapshot->global_box->getL());
+    auto sysdef = std::make_shared<SystemDefinition>(snapshot, exec_conf, decomposition);
+
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        comm = std::make_shared<CommunicatorGPU>(sysdef, decomposition);
+    else
+#endif
+        comm = std::make_shared<Communicator>(sysdef, decomposition);
+    sysdef->setCommunicator(comm);
+    return sysdef;
+    }
+
+//! Construct a binned neighbor list on the CPU or GPU
+std::shared_ptr<NeighborList> make_nlist(std::shared_ptr<SystemDefinition> sysdef)
+    {
+#ifdef ENABLE_HIP
+    if (sysdef->getParticleData()->getExecConf()->isCUDAEnabled())
+        return std::make_shared<NeighborListGPUBinned>(sysdef, r_buff);
+#endif
+    return std::make_shared<NeighborListBinned>(sysdef, r_buff);
+    }
+
+//! Construct a pair potential on the CPU or GPU
+template<class evaluator>
+std::shared_ptr<PotentialPair<evaluator>> make_pair(std::shared_ptr<SystemDefinition> sysdef,
+                                                    std::shared_ptr<NeighborList> nlist)
+    {
+#ifdef ENABLE_HIP
+    if (sysdef->getParticleData()->getExecConf()->isCUDAEnabled())
+        return std::make_shared<PotentialPairGPU<evaluator>>(sysdef, nlist);
+#endif
+    return std::make_shared<PotentialPair<evaluator>>(sysdef, nlist);
+    }
+
+//! Randomly displace the local particles and wrap them back into the global box
+/*! \param pdata Particle data
+    \param rng Random number generator of this rank
+*/
+void displace_particles(std::shared_ptr<ParticleData> pdata, std::mt19937& rng)
+    {
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<int3> h_image(pdata->getImages(), access_location::host, access_mode::readwrite);
+
+    const BoxDim box = pdata->getGlobalBox();
+    std::uniform_real_distribution<Scalar> uniform(-md_displacement, md_displacement);
+    for (unsigned int i = 0; i < pdata->getN(); i++)
+        {
+        h_pos.data[i].x += uniform(rng);
+        h_pos.data[i].y += uniform(rng);
+        h_pos.data[i].z += uniform(rng);
+        box.wrap(h_pos.data[i], h_image.data[i]);
+        }
+    }
+
+//! Time one MD step: migrate, ghost exchange, neighbor list, and the given force computes
+/*! \param report Benchmark report
+    \param system Name of the benchmark system
+    \param sysdef System definition
+    \param comm Communicator
+    \param nlist Neighbor list
+    \param forces Names and force computes timed after the neighbor list, in order
+*/
+void run_md_phases(BenchmarkReport& report,
+                   const std::string& system,
+                   std::shared_ptr<SystemDefinition> sysdef,
+                   std::shared_ptr<Communicator> comm,
+                   std::shared_ptr<NeighborList> nlist,
+                   const std::vector<std::pair<std::string, std::shared_ptr<ForceCompute>>>& forces)
+    {
+    // the benchmark calls the communicator directly, it requests the flags of all computes
+    CommFlags flags(0);
+    flags[comm_flag::position] = 1;
+    flags[comm_flag::tag] = 1;
+    flags[comm_flag::charge] = 1;
+    comm->setFlags(flags);
+
+    std::vector<std::string> phases = {"migrate", "ghost_exchange", "neighbor_list"};
+    for (const auto& force : forces)
+        phases.push_back(force.first);
+
+    auto pdata = sysdef->getParticleData();
+    std::mt19937 rng(pdata->getExecConf()->getRank());
+    report.runPhases("MDStep",
+                     system,
+                     pdata->getNGlobal(),
+                     phases,
+                     [&](uint64_t timestep, PhaseTimer& timer)
+                     {
+                         displace_particles(pdata, rng);
+                         timer.time(0, [&] { comm->migrateParticles(); });
+                         timer.time(1, [&] { comm->exchangeGhosts(); });
+
+                         // the ghost exchange reorders the ghosts, rebuild every step
+                         timer.time(2,
+                                    [&]
+                                    {
+                                        nlist->forceUpdate();
+                                        nlist->compute(timestep);
+                                    });
+                         for (unsigned int i = 0; i < forces.size(); i++)
+                             timer.time(3 + i, [&] { forces[i].second->compute(timestep); });
+                     });
+    }
+
+//! Time the migration, ghost exchange, neighbor list, and LJ force compute in a LJ liquid
+void benchmark_lj_liquid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                         const BenchmarkOptions& options,
+                         BenchmarkReport& report)
+    {
+    const unsigned int n = getLatticeSize(options, exec_conf);
+    auto snapshot = makeLatticeSnapshot(n, Scalar(0.85), Scalar(0.1));
+    std::shared_ptr<Communicator> comm;
+    auto sysdef = make_decomposed_system(snapshot, exec_conf, comm);
+    auto nlist = make_nlist(sysdef);
+
+    auto lj = make_pair<EvaluatorPairLJ>(sysdef, nlist);
+    bool managed = exec_conf->isCUDAEnabled();
+    lj->setParams(0, 0, EvaluatorPairLJ::param_type(Scalar(1.0), Scalar(1.0), managed));
+    lj->setRcut(0, 0, Scalar(2.5));
+
+    run_md_phases(report, "lj_liquid", sysdef, comm, nlist, {{"force", lj}});
+    }
+
+//! Time a charged system with real space Ewald and PPPM forces
+/*! The system is the rock salt lattice of benchmark_md. The PPPM phase includes the mesh ghost
+    exchange and the distributed FFT.
+*/
+void benchmark_charged(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                       const BenchmarkOptions& options,
+                       BenchmarkReport& report)
+    {
+    const Scalar r_cut = Scalar(3.0);
+    const Scalar kappa = Scalar(1.0);
+    const unsigned int order = 5;
+
+    const unsigned int n = getLatticeSize(options, exec_conf, 2);
+    auto snapshot = makeLatticeSnapshot(n, Scalar(0.1), Scalar(0.1));
+    for (unsigned int i = 0; i < snapshot->particle_data.size; i++)
+        {
+        unsigned int x = i % n;
+        unsigned int y = (i / n) % n;
+        unsigned int z = i / (n * n);
+        snapshot->particle_data.charge[i] = ((x + y + z) % 2 == 0) ? Scalar(1.0) : Scalar(-1.0);
+        }
+
+    std::shared_ptr<Communicator> comm;
+    auto sysdef = make_decomposed_system(snapshot, exec_conf, comm);
+    auto nlist = make_nlist(sysdef);
+
+    auto ewald = make_pair<EvaluatorPairEwald>(sysdef, nlist);
+    EvaluatorPairEwald::param_type ewald_params;
+    ewald_params.kappa = kappa;
+    ewald_params.alpha = Scalar(0.0);
+    ewald->setParams(0, 0, ewald_params);
+    ewald->setRcut(0, 0, r_cut);
+
+    auto group = std::make_shared<ParticleGroup>(sysdef, std::make_shared<ParticleFilterAll>());
+    std::shared_ptr<PPPMForceCompute> pppm;
+#ifdef ENABLE_HIP
+    if (exec_conf->isCUDAEnabled())
+        pppm = std::make_shared<PPPMForceComputeGPU>(sysdef, nlist, group);
+    else
+#endif
+        pppm = std::make_shared<PPPMForceCompute>(sysdef, nlist, group);
+
+    unsigned int n_mesh = 1;
+    while (n_mesh < n)
+        n_mesh *= 2;
+    pppm->setParams(n_mesh, n_mesh, n_mesh, order, kappa, r_cut);
+
+    run_md_phases(report, "charged", sysdef, comm, nlist, {{"force", ewald}, {"pppm", pppm}});
+    }
+
+#ifdef BUILD_HPMC
+//! Sphere integrator that times its communication separately
+/*! IntegratorHPMCMono migrates particles and exchanges ghosts inside update().
+ */
+class TimedIntegratorHPMCMonoSphere : public hpmc::IntegratorHPMCMono<hpmc::ShapeSphere>
+    {
+    typedef hpmc::IntegratorHPMCMono<hpmc::ShapeSphere> Base;
+
+    public:
+    //! Constructor
+    TimedIntegratorHPMCMonoSphere(std::shared_ptr<SystemDefinition> sysdef)
+        : Base(sysdef)
+        {
+        }
+
+    //! Communicate particles, timed as phase 1 of the current timer
+    virtual void communicate(bool migrate)
+        {
+        if (m_phase_timer)
+            m_phase_timer->time(1, [&] { Base::communicate(migrate); });
+        else
+            Base::communicate(migrate);
+        }
+
+    PhaseTimer* m_phase_timer = nullptr; //!< Timer of the current step
+    };
+
+//! Time the trial moves and the communication of a hard sphere fluid
+/*! Uses the hard sphere fluid of benchmark_hpmc. The integrator runs on the CPU.
+ */
+void benchmark_hard_sphere_fluid(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                 const BenchmarkOptions& options,
+                                 BenchmarkReport& report)
+    {
+    const Scalar density = Scalar(0.45) / (Scalar(M_PI) / Scalar(6.0));
+    auto snapshot = makeLatticeSnapshot(getLatticeSize(options, exec_conf), density, Scalar(0.02));
+    std::shared_ptr<Communicator> comm;
+    auto sysdef = make_decomposed_system(snapshot, exec_conf, comm);
+
+    auto mc = std::make_shared<TimedIntegratorHPMCMonoSphere>(sysdef);
+    hpmc::SphereParams params;
+    params.radius = ShortReal(0.5);
+    params.ignore = false;
+    params.isOriented = false;
+    mc->setParam(0, params);
+    mc->setD("A", Scalar(0.1));
+    mc->prepRun(0);
+
+    report.runPhases("IntegratorHPMCMonoSphere",
+                     "hard_sphere_fluid",
+                     sysdef->getParticleData()->getNGlobal(),
+                     {"trial_moves", "communication"},
+                     [&](uint64_t timestep, PhaseTimer& timer)
+                     {
+                         mc->m_phase_timer = &timer;
+                         timer.time(0, [&] { mc->update(timestep); });
+                         mc->m_phase_timer = nullptr;
+                     });
+    }
+#endif
+
+int main(int argc, char** argv)
+    {
+    return benchmarkMain(argc,
+                         argv,
+                         [](std::shared_ptr<ExecutionConfiguration> exec_conf,
+                            const BenchmarkOptions& options,
+                            BenchmarkReport& report)
+                         {
+                             benchmark_lj_liquid(exec_conf, options, report);
+                             benchmark_charged(exec_conf, options, report);
+#ifdef BUILD_HPMC
+                             benchmark_hard_sphere_fluid(exec_conf, options, report);
+#endif
+                         });
+    }
@@ -0,0 +1,590 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file benchmark_utils.h
+    \brief Helpers shared by the C++ benchmark executables
+    \note This file should be included only by files that compile into a benchmark executable
+*/
+
+#pragma once
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include "benchmark_results.h"
+#include "hoomd/Autotuned.h"
+#include "hoomd/HOOMDVersion.h"
+#include "hoomd/Initializers.h"
+#include "hoomd/SnapshotSystemData.h"
+#include "hoomd/SystemDefinition.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hoomd
+    {
+namespace benchmarks
+    {
+//! Command line options common to all benchmarks
+struct BenchmarkOptions
+    {
+    unsigned int steps = 100;       //!< Number of timed steps
+    unsigned int warmup_steps = 10; //!< Number of untimed steps run before timing
+    unsigned int n = 20;            //!< Number of lattice sites along each box edge
+    unsigned int particles_per_rank = 0; //!< Particles per rank in weak scaling runs, 0 uses n
+    unsigned int threads = 1;       //!< Number of TBB threads
+    ExecutionConfiguration::executionMode mode = ExecutionConfiguration::CPU; //!< Device to run on
+    std::string output;     //!< File to write the JSON report to, stdout when empty
+    std::string results;    //!< Results database to append records to, none when empty
+    std::string baseline;   //!< Results database to compare against, none when empty
+    double threshold = 0.1; //!< Fractional slowdown relative to the baseline that is a regression
+    };
+
+//! Parse the command line options
+/*! Accepts --steps, --warmup, --n, --particles-per-rank, --threads, --mode (cpu or gpu),
+    --output, --results, --baseline, and --threshold, each followed by a value.
+ */
+inline BenchmarkOptions parseOptions(int argc, char** argv)
+    {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; i++)
+        {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+            throw std::invalid_argument("Missing value for option " + arg);
+
+        std::string value(argv[++i]);
+        if (arg == "--steps")
+            options.steps = std::stoi(value);
+        else if (arg == "--warmup")
+            options.warmup_steps = std::stoi(value);
+        else if (arg == "--n")
+            options.n = std::stoi(value);
+        else if (arg == "--particles-per-rank")
+            options.particles_per_rank = std::stoi(value);
+        else if (arg == "--threads")
+            options.threads = std::stoi(value);
+        else if (arg == "--output")
+            options.output = value;
+        else if (arg == "--results")
+            options.results = value;
+        else if (arg == "--baseline")
+            options.baseline = value;
+        else if (arg == "--threshold")
+            options.threshold = std::stod(value);
+        else if (arg == "--mode" && value == "cpu")
+            options.mode = ExecutionConfiguration::CPU;
+        else if (arg == "--mode" && value == "gpu")
+            options.mode = ExecutionConfiguration::GPU;
+        else
+            throw std::invalid_argument("Invalid option " + arg + " " + value);
+        }
+
+    if (options.steps == 0)
+        throw std::invalid_argument("--steps must be positive");
+    if (options.threshold < 0 || options.threshold >= 1)
+        throw std::invalid_argument("--threshold must be in [0, 1)");
+
+    return options;
+    }
+
+//! Get the number of lattice sites along each box edge
+/*! \param options Command line options
+    \param exec_conf Execution configuration
+    \param multiple The result is rounded up to a multiple of this value
+
+    A fixed --n gives a strong scaling series when run on an increasing number of ranks. With
+    --particles-per-rank, the edge is the cube root of particles_per_rank times the number of ranks,
+    which keeps the work per rank constant for weak scaling.
+*/
+inline unsigned int getLatticeSize(const BenchmarkOptions& options,
+                                   std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                   unsigned int multiple = 1)
+    {
+    unsigned int n = options.n;
+    if (options.particles_per_rank != 0)
+        {
+        double n_total = double(options.particles_per_rank) * double(exec_conf->getNRanks());
+        n = std::max(1u, (unsigned int)std::lround(std::cbrt(n_total)));
+        }
+
+    return (n + multiple - 1) / multiple * multiple;
+    }
+
+//! Accumulates the wall clock time of the phases of a benchmark step on this rank
+/*! Phases may be nested. The time of a nested phase is not added to the enclosing phase, so the
+    phase times sum to the time of the step.
+*/
+class PhaseTimer
+    {
+    public:
+    //! Constructor
+    /*! \param exec_conf Execution configuration
+        \param n_phases Number of phases
+    */
+    PhaseTimer(std::shared_ptr<ExecutionConfiguration> exec_conf, size_t n_phases)
+        : m_exec_conf(exec_conf), m_seconds(n_phases, 0.0)
+        {
+        }
+
+    //! Call \a f and add the elapsed time to phase \a phase
+    /*! The GPU is synchronized before and after the call, so the time includes all kernels the
+        phase launches. There is no barrier between the ranks, so a phase that communicates also
+        includes the time spent waiting for the other ranks.
+    */
+    template<class F> void time(unsigned int phase, F&& f)
+        {
+        synchronizeDevice();
+        double outer_nested = m_nested;
+        m_nested = 0.0;
+        auto start = std::chrono::steady_clock::now();
+
+        f();
+
+        synchronizeDevice();
+        double elapsed
+            = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        m_seconds[phase] += elapsed - m_nested;
+        m_nested = outer_nested + elapsed;
+        }
+
+    //! Set all phase times to zero
+    void reset()
+        {
+        std::fill(m_seconds.begin(), m_seconds.end(), 0.0);
+        }
+
+    //! Get the accumulated time of each phase on this rank
+    const std::vector<double>& getSeconds() const
+        {
+        return m_seconds;
+        }
+
+    private:
+    //! Wait for the GPU to finish its work
+    void synchronizeDevice()
+        {
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            hipDeviceSynchronize();
+#endif
+        }
+
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    std::vector<double> m_seconds;                       //!< Accumulated time of each phase
+    double m_nested = 0.0; //!< Time spent in phases nested in the current one
+    };
+
+//! Build a simple cubic lattice with random displacements
+/*! \param n Number of lattice sites along each box edge
+    \param density Number density of the lattice
+    \param displacement Maximum displacement of each particle along each axis
+    \param seed Seed for the random displacements
+
+    \returns A snapshot with n^3 particles of type A
+*/
+inline std::shared_ptr<SnapshotSystemData<Scalar>>
+makeLatticeSnapshot(unsigned int n, Scalar density, Scalar displacement, unsigned int seed = 12)
+    {
+    Scalar spacing = std::cbrt(Scalar(1.0) / density);
+    SimpleCubicInitializer init(n, spacing, "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snapshot = init.getSnapshot();
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<Scalar> uniform(-displacement, displacement);
+    for (auto& pos : snapshot->particle_data.pos)
+        {
+        pos.x += uniform(rng);
+        pos.y += uniform(rng);
+        pos.z += uniform(rng);
+        }
+
+    return snapshot;
+    }
+
+//! Times benchmarks and collects the results in a JSON report
+class BenchmarkReport
+    {
+    public:
+    //! Constructor
+    BenchmarkReport(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                    const BenchmarkOptions& options)
+        : m_exec_conf(exec_conf), m_options(options), m_build(getBuildMetadata(exec_conf))
+        {
+        }
+
+    //! Time a benchmark
+    /*! \param name Name of the timed class
+        \param system Name of the benchmark system
+        \param n_particles Number of particles in the system
+        \param step Function that performs one step of the benchmark at the given timestep
+        \param tuned Autotuned objects that \a step uses
+
+        Runs options.warmup_steps untimed steps followed by options.steps timed steps. The untimed
+        steps continue until the autotuners of all \a tuned objects are complete, and the report
+        includes the parameters they chose.
+    */
+    void run(const std::string& name,
+             const std::string& system,
+             unsigned int n_particles,
+             std::function<void(uint64_t)> step,
+             const std::vector<std::shared_ptr<Autotuned>>& tuned = {})
+        {
+        uint64_t timestep = 0;
+        for (unsigned int i = 0; i < m_options.warmup_steps; i++)
+            step(timestep++);
+
+        // time only the parameters that the autotuners settle on
+        while (!std::all_of(tuned.begin(),
+                            tuned.end(),
+                            [](const std::shared_ptr<Autotuned>& t)
+                            { return t->isAutotuningComplete(); }))
+            step(timestep++);
+
+        m_first_timed_step = timestep;
+        synchronize();
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned int i = 0; i < m_options.steps; i++)
+            step(timestep++);
+        synchronize();
+        auto end = std::chrono::steady_clock::now();
+
+        Result result;
+        result.name = name;
+        result.system = system;
+        result.n_particles = n_particles;
+        result.seconds = std::chrono::duration<double>(end - start).count();
+        for (const auto& t : tuned)
+            {
+            auto params = t->getAutotunerParameterStrings();
+            result.autotuners.insert(result.autotuners.end(), params.begin(), params.end());
+            }
+        m_results.push_back(result);
+
+        m_exec_conf->msg->notice(1) << system << " " << name << ": "
+                                    << double(m_options.steps) / result.seconds << " steps/s"
+                                    << std::endl;
+        }
+
+    //! Time a benchmark and the phases of its steps on each rank
+    /*! \param name Name of the timed class
+        \param system Name of the benchmark system
+        \param n_particles Number of particles in the system
+        \param phases Names of the phases
+        \param step Function that performs one step of the benchmark at the given timestep and times
+               its phases with the given PhaseTimer
+
+        Like run(), and additionally reports the time of each phase on every rank. The spread
+        between the ranks shows the load imbalance of a phase.
+    */
+    void runPhases(const std::string& name,
+                   const std::string& system,
+                   unsigned int n_particles,
+                   const std::vector<std::string>& phases,
+                   std::function<void(uint64_t, PhaseTimer&)> step)
+        {
+        PhaseTimer timer(m_exec_conf, phases.size());
+        run(name,
+            system,
+            n_particles,
+            [&](uint64_t timestep)
+            {
+                // report only the timed steps
+                if (timestep == m_first_timed_step)
+                    timer.reset();
+                step(timestep, timer);
+            });
+
+        std::vector<double> rank_seconds(phases.size() * m_exec_conf->getNRanks());
+#ifdef ENABLE_MPI
+        MPI_Gather(timer.getSeconds().data(),
+                   int(phases.size()),
+                   MPI_DOUBLE,
+                   rank_seconds.data(),
+                   int(phases.size()),
+                   MPI_DOUBLE,
+                   0,
+                   m_exec_conf->getMPICommunicator());
+#else
+        rank_seconds = timer.getSeconds();
+#endif
+
+        Result& result = m_results.back();
+        result.phases = phases;
+        result.phase_seconds = rank_seconds;
+        }
+
+    //! Write the JSON report to options.output or stdout on the root rank
+    void write() const
+        {
+        if (!m_exec_conf->isRoot())
+            return;
+
+        std::ostringstream s;
+        s.precision(9);
+        s << "{\n";
+        s << "  \"hoomd_version\": \"" << HOOMD_VERSION << "\",\n";
+        s << "  \"git_sha1\": " << jsonString(m_build.git_sha1) << ",\n";
+        s << "  \"compiler\": " << jsonString(m_build.compiler) << ",\n";
+        s << "  \"long_real_size\": " << m_build.long_real_size << ",\n";
+        s << "  \"short_real_size\": " << m_build.short_real_size << ",\n";
+        s << "  \"gpu_platform\": " << jsonString(m_build.gpu_platform) << ",\n";
+        s << "  \"gpu_arch\": " << jsonString(m_build.gpu_arch) << ",\n";
+        s << "  \"mode\": \"" << (m_exec_conf->isCUDAEnabled() ? "gpu" : "cpu") << "\",\n";
+        s << "  \"n_ranks\": " << m_exec_conf->getNRanks() << ",\n";
+        s << "  \"n_threads\": " << m_exec_conf->getNumThreads() << ",\n";
+        s << "  \"steps\": " << m_options.steps << ",\n";
+        if (m_options.particles_per_rank != 0)
+            s << "  \"particles_per_rank\": " << m_options.particles_per_rank << ",\n";
+        s << "  \"benchmarks\": [";
+        for (size_t i = 0; i < m_results.size(); i++)
+            {
+            const Result& result = m_results[i];
+            s << (i == 0 ? "\n" : ",\n");
+            s << "    {\"name\": \"" << result.name << "\", \"system\": \"" << result.system
+              << "\", \"n_particles\": " << result.n_particles
+              << ", \"seconds\": " << result.seconds
+              << ", \"seconds_per_step\": " << result.seconds / double(m_options.steps)
+              << ", \"steps_per_second\": " << double(m_options.steps) / result.seconds;
+            if (!result.phases.empty())
+                writePhases(s, result);
+            if (!result.autotuners.empty())
+                {
+                s << ",\n     ";
+                writeAutotuners(s, result);
+                }
+            s << "}";
+            }
+        s << "\n  ]\n}\n";
+
+        if (m_options.output.empty())
+            {
+            std::cout << s.str();
+            }
+        else
+            {
+            std::ofstream file(m_options.output);
+            if (!file)
+                throw std::runtime_error("Unable to open " + m_options.output);
+            file << s.str();
+            }
+        }
+
+    //! Append one record per result to the results database options.results on the root rank
+    /*! The database is a file of JSON objects, one per line. Each record holds the build metadata
+        along with the result, so a database collects the history of many builds and devices.
+    */
+    void appendResults() const
+        {
+        if (!m_exec_conf->isRoot() || m_options.results.empty())
+            return;
+
+        std::ofstream file(m_options.results, std::ios::app);
+        if (!file)
+            throw std::runtime_error("Unable to open " + m_options.results);
+
+        for (const Result& result : m_results)
+            file << formatRecord(result) << "\n";
+        }
+
+    //! Compare the results to the baseline database options.baseline on the root rank
+    /*! \returns The number of results that are slower than the most recent comparable baseline
+                 record by more than options.threshold
+
+        Results without a comparable baseline record are not compared.
+    */
+    unsigned int compareBaseline() const
+        {
+        if (!m_exec_conf->isRoot() || m_options.baseline.empty())
+            return 0;
+
+        std::map<std::string, double> baseline = readBaseline(m_options.baseline);
+        unsigned int n_regressions = 0;
+        for (const Result& result : m_results)
+            {
+            auto match = baseline.find(getRecordKey(formatRecord(result)));
+            if (match == baseline.end())
+                continue;
+
+            double steps_per_second = double(m_options.steps) / result.seconds;
+            double ratio = steps_per_second / match->second;
+            if (ratio < 1.0 - m_options.threshold)
+                {
+                m_exec_conf->msg->warning()
+                    << result.system << " " << result.name << " regressed: " << steps_per_second
+                    << " steps/s, baseline " << match->second << " steps/s" << std::endl;
+                n_regressions++;
+                }
+            else
+                {
+                m_exec_conf->msg->notice(1)
+                    << result.system << " " << result.name << ": " << ratio
+                    << " times the baseline performance" << std::endl;
+                }
+            }
+
+        return n_regressions;
+        }
+
+    private:
+    //! Result of a single benchmark
+    struct Result
+        {
+        std::string name;         //!< Name of the timed class
+        std::string system;       //!< Name of the benchmark system
+        unsigned int n_particles; //!< Number of particles
+        double seconds;           //!< Wall clock time of the timed steps
+        std::vector<std::string> phases;   //!< Names of the timed phases
+        std::vector<double> phase_seconds; //!< Time of each phase on each rank, by rank then phase
+        std::vector<std::pair<std::string, std::string>> autotuners; //!< Autotuner parameters
+        };
+
+    //! Format a result as a single line record of the results database
+    std::string formatRecord(const Result& result) const
+        {
+        std::ostringstream s;
+        s.precision(9);
+        s << "{\"time\": " << jsonString(getTimestamp())
+          << ", \"hoomd_version\": " << jsonString(HOOMD_VERSION)
+          << ", \"git_sha1\": " << jsonString(m_build.git_sha1)
+          << ", \"compiler\": " << jsonString(m_build.compiler)
+          << ", \"long_real_size\": " << m_build.long_real_size
+          << ", \"short_real_size\": " << m_build.short_real_size
+          << ", \"gpu_platform\": " << jsonString(m_build.gpu_platform)
+          << ", \"gpu_arch\": " << jsonString(m_build.gpu_arch)
+          << ", \"mode\": " << jsonString(m_exec_conf->isCUDAEnabled() ? "gpu" : "cpu")
+          << ", \"n_ranks\": " << m_exec_conf->getNRanks()
+          << ", \"n_threads\": " << m_exec_conf->getNumThreads()
+          << ", \"steps\": " << m_options.steps << ", \"name\": " << jsonString(result.name)
+          << ", \"system\": " << jsonString(result.system)
+          << ", \"n_particles\": " << result.n_particles
+          << ", \"seconds_per_step\": " << result.seconds / double(m_options.steps)
+          << ", \"steps_per_second\": " << double(m_options.steps) / result.seconds << ", ";
+
+        // findJSONValue requires the nested autotuners object to be last
+        writeAutotuners(s, result);
+        s << "}";
+        return s.str();
+        }
+
+    //! Write the autotuner parameters of a result as a JSON object
+    void writeAutotuners(std::ostringstream& s, const Result& result) const
+        {
+        s << "\"autotuners\": {";
+        for (size_t i = 0; i < result.autotuners.size(); i++)
+            {
+            s << (i == 0 ? "" : ", ") << jsonString(result.autotuners[i].first) << ": "
+              << jsonString(result.autotuners[i].second);
+            }
+        s << "}";
+        }
+
+    //! Write the phase times of a result as a JSON object with the statistics over the ranks
+    void writePhases(std::ostringstream& s, const Result& result) const
+        {
+        const size_t n_phases = result.phases.size();
+        const unsigned int n_ranks = m_exec_conf->getNRanks();
+        s << ",\n     \"phases\": {";
+        for (size_t phase = 0; phase < n_phases; phase++)
+            {
+            double min = result.phase_seconds[phase];
+            double max = min;
+            double sum = 0.0;
+            std::ostringstream ranks;
+            ranks.precision(9);
+            for (unsigned int rank = 0; rank < n_ranks; rank++)
+                {
+                double seconds = result.phase_seconds[rank * n_phases + phase];
+                min = std::min(min, seconds);
+                max = std::max(max, seconds);
+                sum += seconds;
+                ranks << (rank == 0 ? "" : ", ") << seconds;
+                }
+
+            s << (phase == 0 ? "\n" : ",\n");
+            s << "       \"" << result.phases[phase] << "\": {\"min\": " << min
+              << ", \"mean\": " << sum / double(n_ranks) << ", \"max\": " << max
+              << ", \"ranks\": [" << ranks.str() << "]}";
+            }
+        s << "}";
+        }
+
+    //! Wait for all ranks and the GPU to finish their work
+    void synchronize()
+        {
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            hipDeviceSynchronize();
+#endif
+
+#ifdef ENABLE_MPI
+        MPI_Barrier(m_exec_conf->getMPICommunicator());
+#endif
+        }
+
+    std::shared_ptr<ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+    BenchmarkOptions m_options;                          //!< Command line options
+    std::vector<Result> m_results;                       //!< Benchmark results
+    BuildMetadata m_build;                               //!< Build metadata
+    uint64_t m_first_timed_step = 0; //!< Timestep of the first timed step of the current benchmark
+    };
+
+//! Parse the options, call \a run_benchmarks, and write the report
+/*! \param argc Number of command line arguments
+    \param argv Command line arguments
+    \param run_benchmarks Function that adds the benchmarks to the report
+
+    \returns 0 on success, 1 on error, and 2 when a result regressed relative to --baseline
+*/
+inline int
+benchmarkMain(int argc,
+              char** argv,
+              std::function<void(std::shared_ptr<ExecutionConfiguration>,
+                                 const BenchmarkOptions&,
+                                 BenchmarkReport&)> run_benchmarks)
+    {
+#ifdef ENABLE_MPI
+    MPI_Init(&argc, &argv);
+#endif
+
+    int result = 0;
+    try
+        {
+        BenchmarkOptions options = parseOptions(argc, argv);
+        auto exec_conf = std::make_shared<ExecutionConfiguration>(options.mode);
+#ifdef ENABLE_TBB
+        exec_conf->setNumThreads(options.threads);
+#endif
+        BenchmarkReport report(exec_conf, options);
+        run_benchmarks(exec_conf, options, report);
+        report.write();
+        // compare before appending so that --baseline and --results may name the same file
+        if (report.compareBaseline() > 0)
+            result = 2;
+        report.appendResults();
+        }
+    catch (const std::exception& e)
+        {
+        std::cerr << "**ERROR** " << e.what() << std::endl;
+        result = 1;
+        }
+
+#ifdef ENABLE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+    }
+
+    } // end namespace benchmarks
+    } // end namespace hoomd
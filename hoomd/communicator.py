@@ -54,6 +54,14 @@ class Communicator(object):
     example by using `partition` as an index into an array of state points to
     execute.
 
+    Tip:
+        Small systems do not fill a GPU. To run an ensemble of small replicas
+        efficiently, launch more ranks than there are GPUs and set
+        ``ranks_per_partition=1``. `hoomd.device.GPU` assigns ranks to GPUs
+        round-robin by local rank, so several partitions share each GPU. Enable
+        the NVIDIA Multi-Process Service (MPS) so that kernels from the
+        different partitions execute concurrently.
+
     .. rubric:: Examples:
 
     .. code-block:: python
@@ -116,6 +116,62 @@ def simulation_factory(device):
     return make_simulation
 
 
+@pytest.fixture
+def cpu_simulation_factory(device):
+    """Make a Simulation on a new CPU device with a given number of threads.
+
+    Tests of the threaded CPU code paths need devices with different numbers
+    of threads. Tests that use `cpu_simulation_factory` run once, on the CPU
+    and a single MPI rank. They are skipped when they request more than one
+    thread in a build without TBB.
+    """
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip('Test is run only on CPU(s).')
+    if device.communicator.num_ranks > 1:
+        pytest.skip('Test is run only on a single rank.')
+
+    def make_simulation(snapshot, num_cpu_threads, seed=1):
+        if num_cpu_threads > 1 and not hoomd.version.tbb_enabled:
+            pytest.skip('TBB is not enabled in this build.')
+
+        sim = Simulation(hoomd.device.CPU(num_cpu_threads=num_cpu_threads),
+                         seed=seed)
+        sim.create_state_from_snapshot(snapshot)
+        return sim
+
+    return make_simulation
+
+
+def _assert_nested_allclose(actual, desired, rtol, atol):
+    """Compare nested sequences of arrays element by element."""
+    if isinstance(desired, (list, tuple)):
+        assert len(actual) == len(desired)
+        for a, d in zip(actual, desired):
+            _assert_nested_allclose(a, d, rtol, atol)
+    else:
+        numpy.testing.assert_allclose(actual, desired, rtol=rtol, atol=atol)
+
+
+@pytest.fixture
+def compare_cpu_threads(cpu_simulation_factory):
+    """Check that threaded CPU code reproduces the serial results.
+
+    ``compare_cpu_threads(snapshot, compute)`` creates a simulation from
+    ``snapshot`` with 1 CPU thread and another with 4 threads, and calls
+    ``compute(sim)`` on each. ``compute`` returns an array or a (nested)
+    sequence of arrays. The results of the two simulations must match within
+    ``rtol`` and ``atol``. Returns the serial and threaded results.
+    """
+
+    def compare(snapshot, compute, rtol=1e-5, atol=1e-5, seed=1):
+        serial = compute(cpu_simulation_factory(snapshot, 1, seed))
+        threaded = compute(cpu_simulation_factory(snapshot, 4, seed))
+        _assert_nested_allclose(threaded, serial, rtol, atol)
+        return serial, threaded
+
+    return compare
+
+
 @pytest.fixture(scope='session')
 def one_particle_snapshot_factory(device):
     """Make a snapshot with a single particle."""
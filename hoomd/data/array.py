@@ -542,6 +542,27 @@ if hoomd.version.gpu_enabled:
         def __cuda_array_interface__(self):
             return deepcopy(self._buffer.__cuda_array_interface__)
 
+        def __dlpack__(self, stream=None):
+            """Export the array as a DLPack capsule.
+
+            Args:
+                stream (int): The consumer's stream. The consumer stream waits
+                    for HOOMD-blue's work on the device.
+
+            Note:
+                DLPack has no read only flag. Do not write to arrays that are
+                `read_only`.
+            """
+            if not self._callback():
+                raise HOOMDArrayError(
+                    "Cannot access {} outside context manager.".format(
+                        self.__class__.__name__))
+            return self._buffer.__dlpack__(stream=stream)
+
+        def __dlpack_device__(self):
+            """tuple[int, int]: The DLPack device type and id."""
+            return self._buffer.__dlpack_device__()
+
         @property
         def read_only(self):
             return self._buffer.read_only
@@ -720,7 +741,8 @@ A __cuda_array_interface__ to internal HOOMD-blue data on the GPU.
 
 The HOOMDGPUArray object exposes a GPU data buffer using
 `__cuda_array_interface__
-<https://numba.pydata.org/numba-doc/latest/cuda/cuda_array_interface.html>`_.
+<https://numba.pydata.org/numba-doc/latest/cuda/cuda_array_interface.html>`_
+and `DLPack <https://dmlc.github.io/dlpack/latest/>`_.
 This class provides buffer access through a context manager to prevent invalid
 memory accesses (`hoomd.State.gpu_local_snapshot`). To avoid errors, use arrays
 only within the relevant context manager. For example:
@@ -753,10 +775,20 @@ Tip:
 
 Note:
     Packages like Numba and PyTorch can use `HOOMDGPUArray` without CuPy
-    installed. Any package that supports version 2 of the
+    installed. Any package that supports version 2 or 3 of the
     `__cuda_array_interface__
     <https://numba.pydata.org/numba-doc/latest/cuda/cuda_array_interface.html>`_
-    should support the direct use of `HOOMDGPUArray` objects.
+    or ``__dlpack__`` should support the direct use of `HOOMDGPUArray` objects.
+    For example, ``torch.from_dlpack(data.particles.position)`` creates a
+    tensor that shares memory with HOOMD-blue.
+
+Neither protocol synchronizes the device. HOOMD-blue launches its kernels on the
+legacy default stream: the ``__cuda_array_interface__`` reports this stream,
+and ``__dlpack__(stream)`` makes the consumer's stream wait for HOOMD-blue's
+work with a device side event. When you write to HOOMD-blue arrays from a
+stream created with the non-blocking flag, call
+`hoomd.device.GPU.wait_for_stream` with that stream before the context manager
+exits so that HOOMD-blue's next kernels wait for your work.
 
 """
 
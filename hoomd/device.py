@@ -249,6 +249,34 @@ class Device:
         else:
             self._cpp_exec_conf.setNumThreads(int(num_cpu_threads))
 
+    @property
+    def deterministic_reduction(self):
+        """bool: Whether threaded CPU reductions sum in a fixed order.
+
+        Threaded CPU computations that add many contributions to the same
+        particle or mesh element, such as pair forces with a half neighbor list,
+        bonded forces, and PPPM charge assignment, accumulate into one array per
+        thread and sum the arrays afterwards. When `deterministic_reduction` is
+        `False` (the default), the TBB scheduler decides which work each thread
+        performs, so the floating point sums vary from run to run. When `True`,
+        each thread processes a fixed slice of the work and the arrays are
+        summed in order. The results are then bitwise reproducible for a given
+        `num_cpu_threads`, at the cost of static load balancing. The results
+        still depend on `num_cpu_threads` and GPU computations are not
+        affected.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            device.deterministic_reduction = True
+        """
+        return self._cpp_exec_conf.isDeterministicReductionEnabled()
+
+    @deterministic_reduction.setter
+    def deterministic_reduction(self, new_bool):
+        self._cpp_exec_conf.setDeterministicReduction(bool(new_bool))
+
     def notice(self, message, level=1):
         """Write a notice message.
 
@@ -341,6 +369,18 @@ class GPU(Device):
     process. Override this auto-selection by providing appropriate device ids on
     each rank.
 
+    More than one rank may select the same GPU. See
+    `hoomd.communicator.Communicator` for running many small replica
+    simulations on a single GPU.
+
+    .. rubric:: Kernel loading
+
+    On NVIDIA GPUs, HOOMD sets the environment variable
+    ``CUDA_MODULE_LOADING=LAZY`` before it initializes CUDA, unless it is
+    already set. CUDA then loads each GPU kernel when it is first launched,
+    which shortens the time to create the device. Set
+    ``CUDA_MODULE_LOADING=EAGER`` to load all kernels at initialization.
+
     .. rubric:: Multiple GPUs
 
     Specify a list of GPUs to ``gpu_ids`` to activate a single-process multi-GPU
@@ -420,6 +460,67 @@ class GPU(Device):
     def gpu_error_checking(self, new_bool):
         self._cpp_exec_conf.setCUDAErrorChecking(new_bool)
 
+    @property
+    def autotuner_successive_halving(self):
+        """bool: Whether autotuners search by successive halving.
+
+        When `False` (the default), autotuners time every valid kernel
+        parameter several times before choosing the fastest. When `True`,
+        autotuners discard the slower half of the remaining parameters after
+        each sweep, which completes tuning in fewer time steps at the cost of
+        choosing from fewer timing samples. Autotuners that synchronize their
+        parameters over MPI ranks always time every parameter.
+
+        Set `autotuner_successive_halving` before the first call to
+        `Simulation.run` or call `Operations.tune_kernel_parameters` after
+        setting it.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.autotuner_successive_halving = True
+        """
+        return self._cpp_exec_conf.isAutotunerSuccessiveHalvingEnabled()
+
+    @autotuner_successive_halving.setter
+    def autotuner_successive_halving(self, new_bool):
+        self._cpp_exec_conf.setAutotunerSuccessiveHalving(new_bool)
+
+    @property
+    def autotuner_retune_threshold(self):
+        """float: Relative slowdown that starts a new kernel parameter scan.
+
+        When `autotuner_retune_threshold` is 0 (the default), autotuners hold
+        their parameters constant after tuning completes. When it is positive,
+        autotuners periodically time the tuned kernel parameters and start a new
+        scan when they run slower than the tuned time by more than this
+        fraction. Use this in simulations where the optimal parameters change
+        over time, such as during nucleation or melting. Combine with
+        `autotuner_successive_halving` to shorten the repeated scans.
+
+        While a new scan is in progress, ``is_tuning_complete`` is `False`.
+        Autotuners that synchronize their parameters over MPI ranks and
+        kernel parameters set by the user are not retuned.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.autotuner_retune_threshold = 0.2
+        """
+        return self._cpp_exec_conf.getAutotunerRetuneThreshold()
+
+    @autotuner_retune_threshold.setter
+    def autotuner_retune_threshold(self, threshold):
+        if threshold < 0:
+            raise ValueError("autotuner_retune_threshold must be non-negative.")
+        self._cpp_exec_conf.setAutotunerRetuneThreshold(float(threshold))
+
     @property
     def compute_capability(self):
         """tuple(int, int): Compute capability of the device.
@@ -483,6 +584,33 @@ class GPU(Device):
         finally:
             self._cpp_exec_conf.hipProfileStop()
 
+    def wait_for_stream(self, stream):
+        """Order HOOMD's GPU work after the work queued on a stream.
+
+        Args:
+            stream (int): Handle of a CUDA (or HIP) stream. Use ``1`` for the
+                legacy default stream and ``2`` for the per thread default
+                stream.
+
+        HOOMD-blue launches all of its kernels on the legacy default stream,
+        which does not wait for streams created with the non-blocking flag
+        (such as the streams created by PyTorch and CuPy). Call
+        `wait_for_stream` after queuing work on such a stream that writes to
+        HOOMD-blue arrays (for example, the forces in
+        `hoomd.md.force.Custom.gpu_local_force_arrays`). HOOMD-blue's next
+        kernels then wait for that work on the device. Neither HOOMD-blue nor
+        the host synchronizes the device.
+
+        .. rubric:: Example:
+
+        .. skip: next if(gpu_not_available)
+
+        .. code-block:: python
+
+            gpu.wait_for_stream(1)
+        """
+        _hoomd.wait_for_stream(int(stream))
+
 
 class CPU(Device):
     """Select the CPU to execute simulations.
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "../SystemDefinition.h"
+#include <algorithm>
 #include <memory>
 #include <pybind11/pybind11.h>
 #include <vector>
@@ -49,4 +50,76 @@ class PYBIND11_EXPORT ParticleFilter
         }
     };
 
+namespace detail
+    {
+/// Combine the tags selected by two filters
+/** Args:
+ *  X: tags selected by the first filter
+ *  Y: tags selected by the second filter
+ *  select: predicate select(in_X, in_Y) that is true for the tags to keep
+ *
+ *  Returns:
+ *  the kept tags in ascending order, each once
+ *
+ *  Dense selections are combined with one byte of flags per tag in linear time. Sparse selections
+ *  (few tags spread over a large tag range) are sorted and merged instead.
+ */
+template<class Select>
+std::vector<unsigned int>
+combine_tags(std::vector<unsigned int> X, std::vector<unsigned int> Y, const Select& select)
+    {
+    std::vector<unsigned int> tags;
+    if (X.empty() && Y.empty())
+        {
+        return tags;
+        }
+
+    unsigned int max_tag = 0;
+    for (unsigned int tag : X)
+        max_tag = std::max(max_tag, tag);
+    for (unsigned int tag : Y)
+        max_tag = std::max(max_tag, tag);
+
+    const size_t n_tags = size_t(max_tag) + 1;
+    if (n_tags <= 16 * (X.size() + Y.size()))
+        {
+        std::vector<unsigned char> flags(n_tags, 0);
+        for (unsigned int tag : X)
+            flags[tag] |= 1;
+        for (unsigned int tag : Y)
+            flags[tag] |= 2;
+
+        for (size_t tag = 0; tag < n_tags; ++tag)
+            {
+            if (flags[tag] && select((flags[tag] & 1) != 0, (flags[tag] & 2) != 0))
+                {
+                tags.push_back((unsigned int)tag);
+                }
+            }
+        return tags;
+        }
+
+    std::sort(X.begin(), X.end());
+    std::sort(Y.begin(), Y.end());
+    auto x = X.begin();
+    auto y = Y.begin();
+    while (x != X.end() || y != Y.end())
+        {
+        const unsigned int tag = (y == Y.end() || (x != X.end() && *x <= *y)) ? *x : *y;
+        bool in_X = false;
+        bool in_Y = false;
+        for (; x != X.end() && *x == tag; ++x)
+            in_X = true;
+        for (; y != Y.end() && *y == tag; ++y)
+            in_Y = true;
+
+        if (select(in_X, in_Y))
+            {
+            tags.push_back(tag);
+            }
+        }
+    return tags;
+    }
+    } // end namespace detail
+
     } // end namespace hoomd
@@ -5,7 +5,6 @@
 #define __PARTICLE_FILTER_SET_DIFFERENCE_H__
 
 #include "ParticleFilter.h"
-#include <algorithm>
 
 namespace hoomd
     {
@@ -37,18 +36,9 @@ class PYBIND11_EXPORT ParticleFilterSetDifference : public ParticleFilter
     virtual std::vector<unsigned int>
     getSelectedTags(std::shared_ptr<SystemDefinition> sysdef) const
         {
-        // Get tags for f() and g()
-        auto X = m_f->getSelectedTags(sysdef);
-        std::sort(X.begin(), X.end());
-
-        auto Y = m_g->getSelectedTags(sysdef);
-        std::sort(Y.begin(), Y.end());
-
-        // Create vector and get set difference
-        auto tags = std::vector<unsigned int>(X.size());
-        auto it = std::set_difference(X.begin(), X.end(), Y.begin(), Y.end(), tags.begin());
-        tags.resize(it - tags.begin());
-        return tags;
+        return detail::combine_tags(m_f->getSelectedTags(sysdef),
+                                    m_g->getSelectedTags(sysdef),
+                                    [](bool in_f, bool in_g) { return in_f && !in_g; });
         }
 
     protected:
@@ -45,11 +45,11 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
                                              access_location::host,
                                              access_mode::read);
 
-        // Get types as unsigned ints
-        std::unordered_set<unsigned int> types(m_types.size());
+        // Flag the selected type ids, so that each particle needs a single lookup
+        std::vector<unsigned char> selected(pdata->getNTypes(), 0);
         for (auto type_str : m_types)
             {
-            types.insert(pdata->getTypeByName(type_str));
+            selected[pdata->getTypeByName(type_str)] = 1;
             }
 
         // Add correctly typed particles to vector
@@ -59,7 +59,7 @@ class PYBIND11_EXPORT ParticleFilterType : public ParticleFilter
         for (unsigned int idx = 0; idx < N; ++idx)
             {
             unsigned int typ = __scalar_as_int(h_postype.data[idx].w);
-            if (types.count(typ))
+            if (typ < selected.size() && selected[typ])
                 {
                 *tag_it = h_tag.data[idx];
                 tag_it++;
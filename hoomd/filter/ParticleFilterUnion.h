@@ -5,7 +5,6 @@
 #define __PARTICLE_FILTER_UNION_H__
 
 #include "ParticleFilter.h"
-#include <algorithm>
 
 namespace hoomd
     {
@@ -34,18 +33,9 @@ class PYBIND11_EXPORT ParticleFilterUnion : public ParticleFilter
     virtual std::vector<unsigned int>
     getSelectedTags(std::shared_ptr<SystemDefinition> sysdef) const
         {
-        // Get tags for f() and g() as sets
-        auto X = m_f->getSelectedTags(sysdef);
-        std::sort(X.begin(), X.end());
-
-        auto Y = m_g->getSelectedTags(sysdef);
-        std::sort(Y.begin(), Y.end());
-
-        // Create vector and get union
-        auto tags = std::vector<unsigned int>(X.size() + Y.size());
-        auto it = std::set_union(X.begin(), X.end(), Y.begin(), Y.end(), tags.begin());
-        tags.resize(it - tags.begin());
-        return tags;
+        return detail::combine_tags(m_f->getSelectedTags(sysdef),
+                                    m_g->getSelectedTags(sysdef),
+                                    [](bool in_f, bool in_g) { return in_f || in_g; });
         }
 
     protected:
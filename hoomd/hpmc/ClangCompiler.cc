@@ -2,6 +2,7 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "ClangCompiler.h"
+#include "hoomd/HOOMDVersion.h"
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
@@ -17,20 +18,37 @@
 #include <clang/Lex/HeaderSearch.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <clang/Tooling/Tooling.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/InitializePasses.h>
 #include <llvm/PassRegistry.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_os_ostream.h>
+#include <llvm/Support/xxhash.h>
 
 #pragma GCC diagnostic pop
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <sys/stat.h>
+#include <unistd.h>
+
+// hoomd/hpmc/CMakeLists.txt sets the git revision of the build
+#ifndef HOOMD_GIT_SHA1
+#define HOOMD_GIT_SHA1 "unknown"
+#endif
 
 namespace hoomd
     {
@@ -73,10 +91,202 @@ ClangCompiler::ClangCompiler()
     llvm::initializeTarget(Registry);
     }
 
+/** @returns The module cache directory, or an empty string when the cache is disabled.
+ */
+static std::string getCacheDirectory()
+    {
+    const char* cache_dir = getenv("HOOMD_JIT_CACHE_DIR");
+    if (cache_dir == nullptr)
+        {
+        return std::string();
+        }
+    return std::string(cache_dir);
+    }
+
+/** @param name File name to read.
+    @param contents Output: Contents of the file.
+
+    @returns true when the file was read.
+*/
+static bool readFile(const std::string& name, std::string& contents)
+    {
+    std::ifstream file(name, std::ios::binary);
+    if (!file)
+        {
+        return false;
+        }
+    std::ostringstream s;
+    s << file.rdbuf();
+    contents = s.str();
+    return bool(file);
+    }
+
+/** @param name File name to write.
+    @param contents Contents of the file.
+
+    Write to a temporary file and rename it so that concurrent processes never read a partially
+    written file.
+*/
+static void writeFileAtomic(const std::string& name, const std::string& contents)
+    {
+    std::string temp_name = name + "." + std::to_string(getpid()) + ".tmp";
+        {
+        std::ofstream file(temp_name, std::ios::binary);
+        file.write(contents.data(), std::streamsize(contents.size()));
+        if (!file)
+            {
+            std::remove(temp_name.c_str());
+            return;
+            }
+        }
+    if (std::rename(temp_name.c_str(), name.c_str()) != 0)
+        {
+        std::remove(temp_name.c_str());
+        }
+    }
+
+/** @param args The compiler arguments.
+
+    @returns A fingerprint of the header files in the include directories named in \a args.
+
+    The fingerprint combines the path, size, and modification time of every header file in the
+    include directories, so the module cache misses when any HOOMD header is modified or
+    reinstalled.
+*/
+static std::string getIncludeFingerprint(const std::vector<std::string>& args)
+    {
+    std::vector<std::string> files;
+    for (size_t i = 0; i < args.size(); i++)
+        {
+        std::string include_dir;
+        if (args[i] == "-I" && i + 1 < args.size())
+            {
+            include_dir = args[++i];
+            }
+        else if (args[i].compare(0, 2, "-I") == 0)
+            {
+            include_dir = args[i].substr(2);
+            }
+        else
+            {
+            continue;
+            }
+
+        std::error_code ec;
+        for (auto it = std::filesystem::recursive_directory_iterator(include_dir, ec);
+             !ec && it != std::filesystem::recursive_directory_iterator();
+             it.increment(ec))
+            {
+            const std::filesystem::path& path = it->path();
+            if (path.filename().string().compare(0, 1, ".") == 0)
+                {
+                // skip hidden directories, such as .git in a source tree
+                it.disable_recursion_pending();
+                continue;
+                }
+
+            const std::string extension = path.extension().string();
+            if (!it->is_regular_file(ec)
+                || (extension != ".h" && extension != ".cuh" && extension != ".inc"
+                    && extension != ".hpp"))
+                {
+                continue;
+                }
+            files.push_back(path.string() + " " + std::to_string(it->file_size(ec)) + " "
+                            + std::to_string(it->last_write_time(ec).time_since_epoch().count()));
+            }
+        }
+
+    // the directory iteration order is unspecified
+    std::sort(files.begin(), files.end());
+    std::string listing;
+    for (auto& file : files)
+        {
+        listing += file + "\n";
+        }
+
+    std::ostringstream s;
+    s << std::hex << std::setw(16) << std::setfill('0') << llvm::xxHash64(llvm::StringRef(listing));
+    return s.str();
+    }
+
+/** @param key Text that uniquely identifies the compilation.
+    @param context LLVM context to load the module into.
+    @param path Output: Path to the cached bitcode, without extension.
+
+    @returns The cached module, or nullptr when there is no valid module in the cache.
+
+    The cache stores the bitcode in `<hash>.bc` next to the full key in `<hash>.key`. A module is
+    loaded only when the stored key matches \a key exactly.
+*/
+static std::unique_ptr<llvm::Module>
+loadCachedModule(const std::string& key, llvm::LLVMContext& context, std::string& path)
+    {
+    std::string cache_dir = getCacheDirectory();
+    if (cache_dir.empty())
+        {
+        return nullptr;
+        }
+
+    std::ostringstream s;
+    s << cache_dir << "/" << std::hex << std::setw(16) << std::setfill('0')
+      << llvm::xxHash64(llvm::StringRef(key));
+    path = s.str();
+
+    std::string stored_key;
+    if (!readFile(path + ".key", stored_key) || stored_key != key)
+        {
+        return nullptr;
+        }
+
+    auto buffer = llvm::MemoryBuffer::getFile(path + ".bc");
+    if (!buffer)
+        {
+        return nullptr;
+        }
+
+    auto module = llvm::parseBitcodeFile(buffer.get()->getMemBufferRef(), context);
+    if (!module)
+        {
+        llvm::consumeError(module.takeError());
+        return nullptr;
+        }
+
+    return std::move(module.get());
+    }
+
+/** @param key Text that uniquely identifies the compilation.
+    @param module Compiled module.
+    @param path Path to the cached bitcode, without extension (set by loadCachedModule).
+*/
+static void
+storeCachedModule(const std::string& key, const llvm::Module& module, const std::string& path)
+    {
+    if (path.empty() || llvm::sys::fs::create_directories(llvm::sys::path::parent_path(path)))
+        {
+        return;
+        }
+
+    std::string bitcode;
+    llvm::raw_string_ostream bitcode_stream(bitcode);
+    llvm::WriteBitcodeToFile(module, bitcode_stream);
+    bitcode_stream.flush();
+
+    // write the bitcode first so that a matching key always refers to complete bitcode
+    writeFileAtomic(path + ".bc", bitcode);
+    writeFileAtomic(path + ".key", key);
+    }
+
 /** @param code The C++ code to compile.
     @param user_args The arguments to pass to the compiler.
 
     @returns The LLVM module with the code compiled.
+
+    When the environment variable HOOMD_JIT_CACHE_DIR is set, compileCode() stores the LLVM bitcode
+    of each module in that directory, keyed by the code, the compiler arguments, the clang version,
+    the target triple, the HOOMD version and git revision, and a fingerprint of the included
+    headers. Later calls (in this or any other process) with the same key load the
+    bitcode instead of running the compiler frontend.
 */
 std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code,
                                                          const std::vector<std::string>& user_args,
@@ -133,6 +343,23 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
     clang_args.insert(clang_args.end(), user_args.begin(), user_args.end());
     clang_args.push_back("_hoomd_llvm_code.cc");
 
+    // look for a previously compiled module
+    std::string cache_key
+        = "clang " CLANG_VERSION_STRING "\n" + llvm::sys::getDefaultTargetTriple() + "\n";
+    cache_key += "hoomd " HOOMD_VERSION " " HOOMD_GIT_SHA1 "\n";
+    cache_key += "headers " + getIncludeFingerprint(clang_args) + "\n";
+    for (auto& arg : clang_args)
+        {
+        cache_key += arg + "\n";
+        }
+    cache_key += code;
+
+    std::string cache_path;
+    if (auto cached_module = loadCachedModule(cache_key, context, cache_path))
+        {
+        return cached_module;
+        }
+
     // convert arguments to a char** array.
     std::vector<const char*> clang_arg_c_strings;
     clang_arg_c_strings.push_back("clang");
@@ -224,6 +451,8 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
         return nullptr;
         }
 
+    storeCachedModule(cache_key, *module, cache_path);
+
     return module;
     }
 
@@ -11,6 +11,12 @@
 #include "IntegratorHPMCMono.h"
 #include "hoomd/RNGIdentifiers.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file ComputeFreeVolume.h
     \brief Defines the template class for an approximate free volume integration
     \note This header cannot be compiled by nvcc
@@ -164,8 +170,9 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
         n_sample /= this->m_exec_conf->getNRanks();
 #endif
 
-        for (unsigned int i = 0; i < n_sample; i++)
-            {
+        // test sample i for overlaps with the particles in the system state
+        auto test_sample = [&](unsigned int i, unsigned int& err_count) -> bool
+        {
             // select a random particle coordinate in the box
             hoomd::RandomGenerator rng_i(
                 hoomd::Seed(hoomd::RNGIdentifier::ComputeFreeVolume, timestep, seed),
@@ -174,7 +181,7 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
             Scalar xrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
             Scalar yrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
             Scalar zrand = hoomd::detail::generate_canonical<Scalar>(rng_i);
-            if (this->m_sysdef->getNDimensions() == 2)
+            if (ndim == 2)
                 {
                 zrand = 0;
                 }
@@ -187,8 +194,6 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                 shape_i.orientation = generateRandomOrientation(rng_i, ndim);
                 }
 
-            // check for overlaps with particles in the system state
-            bool overlap = false;
             hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0, 0, 0));
 
             // All image boxes (including the primary)
@@ -214,12 +219,9 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                                 // read in its position and orientation
                                 unsigned int j = aabb_tree.getNodeParticle(cur_node_idx, cur_p);
 
-                                Scalar4 postype_j;
-                                Scalar4 orientation_j;
-
                                 // load the position and orientation of the j particle
-                                postype_j = h_postype.data[j];
-                                orientation_j = h_orientation.data[j];
+                                Scalar4 postype_j = h_postype.data[j];
+                                Scalar4 orientation_j = h_orientation.data[j];
 
                                 // put particles in coordinate system of particle i
                                 vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
@@ -231,8 +233,7 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                                     && check_circumsphere_overlap(r_ij, shape_i, shape_j)
                                     && test_overlap(r_ij, shape_i, shape_j, err_count))
                                     {
-                                    overlap = true;
-                                    break;
+                                    return true;
                                     }
                                 }
                             }
@@ -242,21 +243,51 @@ template<class Shape> void ComputeFreeVolume<Shape>::computeFreeVolume(uint64_t
                         // skip ahead
                         cur_node_idx += aabb_tree.getNodeSkip(cur_node_idx);
                         }
-
-                    if (overlap)
-                        break;
                     } // end loop over AABB nodes
+                }     // end loop over images
 
-                if (overlap)
-                    break;
-                } // end loop over images
+            return false;
+        };
 
-            if (overlap)
-                {
-                overlap_count++;
-                }
-            } // end loop through all particles
+#ifdef ENABLE_TBB
+        if (m_exec_conf->getNumThreads() > 1)
+            {
+            // samples are independent, count the overlaps per thread and sum them at the end
+            tbb::enumerable_thread_specific<unsigned int> thread_overlap_count(0);
+            tbb::enumerable_thread_specific<unsigned int> thread_err_count(0);
 
+            m_exec_conf->getTaskArena()->execute(
+                [&]
+                {
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_sample),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          unsigned int& count = thread_overlap_count.local();
+                                          unsigned int& errors = thread_err_count.local();
+                                          for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                              {
+                                              if (test_sample(i, errors))
+                                                  count++;
+                                              }
+                                      });
+                });
+
+            for (unsigned int count : thread_overlap_count)
+                overlap_count += count;
+            for (unsigned int errors : thread_err_count)
+                err_count += errors;
+            }
+        else
+#endif
+            {
+            for (unsigned int i = 0; i < n_sample; i++)
+                {
+                if (test_sample(i, err_count))
+                    {
+                    overlap_count++;
+                    }
+                } // end loop through all samples
+            }
         } // end lexical scope
 
 #ifdef ENABLE_MPI
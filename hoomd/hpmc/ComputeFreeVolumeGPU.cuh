@@ -7,6 +7,7 @@
 #include "HPMCCounters.h"
 #include "hip/hip_runtime.h"
 
+#include "hoomd/GPUPartition.cuh"
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 #include "hoomd/ParticleData.cuh"
@@ -58,18 +59,21 @@ struct hpmc_free_volume_args_t
                             const unsigned int _group_size,
                             const unsigned int _max_n,
                             unsigned int* _d_n_overlap_all,
+                            const unsigned int _overlap_pitch,
                             const Scalar3 _ghost_width,
                             const unsigned int* _d_check_overlaps,
                             Index2D _overlap_idx,
-                            const hipDeviceProp_t& _devprop)
+                            const hipDeviceProp_t& _devprop,
+                            const GPUPartition& _gpu_partition)
         : n_sample(_n_sample), type(_type), d_postype(_d_postype), d_orientation(_d_orientation),
           d_cell_idx(_d_cell_idx), d_cell_size(_d_cell_size), ci(_ci), cli(_cli),
           d_excell_idx(_d_excell_idx), d_excell_size(_d_excell_size), excli(_excli),
           cell_dim(_cell_dim), N(_N), num_types(_num_types), seed(_seed), rank(_rank),
           select(_select), timestep(_timestep), dim(_dim), box(_box), block_size(_block_size),
           stride(_stride), group_size(_group_size), max_n(_max_n),
-          d_n_overlap_all(_d_n_overlap_all), ghost_width(_ghost_width),
-          d_check_overlaps(_d_check_overlaps), overlap_idx(_overlap_idx), devprop(_devprop) {};
+          d_n_overlap_all(_d_n_overlap_all), overlap_pitch(_overlap_pitch),
+          ghost_width(_ghost_width), d_check_overlaps(_d_check_overlaps),
+          overlap_idx(_overlap_idx), devprop(_devprop), gpu_partition(_gpu_partition) {};
 
     unsigned int n_sample;                //!< Number of depletants particles to generate
     unsigned int type;                    //!< Type of depletant particle
@@ -95,11 +99,13 @@ struct hpmc_free_volume_args_t
     unsigned int stride;                  //!< Number of threads per overlap check
     unsigned int group_size;              //!< Size of the group to execute
     const unsigned int max_n;             //!< Maximum size of pdata arrays
-    unsigned int* d_n_overlap_all;        //!< Total number of depletants in overlap volume
+    unsigned int* d_n_overlap_all;        //!< Number of depletants in overlap volume per GPU
+    const unsigned int overlap_pitch;     //!< Distance between the counters of two GPUs
     const Scalar3 ghost_width;            //!< Width of ghost layer
     const unsigned int* d_check_overlaps; //!< Interaction matrix
     Index2D overlap_idx;                  //!< Interaction matrix indexer
     const hipDeviceProp_t& devprop;       //!< CUDA device properties
+    const GPUPartition& gpu_partition;    //!< Split of the samples across GPUs
     };
 
 template<class Shape>
@@ -135,7 +141,8 @@ __device__ inline unsigned int compute_cell_idx(const Scalar3 p,
     }
 
 //! Kernel to estimate the colloid overlap volume and the depletant free volume
-/*! \param n_sample Number of probe depletant particles to generate
+/*! \param n_sample Number of probe depletant particles to generate on this GPU
+    \param sample_offset Index of the first sample generated on this GPU
     \param type Type of depletant particle
     \param d_postype Particle positions and types by index
     \param d_orientation Particle orientation
@@ -152,13 +159,14 @@ __device__ inline unsigned int compute_cell_idx(const Scalar3 p,
     \param timestep Current timestep of the simulation
     \param dim Dimension of the simulation box
     \param box Simulation box
-    \param d_n_overlap_all Total overlap counter (output value)
+    \param d_n_overlap_all Overlap counter of this GPU (output value)
     \param ghost_width Width of ghost layer
     \param d_params Per-type shape parameters
     \param d_overlaps Per-type pair interaction matrix
 */
 template<class Shape>
 __global__ void gpu_hpmc_free_volume_kernel(unsigned int n_sample,
+                                            unsigned int sample_offset,
                                             unsigned int type,
                                             Scalar4* d_postype,
                                             Scalar4* d_orientation,
@@ -255,9 +263,9 @@ __global__ void gpu_hpmc_free_volume_kernel(unsigned int n_sample,
         active = false;
         }
 
-    // one RNG per particle
+    // one RNG per sample, independent of the number of GPUs
     hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::ComputeFreeVolume, timestep, seed),
-                               hoomd::Counter(rank, i));
+                               hoomd::Counter(rank, sample_offset + i));
 
     unsigned int my_cell;
 
@@ -378,9 +386,6 @@ hipError_t gpu_hpmc_free_volume(const hpmc_free_volume_args_t& args,
     assert(args.group_size <= 32); // note, really should be warp size of the device
     assert(args.block_size % (args.stride * args.group_size) == 0);
 
-    // reset counters
-    hipMemsetAsync(args.d_n_overlap_all, 0, sizeof(unsigned int));
-
     // determine the maximum block size and clamp the input block size down
     int max_block_size;
     hipFuncAttributes attr;
@@ -392,7 +397,6 @@ hipError_t gpu_hpmc_free_volume(const hpmc_free_volume_args_t& args,
         = min(args.block_size, (unsigned int)max_block_size) / args.group_size / args.stride;
 
     dim3 threads(args.stride, args.group_size, n_groups);
-    dim3 grid(args.n_sample / n_groups + 1, 1, 1);
 
     size_t shared_bytes = args.num_types * sizeof(typename Shape::param_type)
                           + n_groups * sizeof(unsigned int)
@@ -418,36 +422,52 @@ hipError_t gpu_hpmc_free_volume(const hpmc_free_volume_args_t& args,
 
     shared_bytes += extra_bytes;
 
-    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_hpmc_free_volume_kernel<Shape>),
-                       dim3(grid),
-                       dim3(threads),
-                       shared_bytes,
-                       0,
-                       args.n_sample,
-                       args.type,
-                       args.d_postype,
-                       args.d_orientation,
-                       args.d_cell_size,
-                       args.ci,
-                       args.cli,
-                       args.d_excell_idx,
-                       args.d_excell_size,
-                       args.excli,
-                       args.cell_dim,
-                       args.N,
-                       args.num_types,
-                       args.seed,
-                       args.rank,
-                       args.select,
-                       args.timestep,
-                       args.dim,
-                       args.box,
-                       args.d_n_overlap_all,
-                       args.ghost_width,
-                       args.d_check_overlaps,
-                       args.overlap_idx,
-                       d_params,
-                       max_extra_bytes);
+    // split the samples across the GPUs, each GPU counts its overlaps separately
+    for (int idev = args.gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = args.gpu_partition.getRangeAndSetGPU(idev);
+        unsigned int nwork = range.second - range.first;
+        unsigned int* d_n_overlap = args.d_n_overlap_all + idev * args.overlap_pitch;
+
+        hipMemsetAsync(d_n_overlap, 0, sizeof(unsigned int));
+
+        if (nwork == 0)
+            continue;
+
+        dim3 grid(nwork / n_groups + 1, 1, 1);
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_hpmc_free_volume_kernel<Shape>),
+                           dim3(grid),
+                           dim3(threads),
+                           shared_bytes,
+                           0,
+                           nwork,
+                           range.first,
+                           args.type,
+                           args.d_postype,
+                           args.d_orientation,
+                           args.d_cell_size,
+                           args.ci,
+                           args.cli,
+                           args.d_excell_idx,
+                           args.d_excell_size,
+                           args.excli,
+                           args.cell_dim,
+                           args.N,
+                           args.num_types,
+                           args.seed,
+                           args.rank,
+                           args.select,
+                           args.timestep,
+                           args.dim,
+                           args.box,
+                           d_n_overlap,
+                           args.ghost_width,
+                           args.d_check_overlaps,
+                           args.overlap_idx,
+                           d_params,
+                           max_extra_bytes);
+        }
 
     return hipSuccess;
     }
@@ -9,6 +9,8 @@
 #include "hoomd/Autotuner.h"
 #include "hoomd/CellList.h"
 #include "hoomd/Compute.h"
+#include "hoomd/GPUPartition.cuh"
+#include "hoomd/GlobalArray.h"
 
 #include "ComputeFreeVolume.h"
 #include "ComputeFreeVolumeGPU.cuh"
@@ -51,9 +53,12 @@ template<class Shape> class ComputeFreeVolumeGPU : public ComputeFreeVolume<Shap
     uint3 m_last_dim;         //!< Dimensions of the cell list on the last call to update
     unsigned int m_last_nmax; //!< Last cell list NMax value allocated in excell
 
-    GPUArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
-    GPUArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
-    Index2D m_excell_list_indexer;        //!< Indexer to access elements of the excell_idx list
+    GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
+    GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
+    Index2D m_excell_list_indexer;           //!< Indexer to access elements of the excell_idx list
+
+    GlobalArray<unsigned int> m_n_overlap_per_device; //!< Overlap counters, one page per GPU
+    GPUPartition m_sample_partition;                  //!< Split of the samples across GPUs
 
     /// Autotuner for the overlap/free volume counter
     std::shared_ptr<Autotuner<3>> m_tuner_free_volume;
@@ -96,11 +101,42 @@ ComputeFreeVolumeGPU<Shape>::ComputeFreeVolumeGPU(std::shared_ptr<SystemDefiniti
                          3,
                          false,
                          is_parameter_valid));
-    GPUArray<unsigned int> excell_size(0, this->m_exec_conf);
+    GlobalArray<unsigned int> excell_size(0, this->m_exec_conf);
     m_excell_size.swap(excell_size);
+    TAG_ALLOCATION(m_excell_size);
 
-    GPUArray<unsigned int> excell_idx(0, this->m_exec_conf);
+    GlobalArray<unsigned int> excell_idx(0, this->m_exec_conf);
     m_excell_idx.swap(excell_idx);
+    TAG_ALLOCATION(m_excell_idx);
+
+    //! One counter per GPU, separated by an entire memory page
+    unsigned int pitch
+        = (unsigned int)((getpagesize() + sizeof(unsigned int) - 1) / sizeof(unsigned int));
+    GlobalArray<unsigned int>(pitch, this->m_exec_conf->getNumActiveGPUs(), this->m_exec_conf)
+        .swap(m_n_overlap_per_device);
+    TAG_ALLOCATION(m_n_overlap_per_device);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    if (this->m_exec_conf->allConcurrentManagedAccess())
+        {
+        // set memory hints
+        auto gpu_map = this->m_exec_conf->getGPUIds();
+        for (unsigned int idev = 0; idev < this->m_exec_conf->getNumActiveGPUs(); ++idev)
+            {
+            cudaMemAdvise(m_n_overlap_per_device.get() + idev * m_n_overlap_per_device.getPitch(),
+                          sizeof(unsigned int) * m_n_overlap_per_device.getPitch(),
+                          cudaMemAdviseSetPreferredLocation,
+                          gpu_map[idev]);
+            cudaMemPrefetchAsync(m_n_overlap_per_device.get()
+                                     + idev * m_n_overlap_per_device.getPitch(),
+                                 sizeof(unsigned int) * m_n_overlap_per_device.getPitch(),
+                                 gpu_map[idev]);
+            }
+        CHECK_CUDA_ERROR();
+        }
+#endif
+
+    m_sample_partition = GPUPartition(this->m_exec_conf->getGPUIds());
 
     // set last dim to a bogus value so that it will re-init on the first call
     m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
@@ -229,10 +265,10 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
     auto& params = this->m_mc->getParams();
 
         {
-        // access counter
-        ArrayHandle<unsigned int> d_n_overlap_all(this->m_n_overlap_all,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
+        // access the per-device counters
+        ArrayHandle<unsigned int> d_n_overlap_per_device(m_n_overlap_per_device,
+                                                         access_location::device,
+                                                         access_mode::overwrite);
 
         m_tuner_free_volume->begin();
         auto param = m_tuner_free_volume->getParam();
@@ -246,6 +282,9 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
         n_sample /= this->m_exec_conf->getNRanks();
 #endif
 
+        m_sample_partition.setN(n_sample);
+        const unsigned int overlap_pitch = (unsigned int)m_n_overlap_per_device.getPitch();
+
         detail::hpmc_free_volume_args_t free_volume_args(n_sample,
                                                          this->m_type,
                                                          d_postype.data,
@@ -270,11 +309,13 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
                                                          stride,
                                                          group_size,
                                                          this->m_pdata->getMaxN(),
-                                                         d_n_overlap_all.data,
+                                                         d_n_overlap_per_device.data,
+                                                         overlap_pitch,
                                                          this->m_cl->getGhostWidth(),
                                                          d_overlaps.data,
                                                          overlap_idx,
-                                                         this->m_exec_conf->dev_prop);
+                                                         this->m_exec_conf->dev_prop,
+                                                         m_sample_partition);
 
         // invoke kernel for counting total overlap volume
         detail::gpu_hpmc_free_volume<Shape>(free_volume_args, params.data());
@@ -285,20 +326,34 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::computeFreeVolume(uint64
         m_tuner_free_volume->end();
         }
 
+    // wait for all GPUs, then sum their counters and the counters of all ranks
+    this->m_exec_conf->multiGPUBarrier();
+
+    unsigned int overlap_count = 0;
+        {
+        ArrayHandle<unsigned int> h_n_overlap_per_device(m_n_overlap_per_device,
+                                                         access_location::host,
+                                                         access_mode::read);
+        for (unsigned int idev = 0; idev < this->m_exec_conf->getNumActiveGPUs(); ++idev)
+            overlap_count += h_n_overlap_per_device.data[idev * m_n_overlap_per_device.getPitch()];
+        }
+
 #ifdef ENABLE_MPI
     if (this->m_sysdef->isDomainDecomposed())
         {
-        ArrayHandle<unsigned int> h_n_overlap_all(this->m_n_overlap_all,
-                                                  access_location::host,
-                                                  access_mode::readwrite);
         MPI_Allreduce(MPI_IN_PLACE,
-                      h_n_overlap_all.data,
+                      &overlap_count,
                       1,
                       MPI_UNSIGNED,
                       MPI_SUM,
                       this->m_exec_conf->getMPICommunicator());
         }
 #endif
+
+    ArrayHandle<unsigned int> h_n_overlap_all(this->m_n_overlap_all,
+                                              access_location::host,
+                                              access_mode::overwrite);
+    *h_n_overlap_all.data = overlap_count;
     }
 
 template<class Shape> void ComputeFreeVolumeGPU<Shape>::initializeExcellMem()
@@ -308,7 +363,9 @@ template<class Shape> void ComputeFreeVolumeGPU<Shape>::initializeExcellMem()
     // get the current cell dimensions
     unsigned int num_cells = this->m_cl->getCellIndexer().getNumElements();
     unsigned int num_adj = this->m_cl->getCellAdjIndexer().getW();
-    unsigned int num_max = this->m_cl->getNmax();
+    unsigned int n_cell_list
+        = this->m_cl->getPerDevice() ? this->m_exec_conf->getNumActiveGPUs() : 1;
+    unsigned int num_max = this->m_cl->getNmax() * n_cell_list;
 
     // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
     m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
@@ -15,6 +15,12 @@
 #include "hoomd/HOOMDMPI.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file ComputeSDF.h
     \brief Defines the template class for an sdf compute
     \note This header cannot be compiled by nvcc
@@ -176,10 +182,13 @@ template<class Shape> class ComputeSDF : public Compute
     void zeroHistogram();
 
     //! Add to histogram counts
-    void countHistogram(uint64_t timestep);
+    virtual void countHistogram(uint64_t timestep);
     void countHistogramBinarySearch(uint64_t timestep);
     void countHistogramLinearSearch(uint64_t timestep);
 
+    //! Call count_particle(i, hist_compression, hist_expansion) for all local particles
+    template<class CountParticle> void countParticles(const CountParticle& count_particle);
+
     //! Determine the s bin of a given particle pair; only used for the binary search
     size_t computeBin(const vec3<Scalar>& r_ij,
                       const quat<Scalar>& orientation_i,
@@ -381,10 +390,11 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_
     const std::vector<param_type, hoomd::detail::managed_allocator<param_type>>& params
         = m_mc->getParams();
 
-    // loop through N particles
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // count the first overlap of particle i
+    auto count_particle
+        = [&](unsigned int i, std::vector<double>& hist_compression, std::vector<double>&)
         {
-        size_t min_bin = m_hist_compression.size();
+        size_t min_bin = hist_compression.size();
         // read in the current position and orientation
         Scalar4 postype_i = h_postype.data[i];
         const quat<LongReal> orientation_i(h_orientation.data[i]);
@@ -449,12 +459,14 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramBinarySearch(uint64_
                     }
                 } // end loop over AABB nodes
             }     // end loop over images
-        if (min_bin < m_hist_compression.size())
+        if (min_bin < hist_compression.size())
             {
-            m_hist_compression[min_bin]++;
+            hist_compression[min_bin]++;
             }
-        } // end loop over all particles
-    }     // end countHistogramBinarySearch()
+        };
+
+    countParticles(count_particle);
+    } // end countHistogramBinarySearch()
 
 template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_t timestep)
     {
@@ -493,10 +505,12 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
     // up to the minimum bin that we've already found for particle i.
     // Then we add to m_hist_compression[min_bin] the negative Mayer-function corresponding to the
     // type of overlap corresponding to particle i's first overlap.
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    auto count_particle = [&](unsigned int i,
+                              std::vector<double>& hist_compression,
+                              std::vector<double>& hist_expansion)
         {
-        size_t min_bin_compression = m_hist_compression.size();
-        size_t min_bin_expansion = m_hist_expansion.size();
+        size_t min_bin_compression = hist_compression.size();
+        size_t min_bin_expansion = hist_expansion.size();
         double hist_weight_ptl_i_compression = 2.0;
         double hist_weight_ptl_i_expansion = 2.0;
 
@@ -690,16 +704,72 @@ template<class Shape> void ComputeSDF<Shape>::countHistogramLinearSearch(uint64_
                     }
                 } // end loop over AABB nodes
             }     // end loop over images
-        if (min_bin_compression < m_hist_compression.size() && hist_weight_ptl_i_compression <= 1.0)
+        if (min_bin_compression < hist_compression.size() && hist_weight_ptl_i_compression <= 1.0)
             {
-            m_hist_compression[min_bin_compression] += hist_weight_ptl_i_compression;
+            hist_compression[min_bin_compression] += hist_weight_ptl_i_compression;
             }
-        if (min_bin_expansion < m_hist_expansion.size() && hist_weight_ptl_i_expansion <= 1.0)
+        if (min_bin_expansion < hist_expansion.size() && hist_weight_ptl_i_expansion <= 1.0)
             {
-            m_hist_expansion[min_bin_expansion] += hist_weight_ptl_i_expansion;
+            hist_expansion[min_bin_expansion] += hist_weight_ptl_i_expansion;
             }
-        } // end loop over all particles
-    }     // end countHistogramLinearSearch()
+        };
+
+    countParticles(count_particle);
+    } // end countHistogramLinearSearch()
+
+/*! \param count_particle Function that adds the contribution of particle i to the given
+    compression and expansion histograms.
+
+    With more than one TBB thread, each thread counts into its own histograms, which are summed
+    into m_hist_compression and m_hist_expansion at the end.
+*/
+template<class Shape>
+template<class CountParticle>
+void ComputeSDF<Shape>::countParticles(const CountParticle& count_particle)
+    {
+    const unsigned int N = m_pdata->getN();
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        const size_t n_bins = m_hist_compression.size();
+        tbb::enumerable_thread_specific<std::vector<double>> thread_hist_compression(n_bins, 0.0);
+        tbb::enumerable_thread_specific<std::vector<double>> thread_hist_expansion(n_bins, 0.0);
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      std::vector<double>& hist_compression
+                                          = thread_hist_compression.local();
+                                      std::vector<double>& hist_expansion
+                                          = thread_hist_expansion.local();
+                                      for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                          count_particle(i, hist_compression, hist_expansion);
+                                  });
+            });
+
+        // reduce the per-thread histograms
+        for (const auto& hist : thread_hist_compression)
+            {
+            for (size_t bin = 0; bin < n_bins; bin++)
+                m_hist_compression[bin] += hist[bin];
+            }
+        for (const auto& hist : thread_hist_expansion)
+            {
+            for (size_t bin = 0; bin < n_bins; bin++)
+                m_hist_expansion[bin] += hist[bin];
+            }
+        }
+    else
+#endif
+        {
+        for (unsigned int i = 0; i < N; i++)
+            count_particle(i, m_hist_compression, m_hist_expansion);
+        }
+    }
 
 /*! \param r_ij Vector pointing from particle i to j (already wrapped into the box)
     \param orientation_i Orientation of the particle i
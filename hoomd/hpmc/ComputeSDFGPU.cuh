@@ -0,0 +1,383 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _COMPUTE_SDF_CUH_
+#define _COMPUTE_SDF_CUH_
+
+#include "hip/hip_runtime.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#ifdef __HIPCC__
+#include "GPUHelpers.cuh"
+#endif
+
+/*! \file ComputeSDFGPU.cuh
+    \brief Declaration of CUDA kernels drivers for ComputeSDFGPU
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Wraps arguments to gpu_hpmc_sdf
+/*! \ingroup hpmc_data_structs */
+struct hpmc_sdf_args_t
+    {
+    //! Construct a hpmc_sdf_args_t
+    hpmc_sdf_args_t(const unsigned int _N,
+                    const Scalar4* _d_postype,
+                    const Scalar4* _d_orientation,
+                    const unsigned int* _d_excell_idx,
+                    const unsigned int* _d_excell_size,
+                    const Index2D& _excli,
+                    const Index3D& _ci,
+                    const uint3& _cell_dim,
+                    const Scalar3 _ghost_width,
+                    const BoxDim& _box,
+                    const unsigned int _num_types,
+                    const Scalar _dx,
+                    const unsigned int _n_bins,
+                    const Scalar _extra_width,
+                    const bool _linear_search,
+                    unsigned int* _d_hist_compression,
+                    unsigned int* _d_hist_expansion,
+                    const unsigned int _block_size,
+                    const unsigned int _group_size,
+                    const hipDeviceProp_t& _devprop)
+        : N(_N), d_postype(_d_postype), d_orientation(_d_orientation),
+          d_excell_idx(_d_excell_idx), d_excell_size(_d_excell_size), excli(_excli), ci(_ci),
+          cell_dim(_cell_dim), ghost_width(_ghost_width), box(_box), num_types(_num_types),
+          dx(_dx), n_bins(_n_bins), extra_width(_extra_width), linear_search(_linear_search),
+          d_hist_compression(_d_hist_compression), d_hist_expansion(_d_hist_expansion),
+          block_size(_block_size), group_size(_group_size), devprop(_devprop) {};
+
+    const unsigned int N;              //!< Number of local particles
+    const Scalar4* d_postype;          //!< postype array
+    const Scalar4* d_orientation;      //!< orientation array
+    const unsigned int* d_excell_idx;  //!< Expanded cell neighbors
+    const unsigned int* d_excell_size; //!< Size of expanded cell list per cell
+    const Index2D excli;               //!< Expanded cell indexer
+    const Index3D ci;                  //!< Cell indexer
+    const uint3 cell_dim;              //!< Cell dimensions
+    const Scalar3 ghost_width;         //!< Width of ghost layer
+    const BoxDim box;                  //!< Current simulation box
+    const unsigned int num_types;      //!< Number of particle types
+    const Scalar dx;                   //!< Histogram bin width
+    const unsigned int n_bins;         //!< Number of histogram bins
+    const Scalar extra_width;          //!< Search distance beyond the circumsphere contact
+    const bool linear_search;          //!< Sample every bin and also count expansions
+    unsigned int* d_hist_compression;  //!< Compression histogram (output)
+    unsigned int* d_hist_expansion;    //!< Expansion histogram (output)
+    unsigned int block_size;           //!< Block size to execute
+    unsigned int group_size;           //!< Number of threads per particle
+    const hipDeviceProp_t& devprop;    //!< CUDA device properties
+    };
+
+template<class Shape>
+hipError_t gpu_hpmc_sdf(const hpmc_sdf_args_t& args, const typename Shape::param_type* d_params);
+
+#ifdef __HIPCC__
+
+//! Test the overlap of two shapes with the separation scaled by (1 - lambda)
+template<class Shape>
+__device__ inline bool test_scaled_overlap_device(const vec3<Scalar>& r_ij,
+                                                  const Shape& shape_i,
+                                                  const Shape& shape_j,
+                                                  Scalar lambda)
+    {
+    unsigned int err_count = 0;
+    vec3<Scalar> r_ij_scaled = r_ij * (Scalar(1.0) - lambda);
+    return check_circumsphere_overlap(r_ij_scaled, shape_i, shape_j)
+           && test_overlap(r_ij_scaled, shape_i, shape_j, err_count);
+    }
+
+//! Kernel to count the first overlap of every particle in the SDF histograms
+/*! \param N Number of local particles
+    \param d_postype Particle positions and types by index
+    \param d_orientation Particle orientation
+    \param d_excell_idx Expanded cell neighbors
+    \param d_excell_size Size of expanded cell list per cell
+    \param excli Expanded cell indexer
+    \param ci Cell indexer
+    \param cell_dim Dimensions of the cell list
+    \param ghost_width Width of ghost layer
+    \param box Simulation box
+    \param num_types Number of particle types
+    \param dx Histogram bin width
+    \param n_bins Number of histogram bins
+    \param extra_width Search distance beyond the circumsphere contact
+    \param linear_search Sample every bin and also count expansions
+    \param d_hist_compression Compression histogram (output)
+    \param d_hist_expansion Expansion histogram (output)
+    \param d_params Per-type shape parameters
+    \param max_extra_bytes Shared memory available for the shape parameters
+
+    A group of threads processes one particle i, each thread handles a subset of the neighbors in
+    the expanded cells. Every thread finds the first compression (and expansion) bin over its
+    neighbors, the group reduces these in shared memory and adds one count for particle i.
+*/
+template<class Shape>
+__global__ void gpu_hpmc_sdf_kernel(const unsigned int N,
+                                    const Scalar4* d_postype,
+                                    const Scalar4* d_orientation,
+                                    const unsigned int* d_excell_idx,
+                                    const unsigned int* d_excell_size,
+                                    const Index2D excli,
+                                    const Index3D ci,
+                                    const uint3 cell_dim,
+                                    const Scalar3 ghost_width,
+                                    const BoxDim box,
+                                    const unsigned int num_types,
+                                    const Scalar dx,
+                                    const unsigned int n_bins,
+                                    const Scalar extra_width,
+                                    const bool linear_search,
+                                    unsigned int* d_hist_compression,
+                                    unsigned int* d_hist_expansion,
+                                    const typename Shape::param_type* d_params,
+                                    unsigned int max_extra_bytes)
+    {
+    unsigned int offset = threadIdx.x;
+    unsigned int group_size = blockDim.x;
+    unsigned int group = threadIdx.y;
+    unsigned int n_groups = blockDim.y;
+    bool master = (offset == 0);
+
+    // load the per type shape parameters into shared memory
+    HIP_DYNAMIC_SHARED(char, s_data)
+    typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
+    unsigned int* s_min_bin_compression = (unsigned int*)(s_params + num_types);
+    unsigned int* s_min_bin_expansion = s_min_bin_compression + n_groups;
+
+        // copy over parameters one int per thread for fast loads
+        {
+        unsigned int tidx = threadIdx.x + blockDim.x * threadIdx.y;
+        unsigned int block_size = blockDim.x * blockDim.y;
+        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += block_size)
+            {
+            if (cur_offset + tidx < param_size)
+                {
+                ((int*)s_params)[cur_offset + tidx] = ((int*)d_params)[cur_offset + tidx];
+                }
+            }
+        }
+
+    __syncthreads();
+
+    // initialize extra shared mem
+    char* s_extra = (char*)(s_min_bin_expansion + n_groups);
+
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
+        s_params[cur_type].load_shared(s_extra, available_bytes);
+
+    if (master)
+        {
+        s_min_bin_compression[group] = n_bins;
+        s_min_bin_expansion[group] = n_bins;
+        }
+
+    __syncthreads();
+
+    unsigned int i = blockIdx.x * n_groups + group;
+
+    if (i < N)
+        {
+        Scalar4 postype_i = d_postype[i];
+        Shape shape_i(quat<Scalar>(), s_params[__scalar_as_int(postype_i.w)]);
+        if (shape_i.hasOrientation())
+            shape_i.orientation = quat<Scalar>(d_orientation[i]);
+        vec3<Scalar> pos_i(postype_i);
+
+        unsigned int my_cell = gpu::kernel::computeParticleCell(vec_to_scalar3(pos_i),
+                                                                box,
+                                                                ghost_width,
+                                                                cell_dim,
+                                                                ci,
+                                                                false);
+
+        unsigned int min_bin_compression = n_bins;
+        unsigned int min_bin_expansion = n_bins;
+
+        unsigned int excell_size = d_excell_size[my_cell];
+        for (unsigned int k = offset; k < excell_size; k += group_size)
+            {
+            unsigned int j = d_excell_idx[excli(k, my_cell)];
+            if (j == i)
+                continue;
+
+            Scalar4 postype_j = d_postype[j];
+            Shape shape_j(quat<Scalar>(), s_params[__scalar_as_int(postype_j.w)]);
+            if (shape_j.hasOrientation())
+                shape_j.orientation = quat<Scalar>(d_orientation[j]);
+
+            // put particle j into the coordinate system of particle i
+            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i;
+            r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+            // skip pairs that cannot touch within the largest scale factor
+            Scalar r_max = Scalar(0.5)
+                               * (shape_i.getCircumsphereDiameter()
+                                  + shape_j.getCircumsphereDiameter())
+                           + extra_width;
+            if (dot(r_ij, r_ij) > r_max * r_max)
+                continue;
+
+            if (linear_search)
+                {
+                for (unsigned int bin = 0; bin < min_bin_compression; bin++)
+                    {
+                    if (test_scaled_overlap_device(r_ij, shape_i, shape_j, dx * Scalar(bin + 1)))
+                        min_bin_compression = bin;
+                    }
+
+                for (unsigned int bin = 0; bin < min_bin_expansion; bin++)
+                    {
+                    if (test_scaled_overlap_device(r_ij, shape_i, shape_j, -dx * Scalar(bin + 1)))
+                        min_bin_expansion = bin;
+                    }
+                }
+            else
+                {
+                // pairs that overlap already, or do not overlap at the right boundary, do not
+                // contribute
+                unsigned int L = 0;
+                unsigned int R = n_bins;
+                if (test_scaled_overlap_device(r_ij, shape_i, shape_j, Scalar(0.0))
+                    || !test_scaled_overlap_device(r_ij, shape_i, shape_j, dx * Scalar(R)))
+                    continue;
+
+                // progressively narrow the search window by halves
+                do
+                    {
+                    unsigned int m = (L + R) / 2;
+                    if (test_scaled_overlap_device(r_ij, shape_i, shape_j, dx * Scalar(m)))
+                        R = m;
+                    else
+                        L = m;
+                    } while ((R - L) > 1);
+
+                min_bin_compression = min(min_bin_compression, L);
+                }
+            }
+
+        if (min_bin_compression < n_bins)
+            atomicMin(&s_min_bin_compression[group], min_bin_compression);
+        if (min_bin_expansion < n_bins)
+            atomicMin(&s_min_bin_expansion[group], min_bin_expansion);
+        }
+
+    __syncthreads();
+
+    if (master && i < N)
+        {
+        if (s_min_bin_compression[group] < n_bins)
+            atomicAdd(&d_hist_compression[s_min_bin_compression[group]], 1);
+        if (s_min_bin_expansion[group] < n_bins)
+            atomicAdd(&d_hist_expansion[s_min_bin_expansion[group]], 1);
+        }
+    }
+
+//! Kernel driver for gpu_hpmc_sdf_kernel()
+/*! \param args Bundled arguments
+    \param d_params Per-type shape parameters
+    \returns Error codes generated by any CUDA calls, or hipSuccess when there is no error
+
+    The histograms are zeroed before the kernel runs.
+
+    \ingroup hpmc_kernels
+*/
+template<class Shape>
+hipError_t gpu_hpmc_sdf(const hpmc_sdf_args_t& args, const typename Shape::param_type* d_params)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+    assert(args.group_size >= 1);
+    assert(args.block_size % args.group_size == 0);
+
+    hipMemsetAsync(args.d_hist_compression, 0, sizeof(unsigned int) * args.n_bins);
+    hipMemsetAsync(args.d_hist_expansion, 0, sizeof(unsigned int) * args.n_bins);
+
+    if (args.N == 0)
+        return hipSuccess;
+
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_hpmc_sdf_kernel<Shape>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // setup the grid to run the kernel
+    unsigned int n_groups = min(args.block_size, (unsigned int)max_block_size) / args.group_size;
+
+    dim3 threads(args.group_size, n_groups, 1);
+
+    size_t shared_bytes = args.num_types * sizeof(typename Shape::param_type)
+                          + 2 * n_groups * sizeof(unsigned int);
+
+    if (shared_bytes > args.devprop.sharedMemPerBlock)
+        {
+        throw std::runtime_error("HPMC shape parameters exceed the available shared "
+                                 "memory per block.");
+        }
+
+    unsigned int max_extra_bytes = static_cast<unsigned int>(args.devprop.sharedMemPerBlock
+                                                             - attr.sharedSizeBytes - shared_bytes);
+
+    // determine dynamically requested shared memory
+    char* ptr = (char*)nullptr;
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int i = 0; i < args.num_types; ++i)
+        {
+        d_params[i].allocate_shared(ptr, available_bytes);
+        }
+    const unsigned int extra_bytes = max_extra_bytes - available_bytes;
+
+    shared_bytes += extra_bytes;
+
+    dim3 grid(args.N / n_groups + 1, 1, 1);
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_hpmc_sdf_kernel<Shape>),
+                       dim3(grid),
+                       dim3(threads),
+                       shared_bytes,
+                       0,
+                       args.N,
+                       args.d_postype,
+                       args.d_orientation,
+                       args.d_excell_idx,
+                       args.d_excell_size,
+                       args.excli,
+                       args.ci,
+                       args.cell_dim,
+                       args.ghost_width,
+                       args.box,
+                       args.num_types,
+                       args.dx,
+                       args.n_bins,
+                       args.extra_width,
+                       args.linear_search,
+                       args.d_hist_compression,
+                       args.d_hist_expansion,
+                       d_params,
+                       max_extra_bytes);
+
+    return hipSuccess;
+    }
+
+#endif // __HIPCC__
+
+    } // end namespace detail
+
+    } // end namespace hpmc
+
+    } // end namespace hoomd
+
+#endif // _COMPUTE_SDF_CUH_
@@ -0,0 +1,333 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __COMPUTE_SDF_GPU_H__
+#define __COMPUTE_SDF_GPU_H__
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/Autotuner.h"
+#include "hoomd/CellList.h"
+#include "hoomd/GlobalArray.h"
+
+#include "ComputeSDF.h"
+#include "ComputeSDFGPU.cuh"
+#include "IntegratorHPMCMono.h"
+#include "IntegratorHPMCMonoGPU.cuh"
+
+/*! \file ComputeSDFGPU.h
+    \brief Defines the template class for an sdf compute on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! SDF analysis on the GPU
+/*! ComputeSDFGPU counts the hard particle overlaps on the GPU. It finds neighbors with a cell list
+    of width max_diam + extra_width and applies the minimum image convention, so it counts on the
+    host (as ComputeSDF does) when the box is too small for that. Pair energies are only available
+    on the host, so integrators with pair interactions also count on the host.
+
+    \ingroup hpmc_computes
+*/
+template<class Shape> class ComputeSDFGPU : public ComputeSDF<Shape>
+    {
+    public:
+    //! Construct the compute
+    ComputeSDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                  std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                  double xmax,
+                  double dx,
+                  std::shared_ptr<CellList> cl);
+
+    //! Destructor
+    virtual ~ComputeSDFGPU() { }
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< The cell list
+
+    uint3 m_last_dim;         //!< Dimensions of the cell list on the last call to update
+    unsigned int m_last_nmax; //!< Last cell list NMax value allocated in excell
+
+    GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
+    GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
+    Index2D m_excell_list_indexer;           //!< Indexer to access elements of the excell_idx list
+
+    GlobalArray<unsigned int> m_gpu_hist_compression; //!< Compression counts on the device
+    GlobalArray<unsigned int> m_gpu_hist_expansion;   //!< Expansion counts on the device
+
+    /// Autotuner for the histogram kernel
+    std::shared_ptr<Autotuner<2>> m_tuner_sdf;
+
+    /// Autotuner for excell block_size
+    std::shared_ptr<Autotuner<1>> m_tuner_excell_block_size;
+
+    //! Add to histogram counts
+    virtual void countHistogram(uint64_t timestep);
+
+    void initializeExcellMem();
+    };
+
+template<class Shape>
+ComputeSDFGPU<Shape>::ComputeSDFGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                    std::shared_ptr<IntegratorHPMCMono<Shape>> mc,
+                                    double xmax,
+                                    double dx,
+                                    std::shared_ptr<CellList> cl)
+    : ComputeSDF<Shape>(sysdef, mc, xmax, dx), m_cl(cl)
+    {
+    this->m_cl->setRadius(1);
+    this->m_cl->setComputeTypeBody(false);
+    this->m_cl->setFlagType();
+    this->m_cl->setComputeIdx(true);
+
+    // Autotuner parameters:
+    // 0: block size
+    // 1: threads per particle
+    std::function<bool(const std::array<unsigned int, 2>&)> is_parameter_valid
+        = [](const std::array<unsigned int, 2>& parameter) -> bool
+    {
+        unsigned int block_size = parameter[0];
+        unsigned int group_size = parameter[1];
+        return (group_size <= block_size) && (block_size % group_size) == 0;
+    };
+
+    m_tuner_sdf.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                        AutotunerBase::getTppListPow2(this->m_exec_conf)},
+                                       this->m_exec_conf,
+                                       "hpmc_sdf",
+                                       3,
+                                       false,
+                                       is_parameter_valid));
+
+    GlobalArray<unsigned int> excell_size(0, this->m_exec_conf);
+    m_excell_size.swap(excell_size);
+    TAG_ALLOCATION(m_excell_size);
+
+    GlobalArray<unsigned int> excell_idx(0, this->m_exec_conf);
+    m_excell_idx.swap(excell_idx);
+    TAG_ALLOCATION(m_excell_idx);
+
+    GlobalArray<unsigned int> gpu_hist_compression(0, this->m_exec_conf);
+    m_gpu_hist_compression.swap(gpu_hist_compression);
+    TAG_ALLOCATION(m_gpu_hist_compression);
+
+    GlobalArray<unsigned int> gpu_hist_expansion(0, this->m_exec_conf);
+    m_gpu_hist_expansion.swap(gpu_hist_expansion);
+    TAG_ALLOCATION(m_gpu_hist_expansion);
+
+    // set last dim to a bogus value so that it will re-init on the first call
+    m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
+    m_last_nmax = 0xffffffff;
+
+    m_tuner_excell_block_size.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_sdf_excell_block_size"));
+
+    this->m_autotuners.insert(this->m_autotuners.end(), {m_tuner_sdf, m_tuner_excell_block_size});
+    }
+
+/*! \param timestep current timestep
+
+    Count the first hard overlap of every local particle on the GPU. The binary search applies to
+    the same shapes as in ComputeSDF, other shapes sample every bin and also count expansions.
+*/
+template<class Shape> void ComputeSDFGPU<Shape>::countHistogram(uint64_t timestep)
+    {
+    // pair energies are evaluated on the host
+    if (this->m_mc->hasPairInteractions())
+        {
+        ComputeSDF<Shape>::countHistogram(timestep);
+        return;
+        }
+
+    // pairs within this distance of circumsphere contact may touch when scaled by xmax
+    Scalar extra_width = this->m_xmax / (1 - this->m_xmax) * this->m_last_max_diam;
+    Scalar nominal_width = this->m_last_max_diam + extra_width;
+
+    // the kernel applies the minimum image convention, count images on the host in small boxes
+    const BoxDim box = this->m_pdata->getBox();
+    Scalar3 npd = box.getNearestPlaneDistance();
+
+    if ((box.getPeriodic().x && npd.x <= nominal_width * 2)
+        || (box.getPeriodic().y && npd.y <= nominal_width * 2)
+        || (this->m_sysdef->getNDimensions() == 3 && box.getPeriodic().z
+            && npd.z <= nominal_width * 2))
+        {
+        ComputeSDF<Shape>::countHistogram(timestep);
+        return;
+        }
+
+    if (m_cl->getNominalWidth() != nominal_width)
+        m_cl->setNominalWidth(nominal_width);
+
+    // compute cell list
+    m_cl->compute(timestep);
+
+    // if the cell list is a different size than last time, reinitialize expanded cell list
+    uint3 cur_dim = m_cl->getDim();
+    if (m_last_dim.x != cur_dim.x || m_last_dim.y != cur_dim.y || m_last_dim.z != cur_dim.z
+        || m_last_nmax != m_cl->getNmax())
+        {
+        initializeExcellMem();
+        m_last_dim = cur_dim;
+        m_last_nmax = m_cl->getNmax();
+        }
+
+    const unsigned int n_bins = (unsigned int)this->m_hist_compression.size();
+    if (m_gpu_hist_compression.getNumElements() != n_bins)
+        {
+        m_gpu_hist_compression.resize(n_bins);
+        m_gpu_hist_expansion.resize(n_bins);
+        }
+
+        {
+        // access the cell list data
+        ArrayHandle<unsigned int> d_cell_size(m_cl->getCellSizeArray(),
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<unsigned int> d_cell_idx(m_cl->getIndexArray(),
+                                             access_location::device,
+                                             access_mode::read);
+        ArrayHandle<unsigned int> d_cell_adj(m_cl->getCellAdjArray(),
+                                             access_location::device,
+                                             access_mode::read);
+
+        ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                               access_location::device,
+                                               access_mode::readwrite);
+        ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                access_location::device,
+                                                access_mode::readwrite);
+
+        // update the expanded cells
+        m_tuner_excell_block_size->begin();
+        gpu::hpmc_excell(d_excell_idx.data,
+                         d_excell_size.data,
+                         m_excell_list_indexer,
+                         d_cell_idx.data,
+                         d_cell_size.data,
+                         d_cell_adj.data,
+                         m_cl->getCellIndexer(),
+                         m_cl->getCellListIndexer(),
+                         m_cl->getCellAdjIndexer(),
+                         1,
+                         m_tuner_excell_block_size->getParam()[0]);
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_excell_block_size->end();
+
+        // access the particle data
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                           access_location::device,
+                                           access_mode::read);
+
+        ArrayHandle<unsigned int> d_hist_compression(m_gpu_hist_compression,
+                                                     access_location::device,
+                                                     access_mode::overwrite);
+        ArrayHandle<unsigned int> d_hist_expansion(m_gpu_hist_expansion,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+
+        // access the parameters
+        auto& params = this->m_mc->getParams();
+
+        m_tuner_sdf->begin();
+        auto param = m_tuner_sdf->getParam();
+
+        detail::hpmc_sdf_args_t sdf_args(this->m_pdata->getN(),
+                                         d_postype.data,
+                                         d_orientation.data,
+                                         d_excell_idx.data,
+                                         d_excell_size.data,
+                                         m_excell_list_indexer,
+                                         m_cl->getCellIndexer(),
+                                         m_cl->getDim(),
+                                         m_cl->getGhostWidth(),
+                                         box,
+                                         this->m_pdata->getNTypes(),
+                                         this->m_dx,
+                                         n_bins,
+                                         extra_width,
+                                         this->m_shape_requires_expansion_moves,
+                                         d_hist_compression.data,
+                                         d_hist_expansion.data,
+                                         param[0],
+                                         param[1],
+                                         this->m_exec_conf->dev_prop);
+
+        detail::gpu_hpmc_sdf<Shape>(sdf_args, params.data());
+
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_sdf->end();
+        }
+
+    ArrayHandle<unsigned int> h_hist_compression(m_gpu_hist_compression,
+                                                 access_location::host,
+                                                 access_mode::read);
+    ArrayHandle<unsigned int> h_hist_expansion(m_gpu_hist_expansion,
+                                               access_location::host,
+                                               access_mode::read);
+    for (unsigned int bin = 0; bin < n_bins; bin++)
+        {
+        this->m_hist_compression[bin] += h_hist_compression.data[bin];
+        this->m_hist_expansion[bin] += h_hist_expansion.data[bin];
+        }
+    }
+
+template<class Shape> void ComputeSDFGPU<Shape>::initializeExcellMem()
+    {
+    this->m_exec_conf->msg->notice(4) << "hpmc resizing expanded cells" << std::endl;
+
+    // get the current cell dimensions
+    unsigned int num_cells = m_cl->getCellIndexer().getNumElements();
+    unsigned int num_adj = m_cl->getCellAdjIndexer().getW();
+    unsigned int num_max = m_cl->getNmax();
+
+    // make the excell dimensions the same, but with room for Nmax*Nadj in each cell
+    m_excell_list_indexer = Index2D(num_max * num_adj, num_cells);
+
+    // reallocate memory
+    m_excell_idx.resize(m_excell_list_indexer.getNumElements());
+    m_excell_size.resize(num_cells);
+    }
+
+namespace detail
+    {
+//! Export this hpmc compute to python
+/*! \param name Name of the class in the exported python module
+    \tparam Shape An instantiation of ComputeSDFGPU<Shape> will be exported
+*/
+template<class Shape> void export_ComputeSDFGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<ComputeSDFGPU<Shape>,
+                     ComputeSDF<Shape>,
+                     std::shared_ptr<ComputeSDFGPU<Shape>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<IntegratorHPMCMono<Shape>>,
+                            double,
+                            double,
+                            std::shared_ptr<CellList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace hpmc
+
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+
+#endif // __COMPUTE_SDF_GPU_H__
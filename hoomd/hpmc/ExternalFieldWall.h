@@ -588,8 +588,16 @@ template<class Shape> class ExternalFieldWall : public ExternalFieldMono<Shape>
                       std::shared_ptr<IntegratorHPMCMono<Shape>> mc)
         : ExternalFieldMono<Shape>(sysdef), m_mc(mc)
         {
+        m_pdata->getParticleSortSignal()
+            .template connect<ExternalFieldWall<Shape>,
+                              &ExternalFieldWall<Shape>::slotParticleSort>(this);
+        }
+    ~ExternalFieldWall()
+        {
+        m_pdata->getParticleSortSignal()
+            .template disconnect<ExternalFieldWall<Shape>,
+                                 &ExternalFieldWall<Shape>::slotParticleSort>(this);
         }
-    ~ExternalFieldWall() { }
 
     double energydiff(uint64_t timestep,
                       const unsigned int& index,
@@ -601,6 +609,26 @@ template<class Shape> class ExternalFieldWall : public ExternalFieldMono<Shape>
         const BoxDim box = this->m_pdata->getGlobalBox();
         vec3<Scalar> origin(m_pdata->getOrigin());
 
+        if (m_cache_distances)
+            {
+            if (!m_distance_cache_checked || timestep != m_distance_cache_timestep)
+                {
+                validateDistanceCache(box);
+                m_distance_cache_timestep = timestep;
+                }
+
+            // the circumsphere fits in the free sphere around the cached position, no wall can
+            // reject the move
+            assert(index < m_distance_cache.size());
+            const Scalar4 cached = m_distance_cache[index];
+            const Scalar margin = cached.w - Scalar(shape_new.getCircumsphereDiameter()) / 2;
+            const vec3<Scalar> dr = position_new - vec3<Scalar>(cached);
+            if (margin > Scalar(0.0) && dot(dr, dr) < margin * margin)
+                {
+                return double(0.0);
+                }
+            }
+
         for (size_t i = 0; i < m_Spheres.size(); i++)
             {
             if (!test_confined(m_Spheres[i], shape_new, position_new, origin, box))
@@ -626,6 +654,14 @@ template<class Shape> class ExternalFieldWall : public ExternalFieldMono<Shape>
                 }
             }
 
+        if (m_cache_distances)
+            {
+            m_distance_cache[index] = make_scalar4(position_new.x,
+                                                   position_new.y,
+                                                   position_new.z,
+                                                   computeWallDistance(position_new, origin, box));
+            }
+
         return double(0.0);
         }
 
@@ -723,9 +759,28 @@ template<class Shape> class ExternalFieldWall : public ExternalFieldMono<Shape>
         return (energy == INFINITY);
         }
 
+    //! Get whether the distances to the nearest wall are cached
+    bool getCacheDistances()
+        {
+        return m_cache_distances;
+        }
+
+    //! Set whether the distances to the nearest wall are cached
+    void setCacheDistances(bool cache_distances)
+        {
+        m_cache_distances = cache_distances;
+        m_distance_cache_checked = false;
+        }
+
     unsigned int countOverlaps(uint64_t timestep, bool early_exit = false)
         {
         unsigned int numOverlaps = 0;
+        if (m_cache_distances)
+            {
+            // the walls may have changed since the last trial move
+            validateDistanceCache(this->m_pdata->getGlobalBox());
+            m_distance_cache_timestep = timestep;
+            }
         // access particle data and system box
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                        access_location::host,
@@ -791,12 +846,154 @@ template<class Shape> class ExternalFieldWall : public ExternalFieldMono<Shape>
             = ShortReal(2.0 * (shape.getCircumsphereDiameter() + wall.verts->sweep_radius));
         }
 
+    //! Distance from a particle center to the nearest wall surface
+    /*! \param position Particle position
+        \param box_origin Origin of the box
+        \param box The global box
+
+        A particle whose circumsphere lies within the returned distance of \a position is confined
+        by all walls, whatever its orientation. The distance is also limited so that all positions
+        within it have the same minimum image relative to the walls as \a position. Returns 0 when
+        \a position is on the wrong side of a wall.
+    */
+    Scalar computeWallDistance(const vec3<Scalar>& position,
+                               const vec3<Scalar>& box_origin,
+                               const BoxDim& box)
+        {
+        const Scalar3 npd = box.getNearestPlaneDistance();
+        Scalar half_width = Scalar(0.5) * npd.x;
+        half_width = std::min(half_width, Scalar(0.5) * npd.y);
+        if (this->m_sysdef->getNDimensions() == 3)
+            {
+            half_width = std::min(half_width, Scalar(0.5) * npd.z);
+            }
+
+        Scalar distance = std::numeric_limits<Scalar>::max();
+
+        for (size_t i = 0; i < m_Spheres.size(); i++)
+            {
+            const SphereWall& wall = m_Spheres[i];
+            vec3<Scalar> shifted_pos(
+                box.minImage(vec_to_scalar3(position - box_origin - wall.origin)));
+            const Scalar r = sqrt(dot(shifted_pos, shifted_pos));
+            const Scalar radius = sqrt(wall.rsq);
+            distance = std::min(distance, wall.inside ? radius - r : r - radius);
+            distance = std::min(distance, half_width - r);
+            }
+
+        for (size_t i = 0; i < m_Cylinders.size(); i++)
+            {
+            const CylinderWall& wall = m_Cylinders[i];
+            vec3<Scalar> shifted_pos(
+                box.minImage(vec_to_scalar3(position - box_origin - wall.origin)));
+            vec3<Scalar> dist_vec = cross(shifted_pos, wall.orientation);
+            const Scalar r = sqrt(dot(dist_vec, dist_vec));
+            const Scalar radius = sqrt(wall.rsq);
+            distance = std::min(distance, wall.inside ? radius - r : r - radius);
+            distance = std::min(distance, half_width - sqrt(dot(shifted_pos, shifted_pos)));
+            }
+
+        for (size_t i = 0; i < m_Planes.size(); i++)
+            {
+            const PlaneWall& wall = m_Planes[i];
+            vec3<Scalar> shifted_pos(box.minImage(vec_to_scalar3(position - box_origin)));
+            distance = std::min(distance, dot(wall.normal, shifted_pos) + wall.d);
+            distance = std::min(distance, half_width - sqrt(dot(shifted_pos, shifted_pos)));
+            }
+
+        return std::max(distance, Scalar(0.0));
+        }
+
+    //! Invalidate the distance cache when the walls, the box, or the particles changed
+    /*! The wall lists are modified directly through the python bindings, so this compares a
+        snapshot of the wall parameters and the box instead of relying on a notification.
+    */
+    void validateDistanceCache(const BoxDim& box)
+        {
+        std::vector<Scalar> signature;
+        signature.reserve(6 * m_Spheres.size() + 8 * m_Cylinders.size() + 7 * m_Planes.size()
+                          + 9);
+        for (const auto& wall : m_Spheres)
+            {
+            signature.insert(signature.end(),
+                             {wall.rsq,
+                              Scalar(wall.inside),
+                              wall.origin.x,
+                              wall.origin.y,
+                              wall.origin.z});
+            }
+        signature.push_back(Scalar(-1.0));
+        for (const auto& wall : m_Cylinders)
+            {
+            signature.insert(signature.end(),
+                             {wall.rsq,
+                              Scalar(wall.inside),
+                              wall.origin.x,
+                              wall.origin.y,
+                              wall.origin.z,
+                              wall.orientation.x,
+                              wall.orientation.y,
+                              wall.orientation.z});
+            }
+        signature.push_back(Scalar(-1.0));
+        for (const auto& wall : m_Planes)
+            {
+            signature.insert(signature.end(),
+                             {wall.origin.x,
+                              wall.origin.y,
+                              wall.origin.z,
+                              wall.normal.x,
+                              wall.normal.y,
+                              wall.normal.z,
+                              wall.d});
+            }
+        const Scalar3 L = box.getL();
+        signature.insert(signature.end(),
+                         {L.x,
+                          L.y,
+                          L.z,
+                          box.getTiltFactorXY(),
+                          box.getTiltFactorXZ(),
+                          box.getTiltFactorYZ()});
+        const Scalar3 origin = m_pdata->getOrigin();
+        signature.insert(signature.end(), {origin.x, origin.y, origin.z});
+
+        const unsigned int N = m_pdata->getN() + m_pdata->getNGhosts();
+        if (m_particles_sorted || signature != m_distance_cache_signature
+            || m_distance_cache.size() != N)
+            {
+            m_distance_cache.assign(N, make_scalar4(0, 0, 0, 0));
+            m_distance_cache_signature.swap(signature);
+            m_particles_sorted = false;
+            }
+        m_distance_cache_checked = true;
+        }
+
+    //! Particle sort / migration callback, the cache is indexed by local particle index
+    void slotParticleSort()
+        {
+        m_particles_sorted = true;
+        m_distance_cache_checked = false;
+        }
+
     protected:
     std::vector<SphereWall> m_Spheres;
     std::vector<CylinderWall> m_Cylinders;
     std::vector<PlaneWall> m_Planes;
     Scalar m_Volume;
 
+    bool m_cache_distances = false; //!< True when distances to the nearest wall are cached
+
+    /// Reference position (xyz) and distance to the nearest wall (w) of each particle
+    std::vector<Scalar4> m_distance_cache;
+
+    /// Wall parameters and box the distance cache was computed for
+    std::vector<Scalar> m_distance_cache_signature;
+
+    uint64_t m_distance_cache_timestep = 0; //!< Last timestep the cache was validated
+    bool m_distance_cache_checked = false; //!< False when the cache must be validated
+    bool m_particles_sorted = true;        //!< True when the particle order changed
+
     private:
     std::shared_ptr<IntegratorHPMCMono<Shape>> m_mc; //!< integrator
     };
@@ -818,6 +1015,9 @@ template<class Shape> void export_ExternalFieldWall(pybind11::module& m, const s
         .def(pybind11::init<std::shared_ptr<SystemDefinition>,
                             std::shared_ptr<IntegratorHPMCMono<Shape>>>())
         .def("numOverlaps", &ExternalFieldWall<Shape>::countOverlaps)
+        .def_property("cache_distances",
+                      &ExternalFieldWall<Shape>::getCacheDistances,
+                      &ExternalFieldWall<Shape>::setCacheDistances)
         .def_property_readonly("SphereWalls", &ExternalFieldWall<Shape>::GetSphereWalls)
         .def_property_readonly("CylinderWalls", &ExternalFieldWall<Shape>::GetCylinderWalls)
         .def_property_readonly("PlaneWalls", &ExternalFieldWall<Shape>::GetPlaneWalls);
@@ -4,6 +4,7 @@
 #include "IntegratorHPMC.h"
 
 #include "hoomd/VectorMath.h"
+#include <limits>
 #include <sstream>
 
 #include <pybind11/stl_bind.h>
@@ -113,6 +114,65 @@ bool IntegratorHPMC::checkParticleOrientations()
     return result;
     }
 
+/*! \param old_box Box the particles are currently in
+    \param new_box Box to scale the particles into
+*/
+void IntegratorHPMC::scaleParticlePositions(const BoxDim& old_box, const BoxDim& new_box)
+    {
+    unsigned int N = m_pdata->getN();
+
+    // Get particle positions
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+
+    // move the particles to be inside the new box
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 old_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+
+        // obtain scaled coordinates in the old global box
+        Scalar3 f = old_box.makeFraction(old_pos);
+
+        // scale particles
+        Scalar3 scaled_pos = new_box.makeCoordinates(f);
+        h_pos.data[i].x = scaled_pos.x;
+        h_pos.data[i].y = scaled_pos.y;
+        h_pos.data[i].z = scaled_pos.z;
+        }
+    }
+
+/*! \param old_box Box before the resize
+    \param new_box Box after the resize
+    \param ndim Number of dimensions of the system
+
+    \returns true when \a new_box is \a old_box scaled by the same factor >= 1 along all axes
+*/
+static bool isIsotropicExpansion(const BoxDim& old_box, const BoxDim& new_box, unsigned int ndim)
+    {
+    // UpdaterBoxMC computes the box lengths of volume moves from fixed aspect ratios, allow for the
+    // round off in that computation
+    const Scalar tol = Scalar(100.0) * std::numeric_limits<Scalar>::epsilon();
+
+    Scalar3 old_L = old_box.getL();
+    Scalar3 new_L = new_box.getL();
+    Scalar s = new_L.x / old_L.x;
+    if (s < Scalar(1.0) || fabs(new_L.y / old_L.y - s) > tol * s)
+        return false;
+    if (ndim == 3 && fabs(new_L.z / old_L.z - s) > tol * s)
+        return false;
+
+    // the tilt factors are relative to the box lengths, they must not change
+    if (fabs(new_box.getTiltFactorXY() - old_box.getTiltFactorXY()) > tol)
+        return false;
+    if (ndim == 3
+        && (fabs(new_box.getTiltFactorXZ() - old_box.getTiltFactorXZ()) > tol
+            || fabs(new_box.getTiltFactorYZ() - old_box.getTiltFactorYZ()) > tol))
+        return false;
+
+    return true;
+    }
+
 /*! Set new box with particle positions scaled from previous box
     and check for overlaps
 
@@ -122,37 +182,19 @@ bool IntegratorHPMC::checkParticleOrientations()
     new box dimensions result in overlaps. To restore old particle positions,
     they have to be backed up before calling this method.
 
+    When the shapes report isExpansionOverlapFree() and the new box is an isotropic expansion of
+    the current one, every particle separation grows by the same factor and no overlap can form.
+    The overlap check is skipped in that case.
+
     \returns false if resize results in overlaps
 */
 bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     {
-    unsigned int N = m_pdata->getN();
-
     // Get old and new boxes;
     BoxDim curBox = m_pdata->getGlobalBox();
 
-        // Use lexical scope block to make sure ArrayHandles get cleaned up
-        {
-        // Get particle positions
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::readwrite);
-
-        // move the particles to be inside the new box
-        for (unsigned int i = 0; i < N; i++)
-            {
-            Scalar3 old_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-
-            // obtain scaled coordinates in the old global box
-            Scalar3 f = curBox.makeFraction(old_pos);
-
-            // scale particles
-            Scalar3 scaled_pos = new_box.makeCoordinates(f);
-            h_pos.data[i].x = scaled_pos.x;
-            h_pos.data[i].y = scaled_pos.y;
-            h_pos.data[i].z = scaled_pos.z;
-            }
-        } // end lexical scope
+    // move the particles to be inside the new box
+    scaleParticlePositions(curBox, new_box);
 
     m_pdata->setGlobalBox(new_box);
 
@@ -165,6 +207,10 @@ bool IntegratorHPMC::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     // we have moved particles, communicate those changes
     this->communicate(false);
 
+    if (isExpansionOverlapFree()
+        && isIsotropicExpansion(curBox, new_box, m_sysdef->getNDimensions()))
+        return true;
+
     // check overlaps
     return !this->countOverlaps(true);
     }
@@ -264,6 +310,10 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def("communicate", &IntegratorHPMC::communicate)
         .def("computeTotalPairEnergy", &IntegratorHPMC::computeTotalPairEnergy)
         .def_property("nselect", &IntegratorHPMC::getNSelect, &IntegratorHPMC::setNSelect)
+        .def_property("cache_pair_energies",
+                      &IntegratorHPMC::getCachePairEnergies,
+                      &IntegratorHPMC::setCachePairEnergies)
+        .def_property("nproposal", &IntegratorHPMC::getNProposal, &IntegratorHPMC::setNProposal)
         .def_property("translation_move_probability",
                       &IntegratorHPMC::getTranslationMoveProbability,
                       &IntegratorHPMC::setTranslationMoveProbability)
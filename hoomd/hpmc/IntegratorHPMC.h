@@ -363,6 +363,16 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return 0;
         }
 
+    //! Count the number of particle overlaps, stopping once the count exceeds a limit
+    /*! \param max_overlaps stop counting once more than this many overlaps are found
+        \returns the number of overlaps, which is larger than \a max_overlaps when counting
+                 stopped early
+    */
+    virtual unsigned int countOverlapsUpTo(unsigned int max_overlaps)
+        {
+        return 0;
+        }
+
     //! Get the number of degrees of freedom granted to a given group
     /*! \param group Group over which to count degrees of freedom.
         \return a non-zero dummy value to suppress warnings.
@@ -404,6 +414,15 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     //! Method to scale the box
     virtual bool attemptBoxResize(uint64_t timestep, const BoxDim& new_box);
 
+    //! Test whether moving non-overlapping particles apart can never create an overlap
+    /*! attemptBoxResize() skips the overlap check for isotropic expansions when this returns
+        true.
+    */
+    virtual bool isExpansionOverlapFree()
+        {
+        return false;
+        }
+
     ExternalField* getExternalField()
         {
         return m_external_base;
@@ -525,6 +544,34 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_pair_potentials;
         }
 
+    /// Set whether to cache the pair energy of each particle during trial moves.
+    void setCachePairEnergies(bool cache_pair_energies)
+        {
+        m_cache_pair_energies = cache_pair_energies;
+        }
+
+    /// Get whether to cache the pair energy of each particle during trial moves.
+    bool getCachePairEnergies() const
+        {
+        return m_cache_pair_energies;
+        }
+
+    /// Set the number of trial moves proposed concurrently per particle on the GPU.
+    void setNProposal(unsigned int nproposal)
+        {
+        if (nproposal == 0)
+            {
+            throw std::domain_error("nproposal must be at least 1.");
+            }
+        m_nproposal = nproposal;
+        }
+
+    /// Get the number of trial moves proposed concurrently per particle on the GPU.
+    unsigned int getNProposal() const
+        {
+        return m_nproposal;
+        }
+
     /// Returns an array (indexed by type) of the AABB tree search radius needed.
     const std::vector<LongReal>& getPairEnergySearchRadius()
         {
@@ -583,6 +630,9 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
 
 #endif
 
+    //! Scale the local particle positions from \a old_box to \a new_box
+    virtual void scaleParticlePositions(const BoxDim& old_box, const BoxDim& new_box);
+
     std::shared_ptr<PatchEnergy> m_patch; //!< Patchy Interaction
 
     /// Pair potential evaluators.
@@ -591,6 +641,12 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     /// Cached pair energy search radius.
     std::vector<LongReal> m_pair_energy_search_radius;
 
+    /// When true, trial moves use the cached pair energy of the particle in the old configuration.
+    bool m_cache_pair_energies = false;
+
+    /// Number of trial moves proposed concurrently per particle (GPU only).
+    unsigned int m_nproposal = 1;
+
     private:
     hpmc_counters_t m_count_run_start;  //!< Count saved at run() start
     hpmc_counters_t m_count_step_start; //!< Count saved at the start of the last step
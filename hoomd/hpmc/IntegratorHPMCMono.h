@@ -11,12 +11,14 @@
 
 #include <iostream>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 
 #include "hoomd/Integrator.h"
 #include "IntegratorHPMC.h"
 #include "Moves.h"
 #include "hoomd/AABBTree.h"
+#include "hoomd/WideAABBTree.h"
 #include "GSDHPMCSchema.h"
 #include "hoomd/Index1D.h"
 #include "hoomd/RandomNumbers.h"
@@ -25,6 +27,7 @@
 #include "ShapeSpheropolyhedron.h"
 
 #ifdef ENABLE_TBB
+#include <atomic>
 #include <thread>
 #include <tbb/blocked_range.h>
 #include <tbb/enumerable_thread_specific.h>
@@ -220,6 +223,12 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Method to scale the box
         virtual bool attemptBoxResize(uint64_t timestep, const BoxDim& new_box);
 
+        //! Test whether moving non-overlapping particles apart can never create an overlap
+        virtual bool isExpansionOverlapFree()
+            {
+            return Shape::isExpansionOverlapFree();
+            }
+
         /*
          * Common HPMC API
          */
@@ -274,6 +283,12 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Count overlaps with the option to exit early at the first detected overlap
         virtual unsigned int countOverlaps(bool early_exit);
 
+        //! Count overlaps, stopping once the count exceeds max_overlaps
+        virtual unsigned int countOverlapsUpTo(unsigned int max_overlaps);
+
+        //! Test whether any particle of the given type overlaps with any other particle
+        bool hasOverlapsWithType(unsigned int type);
+
         //! Return a vector that is an unwrapped overlap map
         virtual std::vector<std::pair<unsigned int, unsigned int> > mapOverlaps();
 
@@ -281,6 +296,8 @@ class IntegratorHPMCMono : public IntegratorHPMC
         virtual Scalar getGhostLayerWidth(unsigned int type)
             {
             Scalar ghost_width = m_nominal_width + m_extra_ghost_width;
+            if (type < m_type_ghost_width.size())
+                ghost_width = m_type_ghost_width[type] + m_extra_ghost_width;
             m_exec_conf->msg->notice(9) << "IntegratorHPMCMono: ghost layer width of " << ghost_width << std::endl;
             return ghost_width;
             }
@@ -351,6 +368,17 @@ class IntegratorHPMCMono : public IntegratorHPMC
             }
 
         //! Communicate particles
+        /*! Ghosts are exchanged once per step, after the grid shift. They are not exchanged between
+            sweeps: active particles only interact with the ghosts behind the lower boundaries,
+            which lie in the inactive layer of the neighbor and do not move during update().
+
+            The exchange is blocking. Migration must finish before the interior particles are
+            known, because the grid shift changes the owner of each particle, and exchangeGhosts()
+            forwards the ghosts received along x to the y and z neighbors in later stages. Updaters
+            such as UpdaterBoxMC and UpdaterClusters read the ghosts before the next sweep. An
+            interior-first order would also have to be reversed in half of the sweeps, like
+            UpdateOrder, to keep balance, and the reversed order visits the boundary particles first.
+        */
         virtual void communicate(bool migrate)
             {
             // migrate and exchange particles
@@ -367,7 +395,9 @@ class IntegratorHPMCMono : public IntegratorHPMC
 
                 m_comm->exchangeGhosts();
 
+                // communication changes the particle indices
                 m_aabb_tree_invalid = true;
+                m_aabb_tree_refit = false;
                 }
             #endif
             }
@@ -391,9 +421,21 @@ class IntegratorHPMCMono : public IntegratorHPMC
         **/
         double computePairEnergy(uint64_t timestep, std::shared_ptr<PairPotential> selected_pair = nullptr);
 
+        //! Compute the pair energy of one particle with all of its neighbors
+        double computeParticlePairEnergy(unsigned int i, const vec3<Scalar>& pos_i, const quat<LongReal>& orientation_i,
+            LongReal R_query, const Scalar4 *h_postype, const Scalar4 *h_orientation, const Scalar *h_diameter,
+            const Scalar *h_charge, double *neighbor_energy = nullptr);
+
         //! Build the AABB tree (if needed)
         const hoomd::detail::AABBTree& buildAABBTree();
 
+        //! Grow the AABB of particle i in the trees after it moves
+        void updateAABBTree(unsigned int i, const hoomd::detail::AABB& aabb)
+            {
+            m_aabb_tree.update(i, aabb);
+            m_wide_aabb_tree.update(i, aabb);
+            }
+
         //! Make list of image indices for boxes to check in small-box mode
         const std::vector<vec3<Scalar> >& updateImageList();
 
@@ -404,7 +446,11 @@ class IntegratorHPMCMono : public IntegratorHPMC
             return m_image_hkl;
             }
 
-        void invalidateAABBTree(){ m_aabb_tree_invalid = true; }
+        void invalidateAABBTree()
+            {
+            m_aabb_tree_invalid = true;
+            m_aabb_tree_refit = false;
+            }
 
         std::vector<std::string> getTypeShapeMapping(const std::vector<param_type, hoomd::detail::managed_allocator<param_type> > &params) const
             {
@@ -442,9 +488,13 @@ class IntegratorHPMCMono : public IntegratorHPMC
 
         std::shared_ptr< ExternalFieldMono<Shape> > m_external;//!< External Field
         hoomd::detail::AABBTree m_aabb_tree;               //!< Bounding volume hierarchy for overlap checks
+        hoomd::detail::WideAABBTree m_wide_aabb_tree;      //!< 4-wide copy of m_aabb_tree for trial move queries
         hoomd::detail::AABB* m_aabbs;                      //!< list of AABBs, one per particle
         unsigned int m_aabbs_capacity;              //!< Capacity of m_aabbs list
         bool m_aabb_tree_invalid;                   //!< Flag if the aabb tree has been invalidated
+        bool m_aabb_tree_refit;                     //!< Flag if the invalid aabb tree may be refit instead of rebuilt
+        Scalar m_aabb_tree_build_area;              //!< Surface area of the aabb tree when it was last built
+        Scalar m_aabb_tree_max_area_ratio;          //!< Rebuild the refit aabb tree when its surface area grows by this factor
 
         Scalar m_extra_image_width;                 //! Extra width to extend the image list
 
@@ -456,6 +506,12 @@ class IntegratorHPMCMono : public IntegratorHPMC
         /// Cached shape radius by type.
         std::vector<LongReal> m_shape_circumsphere_radius;
 
+        /// Pair energy of each local and ghost particle in the current configuration.
+        std::vector<double> m_pair_energy_cache;
+
+        /// Neighbors and pair energies of the particle in the trial configuration.
+        std::vector< std::pair<unsigned int, double> > m_pair_energy_trial;
+
         /* Depletants related data members */
 
         GlobalVector<Scalar> m_fugacity;            //!< Average depletant number density in free volume, per type
@@ -465,6 +521,16 @@ class IntegratorHPMCMono : public IntegratorHPMC
         std::vector<hpmc_implicit_counters_t> m_implicit_count_run_start;     //!< Counter of depletant insertions at run start
         std::vector<hpmc_implicit_counters_t> m_implicit_count_step_start;    //!< Counter of depletant insertions at step start
 
+        #ifdef ENABLE_TBB
+        /* Checkerboard sweep related data members */
+
+        uint3 m_checkerboard_dim;                                //!< Number of checkerboard cells along each lattice vector
+        Scalar3 m_checkerboard_offset;                           //!< Fractional offset of the checkerboard grid
+        std::vector<unsigned int> m_checkerboard_cell_offsets;   //!< First entry of each cell in m_checkerboard_cell_particles
+        std::vector<unsigned int> m_checkerboard_cell_particles; //!< Particle indices sorted by cell, in update order
+        std::vector<unsigned int> m_checkerboard_particle_cell;  //!< Cell of each particle, in update order
+        #endif
+
         //! Test whether to reject the current particle move based on depletants
         inline bool checkDepletantOverlap(unsigned int i, vec3<Scalar> pos_i, Shape shape_i, unsigned int typ_i,
             Scalar4 *h_postype, Scalar4 *h_orientation, const unsigned int *h_tag, const Scalar4 *h_vel,
@@ -472,9 +538,35 @@ class IntegratorHPMCMono : public IntegratorHPMC
             uint64_t timestep, hoomd::RandomGenerator& rng_depletants,
             unsigned int seed_i_old, unsigned int seed_i_new);
 
+        //! Ghost layer width of each type, without m_extra_ghost_width
+        std::vector<Scalar> m_type_ghost_width;
+
         //! Set the nominal width appropriate for looped moves
         virtual void updateCellWidth();
 
+        //! Test whether update() can sweep over checkerboard cells in parallel
+        bool useCheckerboard(bool has_depletants);
+
+        //! Test whether the serial sweep uses the cached pair energies
+        bool useCachedPairEnergies(bool checkerboard)
+            {
+            return m_cache_pair_energies && !checkerboard && !m_patch && m_pair_potentials.size() > 0;
+            }
+
+        //! Compute the pair energy of every local particle
+        void buildPairEnergyCache();
+
+        #ifdef ENABLE_TBB
+        //! Get the checkerboard cell that contains a position
+        unsigned int getCheckerboardCell(const BoxDim& box, const vec3<Scalar>& pos) const;
+
+        //! Shift the checkerboard grid and sort the particles into cells
+        void buildCheckerboard(uint64_t timestep);
+
+        //! Perform one trial move per particle, moving particles in independent cells in parallel
+        void sweepCheckerboard(uint64_t timestep, unsigned int i_nselect, hpmc_counters_t& counters);
+        #endif
+
         //! Grow the m_aabbs list
         virtual void growAABBList(unsigned int N);
 
@@ -487,14 +579,20 @@ class IntegratorHPMCMono : public IntegratorHPMC
             m_image_list_valid = false;
             // changing the box does not necessarily invalidate the AABB tree - however, practically
             // anything that changes the box (i.e. NPT, box_resize) is also moving the particles,
-            // so use it as a sign to rebuild the AABB tree
-            m_aabb_tree_invalid = true;
+            // so use it as a sign to update the AABB tree. The particle indices are unchanged, so
+            // the tree may be refit.
+            if (!m_aabb_tree_invalid)
+                {
+                m_aabb_tree_invalid = true;
+                m_aabb_tree_refit = true;
+                }
             }
 
         //! callback so that the particle sort signal can invalidate the AABB tree
         virtual void slotSorted()
             {
             m_aabb_tree_invalid = true;
+            m_aabb_tree_refit = false;
             }
     };
 
@@ -535,6 +633,9 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs = NULL;
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
+    m_aabb_tree_refit = false;
+    m_aabb_tree_build_area = 0;
+    m_aabb_tree_max_area_ratio = Scalar(1.25);
 
     m_fugacity.resize(this->m_pdata->getNTypes(), 0.0);
     m_ntrial.resize(m_fugacity.getNumElements(), 1);
@@ -628,13 +729,6 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     m_update_order.resize(m_pdata->getN());
     m_update_order.shuffle(timestep, m_sysdef->getSeed(), m_exec_conf->getRank());
 
-    // update the AABB Tree
-    buildAABBTree();
-    // limit m_d entries so that particles cannot possibly wander more than one box image in one time step
-    limitMoveDistances();
-    // update the image list
-    updateImageList();
-
     bool has_depletants = false;
     for (unsigned int i = 0; i < m_fugacity.getNumElements(); ++i)
         {
@@ -645,6 +739,33 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
             }
         }
 
+    m_max_pair_additive_cutoff.clear();
+    m_shape_circumsphere_radius.clear();
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+        {
+        quat<LongReal> q;
+        Shape shape(q, m_params[type]);
+        m_shape_circumsphere_radius.push_back(LongReal(0.5) * shape.getCircumsphereDiameter());
+        m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
+        }
+
+    // sweep over independent cells in parallel when possible, the serial sweep needs the AABB tree
+    bool checkerboard = useCheckerboard(has_depletants);
+    if (!checkerboard)
+        {
+        // update the AABB Tree
+        buildAABBTree();
+        }
+    // limit m_d entries so that particles cannot possibly wander more than one box image in one time step
+    limitMoveDistances();
+    // update the image list
+    updateImageList();
+
+    #ifdef ENABLE_TBB
+    if (checkerboard)
+        buildCheckerboard(timestep);
+    #endif
+
     // Combine the three seeds to generate RNG for poisson distribution
     hoomd::RandomGenerator rng_depletants(hoomd::Seed(hoomd::RNGIdentifier::HPMCDepletants,
                                                       timestep,
@@ -660,19 +781,22 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     const LongReal min_core_radius = getMinCoreDiameter() * LongReal(0.5);
     const auto& pair_energy_search_radius = getPairEnergySearchRadius();
 
-    m_max_pair_additive_cutoff.clear();
-    m_shape_circumsphere_radius.clear();
-    for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
-        {
-        quat<LongReal> q;
-        Shape shape(q, m_params[type]);
-        m_shape_circumsphere_radius.push_back(LongReal(0.5) * shape.getCircumsphereDiameter());
-        m_max_pair_additive_cutoff.push_back(getMaxPairInteractionAdditiveRCut(type));
-        }
+    // trial moves look up the old configuration pair energy instead of searching the tree again
+    const bool cache_pair_energies = useCachedPairEnergies(checkerboard);
+    if (cache_pair_energies)
+        buildPairEnergyCache();
 
     // loop over local particles nselect times
     for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
         {
+        #ifdef ENABLE_TBB
+        if (checkerboard)
+            {
+            sweepCheckerboard(timestep, i_nselect, counters);
+            continue;
+            }
+        #endif
+
         // access particle data and system box
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
@@ -767,6 +891,8 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
 
             // patch + field interaction deltaU
             double patch_field_energy_diff = 0;
+            if (cache_pair_energies)
+                m_pair_energy_trial.clear();
 
             // check for overlaps with neighboring particle's positions (also calculate the new energy)
             // All image boxes (including the primary)
@@ -777,90 +903,84 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                 hoomd::detail::AABB aabb = aabb_i_local;
                 aabb.translate(pos_i_image);
 
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                // search the tree, stopping at the first overlap
+                m_wide_aabb_tree.query(aabb, [&](unsigned int j, unsigned int)
                     {
-                    if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                    Scalar4 postype_j;
+                    quat<LongReal> orientation_j;
+
+                    // handle j==i situations
+                    if ( j != i )
                         {
-                        if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                        // load the position and orientation of the j particle
+                        postype_j = h_postype.data[j];
+                        orientation_j = quat<LongReal>(h_orientation.data[j]);
+                        }
+                    else
+                        {
+                        if (cur_image == 0)
                             {
-                            for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
-                                {
-                                // read in its position and orientation
-                                unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                                Scalar4 postype_j;
-                                quat<LongReal> orientation_j;
-
-                                // handle j==i situations
-                                if ( j != i )
-                                    {
-                                    // load the position and orientation of the j particle
-                                    postype_j = h_postype.data[j];
-                                    orientation_j = quat<LongReal>(h_orientation.data[j]);
-                                    }
-                                else
-                                    {
-                                    if (cur_image == 0)
-                                        {
-                                        // in the first image, skip i == j
-                                        continue;
-                                        }
-                                    else
-                                        {
-                                        // If this is particle i and we are in an outside image, use the translated position and orientation
-                                        postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
-                                        orientation_j = shape_i.orientation;
-                                        }
-                                    }
+                            // in the first image, skip i == j
+                            return true;
+                            }
+                        else
+                            {
+                            // If this is particle i and we are in an outside image, use the translated position and orientation
+                            postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
+                            orientation_j = shape_i.orientation;
+                            }
+                        }
 
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                    // put particles in coordinate system of particle i
+                    vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
 
-                                unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                Shape shape_j(orientation_j, m_params[typ_j]);
+                    unsigned int typ_j = __scalar_as_int(postype_j.w);
+                    Shape shape_j(orientation_j, m_params[typ_j]);
 
-                                LongReal r_squared = dot(r_ij, r_ij);
-                                LongReal max_overlap_distance = m_shape_circumsphere_radius[typ_i] + m_shape_circumsphere_radius[typ_j];
+                    LongReal r_squared = dot(r_ij, r_ij);
+                    LongReal max_overlap_distance = m_shape_circumsphere_radius[typ_i] + m_shape_circumsphere_radius[typ_j];
 
-                                counters.overlap_checks++;
-                                if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
-                                    && r_squared < max_overlap_distance * max_overlap_distance
-                                    && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
-                                    {
-                                    overlap = true;
-                                    break;
-                                    }
-
-                                // deltaU = U_old - U_new: subtract energy of new configuration
-                                patch_field_energy_diff -= computeOnePairEnergy(r_squared, r_ij, typ_i,
-                                                        shape_i.orientation,
-                                                        h_diameter.data[i],
-                                                        h_charge.data[i],
-                                                        typ_j,
-                                                        shape_j.orientation,
-                                                        h_diameter.data[j],
-                                                        h_charge.data[j]
-                                                        );
-                                }
-                           }
-                        }
-                    else
+                    counters.overlap_checks++;
+                    if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                        && r_squared < max_overlap_distance * max_overlap_distance
+                        && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
                         {
-                        // skip ahead
-                        cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                        overlap = true;
+                        return false;
                         }
 
-                    if (overlap)
-                        break;
-                    }  // end loop over AABB nodes
+                    // deltaU = U_old - U_new: subtract energy of new configuration
+                    double energy_ij = computeOnePairEnergy(r_squared, r_ij, typ_i,
+                                            shape_i.orientation,
+                                            h_diameter.data[i],
+                                            h_charge.data[i],
+                                            typ_j,
+                                            shape_j.orientation,
+                                            h_diameter.data[j],
+                                            h_charge.data[j]
+                                            );
+                    patch_field_energy_diff -= energy_ij;
+
+                    // record the trial energies of the neighbors to update the cache on acceptance
+                    if (cache_pair_energies && j != i && energy_ij != 0.0)
+                        m_pair_energy_trial.push_back(std::make_pair(j, energy_ij));
+                    return true;
+                    });
 
                 if (overlap)
                     break;
                 } // end loop over images
 
+            // the pair energy of i in the trial configuration
+            const double pair_energy_new = -patch_field_energy_diff;
+
+            if (cache_pair_energies && !overlap)
+                {
+                // deltaU = U_old - U_new: add cached energy of old configuration
+                patch_field_energy_diff += m_pair_energy_cache[i];
+                }
             // Calculate old pair energy only when there are pair energies to calculate.
-            if (hasPairInteractions() && !overlap)
+            else if (hasPairInteractions() && !overlap)
                 {
                 for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
@@ -868,68 +988,51 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     hoomd::detail::AABB aabb = aabb_i_local;
                     aabb.translate(pos_i_image);
 
-                    // stackless search
-                    for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                    m_wide_aabb_tree.query(aabb, [&](unsigned int j, unsigned int)
                         {
-                        if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                        Scalar4 postype_j;
+                        quat<LongReal> orientation_j;
+
+                        // handle j==i situations
+                        if ( j != i )
                             {
-                            if (m_aabb_tree.isNodeLeaf(cur_node_idx))
-                                {
-                                for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
-                                    {
-                                    // read in its position and orientation
-                                    unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                                    Scalar4 postype_j;
-                                    quat<LongReal> orientation_j;
-
-                                    // handle j==i situations
-                                    if ( j != i )
-                                        {
-                                        // load the position and orientation of the j particle
-                                        postype_j = h_postype.data[j];
-                                        orientation_j = quat<LongReal>(h_orientation.data[j]);
-                                        }
-                                    else
-                                        {
-                                        if (cur_image == 0)
-                                            {
-                                            // in the first image, skip i == j
-                                            continue;
-                                            }
-                                        else
-                                            {
-                                            // If this is particle i and we are in an outside image, use the translated position and orientation
-                                            postype_j = make_scalar4(pos_old.x, pos_old.y, pos_old.z, postype_i.w);
-                                            orientation_j = shape_old.orientation;
-                                            }
-                                        }
-
-                                    // put particles in coordinate system of particle i
-                                    vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
-                                    unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                    Shape shape_j(orientation_j, m_params[typ_j]);
-
-                                    // deltaU = U_old - U_new: add energy of old configuration
-                                    patch_field_energy_diff += computeOnePairEnergy(dot(r_ij, r_ij),
-                                                            r_ij,
-                                                            typ_i,
-                                                            shape_old.orientation,
-                                                            h_diameter.data[i],
-                                                            h_charge.data[i],
-                                                            typ_j,
-                                                            shape_j.orientation,
-                                                            h_diameter.data[j],
-                                                            h_charge.data[j]);
-                                    }
-                                }
+                            // load the position and orientation of the j particle
+                            postype_j = h_postype.data[j];
+                            orientation_j = quat<LongReal>(h_orientation.data[j]);
                             }
                         else
                             {
-                            // skip ahead
-                            cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                            if (cur_image == 0)
+                                {
+                                // in the first image, skip i == j
+                                return true;
+                                }
+                            else
+                                {
+                                // If this is particle i and we are in an outside image, use the translated position and orientation
+                                postype_j = make_scalar4(pos_old.x, pos_old.y, pos_old.z, postype_i.w);
+                                orientation_j = shape_old.orientation;
+                                }
                             }
-                        }  // end loop over AABB nodes
+
+                        // put particles in coordinate system of particle i
+                        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                        unsigned int typ_j = __scalar_as_int(postype_j.w);
+                        Shape shape_j(orientation_j, m_params[typ_j]);
+
+                        // deltaU = U_old - U_new: add energy of old configuration
+                        patch_field_energy_diff += computeOnePairEnergy(dot(r_ij, r_ij),
+                                                r_ij,
+                                                typ_i,
+                                                shape_old.orientation,
+                                                h_diameter.data[i],
+                                                h_charge.data[i],
+                                                typ_j,
+                                                shape_j.orientation,
+                                                h_diameter.data[j],
+                                                h_charge.data[j]);
+                        return true;
+                        });
                     } // end loop over images
                 }
 
@@ -978,7 +1081,17 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                     aabb = hoomd::detail::AABB(pos_i, radius);
                     }
 
-                m_aabb_tree.update(i, aabb);
+                updateAABBTree(i, aabb);
+
+                if (cache_pair_energies)
+                    {
+                    // remove the old pair energies from the neighbors and add the new ones
+                    computeParticlePairEnergy(i, pos_old, shape_old.orientation, R_query, h_postype.data,
+                        h_orientation.data, h_diameter.data, h_charge.data, m_pair_energy_cache.data());
+                    for (const auto& neighbor : m_pair_energy_trial)
+                        m_pair_energy_cache[neighbor.first] += neighbor.second;
+                    m_pair_energy_cache[i] = pair_energy_new;
+                    }
 
                 // update position of particle
                 h_postype.data[i] = make_scalar4(pos_i.x,pos_i.y,pos_i.z,postype_i.w);
@@ -1050,8 +1163,13 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     // migrate and exchange particles
     communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    m_aabb_tree_invalid = true;
+    // all particle have been moved, the aabb tree is now invalid. When communicate() did not
+    // change the particle indices, the tree may be refit to the new positions.
+    if (!m_aabb_tree_invalid)
+        {
+        m_aabb_tree_invalid = true;
+        m_aabb_tree_refit = true;
+        }
 
     // set current MPS value
     hpmc_counters_t run_counters = getCounters(1);
@@ -1059,12 +1177,23 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     m_mps = double(run_counters.getNMoves()) / cur_time;
     }
 
-/*! \param timestep current step
-    \param early_exit exit at first overlap found if true
+/*! \param early_exit exit at first overlap found if true
     \returns number of overlaps if early_exit=false, 1 if early_exit=true
 */
 template <class Shape>
 unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
+    {
+    if (early_exit)
+        return countOverlapsUpTo(0) > 0 ? 1 : 0;
+
+    return countOverlapsUpTo(std::numeric_limits<unsigned int>::max());
+    }
+
+/*! \param max_overlaps stop counting once more than this many overlaps are found
+    \returns number of overlaps, which is larger than \a max_overlaps when counting stopped early
+*/
+template <class Shape>
+unsigned int IntegratorHPMCMono<Shape>::countOverlapsUpTo(unsigned int max_overlaps)
     {
     unsigned int overlap_count = 0;
     unsigned int err_count = 0;
@@ -1134,7 +1263,7 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
                                 && test_overlap(-r_ij, shape_j, shape_i, err_count))
                                 {
                                 overlap_count++;
-                                if (early_exit)
+                                if (overlap_count > max_overlaps)
                                     {
                                     // exit early from loop over neighbor particles
                                     break;
@@ -1149,19 +1278,19 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
                     cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
                     }
 
-                if (overlap_count && early_exit)
+                if (overlap_count > max_overlaps)
                     {
                     break;
                     }
                 } // end loop over AABB nodes
 
-            if (overlap_count && early_exit)
+            if (overlap_count > max_overlaps)
                 {
                 break;
                 }
             } // end loop over images
 
-        if (overlap_count && early_exit)
+        if (overlap_count > max_overlaps)
             {
             break;
             }
@@ -1171,14 +1300,142 @@ unsigned int IntegratorHPMCMono<Shape>::countOverlaps(bool early_exit)
     if (this->m_pdata->getDomainDecomposition())
         {
         MPI_Allreduce(MPI_IN_PLACE, &overlap_count, 1, MPI_UNSIGNED, MPI_SUM, m_exec_conf->getMPICommunicator());
-        if (early_exit && overlap_count > 1)
-            overlap_count = 1;
         }
     #endif
 
     return overlap_count;
     }
 
+/*! \param type Particle type to test
+    \returns true when at least one particle of type \a type overlaps with another particle
+
+    Only pairs with a local particle of type \a type are tested, so a change to the parameters of
+    one type is validated without testing the pairs between all other particles. The local
+    particles of the type are tested in parallel and every thread stops at the first overlap
+    found by any thread.
+*/
+template <class Shape>
+bool IntegratorHPMCMono<Shape>::hasOverlapsWithType(unsigned int type)
+    {
+    // build an up to date AABB tree
+    buildAABBTree();
+    // update the image list
+    updateImageList();
+
+    // access particle data
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+
+    // access parameters and interaction matrix
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    // collect the local particles of the given type
+    std::vector<unsigned int> members;
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        if (__scalar_as_int(h_postype.data[i].w) == (int)type)
+            members.push_back(i);
+        }
+
+    #ifdef ENABLE_TBB
+    std::atomic<bool> found_overlap(false);
+    #else
+    bool found_overlap = false;
+    #endif
+
+    // test one particle against all of its neighbors, return true at the first overlap
+    auto test_particle = [&](unsigned int i)
+        {
+        unsigned int err_count = 0;
+        Shape shape_i(quat<Scalar>(h_orientation.data[i]), m_params[type]);
+        vec3<Scalar> pos_i = vec3<Scalar>(h_postype.data[i]);
+        hoomd::detail::AABB aabb_i_local = shape_i.getAABB(vec3<Scalar>(0,0,0));
+
+        const unsigned int n_images = (unsigned int)m_image_list.size();
+        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            {
+            vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+            hoomd::detail::AABB aabb = aabb_i_local;
+            aabb.translate(pos_i_image);
+
+            // stackless search
+            for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                {
+                if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                    {
+                    if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                        {
+                        // another thread found an overlap
+                        if (found_overlap)
+                            return false;
+
+                        for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                            {
+                            unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                            // skip i==j in the 0 image
+                            if (cur_image == 0 && i == j)
+                                continue;
+
+                            Scalar4 postype_j = h_postype.data[j];
+
+                            // put particles in coordinate system of particle i
+                            vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+
+                            unsigned int typ_j = __scalar_as_int(postype_j.w);
+                            Shape shape_j(quat<Scalar>(h_orientation.data[j]), m_params[typ_j]);
+
+                            if (h_overlaps.data[m_overlap_idx(type,typ_j)]
+                                && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                                && test_overlap(r_ij, shape_i, shape_j, err_count)
+                                && test_overlap(-r_ij, shape_j, shape_i, err_count))
+                                {
+                                return true;
+                                }
+                            }
+                        }
+                    }
+                else
+                    {
+                    // skip ahead
+                    cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                    }
+                } // end loop over AABB nodes
+            } // end loop over images
+
+        return false;
+        };
+
+    const unsigned int n_members = (unsigned int)members.size();
+    #ifdef ENABLE_TBB
+    m_exec_conf->getTaskArena()->execute([&]{
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_members),
+        [&](const tbb::blocked_range<unsigned int>& r)
+        {
+        for (unsigned int k = r.begin(); k != r.end() && !found_overlap; ++k)
+            {
+            if (test_particle(members[k]))
+                found_overlap = true;
+            }
+        });
+    }); // end task arena execute()
+    #else
+    for (unsigned int k = 0; k < n_members && !found_overlap; k++)
+        found_overlap = test_particle(members[k]);
+    #endif
+
+    unsigned int overlap = found_overlap ? 1 : 0;
+
+    #ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE, &overlap, 1, MPI_UNSIGNED, MPI_MAX, m_exec_conf->getMPICommunicator());
+        }
+    #endif
+
+    return overlap != 0;
+    }
+
 template<class Shape>
 double IntegratorHPMCMono<Shape>::computeTotalPairEnergy(uint64_t timestep)
     {
@@ -1320,6 +1577,147 @@ double IntegratorHPMCMono<Shape>::computePairEnergy(uint64_t timestep, std::shar
     return energy;
     }
 
+/*! \param i Index of the particle
+    \param pos_i Position of the particle
+    \param orientation_i Orientation of the particle
+    \param R_query Radius of the AABB tree search
+    \param h_postype Particle positions and types
+    \param h_orientation Particle orientations
+    \param h_diameter Particle diameters
+    \param h_charge Particle charges
+    \param neighbor_energy When not null, subtract each pair energy from the entry of the neighbor
+
+    \returns The total pair energy of particle i at the given position and orientation, including
+    the interactions with its own periodic images.
+
+    The AABB tree and the image list must be up to date.
+*/
+template <class Shape>
+double IntegratorHPMCMono<Shape>::computeParticlePairEnergy(unsigned int i, const vec3<Scalar>& pos_i,
+    const quat<LongReal>& orientation_i, LongReal R_query, const Scalar4 *h_postype,
+    const Scalar4 *h_orientation, const Scalar *h_diameter, const Scalar *h_charge, double *neighbor_energy)
+    {
+    double energy = 0.0;
+
+    unsigned int typ_i = __scalar_as_int(h_postype[i].w);
+    hoomd::detail::AABB aabb_i_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0),R_query);
+
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+        {
+        vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
+        hoomd::detail::AABB aabb = aabb_i_local;
+        aabb.translate(pos_i_image);
+
+        // stackless search
+        for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+            {
+            if (aabb.overlaps(m_aabb_tree.getNodeAABB(cur_node_idx)))
+                {
+                if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                    {
+                    for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                        {
+                        unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                        vec3<Scalar> pos_j;
+                        quat<LongReal> orientation_j;
+                        if (j != i)
+                            {
+                            pos_j = vec3<Scalar>(h_postype[j]);
+                            orientation_j = quat<LongReal>(h_orientation[j]);
+                            }
+                        else
+                            {
+                            // in the first image, skip i == j
+                            if (cur_image == 0)
+                                continue;
+
+                            // in outside images, interact with the image of i at the given position
+                            pos_j = pos_i;
+                            orientation_j = orientation_i;
+                            }
+
+                        // put particles in coordinate system of particle i
+                        vec3<Scalar> r_ij = pos_j - pos_i_image;
+                        unsigned int typ_j = __scalar_as_int(h_postype[j].w);
+
+                        double energy_ij = computeOnePairEnergy(dot(r_ij, r_ij),
+                                                r_ij,
+                                                typ_i,
+                                                orientation_i,
+                                                h_diameter[i],
+                                                h_charge[i],
+                                                typ_j,
+                                                orientation_j,
+                                                h_diameter[j],
+                                                h_charge[j]);
+                        energy += energy_ij;
+
+                        if (neighbor_energy && j != i)
+                            neighbor_energy[j] -= energy_ij;
+                        }
+                    }
+                }
+            else
+                {
+                // skip ahead
+                cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                }
+            } // end loop over AABB nodes
+        } // end loop over images
+
+    return energy;
+    }
+
+/*! Fill m_pair_energy_cache with the pair energy of every local particle. Trial moves in the serial
+    sweep use the cached value in place of a second AABB tree search around the old configuration,
+    and apply the changes in pair energy to the particle and its neighbors when accepting a move.
+    Rejected moves (the majority for soft potentials with well tuned move sizes) then cost one tree
+    search instead of two. The cache is rebuilt at the start of every step, so changes made by other
+    updaters and to the pair potential parameters are always picked up.
+
+    The AABB tree and the image list must be up to date.
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::buildPairEnergyCache()
+    {
+    const unsigned int N = m_pdata->getN();
+    m_pair_energy_cache.assign(N + m_pdata->getNGhosts(), 0.0);
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+    // use the same search radius as the trial moves
+    const LongReal min_core_radius = getMinCoreDiameter() * LongReal(0.5);
+    const auto& pair_energy_search_radius = getPairEnergySearchRadius();
+
+    auto compute_energy = [&](unsigned int i)
+        {
+        unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
+        LongReal R_query = std::max(m_shape_circumsphere_radius[typ_i], pair_energy_search_radius[typ_i] - min_core_radius);
+        m_pair_energy_cache[i] = computeParticlePairEnergy(i, vec3<Scalar>(h_postype.data[i]),
+            quat<LongReal>(h_orientation.data[i]), R_query, h_postype.data, h_orientation.data,
+            h_diameter.data, h_charge.data);
+        };
+
+    #ifdef ENABLE_TBB
+    m_exec_conf->getTaskArena()->execute([&]{
+    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+        [&](const tbb::blocked_range<unsigned int>& r)
+        {
+        for (unsigned int i = r.begin(); i != r.end(); ++i)
+            compute_energy(i);
+        });
+    }); // end task arena execute()
+    #else
+    for (unsigned int i = 0; i < N; i++)
+        compute_energy(i);
+    #endif
+    }
+
 
 template <class Shape>
 Scalar IntegratorHPMCMono<Shape>::getMaxCoreDiameter()
@@ -1417,11 +1815,14 @@ void IntegratorHPMCMono<Shape>::setInteractionMatrix(std::pair<std::string, std:
     auto typj = m_pdata->getTypeByName(types.second);
 
     // update the parameter for this type
-    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::readwrite);
-    h_overlaps.data[m_overlap_idx(typi,typj)] = check_overlaps;
-    h_overlaps.data[m_overlap_idx(typj,typi)] = check_overlaps;
+        {
+        ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::readwrite);
+        h_overlaps.data[m_overlap_idx(typi,typj)] = check_overlaps;
+        h_overlaps.data[m_overlap_idx(typj,typi)] = check_overlaps;
+        }
 
-    m_image_list_valid = false;
+    // the per-type ghost widths depend on which types overlap
+    updateCellWidth();
     }
 
 template <class Shape>
@@ -1674,6 +2075,48 @@ void IntegratorHPMCMono<Shape>::updateCellWidth()
 
         this->m_nominal_width = std::max(this->m_nominal_width, getMaxPairEnergyRCutNonAdditive() + max_extent);
         }
+
+    /* Particles closer than m_nominal_width to the upper boundaries are not moved, so ghosts only
+       need to reach any active particle they may interact with. For a ghost of type t, that is
+       0.5 (d_t + d_j) for any type j that overlaps with t, and the pair interaction range with t.
+       Thin, long shapes mixed with small ones then only send ghosts of the small types from a thin
+       layer. Depletants may overlap any pair of shapes, so they keep the nominal width.
+    */
+    const unsigned int n_types = this->m_pdata->getNTypes();
+    m_type_ghost_width.assign(n_types, this->m_nominal_width);
+    if (max_d == Scalar(0.0))
+        {
+        ArrayHandle<unsigned int> h_overlaps(this->m_overlaps, access_location::host, access_mode::read);
+
+        Scalar max_extent = 0.0;
+        if (hasPairInteractions())
+            {
+            for (unsigned int typ = 0; typ < n_types; typ++)
+                max_extent = std::max(max_extent, static_cast<Scalar>(getMaxPairInteractionAdditiveRCut(typ)));
+            }
+
+        for (unsigned int typ_i = 0; typ_i < n_types; typ_i++)
+            {
+            Shape temp_i(quat<Scalar>(), m_params[typ_i]);
+            Scalar width(0.0);
+            for (unsigned int typ_j = 0; typ_j < n_types; typ_j++)
+                {
+                Shape temp_j(quat<Scalar>(), m_params[typ_j]);
+                if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)])
+                    width = std::max(width, Scalar(0.5) * (temp_i.getCircumsphereDiameter() + temp_j.getCircumsphereDiameter()));
+                }
+
+            if (hasPairInteractions())
+                {
+                width = std::max(width,
+                                 static_cast<Scalar>(getMaxPairEnergyRCutNonAdditive())
+                                     + Scalar(0.5) * (static_cast<Scalar>(getMaxPairInteractionAdditiveRCut(typ_i)) + max_extent));
+                }
+
+            m_type_ghost_width[typ_i] = std::min(width, this->m_nominal_width);
+            }
+        }
+
     this->m_image_list_valid = false;
     this->m_aabb_tree_invalid = true;
 
@@ -1707,6 +2150,12 @@ void IntegratorHPMCMono<Shape>::growAABBList(unsigned int N)
     this is on the next timestep. But in some cases (i.e. NPT), the tree may need to be rebuilt several times in a
     single step because of box volume moves.
 
+    When only the particle positions, orientations, or the box have changed and the particle indices are the same,
+    set m_aabb_tree_refit to true as well. buildAABBTree() then refits the existing tree to the new AABBs in O(N)
+    time. Refitting keeps the tree topology, so the tree becomes less efficient as the particles move away from their
+    positions at the last build. buildAABBTree() rebuilds the tree from scratch when the total surface area of the
+    refit tree exceeds m_aabb_tree_max_area_ratio times the area of the last built tree.
+
     Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid appropriately, or
     erroneous simulations will result.
 
@@ -1754,13 +2203,32 @@ const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
                         m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype.data[i]), radius);
                         }
                     }
-                m_aabb_tree.buildTree(m_aabbs, n_aabb);
+
+                bool rebuild = true;
+                if (m_aabb_tree_refit && m_aabb_tree.getNumParticles() == n_aabb)
+                    {
+                    m_aabb_tree.refit(m_aabbs, n_aabb);
+                    rebuild = m_aabb_tree.getSurfaceArea() > m_aabb_tree_max_area_ratio * m_aabb_tree_build_area;
+                    }
+
+                if (rebuild)
+                    {
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                    m_aabb_tree_build_area = m_aabb_tree.getSurfaceArea();
+                    }
+                else
+                    {
+                    m_exec_conf->msg->notice(8) << "Refit AABB tree" << std::endl;
+                    }
+
+                m_wide_aabb_tree.build(m_aabb_tree);
                 }
             }
 
         }
 
     m_aabb_tree_invalid = false;
+    m_aabb_tree_refit = false;
     return m_aabb_tree;
     }
 
@@ -1799,6 +2267,387 @@ void IntegratorHPMCMono<Shape>::limitMoveDistances()
         }
     }
 
+/*! \param has_depletants True when any depletant fugacity is non-zero
+    \returns True when update() should use sweepCheckerboard()
+
+    The checkerboard sweep divides the box into an even number of cells along each lattice vector,
+    each at least as wide as the largest interaction range. Cells with the same parity along all
+    lattice vectors (the same color) are separated by at least one cell, so particles in different
+    cells of the same color cannot interact. The sweep moves all cells of one color concurrently
+    and rejects moves that leave the cell, then moves on to the next color. This is the scheme
+    that IntegratorHPMCMonoGPU uses.
+
+    The checkerboard sweep requires more than one TBB thread and a single rank, and does not
+    support depletants or external potentials.
+*/
+template <class Shape>
+bool IntegratorHPMCMono<Shape>::useCheckerboard(bool has_depletants)
+    {
+    #ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() <= 1 || has_depletants || m_external || m_pdata->getN() == 0)
+        return false;
+
+    #ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        return false;
+    #endif
+
+    // the largest distance at which the serial AABB tree search finds a pair
+    const auto& pair_energy_search_radius = getPairEnergySearchRadius();
+    const LongReal min_core_radius = getMinCoreDiameter() * LongReal(0.5);
+    LongReal max_query_radius = 0;
+    LongReal max_aabb_radius = 0;
+    for (unsigned int type = 0; type < m_pdata->getNTypes(); type++)
+        {
+        LongReal query_radius = m_shape_circumsphere_radius[type];
+        LongReal aabb_radius = m_shape_circumsphere_radius[type];
+        if (hasPairInteractions())
+            {
+            query_radius = std::max(query_radius, pair_energy_search_radius[type] - min_core_radius);
+            aabb_radius = std::max(aabb_radius, LongReal(0.5) * m_max_pair_additive_cutoff[type]);
+            }
+        max_query_radius = std::max(max_query_radius, query_radius);
+        max_aabb_radius = std::max(max_aabb_radius, aabb_radius);
+        }
+
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+
+    // use no more cells than particles
+    Scalar width = Scalar(max_query_radius + max_aabb_radius);
+    width = std::max(width, Scalar(pow(box.getVolume(ndim == 2) / Scalar(m_pdata->getN()), Scalar(1.0) / Scalar(ndim))));
+
+    // each dimension needs an even number of cells, and at least 4 so that the neighbors of a cell are distinct
+    const Scalar3 npd = box.getNearestPlaneDistance();
+    uint3 dim = make_uint3((unsigned int)(npd.x / width), (unsigned int)(npd.y / width), 1);
+    if (ndim == 3)
+        dim.z = (unsigned int)(npd.z / width);
+    dim.x -= dim.x % 2;
+    dim.y -= dim.y % 2;
+    if (ndim == 3)
+        dim.z -= dim.z % 2;
+
+    if (dim.x < 4 || dim.y < 4 || (ndim == 3 && dim.z < 4))
+        return false;
+
+    m_checkerboard_dim = dim;
+    return true;
+    #else
+    return false;
+    #endif
+    }
+
+#ifdef ENABLE_TBB
+/*! \param box Local simulation box
+    \param pos Position in the box (or up to one image outside it)
+    \returns Index of the checkerboard cell that contains \a pos
+*/
+template <class Shape>
+unsigned int IntegratorHPMCMono<Shape>::getCheckerboardCell(const BoxDim& box, const vec3<Scalar>& pos) const
+    {
+    Scalar3 f = box.makeFraction(vec_to_scalar3(pos));
+    int cx = int(slow::floor((f.x + m_checkerboard_offset.x) * Scalar(m_checkerboard_dim.x)));
+    int cy = int(slow::floor((f.y + m_checkerboard_offset.y) * Scalar(m_checkerboard_dim.y)));
+    int cz = int(slow::floor((f.z + m_checkerboard_offset.z) * Scalar(m_checkerboard_dim.z)));
+
+    // wrap the cell into the periodic grid
+    cx = (cx % int(m_checkerboard_dim.x) + int(m_checkerboard_dim.x)) % int(m_checkerboard_dim.x);
+    cy = (cy % int(m_checkerboard_dim.y) + int(m_checkerboard_dim.y)) % int(m_checkerboard_dim.y);
+    cz = (cz % int(m_checkerboard_dim.z) + int(m_checkerboard_dim.z)) % int(m_checkerboard_dim.z);
+
+    return Index3D(m_checkerboard_dim.x, m_checkerboard_dim.y, m_checkerboard_dim.z)(cx, cy, cz);
+    }
+
+/*! \param timestep Current time step
+
+    Randomly shift the checkerboard grid, so that the cell boundaries do not stay in place, then
+    sort the particles into cells in the current update order.
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::buildCheckerboard(uint64_t timestep)
+    {
+    hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard, timestep, m_sysdef->getSeed()),
+                               hoomd::Counter());
+    hoomd::UniformDistribution<Scalar> uniform(Scalar(0.0), Scalar(1.0));
+    m_checkerboard_offset.x = uniform(rng);
+    m_checkerboard_offset.y = uniform(rng);
+    m_checkerboard_offset.z = m_sysdef->getNDimensions() == 3 ? uniform(rng) : Scalar(0.0);
+
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_cells = m_checkerboard_dim.x * m_checkerboard_dim.y * m_checkerboard_dim.z;
+    m_checkerboard_cell_offsets.assign(n_cells + 1, 0);
+    m_checkerboard_cell_particles.resize(N);
+    m_checkerboard_particle_cell.resize(N);
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    // count the particles in each cell
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        unsigned int cell = getCheckerboardCell(box, vec3<Scalar>(h_postype.data[m_update_order[cur_particle]]));
+        m_checkerboard_particle_cell[cur_particle] = cell;
+        m_checkerboard_cell_offsets[cell + 1]++;
+        }
+
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_checkerboard_cell_offsets[cell + 1] += m_checkerboard_cell_offsets[cell];
+
+    // place the particles, preserving the update order within each cell
+    std::vector<unsigned int> cell_fill(m_checkerboard_cell_offsets.begin(), m_checkerboard_cell_offsets.end() - 1);
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        unsigned int cell = m_checkerboard_particle_cell[cur_particle];
+        m_checkerboard_cell_particles[cell_fill[cell]++] = m_update_order[cur_particle];
+        }
+    }
+
+/*! \param timestep Current time step
+    \param i_nselect Index of the current sweep
+    \param counters Output: Counters to add the trial moves to
+
+    Perform the same trial moves as the serial loop in update(), but find the neighbors of a particle
+    in the cell lists and reject moves that leave the cell. buildCheckerboard() must be called first.
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::sweepCheckerboard(uint64_t timestep, unsigned int i_nselect, hpmc_counters_t& counters)
+    {
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    //access move sizes
+    ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const uint16_t seed = m_sysdef->getSeed();
+    const unsigned int rank = m_exec_conf->getRank();
+    const bool has_pair_interactions = hasPairInteractions();
+    const uint3 dim = m_checkerboard_dim;
+    const Index3D cell_indexer(dim.x, dim.y, dim.z);
+
+    // call f(j) for every particle j in the cells around (and including) cell
+    auto for_each_neighbor = [&](unsigned int cell, const auto& f)
+        {
+        uint3 c = cell_indexer.getTriple(cell);
+        int dz_max = ndim == 3 ? 1 : 0;
+        for (int dz = -dz_max; dz <= dz_max; dz++)
+            for (int dy = -1; dy <= 1; dy++)
+                for (int dx = -1; dx <= 1; dx++)
+                    {
+                    unsigned int neighbor_cell = cell_indexer((c.x + dim.x + dx) % dim.x,
+                                                              (c.y + dim.y + dy) % dim.y,
+                                                              (c.z + dim.z + dz) % dim.z);
+                    for (unsigned int k = m_checkerboard_cell_offsets[neighbor_cell];
+                         k < m_checkerboard_cell_offsets[neighbor_cell + 1]; k++)
+                        {
+                        if (f(m_checkerboard_cell_particles[k]))
+                            return;
+                        }
+                    }
+        };
+
+    // perform one trial move on particle i in the given cell
+    auto trial_move = [&](unsigned int i, unsigned int cell, hpmc_counters_t& thread_counters)
+        {
+        // read in the current position and orientation
+        Scalar4 postype_i = h_postype.data[i];
+        vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+        // make a trial move for i
+        hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove, timestep, seed),
+                                     hoomd::Counter(i, rank, i_nselect));
+        int typ_i = __scalar_as_int(postype_i.w);
+        Shape shape_i(quat<LongReal>(h_orientation.data[i]), m_params[typ_i]);
+        unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng_i);
+        bool move_type_translate = !shape_i.hasOrientation() || (move_type_select < m_translation_move_probability);
+
+        Shape shape_old(shape_i.orientation, m_params[typ_i]);
+        vec3<Scalar> pos_old = pos_i;
+
+        if (move_type_translate)
+            {
+            // skip if no overlap check is required
+            if (h_d.data[typ_i] == 0.0)
+                {
+                if (!shape_i.ignoreStatistics())
+                    thread_counters.translate_accept_count++;
+                return;
+                }
+
+            move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
+
+            // particles in other cells of the same color may be moving, reject moves out of the cell
+            if (getCheckerboardCell(box, pos_i) != cell)
+                {
+                if (!shape_i.ignoreStatistics())
+                    thread_counters.translate_reject_count++;
+                return;
+                }
+            }
+        else
+            {
+            if (h_a.data[typ_i] == 0.0)
+                {
+                if (!shape_i.ignoreStatistics())
+                    thread_counters.rotate_accept_count++;
+                return;
+                }
+
+            if (ndim == 2)
+                move_rotate<2>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+            else
+                move_rotate<3>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+            }
+
+        bool overlap = false;
+
+        // patch + field interaction deltaU
+        double patch_field_energy_diff = 0;
+
+        // check for overlaps with the neighboring particles (also calculate the new energy)
+        for_each_neighbor(cell, [&](unsigned int j)
+            {
+            if (j == i)
+                return false;
+
+            // put particles in coordinate system of particle i
+            Scalar4 postype_j = h_postype.data[j];
+            vec3<Scalar> r_ij = box.minImage(vec3<Scalar>(postype_j) - pos_i);
+
+            unsigned int typ_j = __scalar_as_int(postype_j.w);
+            Shape shape_j(quat<LongReal>(h_orientation.data[j]), m_params[typ_j]);
+
+            LongReal r_squared = dot(r_ij, r_ij);
+            LongReal max_overlap_distance = m_shape_circumsphere_radius[typ_i] + m_shape_circumsphere_radius[typ_j];
+
+            thread_counters.overlap_checks++;
+            if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                && r_squared < max_overlap_distance * max_overlap_distance
+                && test_overlap(r_ij, shape_i, shape_j, thread_counters.overlap_err_count))
+                {
+                overlap = true;
+                return true;
+                }
+
+            if (has_pair_interactions)
+                {
+                // deltaU = U_old - U_new: subtract energy of new configuration
+                patch_field_energy_diff -= computeOnePairEnergy(r_squared, r_ij, typ_i,
+                                                                shape_i.orientation,
+                                                                h_diameter.data[i],
+                                                                h_charge.data[i],
+                                                                typ_j,
+                                                                shape_j.orientation,
+                                                                h_diameter.data[j],
+                                                                h_charge.data[j]);
+                }
+            return false;
+            });
+
+        // Calculate old pair energy only when there are pair energies to calculate.
+        if (has_pair_interactions && !overlap)
+            {
+            for_each_neighbor(cell, [&](unsigned int j)
+                {
+                if (j == i)
+                    return false;
+
+                Scalar4 postype_j = h_postype.data[j];
+                vec3<Scalar> r_ij = box.minImage(vec3<Scalar>(postype_j) - pos_old);
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
+
+                // deltaU = U_old - U_new: add energy of old configuration
+                patch_field_energy_diff += computeOnePairEnergy(dot(r_ij, r_ij),
+                                                                r_ij,
+                                                                typ_i,
+                                                                shape_old.orientation,
+                                                                h_diameter.data[i],
+                                                                h_charge.data[i],
+                                                                typ_j,
+                                                                quat<LongReal>(h_orientation.data[j]),
+                                                                h_diameter.data[j],
+                                                                h_charge.data[j]);
+                return false;
+                });
+            }
+
+        bool accept = !overlap && hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(patch_field_energy_diff);
+
+        // If no overlaps and Metropolis criterion is met, accept
+        // trial move and update positions and/or orientations.
+        if (accept)
+            {
+            // increment accept counter and assign new position
+            if (!shape_i.ignoreStatistics())
+                {
+                if (move_type_translate)
+                    thread_counters.translate_accept_count++;
+                else
+                    thread_counters.rotate_accept_count++;
+                }
+
+            // update position of particle
+            h_postype.data[i] = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
+
+            if (shape_i.hasOrientation())
+                {
+                h_orientation.data[i] = quat_to_scalar4(shape_i.orientation);
+                }
+            }
+        else
+            {
+            if (!shape_i.ignoreStatistics())
+                {
+                // increment reject counter
+                if (move_type_translate)
+                    thread_counters.translate_reject_count++;
+                else
+                    thread_counters.rotate_reject_count++;
+                }
+            }
+        };
+
+    tbb::enumerable_thread_specific<hpmc_counters_t> thread_counters;
+
+    // the 2^ndim colors are visited in sequence, cells of one color are independent
+    const uint3 color_dim = make_uint3(dim.x / 2, dim.y / 2, ndim == 3 ? dim.z / 2 : 1);
+    const unsigned int n_color_cells = color_dim.x * color_dim.y * color_dim.z;
+    const unsigned int n_colors = ndim == 3 ? 8 : 4;
+    const Index3D color_indexer(color_dim.x, color_dim.y, color_dim.z);
+
+    m_exec_conf->getTaskArena()->execute([&]{
+    for (unsigned int color = 0; color < n_colors; color++)
+        {
+        tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_color_cells),
+            [&](const tbb::blocked_range<unsigned int>& r)
+            {
+            hpmc_counters_t& local_counters = thread_counters.local();
+            for (unsigned int k = r.begin(); k != r.end(); ++k)
+                {
+                uint3 c = color_indexer.getTriple(k);
+                unsigned int cell = cell_indexer(2 * c.x + (color & 1),
+                                                 2 * c.y + ((color >> 1) & 1),
+                                                 ndim == 3 ? 2 * c.z + ((color >> 2) & 1) : 0);
+                for (unsigned int p = m_checkerboard_cell_offsets[cell]; p < m_checkerboard_cell_offsets[cell + 1]; p++)
+                    trial_move(m_checkerboard_cell_particles[p], cell, local_counters);
+                }
+            });
+        }
+    }); // end task arena execute()
+
+    // reduce counters
+    for (auto i = thread_counters.begin(); i != thread_counters.end(); ++i)
+        {
+        counters = counters + *i;
+        }
+    }
+#endif
+
 /*! Function for finding all overlaps in a system by particle tag. returns an unraveled form of an NxN matrix
  * with true/false indicating the overlap status of the ith and jth particle
  */
@@ -111,6 +111,140 @@ __global__ void hpmc_shift(Scalar4* d_postype,
     d_image[my_pidx] = image;
     }
 
+//! Kernel for scaling particles into a new box
+/*! \param d_postype postype array to update
+    \param N number of particles
+    \param old_box Box the particles are currently in
+    \param new_box Box to scale the particles into
+
+    Scale all particle positions by keeping their fractional coordinates fixed.
+
+    \ingroup hpmc_kernels
+*/
+__global__ void hpmc_scale(Scalar4* d_postype,
+                           const unsigned int N,
+                           const BoxDim old_box,
+                           const BoxDim new_box)
+    {
+    unsigned int my_pidx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    // this thread is inactive if it indexes past the end of the particle list
+    if (my_pidx >= N)
+        return;
+
+    Scalar4 postype = d_postype[my_pidx];
+
+    // obtain scaled coordinates in the old box and map them into the new box
+    Scalar3 f = old_box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+    Scalar3 pos = new_box.makeCoordinates(f);
+
+    d_postype[my_pidx] = make_scalar4(pos.x, pos.y, pos.z, postype.w);
+    }
+
+//! Kernel to select one of the trial moves proposed concurrently for each particle
+/*! The proposals are the stages of a delayed rejection move. The first proposal that passed the
+    overlap checks is taken. A later proposal p is accepted only if it and all proposals before it
+    are translations, and the earlier ones lie within the move size d of p. Then each earlier
+    proposal is a possible first trial of the reverse move from p and fails there too, since
+    whether it overlaps depends only on its own position. This preserves detailed balance without
+    evaluating any additional trial moves.
+
+    The selected proposal is written to the trial move arrays, where the narrow phase of the next
+    iteration reads it for the particles that are updated earlier.
+*/
+__global__ void hpmc_select_proposal(const Scalar4* d_proposal_postype,
+                                     const Scalar4* d_proposal_orientation,
+                                     const unsigned int* d_proposal_move_type,
+                                     const unsigned int* d_proposal_reject_out_of_cell,
+                                     unsigned int* d_proposal_reject,
+                                     const unsigned int n_proposal,
+                                     const unsigned int proposal_pitch,
+                                     const Scalar* d_d,
+                                     Scalar4* d_trial_postype,
+                                     Scalar4* d_trial_orientation,
+                                     unsigned int* d_trial_move_type,
+                                     unsigned int* d_reject_out_of_cell,
+                                     unsigned int* d_reject_out,
+                                     unsigned int* d_proposal_select,
+                                     unsigned int* d_condition,
+                                     const unsigned int nwork,
+                                     const unsigned work_offset)
+    {
+    // the particle we are handling
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (work_idx >= nwork)
+        return;
+    unsigned int i = work_idx + work_offset;
+
+    // find the first active proposal without overlaps
+    unsigned int select = 0;
+    bool reject = true;
+    for (unsigned int p = 0; p < n_proposal; ++p)
+        {
+        unsigned int k = p * proposal_pitch + i;
+        if (d_proposal_move_type[k] && !d_proposal_reject[k])
+            {
+            select = p;
+            reject = false;
+            break;
+            }
+        }
+
+    if (!reject && select > 0)
+        {
+        unsigned int k_select = select * proposal_pitch + i;
+        Scalar4 postype_select = d_proposal_postype[k_select];
+        Scalar4 orientation_select = d_proposal_orientation[k_select];
+        Scalar d = d_d[__scalar_as_int(postype_select.w)];
+
+        // translations leave the orientation unchanged, rotations leave the position unchanged
+        reject = d_proposal_move_type[k_select] != 1;
+        for (unsigned int p = 0; p < select && !reject; ++p)
+            {
+            unsigned int k = p * proposal_pitch + i;
+            Scalar4 postype_p = d_proposal_postype[k];
+            Scalar4 orientation_p = d_proposal_orientation[k];
+
+            Scalar dx = postype_p.x - postype_select.x;
+            Scalar dy = postype_p.y - postype_select.y;
+            Scalar dz = postype_p.z - postype_select.z;
+            bool same_orientation
+                = orientation_p.x == orientation_select.x && orientation_p.y == orientation_select.y
+                  && orientation_p.z == orientation_select.z
+                  && orientation_p.w == orientation_select.w;
+
+            if (!same_orientation || dx * dx + dy * dy + dz * dz >= d * d)
+                reject = true;
+            }
+        }
+
+    // count rejected moves with the move type of the first proposal
+    if (reject)
+        select = 0;
+
+    // did the selection change since the last iteration?
+    if (select != d_proposal_select[i])
+        {
+        // flag that we're not done yet (a trivial race condition upon write)
+        *d_condition = 1;
+        d_proposal_select[i] = select;
+        }
+
+    unsigned int k_select = select * proposal_pitch + i;
+    d_trial_postype[i] = d_proposal_postype[k_select];
+    d_trial_orientation[i] = d_proposal_orientation[k_select];
+    d_trial_move_type[i] = d_proposal_move_type[k_select];
+    d_reject_out_of_cell[i] = d_proposal_reject_out_of_cell[k_select];
+    d_reject_out[i] = reject;
+
+    // reset the proposal reject flags for the next iteration
+    for (unsigned int p = 0; p < n_proposal; ++p)
+        {
+        unsigned int k = p * proposal_pitch + i;
+        d_proposal_reject[k] = d_proposal_reject_out_of_cell[k];
+        }
+    }
+
 //!< Kernel to evaluate convergence
 __global__ void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                                        const unsigned int* d_reject_out_of_cell,
@@ -225,6 +359,96 @@ void __attribute__((visibility("default"))) hpmc_shift(Scalar4* d_postype,
     hipDeviceSynchronize();
     }
 
+//! Kernel driver for kernel::hpmc_scale()
+void __attribute__((visibility("default"))) hpmc_scale(Scalar4* d_postype,
+                                                       const unsigned int N,
+                                                       const BoxDim& old_box,
+                                                       const BoxDim& new_box,
+                                                       const unsigned int block_size)
+    {
+    assert(d_postype);
+
+    // setup the grid to run the kernel
+    dim3 threads(block_size, 1, 1);
+    dim3 grid(N / block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL(kernel::hpmc_scale,
+                       dim3(grid),
+                       dim3(threads),
+                       0,
+                       0,
+                       d_postype,
+                       N,
+                       old_box,
+                       new_box);
+
+    // after this kernel we return control of cuda managed memory to the host
+    hipDeviceSynchronize();
+    }
+
+void __attribute__((visibility("default")))
+hpmc_select_proposal(const Scalar4* d_proposal_postype,
+                     const Scalar4* d_proposal_orientation,
+                     const unsigned int* d_proposal_move_type,
+                     const unsigned int* d_proposal_reject_out_of_cell,
+                     unsigned int* d_proposal_reject,
+                     const unsigned int n_proposal,
+                     const unsigned int proposal_pitch,
+                     const Scalar* d_d,
+                     Scalar4* d_trial_postype,
+                     Scalar4* d_trial_orientation,
+                     unsigned int* d_trial_move_type,
+                     unsigned int* d_reject_out_of_cell,
+                     unsigned int* d_reject_out,
+                     unsigned int* d_proposal_select,
+                     unsigned int* d_condition,
+                     const GPUPartition& gpu_partition,
+                     const unsigned int block_size)
+    {
+    // determine the maximum block size and clamp the input block size down
+    int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_select_proposal));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // setup the grid to run the kernel
+    unsigned int run_block_size = min(block_size, (unsigned int)max_block_size);
+
+    dim3 threads(run_block_size, 1, 1);
+
+    for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = gpu_partition.getRangeAndSetGPU(idev);
+
+        unsigned int nwork = range.second - range.first;
+        const unsigned int num_blocks = nwork / run_block_size + 1;
+        dim3 grid(num_blocks, 1, 1);
+
+        hipLaunchKernelGGL(kernel::hpmc_select_proposal,
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_proposal_postype,
+                           d_proposal_orientation,
+                           d_proposal_move_type,
+                           d_proposal_reject_out_of_cell,
+                           d_proposal_reject,
+                           n_proposal,
+                           proposal_pitch,
+                           d_d,
+                           d_trial_postype,
+                           d_trial_orientation,
+                           d_trial_move_type,
+                           d_reject_out_of_cell,
+                           d_reject_out,
+                           d_proposal_select,
+                           d_condition,
+                           nwork,
+                           range.first);
+        }
+    }
+
 void __attribute__((visibility("default")))
 hpmc_check_convergence(const unsigned int* d_trial_move_type,
                        const unsigned int* d_reject_out_of_cell,
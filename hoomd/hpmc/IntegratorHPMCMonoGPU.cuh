@@ -42,6 +42,11 @@ namespace gpu
 namespace kernel
     {
 //! Check narrow-phase overlaps
+/*! Each group checks one of the \a n_proposal trial moves of a particle, read from
+    \a d_proposal_postype and \a d_proposal_orientation at p * proposal_pitch + i. The reject flags
+    \a d_reject_out_of_cell and \a d_reject_out are indexed the same way. The other particles are
+    always read from the selected trial moves in \a d_trial_postype and \a d_trial_orientation.
+*/
 template<class Shape, unsigned int max_threads>
 #ifdef __HIP_PLATFORM_NVCC__
 __launch_bounds__(max_threads)
@@ -71,7 +76,11 @@ __launch_bounds__(max_threads)
                                       const unsigned int max_extra_bytes,
                                       const unsigned int max_queue_size,
                                       const unsigned int work_offset,
-                                      const unsigned int nwork)
+                                      const unsigned int nwork,
+                                      const unsigned int n_proposal,
+                                      const unsigned int proposal_pitch,
+                                      const Scalar4* d_proposal_postype,
+                                      const Scalar4* d_proposal_orientation)
     {
     __shared__ unsigned int s_overlap_checks;
     __shared__ unsigned int s_overlap_err_count;
@@ -141,10 +150,13 @@ __launch_bounds__(max_threads)
         }
 
     bool active = true;
-    unsigned int idx = blockIdx.x * n_groups + group;
-    if (idx >= nwork)
+    unsigned int work_idx = blockIdx.x * n_groups + group;
+    if (work_idx >= nwork * n_proposal)
         active = false;
-    idx += work_offset;
+
+    // the particle and the proposal this group checks
+    unsigned int idx = work_offset + (active ? work_idx % nwork : 0);
+    unsigned int proposal_idx = (active ? work_idx / nwork : 0) * proposal_pitch + idx;
 
     unsigned int my_cell;
 
@@ -153,13 +165,13 @@ __launch_bounds__(max_threads)
 
     // if this particle is rejected a priori because it has left the cell, don't check overlaps
     // and avoid out of range memory access when computing the cell
-    if (active && d_reject_out_of_cell[idx])
+    if (active && d_reject_out_of_cell[proposal_idx])
         active = false;
 
     unsigned int update_order_i;
     if (active)
         {
-        Scalar4 postype_i(d_trial_postype[idx]);
+        Scalar4 postype_i(d_proposal_postype[proposal_idx]);
         vec3<Scalar> pos_i(postype_i);
         unsigned int type_i = __scalar_as_int(postype_i.w);
 
@@ -175,7 +187,7 @@ __launch_bounds__(max_threads)
             {
             s_pos_group[group] = make_scalar3(pos_i.x, pos_i.y, pos_i.z);
             s_type_group[group] = type_i;
-            s_orientation_group[group] = d_trial_orientation[idx];
+            s_orientation_group[group] = d_proposal_orientation[proposal_idx];
             }
         }
 
@@ -183,7 +195,7 @@ __launch_bounds__(max_threads)
         {
         // load from output, this race condition is intentional and implements an
         // optional early exit flag between concurrently running kernels
-        s_reject_group[group] = atomicCAS(&d_reject_out[idx], 0, 0);
+        s_reject_group[group] = atomicCAS(&d_reject_out[proposal_idx], 0, 0);
         }
 
     // sync so that s_postype_group and s_orientation are available before other threads might
@@ -344,7 +356,7 @@ __launch_bounds__(max_threads)
         {
         // update reject flags in global mem
         if (s_reject_group[group])
-            atomicAdd(&d_reject_out[idx], 1);
+            atomicAdd(&d_reject_out[proposal_idx], 1);
         }
 
     if (master)
@@ -456,12 +468,15 @@ void narrow_phase_launcher(const hpmc_args_t& args,
 
         dim3 thread(overlap_threads, n_groups, tpp);
 
+        // check all proposals of each particle concurrently
+        const bool multiple_proposals = args.n_proposal > 1;
+
         for (int idev = args.gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
             {
             auto range = args.gpu_partition.getRangeAndSetGPU(idev);
 
             unsigned int nwork = range.second - range.first;
-            const unsigned int num_blocks = nwork / n_groups + 1;
+            const unsigned int num_blocks = nwork * args.n_proposal / n_groups + 1;
 
             dim3 grid(num_blocks, 1, 1);
 
@@ -502,12 +517,18 @@ void narrow_phase_launcher(const hpmc_args_t& args,
                                params,
                                args.d_update_order_by_ptl,
                                args.d_reject_in,
-                               args.d_reject_out,
-                               args.d_reject_out_of_cell,
+                               multiple_proposals ? args.d_proposal_reject_out : args.d_reject_out,
+                               multiple_proposals ? args.d_proposal_reject_out_of_cell
+                                                  : args.d_reject_out_of_cell,
                                max_extra_bytes,
                                max_queue_size,
                                range.first,
-                               nwork);
+                               nwork,
+                               args.n_proposal,
+                               args.proposal_pitch,
+                               multiple_proposals ? args.d_proposal_postype : args.d_trial_postype,
+                               multiple_proposals ? args.d_proposal_orientation
+                                                  : args.d_trial_orientation);
             }
         }
     else
@@ -518,6 +539,126 @@ void narrow_phase_launcher(const hpmc_args_t& args,
                                      detail::int2type<cur_launch_bounds / 2>());
         }
     }
+
+//! Count the overlaps between the particles in the current configuration
+/*! One thread tests one particle against all particles in its expanded cell. Each pair is counted
+    by the particle with the smaller tag only, so every overlap counts once, including overlaps
+    with ghosts that are also tested on the rank that owns the ghost. Threads stop once the count
+    on the device exceeds \a max_overlaps.
+
+    Each block first loads the shape parameters, including nested data such as the member trees
+    of unions, into shared memory so that the tree traversals for all pairs of the block read from
+    shared memory.
+*/
+template<class Shape>
+__global__ void hpmc_count_overlaps(const Scalar4* d_postype,
+                                    const Scalar4* d_orientation,
+                                    const unsigned int* d_tag,
+                                    const unsigned int* d_excell_idx,
+                                    const unsigned int* d_excell_size,
+                                    const Index2D excli,
+                                    const BoxDim box,
+                                    const Scalar3 ghost_width,
+                                    const uint3 cell_dim,
+                                    const Index3D ci,
+                                    const unsigned int* d_check_overlaps,
+                                    const Index2D overlap_idx,
+                                    const typename Shape::param_type* d_params,
+                                    unsigned int* d_overlap_count,
+                                    const unsigned int max_overlaps,
+                                    const unsigned int work_offset,
+                                    const unsigned int nwork,
+                                    const unsigned int max_extra_bytes)
+    {
+    const unsigned int num_types = overlap_idx.getW();
+
+    // load the per type pair parameters into shared memory
+    HIP_DYNAMIC_SHARED(char, s_data)
+    typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
+    unsigned int* s_check_overlaps = (unsigned int*)(s_params + num_types);
+
+        // copy over parameters one int per thread for fast loads
+        {
+        unsigned int param_size = num_types * sizeof(typename Shape::param_type) / sizeof(int);
+
+        for (unsigned int cur_offset = 0; cur_offset < param_size; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < param_size)
+                {
+                ((int*)s_params)[cur_offset + threadIdx.x]
+                    = ((int*)d_params)[cur_offset + threadIdx.x];
+                }
+            }
+
+        unsigned int ntyppairs = overlap_idx.getNumElements();
+
+        for (unsigned int cur_offset = 0; cur_offset < ntyppairs; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < ntyppairs)
+                {
+                s_check_overlaps[cur_offset + threadIdx.x]
+                    = d_check_overlaps[cur_offset + threadIdx.x];
+                }
+            }
+        }
+
+    __syncthreads();
+
+    // initialize extra shared mem, all threads take part because load_shared synchronizes
+    char* s_extra = (char*)(s_check_overlaps + overlap_idx.getNumElements());
+
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int cur_type = 0; cur_type < num_types; ++cur_type)
+        s_params[cur_type].load_shared(s_extra, available_bytes);
+
+    __syncthreads();
+
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (work_idx >= nwork)
+        return;
+    unsigned int idx = work_idx + work_offset;
+
+    // other threads may already have found enough overlaps, this race condition is intentional
+    if (atomicCAS(d_overlap_count, 0, 0) > max_overlaps)
+        return;
+
+    Scalar4 postype_i = d_postype[idx];
+    vec3<Scalar> pos_i(postype_i);
+    unsigned int type_i = __scalar_as_int(postype_i.w);
+    unsigned int tag_i = d_tag[idx];
+    Shape shape_i(quat<Scalar>(d_orientation[idx]), s_params[type_i]);
+
+    unsigned int my_cell
+        = computeParticleCell(vec_to_scalar3(pos_i), box, ghost_width, cell_dim, ci, false);
+    unsigned int excell_size = d_excell_size[my_cell];
+    unsigned int overlap_err_count = 0;
+
+    for (unsigned int k = 0; k < excell_size; k++)
+        {
+        unsigned int j = __ldg(&d_excell_idx[excli(k, my_cell)]);
+
+        // count each pair once
+        if (j == idx || tag_i >= d_tag[j])
+            continue;
+
+        Scalar4 postype_j = d_postype[j];
+        unsigned int type_j = __scalar_as_int(postype_j.w);
+        Shape shape_j(quat<Scalar>(d_orientation[j]), s_params[type_j]);
+
+        // put particle j into the coordinate system of particle i
+        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i;
+        r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(r_ij)));
+
+        if (s_check_overlaps[overlap_idx(type_i, type_j)]
+            && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+            && test_overlap(r_ij, shape_i, shape_j, overlap_err_count))
+            {
+            if (atomicAdd(d_overlap_count, 1) >= max_overlaps)
+                return;
+            }
+        }
+    }
+
     } // end namespace kernel
 
 //! Kernel driver for kernel::hpmc_narrow_phase
@@ -538,6 +679,82 @@ void hpmc_narrow_phase(const hpmc_args_t& args, const typename Shape::param_type
                                          launch_bounds,
                                          detail::int2type<MAX_BLOCK_SIZE / MIN_BLOCK_SIZE>());
     }
+
+//! Kernel driver for kernel::hpmc_count_overlaps
+template<class Shape>
+void hpmc_count_overlaps(const hpmc_count_overlaps_args_t& args,
+                         const typename Shape::param_type* params)
+    {
+    assert(args.d_postype);
+    assert(args.d_orientation);
+    assert(args.d_overlap_count);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(kernel::hpmc_count_overlaps<Shape>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(args.block_size, max_block_size);
+
+    const unsigned int num_types = args.overlap_idx.getW();
+    const size_t shared_bytes = num_types * sizeof(typename Shape::param_type)
+                                + args.overlap_idx.getNumElements() * sizeof(unsigned int);
+
+    if (shared_bytes + attr.sharedSizeBytes >= args.devprop.sharedMemPerBlock)
+        throw std::runtime_error("Insufficient shared memory for HPMC kernel: reduce number of "
+                                 "particle types or size of shape parameters");
+
+    // nested shape data, such as union member trees, fills the remaining shared memory
+    unsigned int max_extra_bytes = static_cast<unsigned int>(
+        args.devprop.sharedMemPerBlock - attr.sharedSizeBytes - shared_bytes);
+    char* ptr = (char*)nullptr;
+    unsigned int available_bytes = max_extra_bytes;
+    for (unsigned int i = 0; i < num_types; ++i)
+        {
+        params[i].allocate_shared(ptr, available_bytes);
+        }
+    unsigned int extra_bytes = max_extra_bytes - available_bytes;
+
+    // each GPU counts the overlaps of its particles separately
+    for (int idev = args.gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = args.gpu_partition.getRangeAndSetGPU(idev);
+        unsigned int nwork = range.second - range.first;
+        unsigned int* d_overlap_count = args.d_overlap_count + idev * args.overlap_count_pitch;
+
+        hipMemsetAsync(d_overlap_count, 0, sizeof(unsigned int));
+
+        if (nwork == 0)
+            continue;
+
+        dim3 grid(nwork / run_block_size + 1, 1, 1);
+        dim3 threads(run_block_size, 1, 1);
+
+        hipLaunchKernelGGL(HIP_KERNEL_NAME(kernel::hpmc_count_overlaps<Shape>),
+                           grid,
+                           threads,
+                           shared_bytes + extra_bytes,
+                           0,
+                           args.d_postype,
+                           args.d_orientation,
+                           args.d_tag,
+                           args.d_excell_idx,
+                           args.d_excell_size,
+                           args.excli,
+                           args.box,
+                           args.ghost_width,
+                           args.cell_dim,
+                           args.ci,
+                           args.d_check_overlaps,
+                           args.overlap_idx,
+                           params,
+                           d_overlap_count,
+                           args.max_overlaps,
+                           range.first,
+                           nwork,
+                           max_extra_bytes);
+        }
+    }
 #endif
 
 #undef MAX_BLOCK_SIZE
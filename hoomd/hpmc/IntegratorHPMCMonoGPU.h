@@ -166,6 +166,9 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
+    //! Count overlaps on the device, stopping once the count exceeds max_overlaps
+    virtual unsigned int countOverlapsUpTo(unsigned int max_overlaps);
+
 #ifdef ENABLE_MPI
     void setNtrialCommunicator(std::shared_ptr<MPIConfiguration> mpi_conf)
         {
@@ -184,6 +187,7 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     std::shared_ptr<CellList> m_cl; //!< Cell list
     uint3 m_last_dim;               //!< Dimensions of the cell list on the last call to update
     unsigned int m_last_nmax;       //!< Last cell list NMax value allocated in excell
+    uint64_t m_last_timestep;       //!< Timestep of the last call to update
 
     GlobalArray<unsigned int> m_excell_idx;  //!< Particle indices in expanded cells
     GlobalArray<unsigned int> m_excell_size; //!< Number of particles in each expanded cell
@@ -204,12 +208,15 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     /// Autotuner for convergence check.
     std::shared_ptr<Autotuner<1>> m_tuner_convergence;
 
+    /// Autotuner for selecting one of multiple proposals.
+    std::shared_ptr<Autotuner<1>> m_tuner_select_proposal;
+
+    /// Autotuner for counting overlaps.
+    std::shared_ptr<Autotuner<1>> m_tuner_count_overlaps;
+
     /// Autotuner for inserting depletants.
     std::shared_ptr<Autotuner<3>> m_tuner_depletants;
 
-    /// Autotuner for calculating number of depletants.
-    std::shared_ptr<Autotuner<1>> m_tuner_num_depletants;
-
     /// Autotuner for calculating number of depletants with ntrial.
     std::shared_ptr<Autotuner<1>> m_tuner_num_depletants_ntrial;
 
@@ -232,7 +239,14 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     GlobalArray<unsigned int>
         m_reject_out; //!< Flags to reject particle moves, per particle (temporary)
 
-    GlobalArray<unsigned int> m_n_depletants; //!< List of number of depletants, per particle
+    GlobalArray<Scalar4> m_proposal_postype;     //!< Positions of all proposals, with pitch maxN
+    GlobalArray<Scalar4> m_proposal_orientation; //!< Orientations of all proposals
+    GlobalArray<unsigned int> m_proposal_move_type; //!< Move types of all proposals
+    GlobalArray<unsigned int>
+        m_proposal_reject_out_of_cell;          //!< Flags to reject proposals that leave the cell
+    GlobalArray<unsigned int> m_proposal_reject; //!< Reject flags of all proposals
+    GlobalArray<unsigned int> m_proposal_select; //!< Selected proposal, per particle
+
     GlobalArray<unsigned int>
         m_n_depletants_ntrial; //!< List of number of depletants, per particle, trial insertion and
                                //!< configuration:w
@@ -248,6 +262,7 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
     GlobalArray<Scalar> m_additive_cutoff; //!< Per-type additive cutoffs from patch potential
 
     GlobalArray<hpmc_counters_t> m_counters; //!< Per-device counters
+    GlobalArray<unsigned int> m_overlap_count; //!< Per-device overlap counts of countOverlapsUpTo
     GlobalArray<hpmc_implicit_counters_t>
         m_implicit_counters; //!< Per-device counters for depletants
 
@@ -270,16 +285,24 @@ template<class Shape> class IntegratorHPMCMonoGPU : public IntegratorHPMCMono<Sh
 #endif
 
     //!< Variables for implicit depletants
-    GlobalArray<Scalar> m_lambda; //!< Poisson means, per type pair
+    GlobalArray<Scalar> m_lambda;     //!< Poisson means, per type pair
+    std::vector<Scalar> m_max_lambda; //!< Largest Poisson mean of any particle type, per depletant
+                                      //!< type
 
     //! Set up excell_list
     virtual void initializeExcellMem();
 
+    //! Build the cell list and the expanded cells for the current configuration
+    void updateExpandedCells(uint64_t timestep);
+
     //! Set the nominal width appropriate for looped moves
     virtual void updateCellWidth();
 
     //! Update GPU memory hints
     virtual void updateGPUAdvice();
+
+    //! Scale the local particle positions from \a old_box to \a new_box on the device
+    virtual void scaleParticlePositions(const BoxDim& old_box, const BoxDim& new_box);
     };
 
 template<class Shape>
@@ -298,6 +321,7 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     // set last dim to a bogus value so that it will re-init on the first call
     m_last_dim = make_uint3(0xffffffff, 0xffffffff, 0xffffffff);
     m_last_nmax = 0xffffffff;
+    m_last_timestep = 0;
 
     m_tuner_moves.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                          this->m_exec_conf,
@@ -313,12 +337,10 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                          this->m_exec_conf,
                          "hpmc_excell_block_size"));
 
-    m_tuner_num_depletants.reset(
+    m_tuner_count_overlaps.reset(
         new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                          this->m_exec_conf,
-                         "hpmc_num_depletants",
-                         5,
-                         true));
+                         "hpmc_count_overlaps"));
 
     m_tuner_num_depletants_ntrial.reset(
         new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
@@ -361,6 +383,11 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                          this->m_exec_conf,
                          "hpmc_convergence"));
 
+    m_tuner_select_proposal.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "hpmc_select_proposal"));
+
     m_tuner_depletants_accept.reset(
         new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                          this->m_exec_conf,
@@ -416,9 +443,10 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
                               {m_tuner_moves,
                                m_tuner_update_pdata,
                                m_tuner_excell_block_size,
-                               m_tuner_num_depletants,
+                               m_tuner_count_overlaps,
                                m_tuner_num_depletants_ntrial,
                                m_tuner_convergence,
+                               m_tuner_select_proposal,
                                m_tuner_depletants_accept,
                                m_tuner_depletants,
                                m_tuner_depletants_phase1,
@@ -447,6 +475,24 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_reject_out);
     TAG_ALLOCATION(m_reject_out);
 
+    GlobalArray<Scalar4>(1, this->m_exec_conf).swap(m_proposal_postype);
+    TAG_ALLOCATION(m_proposal_postype);
+
+    GlobalArray<Scalar4>(1, this->m_exec_conf).swap(m_proposal_orientation);
+    TAG_ALLOCATION(m_proposal_orientation);
+
+    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_proposal_move_type);
+    TAG_ALLOCATION(m_proposal_move_type);
+
+    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_proposal_reject_out_of_cell);
+    TAG_ALLOCATION(m_proposal_reject_out_of_cell);
+
+    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_proposal_reject);
+    TAG_ALLOCATION(m_proposal_reject);
+
+    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_proposal_select);
+    TAG_ALLOCATION(m_proposal_select);
+
     GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_condition);
     TAG_ALLOCATION(m_condition);
 
@@ -493,8 +539,6 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     m_excell_idx.swap(excell_idx);
     TAG_ALLOCATION(m_excell_idx);
 
-    GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_n_depletants);
-    TAG_ALLOCATION(m_n_depletants);
 
     GlobalArray<unsigned int>(1, this->m_exec_conf).swap(m_n_depletants_ntrial);
     TAG_ALLOCATION(m_n_depletants_ntrial);
@@ -528,6 +572,31 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
         }
 #endif
 
+    // one overlap count per GPU, separated by an entire memory page
+    pitch = (unsigned int)((getpagesize() + sizeof(unsigned int) - 1) / sizeof(unsigned int));
+    GlobalArray<unsigned int>(pitch, this->m_exec_conf->getNumActiveGPUs(), this->m_exec_conf)
+        .swap(m_overlap_count);
+    TAG_ALLOCATION(m_overlap_count);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    if (this->m_exec_conf->allConcurrentManagedAccess())
+        {
+        // set memory hints
+        auto gpu_map = this->m_exec_conf->getGPUIds();
+        for (unsigned int idev = 0; idev < this->m_exec_conf->getNumActiveGPUs(); ++idev)
+            {
+            cudaMemAdvise(m_overlap_count.get() + idev * m_overlap_count.getPitch(),
+                          sizeof(unsigned int) * m_overlap_count.getPitch(),
+                          cudaMemAdviseSetPreferredLocation,
+                          gpu_map[idev]);
+            cudaMemPrefetchAsync(m_overlap_count.get() + idev * m_overlap_count.getPitch(),
+                                 sizeof(unsigned int) * m_overlap_count.getPitch(),
+                                 gpu_map[idev]);
+            }
+        CHECK_CUDA_ERROR();
+        }
+#endif
+
     // ntypes counters per GPU, separated by at least a memory page
     pitch = (unsigned int)((getpagesize() + sizeof(hpmc_implicit_counters_t) - 1)
                            / sizeof(hpmc_implicit_counters_t));
@@ -568,6 +637,7 @@ IntegratorHPMCMonoGPU<Shape>::IntegratorHPMCMonoGPU(std::shared_ptr<SystemDefini
     GlobalArray<Scalar> lambda(ntypes * ntypes, this->m_exec_conf);
     m_lambda.swap(lambda);
     TAG_ALLOCATION(m_lambda);
+    m_max_lambda.resize(ntypes, Scalar(0.0));
 
     m_depletant_streams.resize(ntypes);
     m_depletant_streams_phase1.resize(ntypes);
@@ -764,14 +834,6 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateGPUAdvice()
                     {
                     continue;
                     }
-                cudaMemAdvise(m_n_depletants.get() + itype + range.first,
-                              sizeof(unsigned int) * nelem,
-                              cudaMemAdviseSetPreferredLocation,
-                              gpu_map[idev]);
-                cudaMemPrefetchAsync(m_n_depletants.get() + itype + range.first,
-                                     sizeof(unsigned int) * nelem,
-                                     gpu_map[idev]);
-
                 unsigned int ntrial = this->m_ntrial[itype];
                 if (ntrial == 0)
                     {
@@ -804,6 +866,7 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateGPUAdvice()
 template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timestep)
     {
     IntegratorHPMC::update(timestep);
+    m_last_timestep = timestep;
 
     if (this->m_patch)
         {
@@ -892,12 +955,6 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
             update_gpu_advice = true;
             }
 
-        if (m_n_depletants.getNumElements() < this->m_pdata->getMaxN() * this->m_pdata->getNTypes())
-            {
-            m_n_depletants.resize(this->m_pdata->getMaxN() * this->m_pdata->getNTypes());
-            update_gpu_advice = true;
-            }
-
         // resize data structures for depletants with ntrial > 0
         bool have_auxilliary_variables = false;
         bool have_depletants = false;
@@ -960,6 +1017,24 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
             update_gpu_advice = true;
             }
 
+        // depletants and patch energies evaluate only the selected trial move of every particle
+        const unsigned int nproposal
+            = (this->m_patch || have_depletants) ? 1 : this->m_nproposal;
+        const unsigned int proposal_pitch = this->m_pdata->getMaxN();
+        if (nproposal > 1
+            && m_proposal_postype.getNumElements() < (size_t)nproposal * proposal_pitch)
+            {
+            m_proposal_postype.resize(nproposal * proposal_pitch);
+            m_proposal_orientation.resize(nproposal * proposal_pitch);
+            m_proposal_move_type.resize(nproposal * proposal_pitch);
+            m_proposal_reject_out_of_cell.resize(nproposal * proposal_pitch);
+            m_proposal_reject.resize(nproposal * proposal_pitch);
+            }
+        if (nproposal > 1 && m_proposal_select.getNumElements() < proposal_pitch)
+            {
+            m_proposal_select.resize(proposal_pitch);
+            }
+
         if (update_gpu_advice)
             updateGPUAdvice();
 
@@ -1089,6 +1164,21 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                                             access_location::device,
                                                             access_mode::overwrite);
 
+                // access data for all proposals
+                ArrayHandle<Scalar4> d_proposal_postype(m_proposal_postype,
+                                                        access_location::device,
+                                                        access_mode::overwrite);
+                ArrayHandle<Scalar4> d_proposal_orientation(m_proposal_orientation,
+                                                            access_location::device,
+                                                            access_mode::overwrite);
+                ArrayHandle<unsigned int> d_proposal_move_type(m_proposal_move_type,
+                                                               access_location::device,
+                                                               access_mode::overwrite);
+                ArrayHandle<unsigned int> d_proposal_reject_out_of_cell(
+                    m_proposal_reject_out_of_cell,
+                    access_location::device,
+                    access_mode::overwrite);
+
                 // access the particle data
                 ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
                                                access_location::device,
@@ -1151,6 +1241,17 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                       this->m_pdata->getGPUPartition(),
                                       0);
 
+                if (nproposal > 1)
+                    {
+                    // write all proposals, the first one is copied to the trial arrays below
+                    args.d_reject_out_of_cell = d_proposal_reject_out_of_cell.data;
+                    args.d_trial_postype = d_proposal_postype.data;
+                    args.d_trial_orientation = d_proposal_orientation.data;
+                    args.d_trial_move_type = d_proposal_move_type.data;
+                    args.n_proposal = nproposal;
+                    args.proposal_pitch = proposal_pitch;
+                    }
+
                 // propose trial moves, \sa gpu::kernel::hpmc_moves
 
                 // reset acceptance results and move types
@@ -1164,6 +1265,85 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
 
             bool converged = false;
 
+            if (nproposal > 1)
+                {
+                // start from the first proposal of every particle
+                ArrayHandle<Scalar4> d_proposal_postype(m_proposal_postype,
+                                                        access_location::device,
+                                                        access_mode::read);
+                ArrayHandle<Scalar4> d_proposal_orientation(m_proposal_orientation,
+                                                            access_location::device,
+                                                            access_mode::read);
+                ArrayHandle<unsigned int> d_proposal_move_type(m_proposal_move_type,
+                                                               access_location::device,
+                                                               access_mode::read);
+                ArrayHandle<unsigned int> d_proposal_reject_out_of_cell(
+                    m_proposal_reject_out_of_cell,
+                    access_location::device,
+                    access_mode::read);
+                ArrayHandle<unsigned int> d_proposal_reject(m_proposal_reject,
+                                                            access_location::device,
+                                                            access_mode::overwrite);
+                ArrayHandle<unsigned int> d_proposal_select(m_proposal_select,
+                                                            access_location::device,
+                                                            access_mode::overwrite);
+                ArrayHandle<Scalar4> d_trial_postype(m_trial_postype,
+                                                     access_location::device,
+                                                     access_mode::overwrite);
+                ArrayHandle<Scalar4> d_trial_orientation(m_trial_orientation,
+                                                         access_location::device,
+                                                         access_mode::overwrite);
+                ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                            access_location::device,
+                                                            access_mode::overwrite);
+                ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                               access_location::device,
+                                                               access_mode::overwrite);
+
+                this->m_exec_conf->beginMultiGPU();
+                for (int idev = this->m_exec_conf->getNumActiveGPUs() - 1; idev >= 0; --idev)
+                    {
+                    hipSetDevice(this->m_exec_conf->getGPUIds()[idev]);
+
+                    auto range = this->m_pdata->getGPUPartition().getRange(idev);
+                    unsigned int nwork = range.second - range.first;
+                    if (nwork != 0)
+                        {
+                        hipMemcpyAsync(d_trial_postype.data + range.first,
+                                       d_proposal_postype.data + range.first,
+                                       sizeof(Scalar4) * nwork,
+                                       hipMemcpyDeviceToDevice);
+                        hipMemcpyAsync(d_trial_orientation.data + range.first,
+                                       d_proposal_orientation.data + range.first,
+                                       sizeof(Scalar4) * nwork,
+                                       hipMemcpyDeviceToDevice);
+                        hipMemcpyAsync(d_trial_move_type.data + range.first,
+                                       d_proposal_move_type.data + range.first,
+                                       sizeof(unsigned int) * nwork,
+                                       hipMemcpyDeviceToDevice);
+                        hipMemcpyAsync(d_reject_out_of_cell.data + range.first,
+                                       d_proposal_reject_out_of_cell.data + range.first,
+                                       sizeof(unsigned int) * nwork,
+                                       hipMemcpyDeviceToDevice);
+                        for (unsigned int p = 0; p < nproposal; ++p)
+                            {
+                            hipMemcpyAsync(
+                                d_proposal_reject.data + p * proposal_pitch + range.first,
+                                d_proposal_reject_out_of_cell.data + p * proposal_pitch
+                                    + range.first,
+                                sizeof(unsigned int) * nwork,
+                                hipMemcpyDeviceToDevice);
+                            }
+                        hipMemsetAsync(d_proposal_select.data + range.first,
+                                       0,
+                                       sizeof(unsigned int) * nwork);
+                        }
+                    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                        CHECK_CUDA_ERROR();
+                    }
+                this->m_exec_conf->endMultiGPU();
+                }
+
                 {
                 // initialize reject flags
                 ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
@@ -1317,13 +1497,25 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                         access_mode::readwrite);
 
                     // depletants
-                    ArrayHandle<unsigned int> d_n_depletants(m_n_depletants,
-                                                             access_location::device,
-                                                             access_mode::overwrite);
                     ArrayHandle<unsigned int> d_n_depletants_ntrial(m_n_depletants_ntrial,
                                                                     access_location::device,
                                                                     access_mode::overwrite);
 
+                    // access data for all proposals
+                    ArrayHandle<Scalar4> d_proposal_postype(m_proposal_postype,
+                                                            access_location::device,
+                                                            access_mode::read);
+                    ArrayHandle<Scalar4> d_proposal_orientation(m_proposal_orientation,
+                                                                access_location::device,
+                                                                access_mode::read);
+                    ArrayHandle<unsigned int> d_proposal_reject_out_of_cell(
+                        m_proposal_reject_out_of_cell,
+                        access_location::device,
+                        access_mode::read);
+                    ArrayHandle<unsigned int> d_proposal_reject(m_proposal_reject,
+                                                                access_location::device,
+                                                                access_mode::readwrite);
+
                     // fill the parameter structure for the GPU kernels
                     gpu::hpmc_args_t args(d_postype.data,
                                           d_orientation.data,
@@ -1367,6 +1559,17 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                           this->m_pdata->getGPUPartition(),
                                           &m_narrow_phase_streams.front());
 
+                    if (nproposal > 1)
+                        {
+                        // check every proposal of i against the selected moves of the others
+                        args.n_proposal = nproposal;
+                        args.proposal_pitch = proposal_pitch;
+                        args.d_proposal_postype = d_proposal_postype.data;
+                        args.d_proposal_orientation = d_proposal_orientation.data;
+                        args.d_proposal_reject_out = d_proposal_reject.data;
+                        args.d_proposal_reject_out_of_cell = d_proposal_reject_out_of_cell.data;
+                        }
+
                     /*
                      *  check overlaps, new configuration simultaneously against the old and the new
                      * configuration
@@ -1401,36 +1604,15 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                         unsigned int ntrial = h_ntrial.data[itype];
                         if (!ntrial)
                             {
-                            // draw random number of depletant insertions per particle from
-                            // Poisson distribution
-                            m_tuner_num_depletants->begin();
-                            gpu::generate_num_depletants(this->m_sysdef->getSeed(),
-                                                         timestep,
-                                                         i,
-                                                         this->m_exec_conf->getRank(),
-                                                         itype,
-                                                         d_lambda.data,
-                                                         d_postype.data,
-                                                         d_n_depletants.data
-                                                             + itype * this->m_pdata->getMaxN(),
-                                                         m_tuner_num_depletants->getParam()[0],
-                                                         &m_depletant_streams[itype].front(),
-                                                         this->m_pdata->getGPUPartition(),
-                                                         this->m_pdata->getNTypes());
-                            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-                                CHECK_CUDA_ERROR();
-                            m_tuner_num_depletants->end();
-
-                            // max reduce over result
-                            unsigned int max_n_depletants[this->m_exec_conf->getNumActiveGPUs()];
-                            gpu::get_max_num_depletants(
-                                d_n_depletants.data + itype * this->m_pdata->getMaxN(),
-                                &max_n_depletants[0],
-                                &m_depletant_streams[itype].front(),
-                                this->m_pdata->getGPUPartition(),
-                                this->m_exec_conf->getCachedAllocatorManaged());
-                            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
-                                CHECK_CUDA_ERROR();
+                            // the kernel draws the number of depletant insertions per particle
+                            // from the Poisson distribution, size the grid for the expected
+                            // maximum so that the stride loop rarely needs to make a second pass
+                            Scalar lambda_max = m_max_lambda[itype];
+                            unsigned int n_expected = static_cast<unsigned int>(
+                                lambda_max + Scalar(3.0) * slow::sqrt(lambda_max));
+                            std::vector<unsigned int> max_n_depletants(
+                                this->m_exec_conf->getNumActiveGPUs(),
+                                n_expected);
 
                             // insert depletants on-the-fly
                             m_tuner_depletants->begin();
@@ -1445,10 +1627,11 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                                          : d_implicit_count.data,
                                 (unsigned int)m_implicit_counters.getPitch(),
                                 h_fugacity.data[itype] < 0,
-                                d_n_depletants.data + itype * this->m_pdata->getMaxN(),
+                                nullptr,
                                 &max_n_depletants[0],
                                 depletants_per_thread,
-                                &m_depletant_streams[itype].front());
+                                &m_depletant_streams[itype].front(),
+                                d_lambda.data);
                             gpu::hpmc_insert_depletants<Shape>(args, implicit_args, params.data());
                             if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
                                 CHECK_CUDA_ERROR();
@@ -1712,6 +1895,72 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
                     this->m_exec_conf->endMultiGPU();
                     }
 
+                if (nproposal > 1)
+                    {
+                    // select the first acceptable proposal of every particle
+                    ArrayHandle<Scalar4> d_proposal_postype(m_proposal_postype,
+                                                            access_location::device,
+                                                            access_mode::read);
+                    ArrayHandle<Scalar4> d_proposal_orientation(m_proposal_orientation,
+                                                                access_location::device,
+                                                                access_mode::read);
+                    ArrayHandle<unsigned int> d_proposal_move_type(m_proposal_move_type,
+                                                                   access_location::device,
+                                                                   access_mode::read);
+                    ArrayHandle<unsigned int> d_proposal_reject_out_of_cell(
+                        m_proposal_reject_out_of_cell,
+                        access_location::device,
+                        access_mode::read);
+                    ArrayHandle<unsigned int> d_proposal_reject(m_proposal_reject,
+                                                                access_location::device,
+                                                                access_mode::readwrite);
+                    ArrayHandle<unsigned int> d_proposal_select(m_proposal_select,
+                                                                access_location::device,
+                                                                access_mode::readwrite);
+                    ArrayHandle<Scalar4> d_trial_postype(m_trial_postype,
+                                                         access_location::device,
+                                                         access_mode::readwrite);
+                    ArrayHandle<Scalar4> d_trial_orientation(m_trial_orientation,
+                                                             access_location::device,
+                                                             access_mode::readwrite);
+                    ArrayHandle<unsigned int> d_trial_move_type(m_trial_move_type,
+                                                                access_location::device,
+                                                                access_mode::readwrite);
+                    ArrayHandle<unsigned int> d_reject_out_of_cell(m_reject_out_of_cell,
+                                                                   access_location::device,
+                                                                   access_mode::readwrite);
+                    ArrayHandle<unsigned int> d_reject_out(m_reject_out,
+                                                           access_location::device,
+                                                           access_mode::readwrite);
+                    ArrayHandle<unsigned int> d_condition(m_condition,
+                                                          access_location::device,
+                                                          access_mode::readwrite);
+
+                    this->m_exec_conf->beginMultiGPU();
+                    m_tuner_select_proposal->begin();
+                    gpu::hpmc_select_proposal(d_proposal_postype.data,
+                                              d_proposal_orientation.data,
+                                              d_proposal_move_type.data,
+                                              d_proposal_reject_out_of_cell.data,
+                                              d_proposal_reject.data,
+                                              nproposal,
+                                              proposal_pitch,
+                                              d_d.data,
+                                              d_trial_postype.data,
+                                              d_trial_orientation.data,
+                                              d_trial_move_type.data,
+                                              d_reject_out_of_cell.data,
+                                              d_reject_out.data,
+                                              d_proposal_select.data,
+                                              d_condition.data,
+                                              this->m_pdata->getGPUPartition(),
+                                              m_tuner_select_proposal->getParam()[0]);
+                    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                        CHECK_CUDA_ERROR();
+                    m_tuner_select_proposal->end();
+                    this->m_exec_conf->endMultiGPU();
+                    }
+
                 if (this->m_patch)
                     {
                     // access data for proposed moves
@@ -1965,8 +2214,14 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::update(uint64_t timeste
 
     this->communicate(true);
 
-    // all particle have been moved, the aabb tree is now invalid
-    this->m_aabb_tree_invalid = true;
+    // all particle have been moved, the aabb tree is now invalid. Host side updaters (such as
+    // UpdaterMuVT) that query the tree between steps may refit it to the new positions when
+    // communicate() did not change the particle indices.
+    if (!this->m_aabb_tree_invalid)
+        {
+        this->m_aabb_tree_invalid = true;
+        this->m_aabb_tree_refit = true;
+        }
 
     // set current MPS value
     hpmc_counters_t run_counters = this->getCounters(1);
@@ -2077,6 +2332,207 @@ template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateCellWidth()
                 }
             }
         }
+
+    // the largest mean of each depletant type sizes the insertion grid
+    for (unsigned int i_type = 0; i_type < this->m_pdata->getNTypes(); ++i_type)
+        {
+        m_max_lambda[i_type] = Scalar(0.0);
+        for (unsigned int k_type = 0; k_type < this->m_pdata->getNTypes(); ++k_type)
+            {
+            m_max_lambda[i_type]
+                = std::max(m_max_lambda[i_type],
+                           h_lambda.data[k_type * this->m_pdata->getNTypes() + i_type]);
+            }
+        }
+    }
+
+/*! \param old_box Box the particles are currently in
+    \param new_box Box to scale the particles into
+*/
+/*! \param timestep Current time step
+
+    The cell list only caches its result per time step, so it is always rebuilt here: the caller
+    may have moved the particles since the last update.
+*/
+template<class Shape> void IntegratorHPMCMonoGPU<Shape>::updateExpandedCells(uint64_t timestep)
+    {
+    this->m_cl->forceCompute(timestep);
+
+    // if the cell list is a different size than last time, reinitialize the expanded cell list
+    uint3 cur_dim = this->m_cl->getDim();
+    if (m_last_dim.x != cur_dim.x || m_last_dim.y != cur_dim.y || m_last_dim.z != cur_dim.z
+        || m_last_nmax != this->m_cl->getNmax())
+        {
+        initializeExcellMem();
+
+        m_last_dim = cur_dim;
+        m_last_nmax = this->m_cl->getNmax();
+        }
+
+    ArrayHandle<unsigned int> d_cell_size(this->m_cl->getCellSizeArray(),
+                                          access_location::device,
+                                          access_mode::read);
+    ArrayHandle<unsigned int> d_cell_idx(this->m_cl->getIndexArray(),
+                                         access_location::device,
+                                         access_mode::read);
+    ArrayHandle<unsigned int> d_cell_adj(this->m_cl->getCellAdjArray(),
+                                         access_location::device,
+                                         access_mode::read);
+
+    // per-device cell list data
+    const ArrayHandle<unsigned int>& d_cell_size_per_device
+        = m_cl->getPerDevice() ? ArrayHandle<unsigned int>(m_cl->getCellSizeArrayPerDevice(),
+                                                           access_location::device,
+                                                           access_mode::read)
+                               : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                                           access_location::device,
+                                                           access_mode::read);
+    const ArrayHandle<unsigned int>& d_cell_idx_per_device
+        = m_cl->getPerDevice() ? ArrayHandle<unsigned int>(m_cl->getIndexArrayPerDevice(),
+                                                           access_location::device,
+                                                           access_mode::read)
+                               : ArrayHandle<unsigned int>(GlobalArray<unsigned int>(),
+                                                           access_location::device,
+                                                           access_mode::read);
+
+    ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                           access_location::device,
+                                           access_mode::overwrite);
+    ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                            access_location::device,
+                                            access_mode::overwrite);
+
+    this->m_tuner_excell_block_size->begin();
+    gpu::hpmc_excell(d_excell_idx.data,
+                     d_excell_size.data,
+                     m_excell_list_indexer,
+                     m_cl->getPerDevice() ? d_cell_idx_per_device.data : d_cell_idx.data,
+                     m_cl->getPerDevice() ? d_cell_size_per_device.data : d_cell_size.data,
+                     d_cell_adj.data,
+                     this->m_cl->getCellIndexer(),
+                     this->m_cl->getCellListIndexer(),
+                     this->m_cl->getCellAdjIndexer(),
+                     this->m_exec_conf->getNumActiveGPUs(),
+                     this->m_tuner_excell_block_size->getParam()[0]);
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    this->m_tuner_excell_block_size->end();
+    }
+
+/*! \param max_overlaps stop counting once more than this many overlaps are found
+    \returns number of overlaps, which is larger than \a max_overlaps when counting stopped early
+
+    Count the overlaps with the expanded cells on the device, so that callers like
+    UpdaterQuickCompress do not copy the particle data to the host. Only the per-device counts
+    are read back. Boxes too small for the minimum image convention fall back to the host
+    implementation.
+*/
+template<class Shape>
+unsigned int IntegratorHPMCMonoGPU<Shape>::countOverlapsUpTo(unsigned int max_overlaps)
+    {
+    BoxDim global_box = this->m_pdata->getGlobalBox();
+    Scalar3 nearest_plane_distance = global_box.getNearestPlaneDistance();
+    if ((global_box.getPeriodic().x && nearest_plane_distance.x <= this->m_nominal_width * 2)
+        || (global_box.getPeriodic().y && nearest_plane_distance.y <= this->m_nominal_width * 2)
+        || (this->m_sysdef->getNDimensions() == 3 && global_box.getPeriodic().z
+            && nearest_plane_distance.z <= this->m_nominal_width * 2))
+        {
+        return IntegratorHPMCMono<Shape>::countOverlapsUpTo(max_overlaps);
+        }
+
+    unsigned int overlap_count = 0;
+    if (this->m_pdata->getN() > 0)
+        {
+        updateExpandedCells(m_last_timestep);
+
+            {
+            ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::read);
+            ArrayHandle<Scalar4> d_orientation(this->m_pdata->getOrientationArray(),
+                                               access_location::device,
+                                               access_mode::read);
+            ArrayHandle<unsigned int> d_tag(this->m_pdata->getTags(),
+                                            access_location::device,
+                                            access_mode::read);
+            ArrayHandle<unsigned int> d_excell_idx(m_excell_idx,
+                                                   access_location::device,
+                                                   access_mode::read);
+            ArrayHandle<unsigned int> d_excell_size(m_excell_size,
+                                                    access_location::device,
+                                                    access_mode::read);
+            ArrayHandle<unsigned int> d_overlaps(this->m_overlaps,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_overlap_count(m_overlap_count,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+
+            auto& params = this->getParams();
+
+            this->m_tuner_count_overlaps->begin();
+            gpu::hpmc_count_overlaps_args_t args(d_postype.data,
+                                                 d_orientation.data,
+                                                 d_tag.data,
+                                                 d_excell_idx.data,
+                                                 d_excell_size.data,
+                                                 m_excell_list_indexer,
+                                                 this->m_pdata->getBox(),
+                                                 this->m_cl->getGhostWidth(),
+                                                 this->m_cl->getDim(),
+                                                 this->m_cl->getCellIndexer(),
+                                                 d_overlaps.data,
+                                                 this->m_overlap_idx,
+                                                 d_overlap_count.data,
+                                                 (unsigned int)m_overlap_count.getPitch(),
+                                                 max_overlaps,
+                                                 this->m_tuner_count_overlaps->getParam()[0],
+                                                 this->m_exec_conf->dev_prop,
+                                                 this->m_pdata->getGPUPartition());
+            gpu::hpmc_count_overlaps<Shape>(args, params.data());
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            this->m_tuner_count_overlaps->end();
+            }
+
+        this->m_exec_conf->multiGPUBarrier();
+
+        ArrayHandle<unsigned int> h_overlap_count(m_overlap_count,
+                                                  access_location::host,
+                                                  access_mode::read);
+        for (unsigned int idev = 0; idev < this->m_exec_conf->getNumActiveGPUs(); ++idev)
+            overlap_count += h_overlap_count.data[idev * m_overlap_count.getPitch()];
+        }
+
+#ifdef ENABLE_MPI
+    if (this->m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &overlap_count,
+                      1,
+                      MPI_UNSIGNED,
+                      MPI_SUM,
+                      this->m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return overlap_count;
+    }
+
+template<class Shape>
+void IntegratorHPMCMonoGPU<Shape>::scaleParticlePositions(const BoxDim& old_box,
+                                                          const BoxDim& new_box)
+    {
+    if (this->m_pdata->getN() > 0)
+        {
+        ArrayHandle<Scalar4> d_postype(this->m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+
+        gpu::hpmc_scale(d_postype.data, this->m_pdata->getN(), old_box, new_box, 128);
+        }
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
     }
 
 namespace detail
@@ -79,7 +79,9 @@ __launch_bounds__(max_threads)
                                            bool repulsive,
                                            unsigned int work_offset,
                                            unsigned int max_depletant_queue_size,
-                                           const unsigned int* d_n_depletants)
+                                           const unsigned int* d_n_depletants,
+                                           const Scalar* d_lambda,
+                                           const unsigned int rank)
     {
     // variables to tell what type of thread we are
     unsigned int group = threadIdx.z;
@@ -110,6 +112,9 @@ __launch_bounds__(max_threads)
     // per particle reject flag
     __shared__ unsigned int s_reject;
 
+    // number of depletants to insert for this particle
+    __shared__ unsigned int s_n_depletants;
+
     // load the per type pair parameters into shared memory
     HIP_DYNAMIC_SHARED(char, s_data)
     typename Shape::param_type* s_params = (typename Shape::param_type*)(&s_data[0]);
@@ -183,6 +188,21 @@ __launch_bounds__(max_threads)
 
         s_orientation_i_new = d_trial_orientation[i];
         s_orientation_i_old = d_orientation[i];
+
+        if (d_lambda)
+            {
+            // generate random number of depletants from Poisson distribution, with the same
+            // stream as generate_num_depletants
+            hoomd::RandomGenerator rng_poisson(
+                hoomd::Seed(hoomd::RNGIdentifier::HPMCDepletantNum, timestep, seed),
+                hoomd::Counter(i, rank, depletant_type_a, static_cast<uint16_t>(select)));
+            s_n_depletants = hoomd::PoissonDistribution<Scalar>(
+                d_lambda[s_type_i * num_types + depletant_type_a])(rng_poisson);
+            }
+        else
+            {
+            s_n_depletants = d_n_depletants[i];
+            }
         }
 
     if (master && group == 0)
@@ -195,8 +215,7 @@ __launch_bounds__(max_threads)
     // sync so that s_pos_i_old etc. are available
     __syncthreads();
 
-    // generate random number of depletants from Poisson distribution
-    unsigned int n_depletants = d_n_depletants[i];
+    unsigned int n_depletants = s_n_depletants;
 
     unsigned int overlap_checks = 0;
 
@@ -675,7 +694,7 @@ void depletants_launcher(const hpmc_args_t& args,
             assert(args.d_update_order_by_ptl);
             assert(args.d_reject_in);
             assert(args.d_reject_out);
-            assert(implicit_args.d_n_depletants);
+            assert(implicit_args.d_n_depletants || implicit_args.d_lambda);
 
             hipLaunchKernelGGL(
                 (kernel::hpmc_insert_depletants<Shape, launch_bounds_nonzero * MIN_BLOCK_SIZE>),
@@ -716,7 +735,9 @@ void depletants_launcher(const hpmc_args_t& args,
                 implicit_args.repulsive,
                 range.first,
                 max_depletant_queue_size,
-                implicit_args.d_n_depletants);
+                implicit_args.d_n_depletants,
+                implicit_args.d_lambda,
+                args.rank);
             }
         }
     else
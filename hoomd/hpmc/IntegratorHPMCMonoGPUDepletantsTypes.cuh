@@ -33,11 +33,13 @@ struct hpmc_implicit_args_t
                          const unsigned int* _d_n_depletants,
                          const unsigned int* _max_n_depletants,
                          const unsigned int _depletants_per_thread,
-                         const hipStream_t* _streams)
+                         const hipStream_t* _streams,
+                         const Scalar* _d_lambda = nullptr)
         : depletant_type_a(_depletant_type_a), d_implicit_count(_d_implicit_count),
           implicit_counters_pitch(_implicit_counters_pitch), repulsive(_repulsive),
           d_n_depletants(_d_n_depletants), max_n_depletants(_max_n_depletants),
-          depletants_per_thread(_depletants_per_thread), streams(_streams) {};
+          depletants_per_thread(_depletants_per_thread), streams(_streams),
+          d_lambda(_d_lambda) {};
 
     const unsigned int depletant_type_a;        //!< Particle type of first depletant
     hpmc_implicit_counters_t* d_implicit_count; //!< Active cell acceptance/rejection counts
@@ -45,10 +47,13 @@ struct hpmc_implicit_args_t
     const bool repulsive;                       //!< True if the fugacity is negative
     const unsigned int* d_n_depletants;         //!< Number of depletants per particle
     const unsigned int*
-        max_n_depletants; //!< Maximum number of depletants inserted per particle, per device
+        max_n_depletants; //!< Maximum (or, with d_lambda, expected maximum) number of depletants
+                          //!< inserted per particle, per device
     unsigned int depletants_per_thread; //!< Controls parallelism (number of depletant loop
                                         //!< iterations per group)
     const hipStream_t* streams;         //!< Stream for this depletant type
+    const Scalar* d_lambda; //!< Poisson means per type pair. When set, hpmc_insert_depletants
+                            //!< draws the number of depletants and ignores d_n_depletants
     };
 
 //! Driver for kernel::hpmc_insert_depletants()
@@ -29,6 +29,9 @@ namespace gpu
 namespace kernel
     {
 //! Propose trial moves
+/*! Each thread generates one of the \a n_proposal trial moves of a particle. Proposal p of
+    particle i is stored at p * proposal_pitch + i.
+*/
 template<class Shape, unsigned int dim>
 __global__ void hpmc_gen_moves(const Scalar4* d_postype,
                                const Scalar4* d_orientation,
@@ -54,7 +57,9 @@ __global__ void hpmc_gen_moves(const Scalar4* d_postype,
                                Scalar4* d_trial_vel,
                                unsigned int* d_trial_move_type,
                                unsigned int* d_reject_out_of_cell,
-                               const typename Shape::param_type* d_params)
+                               const typename Shape::param_type* d_params,
+                               const unsigned int n_proposal,
+                               const unsigned int proposal_pitch)
     {
     // load the per type pair parameters into shared memory
     HIP_DYNAMIC_SHARED(char, s_data)
@@ -90,13 +95,17 @@ __global__ void hpmc_gen_moves(const Scalar4* d_postype,
 
     __syncthreads();
 
-    // identify the particle that this thread handles
-    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    // identify the particle and the proposal that this thread handles
+    unsigned int work_idx = blockIdx.x * blockDim.x + threadIdx.x;
 
     // return early if we are not handling a particle
-    if (idx >= N)
+    if (work_idx >= N * n_proposal)
         return;
 
+    unsigned int idx = work_idx % N;
+    unsigned int proposal = work_idx / N;
+    unsigned int proposal_idx = proposal * proposal_pitch + idx;
+
     // read in the position and orientation of our particle.
     Scalar4 postype_i = d_postype[idx];
     Scalar4 orientation_i = make_scalar4(1, 0, 0, 0);
@@ -123,7 +132,7 @@ __global__ void hpmc_gen_moves(const Scalar4* d_postype,
 
     // make the move
     hoomd::RandomGenerator rng(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove, timestep, seed),
-                               hoomd::Counter(idx, select, rank));
+                               hoomd::Counter(idx, select, rank, static_cast<uint16_t>(proposal)));
 
     // do not move particles that are outside the boundaries
     unsigned int reject = old_cell >= ci.getNumElements();
@@ -165,18 +174,19 @@ __global__ void hpmc_gen_moves(const Scalar4* d_postype,
         // store it in the velocity .x field
         Scalar4 vel = d_vel[idx];
         vel.x = __int_as_scalar(seed_i_new);
-        d_trial_vel[idx] = vel;
+        d_trial_vel[proposal_idx] = vel;
         }
 
     // stash the trial move in global memory
-    d_trial_postype[idx] = make_scalar4(pos_i.x, pos_i.y, pos_i.z, __int_as_scalar(typ_i));
-    d_trial_orientation[idx] = quat_to_scalar4(shape_i.orientation);
+    d_trial_postype[proposal_idx]
+        = make_scalar4(pos_i.x, pos_i.y, pos_i.z, __int_as_scalar(typ_i));
+    d_trial_orientation[proposal_idx] = quat_to_scalar4(shape_i.orientation);
 
     // 0==inactive, 1==translation, 2==rotation
-    d_trial_move_type[idx] = move_active ? (move_type_translate ? 1 : 2) : 0;
+    d_trial_move_type[proposal_idx] = move_active ? (move_type_translate ? 1 : 2) : 0;
 
     // initialize reject flag
-    d_reject_out_of_cell[idx] = reject;
+    d_reject_out_of_cell[proposal_idx] = reject;
     }
 
 //! Kernel to update particle data and statistics after acceptance
@@ -302,7 +312,7 @@ void hpmc_gen_moves(const hpmc_args_t& args, const typename Shape::param_type* p
 
         // setup the grid to run the kernel
         dim3 threads(block_size, 1, 1);
-        dim3 grid(args.N / block_size + 1, 1, 1);
+        dim3 grid(args.N * args.n_proposal / block_size + 1, 1, 1);
 
         hipLaunchKernelGGL((kernel::hpmc_gen_moves<Shape, 2>),
                            grid,
@@ -333,7 +343,9 @@ void hpmc_gen_moves(const hpmc_args_t& args, const typename Shape::param_type* p
                            args.d_trial_vel,
                            args.d_trial_move_type,
                            args.d_reject_out_of_cell,
-                           params);
+                           params,
+                           args.n_proposal,
+                           args.proposal_pitch);
         }
     else
         {
@@ -355,7 +367,7 @@ void hpmc_gen_moves(const hpmc_args_t& args, const typename Shape::param_type* p
 
         // setup the grid to run the kernel
         dim3 threads(block_size, 1, 1);
-        dim3 grid(args.N / block_size + 1, 1, 1);
+        dim3 grid(args.N * args.n_proposal / block_size + 1, 1, 1);
 
         hipLaunchKernelGGL((kernel::hpmc_gen_moves<Shape, 3>),
                            grid,
@@ -386,7 +398,9 @@ void hpmc_gen_moves(const hpmc_args_t& args, const typename Shape::param_type* p
                            args.d_trial_vel,
                            args.d_trial_move_type,
                            args.d_reject_out_of_cell,
-                           params);
+                           params,
+                           args.n_proposal,
+                           args.proposal_pitch);
         }
     }
 
@@ -121,6 +121,14 @@ struct hpmc_args_t
     const hipDeviceProp_t& devprop;            //!< CUDA device properties
     const GPUPartition& gpu_partition;         //!< Multi-GPU partition
     const hipStream_t* streams;                //!< kernel streams
+
+    unsigned int n_proposal = 1;     //!< Number of trial moves proposed concurrently per particle
+    unsigned int proposal_pitch = 0; //!< Offset between consecutive proposals of a particle
+    const Scalar4* d_proposal_postype = nullptr;     //!< Positions of all proposals
+    const Scalar4* d_proposal_orientation = nullptr; //!< Orientations of all proposals
+    unsigned int* d_proposal_reject_out = nullptr;   //!< Reject flags of all proposals (out)
+    const unsigned int* d_proposal_reject_out_of_cell
+        = nullptr; //!< Flags to reject proposals that leave the cell
     };
 
 //! Wraps arguments for hpmc_update_pdata
@@ -164,10 +172,67 @@ struct hpmc_update_args_t
     const unsigned int block_size;
     };
 
+//! Wraps arguments for hpmc_count_overlaps
+struct hpmc_count_overlaps_args_t
+    {
+    //! Construct an hpmc_count_overlaps_args_t
+    hpmc_count_overlaps_args_t(const Scalar4* _d_postype,
+                               const Scalar4* _d_orientation,
+                               const unsigned int* _d_tag,
+                               const unsigned int* _d_excell_idx,
+                               const unsigned int* _d_excell_size,
+                               const Index2D& _excli,
+                               const BoxDim& _box,
+                               const Scalar3 _ghost_width,
+                               const uint3& _cell_dim,
+                               const Index3D& _ci,
+                               const unsigned int* _d_check_overlaps,
+                               const Index2D& _overlap_idx,
+                               unsigned int* _d_overlap_count,
+                               const unsigned int _overlap_count_pitch,
+                               const unsigned int _max_overlaps,
+                               const unsigned int _block_size,
+                               const hipDeviceProp_t& _devprop,
+                               const GPUPartition& _gpu_partition)
+        : d_postype(_d_postype), d_orientation(_d_orientation), d_tag(_d_tag),
+          d_excell_idx(_d_excell_idx), d_excell_size(_d_excell_size), excli(_excli), box(_box),
+          ghost_width(_ghost_width), cell_dim(_cell_dim), ci(_ci),
+          d_check_overlaps(_d_check_overlaps), overlap_idx(_overlap_idx),
+          d_overlap_count(_d_overlap_count), overlap_count_pitch(_overlap_count_pitch),
+          max_overlaps(_max_overlaps), block_size(_block_size), devprop(_devprop),
+          gpu_partition(_gpu_partition)
+        {
+        }
+
+    const Scalar4* d_postype;               //!< postype array
+    const Scalar4* d_orientation;           //!< orientation array
+    const unsigned int* d_tag;              //!< particle tags, including ghosts
+    const unsigned int* d_excell_idx;       //!< Expanded cell list
+    const unsigned int* d_excell_size;      //!< Size of expanded cells
+    const Index2D& excli;                   //!< Excell indexer
+    const BoxDim box;                       //!< Current simulation box
+    const Scalar3 ghost_width;              //!< Width of the ghost layer
+    const uint3& cell_dim;                  //!< Cell dimensions
+    const Index3D& ci;                      //!< Cell indexer
+    const unsigned int* d_check_overlaps;   //!< Interaction matrix
+    const Index2D& overlap_idx;             //!< Indexer into interaction matrix
+    unsigned int* d_overlap_count;          //!< Number of overlaps found, per device (output)
+    const unsigned int overlap_count_pitch; //!< Pitch of the per-device overlap counts
+    const unsigned int max_overlaps;        //!< Stop counting once this many are exceeded
+    const unsigned int block_size;          //!< Block size to execute
+    const hipDeviceProp_t& devprop;         //!< CUDA device properties
+    const GPUPartition& gpu_partition;      //!< Multi-GPU partition
+    };
+
 //! Driver for kernel::hpmc_narrow_phase()
 template<class Shape>
 void hpmc_narrow_phase(const hpmc_args_t& args, const typename Shape::param_type* params);
 
+//! Driver for kernel::hpmc_count_overlaps()
+template<class Shape>
+void hpmc_count_overlaps(const hpmc_count_overlaps_args_t& args,
+                         const typename Shape::param_type* params);
+
 //! Driver for kernel::hpmc_gen_moves()
 template<class Shape>
 void hpmc_gen_moves(const hpmc_args_t& args, const typename Shape::param_type* params);
@@ -197,6 +262,32 @@ void hpmc_shift(Scalar4* d_postype,
                 const Scalar3 shift,
                 const unsigned int block_size);
 
+//! Kernel driver for kernel::hpmc_scale()
+void hpmc_scale(Scalar4* d_postype,
+                const unsigned int N,
+                const BoxDim& old_box,
+                const BoxDim& new_box,
+                const unsigned int block_size);
+
+//! Kernel driver for kernel::hpmc_select_proposal()
+void hpmc_select_proposal(const Scalar4* d_proposal_postype,
+                          const Scalar4* d_proposal_orientation,
+                          const unsigned int* d_proposal_move_type,
+                          const unsigned int* d_proposal_reject_out_of_cell,
+                          unsigned int* d_proposal_reject,
+                          const unsigned int n_proposal,
+                          const unsigned int proposal_pitch,
+                          const Scalar* d_d,
+                          Scalar4* d_trial_postype,
+                          Scalar4* d_trial_orientation,
+                          unsigned int* d_trial_move_type,
+                          unsigned int* d_reject_out_of_cell,
+                          unsigned int* d_reject_out,
+                          unsigned int* d_proposal_select,
+                          unsigned int* d_condition,
+                          const GPUPartition& gpu_partition,
+                          const unsigned int block_size);
+
 //! Kernel to evaluate convergence
 void hpmc_check_convergence(const unsigned int* d_trial_move_type,
                             const unsigned int* d_reject_out_of_cell,
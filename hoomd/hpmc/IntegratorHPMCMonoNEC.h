@@ -495,7 +495,7 @@ template<class Shape> void IntegratorHPMCMonoNEC<Shape>::update(uint64_t timeste
                     hoomd::detail::AABB aabb_k_local = shape_k.getAABB(vec3<Scalar>(0, 0, 0));
                     hoomd::detail::AABB aabb = aabb_k_local;
                     aabb.translate(vec3<Scalar>(h_postype.data[k]));
-                    this->m_aabb_tree.update(k, aabb);
+                    this->updateAABBTree(k, aabb);
                     // Update the velocities of 'k' and 'next'
                     // unless there was no collision
                     if (next != k and next > -1)
@@ -588,7 +588,7 @@ template<class Shape> void IntegratorHPMCMonoNEC<Shape>::update(uint64_t timeste
                     // update the position of the particle in the tree for future updates
                     hoomd::detail::AABB aabb = aabb_i_local;
                     aabb.translate(pos_i);
-                    this->m_aabb_tree.update(i, aabb);
+                    this->updateAABBTree(i, aabb);
 
                     // update position of particle
                     h_postype.data[i] = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
@@ -87,6 +87,34 @@ class OBBTree
     //! Construct an OBBTree
     OBBTree() : m_nodes(0), m_num_nodes(0), m_node_capacity(0), m_leaf_capacity(0), m_root(0) { }
 
+    //! Copy an OBBTree
+    OBBTree(const OBBTree& other)
+        : m_nodes(0), m_num_nodes(0), m_node_capacity(0), m_leaf_capacity(0), m_root(0)
+        {
+        *this = other;
+        }
+
+    //! Copy an OBBTree
+    OBBTree& operator=(const OBBTree& other)
+        {
+        if (this == &other)
+            return *this;
+
+        if (m_nodes)
+            delete[] m_nodes;
+        m_nodes = 0;
+        if (other.m_num_nodes > 0)
+            {
+            m_nodes = new OBBNode[other.m_num_nodes];
+            std::copy(other.m_nodes, other.m_nodes + other.m_num_nodes, m_nodes);
+            }
+        m_num_nodes = other.m_num_nodes;
+        m_node_capacity = other.m_num_nodes;
+        m_leaf_capacity = other.m_leaf_capacity;
+        m_root = other.m_root;
+        return *this;
+        }
+
     // Destructor
     ~OBBTree()
         {
@@ -107,6 +135,11 @@ class OBBTree
     //! Update the OBB of a particle
     inline void update(unsigned int idx, const OBB& obb);
 
+    //! Recompute the node OBBs for moved particles, keeping the structure of the tree
+    inline void refit(const OBB* obbs,
+                      const std::vector<std::vector<vec3<ShortReal>>>& internal_coordinates,
+                      ShortReal vertex_radius);
+
     //! Get the number of nodes
     inline unsigned int getNumNodes() const
         {
@@ -292,6 +325,66 @@ OBBTree::buildTree(OBB* obbs, unsigned int N, unsigned int leaf_capacity, bool s
     updateEscapeIndex(m_root, getNumNodes());
     }
 
+/*! \param obbs List of OBBs for each particle
+    \param internal_coordinates List of lists of vertex contents of OBBs
+    \param vertex_radius Radius of every vertex
+
+    refit() recomputes the OBBs of all nodes from new particle OBBs and coordinates without
+   changing which particles the leaves hold. Leaf OBBs are fit to the coordinates of their
+   particles as in buildTree(). Internal OBBs are fit to the corners of the OBBs of their
+   children, which is looser than a fit to all contained coordinates but costs O(1) per node.
+   The tree remains a valid bounding volume hierarchy for any motion of the particles, but its
+   splits stay those of the last build.
+*/
+inline void OBBTree::refit(const OBB* obbs,
+                           const std::vector<std::vector<vec3<ShortReal>>>& internal_coordinates,
+                           ShortReal vertex_radius)
+    {
+    // buildNode() allocates every node before its children, so visiting the nodes in reverse
+    // order visits children before their parents
+    for (unsigned int i = m_num_nodes; i-- > 0;)
+        {
+        OBBNode& node = m_nodes[i];
+
+        if (isNodeLeaf(i))
+            {
+            if (node.particles.size() == 1)
+                {
+                node.obb = obbs[node.particles[0]];
+                continue;
+                }
+
+            std::vector<vec3<ShortReal>> merge_internal_coordinates;
+            unsigned int mask = 0;
+            for (unsigned int j : node.particles)
+                {
+                merge_internal_coordinates.insert(merge_internal_coordinates.end(),
+                                                  internal_coordinates[j].begin(),
+                                                  internal_coordinates[j].end());
+                mask |= obbs[j].mask;
+                }
+
+            std::vector<ShortReal> merge_vertex_radii(merge_internal_coordinates.size(),
+                                                      vertex_radius);
+            node.obb = compute_obb(merge_internal_coordinates, merge_vertex_radii, false);
+            node.obb.mask = mask;
+            }
+        else
+            {
+            const OBB& left = m_nodes[node.left].obb;
+            const OBB& right = m_nodes[node.right].obb;
+
+            std::vector<vec3<ShortReal>> corners = left.getCorners();
+            std::vector<vec3<ShortReal>> right_corners = right.getCorners();
+            corners.insert(corners.end(), right_corners.begin(), right_corners.end());
+
+            std::vector<ShortReal> corner_radii(corners.size(), ShortReal(0.0));
+            node.obb = compute_obb(corners, corner_radii, false);
+            node.obb.mask = left.mask | right.mask;
+            }
+        }
+    }
+
 //! Define a weak ordering on OBB centroid projections
 inline bool compare_proj(const std::pair<ShortReal, unsigned int>& lhs,
                          const std::pair<ShortReal, unsigned int>& rhs)
@@ -0,0 +1,229 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include "OBBTree.h"
+
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*! \file OBBTreeCache.h
+    \brief Caches OBB trees built for triangle meshes
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Cache of OBB trees of triangle meshes
+/*! Building the OBB tree of a mesh fits an OBB to a convex hull for every node and dominates the
+    cost of setting the shape parameters of large meshes. OBBTreeCache keeps the trees of recently
+    used meshes, addressed by the full content of the mesh:
+
+    - When the vertices, faces, face overlap masks, sweep radius, and leaf capacity all match a
+      cached mesh, getTree() returns the cached tree.
+    - When only the vertex positions or the sweep radius differ, getTree() refits a copy of the
+      cached tree with OBBTree::refit() instead of building a new one. Shape moves that deform a
+      mesh without changing its connectivity take this path.
+    - Otherwise, getTree() builds a new tree and evicts the least recently used mesh when the
+      cache is full.
+
+    A refit tree keeps the splits of the original build, so its nodes grow looser as the mesh
+    deforms away from the built shape. Overlap checks remain exact.
+*/
+class OBBTreeCache
+    {
+    public:
+    //! Get the process wide cache
+    static OBBTreeCache& getInstance()
+        {
+        static OBBTreeCache cache;
+        return cache;
+        }
+
+    //! Get the OBB tree of a triangle mesh
+    /*! \param verts Vertex coordinates
+        \param n_verts Number of vertices
+        \param face_offs Offset of every face in \a face_verts (n_faces + 1 elements)
+        \param face_verts Ordered vertex IDs of every face
+        \param face_overlap Overlap mask per face
+        \param n_faces Number of faces
+        \param sweep_radius Radius of the sweeping sphere
+        \param leaf_capacity Maximum number of faces per leaf node
+    */
+    std::shared_ptr<const OBBTree> getTree(const vec3<ShortReal>* verts,
+                                           unsigned int n_verts,
+                                           const unsigned int* face_offs,
+                                           const unsigned int* face_verts,
+                                           const unsigned int* face_overlap,
+                                           unsigned int n_faces,
+                                           ShortReal sweep_radius,
+                                           unsigned int leaf_capacity)
+        {
+        Entry key;
+        key.face_offs.assign(face_offs, face_offs + n_faces + 1);
+        key.face_verts.assign(face_verts, face_verts + face_offs[n_faces]);
+        key.face_overlap.assign(face_overlap, face_overlap + n_faces);
+        key.leaf_capacity = leaf_capacity;
+        key.verts.assign(verts, verts + n_verts);
+        key.sweep_radius = sweep_radius;
+        key.topology_hash = key.hashTopology();
+        key.geometry_hash = key.hashGeometry();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto match = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+            if (it->sameTopology(key))
+                {
+                match = it;
+                break;
+                }
+            }
+
+        if (match != m_entries.end() && match->sameGeometry(key))
+            {
+            m_entries.splice(m_entries.begin(), m_entries, match);
+            return match->tree;
+            }
+
+        // fit an OBB to every face
+        std::vector<OBB> obbs(std::max(n_faces, 1u));
+        std::vector<std::vector<vec3<ShortReal>>> internal_coordinates(n_faces);
+        for (unsigned int i = 0; i < n_faces; ++i)
+            {
+            for (unsigned int j = face_offs[i]; j < face_offs[i + 1]; ++j)
+                {
+                internal_coordinates[i].push_back(verts[face_verts[j]]);
+                }
+
+            std::vector<ShortReal> vertex_radii(internal_coordinates[i].size(), sweep_radius);
+            obbs[i] = compute_obb(internal_coordinates[i], vertex_radii, false);
+            obbs[i].mask = face_overlap[i];
+            }
+
+        std::shared_ptr<OBBTree> tree;
+        if (match != m_entries.end())
+            {
+            tree = std::make_shared<OBBTree>(*match->tree);
+            tree->refit(obbs.data(), internal_coordinates, sweep_radius);
+            m_entries.erase(match);
+            }
+        else
+            {
+            tree = std::make_shared<OBBTree>();
+            tree->buildTree(obbs.data(),
+                            internal_coordinates,
+                            sweep_radius,
+                            n_faces,
+                            leaf_capacity);
+            if (m_entries.size() >= max_entries)
+                {
+                m_entries.pop_back();
+                }
+            }
+
+        key.tree = tree;
+        m_entries.push_front(std::move(key));
+        return tree;
+        }
+
+    //! Remove all cached trees
+    void clear()
+        {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+        }
+
+    private:
+    //! Maximum number of cached meshes
+    static constexpr size_t max_entries = 32;
+
+    //! A cached mesh and its tree
+    struct Entry
+        {
+        std::vector<unsigned int> face_offs;
+        std::vector<unsigned int> face_verts;
+        std::vector<unsigned int> face_overlap;
+        unsigned int leaf_capacity;
+        std::vector<vec3<ShortReal>> verts;
+        ShortReal sweep_radius;
+        size_t topology_hash;
+        size_t geometry_hash;
+        std::shared_ptr<const OBBTree> tree;
+
+        //! Combine a value into a hash
+        template<class T> static void combine(size_t& seed, const T& v)
+            {
+            seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+
+        size_t hashTopology() const
+            {
+            size_t seed = verts.size();
+            combine(seed, leaf_capacity);
+            for (unsigned int v : face_offs)
+                combine(seed, v);
+            for (unsigned int v : face_verts)
+                combine(seed, v);
+            for (unsigned int v : face_overlap)
+                combine(seed, v);
+            return seed;
+            }
+
+        size_t hashGeometry() const
+            {
+            size_t seed = 0;
+            combine(seed, sweep_radius);
+            for (const vec3<ShortReal>& v : verts)
+                {
+                combine(seed, v.x);
+                combine(seed, v.y);
+                combine(seed, v.z);
+                }
+            return seed;
+            }
+
+        //! Test whether two meshes have the same faces, masks, and number of vertices
+        bool sameTopology(const Entry& other) const
+            {
+            return topology_hash == other.topology_hash && verts.size() == other.verts.size()
+                   && leaf_capacity == other.leaf_capacity && face_offs == other.face_offs
+                   && face_verts == other.face_verts && face_overlap == other.face_overlap;
+            }
+
+        //! Test whether two meshes of the same topology have the same vertices and sweep radius
+        bool sameGeometry(const Entry& other) const
+            {
+            if (geometry_hash != other.geometry_hash || sweep_radius != other.sweep_radius)
+                return false;
+
+            for (size_t i = 0; i < verts.size(); ++i)
+                {
+                if (verts[i].x != other.verts[i].x || verts[i].y != other.verts[i].y
+                    || verts[i].z != other.verts[i].z)
+                    return false;
+                }
+            return true;
+            }
+        };
+
+    std::list<Entry> m_entries; //!< Cached meshes, most recently used first
+    std::mutex m_mutex;         //!< Protects m_entries
+    };
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
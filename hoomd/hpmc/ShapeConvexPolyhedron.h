@@ -24,6 +24,9 @@
 #if !defined(__HIPCC__) && defined(__SSE__)
 #include <immintrin.h>
 #endif
+#if !defined(__HIPCC__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 #endif
 
 namespace hoomd
@@ -286,7 +289,46 @@ class SupportFuncConvexPolyhedron
 
         if (verts.N > 0)
             {
-#if !defined(__HIPCC__) && defined(__AVX__) && HOOMD_SHORTREAL_SIZE == 32
+#if !defined(__HIPCC__) && defined(__AVX512F__) && HOOMD_SHORTREAL_SIZE == 32
+            // process dot products with AVX-512 16 at a time on the CPU, tracking the index of
+            // the maximum in each channel so that a single pass over the vertices is needed
+            __m512 nx_v = _mm512_set1_ps(n.x);
+            __m512 ny_v = _mm512_set1_ps(n.y);
+            __m512 nz_v = _mm512_set1_ps(n.z);
+            __m512 max_dot_v = _mm512_set1_ps(max_dot);
+            __m512i max_idx_v = _mm512_setzero_si512();
+            __m512i idx_v = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            const __m512i stride_v = _mm512_set1_epi32(16);
+
+            for (unsigned int i = 0; i < verts.N; i += 16)
+                {
+                // the vertex arrays are only padded to a multiple of 8, mask off the channels
+                // past the last vertex
+                __mmask16 load_mask = (verts.N - i >= 16)
+                                          ? __mmask16(0xffff)
+                                          : __mmask16((1u << (verts.N - i)) - 1);
+                __m512 x_v = _mm512_maskz_loadu_ps(load_mask, verts.x.get() + i);
+                __m512 y_v = _mm512_maskz_loadu_ps(load_mask, verts.y.get() + i);
+                __m512 z_v = _mm512_maskz_loadu_ps(load_mask, verts.z.get() + i);
+
+                __m512 d_v = _mm512_fmadd_ps(
+                    nx_v,
+                    x_v,
+                    _mm512_fmadd_ps(ny_v, y_v, _mm512_mul_ps(nz_v, z_v)));
+
+                // keep the first maximum in each of the 16 channels as we go
+                __mmask16 greater = _mm512_mask_cmp_ps_mask(load_mask, d_v, max_dot_v, _CMP_GT_OQ);
+                max_dot_v = _mm512_mask_mov_ps(max_dot_v, greater, d_v);
+                max_idx_v = _mm512_mask_mov_epi32(max_idx_v, greater, idx_v);
+                idx_v = _mm512_add_epi32(idx_v, stride_v);
+                }
+
+            // the support vertex is the lowest index among the channels that hold the maximum
+            max_dot = _mm512_reduce_max_ps(max_dot_v);
+            __mmask16 is_max
+                = _mm512_cmp_ps_mask(max_dot_v, _mm512_set1_ps(max_dot), _CMP_EQ_OQ);
+            max_idx = _mm512_mask_reduce_min_epi32(is_max, max_idx_v);
+#elif !defined(__HIPCC__) && defined(__AVX__) && HOOMD_SHORTREAL_SIZE == 32
             // process dot products with AVX 8 at a time on the CPU when working with more than
             // 4 verts
             __m256 nx_v = _mm256_broadcast_ss(&n.x);
@@ -301,9 +343,15 @@ class SupportFuncConvexPolyhedron
                 __m256 y_v = _mm256_load_ps(verts.y.get() + i);
                 __m256 z_v = _mm256_load_ps(verts.z.get() + i);
 
+#ifdef __FMA__
+                __m256 d_v = _mm256_fmadd_ps(nx_v,
+                                             x_v,
+                                             _mm256_fmadd_ps(ny_v, y_v, _mm256_mul_ps(nz_v, z_v)));
+#else
                 __m256 d_v = _mm256_add_ps(
                     _mm256_mul_ps(nx_v, x_v),
                     _mm256_add_ps(_mm256_mul_ps(ny_v, y_v), _mm256_mul_ps(nz_v, z_v)));
+#endif
 
                 // determine a maximum in each of the 8 channels as we go
                 max_dot_v = _mm256_max_ps(max_dot_v, d_v);
@@ -385,9 +433,48 @@ class SupportFuncConvexPolyhedron
                     break;
                     }
                 }
+#elif !defined(__HIPCC__) && defined(__ARM_NEON) && HOOMD_SHORTREAL_SIZE == 32
+            // process dot products with NEON 4 at a time on the CPU
+            float32x4_t nx_v = vdupq_n_f32(n.x);
+            float32x4_t ny_v = vdupq_n_f32(n.y);
+            float32x4_t nz_v = vdupq_n_f32(n.z);
+            float32x4_t max_dot_v = vdupq_n_f32(max_dot);
+            float d_s[verts.x.size()] __attribute__((aligned(16)));
+
+            for (unsigned int i = 0; i < verts.N; i += 4)
+                {
+                float32x4_t x_v = vld1q_f32(verts.x.get() + i);
+                float32x4_t y_v = vld1q_f32(verts.y.get() + i);
+                float32x4_t z_v = vld1q_f32(verts.z.get() + i);
+
+                float32x4_t d_v
+                    = vmlaq_f32(vmlaq_f32(vmulq_f32(nz_v, z_v), ny_v, y_v), nx_v, x_v);
+
+                // determine a maximum in each of the 4 channels as we go
+                max_dot_v = vmaxq_f32(max_dot_v, d_v);
+
+                vst1q_f32(d_s + i, d_v);
+                }
+
+            // find the maximum of the 4 channels with pairwise maxima
+            float32x2_t max_dot_pair = vpmax_f32(vget_low_f32(max_dot_v), vget_high_f32(max_dot_v));
+            max_dot_pair = vpmax_f32(max_dot_pair, max_dot_pair);
+            max_dot = vget_lane_f32(max_dot_pair, 0);
+
+            // loop again and find the first index of the max. NEON has no movemask, so compare the
+            // stored dot products directly
+            for (unsigned int i = 0; i < verts.N; i++)
+                {
+                if (d_s[i] == max_dot)
+                    {
+                    max_idx = i;
+                    break;
+                    }
+                }
 #else
 
-            // if no AVX or SSE, or running in double precision, fall back on serial computation
+            // if no SIMD instructions, or running in double precision, fall back on serial
+            // computation
             // this code path also triggers on the GPU
 
             ShortReal max_dot0 = dot(n, vec3<ShortReal>(verts.x[0], verts.y[0], verts.z[0]));
@@ -765,6 +852,13 @@ struct ShapeConvexPolyhedron
         return false;
         }
 
+    /// Returns true if moving two non-overlapping shapes apart along the line between their
+    /// centers never creates an overlap
+    HOSTDEVICE static bool isExpansionOverlapFree()
+        {
+        return false;
+        }
+
     /// Returns true if the overlap check supports sweeping both shapes by a sphere of given radius
     HOSTDEVICE static bool supportsSweepRadius()
         {
@@ -178,6 +178,13 @@ struct ShapeEllipsoid
         return false;
         }
 
+    /// Returns true if moving two non-overlapping shapes apart along the line between their
+    /// centers never creates an overlap
+    HOSTDEVICE static bool isExpansionOverlapFree()
+        {
+        return true;
+        }
+
     /// Returns true if the overlap check supports sweeping both shapes by a sphere of given radius
     HOSTDEVICE static bool supportsSweepRadius()
         {
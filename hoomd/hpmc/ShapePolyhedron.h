@@ -3,6 +3,9 @@
 
 #pragma once
 #include "GPUTree.h"
+#ifndef __HIPCC__
+#include "OBBTreeCache.h"
+#endif
 #include "ShapeConvexPolyhedron.h"
 #include "ShapeSphere.h"
 #include "ShapeSpheropolyhedron.h"
@@ -47,7 +50,8 @@ namespace detail
 
     Define the parameters of a general polyhedron for HPMC shape overlap checks. Polyhedra are
     defined N vertices and a triangle mesh indexed on those vertices. The shape data precomputes an
-    OBB tree of the triangles for use in an efficient overlap check.
+    OBB tree of the triangles for use in an efficient overlap check. OBBTreeCache reuses the trees
+    of identical meshes and refits the trees of meshes whose vertices moved.
 
      The polyhedrons's diameter is precomputed from the vertex farthest from the origin. Arrays are
     stored in ManagedArray to support arbitrary numbers of verticles.
@@ -163,31 +167,17 @@ struct TriangleMesh : ShapeParams
                 }
             }
 
-        // construct bounding box tree
-        hpmc::detail::OBB* obbs = new hpmc::detail::OBB[n_faces];
-        std::vector<std::vector<vec3<ShortReal>>> internal_coordinates;
-
-        for (unsigned int i = 0; i < n_faces; ++i)
-            {
-            std::vector<vec3<ShortReal>> face_vec;
-
-            unsigned int n_vert = 0;
-            for (unsigned int j = face_offs[i]; j < face_offs[i + 1]; ++j)
-                {
-                face_vec.push_back(verts[face_verts[j]]);
-                n_vert++;
-                }
-
-            std::vector<ShortReal> vertex_radii(n_vert, sweep_radius);
-            obbs[i] = hpmc::detail::compute_obb(face_vec, vertex_radii, false);
-            obbs[i].mask = face_overlap[i];
-            internal_coordinates.push_back(face_vec);
-            }
-
-        OBBTree tree_obb;
-        tree_obb.buildTree(obbs, internal_coordinates, sweep_radius, n_faces, leaf_capacity);
-        tree = GPUTree(tree_obb, managed);
-        delete[] obbs;
+        // construct bounding box tree, reusing the tree of an identical or deformed mesh
+        std::shared_ptr<const OBBTree> tree_obb
+            = OBBTreeCache::getInstance().getTree(verts.get(),
+                                                  n_verts,
+                                                  face_offs.get(),
+                                                  face_verts.get(),
+                                                  face_overlap.get(),
+                                                  n_faces,
+                                                  sweep_radius,
+                                                  leaf_capacity);
+        tree = GPUTree(*tree_obb, managed);
 
         // set the diameter
         diameter = 2 * (sqrt(radius_sq) + sweep_radius);
@@ -435,6 +425,13 @@ struct ShapePolyhedron
 #endif
         }
 
+    /// Returns true if moving two non-overlapping shapes apart along the line between their
+    /// centers never creates an overlap
+    HOSTDEVICE static bool isExpansionOverlapFree()
+        {
+        return false;
+        }
+
     /// Returns true if the overlap check supports sweeping both shapes by a sphere of given radius
     HOSTDEVICE static bool supportsSweepRadius()
         {
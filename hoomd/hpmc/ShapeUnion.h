@@ -442,6 +442,13 @@ template<class Shape> struct ShapeUnion
         return true;
         }
 
+    /// Returns true if moving two non-overlapping shapes apart along the line between their
+    /// centers never creates an overlap
+    HOSTDEVICE static bool isExpansionOverlapFree()
+        {
+        return false;
+        }
+
     /// Orientation of the sphere
     quat<Scalar> orientation;
 
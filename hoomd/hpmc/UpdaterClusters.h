@@ -19,18 +19,12 @@
 #include "HPMCCounters.h"
 #include "IntegratorHPMCMono.h"
 
+#include <atomic>
+
 #ifdef ENABLE_TBB
 #include <tbb/concurrent_unordered_map.h>
-#include <tbb/concurrent_unordered_set.h>
-#include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
-#include <tbb/task.h>
-#include <atomic>
-
-#if TBB_VERSION_MAJOR < 2021
-#define ENABLE_TBB_TASK
-#endif
-
+#include <tbb/task_arena.h>
 #endif
 
 namespace hoomd {
@@ -41,49 +35,29 @@ namespace hpmc
 namespace detail
 {
 
-#ifdef ENABLE_TBB_TASK
-//! Wrapper around std::atomic_flag to allow use in a std::vector
-class my_atomic_flag
+#ifdef ENABLE_TBB
+//! Hash function for particle index pairs in concurrent containers
+struct PairHash
     {
-    public:
-        //! Default constructor
-        my_atomic_flag()
-            {
-            f.clear();
-            }
-
-        //! Copy constructor
-        /*! \note this constructor doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag(const my_atomic_flag& other)
-            {
-            f.clear();
-            }
-
-        //! Assignment operator (non-atomic)
-        /*! \note this assignment operator doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag& operator =( const my_atomic_flag& other)
-            {
-            f.clear();
-            return *this;
-            }
-
-        //! Sets flag and returns old value
-        bool test_and_set()
-            {
-            return f.test_and_set();
-            }
-
-    private:
-        std::atomic_flag f;
+    size_t operator()(const std::pair<unsigned int, unsigned int>& p) const
+        {
+        return std::hash<uint64_t>()((uint64_t(p.first) << 32) | p.second);
+        }
     };
 #endif
 
-// Graph class represents a undirected graph
-// using adjacency list representation
+//! Undirected graph that tracks its connected components with a union-find forest
+/*! Each vertex points to a parent vertex with a smaller or equal index, and the root of each tree
+    labels a connected component. addEdge() hooks the larger root under the smaller one with an
+    atomic compare and swap and compresses the paths it visits (pointer jumping), following the
+    ECL-CC connected components algorithm used on the GPU (extern/ECL.cuh). Because the roots only
+    ever move to smaller indices, concurrent calls to addEdge() from multiple threads are safe and
+    need no locks.
+
+    connectedComponents() lists the components in the order of their smallest vertex, with the
+    vertices of each component in increasing order. The result is independent of the order in
+    which the edges are added and of the number of threads.
+*/
 class Graph
     {
     public:
@@ -93,17 +67,16 @@ class Graph
 
         inline Graph(unsigned int V);   // Constructor
 
+        //! Remove all edges and set the number of vertices
         inline void resize(unsigned int V);
 
+        //! Add an undirected edge (thread safe)
         inline void addEdge(unsigned int v, unsigned int w);
 
-        #ifdef ENABLE_TBB_TASK
-        inline void connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc);
-        #else
+        //! List the connected components
         inline void connectedComponents(std::vector<std::vector<unsigned int> >& cc);
-        #endif
 
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         void setTaskArena(std::shared_ptr<tbb::task_arena> task_arena)
             {
             m_task_arena = task_arena;
@@ -111,161 +84,114 @@ class Graph
         #endif
 
     private:
-        #ifndef ENABLE_TBB_TASK
-        std::multimap<unsigned int,unsigned int> adj;
-        #else
-        tbb::concurrent_unordered_multimap<unsigned int, unsigned int> adj;
-        #endif
+        std::vector<std::atomic<unsigned int> > m_parent;   //!< Parent of each vertex in the union-find forest
+        std::vector<unsigned int> m_component;              //!< Index of the component of each root vertex
 
-        #ifndef ENABLE_TBB_TASK
-        std::vector<unsigned int> visited;
-        #else
-        std::vector<my_atomic_flag> visited;
-        #endif
-
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         /// The TBB task arena
         std::shared_ptr<tbb::task_arena> m_task_arena;
         #endif
 
-        #ifndef ENABLE_TBB_TASK
-        // A function used by DFS
-        inline void DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc);
-        #endif
-
-        #ifdef ENABLE_TBB_TASK
-        class DFSTask : public tbb::task
-            {
-            public:
-                DFSTask(unsigned int _root, std::vector<my_atomic_flag>& _visited,
-                    tbb::concurrent_vector<unsigned int>& _cc,
-                    const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& _adj)
-                    : root(_root), visited(_visited), cc(_cc), adj(_adj)
-                    { }
-
-                tbb::task* execute()
-                    {
-                    cc.push_back(root);
-
-                    unsigned int count = 0;
-                    tbb::task_list list;
-
-                    auto begin = adj.equal_range(root).first;
-                    auto end = adj.equal_range(root).second;
-
-                    for (auto it = begin; it != end; ++it)
-                        {
-                        unsigned int neighbor = it->second;
-                        if (!visited[neighbor].test_and_set())
-                            {
-                            if (count++ == 0)
-                                {
-                                root = neighbor; // for task recycling
-                                continue;
-                                }
-                            list.push_back(*new(allocate_child()) DFSTask(neighbor, visited, cc, adj));
-                            }
-                        }
-
-                    if (count)
-                        {
-                        set_ref_count(count);
-                        spawn(list);
+        //! Find the root of a vertex and shorten the path to it
+        inline unsigned int findRoot(unsigned int v);
+    };
 
-                        recycle_as_safe_continuation();
-                        }
+Graph::Graph(unsigned int V)
+    {
+    resize(V);
+    }
 
-                    return NULL;
-                    }
+void Graph::resize(unsigned int V)
+    {
+    // std::atomic is not movable, so the vector cannot be resized in place
+    if (m_parent.size() != V)
+        m_parent = std::vector<std::atomic<unsigned int> >(V);
 
-            private:
-                unsigned int root;
-                std::vector<my_atomic_flag> & visited;
-                tbb::concurrent_vector<unsigned int>& cc;
-                const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& adj;
-            };
-        #endif // ENABLE_TBB_TASK
+    for (unsigned int v = 0; v < V; ++v)
+        m_parent[v].store(v, std::memory_order_relaxed);
+    }
 
-    };
+/*! \param v Vertex
+    \returns The root of the tree that contains \a v
 
-// Gather connected components in an undirected graph
-#ifdef ENABLE_TBB_TASK
-void Graph::connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc)
-#else
-void Graph::connectedComponents(std::vector<std::vector<unsigned int> >& cc)
-#endif
+    Intermediate pointer jumping: point every vertex on the path to its grandparent. Concurrent
+    calls may overwrite each other's updates, but every value written is an ancestor of the vertex,
+    so the forest stays valid.
+*/
+unsigned int Graph::findRoot(unsigned int v)
     {
-    #ifdef ENABLE_TBB_TASK
-    this->m_task_arena->execute([&]{
-    for (unsigned int v = 0; v < visited.size(); ++v)
+    unsigned int current = m_parent[v].load(std::memory_order_relaxed);
+    if (current != v)
         {
-        if (! visited[v].test_and_set())
+        unsigned int previous = v;
+        unsigned int next;
+        while (current > (next = m_parent[current].load(std::memory_order_relaxed)))
             {
-            tbb::concurrent_vector<unsigned int> component;
-            DFSTask& a = *new(tbb::task::allocate_root()) DFSTask(v, visited, component, adj);
-            tbb::task::spawn_root_and_wait(a);
-            cc.push_back(component);
+            m_parent[previous].store(next, std::memory_order_relaxed);
+            previous = current;
+            current = next;
             }
         }
-    }); // end task arena execute()
-    #else
-    std::fill(visited.begin(), visited.end(), 0);
-
-    // Depth first search
-    for (unsigned int v=0; v<visited.size(); v++)
-        {
-        if (visited[v] == false)
-            {
-            std::vector<unsigned int> cur_cc;
-            DFSUtil(v, visited, cur_cc);
-            cc.push_back(cur_cc);
-            }
-        }
-    #endif
+    return current;
     }
 
-#ifndef ENABLE_TBB_TASK
-void Graph::DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc)
+/*! \param v First vertex
+    \param w Second vertex
+*/
+void Graph::addEdge(unsigned int v, unsigned int w)
     {
-    visited[v] = 1;
-    cur_cc.push_back(v);
-
-    // Recur for all the vertices
-    // adjacent to this vertex
-    auto begin = adj.equal_range(v).first;
-    auto end = adj.equal_range(v).second;
-    for(auto i = begin; i != end; ++i)
+    unsigned int root_v = findRoot(v);
+    unsigned int root_w = findRoot(w);
+
+    while (root_v != root_w)
         {
-        if(!visited[i->second])
-            DFSUtil(i->second, visited, cur_cc);
+        // hook the larger root under the smaller one
+        if (root_v < root_w)
+            std::swap(root_v, root_w);
+
+        unsigned int expected = root_v;
+        if (m_parent[root_v].compare_exchange_strong(expected, root_w))
+            break;
+
+        // another thread hooked root_v first, continue from its new root
+        root_v = findRoot(expected);
         }
     }
-#endif
-Graph::Graph(unsigned int V)
-    {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
-    #else
-    visited.resize(V);
-    #endif
-    }
 
-void Graph::resize(unsigned int V)
+/*! \param cc Output: Connected components, appended to the list
+*/
+void Graph::connectedComponents(std::vector<std::vector<unsigned int> >& cc)
     {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
+    unsigned int V = (unsigned int)m_parent.size();
+
+    // point every vertex directly to its root
+    #ifdef ENABLE_TBB
+    m_task_arena->execute([&]{
+    tbb::parallel_for((unsigned int)0, V, [&](unsigned int v)
     #else
-    visited.clear();
-    visited.resize(V);
+    for (unsigned int v = 0; v < V; ++v)
+    #endif
+        {
+        m_parent[v].store(findRoot(v), std::memory_order_relaxed);
+        }
+    #ifdef ENABLE_TBB
+        );
+    }); // end task arena execute()
     #endif
 
-    adj.clear();
-    }
-
-// method to add a directed edge
-void Graph::addEdge(unsigned int v, unsigned int w)
-    {
-    adj.insert(std::make_pair(v,w));
+    // roots have the smallest index in their component, so each root is visited before the other
+    // vertices in its component
+    m_component.resize(V);
+    for (unsigned int v = 0; v < V; ++v)
+        {
+        unsigned int root = m_parent[v].load(std::memory_order_relaxed);
+        if (root == v)
+            {
+            m_component[v] = (unsigned int)cc.size();
+            cc.push_back(std::vector<unsigned int>());
+            }
+        cc[m_component[root]].push_back(v);
+        }
     }
 } // end namespace detail
 
@@ -365,11 +291,7 @@ class UpdaterClusters : public Updater
 
         unsigned int m_instance=0;                  //!< Unique ID for RNG seeding
 
-        #ifdef ENABLE_TBB_TASK
-        std::vector<tbb::concurrent_vector<unsigned int> > m_clusters; //!< Cluster components
-        #else
         std::vector<std::vector<unsigned int> > m_clusters; //!< Cluster components
-        #endif
 
         detail::Graph m_G; //!< The graph
 
@@ -379,14 +301,12 @@ class UpdaterClusters : public Updater
         GlobalVector<Scalar4> m_orientation_backup;    //!< Old local orientations
         GlobalVector<int3> m_image_backup;             //!< Old local images
 
-        #ifndef ENABLE_TBB_TASK
-        std::set<std::pair<unsigned int, unsigned int> > m_overlap;   //!< A local vector of particle pairs due to overlap
+        #ifndef ENABLE_TBB
         std::map<std::pair<unsigned int, unsigned int>,LongReal > m_energy_old_old;    //!< Energy of interaction old-old
         std::map<std::pair<unsigned int, unsigned int>,LongReal > m_energy_new_old;    //!< Energy of interaction old-old
         #else
-        tbb::concurrent_unordered_set<std::pair<unsigned int, unsigned int> > m_overlap;
-        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,LongReal > m_energy_old_old;
-        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,LongReal > m_energy_new_old;
+        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,LongReal,detail::PairHash > m_energy_old_old;
+        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,LongReal,detail::PairHash > m_energy_new_old;
         #endif
 
         hpmc_clusters_counters_t m_count_total;                 //!< Total count since initialization
@@ -426,7 +346,7 @@ UpdaterClusters<Shape>::UpdaterClusters(std::shared_ptr<SystemDefinition> sysdef
     {
     m_exec_conf->msg->notice(5) << "Constructing UpdaterClusters" << std::endl;
 
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     m_G.setTaskArena(sysdef->getParticleData()->getExecConf()->getTaskArena());
     #endif
 
@@ -494,7 +414,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
         }
     img_i = box.getImage(pos_i_transf);
 
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for(tbb::blocked_range<unsigned int>(0, this->m_pdata->getNTypes()),
         [=, &shape_i](const tbb::blocked_range<unsigned int>& x) {
@@ -507,7 +427,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
             {
             continue;
             }
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         tbb::parallel_for(tbb::blocked_range<unsigned int>(type_a, this->m_pdata->getNTypes()),
             [=, &shape_i](const tbb::blocked_range<unsigned int>& w) {
         for (unsigned int type_b = w.begin(); type_b != w.end(); ++type_b)
@@ -655,7 +575,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
                 }
 
             // for every depletant
-            #ifdef ENABLE_TBB_TASK
+            #ifdef ENABLE_TBB
             tbb::parallel_for(tbb::blocked_range<unsigned int>(0, (unsigned int)n),
                 [=, &shape_i,
                     &pos_j, &orientation_j, &type_j, &V_all,
@@ -1043,23 +963,20 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
                         if ((overlap_i_a && !overlap_transf_a && overlap_j_b) || (overlap_i_b && !overlap_transf_b & overlap_j_a))
                             {
                             // add bond
-                            this->m_overlap.insert(std::make_pair(i,idx_j[m]));
-
-                            // since i<=j by construction, make matrix symmetric explicitly
-                            this->m_overlap.insert(std::make_pair(idx_j[m],i));
+                            this->m_G.addEdge(i,idx_j[m]);
                             }
                         }
                     } // end loop over intersections
                 } // end loop over depletants
-            #ifdef ENABLE_TBB_TASK
+            #ifdef ENABLE_TBB
                 });
             #endif
             } // end loop over type_b
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             });
         #endif
         } // end loop over type_a
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         });
     }); // end task arena execute()
     #endif
@@ -1165,9 +1082,6 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
     Index2D overlap_idx = m_mc->getOverlapIndexer();
     ArrayHandle<unsigned int> h_overlaps(m_mc->getInteractionMatrix(), access_location::host, access_mode::read);
 
-    // clear the local bond and rejection lists
-    m_overlap.clear();
-
     Scalar r_cut_patch(0.0);
     if (m_mc->hasPairInteractions())
         {
@@ -1192,7 +1106,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
     if (m_mc->hasPairInteractions())
         {
         // test old configuration against itself
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         this->m_exec_conf->getTaskArena()->execute([&]{
         tbb::parallel_for((unsigned int)0,this->m_pdata->getN(), [&](unsigned int i)
         #else
@@ -1286,14 +1200,14 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
                 } // end loop over images
 
             } // end loop over old configuration
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             );
         }); // end task arena execute()
         #endif
         }
 
     // loop over new configuration
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for((unsigned int)0,nptl, [&](unsigned int i)
     #else
@@ -1356,7 +1270,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
                                     && test_overlap(r_ij, shape_i, shape_j, err))
                                     {
                                     // add connection
-                                    m_overlap.insert(std::make_pair(i,j));
+                                    m_G.addEdge(i,j);
                                     } // end if overlap
                                 }
 
@@ -1452,7 +1366,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
                 } // end loop over images
             } // end if patch
         } // end loop over local particles
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         );
     }); // end task arena execute()
     #endif
@@ -1476,7 +1390,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
         return;
 
     // test old configuration against itself
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for((unsigned int)0,this->m_pdata->getN(), [&](unsigned int i) {
     #else
@@ -1494,7 +1408,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
             h_overlaps.data, h_fugacity.data,
             timestep, q, pivot, line);
         }
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         });
     }); // end task arena execute()
     #endif
@@ -1623,39 +1537,18 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
     // signal that AABB tree is invalid
     m_mc->invalidateAABBTree();
 
-    // determine which particles interact
-    findInteractions(timestep, q, pivot, line);
-
-    // resize the number of graph nodes in place
+    // remove the edges of the previous step, the graph is undirected because the symmetry
+    // operation is self-inverse
     m_G.resize(this->m_pdata->getN());
 
-    #ifdef ENABLE_TBB_TASK
-    this->m_exec_conf->getTaskArena()->execute([&]{
-    tbb::parallel_for(m_overlap.range(), [&] (decltype(m_overlap.range()) r)
-    #else
-    auto &r = m_overlap;
-    #endif
-        {
-        for (auto it = r.begin(); it != r.end(); ++it)
-            {
-            unsigned int i = it->first;
-            unsigned int j = it->second;
-
-            // we're adding a directed edge, but the actual graph will be undirected
-            // if the symmetry operation is self-inverse
-            m_G.addEdge(i,j);
-            }
-        }
-    #ifdef ENABLE_TBB_TASK
-        );
-    }); // end task arena execute()
-    #endif
+    // determine which particles interact and add the overlapping pairs to the graph
+    findInteractions(timestep, q, pivot, line);
 
     if (m_mc->hasPairInteractions())
         {
         // sum up interaction energies
-        #ifdef ENABLE_TBB_TASK
-        tbb::concurrent_unordered_map< std::pair<unsigned int, unsigned int>, LongReal> delta_U;
+        #ifdef ENABLE_TBB
+        tbb::concurrent_unordered_map< std::pair<unsigned int, unsigned int>, LongReal, detail::PairHash> delta_U;
         #else
         std::map< std::pair<unsigned int, unsigned int>, LongReal> delta_U;
         #endif
@@ -1694,7 +1587,7 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
             delta_U[p] = delU;
             }
 
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         this->m_exec_conf->getTaskArena()->execute([&]{
         tbb::parallel_for(delta_U.range(), [&] (decltype(delta_U.range()) r)
         #else
@@ -1719,7 +1612,7 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
                     }
                 }
             }
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             );
         }); // end task arena execute()
         #endif
@@ -44,8 +44,8 @@ void UpdaterQuickCompress::update(uint64_t timestep)
     Updater::update(timestep);
     m_exec_conf->msg->notice(10) << "UpdaterQuickCompress: " << timestep << std::endl;
 
-    // count the number of overlaps in the current configuration
-    auto n_overlaps = m_mc->countOverlaps(false);
+    // test for overlaps in the current configuration
+    auto n_overlaps = m_mc->countOverlaps(true);
     BoxDim current_box = m_pdata->getGlobalBox();
     BoxDim target_box = BoxDim((*m_target_box)(timestep));
     if (n_overlaps == 0 && current_box != target_box)
@@ -69,6 +69,25 @@ void UpdaterQuickCompress::performBoxScale(uint64_t timestep, const BoxDim& targ
 
     // Make a backup copy of position data
     unsigned int N_backup = m_pdata->getN();
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        // keep the backup on the device where the integrator counts the overlaps
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> d_pos_backup(m_pos_backup,
+                                          access_location::device,
+                                          access_mode::overwrite);
+        hipMemcpy(d_pos_backup.data,
+                  d_pos.data,
+                  sizeof(Scalar4) * N_backup,
+                  hipMemcpyDeviceToDevice);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+    else
+#endif
         {
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
@@ -83,17 +102,42 @@ void UpdaterQuickCompress::performBoxScale(uint64_t timestep, const BoxDim& targ
     Scalar3 new_origin = m_pdata->getOrigin();
     Scalar3 origin_shift = new_origin - old_origin;
 
-    auto n_overlaps = m_mc->countOverlaps(false);
-    if (n_overlaps > m_max_overlaps_per_particle * m_pdata->getNGlobal())
+    // only the decision matters, so stop counting once there are too many overlaps
+    auto max_overlaps
+        = static_cast<unsigned int>(m_max_overlaps_per_particle * m_pdata->getNGlobal());
+    auto n_overlaps = m_mc->countOverlapsUpTo(max_overlaps);
+    if (n_overlaps > max_overlaps)
         {
         // the box move generated too many overlaps, undo the move
-        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                   access_location::host,
-                                   access_mode::readwrite);
-        ArrayHandle<Scalar4> h_pos_backup(m_pos_backup, access_location::host, access_mode::read);
         unsigned int N = m_pdata->getN();
         assert(N == N_backup);
-        memcpy(h_pos.data, h_pos_backup.data, sizeof(Scalar4) * N);
+#ifdef ENABLE_HIP
+        if (m_exec_conf->isCUDAEnabled())
+            {
+            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+            ArrayHandle<Scalar4> d_pos_backup(m_pos_backup,
+                                              access_location::device,
+                                              access_mode::read);
+            hipMemcpy(d_pos.data,
+                      d_pos_backup.data,
+                      sizeof(Scalar4) * N,
+                      hipMemcpyDeviceToDevice);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+        else
+#endif
+            {
+            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                       access_location::host,
+                                       access_mode::readwrite);
+            ArrayHandle<Scalar4> h_pos_backup(m_pos_backup,
+                                              access_location::host,
+                                              access_mode::read);
+            memcpy(h_pos.data, h_pos_backup.data, sizeof(Scalar4) * N);
+            }
         m_pdata->setGlobalBox(old_box);
         m_pdata->translateOrigin(-origin_shift);
 
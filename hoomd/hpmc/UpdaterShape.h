@@ -318,8 +318,9 @@ template<class Shape> void UpdaterShape<Shape>::update(uint64_t timestep)
             // actually update the shape parameter in the integrator
             m_mc->setParam(typ_i, shape_param_new);
 
-            // check if at least one overlap was caused
-            bool overlaps = static_cast<bool>(m_mc->countOverlaps(true));
+            // check if at least one overlap was caused, only the particles of this type can
+            // overlap with a new shape
+            bool overlaps = m_mc->hasOverlapsWithType(typ_i);
             // automatically reject if there are overlaps
             if (overlaps)
                 {
@@ -302,7 +302,8 @@ class SDF(Compute):
         values and step discontinuities.
 
     Note:
-        `SDF` always runs on the CPU.
+        On GPU devices, `SDF` counts hard particle overlaps on the GPU. It runs
+        on the CPU when the integrator has pair potentials.
 
     .. rubric:: Mixed precision
 
@@ -311,9 +312,11 @@ class SDF(Compute):
 
     .. rubric:: Box images
 
-    `SDF` does not apply the minimum image convention. It supports small boxes
-    where particles may overlap with non-primary images of other particles,
-    including self overlap.
+    On CPU devices, `SDF` does not apply the minimum image convention. It
+    supports small boxes where particles may overlap with non-primary images of
+    other particles, including self overlap. On GPU devices, `SDF` applies the
+    minimum image convention and runs on the CPU when the box is too small for
+    it.
 
     Attributes:
         xmax (float): Maximum *x* value at the right hand side of the rightmost
@@ -337,15 +340,21 @@ class SDF(Compute):
 
         # Extract 'Shape' from '<hoomd.hpmc.integrate.Shape object>'
         integrator_name = integrator.__class__.__name__
+        sys_def = self._simulation.state._cpp_sys_def
 
-        cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name)
-
-        self._cpp_obj = cpp_cls(
-            self._simulation.state._cpp_sys_def,
-            integrator._cpp_obj,
-            self.xmax,
-            self.dx,
-        )
+        if (isinstance(self._simulation.device, hoomd.device.GPU)
+                and ('ComputeSDF' + integrator_name + 'GPU') in _hpmc.__dict__):
+            cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name + 'GPU')
+            self._cpp_obj = cpp_cls(sys_def, integrator._cpp_obj, self.xmax,
+                                    self.dx, _hoomd.CellListGPU(sys_def))
+        else:
+            cpp_cls = getattr(_hpmc, 'ComputeSDF' + integrator_name)
+            self._cpp_obj = cpp_cls(
+                sys_def,
+                integrator._cpp_obj,
+                self.xmax,
+                self.dx,
+            )
 
     @log(category='sequence', requires_run=True)
     def sdf_compression(self):
@@ -10,6 +10,7 @@ Set :math:`U_{\\mathrm{external},i}` evaluated in
 import hoomd
 from hoomd.wall import _WallsMetaList
 from hoomd.data.syncedlist import identity
+from hoomd.data.parameterdicts import ParameterDict
 from hoomd.hpmc.external.field import ExternalField
 from hoomd.logging import log
 from hoomd import hpmc
@@ -88,6 +89,8 @@ class WallPotential(ExternalField):
     Args:
         walls (`list` [`hoomd.wall.WallGeometry` ]): A list of wall definitions
             that confine particles to specific regions of space.
+        cache_distances (bool): When `True`, cache the distance from each
+            particle to the nearest wall.
 
     `WallPotential` adds hard walls to HPMC simulations. Define the wall
     geometry with a collection of `wall.WallGeometry` objects.  These walls
@@ -132,6 +135,14 @@ class WallPotential(ExternalField):
     are not implemented. See the individual subclasses of
     `hoomd.hpmc.integrate.HPMCIntegrator` for their wall support.
 
+    When `cache_distances` is `True`, `WallPotential` stores each particle's
+    position and the distance from it to the nearest wall after a trial move
+    passes the wall checks. Later trial moves that keep the particle's
+    circumsphere within that distance of the stored position skip the wall
+    checks. The cache is exact: it changes only how fast the checks are, not
+    which moves are accepted. Enable it in confined systems where most
+    particles are far from the walls compared to the move size.
+
     Note:
         `WallPotential` does not support execution on GPUs.
 
@@ -145,10 +156,15 @@ class WallPotential(ExternalField):
         wall_potential = hoomd.hpmc.external.wall.WallPotential(walls)
         mc.external_potential = wall_potential
 
+    Attributes:
+        cache_distances (bool): When `True`, cache the distance from each
+            particle to the nearest wall.
     """
 
-    def __init__(self, walls):
+    def __init__(self, walls, cache_distances=False):
         self._walls = _HPMCWallsMetaList(self, walls, _to_hpmc_cpp_wall)
+        self._param_dict.update(
+            ParameterDict(cache_distances=bool(cache_distances)))
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.GPU):
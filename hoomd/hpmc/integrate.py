@@ -100,7 +100,9 @@ implementations, trial moves are performed in parallel for particles in active
 domains while leaving particles on the border fixed (see `Anderson 2016
 <https://dx.doi.org/10.1016/j.cpc.2016.02.024>`_ for a full description). As a
 consequence, a single timestep may perform more or less than ``nselect`` trial
-moves per particle when using the parallel code paths. Monitor the number of
+moves per particle when using the parallel code paths. The threaded CPU
+implementation performs ``nselect`` trial moves per particle, but rejects
+trial moves that leave the particle's checkerboard cell. Monitor the number of
 trial moves performed with `HPMCIntegrator.translate_moves` and
 `HPMCIntegrator.rotate_moves`.
 
@@ -313,12 +315,20 @@ class HPMCIntegrator(Integrator):
 
     .. rubric:: Threading
 
-    HPMC integrators use threaded execution on multiple CPU cores only when
-    placing implicit depletants (``depletant_fugacity != 0``).
+    When ``num_cpu_threads > 1``, HPMC integrators sweep over the particles in
+    parallel on a single MPI rank. The integrator divides the box into a
+    checkerboard of cells that are at least as wide as the largest interaction
+    range and moves particles in cells of the same color concurrently. The
+    threaded sweep is not used with external potentials or implicit
+    depletants, in domain decomposed simulations, or when the box is too small
+    to fit 4 cells along each dimension. In these cases, HPMC integrators use
+    threads only when placing implicit depletants
+    (``depletant_fugacity != 0``).
 
     .. deprecated:: 4.4.0
 
-        ``num_cpu_threads >= 1`` is deprecated. Set ``num_cpu_threads = 1``.
+        ``num_cpu_threads >= 1`` with implicit depletants is deprecated. Set
+        ``num_cpu_threads = 1``.
 
     .. rubric:: Mixed precision
 
@@ -363,6 +373,25 @@ class HPMCIntegrator(Integrator):
         nselect (int): Number of trial moves to perform per particle per
             timestep.
 
+        cache_pair_energies (bool): Set to `True` to cache the pair energy of
+            each particle from `pair_potentials` in the serial CPU sweep
+            (**default:** `False`). Trial moves then search for neighbors only
+            in the trial configuration, which speeds up simulations of soft
+            potentials with low acceptance ratios. The cache is not used on
+            the GPU, in the threaded sweep, or with a user defined pair
+            potential.
+
+        nproposal (int): Number of trial moves the GPU proposes concurrently
+            for each particle in each of the ``nselect`` sweeps
+            (**default:** 1). The integrator takes the first proposal that
+            does not overlap. It accepts a later proposal only when it and all
+            earlier proposals are translations and the earlier ones lie within
+            ``d`` of it, which makes the selection a delayed rejection scheme
+            that preserves detailed balance. Values larger than 1 trade spare
+            GPU width for a higher acceptance ratio in dense systems of hard
+            particles. The GPU ignores `nproposal` with depletants or a patch
+            energy, and the CPU ignores it entirely.
+
     .. rubric:: Attributes
     """
     _ext_module = _hpmc
@@ -377,7 +406,9 @@ class HPMCIntegrator(Integrator):
         # Set base parameter dict for hpmc integrators
         param_dict = ParameterDict(
             translation_move_probability=float(translation_move_probability),
-            nselect=int(nselect))
+            nselect=int(nselect),
+            cache_pair_energies=False,
+            nproposal=1)
         self._param_dict.update(param_dict)
         self._pair_potential = None
         self._external_potential = None
@@ -20,6 +20,7 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
 #endif
@@ -47,6 +48,7 @@ void export_sphere(pybind11::module& m)
 #ifdef ENABLE_HIP
     export_IntegratorHPMCMonoGPU<ShapeSphere>(m, "IntegratorHPMCMonoSphereGPU");
     export_ComputeFreeVolumeGPU<ShapeSphere>(m, "ComputeFreeVolumeSphereGPU");
+    export_ComputeSDFGPU<ShapeSphere>(m, "ComputeSDFSphereGPU");
     export_UpdaterClustersGPU<ShapeSphere>(m, "UpdaterClustersSphereGPU");
 #endif
     }
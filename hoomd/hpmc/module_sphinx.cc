@@ -19,6 +19,7 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
 #endif
@@ -47,6 +48,7 @@ void export_sphinx(pybind11::module& m)
 
     export_IntegratorHPMCMonoGPU<ShapeSphinx>(m, "IntegratorHPMCMonoSphinxGPU");
     export_ComputeFreeVolumeGPU<ShapeSphinx>(m, "ComputeFreeVolumeSphinxGPU");
+    export_ComputeSDFGPU<ShapeSphinx>(m, "ComputeSDFSphinxGPU");
     export_UpdaterClustersGPU<ShapeSphinx>(m, "UpdaterClustersSphinxGPU");
 
 #endif
@@ -19,6 +19,7 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
 #endif
@@ -63,6 +64,9 @@ void export_union_convex_polyhedron(pybind11::module& m)
     export_ComputeFreeVolumeGPU<ShapeUnion<ShapeSpheropolyhedron>>(
         m,
         "ComputeFreeVolumeConvexPolyhedronUnionGPU");
+    export_ComputeSDFGPU<ShapeUnion<ShapeSpheropolyhedron>>(
+        m,
+        "ComputeSDFConvexSpheropolyhedronUnionGPU");
     export_UpdaterClustersGPU<ShapeUnion<ShapeSpheropolyhedron>>(
         m,
         "UpdaterClustersConvexSpheropolyhedronUnionGPU");
@@ -19,6 +19,7 @@
 
 #ifdef ENABLE_HIP
 #include "ComputeFreeVolumeGPU.h"
+#include "ComputeSDFGPU.h"
 #include "IntegratorHPMCMonoGPU.h"
 #include "UpdaterClustersGPU.h"
 #endif
@@ -60,6 +61,9 @@ void export_union_faceted_ellipsoid(pybind11::module& m)
     export_ComputeFreeVolumeGPU<ShapeUnion<ShapeFacetedEllipsoid>>(
         m,
         "ComputeFreeVolumeFacetedEllipsoidUnionGPU");
+    export_ComputeSDFGPU<ShapeUnion<ShapeFacetedEllipsoid>>(
+        m,
+        "ComputeSDFFacetedEllipsoidUnionGPU");
     export_UpdaterClustersGPU<ShapeUnion<ShapeFacetedEllipsoid>>(
         m,
         "UpdaterClustersFacetedEllipsoidUnionGPU");
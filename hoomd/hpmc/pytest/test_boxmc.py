@@ -252,6 +252,36 @@ def test_disk_compression(betaP, box_move, simulation_factory,
     assert sim.state.box != initial_box
 
 
+@pytest.mark.parametrize("mode", ['standard', 'ln'])
+def test_ellipsoid_volume_moves(mode, simulation_factory,
+                                lattice_snapshot_factory):
+    """Test that volume moves of ellipsoids in a tilted box create no overlaps.
+
+    Isotropic expansions skip the overlap check for ellipsoids.
+    """
+    snap = lattice_snapshot_factory(dimensions=3, n=6, a=1.1)
+    if snap.communicator.rank == 0:
+        box = hoomd.Box.from_box([6.6, 6.6, 6.6, 0.2, 0.1, 0.3])
+        fractions = snap.particles.position / 6.6
+        snap.particles.position[:] = fractions @ box.to_matrix().T
+        snap.configuration.box = box
+
+    boxmc = hoomd.hpmc.update.BoxMC(betaP=1, trigger=1)
+    boxmc.volume = dict(mode=mode, weight=1, delta=0.1 if mode == 'ln' else 5)
+
+    sim = simulation_factory(snap)
+    sim.operations.updaters.append(boxmc)
+    mc = hoomd.hpmc.integrate.Ellipsoid(default_d=0.05, default_a=0.05)
+    mc.shape['A'] = dict(a=0.5, b=0.4, c=0.25)
+    sim.operations.integrator = mc
+
+    sim.run(50)
+
+    accepted, rejected = boxmc.volume_moves
+    assert accepted > 0
+    assert mc.overlaps == 0
+
+
 @pytest.mark.parametrize("box_move", box_moves_attrs)
 def test_counters(box_move, simulation_factory, lattice_snapshot_factory,
                   counter_attrs):
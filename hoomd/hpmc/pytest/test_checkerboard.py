@@ -0,0 +1,45 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test the threaded checkerboard sweep of the CPU HPMC integrators."""
+
+import hoomd
+import numpy
+import pytest
+
+
+@pytest.mark.parametrize("dimensions", [2, 3])
+def test_checkerboard_sweep(dimensions, cpu_simulation_factory):
+    """Check that threaded sweeps perform all trial moves without overlaps."""
+    n = 8
+    spacing = 1.5
+    L = n * spacing
+
+    snap = hoomd.Snapshot()
+    snap.particles.types = ['A']
+    x = (numpy.arange(n) + 0.5) * spacing - L / 2
+    if dimensions == 3:
+        positions = numpy.array(numpy.meshgrid(x, x, x)).reshape(3, -1).T
+        snap.configuration.box = [L, L, L, 0, 0, 0]
+    else:
+        positions = numpy.array(numpy.meshgrid(x, x, [0])).reshape(3, -1).T
+        snap.configuration.box = [L, L, 0, 0, 0, 0]
+    snap.particles.N = len(positions)
+    snap.particles.position[:] = positions
+
+    sim = cpu_simulation_factory(snap, num_cpu_threads=4, seed=4)
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.2, nselect=4)
+    mc.shape['A'] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+
+    steps = 20
+    sim.run(steps)
+
+    assert mc.overlaps == 0
+    assert sum(mc.translate_moves) == 4 * snap.particles.N * steps
+    assert mc.translate_moves[0] > 0
+
+    # particles moved away from the lattice sites
+    assert not numpy.allclose(sim.state.get_snapshot().particles.position,
+                              positions)
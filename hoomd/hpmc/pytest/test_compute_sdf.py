@@ -242,7 +242,7 @@ def test_values(simulation_factory, lattice_snapshot_factory):
 
 
 @pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
-@pytest.mark.cpu  # SDF runs on the CPU only, no need to test on the GPU
+@pytest.mark.cpu  # SDF with pair potentials runs on the CPU only
 def test_linear_search_path(simulation_factory, two_particle_snapshot_factory):
     """Test that adding patches changes the pressure calculation.
 
@@ -377,6 +377,60 @@ def test_sdf_expansion(simulation_factory, two_particle_snapshot_factory):
     assert sdf_expansion[-1] != 0
 
 
+def _square_sdf(sim, integrator_cls=hoomd.hpmc.integrate.ConvexPolygon):
+    """Compute the compression and expansion SDF of squares."""
+    mc = integrator_cls(default_d=0.1)
+    mc.shape["A"] = {
+        'vertices': [(-0.5, -0.5), (0.5, -0.5), (0.5, 0.5), (-0.5, 0.5)]
+    }
+    sim.operations.add(mc)
+
+    sdf = hoomd.hpmc.compute.SDF(xmax=0.02, dx=1e-4)
+    sim.operations.add(sdf)
+    sim.run(0)
+
+    return sdf.sdf_compression, sdf.sdf_expansion
+
+
+def test_threaded_histogram(lattice_snapshot_factory, compare_cpu_threads):
+    """Test that per-thread histograms sum to the serial histogram."""
+    snapshot = lattice_snapshot_factory(dimensions=2, n=16, a=1.01, r=0.004)
+
+    serial, _ = compare_cpu_threads(snapshot,
+                                     _square_sdf,
+                                     rtol=1e-7,
+                                     atol=0,
+                                     seed=10)
+    assert numpy.count_nonzero(serial[0]) > 0
+
+
+@pytest.mark.gpu
+@pytest.mark.serial
+@pytest.mark.parametrize("integrator_cls", [
+    hoomd.hpmc.integrate.ConvexPolygon,
+    hoomd.hpmc.integrate.SimplePolygon,
+])
+def test_gpu_histogram(simulation_factory, lattice_snapshot_factory,
+                       integrator_cls):
+    """Test that the GPU histograms match the CPU histograms.
+
+    ConvexPolygon uses the binary search, SimplePolygon the linear search over
+    compressions and expansions.
+    """
+    snapshot = lattice_snapshot_factory(dimensions=2, n=16, a=1.01, r=0.004)
+
+    cpu_sim = hoomd.Simulation(device=hoomd.device.CPU(), seed=10)
+    cpu_sim.create_state_from_snapshot(snapshot)
+    results = [
+        _square_sdf(simulation_factory(snapshot), integrator_cls),
+        _square_sdf(cpu_sim, integrator_cls)
+    ]
+
+    assert numpy.count_nonzero(results[1][0]) > 0
+    numpy.testing.assert_allclose(results[0][0], results[1][0])
+    numpy.testing.assert_allclose(results[0][1], results[1][1])
+
+
 def test_logging():
     logging_check(
         hoomd.hpmc.compute.SDF, ('hpmc', 'compute'), {
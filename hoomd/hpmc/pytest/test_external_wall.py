@@ -578,3 +578,40 @@ def test_overlaps(simulation_factory, one_particle_snapshot_factory,
     mc.shape['A'] = shapedef
     sim.run(0)
     assert (mc.external_potential.overlaps > 0) == expecting_overlap
+
+
+@pytest.mark.cpu
+def test_cache_distances(simulation_factory, lattice_snapshot_factory):
+    """Test that caching the wall distances does not change the trajectory."""
+    wall_list = [
+        hoomd.wall.Sphere(4.0),
+        hoomd.wall.Cylinder(3.5, (0, 0, 1)),
+        hoomd.wall.Plane((0, 0, -2.5), (0, 0, 1))
+    ]
+
+    def run(cache_distances):
+        snap = lattice_snapshot_factory(n=4, a=1.1)
+        if snap.communicator.rank == 0:
+            snap.configuration.box = [12, 12, 12, 0, 0, 0]
+        sim = simulation_factory(snap)
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.1)
+        mc.shape['A'] = dict(diameter=1.0)
+        walls = hoomd.hpmc.external.wall.WallPotential(
+            wall_list, cache_distances=cache_distances)
+        mc.external_potential = walls
+        sim.operations.integrator = mc
+        sim.run(0)
+        assert walls.overlaps == 0
+        assert walls.cache_distances == cache_distances
+
+        sim.run(200)
+        assert walls.overlaps == 0
+        return sim.state.get_snapshot(), mc.translate_moves
+
+    snap_ref, moves_ref = run(False)
+    snap, moves = run(True)
+
+    assert moves == moves_ref
+    if snap.communicator.rank == 0:
+        np.testing.assert_allclose(snap.particles.position,
+                                   snap_ref.particles.position)
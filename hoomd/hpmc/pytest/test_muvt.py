@@ -349,3 +349,57 @@ def test_cylindrical_wall_insertion(device, simulation_factory,
 
     # We should have successfully attempted some removes
     assert sum(muvt.remove_moves) > 0
+
+
+@pytest.mark.gpu
+@pytest.mark.serial
+def test_gpu_sweep_refits_host_tree(device, simulation_factory,
+                                    lattice_snapshot_factory, capsys):
+    """Test that host queries after GPU sweeps refit the AABB tree.
+
+    UpdaterMuVT queries the host AABB tree between GPU sweeps. The GPU sweep
+    keeps the particle indices, so the next query refits the tree to the new
+    positions instead of building it again. The overlaps found with the
+    refitted tree must match a brute force search of the final positions.
+    """
+    snapshot = lattice_snapshot_factory(a=1.5, n=4)
+    if snapshot.communicator.rank == 0:
+        # a pair of overlapping particles among free ones
+        snapshot.particles.position[1] = snapshot.particles.position[0] + [
+            0.4, 0, 0
+        ]
+    sim = simulation_factory(snapshot)
+
+    # particle sorting rebuilds the tree, exercise only the sweep
+    sim.operations.tuners.clear()
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0.0)
+    mc.shape["A"] = dict(diameter=1.0)
+    sim.operations.integrator = mc
+    sim.run(0)
+
+    # build the tree once so that the next sweep can mark it refittable
+    assert mc.map_overlaps == [(0, 1)]
+
+    sim.run(10)
+    assert mc.translate_moves[0] > 0
+
+    capsys.readouterr()
+    sim.device.notice_level = 8
+    try:
+        overlaps = mc.map_overlaps
+    finally:
+        sim.device.notice_level = 2
+    assert "Refit AABB tree" in capsys.readouterr().out
+
+    snapshot = sim.state.get_snapshot()
+    L = snapshot.configuration.box[0]
+    pos = snapshot.particles.position
+    reference = []
+    for i in range(snapshot.particles.N):
+        dx = pos[i + 1:] - pos[i]
+        dx -= L * numpy.round(dx / L)
+        for j in numpy.nonzero(numpy.linalg.norm(dx, axis=1) < 1.0)[0]:
+            reference.append((i, i + 1 + j))
+
+    assert sorted(tuple(pair) for pair in overlaps) == reference
@@ -4,6 +4,7 @@
 """Test hoomd.hpmc.pair.LennardJones and HPMC pair infrastructure."""
 
 import hoomd
+import numpy
 import pytest
 
 valid_constructor_args = [
@@ -206,6 +207,50 @@ def test_multiple_pair_potentials(mc_simulation_factory):
         expected=-3.0, rel=1e-5)
 
 
+def _run_lennard_jones_fluid(cpu_simulation_factory, cache_pair_energies):
+    """Run a small Lennard-Jones fluid and return the final snapshot."""
+    n = 6
+    spacing = 1.2
+    L = n * spacing
+
+    snap = hoomd.Snapshot()
+    snap.particles.types = ['A']
+    x = (numpy.arange(n) + 0.5) * spacing - L / 2
+    positions = numpy.array(numpy.meshgrid(x, x, x)).reshape(3, -1).T
+    snap.configuration.box = [L, L, L, 0, 0, 0]
+    snap.particles.N = len(positions)
+    snap.particles.position[:] = positions
+
+    # the cache is only used in the serial sweep
+    sim = cpu_simulation_factory(snap, num_cpu_threads=1, seed=3)
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.2, nselect=2)
+    mc.shape['A'] = dict(diameter=0)
+    mc.cache_pair_energies = cache_pair_energies
+    lennard_jones = hoomd.hpmc.pair.LennardJones()
+    lennard_jones.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0, r_cut=2.5)
+    mc.pair_potentials = [lennard_jones]
+    sim.operations.integrator = mc
+
+    sim.run(20)
+    return sim.state.get_snapshot(), mc.translate_moves, mc.pair_energy
+
+
+def test_cache_pair_energies(cpu_simulation_factory):
+    """Check that cached pair energies reproduce the uncached trajectory."""
+    snap, moves, energy = _run_lennard_jones_fluid(cpu_simulation_factory,
+                                                   cache_pair_energies=False)
+    snap_cached, moves_cached, energy_cached = _run_lennard_jones_fluid(
+        cpu_simulation_factory, cache_pair_energies=True)
+
+    assert moves_cached == moves
+    assert moves[0] > 0 and moves[1] > 0
+    numpy.testing.assert_allclose(snap_cached.particles.position,
+                                  snap.particles.position,
+                                  rtol=1e-6)
+    assert energy_cached == pytest.approx(energy, rel=1e-6)
+
+
 def test_logging():
     hoomd.conftest.logging_check(
         hoomd.hpmc.pair.LennardJones, ('hpmc', 'pair'), {
@@ -741,3 +741,21 @@ def test_fugacity(simulation_factory, two_particle_snapshot_factory,
     sim = simulation_factory(two_particle_snapshot_factory())
     sim.operations.integrator = mc
     sim.run(2)
+
+
+def test_nproposal(simulation_factory, lattice_snapshot_factory):
+    mc = hoomd.hpmc.integrate.Sphere(d=0.2)
+    mc.shape['A'] = dict(diameter=1)
+    assert mc.nproposal == 1
+
+    mc.nproposal = 4
+    sim = simulation_factory(lattice_snapshot_factory(a=1.1))
+    sim.operations.integrator = mc
+    sim.run(10)
+
+    assert mc.nproposal == 4
+    assert sum(mc.translate_moves) > 0
+    assert mc.overlaps == 0
+
+    with pytest.raises(ValueError):
+        mc.nproposal = 0
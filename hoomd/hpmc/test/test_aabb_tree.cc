@@ -6,6 +6,7 @@
 HOOMD_UP_MAIN();
 
 #include "hoomd/AABBTree.h"
+#include "hoomd/WideAABBTree.h"
 
 #include <algorithm>
 #include <iostream>
@@ -105,3 +106,143 @@ UP_TEST(bigger)
         UP_ASSERT(in(i, hits));
         }
     }
+
+UP_TEST(refit)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 7));
+
+    std::vector<vec3<Scalar>> points(N);
+    std::vector<AABB> aabbs(N);
+    AABB build_aabbs[N];
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(100);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        build_aabbs[i] = aabbs[i];
+        }
+
+    // buildTree modifies its input
+    AABBTree tree;
+    tree.buildTree(build_aabbs, N);
+    UP_ASSERT_EQUAL(tree.getNumParticles(), N);
+    Scalar build_area = tree.getSurfaceArea();
+
+    // refitting to the same AABBs does not change the tree
+    tree.refit(aabbs.data(), N);
+    MY_CHECK_CLOSE(tree.getSurfaceArea(), build_area, tol);
+
+    // move the points and refit, ensure that they are all found at their new positions
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5),
+                                  hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5),
+                                  hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5));
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        }
+    tree.refit(aabbs.data(), N);
+
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        tree.query(hits, AABB(points[i], Scalar(0.01)));
+        UP_ASSERT(in(i, hits));
+        }
+
+    // refit shrinks nodes: growing the AABBs with update and refitting to the original AABBs
+    // restores the original area
+    Scalar refit_area = tree.getSurfaceArea();
+    for (unsigned int i = 0; i < N; i++)
+        {
+        tree.update(i, AABB(points[i], Scalar(5.0)));
+        }
+    UP_ASSERT(tree.getSurfaceArea() > refit_area);
+    tree.refit(aabbs.data(), N);
+    MY_CHECK_CLOSE(tree.getSurfaceArea(), refit_area, tol);
+
+    // moving a single particle across the box degrades the quality of the tree
+    points[0] += vec3<Scalar>(100, 100, 100);
+    aabbs[0] = AABB(points[0], Scalar(1.0));
+    tree.refit(aabbs.data(), N);
+    UP_ASSERT(tree.getSurfaceArea() > refit_area);
+    hits.clear();
+    tree.query(hits, AABB(points[0], Scalar(0.01)));
+    UP_ASSERT(in(0, hits));
+    }
+
+UP_TEST(wide)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(4, 5, 8));
+
+    std::vector<vec3<Scalar>> points(N);
+    AABB aabbs[N];
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(100);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        aabbs[i].tag = N - i;
+        }
+
+    AABBTree tree;
+    tree.buildTree(aabbs, N);
+    WideAABBTree wide_tree;
+    wide_tree.build(tree);
+    UP_ASSERT_EQUAL(wide_tree.getNumParticles(), N);
+    UP_ASSERT(wide_tree.getNumNodes() < tree.getNumNodes());
+
+    // the wide tree finds the same particles as the binary tree, with their tags
+    auto check_queries = [&]()
+    {
+        std::vector<unsigned int> hits;
+        std::vector<unsigned int> wide_hits;
+        for (unsigned int i = 0; i < N; i++)
+            {
+            AABB query(points[i], Scalar(3.0));
+            hits.clear();
+            tree.query(hits, query);
+            wide_hits.clear();
+            wide_tree.query(query,
+                            [&](unsigned int j, unsigned int tag)
+                            {
+                                UP_ASSERT_EQUAL(tag, N - j);
+                                wide_hits.push_back(j);
+                                return true;
+                            });
+            std::sort(hits.begin(), hits.end());
+            std::sort(wide_hits.begin(), wide_hits.end());
+            UP_ASSERT(hits == wide_hits);
+            UP_ASSERT(in(i, wide_hits));
+            }
+    };
+    check_queries();
+
+    // move the points with update in both trees
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng),
+                                  hoomd::detail::generate_canonical<float>(rng));
+        AABB aabb(points[i], Scalar(1.0));
+        tree.update(i, aabb);
+        wide_tree.update(i, aabb);
+        }
+    check_queries();
+
+    // returning false stops the traversal
+    unsigned int n_visited = 0;
+    wide_tree.query(AABB(vec3<Scalar>(50, 50, 50), Scalar(100.0)),
+                    [&](unsigned int, unsigned int)
+                    {
+                        n_visited++;
+                        return false;
+                    });
+    UP_ASSERT_EQUAL(n_visited, 1);
+    }
@@ -84,6 +84,32 @@ UP_TEST(support)
     UP_ASSERT(v1 == v2);
     }
 
+UP_TEST(support_many_verts)
+    {
+    // Check the support function on vertex counts that do not fill the SIMD channels. Vertices
+    // are on a unit sphere, so the support in the direction of any vertex is that vertex.
+    for (unsigned int N = 5; N <= 61; N++)
+        {
+        vector<vec3<ShortReal>> vlist;
+        for (unsigned int i = 0; i < N; i++)
+            {
+            // Fibonacci sphere
+            ShortReal z = ShortReal(1.0) - ShortReal(2 * i + 1) / ShortReal(N);
+            ShortReal r = sqrt(ShortReal(1.0) - z * z);
+            ShortReal phi = ShortReal(2.399963229728653) * ShortReal(i);
+            vlist.push_back(vec3<ShortReal>(r * cos(phi), r * sin(phi), z));
+            }
+        PolyhedronVertices verts(vlist, 0, 0);
+        SupportFuncConvexPolyhedron sa = SupportFuncConvexPolyhedron(verts);
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            UP_ASSERT(sa(vlist[i]) == vlist[i]);
+            UP_ASSERT(sa(ShortReal(3.0) * vlist[i]) == vlist[i]);
+            }
+        }
+    }
+
 UP_TEST(overlap_octahedron_no_rot)
     {
     // first set of simple overlap checks is two octahedra at unit orientation
@@ -0,0 +1,145 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifdef ENABLE_MPI
+
+#include "hoomd/test/upp11_config.h"
+HOOMD_UP_MAIN()
+
+#include "hoomd/Communicator.h"
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/SystemDefinition.h"
+
+#include "hoomd/hpmc/IntegratorHPMCMono.h"
+#include "hoomd/hpmc/ShapeSphere.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+
+using namespace hoomd;
+using namespace hoomd::hpmc;
+
+//! Check if the particle with the given tag is present on this rank as a ghost
+bool is_ghost(std::shared_ptr<ParticleData> pdata, unsigned int tag)
+    {
+    unsigned int idx = pdata->getRTag(tag);
+    return idx != NOT_LOCAL && idx >= pdata->getN();
+    }
+
+//! Test per-type ghost widths and overlap checks across the domain boundary with mixed sizes
+/*! Small spheres (type A, d=1) and one large sphere (type B, d=5) are placed across the boundary
+    between two domains. Ghosts of A only need to reach the particles they overlap with, so their
+    layer is thinner than the nominal width of the large sphere.
+*/
+void test_ghost_width_mixed_sizes(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    // this test needs to be run on two processors
+    int size;
+    MPI_Comm_size(exec_conf->getHOOMDWorldMPICommunicator(), &size);
+    UP_ASSERT_EQUAL(size, 2);
+
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(7,            // particles
+                                                                  BoxDim(20.0), // box
+                                                                  2, // particle types
+                                                                  0, // bond types
+                                                                  0, // angle types
+                                                                  0, // dihedral types
+                                                                  0, // improper types
+                                                                  exec_conf));
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+
+    // two small spheres overlapping across the boundary at x=0
+    pdata->setPosition(0, make_scalar3(-0.2, -6.0, 0.0), false);
+    pdata->setPosition(1, make_scalar3(0.6, -6.0, 0.0), false);
+    // a small and a large sphere overlapping across the boundary
+    pdata->setPosition(2, make_scalar3(-1.2, 0.0, 0.0), false);
+    pdata->setPosition(3, make_scalar3(1.6, 0.0, 0.0), false);
+    pdata->setType(3, 1);
+    // two small spheres close to, but not overlapping across the boundary
+    pdata->setPosition(4, make_scalar3(-0.6, 6.0, 0.0), false);
+    pdata->setPosition(5, make_scalar3(0.6, 6.0, 0.0), false);
+    // a small sphere within the nominal width, but outside the ghost layer of its type
+    pdata->setPosition(6, make_scalar3(-3.5, -3.0, 5.0), false);
+
+    SnapshotParticleData<Scalar> snap(7);
+    pdata->takeSnapshot(snap);
+
+    // split the box at x=0
+    std::vector<Scalar> fxs(1), fys, fzs;
+    fxs[0] = Scalar(0.5);
+    std::shared_ptr<DomainDecomposition> decomposition(
+        new DomainDecomposition(exec_conf, pdata->getBox().getL(), fxs, fys, fzs));
+    std::shared_ptr<Communicator> comm(new Communicator(sysdef, decomposition));
+    pdata->setDomainDecomposition(decomposition);
+    sysdef->setCommunicator(comm);
+
+    pdata->initializeFromSnapshot(snap);
+
+    std::shared_ptr<IntegratorHPMCMono<ShapeSphere>> mc(
+        new IntegratorHPMCMono<ShapeSphere>(sysdef));
+
+    SphereParams small;
+    small.radius = 0.5;
+    small.ignore = 0;
+    small.isOriented = false;
+    mc->setParam(0, small);
+
+    SphereParams large;
+    large.radius = 2.5;
+    large.ignore = 0;
+    large.isOriented = false;
+    mc->setParam(1, large);
+
+    // A reaches into B by 0.5 (1 + 5), B by its diameter
+    MY_CHECK_CLOSE(mc->getGhostLayerWidth(0), 3.0, tol);
+    MY_CHECK_CLOSE(mc->getGhostLayerWidth(1), 5.0, tol);
+
+    mc->communicate(true);
+
+    bool lower = decomposition->getGridPos().x == 0;
+    if (lower)
+        {
+        UP_ASSERT(is_ghost(pdata, 1));
+        UP_ASSERT(is_ghost(pdata, 3));
+        }
+    else
+        {
+        UP_ASSERT(is_ghost(pdata, 0));
+        UP_ASSERT(is_ghost(pdata, 2));
+        UP_ASSERT(!is_ghost(pdata, 6));
+        }
+
+    UP_ASSERT_EQUAL(mc->countOverlaps(false), 2);
+
+    // without A-B overlaps, the ghost layer of A shrinks to the diameter of A
+    mc->setInteractionMatrix(std::make_pair(pdata->getNameByType(0), pdata->getNameByType(1)),
+                             false);
+    MY_CHECK_CLOSE(mc->getGhostLayerWidth(0), 1.0, tol);
+    MY_CHECK_CLOSE(mc->getGhostLayerWidth(1), 5.0, tol);
+
+    mc->communicate(false);
+    if (!lower)
+        {
+        UP_ASSERT(is_ghost(pdata, 0));
+        UP_ASSERT(!is_ghost(pdata, 2));
+        }
+
+    UP_ASSERT_EQUAL(mc->countOverlaps(false), 1);
+
+    // enabling the overlaps again widens the ghost layer of A, so the overlap is found again
+    mc->setInteractionMatrix(std::make_pair(pdata->getNameByType(0), pdata->getNameByType(1)),
+                             true);
+    MY_CHECK_CLOSE(mc->getGhostLayerWidth(0), 3.0, tol);
+
+    mc->communicate(false);
+    UP_ASSERT_EQUAL(mc->countOverlaps(false), 2);
+    }
+
+//! Test per-type ghost widths on the CPU
+UP_TEST(ghost_width_mixed_sizes)
+    {
+    test_ghost_width_mixed_sizes(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+#endif // ENABLE_MPI
@@ -4,6 +4,7 @@
 #include "hoomd/AABBTree.h"
 #include "hoomd/hpmc/IntegratorHPMC.h"
 #include "hoomd/hpmc/Moves.h"
+#include "hoomd/hpmc/OBBTreeCache.h"
 #include "hoomd/hpmc/ShapePolyhedron.h"
 
 #include "hoomd/test/upp11_config.h"
@@ -498,3 +499,79 @@ UP_TEST(overlap_octahedron_sphere)
     UP_ASSERT(test_overlap(r_ij, a, b, err_count));
     UP_ASSERT(test_overlap(-r_ij, b, a, err_count));
     }
+
+UP_TEST(obb_tree_cache)
+    {
+    // octahedron faces, one face per leaf so that the tree has internal nodes
+    const unsigned int faces[24] = {0, 4, 1, 1, 4, 2, 2, 4, 3, 3, 4, 0,
+                                    0, 5, 1, 1, 5, 2, 2, 5, 3, 3, 5, 0};
+    unsigned int face_offs[9];
+    unsigned int face_overlap[8];
+    for (unsigned int i = 0; i < 8; i++)
+        {
+        face_offs[i] = 3 * i;
+        face_overlap[i] = 1;
+        }
+    face_offs[8] = 24;
+
+    vec3<ShortReal> verts[6] = {vec3<ShortReal>(-0.5, -0.5, 0),
+                                vec3<ShortReal>(0.5, -0.5, 0),
+                                vec3<ShortReal>(0.5, 0.5, 0),
+                                vec3<ShortReal>(-0.5, 0.5, 0),
+                                vec3<ShortReal>(0, 0, ShortReal(0.707106781186548)),
+                                vec3<ShortReal>(0, 0, -ShortReal(0.707106781186548))};
+
+    OBBTreeCache& cache = OBBTreeCache::getInstance();
+    cache.clear();
+
+    std::shared_ptr<const OBBTree> tree
+        = cache.getTree(verts, 6, face_offs, faces, face_overlap, 8, 0.0, 1);
+    UP_ASSERT(tree->getNumNodes() > 1);
+
+    // identical meshes share the tree
+    std::shared_ptr<const OBBTree> same
+        = cache.getTree(verts, 6, face_offs, faces, face_overlap, 8, 0.0, 1);
+    UP_ASSERT(same == tree);
+
+    // a different leaf capacity builds a new tree
+    std::shared_ptr<const OBBTree> other
+        = cache.getTree(verts, 6, face_offs, faces, face_overlap, 8, 0.0, 4);
+    UP_ASSERT(other != tree);
+
+    // deforming the mesh refits the tree and keeps its structure
+    for (unsigned int i = 0; i < 6; i++)
+        {
+        verts[i].x *= 2;
+        }
+    verts[4].z += ShortReal(0.5);
+    std::shared_ptr<const OBBTree> refit
+        = cache.getTree(verts, 6, face_offs, faces, face_overlap, 8, 0.0, 1);
+    UP_ASSERT(refit != tree);
+    UP_ASSERT_EQUAL(refit->getNumNodes(), tree->getNumNodes());
+
+    for (unsigned int node = 0; node < refit->getNumNodes(); node++)
+        {
+        UP_ASSERT_EQUAL(refit->getNodeLeft(node), tree->getNodeLeft(node));
+        }
+
+    // every node of the refit tree bounds the vertices of the faces below it
+    for (unsigned int node = 0; node < refit->getNumNodes(); node++)
+        {
+        if (!refit->isNodeLeaf(node))
+            continue;
+
+        for (unsigned int j = 0; j < refit->getNodeNumParticles(node); j++)
+            {
+            unsigned int face = refit->getNodeParticle(node, j);
+            for (unsigned int k = face_offs[face]; k < face_offs[face + 1]; k++)
+                {
+                OBB vertex(verts[faces[k]], ShortReal(1e-4));
+                for (unsigned int cur = node; cur != OBB_INVALID_NODE;
+                     cur = refit->getNode(cur).parent)
+                    {
+                    UP_ASSERT(overlap(refit->getNodeOBB(cur), vertex));
+                    }
+                }
+            }
+        }
+    }
@@ -26,7 +26,7 @@ from functools import reduce, wraps
 import weakref
 
 import hoomd
-from hoomd.util import _SafeNamespaceDict
+from hoomd.util import _NamespaceDict, _SafeNamespaceDict
 from hoomd.error import DataAccessError
 from collections.abc import Sequence
 
@@ -663,6 +663,9 @@ class Logger(_SafeNamespaceDict):
         else:
             self._categories = LoggerCategories.any(categories)
         self._only_default = only_default
+        # (namespace, entry) pairs in iteration order, rebuilt lazily when
+        # quantities are added or removed.
+        self._flat_entries = None
         super().__init__()
 
     @property
@@ -819,6 +822,12 @@ class Logger(_SafeNamespaceDict):
             raise ValueError(
                 "User specified loggable is not of an accepted category.")
         super().__setitem__(namespace, value)
+        self._flat_entries = None
+
+    def __delitem__(self, namespace):
+        """Remove a logged quantity by namespace."""
+        super().__delitem__(namespace)
+        self._flat_entries = None
 
     def __iadd__(self, obj):
         """Add quantities from an object or list of objects.
@@ -881,12 +890,28 @@ class Logger(_SafeNamespaceDict):
 
             values_to_log = logger.log()
         """
-        # Use namespace dict to correctly nest log values.
-        data = _SafeNamespaceDict()
+        # Use namespace dict to correctly nest log values. The namespaces are
+        # unique, so skip the overwrite check of _SafeNamespaceDict.
+        data = _NamespaceDict()
+        for key, log_value in self._log_flat().items():
+            data._setitem(key, log_value)
+        return data._dict
+
+    def _log_flat(self):
+        """Get a flat dictionary of the current values for logged quantities.
+
+        The keys are the full namespaces and the values (value, category) pairs
+        as in `log`. Writers that flatten the output of `log` should call this
+        method instead to avoid building the nested dictionary each frame.
+        """
+        if self._flat_entries is None:
+            self._flat_entries = list(self.items())
+
+        data = {}
         # We remove all keys where the reference to the object has become
         # invalid.
         remove_keys = []
-        for key, entry in self.items():
+        for key, entry in self._flat_entries:
             log_value = entry()
             if log_value is _InvalidLogEntry:
                 remove_keys.append(key)
@@ -895,7 +920,7 @@ class Logger(_SafeNamespaceDict):
         if len(remove_keys) > 0:
             for key in remove_keys:
                 del self[key]
-        return data._dict
+        return data
 
     def _contains_obj(self, namespace, obj):
         """Evaluates based on identity."""
@@ -203,8 +203,12 @@ void ActiveForceCompute::setForces()
     assert(h_pos.data != NULL);
 
     // zero forces so we don't leave any forces set for indices that are no longer part of our group
-    memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
-    memset(h_torque.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    // when the group holds every particle, the loop below overwrites them all
+    if (m_group->getNumMembers() < m_pdata->getN())
+        {
+        memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+        memset(h_torque.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+        }
 
     for (unsigned int i = 0; i < m_group->getNumMembers(); i++)
         {
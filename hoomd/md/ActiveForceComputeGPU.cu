@@ -93,7 +93,7 @@ __global__ void gpu_compute_active_force_rotational_diffusion_kernel(const unsig
 
     if (fact.w != 0)
         {
-        unsigned int ptag = d_tag[group_idx];
+        unsigned int ptag = d_tag[idx];
 
         quat<Scalar> quati(__ldg(d_orientation + idx));
 
@@ -151,8 +151,15 @@ hipError_t gpu_compute_active_force_set_forces(const unsigned int group_size,
     dim3 grid(group_size / block_size + 1, 1, 1);
     dim3 threads(block_size, 1, 1);
 
+    // zero forces and torques so we don't leave any set for indices that are no longer part of
+    // our group. When the group holds every particle, the kernel overwrites them all.
+    if (group_size < N)
+        {
+        hipMemset(d_force, 0, sizeof(Scalar4) * N);
+        hipMemset(d_torque, 0, sizeof(Scalar4) * N);
+        }
+
     // run the kernel
-    hipMemset(d_force, 0, sizeof(Scalar4) * N);
     hipLaunchKernelGGL((gpu_compute_active_force_set_forces_kernel),
                        dim3(grid),
                        dim3(threads),
@@ -135,7 +135,7 @@ gpu_compute_active_force_constraint_rotational_diffusion_kernel(const unsigned i
     unsigned int idx = d_index_array[group_idx];
     Scalar4 posidx = __ldg(d_pos + idx);
     unsigned int type = __scalar_as_int(posidx.w);
-    unsigned int ptag = d_tag[group_idx];
+    unsigned int ptag = d_tag[idx];
 
     quat<Scalar> quati(__ldg(d_orientation + idx));
 
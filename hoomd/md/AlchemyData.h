@@ -71,6 +71,12 @@ struct AlchemicalMDParticle : AlchemicalParticle
     void zeroNetForce(uint64_t timestep)
         {
         zeroForces();
+        setNetForceTimestep(timestep);
+        }
+
+    //! Set the timestep of the per particle forces when they are written without zeroing first
+    void setNetForceTimestep(uint64_t timestep)
+        {
         m_timestep_net_force.first = timestep;
         }
 
@@ -0,0 +1,19 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "AnisoPotentialPairGPU.h"
+#include "EvaluatorPairSiteLJ.h"
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+void export_AnisoPotentialPairSiteLJGPU(pybind11::module& m)
+    {
+    export_AnisoPotentialPairGPU<EvaluatorPairSiteLJ>(m, "AnisoPotentialPairSiteLJGPU");
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
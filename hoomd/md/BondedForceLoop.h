@@ -0,0 +1,126 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __BONDED_FORCE_LOOP_H__
+#define __BONDED_FORCE_LOOP_H__
+
+#include "hoomd/ExecutionConfiguration.h"
+#include "hoomd/HOOMDMath.h"
+
+#include <memory>
+#include <vector>
+
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+/*! \file BondedForceLoop.h
+    \brief Declares a helper to evaluate bonded forces over groups in parallel
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Evaluate the forces of all bonded groups, in parallel when TBB provides more than one thread
+/*! \param exec_conf Execution configuration
+    \param n_groups Number of groups
+    \param n_particles Number of particles (local and ghost) the groups can write to
+    \param compute_virial Set to true when compute_groups writes to the virial
+    \param h_force Force array, zeroed by the caller
+    \param h_virial Virial array, zeroed by the caller
+    \param virial_pitch Pitch of h_virial
+    \param compute_groups Callable compute_groups(begin, end, force, virial, virial_pitch) that
+        adds the forces, energies, and virials of groups [begin, end) to the given arrays
+
+    A group writes to all of its members, so threads that process different groups may write to
+    the same particle. With more than one thread, each thread accumulates into its own force and
+    virial arrays, which are summed per particle afterwards. The sums are reproducible when
+    ExecutionConfiguration::isDeterministicReductionEnabled() is true.
+*/
+template<class ComputeGroups>
+void for_each_bonded_group(std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                           unsigned int n_groups,
+                           unsigned int n_particles,
+                           bool compute_virial,
+                           Scalar4* h_force,
+                           Scalar* h_virial,
+                           size_t virial_pitch,
+                           const ComputeGroups& compute_groups)
+    {
+#ifdef ENABLE_TBB
+    if (exec_conf->getNumThreads() > 1)
+        {
+        exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                hoomd::detail::ThreadBuffers<Scalar4> thread_force(exec_conf,
+                                                                   n_particles,
+                                                                   make_scalar4(0, 0, 0, 0));
+                hoomd::detail::ThreadBuffers<Scalar> thread_virial(
+                    exec_conf,
+                    compute_virial ? 6 * size_t(n_particles) : 0,
+                    Scalar(0.0));
+
+                thread_force.parallel_for(0,
+                                          n_groups,
+                                          [&](unsigned int begin, unsigned int end, unsigned int k)
+                                          {
+                                              compute_groups(begin,
+                                                             end,
+                                                             thread_force[k].data(),
+                                                             thread_virial[k].data(),
+                                                             size_t(n_particles));
+                                          });
+
+                // sum the per-thread contributions
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_particles),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int i = r.begin(); i != r.end(); ++i)
+                            {
+                            Scalar4 f = make_scalar4(0, 0, 0, 0);
+                            for (const auto& force : thread_force)
+                                {
+                                f.x += force[i].x;
+                                f.y += force[i].y;
+                                f.z += force[i].z;
+                                f.w += force[i].w;
+                                }
+                            h_force[i] = f;
+                            }
+
+                        if (compute_virial)
+                            {
+                            for (unsigned int k = 0; k < 6; k++)
+                                for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                    {
+                                    Scalar v(0.0);
+                                    for (const auto& virial : thread_virial)
+                                        v += virial[k * size_t(n_particles) + i];
+                                    h_virial[k * virial_pitch + i] = v;
+                                    }
+                            }
+                    });
+            });
+        return;
+        }
+#endif
+
+    compute_groups(0, n_groups, h_force, h_virial, virial_pitch);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -13,6 +13,7 @@
 #include "hoomd/HOOMDMPI.h"
 #endif
 
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
@@ -50,12 +51,17 @@ ComputeThermo::ComputeThermo(std::shared_ptr<SystemDefinition> sysdef,
 
 #ifdef ENABLE_MPI
     m_properties_reduced = true;
+    m_reduction_pending = false;
+    m_reduction_request = MPI_REQUEST_NULL;
 #endif
     }
 
 ComputeThermo::~ComputeThermo()
     {
     m_exec_conf->msg->notice(5) << "Destroying ComputeThermo" << endl;
+#ifdef ENABLE_MPI
+    cancelReduceProperties();
+#endif
     }
 
 /*! Calls computeProperties if the properties need updating
@@ -66,6 +72,7 @@ void ComputeThermo::compute(uint64_t timestep)
     Compute::compute(timestep);
     if (shouldCompute(timestep))
         {
+        ScopedOperationTimer timer(m_timer, typeid(*this));
         computeProperties();
         m_computed_flags = m_pdata->getFlags();
         }
@@ -75,6 +82,11 @@ void ComputeThermo::compute(uint64_t timestep)
  */
 void ComputeThermo::computeProperties()
     {
+#ifdef ENABLE_MPI
+    // the local properties are about to be overwritten
+    cancelReduceProperties();
+#endif
+
     // just drop out if the group is an empty group
     if (m_group->getNumMembersGlobal() == 0)
         return;
@@ -286,8 +298,11 @@ void ComputeThermo::computeProperties()
     h_properties.data[thermo_index::pressure_zz] = pressure_zz;
 
 #ifdef ENABLE_MPI
-    // in MPI, reduce extensive quantities only when they're needed
+    // in MPI, start reducing the extensive quantities now and complete the reduction only when
+    // they're needed
     m_properties_reduced = !m_pdata->getDomainDecomposition();
+    if (!m_properties_reduced)
+        beginReduceProperties();
 #endif // ENABLE_MPI
     }
 
@@ -297,17 +312,61 @@ void ComputeThermo::reduceProperties()
     if (m_properties_reduced)
         return;
 
-    // reduce properties
     ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::readwrite);
-    MPI_Allreduce(MPI_IN_PLACE,
-                  h_properties.data,
-                  thermo_index::num_quantities,
-                  MPI_HOOMD_SCALAR,
-                  MPI_SUM,
-                  m_exec_conf->getMPICommunicator());
+
+    if (m_reduction_pending)
+        {
+        // complete the reduction started in computeProperties()
+        MPI_Wait(&m_reduction_request, MPI_STATUS_IGNORE);
+        m_reduction_pending = false;
+        std::copy(m_reduction_buf.begin(), m_reduction_buf.end(), h_properties.data);
+        }
+    else
+        {
+        // reduce properties
+        MPI_Allreduce(MPI_IN_PLACE,
+                      h_properties.data,
+                      thermo_index::num_quantities,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
 
     m_properties_reduced = true;
     }
+
+/*! The local properties are copied to a separate buffer, so that m_properties may be accessed
+    while the reduction is in flight. reduceProperties() waits for the result.
+*/
+void ComputeThermo::beginReduceProperties()
+    {
+    cancelReduceProperties();
+
+        {
+        ArrayHandle<Scalar> h_properties(m_properties, access_location::host, access_mode::read);
+        m_reduction_buf.assign(h_properties.data,
+                               h_properties.data + thermo_index::num_quantities);
+        }
+
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   m_reduction_buf.data(),
+                   thermo_index::num_quantities,
+                   MPI_HOOMD_SCALAR,
+                   MPI_SUM,
+                   m_exec_conf->getMPICommunicator(),
+                   &m_reduction_request);
+    m_reduction_pending = true;
+    }
+
+void ComputeThermo::cancelReduceProperties()
+    {
+    if (!m_reduction_pending)
+        return;
+
+    // nonblocking collectives cannot be cancelled, wait for completion
+    MPI_Wait(&m_reduction_request, MPI_STATUS_IGNORE);
+    m_reduction_pending = false;
+    }
 #endif
 
 namespace detail
@@ -8,6 +8,7 @@
 
 #include <limits>
 #include <memory>
+#include <vector>
 
 /*! \file ComputeThermo.h
     \brief Declares a class for computing thermodynamic quantities
@@ -312,6 +313,15 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
         }
 
     //! Get the gpu array of properties
+    /*! \returns The properties, indexed by thermo_index
+
+        ComputeThermoGPU writes the properties on the device and the array stays there until a
+        host getter (e.g. getTranslationalKineticEnergy()) reads it, which copies the whole array
+        to the host once per compute(). Consumers that run on the GPU should access the returned
+        array with access_location::device so that they do not force that copy and the
+        synchronization that comes with it. With domain decomposition, the reduction across ranks
+        still passes through the host.
+    */
     const GlobalArray<Scalar>& getProperties()
         {
 #ifdef ENABLE_MPI
@@ -342,8 +352,18 @@ class PYBIND11_EXPORT ComputeThermo : public Compute
 #ifdef ENABLE_MPI
     bool m_properties_reduced; //!< True if properties have been reduced across MPI
 
+    bool m_reduction_pending;            //!< True while a nonblocking reduction is in flight
+    MPI_Request m_reduction_request;     //!< Request of the nonblocking reduction
+    std::vector<Scalar> m_reduction_buf; //!< Send and receive buffer of the nonblocking reduction
+
     //! Reduce properties over MPI
     virtual void reduceProperties();
+
+    //! Start a nonblocking reduction of the properties over MPI
+    void beginReduceProperties();
+
+    //! Wait for a pending nonblocking reduction and discard its result
+    void cancelReduceProperties();
 #endif
     };
 
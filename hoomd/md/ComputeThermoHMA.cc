@@ -90,6 +90,7 @@ void ComputeThermoHMA::compute(uint64_t timestep)
     if (!shouldCompute(timestep))
         return;
 
+    ScopedOperationTimer timer(m_timer, typeid(*this));
     computeProperties();
     }
 
@@ -135,26 +136,27 @@ void ComputeThermoHMA::computeProperties()
                 / (D * (group_size - 1));
     double W = 0;
     size_t virial_pitch = net_virial.getPitch();
+    // accumulate the energy, virial, and force . displacement in a single pass over the members
+    double fdr_total = 0;
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
         {
         unsigned int j = m_group->getMemberIndex(group_idx);
-        unsigned int tag = h_tag.data[group_idx];
-        pe_total += (double)h_net_force.data[j].w;
+        unsigned int tag = h_tag.data[j];
+        const Scalar4 net_force = h_net_force.data[j];
+        pe_total += (double)net_force.w;
         W += Scalar(1. / D)
              * ((double)h_net_virial.data[j + 0 * virial_pitch]
                 + (double)h_net_virial.data[j + 3 * virial_pitch]
                 + (double)h_net_virial.data[j + 5 * virial_pitch]);
 
-        Scalar4 pos4 = h_pos.data[group_idx];
+        Scalar4 pos4 = h_pos.data[j];
         Scalar3 pos3 = make_scalar3(pos4.x, pos4.y, pos4.z);
-        Scalar3 dr = box.shift(pos3, h_image.data[group_idx]) - h_lattice_site.data[tag];
-        double fdr = 0;
-        fdr += (double)h_net_force.data[group_idx].x * dr.x;
-        fdr += (double)h_net_force.data[group_idx].y * dr.y;
-        fdr += (double)h_net_force.data[group_idx].z * dr.z;
-        pe_total += 0.5 * fdr;
-        p_HMA += fV * fdr;
+        Scalar3 dr = box.shift(pos3, h_image.data[j]) - h_lattice_site.data[tag];
+        fdr_total += (double)net_force.x * dr.x + (double)net_force.y * dr.y
+                     + (double)net_force.z * dr.z;
         }
+    pe_total += 0.5 * fdr_total;
+    p_HMA = fV * fdr_total;
     pe_total += 1.5 * (group_size - 1) * m_temperature;
     pe_total += m_pdata->getExternalEnergy();
 
@@ -0,0 +1,228 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CorrelatorAnalyzer.cc
+    \brief Defines the CorrelatorAnalyzer class
+*/
+
+#include "CorrelatorAnalyzer.h"
+
+#include <pybind11/numpy.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param group Group to compute the MSD and velocity autocorrelation of (may be null)
+    \param thermo Computes the pressure tensor (may be null)
+    \param points Number of entries in each shift register
+    \param averaging Number of values averaged into one value of the next level
+    \param levels Number of levels
+*/
+CorrelatorAnalyzer::CorrelatorAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                                       std::shared_ptr<Trigger> trigger,
+                                       std::shared_ptr<ParticleGroup> group,
+                                       std::shared_ptr<ComputeThermo> thermo,
+                                       unsigned int points,
+                                       unsigned int averaging,
+                                       unsigned int levels)
+    : Analyzer(sysdef, trigger), m_group(group), m_thermo(thermo),
+      m_msd(group ? 3 * group->getNumMembersGlobal() : 0,
+            points,
+            averaging,
+            levels,
+            MultipleTauCorrelator::squared_difference),
+      m_vacf(group ? 3 * group->getNumMembersGlobal() : 0,
+             points,
+             averaging,
+             levels,
+             MultipleTauCorrelator::product),
+      m_pressure_acf(thermo ? 3 : 0, points, averaging, levels, MultipleTauCorrelator::product)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing CorrelatorAnalyzer" << endl;
+
+    if (averaging < 2 || points < averaging || points % averaging != 0)
+        {
+        throw std::invalid_argument("Correlator averaging must be at least 2 and divide points.");
+        }
+    if (levels == 0)
+        {
+        throw std::invalid_argument("Correlator levels must be positive.");
+        }
+
+    if (m_group && m_sysdef->isDomainDecomposed())
+        {
+        throw std::runtime_error("The MSD and velocity autocorrelation are not available with "
+                                 "domain decomposition.");
+        }
+
+    m_sample.resize(m_msd.getNumChannels());
+    }
+
+CorrelatorAnalyzer::~CorrelatorAnalyzer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying CorrelatorAnalyzer" << endl;
+    }
+
+PDataFlags CorrelatorAnalyzer::getRequestedPDataFlags()
+    {
+    PDataFlags flags(0);
+    if (m_thermo)
+        {
+        flags[pdata_flag::pressure_tensor] = 1;
+        }
+    return flags;
+    }
+
+void CorrelatorAnalyzer::reset()
+    {
+    m_msd.reset();
+    m_vacf.reset();
+    m_pressure_acf.reset();
+    m_num_samples = 0;
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void CorrelatorAnalyzer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    if (m_group)
+        {
+        if (3 * m_group->getNumMembersGlobal() != m_msd.getNumChannels())
+            {
+            throw std::runtime_error("The number of particles in the correlator group changed.");
+            }
+
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
+                                         access_location::host,
+                                         access_mode::read);
+
+        const BoxDim box = m_pdata->getGlobalBox();
+        const unsigned int n_members = m_group->getNumMembersGlobal();
+
+        // members are in tag order, so each particle keeps its channels when particles sort
+        for (unsigned int i = 0; i < n_members; i++)
+            {
+            const unsigned int idx = h_rtag.data[m_group->getMemberTag(i)];
+            const Scalar3 pos
+                = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
+            const Scalar3 unwrapped = box.shift(pos, h_image.data[idx]);
+            m_sample[3 * i] = unwrapped.x;
+            m_sample[3 * i + 1] = unwrapped.y;
+            m_sample[3 * i + 2] = unwrapped.z;
+            }
+        m_msd.add(m_sample.data());
+
+        for (unsigned int i = 0; i < n_members; i++)
+            {
+            const unsigned int idx = h_rtag.data[m_group->getMemberTag(i)];
+            m_sample[3 * i] = h_vel.data[idx].x;
+            m_sample[3 * i + 1] = h_vel.data[idx].y;
+            m_sample[3 * i + 2] = h_vel.data[idx].z;
+            }
+        m_vacf.add(m_sample.data());
+        }
+
+    if (m_thermo)
+        {
+        m_thermo->compute(timestep);
+        const PressureTensor p = m_thermo->getPressureTensor();
+        const double off_diagonal[3] = {p.xy, p.xz, p.yz};
+        m_pressure_acf.add(off_diagonal);
+        }
+
+    m_num_samples++;
+    }
+
+/*! \param correlation Correlation at each lag
+    \param factor Scale factor
+*/
+pybind11::object CorrelatorAnalyzer::toArray(const std::vector<double>& correlation, double factor)
+    {
+    std::vector<double> scaled(correlation);
+    for (auto& value : scaled)
+        {
+        value *= factor;
+        }
+    return pybind11::array_t<double>(scaled.size(), scaled.data());
+    }
+
+pybind11::object CorrelatorAnalyzer::getLags()
+    {
+    std::vector<uint64_t> lags = m_msd.getLags();
+    return pybind11::array_t<uint64_t>(lags.size(), lags.data());
+    }
+
+/*! \returns The MSD, summed over the three directions, or None without a group
+ */
+pybind11::object CorrelatorAnalyzer::getMSD()
+    {
+    if (!m_group)
+        return pybind11::none();
+
+    return toArray(m_msd.getCorrelation(), 3.0);
+    }
+
+/*! \returns The velocity autocorrelation, summed over the three directions, or None without a
+    group
+*/
+pybind11::object CorrelatorAnalyzer::getVACF()
+    {
+    if (!m_group)
+        return pybind11::none();
+
+    return toArray(m_vacf.getCorrelation(), 3.0);
+    }
+
+/*! \returns The pressure autocorrelation, averaged over xy, xz, and yz, or None without a
+    ComputeThermo
+*/
+pybind11::object CorrelatorAnalyzer::getPressureACF()
+    {
+    if (!m_thermo)
+        return pybind11::none();
+
+    return toArray(m_pressure_acf.getCorrelation(), 1.0);
+    }
+
+namespace detail
+    {
+void export_CorrelatorAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<CorrelatorAnalyzer, Analyzer, std::shared_ptr<CorrelatorAnalyzer>>(
+        m,
+        "CorrelatorAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<ParticleGroup>,
+                            std::shared_ptr<ComputeThermo>,
+                            unsigned int,
+                            unsigned int,
+                            unsigned int>())
+        .def_property_readonly("num_samples", &CorrelatorAnalyzer::getNumSamples)
+        .def_property_readonly("lags", &CorrelatorAnalyzer::getLags)
+        .def_property_readonly("msd", &CorrelatorAnalyzer::getMSD)
+        .def_property_readonly("vacf", &CorrelatorAnalyzer::getVACF)
+        .def_property_readonly("pressure_acf", &CorrelatorAnalyzer::getPressureACF)
+        .def("reset", &CorrelatorAnalyzer::reset);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
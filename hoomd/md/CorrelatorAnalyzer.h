@@ -0,0 +1,115 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file CorrelatorAnalyzer.h
+    \brief Declares an analyzer that computes time correlation functions on the fly
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ComputeThermo.h"
+#include "MultipleTauCorrelator.h"
+#include "hoomd/Analyzer.h"
+#include "hoomd/ParticleGroup.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Computes the MSD, velocity and pressure autocorrelation with multiple-tau correlators
+/** Each call to analyze() adds one sample to the correlators:
+
+     - The mean squared displacement of the group, from the positions unwrapped with the image
+       flags.
+     - The velocity autocorrelation < v(t) . v(t + tau) > of the group.
+     - When given a ComputeThermo, the autocorrelation of the off-diagonal pressure tensor
+       components averaged over xy, xz, and yz, which enters the Green-Kubo relation for the shear
+       viscosity.
+
+    See MultipleTauCorrelator for the algorithm. The per-particle correlators hold
+    3 * levels * points values for each member of the group and each of the two quantities.
+    Particles are tracked by tag, so a particle keeps its history when the particles are sorted.
+    The per-particle history cannot follow a particle to another rank, so the MSD and velocity
+    autocorrelation are not available with domain decomposition. The pressure autocorrelation is.
+
+    The correlators run on the host. On the GPU, each sample copies the positions, images, and
+    velocities of all particles to the host.
+*/
+class PYBIND11_EXPORT CorrelatorAnalyzer : public Analyzer
+    {
+    public:
+    /// Constructor
+    CorrelatorAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<Trigger> trigger,
+                       std::shared_ptr<ParticleGroup> group,
+                       std::shared_ptr<ComputeThermo> thermo,
+                       unsigned int points,
+                       unsigned int averaging,
+                       unsigned int levels);
+
+    /// Destructor
+    virtual ~CorrelatorAnalyzer();
+
+    /// Add the current configuration to the correlators
+    virtual void analyze(uint64_t timestep);
+
+    /// Request the pressure tensor when computing its autocorrelation
+    virtual PDataFlags getRequestedPDataFlags();
+
+    /// Get the number of accumulated samples
+    uint64_t getNumSamples() const
+        {
+        return m_num_samples;
+        }
+
+    /// Discard the accumulated samples
+    void reset();
+
+    /// Get the lags of the correlation functions, in samples
+    pybind11::object getLags();
+
+    /// Get the mean squared displacement at each lag
+    pybind11::object getMSD();
+
+    /// Get the velocity autocorrelation at each lag
+    pybind11::object getVACF();
+
+    /// Get the off-diagonal pressure tensor autocorrelation at each lag
+    pybind11::object getPressureACF();
+
+    private:
+    /// Group to compute the MSD and velocity autocorrelation of
+    std::shared_ptr<ParticleGroup> m_group;
+
+    /// Computes the pressure tensor (may be null)
+    std::shared_ptr<ComputeThermo> m_thermo;
+
+    /// Correlator for the unwrapped positions
+    MultipleTauCorrelator m_msd;
+
+    /// Correlator for the velocities
+    MultipleTauCorrelator m_vacf;
+
+    /// Correlator for the off-diagonal pressure tensor components
+    MultipleTauCorrelator m_pressure_acf;
+
+    /// Buffer for one sample of the per-particle quantities
+    std::vector<double> m_sample;
+
+    /// Number of accumulated samples
+    uint64_t m_num_samples = 0;
+
+    /// Convert a correlation to a numpy array, scaling it by \a factor
+    static pybind11::object toArray(const std::vector<double>& correlation, double factor);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
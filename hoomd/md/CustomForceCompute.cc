@@ -55,6 +55,7 @@ void CustomForceCompute::computeForces(uint64_t timestep)
         memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
         }
     // execute python callback to update the forces, if present
+    pybind11::gil_scoped_acquire acquire;
     m_setForces(timestep);
     }
 
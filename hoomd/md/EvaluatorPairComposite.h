@@ -0,0 +1,248 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_COMPOSITE_H__
+#define __PAIR_EVALUATOR_COMPOSITE_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairComposite.h
+    \brief Defines the pair evaluator class that sums two pair potentials
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Class for evaluating the sum of two pair potentials
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>Composite specifics</b>
+
+    EvaluatorPairComposite evaluates the function:
+    \f[ V(r) = V_A(r) + V_B(r) \f]
+    where \f$ V_A \f$ and \f$ V_B \f$ are computed by the evaluators \a EvaluatorA and \a
+    EvaluatorB. PotentialPair<EvaluatorPairComposite<A, B>> computes both potentials in a single
+    traversal of the neighbor list, reading the particle positions and neighbor indices once
+    instead of once per potential. Nest composite evaluators to combine more than two potentials.
+
+    Both components share the cutoff radius and shifting mode of the pair potential. The parameters
+    of the components are stored in the dictionary entries named by EvaluatorA::getName() and
+    EvaluatorB::getName(). After evalForceAndEnergy(), getComponentEnergy() returns the energy of
+    each component so that PotentialPair can tally the components in the same traversal.
+    evalComponentForceAndEnergy() evaluates a single component on its own.
+*/
+template<class EvaluatorA, class EvaluatorB> class EvaluatorPairComposite
+    {
+    public:
+    //! Evaluator of the first component
+    typedef EvaluatorA evaluator_a;
+
+    //! Evaluator of the second component
+    typedef EvaluatorB evaluator_b;
+
+    //! Number of component potentials
+    static constexpr unsigned int n_components = 2;
+
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        typename EvaluatorA::param_type a; //!< Parameters of the first component
+        typename EvaluatorB::param_type b; //!< Parameters of the second component
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            a.load_shared(ptr, available_bytes);
+            b.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            a.allocate_shared(ptr, available_bytes);
+            b.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        // set CUDA memory hints
+        void set_memory_hint() const
+            {
+            a.set_memory_hint();
+            b.set_memory_hint();
+            }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : a(), b() { }
+
+        param_type(pybind11::dict v, bool managed = false)
+            : a(v[EvaluatorA::getName().c_str()].template cast<pybind11::dict>(), managed),
+              b(v[EvaluatorB::getName().c_str()].template cast<pybind11::dict>(), managed)
+            {
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            v[EvaluatorA::getName().c_str()] = a.asDict();
+            v[EvaluatorB::getName().c_str()] = b.asDict();
+            return v;
+            }
+#endif
+        };
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairComposite(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : m_eval_a(_rsq, _rcutsq, _params.a), m_eval_b(_rsq, _rcutsq, _params.b)
+        {
+        }
+
+    //! Composite needs charge when either component does
+    DEVICE static bool needsCharge()
+        {
+        return EvaluatorA::needsCharge() || EvaluatorB::needsCharge();
+        }
+
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj)
+        {
+        if (EvaluatorA::needsCharge())
+            m_eval_a.setCharge(qi, qj);
+        if (EvaluatorB::needsCharge())
+            m_eval_b.setCharge(qi, qj);
+        }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+        cutoff
+
+        \return True if either component is evaluated
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        Scalar force_divr_a = Scalar(0.0);
+        Scalar pair_eng_a = Scalar(0.0);
+        bool evaluated_a = m_eval_a.evalForceAndEnergy(force_divr_a, pair_eng_a, energy_shift);
+
+        Scalar force_divr_b = Scalar(0.0);
+        Scalar pair_eng_b = Scalar(0.0);
+        bool evaluated_b = m_eval_b.evalForceAndEnergy(force_divr_b, pair_eng_b, energy_shift);
+
+        m_pair_eng_a = evaluated_a ? pair_eng_a : Scalar(0.0);
+        m_pair_eng_b = evaluated_b ? pair_eng_b : Scalar(0.0);
+
+        if (!evaluated_a && !evaluated_b)
+            return false;
+
+        force_divr = Scalar(0.0);
+        pair_eng = Scalar(0.0);
+        if (evaluated_a)
+            {
+            force_divr += force_divr_a;
+            pair_eng += pair_eng_a;
+            }
+        if (evaluated_b)
+            {
+            force_divr += force_divr_b;
+            pair_eng += pair_eng_b;
+            }
+        return true;
+        }
+
+    //! Evaluate the force and energy of a single component
+    /*! \param component Index of the component (0 or 1)
+        \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+        cutoff
+
+        \return True if the component is evaluated
+    */
+    DEVICE bool evalComponentForceAndEnergy(unsigned int component,
+                                            Scalar& force_divr,
+                                            Scalar& pair_eng,
+                                            bool energy_shift)
+        {
+        if (component == 0)
+            return m_eval_a.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+        else
+            return m_eval_b.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+        }
+
+    //! Get the energy of a component from the last call to evalForceAndEnergy()
+    /*! \param component Index of the component (0 or 1)
+        \returns The pair energy of the component, or 0 when it was not evaluated
+    */
+    DEVICE Scalar getComponentEnergy(unsigned int component) const
+        {
+        return component == 0 ? m_pair_eng_a : m_pair_eng_b;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return m_eval_a.evalPressureLRCIntegral() + m_eval_b.evalPressureLRCIntegral();
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return m_eval_a.evalEnergyLRCIntegral() + m_eval_b.evalEnergyLRCIntegral();
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return EvaluatorA::getName() + "_" + EvaluatorB::getName();
+        }
+
+    //! Get the name of a component potential
+    static std::string getComponentName(unsigned int component)
+        {
+        return component == 0 ? EvaluatorA::getName() : EvaluatorB::getName();
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    EvaluatorA m_eval_a; //!< Evaluator of the first component
+    EvaluatorB m_eval_b; //!< Evaluator of the second component
+
+    Scalar m_pair_eng_a = Scalar(0.0); //!< Energy of the first component
+    Scalar m_pair_eng_b = Scalar(0.0); //!< Energy of the second component
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_COMPOSITE_H__
@@ -234,26 +234,6 @@ class EvaluatorPairDPDThermoDPD
 
             // force calculation
 
-            unsigned int m_oi, m_oj;
-            // initialize the RNG
-            if (m_i > m_j)
-                {
-                m_oi = m_j;
-                m_oj = m_i;
-                }
-            else
-                {
-                m_oi = m_i;
-                m_oj = m_j;
-                }
-
-            hoomd::RandomGenerator rng(
-                hoomd::Seed(hoomd::RNGIdentifier::EvaluatorPairDPDThermo, m_timestep, m_seed),
-                hoomd::Counter(m_oi, m_oj));
-
-            // Generate a single random number
-            Scalar alpha = hoomd::UniformDistribution<Scalar>(-1, 1)(rng);
-
             // conservative dpd
             // force_divr = FDIV(a,r)*(Scalar(1.0) - r*rcutinv);
             force_divr = a * (rinv - rcutinv);
@@ -265,8 +245,33 @@ class EvaluatorPairDPDThermoDPD
             force_divr -= gamma * m_dot * (rinv - rcutinv) * (rinv - rcutinv);
 
             //  Random Force
-            force_divr
-                += fast::rsqrt(m_deltaT / (m_T * gamma * Scalar(6.0))) * (rinv - rcutinv) * alpha;
+            // The random force vanishes when gamma or kT is 0, skip generating the random number
+            if (gamma != Scalar(0.0) && m_T != Scalar(0.0))
+                {
+                // initialize the RNG with the ordered tags so that both particles of the pair
+                // draw the same number
+                unsigned int m_oi, m_oj;
+                if (m_i > m_j)
+                    {
+                    m_oi = m_j;
+                    m_oj = m_i;
+                    }
+                else
+                    {
+                    m_oi = m_i;
+                    m_oj = m_j;
+                    }
+
+                hoomd::RandomGenerator rng(
+                    hoomd::Seed(hoomd::RNGIdentifier::EvaluatorPairDPDThermo, m_timestep, m_seed),
+                    hoomd::Counter(m_oi, m_oj));
+
+                // Generate a single random number
+                Scalar alpha = hoomd::UniformDistribution<Scalar>(-1, 1)(rng);
+
+                force_divr += fast::rsqrt(m_deltaT / (m_T * gamma * Scalar(6.0)))
+                              * (rinv - rcutinv) * alpha;
+                }
 
             // conservative energy only
             pair_eng = a * (rcut - r) - Scalar(1.0 / 2.0) * a * rcutinv * (rcutsq - rsq);
@@ -228,26 +228,6 @@ class EvaluatorPairDPDThermoLJ
 
             // force calculation
 
-            unsigned int m_oi, m_oj;
-            // initialize the RNG
-            if (m_i > m_j)
-                {
-                m_oi = m_j;
-                m_oj = m_i;
-                }
-            else
-                {
-                m_oi = m_i;
-                m_oj = m_j;
-                }
-
-            hoomd::RandomGenerator rng(
-                hoomd::Seed(hoomd::RNGIdentifier::EvaluatorPairDPDThermo, m_timestep, m_seed),
-                hoomd::Counter(m_oi, m_oj));
-
-            // Generate a single random number
-            Scalar alpha = hoomd::UniformDistribution<Scalar>(-1, 1)(rng);
-
             // conservative lj
             force_divr = r2inv * r6inv * (Scalar(12.0) * lj1 * r6inv - Scalar(6.0) * lj2);
             force_divr_cons = force_divr;
@@ -256,8 +236,33 @@ class EvaluatorPairDPDThermoLJ
             force_divr -= gamma * m_dot * (rinv - rcutinv) * (rinv - rcutinv);
 
             //  Random Force
-            force_divr
-                += fast::rsqrt(m_deltaT / (m_T * gamma * Scalar(6.0))) * (rinv - rcutinv) * alpha;
+            // The random force vanishes when gamma or kT is 0, skip generating the random number
+            if (gamma != Scalar(0.0) && m_T != Scalar(0.0))
+                {
+                // initialize the RNG with the ordered tags so that both particles of the pair
+                // draw the same number
+                unsigned int m_oi, m_oj;
+                if (m_i > m_j)
+                    {
+                    m_oi = m_j;
+                    m_oj = m_i;
+                    }
+                else
+                    {
+                    m_oi = m_i;
+                    m_oj = m_j;
+                    }
+
+                hoomd::RandomGenerator rng(
+                    hoomd::Seed(hoomd::RNGIdentifier::EvaluatorPairDPDThermo, m_timestep, m_seed),
+                    hoomd::Counter(m_oi, m_oj));
+
+                // Generate a single random number
+                Scalar alpha = hoomd::UniformDistribution<Scalar>(-1, 1)(rng);
+
+                force_divr += fast::rsqrt(m_deltaT / (m_T * gamma * Scalar(6.0)))
+                              * (rinv - rcutinv) * alpha;
+                }
 
             // conservative energy only
             pair_eng = r6inv * (lj1 * r6inv - lj2);
@@ -0,0 +1,217 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_DISPERSION_EWALD_H__
+#define __PAIR_EVALUATOR_DISPERSION_EWALD_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#include "hoomd/HOOMDMath.h"
+
+/*! \file EvaluatorPairDispersionEwald.h
+    \brief Defines the pair evaluator class for the real space part of the dispersion Ewald sum
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+// DEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define DEVICE __device__
+#define HOSTDEVICE __host__ __device__
+#else
+#define DEVICE
+#define HOSTDEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Evaluate the long-range part of the r^-6 interaction in the dispersion Ewald sum
+/*! \param beta Splitting parameter
+    \param rsq Squared distance between the particles
+    \param u Output parameter, (1 - g(beta r)) / r^6
+    \param force_divr Output parameter, -(du/dr) / r
+
+    The dispersion Ewald sum splits 1/r^6 = g(beta r) / r^6 + (1 - g(beta r)) / r^6 with
+    g(x) = exp(-x^2) (1 + x^2 + x^4 / 2). The long-range part is finite at r = 0, evaluate it with
+    the series 1 - g(x) = exp(-x^2) sum_{n >= 3} x^(2n) / n! at small x to avoid the cancellation.
+*/
+HOSTDEVICE inline void
+eval_dispersion_long_range(Scalar beta, Scalar rsq, Scalar& u, Scalar& force_divr)
+    {
+    Scalar beta_sq = beta * beta;
+    Scalar xsq = beta_sq * rsq;
+    Scalar expfac = fast::exp(-xsq);
+
+    if (xsq < Scalar(1.0))
+        {
+        // t = sum_{n >= 4} x^(2(n - 4)) / n!, truncated after n = 12
+        Scalar t = Scalar(1.0 / 479001600.0);
+        t = Scalar(1.0 / 39916800.0) + xsq * t;
+        t = Scalar(1.0 / 3628800.0) + xsq * t;
+        t = Scalar(1.0 / 362880.0) + xsq * t;
+        t = Scalar(1.0 / 40320.0) + xsq * t;
+        t = Scalar(1.0 / 5040.0) + xsq * t;
+        t = Scalar(1.0 / 720.0) + xsq * t;
+        t = Scalar(1.0 / 120.0) + xsq * t;
+        t = Scalar(1.0 / 24.0) + xsq * t;
+
+        Scalar beta6 = beta_sq * beta_sq * beta_sq;
+        u = beta6 * expfac * (Scalar(1.0 / 6.0) + xsq * t);
+        force_divr = Scalar(6.0) * beta6 * beta_sq * expfac * t;
+        }
+    else
+        {
+        Scalar r2inv = Scalar(1.0) / rsq;
+        Scalar r6inv = r2inv * r2inv * r2inv;
+        Scalar long_range = Scalar(1.0) - expfac * (Scalar(1.0) + xsq + Scalar(0.5) * xsq * xsq);
+
+        u = long_range * r6inv;
+        force_divr = (Scalar(6.0) * u - beta_sq * beta_sq * beta_sq * expfac) * r2inv;
+        }
+    }
+
+//! Class for evaluating the real space part of the dispersion Ewald sum
+/*! <b>General Overview</b>
+
+    See EvaluatorPairLJ
+
+    <b>DispersionEwald specifics</b>
+
+    EvaluatorPairDispersionEwald evaluates the function:
+
+    \f[ V(r) = C_6 \frac{1 - g(\beta r)}{r^6}, \quad g(x) = e^{-x^2}
+        \left(1 + x^2 + \frac{x^4}{2}\right) \f]
+
+    The reciprocal space part (PPPMDispersionForceCompute) includes the attractive long-range part
+    -C_6 (1 - g(beta r)) / r^6 for all pairs. Inside the cutoff, this evaluator adds it back so
+    that the sum with a pair potential that includes the full -C_6 / r^6 term (such as LJ) is
+    exact there.
+*/
+class EvaluatorPairDispersionEwald
+    {
+    public:
+    //! Define the parameter type used by this pair potential evaluator
+    struct param_type
+        {
+        Scalar c6;
+        Scalar beta;
+
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes) { }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const { }
+
+#ifdef ENABLE_HIP
+        //! Set CUDA memory hints
+        void set_memory_hints() const { }
+#endif
+
+#ifndef __HIPCC__
+        param_type() : c6(0), beta(0) { }
+
+        param_type(pybind11::dict v, bool managed = false)
+            {
+            c6 = v["c6"].cast<Scalar>();
+            beta = v["beta"].cast<Scalar>();
+            }
+
+        pybind11::dict asDict()
+            {
+            pybind11::dict v;
+            v["c6"] = c6;
+            v["beta"] = beta;
+            return v;
+            }
+#endif
+        }
+#if HOOMD_LONGREAL_SIZE == 32
+        __attribute__((aligned(8)));
+#else
+        __attribute__((aligned(16)));
+#endif
+
+    //! Constructs the pair potential evaluator
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared distance at which the potential goes to 0
+        \param _params Per type pair parameters of this potential
+    */
+    DEVICE EvaluatorPairDispersionEwald(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
+        : rsq(_rsq), rcutsq(_rcutsq), c6(_params.c6), beta(_params.beta)
+        {
+        }
+
+    //! DispersionEwald doesn't use charge
+    DEVICE static bool needsCharge()
+        {
+        return false;
+        }
+    //! Accept the optional charge values.
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    DEVICE void setCharge(Scalar qi, Scalar qj) { }
+
+    //! Evaluate the force and energy
+    /*! \param force_divr Output parameter to write the computed force divided by r.
+        \param pair_eng Output parameter to write the computed pair energy
+        \param energy_shift If true, the potential must be shifted so that V(r) is continuous at the
+       cutoff \note There is no need to check if rsq < rcutsq in this method. Cutoff tests are
+       performed in PotentialPair.
+
+        \return True if they are evaluated or false if they are not because we are beyond the cutoff
+    */
+    DEVICE bool evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, bool energy_shift)
+        {
+        if (rsq < rcutsq && c6 != 0)
+            {
+            Scalar u, f;
+            eval_dispersion_long_range(beta, rsq, u, f);
+
+            force_divr = c6 * f;
+            pair_eng = c6 * u;
+
+            return true;
+            }
+        else
+            return false;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return 0;
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return 0;
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of this potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return std::string("dispersion_ewald");
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    Scalar rsq;    //!< Stored rsq from the constructor
+    Scalar rcutsq; //!< Stored rcutsq from the constructor
+    Scalar c6;     //!< Dispersion coefficient of the type pair
+    Scalar beta;   //!< Splitting parameter
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_DISPERSION_EWALD_H__
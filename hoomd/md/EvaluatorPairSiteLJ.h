@@ -0,0 +1,362 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __EVALUATOR_PAIR_SITE_LJ_H__
+#define __EVALUATOR_PAIR_SITE_LJ_H__
+
+#ifndef __HIPCC__
+#include <string>
+#endif
+
+#ifdef ENABLE_HIP
+#include <hip/hip_runtime.h>
+#endif
+
+#include "hoomd/ManagedArray.h"
+#include "hoomd/VectorMath.h"
+
+#ifndef __HIPCC__
+#include <pybind11/pybind11.h>
+#endif
+
+/*! \file EvaluatorPairSiteLJ.h
+    \brief Defines an evaluator class for Lennard-Jones interactions between sites of rigid bodies
+*/
+
+// need to declare these class methods with __device__ qualifiers when building in nvcc
+//! HOSTDEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+//! compiler
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#define DEVICE __device__
+#else
+#define HOSTDEVICE
+#define DEVICE
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Lennard-Jones interactions between interaction sites fixed in the body frame
+/*! Each particle type carries a list of interaction sites with positions in the particle's body
+    frame. The pair energy between particles i and j is the sum of the Lennard-Jones energy over
+    all pairs of sites a on i and b on j:
+
+        U = sum_a sum_b 4 epsilon ((sigma / r_ab)^12 - (sigma / r_ab)^6),  r_ab < site_r_cut
+
+    with r_ab the distance between the sites in the space frame. The site positions are computed
+    from the particle position and orientation during the evaluation, so a rigid body with many
+    interaction sites is a single particle in the particle data: it is sorted, communicated, and
+    stored in the neighbor list as one particle.
+
+    The sum transforms the sites of i into the body frame of j, so it needs one rotation per site
+    rather than one per pair of sites.
+*/
+class EvaluatorPairSiteLJ
+    {
+    public:
+    struct param_type
+        {
+        Scalar epsilon;    //! The energy scale.
+        Scalar sigma;      //! The interaction length scale.
+        Scalar site_r_cut; //! The cutoff distance between sites.
+
+        //! Load dynamic data members into shared memory and increase pointer
+        /*! \param ptr Pointer to load data to (will be incremented)
+            \param available_bytes Size of remaining shared memory
+            allocation
+        */
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes) { }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const { }
+
+#ifdef ENABLE_HIP
+        //! Set CUDA memory hints
+        void set_memory_hint() const
+            {
+            // default implementation does nothing
+            }
+#endif
+
+        HOSTDEVICE param_type() : epsilon(0), sigma(0), site_r_cut(0) { }
+
+#ifndef __HIPCC__
+
+        param_type(pybind11::dict v, bool managed = false)
+            {
+            epsilon = v["epsilon"].cast<Scalar>();
+            sigma = v["sigma"].cast<Scalar>();
+            site_r_cut = v["site_r_cut"].cast<Scalar>();
+            }
+
+        pybind11::dict toPython()
+            {
+            pybind11::dict v;
+            v["epsilon"] = epsilon;
+            v["sigma"] = sigma;
+            v["site_r_cut"] = site_r_cut;
+            return v;
+            }
+
+#endif
+        }
+#if HOOMD_LONGREAL_SIZE == 32
+        __attribute__((aligned(8)));
+#else
+        __attribute__((aligned(16)));
+#endif
+
+    //! Interaction sites of a particle type
+    struct shape_type
+        {
+        HOSTDEVICE shape_type() { }
+
+#ifndef __HIPCC__
+
+        //! Shape constructor
+        /*! \param shape Dictionary with the key "positions": a list of the site positions in the
+                body frame
+            \param managed Whether the site positions are stored in managed memory
+        */
+        shape_type(pybind11::object shape, bool managed)
+            {
+            pybind11::list positions = shape["positions"].cast<pybind11::list>();
+            const auto N_sites = static_cast<unsigned int>(len(positions));
+
+            sites = ManagedArray<vec3<Scalar>>(N_sites, managed);
+            for (unsigned int i = 0; i < N_sites; ++i)
+                {
+                pybind11::tuple position = pybind11::cast<pybind11::tuple>(positions[i]);
+                sites[i] = vec3<Scalar>(pybind11::cast<Scalar>(position[0]),
+                                        pybind11::cast<Scalar>(position[1]),
+                                        pybind11::cast<Scalar>(position[2]));
+                }
+            }
+
+        pybind11::object toPython()
+            {
+            pybind11::list positions;
+            for (unsigned int i = 0; i < sites.size(); ++i)
+                {
+                positions.append(pybind11::make_tuple(sites[i].x, sites[i].y, sites[i].z));
+                }
+
+            pybind11::dict v;
+            v["positions"] = positions;
+            return v;
+            }
+#endif
+
+        //! Load dynamic data members into shared memory and increase pointer
+        /*! \param ptr Pointer to load data to (will be incremented)
+            \param available_bytes Size of remaining shared memory allocation
+         */
+        DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
+            {
+            sites.load_shared(ptr, available_bytes);
+            }
+
+        HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
+            {
+            sites.allocate_shared(ptr, available_bytes);
+            }
+
+#ifdef ENABLE_HIP
+        //! Attach managed memory to CUDA stream
+        void set_memory_hint() const
+            {
+            sites.set_memory_hint();
+            }
+#endif
+
+        ManagedArray<vec3<Scalar>> sites; //! Site positions in the body frame.
+        };
+
+    //! Constructs the pair potential evaluator
+    /*! \param _dr Displacement vector between particle centers of mass
+        \param _qi Quaternion of i^th particle
+        \param _qj Quaternion of j^th particle
+        \param _rcutsq Squared distance between the particle centers at which the potential goes to
+            0
+        \param _params Per type pair parameters of this potential
+    */
+    HOSTDEVICE EvaluatorPairSiteLJ(const Scalar3& _dr,
+                                   const Scalar4& _qi,
+                                   const Scalar4& _qj,
+                                   const Scalar _rcutsq,
+                                   const param_type& _params)
+        : dr(_dr), rcutsq(_rcutsq), qi(_qi), qj(_qj), epsilon(_params.epsilon),
+          sigma(_params.sigma), site_r_cut(_params.site_r_cut), shape_i(nullptr), shape_j(nullptr)
+        {
+        }
+
+    //! Whether the pair potential uses shape.
+    HOSTDEVICE static bool needsShape()
+        {
+        return true;
+        }
+
+    //! Whether the pair potential needs particle tags.
+    HOSTDEVICE static bool needsTags()
+        {
+        return false;
+        }
+
+    //! whether pair potential requires charges
+    HOSTDEVICE static bool needsCharge()
+        {
+        return false;
+        }
+
+    /// Whether the potential implements the energy_shift parameter
+    HOSTDEVICE static bool constexpr implementsEnergyShift()
+        {
+        return true;
+        }
+
+    //! Accept the optional shape values
+    /*! \param shape_i Shape of particle i
+        \param shape_j Shape of particle j
+    */
+    HOSTDEVICE void setShape(const shape_type* shapei, const shape_type* shapej)
+        {
+        shape_i = shapei;
+        shape_j = shapej;
+        }
+
+    //! Accept the optional tags
+    /*! \param tag_i Tag of particle i
+        \param tag_j Tag of particle j
+    */
+    HOSTDEVICE void setTags(unsigned int tagi, unsigned int tagj) { }
+
+    //! Accept the optional charge values
+    /*! \param qi Charge of particle i
+        \param qj Charge of particle j
+    */
+    HOSTDEVICE void setCharge(Scalar qi, Scalar qj) { }
+
+    //! Evaluate the force and energy
+    /*! \param force Output parameter to write the computed force.
+        \param pair_eng Output parameter to write the computed pair energy.
+        \param energy_shift If true, each site-site term is shifted so that it is continuous at
+            site_r_cut.
+        \param torque_i The torque exerted on the i^th particle.
+        \param torque_j The torque exerted on the j^th particle.
+        \return True if they are evaluated or false if they are not because we are beyond the
+            cutoff.
+    */
+    HOSTDEVICE bool evaluate(Scalar3& force,
+                             Scalar& pair_eng,
+                             bool energy_shift,
+                             Scalar3& torque_i,
+                             Scalar3& torque_j)
+        {
+        if (dot(dr, dr) > rcutsq || epsilon == Scalar(0.0))
+            return false;
+
+        const Scalar site_rcutsq = site_r_cut * site_r_cut;
+        const Scalar sigma2 = sigma * sigma;
+        const Scalar sigma6 = sigma2 * sigma2 * sigma2;
+        const Scalar lj1 = Scalar(4.0) * epsilon * sigma6 * sigma6;
+        const Scalar lj2 = Scalar(4.0) * epsilon * sigma6;
+
+        Scalar e_shift(0.0);
+        if (energy_shift && site_rcutsq > Scalar(0.0))
+            {
+            Scalar r2inv = Scalar(1.0) / site_rcutsq;
+            Scalar r6inv = r2inv * r2inv * r2inv;
+            e_shift = r6inv * (lj1 * r6inv - lj2);
+            }
+
+        // the displacement between the centers in the body frame of j
+        quat<Scalar> qj_conj = conj(qj);
+        vec3<Scalar> dr_j = rotate(qj_conj, dr);
+
+        vec3<Scalar> f;
+        vec3<Scalar> t_i;
+        vec3<Scalar> t_j_body;
+        Scalar e(0.0);
+
+        for (unsigned int a = 0; a < shape_i->sites.size(); ++a)
+            {
+            vec3<Scalar> r_a = rotate(qi, shape_i->sites[a]);
+
+            // position of site a relative to the center of j in the body frame of j
+            vec3<Scalar> r_a_j = dr_j + rotate(qj_conj, r_a);
+
+            // force on site a in the body frame of j
+            vec3<Scalar> f_a_body;
+            for (unsigned int b = 0; b < shape_j->sites.size(); ++b)
+                {
+                const vec3<Scalar>& r_b = shape_j->sites[b];
+                vec3<Scalar> d = r_a_j - r_b;
+                Scalar rsq = dot(d, d);
+                if (rsq >= site_rcutsq)
+                    continue;
+
+                Scalar r2inv = Scalar(1.0) / rsq;
+                Scalar r6inv = r2inv * r2inv * r2inv;
+                Scalar force_divr
+                    = r2inv * r6inv * (Scalar(12.0) * lj1 * r6inv - Scalar(6.0) * lj2);
+
+                vec3<Scalar> f_ab = force_divr * d;
+                f_a_body += f_ab;
+                t_j_body -= cross(r_b, f_ab);
+                e += r6inv * (lj1 * r6inv - lj2) - e_shift;
+                }
+
+            vec3<Scalar> f_a = rotate(qj, f_a_body);
+            f += f_a;
+            t_i += cross(r_a, f_a);
+            }
+
+        force = vec_to_scalar3(f);
+        torque_i = vec_to_scalar3(t_i);
+        torque_j = vec_to_scalar3(rotate(qj, t_j_body));
+        pair_eng = e;
+        return true;
+        }
+
+    DEVICE Scalar evalPressureLRCIntegral()
+        {
+        return 0;
+        }
+
+    DEVICE Scalar evalEnergyLRCIntegral()
+        {
+        return 0;
+        }
+
+#ifndef __HIPCC__
+    //! Get the name of the potential
+    /*! \returns The potential name.
+     */
+    static std::string getName()
+        {
+        return "site_lj";
+        }
+
+    std::string getShapeSpec() const
+        {
+        throw std::runtime_error("Shape definition not supported for this pair potential.");
+        }
+#endif
+
+    protected:
+    vec3<Scalar> dr;           //!< Stored dr from the constructor
+    Scalar rcutsq;             //!< Stored rcutsq from the constructor
+    quat<Scalar> qi;           //!< Orientation quaternion for particle i
+    quat<Scalar> qj;           //!< Orientation quaternion for particle j
+    Scalar epsilon;            //!< The energy scale
+    Scalar sigma;              //!< The interaction length scale
+    Scalar site_r_cut;         //!< The cutoff distance between sites
+    const shape_type* shape_i; //!< Interaction sites of particle i
+    const shape_type* shape_j; //!< Interaction sites of particle j
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __EVALUATOR_PAIR_SITE_LJ_H__
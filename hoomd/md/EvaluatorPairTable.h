@@ -31,7 +31,9 @@ namespace md
     F(r) must be explicitly specified as -dV/dr to avoid errors resulting from the numerical
     derivative.
 
-    V(r) and F(r) are specified for each unique particle type pair. dr is the linear bin
+    V(r) and F(r) are specified for each unique particle type pair and stored interleaved as
+    (V, F) pairs, so that one interpolation reads both values from the same cache line. dr is the
+    linear bin
     spacing and equal to (rcut - rmin)/N_table. V(0) is the value of V at r=rmin. V(i) is the value
     of V at r=rmin + dr*i where i is chosen such that r >= rmin and r < rcut. V(r) and F(r) for
     r < rmin and r >= rcut is 0.
@@ -44,9 +46,8 @@ class EvaluatorPairTable
     //! Define the parameter type used by this pair potential evaluator
     struct param_type
         {
-        Scalar rmin;                  //!< the distance of the first index of the table potential
-        ManagedArray<Scalar> V_table; //!< the tabulated energy
-        ManagedArray<Scalar> F_table; //!< the tabulated force specifically - (dV / dr)
+        Scalar rmin;                    //!< the distance of the first index of the table
+        ManagedArray<Scalar2> VF_table; //!< the tabulated energy and force - (dV / dr)
 
         //! Load dynamic data members into shared memory and increase pointer
         /*! \param ptr Pointer to load data to (will be incremented)
@@ -54,22 +55,19 @@ class EvaluatorPairTable
          */
         DEVICE void load_shared(char*& ptr, unsigned int& available_bytes)
             {
-            V_table.load_shared(ptr, available_bytes);
-            F_table.load_shared(ptr, available_bytes);
+            VF_table.load_shared(ptr, available_bytes);
             }
 
         HOSTDEVICE void allocate_shared(char*& ptr, unsigned int& available_bytes) const
             {
-            V_table.allocate_shared(ptr, available_bytes);
-            F_table.allocate_shared(ptr, available_bytes);
+            VF_table.allocate_shared(ptr, available_bytes);
             }
 
 #ifdef ENABLE_HIP
         //! Attach managed memory to CUDA stream
         void set_memory_hint() const
             {
-            V_table.set_memory_hint();
-            F_table.set_memory_hint();
+            VF_table.set_memory_hint();
             }
 #endif
 
@@ -93,16 +91,24 @@ class EvaluatorPairTable
 
             size_t width = V_py.size();
             rmin = v["r_min"].cast<Scalar>();
-            V_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            F_table = ManagedArray<Scalar>(static_cast<unsigned int>(width), managed);
-            std::copy(V_py.data(0), V_py.data(0) + width, V_table.get());
-            std::copy(F_py.data(0), F_py.data(0) + width, F_table.get());
+            VF_table = ManagedArray<Scalar2>(static_cast<unsigned int>(width), managed);
+            for (size_t i = 0; i < width; i++)
+                {
+                VF_table[i] = make_scalar2(V_py(i), F_py(i));
+                }
             }
 
         pybind11::dict asDict() const
             {
-            const auto V = pybind11::array_t<Scalar>(V_table.size(), V_table.get());
-            const auto F = pybind11::array_t<Scalar>(F_table.size(), F_table.get());
+            auto V = pybind11::array_t<Scalar>(VF_table.size());
+            auto F = pybind11::array_t<Scalar>(VF_table.size());
+            auto V_data = V.mutable_unchecked<1>();
+            auto F_data = F.mutable_unchecked<1>();
+            for (unsigned int i = 0; i < VF_table.size(); i++)
+                {
+                V_data(i) = VF_table[i].x;
+                F_data(i) = VF_table[i].y;
+                }
             auto params = pybind11::dict();
             params["U"] = V;
             params["F"] = F;
@@ -123,8 +129,7 @@ class EvaluatorPairTable
         \param _params Per type pair parameters of this potential
     */
     DEVICE EvaluatorPairTable(Scalar _rsq, Scalar _rcutsq, const param_type& _params)
-        : rsq(_rsq), rcutsq(_rcutsq), rmin(_params.rmin), V_table(_params.V_table),
-          F_table(_params.F_table)
+        : rsq(_rsq), rcutsq(_rcutsq), rmin(_params.rmin), VF_table(_params.VF_table)
         {
         }
 
@@ -151,7 +156,7 @@ class EvaluatorPairTable
     DEVICE bool
     evalForceAndEnergy(Scalar& force_divr, Scalar& pair_eng, const bool energy_shift) const
         {
-        unsigned int width = V_table.size();
+        unsigned int width = VF_table.size();
 
         const Scalar r = fast::sqrt(rsq);
         // compute the force divided by r in force_divr
@@ -167,14 +172,16 @@ class EvaluatorPairTable
         // compute index into the table and read in values
         unsigned int value_i = static_cast<unsigned int>(slow::floor(value_f));
         // unpack the data
-        const Scalar V0 = V_table[value_i];
-        const Scalar F0 = F_table[value_i];
+        const Scalar2 VF0 = VF_table[value_i];
+        const Scalar V0 = VF0.x;
+        const Scalar F0 = VF0.y;
         Scalar V1 = 0;
         Scalar F1 = 0;
         if (value_i + 1 < width)
             {
-            V1 = V_table[value_i + 1];
-            F1 = F_table[value_i + 1];
+            const Scalar2 VF1 = VF_table[value_i + 1];
+            V1 = VF1.x;
+            F1 = VF1.y;
             }
 
         // compute the linear interpolation coefficient
@@ -219,12 +226,11 @@ class EvaluatorPairTable
 #endif
 
     protected:
-    Scalar rsq;                          //!< distance squared
-    Scalar rcutsq;                       //!< the potential cuttoff distance squared
-    size_t width;                        //!< the distance between table indices
-    Scalar rmin;                         //!< the distance of the first index of the table potential
-    const ManagedArray<Scalar>& V_table; //!< the tabulated energy
-    const ManagedArray<Scalar>& F_table; //!< the tabulated force specifically - (dV / dr)
+    Scalar rsq;                            //!< distance squared
+    Scalar rcutsq;                         //!< the potential cuttoff distance squared
+    size_t width;                          //!< the distance between table indices
+    Scalar rmin;                           //!< the distance of the first index of the table
+    const ManagedArray<Scalar2>& VF_table; //!< the tabulated energy and force - (dV / dr)
     };
 
     } // end namespace md
@@ -268,7 +268,10 @@ template<class evaluator> class EvaluatorWalls
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
                     {
-                    callEvaluator(F, energy, drv);
+                    if (rsq < m_params.rcutsq)
+                        {
+                        callEvaluator(F, energy, drv);
+                        }
                     }
                 // Need to use extrapolated potential
                 else
@@ -297,7 +300,10 @@ template<class evaluator> class EvaluatorWalls
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
                     {
-                    callEvaluator(F, energy, drv);
+                    if (rsq < m_params.rcutsq)
+                        {
+                        callEvaluator(F, energy, drv);
+                        }
                     }
                 else
                     {
@@ -322,7 +328,10 @@ template<class evaluator> class EvaluatorWalls
                 rsq = dot(drv, drv);
                 if (in_active_space && rsq >= rextrapsq)
                     {
-                    callEvaluator(F, energy, drv);
+                    if (rsq < m_params.rcutsq)
+                        {
+                        callEvaluator(F, energy, drv);
+                        }
                     }
                 else
                     {
@@ -344,10 +353,11 @@ template<class evaluator> class EvaluatorWalls
             }
         else // normal mode
             {
+            // walls at or beyond r_cut contribute nothing, skip constructing the evaluator for them
             for (unsigned int k = 0; k < m_field.numSpheres; k++)
                 {
                 drv = distVectorWallToPoint(m_field.Spheres[k], position, in_active_space);
-                if (in_active_space)
+                if (in_active_space && dot(drv, drv) < m_params.rcutsq)
                     {
                     callEvaluator(F, energy, drv);
                     }
@@ -355,7 +365,7 @@ template<class evaluator> class EvaluatorWalls
             for (unsigned int k = 0; k < m_field.numCylinders; k++)
                 {
                 drv = distVectorWallToPoint(m_field.Cylinders[k], position, in_active_space);
-                if (in_active_space)
+                if (in_active_space && dot(drv, drv) < m_params.rcutsq)
                     {
                     callEvaluator(F, energy, drv);
                     }
@@ -363,7 +373,7 @@ template<class evaluator> class EvaluatorWalls
             for (unsigned int k = 0; k < m_field.numPlanes; k++)
                 {
                 drv = distVectorWallToPoint(m_field.Planes[k], position, in_active_space);
-                if (in_active_space)
+                if (in_active_space && dot(drv, drv) < m_params.rcutsq)
                     {
                     callEvaluator(F, energy, drv);
                     }
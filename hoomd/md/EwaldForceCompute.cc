@@ -0,0 +1,527 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "EwaldForceCompute.h"
+#include "PPPMForceCompute.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <string.h>
+
+using namespace std;
+
+/*! \file EwaldForceCompute.cc
+    \brief Contains code for the EwaldForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param nlist Neighbor list that provides the exclusions
+    \param group Particles to include in the sum
+*/
+EwaldForceCompute::EwaldForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<NeighborList> nlist,
+                                     std::shared_ptr<ParticleGroup> group)
+    : ForceCompute(sysdef), m_nlist(nlist), m_group(group), m_k_max(make_uint3(0, 0, 0)),
+      m_kappa(0.0), m_alpha(0.0), m_q2(0.0), m_params_set(false), m_box_changed(false),
+      m_ptls_added_removed(true), m_n_k(0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing EwaldForceCompute" << endl;
+
+    if (m_sysdef->getNDimensions() == 2)
+        {
+        throw runtime_error("The Ewald sum is not implemented for 2D simulations.");
+        }
+
+    m_pdata->getBoxChangeSignal().connect<EwaldForceCompute, &EwaldForceCompute::setBoxChange>(
+        this);
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .connect<EwaldForceCompute, &EwaldForceCompute::slotGlobalParticleNumberChange>(this);
+    }
+
+EwaldForceCompute::~EwaldForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying EwaldForceCompute" << endl;
+
+    m_pdata->getBoxChangeSignal().disconnect<EwaldForceCompute, &EwaldForceCompute::setBoxChange>(
+        this);
+    m_pdata->getGlobalParticleNumberChangeSignal()
+        .disconnect<EwaldForceCompute, &EwaldForceCompute::slotGlobalParticleNumberChange>(this);
+    }
+
+/*! \param kx_max Largest Miller index along the first reciprocal lattice vector
+    \param ky_max Largest Miller index along the second reciprocal lattice vector
+    \param kz_max Largest Miller index along the third reciprocal lattice vector
+    \param kappa Splitting parameter
+    \param alpha Debye screening parameter
+*/
+void EwaldForceCompute::setParams(unsigned int kx_max,
+                                  unsigned int ky_max,
+                                  unsigned int kz_max,
+                                  Scalar kappa,
+                                  Scalar alpha)
+    {
+    if (kappa <= Scalar(0.0))
+        {
+        throw invalid_argument("Ewald: kappa must be positive.");
+        }
+
+    if (kx_max == 0 && ky_max == 0 && kz_max == 0)
+        {
+        throw invalid_argument("Ewald: at least one k_max must be positive.");
+        }
+
+    m_k_max = make_uint3(kx_max, ky_max, kz_max);
+    m_kappa = kappa;
+    m_alpha = alpha;
+
+    // enumerate half of the wave vectors inside the ellipsoid, k and -k contribute equally
+    m_miller.clear();
+    auto square = [](int n, unsigned int n_max)
+    {
+        return n_max ? Scalar(n * n) / Scalar(n_max * n_max) : Scalar(0.0);
+    };
+
+    int nx_max = int(kx_max), ny_max = int(ky_max), nz_max = int(kz_max);
+    for (int nz = 0; nz <= nz_max; nz++)
+        {
+        for (int ny = nz ? -ny_max : 0; ny <= ny_max; ny++)
+            {
+            for (int nx = (nz || ny) ? -nx_max : 1; nx <= nx_max; nx++)
+                {
+                if (square(nx, kx_max) + square(ny, ky_max) + square(nz, kz_max) <= Scalar(1.0))
+                    {
+                    m_miller.push_back(make_int3(nx, ny, nz));
+                    }
+                }
+            }
+        }
+
+    m_n_k = (unsigned int)m_miller.size();
+
+    GlobalArray<Scalar4> k(m_n_k, m_exec_conf);
+    m_k.swap(k);
+    TAG_ALLOCATION(m_k);
+
+    GlobalArray<Scalar2> s(m_n_k, m_exec_conf);
+    m_s.swap(s);
+    TAG_ALLOCATION(m_s);
+
+    computeKVectors();
+
+    m_params_set = true;
+    }
+
+/*! The wave vectors depend on the box, the coefficients also on kappa and alpha.
+ */
+void EwaldForceCompute::computeKVectors()
+    {
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+
+    vec3<Scalar> a1(global_box.getLatticeVector(0));
+    vec3<Scalar> a2(global_box.getLatticeVector(1));
+    vec3<Scalar> a3(global_box.getLatticeVector(2));
+    Scalar V_box = global_box.getVolume();
+
+    vec3<Scalar> b1 = Scalar(2.0 * M_PI) * cross(a2, a3) / V_box;
+    vec3<Scalar> b2 = Scalar(2.0 * M_PI) * cross(a3, a1) / V_box;
+    vec3<Scalar> b3 = Scalar(2.0 * M_PI) * cross(a1, a2) / V_box;
+
+    ArrayHandle<Scalar4> h_k(m_k, access_location::host, access_mode::overwrite);
+
+    Scalar alpha_sq = m_alpha * m_alpha;
+    for (unsigned int i = 0; i < m_n_k; i++)
+        {
+        int3 n = m_miller[i];
+        vec3<Scalar> k = Scalar(n.x) * b1 + Scalar(n.y) * b2 + Scalar(n.z) * b3;
+        Scalar ksq = dot(k, k) + alpha_sq;
+        Scalar A = Scalar(4.0 * M_PI) * exp(-ksq / (Scalar(4.0) * m_kappa * m_kappa)) / ksq;
+        h_k.data[i] = make_scalar4(k.x, k.y, k.z, A);
+        }
+
+    m_box_changed = false;
+    }
+
+namespace detail
+    {
+//! Fill a table of exp(i n t) for n in [-n_max, n_max]
+/*! The structure factor factorizes as exp(i k.r) = prod_d exp(i n_d b_d.r), so each particle needs
+    only (2 n_max + 1) phases per direction instead of one per wave vector.
+*/
+inline void ewald_fill_phases(Scalar t, int n_max, Scalar2* table)
+    {
+    table[n_max] = make_scalar2(1.0, 0.0);
+    for (int n = 1; n <= n_max; n++)
+        {
+        Scalar s, c;
+        fast::sincos(Scalar(n) * t, s, c);
+        table[n_max + n] = make_scalar2(c, s);
+        table[n_max - n] = make_scalar2(c, -s);
+        }
+    }
+
+//! Multiply two complex numbers
+inline Scalar2 ewald_complex_mul(const Scalar2& a, const Scalar2& b)
+    {
+    return make_scalar2(a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x);
+    }
+    } // end namespace detail
+
+/*! Sums S(k) over the local group members.
+ */
+void EwaldForceCompute::computeStructureFactor()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_index_array(m_group->getIndexArray(),
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<Scalar2> h_s(m_s, access_location::host, access_mode::overwrite);
+    memset(h_s.data, 0, sizeof(Scalar2) * m_n_k);
+
+    unsigned int group_size = m_group->getNumMembers();
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    Scalar3 f_origin = global_box.makeFraction(make_scalar3(0, 0, 0));
+
+    int3 n_max = make_int3(m_k_max.x, m_k_max.y, m_k_max.z);
+    unsigned int table_size = 2 * (n_max.x + n_max.y + n_max.z) + 3;
+    const int3* miller = m_miller.data();
+    unsigned int n_k = m_n_k;
+
+    auto sum_items = [&](unsigned int start, unsigned int end, Scalar2* s)
+    {
+        std::vector<Scalar2> table(table_size);
+        Scalar2* table_x = table.data();
+        Scalar2* table_y = table_x + 2 * n_max.x + 1;
+        Scalar2* table_z = table_y + 2 * n_max.y + 1;
+
+        for (unsigned int group_idx = start; group_idx < end; group_idx++)
+            {
+            unsigned int j = h_index_array.data[group_idx];
+            Scalar qj = h_charge.data[j];
+            if (qj == Scalar(0.0))
+                continue;
+
+            // b_d.r is 2 pi times the fractional coordinate along d
+            Scalar4 postype = h_pos.data[j];
+            Scalar3 f = global_box.makeFraction(make_scalar3(postype.x, postype.y, postype.z))
+                        - f_origin;
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.x, n_max.x, table_x);
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.y, n_max.y, table_y);
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.z, n_max.z, table_z);
+
+            for (unsigned int i = 0; i < n_k; i++)
+                {
+                int3 n = miller[i];
+                Scalar2 e = detail::ewald_complex_mul(
+                    detail::ewald_complex_mul(table_x[n_max.x + n.x], table_y[n_max.y + n.y]),
+                    table_z[n_max.z + n.z]);
+                s[i].x += qj * e.x;
+                s[i].y += qj * e.y;
+                }
+            }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                // all particles contribute to all wave vectors, sum into thread-local arrays
+                hoomd::detail::ThreadBuffers<Scalar2> thread_s(m_exec_conf,
+                                                               n_k,
+                                                               make_scalar2(0.0, 0.0));
+
+                thread_s.parallel_for(0,
+                                      group_size,
+                                      [&](unsigned int begin, unsigned int end, unsigned int k)
+                                      { sum_items(begin, end, thread_s[k].data()); });
+
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_k),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      for (const auto& s : thread_s)
+                                          for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                              {
+                                              h_s.data[i].x += s[i].x;
+                                              h_s.data[i].y += s[i].y;
+                                              }
+                                  });
+            });
+        }
+    else
+#endif
+        {
+        sum_items(0, group_size, h_s.data);
+        }
+    }
+
+/*! \param compute_virial Set to true to compute the external virial
+
+    Sums the structure factor over all ranks. The energy and virial are then the same on all ranks,
+    rank 0 stores them.
+*/
+void EwaldForceCompute::computeEnergyAndVirial(bool compute_virial)
+    {
+    ArrayHandle<Scalar2> h_s(m_s, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_k(m_k, access_location::host, access_mode::read);
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      h_s.data,
+                      2 * m_n_k,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar energy(0.0);
+    Scalar virial[6];
+    for (unsigned int i = 0; i < 6; ++i)
+        virial[i] = Scalar(0.0);
+
+    Scalar inv_four_kappa_sq = Scalar(0.25) / (m_kappa * m_kappa);
+    Scalar alpha_sq = m_alpha * m_alpha;
+    for (unsigned int i = 0; i < m_n_k; i++)
+        {
+        Scalar4 k = h_k.data[i];
+        Scalar2 s = h_s.data[i];
+        Scalar e = k.w * (s.x * s.x + s.y * s.y);
+        energy += e;
+
+        if (compute_virial)
+            {
+            Scalar ksq = k.x * k.x + k.y * k.y + k.z * k.z + alpha_sq;
+            Scalar vterm = -Scalar(2.0) * (Scalar(1.0) / ksq + inv_four_kappa_sq);
+            virial[0] += e * (Scalar(1.0) + vterm * k.x * k.x); // xx
+            virial[1] += e * (vterm * k.x * k.y);               // xy
+            virial[2] += e * (vterm * k.x * k.z);               // xz
+            virial[3] += e * (Scalar(1.0) + vterm * k.y * k.y); // yy
+            virial[4] += e * (vterm * k.y * k.z);               // yz
+            virial[5] += e * (Scalar(1.0) + vterm * k.z * k.z); // zz
+            }
+        }
+
+    Scalar V = m_pdata->getGlobalBox().getVolume();
+
+    // subtract the self energy
+    Scalar self_energy = m_q2
+                         * (m_kappa / sqrt(Scalar(M_PI))
+                                * exp(-m_alpha * m_alpha / (Scalar(4.0) * m_kappa * m_kappa))
+                            - Scalar(0.5) * m_alpha * erfc(m_alpha / (Scalar(2.0) * m_kappa)));
+
+    m_external_energy = Scalar(0.0);
+    for (unsigned int i = 0; i < 6; ++i)
+        m_external_virial[i] = Scalar(0.0);
+
+    if (m_exec_conf->getRank() == 0)
+        {
+        m_external_energy = energy / V - self_energy;
+        for (unsigned int i = 0; i < 6; ++i)
+            m_external_virial[i] = virial[i] / V;
+        }
+    }
+
+/*! Evaluates the forces on the local group members from the reduced structure factor.
+ */
+void EwaldForceCompute::computeForcesFromStructureFactor()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_index_array(m_group->getIndexArray(),
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<Scalar4> h_k(m_k, access_location::host, access_mode::read);
+    ArrayHandle<Scalar2> h_s(m_s, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+
+    memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+
+    unsigned int group_size = m_group->getNumMembers();
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    Scalar3 f_origin = global_box.makeFraction(make_scalar3(0, 0, 0));
+    Scalar prefactor = Scalar(2.0) / global_box.getVolume();
+
+    int3 n_max = make_int3(m_k_max.x, m_k_max.y, m_k_max.z);
+    unsigned int table_size = 2 * (n_max.x + n_max.y + n_max.z) + 3;
+    const int3* miller = m_miller.data();
+    unsigned int n_k = m_n_k;
+
+    auto force_items = [&](unsigned int start, unsigned int end)
+    {
+        std::vector<Scalar2> table(table_size);
+        Scalar2* table_x = table.data();
+        Scalar2* table_y = table_x + 2 * n_max.x + 1;
+        Scalar2* table_z = table_y + 2 * n_max.y + 1;
+
+        for (unsigned int group_idx = start; group_idx < end; group_idx++)
+            {
+            unsigned int j = h_index_array.data[group_idx];
+            Scalar qj = h_charge.data[j];
+            if (qj == Scalar(0.0))
+                continue;
+
+            Scalar4 postype = h_pos.data[j];
+            Scalar3 f = global_box.makeFraction(make_scalar3(postype.x, postype.y, postype.z))
+                        - f_origin;
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.x, n_max.x, table_x);
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.y, n_max.y, table_y);
+            detail::ewald_fill_phases(Scalar(2.0 * M_PI) * f.z, n_max.z, table_z);
+
+            Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+            for (unsigned int i = 0; i < n_k; i++)
+                {
+                int3 n = miller[i];
+                Scalar2 e = detail::ewald_complex_mul(
+                    detail::ewald_complex_mul(table_x[n_max.x + n.x], table_y[n_max.y + n.y]),
+                    table_z[n_max.z + n.z]);
+
+                // A(k) Im(S(k)^* exp(i k.r_j))
+                Scalar4 k = h_k.data[i];
+                Scalar2 s = h_s.data[i];
+                Scalar im = k.w * (s.x * e.y - s.y * e.x);
+                force.x += im * k.x;
+                force.y += im * k.y;
+                force.z += im * k.z;
+                }
+
+            h_force.data[j] = make_scalar4(prefactor * qj * force.x,
+                                           prefactor * qj * force.y,
+                                           prefactor * qj * force.z,
+                                           0.0);
+            }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each particle only reads the structure factor and writes its own force
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, group_size),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { force_items(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        force_items(0, group_size);
+        }
+    }
+
+void EwaldForceCompute::fixExclusions()
+    {
+    detail::fix_ewald_exclusions(m_pdata, m_nlist, m_group, m_force, m_virial, m_kappa, m_alpha);
+    }
+
+/*! \param timestep Current time step
+ */
+void EwaldForceCompute::computeForces(uint64_t timestep)
+    {
+    if (!m_params_set)
+        {
+        throw runtime_error("Ewald: parameters must be set before run().");
+        }
+
+    if (m_nlist->getFilterBody())
+        {
+        throw runtime_error("Ewald: rigid bodies are not supported, use PPPM instead.");
+        }
+
+    if (m_ptls_added_removed)
+        {
+        m_q2 = getQ2Sum();
+        m_ptls_added_removed = false;
+        }
+
+    if (m_box_changed)
+        {
+        computeKVectors();
+        }
+
+    computeStructureFactor();
+
+    PDataFlags flags = m_pdata->getFlags();
+    computeEnergyAndVirial(flags[pdata_flag::pressure_tensor]);
+
+    computeForcesFromStructureFactor();
+
+    // If there are exclusions, correct for the long-range part of the potential
+    if (m_nlist->getExclusionsSet())
+        {
+        m_nlist->compute(timestep);
+        fixExclusions();
+        }
+    else
+        {
+        ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+        memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        }
+    }
+
+Scalar EwaldForceCompute::getQ2Sum()
+    {
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    unsigned int group_size = m_group->getNumMembers();
+    Scalar q2(0.0);
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+
+        q2 += h_charge.data[j] * h_charge.data[j];
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &q2,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return q2;
+    }
+
+namespace detail
+    {
+void export_EwaldForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<EwaldForceCompute, ForceCompute, std::shared_ptr<EwaldForceCompute>>(
+        m,
+        "EwaldForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            std::shared_ptr<ParticleGroup>>())
+        .def("setParams", &EwaldForceCompute::setParams)
+        .def("getQ2Sum", &EwaldForceCompute::getQ2Sum)
+        .def_property_readonly("k_max", &EwaldForceCompute::getKMax)
+        .def_property_readonly("kappa", &EwaldForceCompute::getKappa)
+        .def_property_readonly("alpha", &EwaldForceCompute::getAlpha)
+        .def_property_readonly("num_k_vectors", &EwaldForceCompute::getNumKVectors);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
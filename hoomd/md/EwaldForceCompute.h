@@ -0,0 +1,157 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __EWALD_FORCE_COMPUTE_H__
+#define __EWALD_FORCE_COMPUTE_H__
+
+#include "NeighborList.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/ParticleGroup.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file EwaldForceCompute.h
+    \brief Declares the reciprocal space part of the Ewald sum
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Compute the reciprocal space part of the Ewald sum directly
+/*! EwaldForceCompute sums over the wave vectors k = n_1 b_1 + n_2 b_2 + n_3 b_3 of the reciprocal
+    lattice with |n_i / n_max_i| inside the unit sphere. For each k, it computes the structure
+    factor S(k) = sum_j q_j exp(i k.r_j) and
+
+        E = (1/V) sum_k A(k) |S(k)|^2
+        F_i = (2 q_i / V) sum_k A(k) k Im(S(k)^* exp(i k.r_i))
+
+    with A(k) = 4 pi exp(-(k^2 + alpha^2) / (4 kappa^2)) / (k^2 + alpha^2). The sums include only
+    one of each pair of wave vectors k and -k, which contribute equally.
+
+    The cost is O(N n_k), so the direct sum pays off over PPPM for small systems where it avoids
+    the mesh setup, the FFTs, and the aliasing error of the mesh. The real space part of the sum is
+    computed by the pair potential EvaluatorPairEwald.
+
+    The structure factor is reduced over all ranks, so every rank computes the full energy and
+    virial. Rank 0 stores them in the external energy and virial.
+*/
+class PYBIND11_EXPORT EwaldForceCompute : public ForceCompute
+    {
+    public:
+    //! Constructor
+    EwaldForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<NeighborList> nlist,
+                      std::shared_ptr<ParticleGroup> group);
+    virtual ~EwaldForceCompute();
+
+    //! Set the parameters
+    void setParams(unsigned int kx_max,
+                   unsigned int ky_max,
+                   unsigned int kz_max,
+                   Scalar kappa,
+                   Scalar alpha = 0);
+
+    //! Get sum of squares of charges
+    Scalar getQ2Sum();
+
+    /// Get the largest Miller indices
+    pybind11::tuple getKMax()
+        {
+        pybind11::list val;
+        val.append(m_k_max.x);
+        val.append(m_k_max.y);
+        val.append(m_k_max.z);
+
+        return pybind11::tuple(val);
+        }
+
+    /// Get the splitting parameter
+    Scalar getKappa()
+        {
+        return m_kappa;
+        }
+
+    /// Get the Debye screening parameter
+    Scalar getAlpha()
+        {
+        return m_alpha;
+        }
+
+    /// Get the number of wave vectors in the sum
+    unsigned int getNumKVectors()
+        {
+        return m_n_k;
+        }
+
+#ifdef ENABLE_MPI
+    //! Get ghost particle fields requested by this force
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep)
+        {
+        CommFlags flags = ForceCompute::getRequestedCommFlags(timestep);
+
+        if (m_nlist->getExclusionsSet())
+            {
+            // need ghost particle charge
+            flags[comm_flag::charge] = 1;
+            }
+
+        return flags;
+        }
+#endif
+
+    protected:
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    //! Compute the structure factor of the local particles
+    virtual void computeStructureFactor();
+
+    //! Compute the forces from the structure factor
+    virtual void computeForcesFromStructureFactor();
+
+    //! Correct the forces on excluded particles
+    virtual void fixExclusions();
+
+    //! Compute the wave vectors and their coefficients for the current box
+    void computeKVectors();
+
+    //! Reduce the structure factor and compute the energy and virial
+    void computeEnergyAndVirial(bool compute_virial);
+
+    std::shared_ptr<NeighborList> m_nlist;  //!< The neighborlist to use for the computation
+    std::shared_ptr<ParticleGroup> m_group; //!< Group to compute properties for
+    uint3 m_k_max;                          //!< Largest Miller index along each direction
+    Scalar m_kappa;                         //!< Splitting parameter
+    Scalar m_alpha;                         //!< Debye screening parameter
+    Scalar m_q2;                            //!< Sum of the squared charges of the group
+    bool m_params_set;                      //!< True if parameters are set
+    bool m_box_changed;                     //!< True if the box changed since the last step
+    bool m_ptls_added_removed;              //!< True if particles have been added or removed
+    unsigned int m_n_k;                     //!< Number of wave vectors
+    GlobalArray<Scalar4> m_k;               //!< Wave vectors (xyz) and their coefficients (w)
+    GlobalArray<Scalar2> m_s;               //!< Structure factor (real, imaginary)
+    std::vector<int3> m_miller;             //!< Miller indices of the wave vectors
+
+    //! Set the flag when the box changes
+    void setBoxChange()
+        {
+        m_box_changed = true;
+        }
+
+    //! Set the flag when particles are added or removed
+    void slotGlobalParticleNumberChange()
+        {
+        m_ptls_added_removed = true;
+        }
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,160 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "EwaldForceComputeGPU.h"
+
+#ifdef ENABLE_HIP
+#include "EwaldForceComputeGPU.cuh"
+#include "PPPMForceComputeGPU.cuh"
+
+/*! \file EwaldForceComputeGPU.cc
+    \brief Contains code for the EwaldForceComputeGPU class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param nlist Neighbor list that provides the exclusions
+    \param group Particles to include in the sum
+*/
+EwaldForceComputeGPU::EwaldForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<NeighborList> nlist,
+                                           std::shared_ptr<ParticleGroup> group)
+    : EwaldForceCompute(sysdef, nlist, group)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Cannot create EwaldForceComputeGPU on a CPU device.");
+        }
+
+    m_tuner_structure_factor.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                         m_exec_conf,
+                         "ewald_structure_factor"));
+    m_tuner_force.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                         m_exec_conf,
+                                         "ewald_force"));
+    m_tuner_exclusions.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                              m_exec_conf,
+                                              "ewald_exclusions"));
+
+    m_autotuners.insert(m_autotuners.end(),
+                        {m_tuner_structure_factor, m_tuner_force, m_tuner_exclusions});
+    }
+
+void EwaldForceComputeGPU::computeStructureFactor()
+    {
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<Scalar4> d_k(m_k, access_location::device, access_mode::read);
+    ArrayHandle<Scalar2> d_s(m_s, access_location::device, access_mode::overwrite);
+
+    m_tuner_structure_factor->begin();
+    kernel::gpu_compute_ewald_structure_factor(d_s.data,
+                                               d_k.data,
+                                               m_n_k,
+                                               d_pos.data,
+                                               d_charge.data,
+                                               d_index_array.data,
+                                               m_group->getNumMembers(),
+                                               m_tuner_structure_factor->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_structure_factor->end();
+    }
+
+void EwaldForceComputeGPU::computeForcesFromStructureFactor()
+    {
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<Scalar4> d_k(m_k, access_location::device, access_mode::read);
+    ArrayHandle<Scalar2> d_s(m_s, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::overwrite);
+
+    hipMemset(d_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+
+    Scalar prefactor = Scalar(2.0) / m_pdata->getGlobalBox().getVolume();
+
+    m_tuner_force->begin();
+    kernel::gpu_compute_ewald_forces(d_force.data,
+                                     d_k.data,
+                                     d_s.data,
+                                     m_n_k,
+                                     d_pos.data,
+                                     d_charge.data,
+                                     d_index_array.data,
+                                     m_group->getNumMembers(),
+                                     prefactor,
+                                     m_tuner_force->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_force->end();
+    }
+
+void EwaldForceComputeGPU::fixExclusions()
+    {
+    ArrayHandle<unsigned int> d_exlist(m_nlist->getExListArray(),
+                                       access_location::device,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> d_n_ex(m_nlist->getNExArray(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> d_force(m_force, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar> d_virial(m_virial, access_location::device, access_mode::readwrite);
+    ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<Scalar4> d_postype(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+    ArrayHandle<Scalar> d_charge(m_pdata->getCharges(), access_location::device, access_mode::read);
+
+    // reset virial
+    hipMemset(d_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    m_tuner_exclusions->begin();
+    kernel::gpu_fix_exclusions(d_force.data,
+                               d_virial.data,
+                               m_virial.getPitch(),
+                               m_pdata->getN() + m_pdata->getNGhosts(),
+                               d_postype.data,
+                               d_charge.data,
+                               m_pdata->getBox(),
+                               d_n_ex.data,
+                               d_exlist.data,
+                               m_nlist->getExListIndexer(),
+                               m_kappa,
+                               m_alpha,
+                               d_index_array.data,
+                               m_group->getNumMembers(),
+                               m_tuner_exclusions->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_exclusions->end();
+    }
+
+namespace detail
+    {
+void export_EwaldForceComputeGPU(pybind11::module& m)
+    {
+    pybind11::class_<EwaldForceComputeGPU,
+                     EwaldForceCompute,
+                     std::shared_ptr<EwaldForceComputeGPU>>(m, "EwaldForceComputeGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            std::shared_ptr<ParticleGroup>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
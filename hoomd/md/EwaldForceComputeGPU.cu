@@ -0,0 +1,242 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "EwaldForceComputeGPU.cuh"
+
+/*! \file EwaldForceComputeGPU.cu
+    \brief Defines GPU kernels for the reciprocal space part of the Ewald sum
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Compute exp(i k.r) accurately for large k.r
+/*! Reduce k.r / (2 pi) to [-1/2, 1/2] before evaluating the phase so that single precision
+    sincospi keeps full accuracy for large wave vectors.
+*/
+__device__ inline void ewald_phase(const Scalar4& k, const Scalar4& r, Scalar& s, Scalar& c)
+    {
+    Scalar x = (k.x * r.x + k.y * r.y + k.z * r.z) * Scalar(0.5 / M_PI);
+    x -= floor(x + Scalar(0.5));
+    fast::sincospi(Scalar(2.0) * x, s, c);
+    }
+
+//! Kernel to compute the structure factor
+/*! One block computes S(k) for one wave vector, the threads stride over the group members.
+ */
+__global__ void gpu_compute_ewald_structure_factor_kernel(Scalar2* d_s,
+                                                          const Scalar4* d_k,
+                                                          const Scalar4* d_pos,
+                                                          const Scalar* d_charge,
+                                                          const unsigned int* d_index_array,
+                                                          unsigned int group_size)
+    {
+    HIP_DYNAMIC_SHARED(Scalar2, sdata)
+
+    unsigned int k_idx = blockIdx.x;
+    Scalar4 k = d_k[k_idx];
+
+    Scalar2 sum = make_scalar2(0.0, 0.0);
+    for (unsigned int group_idx = threadIdx.x; group_idx < group_size; group_idx += blockDim.x)
+        {
+        unsigned int j = d_index_array[group_idx];
+        Scalar qj = d_charge[j];
+
+        Scalar s, c;
+        ewald_phase(k, d_pos[j], s, c);
+        sum.x += qj * c;
+        sum.y += qj * s;
+        }
+
+    sdata[threadIdx.x] = sum;
+    __syncthreads();
+
+    // reduce the sum, the block size need not be a power of two
+    unsigned int n = blockDim.x;
+    while (n > 1)
+        {
+        unsigned int half = (n + 1) / 2;
+        if (threadIdx.x < n - half)
+            {
+            sdata[threadIdx.x].x += sdata[threadIdx.x + half].x;
+            sdata[threadIdx.x].y += sdata[threadIdx.x + half].y;
+            }
+        n = half;
+        __syncthreads();
+        }
+
+    if (threadIdx.x == 0)
+        d_s[k_idx] = sdata[0];
+    }
+
+/*! \param d_s Output: Structure factor
+    \param d_k Wave vectors
+    \param n_k Number of wave vectors
+    \param d_pos Particle positions
+    \param d_charge Particle charges
+    \param d_index_array Indices of the group members
+    \param group_size Number of group members
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_compute_ewald_structure_factor(Scalar2* d_s,
+                                              const Scalar4* d_k,
+                                              unsigned int n_k,
+                                              const Scalar4* d_pos,
+                                              const Scalar* d_charge,
+                                              const unsigned int* d_index_array,
+                                              unsigned int group_size,
+                                              unsigned int block_size)
+    {
+    if (n_k == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_ewald_structure_factor_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_compute_ewald_structure_factor_kernel),
+                       dim3(n_k),
+                       dim3(run_block_size),
+                       run_block_size * sizeof(Scalar2),
+                       0,
+                       d_s,
+                       d_k,
+                       d_pos,
+                       d_charge,
+                       d_index_array,
+                       group_size);
+
+    return hipSuccess;
+    }
+
+//! Kernel to compute the forces from the structure factor
+/*! One thread computes the force on one group member. The block stages tiles of the wave vectors
+    and the structure factor in shared memory.
+*/
+__global__ void gpu_compute_ewald_forces_kernel(Scalar4* d_force,
+                                                const Scalar4* d_k,
+                                                const Scalar2* d_s,
+                                                unsigned int n_k,
+                                                const Scalar4* d_pos,
+                                                const Scalar* d_charge,
+                                                const unsigned int* d_index_array,
+                                                unsigned int group_size,
+                                                Scalar prefactor)
+    {
+    HIP_DYNAMIC_SHARED(char, s_data)
+    Scalar4* s_k = (Scalar4*)s_data;
+    Scalar2* s_s = (Scalar2*)(s_k + blockDim.x);
+
+    unsigned int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+    bool active = group_idx < group_size;
+
+    unsigned int j = 0;
+    Scalar qj(0.0);
+    Scalar4 postype = make_scalar4(0.0, 0.0, 0.0, 0.0);
+    if (active)
+        {
+        j = d_index_array[group_idx];
+        qj = d_charge[j];
+        postype = d_pos[j];
+        }
+
+    Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+    for (unsigned int tile = 0; tile < n_k; tile += blockDim.x)
+        {
+        unsigned int k_idx = tile + threadIdx.x;
+        if (k_idx < n_k)
+            {
+            s_k[threadIdx.x] = d_k[k_idx];
+            s_s[threadIdx.x] = d_s[k_idx];
+            }
+        __syncthreads();
+
+        unsigned int n_tile = min(blockDim.x, n_k - tile);
+        if (active)
+            {
+            for (unsigned int i = 0; i < n_tile; i++)
+                {
+                Scalar4 k = s_k[i];
+                Scalar2 s = s_s[i];
+
+                // A(k) Im(S(k)^* exp(i k.r_j))
+                Scalar sin_kr, cos_kr;
+                ewald_phase(k, postype, sin_kr, cos_kr);
+                Scalar im = k.w * (s.x * sin_kr - s.y * cos_kr);
+                force.x += im * k.x;
+                force.y += im * k.y;
+                force.z += im * k.z;
+                }
+            }
+        __syncthreads();
+        }
+
+    if (active)
+        {
+        d_force[j] = make_scalar4(prefactor * qj * force.x,
+                                  prefactor * qj * force.y,
+                                  prefactor * qj * force.z,
+                                  0.0);
+        }
+    }
+
+/*! \param d_force Output: Forces on the group members
+    \param d_k Wave vectors and their coefficients
+    \param d_s Structure factor summed over all ranks
+    \param n_k Number of wave vectors
+    \param d_pos Particle positions
+    \param d_charge Particle charges
+    \param d_index_array Indices of the group members
+    \param group_size Number of group members
+    \param prefactor 2 / V
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_compute_ewald_forces(Scalar4* d_force,
+                                    const Scalar4* d_k,
+                                    const Scalar2* d_s,
+                                    unsigned int n_k,
+                                    const Scalar4* d_pos,
+                                    const Scalar* d_charge,
+                                    const unsigned int* d_index_array,
+                                    unsigned int group_size,
+                                    Scalar prefactor,
+                                    unsigned int block_size)
+    {
+    if (group_size == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_ewald_forces_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    unsigned int shared_size = run_block_size * (sizeof(Scalar4) + sizeof(Scalar2));
+
+    hipLaunchKernelGGL((gpu_compute_ewald_forces_kernel),
+                       dim3(group_size / run_block_size + 1),
+                       dim3(run_block_size),
+                       shared_size,
+                       0,
+                       d_force,
+                       d_k,
+                       d_s,
+                       n_k,
+                       d_pos,
+                       d_charge,
+                       d_index_array,
+                       group_size,
+                       prefactor);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,42 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/HOOMDMath.h"
+
+#include "hip/hip_runtime.h"
+
+/*! \file EwaldForceComputeGPU.cuh
+    \brief Declares GPU kernel drivers for the reciprocal space part of the Ewald sum
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Compute the structure factor of the group members
+hipError_t gpu_compute_ewald_structure_factor(Scalar2* d_s,
+                                              const Scalar4* d_k,
+                                              unsigned int n_k,
+                                              const Scalar4* d_pos,
+                                              const Scalar* d_charge,
+                                              const unsigned int* d_index_array,
+                                              unsigned int group_size,
+                                              unsigned int block_size);
+
+//! Compute the forces on the group members from the structure factor
+hipError_t gpu_compute_ewald_forces(Scalar4* d_force,
+                                    const Scalar4* d_k,
+                                    const Scalar2* d_s,
+                                    unsigned int n_k,
+                                    const Scalar4* d_pos,
+                                    const Scalar* d_charge,
+                                    const unsigned int* d_index_array,
+                                    unsigned int group_size,
+                                    Scalar prefactor,
+                                    unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
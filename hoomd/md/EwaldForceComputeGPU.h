@@ -0,0 +1,63 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "EwaldForceCompute.h"
+
+#ifndef __EWALD_FORCE_COMPUTE_GPU_H__
+#define __EWALD_FORCE_COMPUTE_GPU_H__
+
+#ifdef ENABLE_HIP
+
+#include "hoomd/Autotuner.h"
+
+/*! \file EwaldForceComputeGPU.h
+    \brief Declares the GPU implementation of the reciprocal space part of the Ewald sum
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Compute the reciprocal space part of the Ewald sum on the GPU
+/*! The structure factor kernel reduces over the particles with one block per wave vector. The
+    force kernel evaluates one particle per thread.
+*/
+class PYBIND11_EXPORT EwaldForceComputeGPU : public EwaldForceCompute
+    {
+    public:
+    //! Constructor
+    EwaldForceComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<NeighborList> nlist,
+                         std::shared_ptr<ParticleGroup> group);
+    virtual ~EwaldForceComputeGPU() { }
+
+    protected:
+    //! Compute the structure factor of the local particles
+    virtual void computeStructureFactor();
+
+    //! Compute the forces from the structure factor
+    virtual void computeForcesFromStructureFactor();
+
+    //! Correct the forces on excluded particles
+    virtual void fixExclusions();
+
+    private:
+    /// Autotuner for the structure factor
+    std::shared_ptr<Autotuner<1>> m_tuner_structure_factor;
+
+    /// Autotuner for the forces
+    std::shared_ptr<Autotuner<1>> m_tuner_force;
+
+    /// Autotuner for the exclusion correction
+    std::shared_ptr<Autotuner<1>> m_tuner_exclusions;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
+#endif // __EWALD_FORCE_COMPUTE_GPU_H__
@@ -27,12 +27,6 @@ FIREEnergyMinimizerGPU::FIREEnergyMinimizerGPU(std::shared_ptr<SystemDefinition>
         throw std::runtime_error("FIREEnergyMinimizerGPU requires a GPU device.");
         }
 
-    // allocate the sum arrays
-    GPUArray<Scalar> sum(1, m_exec_conf);
-    m_sum.swap(sum);
-    GPUArray<Scalar> sum3(3, m_exec_conf);
-    m_sum3.swap(sum3);
-
     // initialize the partial sum arrays
     m_partial_sum1 = GPUVector<Scalar>(m_exec_conf);
     m_partial_sum2 = GPUVector<Scalar>(m_exec_conf);
@@ -64,6 +58,12 @@ void FIREEnergyMinimizerGPU::resizePartialSumArrays()
         m_partial_sum2.resize(num_blocks);
         m_partial_sum3.resize(num_blocks);
         }
+
+    if (m_sums.getNumElements() != m_methods.size() * n_sums)
+        {
+        GPUArray<Scalar> sums(m_methods.size() * n_sums, m_exec_conf);
+        m_sums.swap(sums);
+        }
     }
 
 /*! \param timesteps is the iteration number
@@ -76,158 +76,77 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
 
     IntegratorTwoStep::update(timestep);
 
-    Scalar Pt(0.0); // translational power
-    Scalar Pr(0.0); // rotational power
-    Scalar vnorm(0.0);
-    Scalar fnorm(0.0);
-    Scalar energy(0.0);
-    Scalar tnorm(0.0);
-    Scalar wnorm(0.0);
-
     // update partial sum memory space if needed
     resizePartialSumArrays();
 
-    // compute the total energy on the GPU
-    // CPU version is Scalar energy = computePotentialEnergy(timesteps)/Scalar(group_size);
+    // Reduce all sums of all methods on the device first, then copy them to the host at once. The
+    // kernels run in order on one stream, so they may share the partial sum arrays. The FIRE
+    // state machine stays on the host because the methods take the step size as a kernel
+    // argument.
     unsigned int total_group_size = 0;
 
-    for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
         {
-        std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
+        ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
+                                     access_location::device,
+                                     access_mode::read);
+        ArrayHandle<Scalar> d_partial_sum1(m_partial_sum1,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar> d_partial_sum2(m_partial_sum2,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar> d_partial_sum3(m_partial_sum3,
+                                           access_location::device,
+                                           access_mode::overwrite);
+        ArrayHandle<Scalar> d_sums(m_sums, access_location::device, access_mode::overwrite);
 
-        unsigned int group_size = current_group->getNumMembers();
-        total_group_size += group_size;
+        for (unsigned int i = 0; i < m_methods.size(); i++)
+            {
+            std::shared_ptr<ParticleGroup> current_group = m_methods[i]->getGroup();
 
-        ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                access_location::device,
-                                                access_mode::read);
+            unsigned int group_size = current_group->getNumMembers();
+            total_group_size += group_size;
 
-            {
-            ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
-                                             access_location::device,
-                                             access_mode::read);
-            ArrayHandle<Scalar> d_partial_sumE(m_partial_sum1,
-                                               access_location::device,
-                                               access_mode::overwrite);
-            ArrayHandle<Scalar> d_sumE(m_sum, access_location::device, access_mode::overwrite);
+            ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
+                                                    access_location::device,
+                                                    access_mode::read);
 
+            Scalar* d_method_sums = d_sums.data + i * n_sums;
             unsigned int num_blocks = group_size / m_block_size + 1;
             kernel::gpu_fire_compute_sum_pe(d_index_array.data,
                                             group_size,
                                             d_net_force.data,
-                                            d_sumE.data,
-                                            d_partial_sumE.data,
+                                            d_method_sums + sum_energy,
+                                            d_partial_sum1.data,
                                             m_block_size,
                                             num_blocks);
 
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
-            }
-
-        ArrayHandle<Scalar> h_sumE(m_sum, access_location::host, access_mode::read);
-        energy += h_sumE.data[0];
-        }
-
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &energy,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &total_group_size,
-                      1,
-                      MPI_INT,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        }
-#endif
-
-    m_energy_total = energy;
-    energy /= (Scalar)total_group_size;
-
-    if (m_was_reset)
-        {
-        m_was_reset = false;
-        m_old_energy = energy + Scalar(100000) * m_etol;
-        }
-
-    // sum P, vnorm, fnorm
-
-#ifdef ENABLE_MPI
-    bool aniso = false;
-#endif
-
-    for (auto method = m_methods.begin(); method != m_methods.end(); ++method)
-        {
-        std::shared_ptr<ParticleGroup> current_group = (*method)->getGroup();
-
-        unsigned int group_size = current_group->getNumMembers();
-        ArrayHandle<unsigned int> d_index_array(current_group->getIndexArray(),
-                                                access_location::device,
-                                                access_mode::read);
-
-            {
-            ArrayHandle<Scalar> d_partial_sum_P(m_partial_sum1,
-                                                access_location::device,
-                                                access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_vsq(m_partial_sum2,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_partial_sum_fsq(m_partial_sum3,
-                                                  access_location::device,
-                                                  access_mode::overwrite);
-            ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
-            ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
-                                       access_location::device,
-                                       access_mode::read);
-            ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
-                                         access_location::device,
-                                         access_mode::read);
-
-            unsigned int num_blocks = group_size / m_block_size + 1;
 
             kernel::gpu_fire_compute_sum_all(m_pdata->getN(),
                                              d_vel.data,
                                              d_accel.data,
                                              d_index_array.data,
                                              group_size,
-                                             d_sum.data,
-                                             d_partial_sum_P.data,
-                                             d_partial_sum_vsq.data,
-                                             d_partial_sum_fsq.data,
+                                             d_method_sums + sum_P,
+                                             d_partial_sum1.data,
+                                             d_partial_sum2.data,
+                                             d_partial_sum3.data,
                                              m_block_size,
                                              num_blocks);
 
             if (m_exec_conf->isCUDAErrorCheckingEnabled())
                 CHECK_CUDA_ERROR();
-            }
-
-        ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-        Pt += h_sum.data[0];
-        vnorm += h_sum.data[1];
-        fnorm += h_sum.data[2];
-
-        if ((*method)->getAnisotropic())
-            {
-#ifdef ENABLE_MPI
-            aniso = true;
-#endif
 
+            if (m_methods[i]->getAnisotropic())
                 {
-                ArrayHandle<Scalar> d_partial_sum_Pr(m_partial_sum1,
-                                                     access_location::device,
-                                                     access_mode::overwrite);
-                ArrayHandle<Scalar> d_partial_sum_wnorm(m_partial_sum2,
-                                                        access_location::device,
-                                                        access_mode::overwrite);
-                ArrayHandle<Scalar> d_partial_sum_tsq(m_partial_sum3,
-                                                      access_location::device,
-                                                      access_mode::overwrite);
-                ArrayHandle<Scalar> d_sum(m_sum3, access_location::device, access_mode::overwrite);
                 ArrayHandle<Scalar4> d_orientation(m_pdata->getOrientationArray(),
                                                    access_location::device,
                                                    access_mode::read);
@@ -241,8 +160,6 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                                                access_location::device,
                                                access_mode::read);
 
-                unsigned int num_blocks = group_size / m_block_size + 1;
-
                 kernel::gpu_fire_compute_sum_all_angular(m_pdata->getN(),
                                                          d_orientation.data,
                                                          d_inertia.data,
@@ -250,20 +167,31 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
                                                          d_net_torque.data,
                                                          d_index_array.data,
                                                          group_size,
-                                                         d_sum.data,
-                                                         d_partial_sum_Pr.data,
-                                                         d_partial_sum_wnorm.data,
-                                                         d_partial_sum_tsq.data,
+                                                         d_method_sums + sum_Pr,
+                                                         d_partial_sum1.data,
+                                                         d_partial_sum2.data,
+                                                         d_partial_sum3.data,
                                                          m_block_size,
                                                          num_blocks);
 
                 if (m_exec_conf->isCUDAErrorCheckingEnabled())
                     CHECK_CUDA_ERROR();
                 }
-            ArrayHandle<Scalar> h_sum(m_sum3, access_location::host, access_mode::read);
-            Pr += h_sum.data[0];
-            wnorm += h_sum.data[1];
-            tnorm += h_sum.data[2];
+            }
+        }
+
+    // a single device to host copy per iteration
+    Scalar sums[n_sums] = {};
+        {
+        ArrayHandle<Scalar> h_sums(m_sums, access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < m_methods.size(); i++)
+            {
+            // the angular sums are not written for isotropic methods
+            unsigned int n_method_sums = m_methods[i]->getAnisotropic() ? n_sums : sum_Pr;
+            for (unsigned int j = 0; j < n_method_sums; j++)
+                {
+                sums[j] += h_sums.data[i * n_sums + j];
+                }
             }
         }
 
@@ -271,48 +199,36 @@ void FIREEnergyMinimizerGPU::update(uint64_t timestep)
     if (m_pdata->getDomainDecomposition())
         {
         MPI_Allreduce(MPI_IN_PLACE,
-                      &fnorm,
-                      1,
+                      sums,
+                      n_sums,
                       MPI_HOOMD_SCALAR,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
         MPI_Allreduce(MPI_IN_PLACE,
-                      &vnorm,
-                      1,
-                      MPI_HOOMD_SCALAR,
-                      MPI_SUM,
-                      m_exec_conf->getMPICommunicator());
-        MPI_Allreduce(MPI_IN_PLACE,
-                      &Pt,
+                      &total_group_size,
                       1,
-                      MPI_HOOMD_SCALAR,
+                      MPI_INT,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
-
-        if (aniso)
-            {
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &tnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &wnorm,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            MPI_Allreduce(MPI_IN_PLACE,
-                          &Pr,
-                          1,
-                          MPI_HOOMD_SCALAR,
-                          MPI_SUM,
-                          m_exec_conf->getMPICommunicator());
-            }
         }
 #endif
 
+    Scalar energy = sums[sum_energy];
+    Scalar Pt = sums[sum_P]; // translational power
+    Scalar vnorm = sums[sum_vsq];
+    Scalar fnorm = sums[sum_asq];
+    Scalar Pr = sums[sum_Pr]; // rotational power
+    Scalar wnorm = sums[sum_wnorm];
+    Scalar tnorm = sums[sum_tsq];
+
+    m_energy_total = energy;
+    energy /= (Scalar)total_group_size;
+
+    if (m_was_reset)
+        {
+        m_was_reset = false;
+        m_old_energy = energy + Scalar(100000) * m_etol;
+        }
     vnorm = sqrt(vnorm);
     fnorm = sqrt(fnorm);
     wnorm = sqrt(wnorm);
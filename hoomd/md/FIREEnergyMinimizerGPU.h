@@ -45,8 +45,22 @@ class PYBIND11_EXPORT FIREEnergyMinimizerGPU : public FIREEnergyMinimizer
     GPUVector<Scalar> m_partial_sum1; //!< memory space for partial sum over P and E
     GPUVector<Scalar> m_partial_sum2; //!< memory space for partial sum over vsq
     GPUVector<Scalar> m_partial_sum3; //!< memory space for partial sum over asq
-    GPUArray<Scalar> m_sum;           //!< memory space for sum over E
-    GPUArray<Scalar> m_sum3;          //!< memory space for the sum over P, vsq, asq
+
+    //! Offsets of the sums of each method in m_sums
+    enum sum_index
+        {
+        sum_energy = 0, //!< potential energy
+        sum_P,          //!< translational power
+        sum_vsq,        //!< velocity squared
+        sum_asq,        //!< acceleration squared
+        sum_Pr,         //!< rotational power
+        sum_wnorm,      //!< angular velocity squared
+        sum_tsq,        //!< torque squared
+        n_sums
+        };
+
+    //! Sums of each method, copied to the host once per iteration
+    GPUArray<Scalar> m_sums;
 
     private:
     //! allocate the memory needed to store partial sums
@@ -10,6 +10,11 @@
 
 #include <pybind11/stl.h>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file ForceComposite.cc
     \brief Contains code for the ForceComposite class
 */
@@ -719,122 +724,150 @@ void ForceComposite::computeForces(uint64_t timestep)
         compute_virial = true;
         }
 
-    // loop over all molecules, also incomplete ones
-    for (unsigned int ibody = 0; ibody < nmol; ibody++)
+    // loop over all molecules, also incomplete ones. Each molecule writes only to its central
+    // particle and its own constituents, so threads can process different molecules concurrently.
+    auto compute_bodies = [&](unsigned int begin, unsigned int end)
         {
-        // get central particle tag from first particle in molecule
-        assert(h_molecule_length.data[ibody] > 0);
-        unsigned int first_idx = h_molecule_list.data[molecule_indexer(0, ibody)];
+        for (unsigned int ibody = begin; ibody < end; ibody++)
+            {
+            // get central particle tag from first particle in molecule
+            assert(h_molecule_length.data[ibody] > 0);
+            unsigned int first_idx = h_molecule_list.data[molecule_indexer(0, ibody)];
 
-        assert(first_idx < m_pdata->getN() + m_pdata->getNGhosts());
-        unsigned int central_tag = h_body.data[first_idx];
+            assert(first_idx < m_pdata->getN() + m_pdata->getNGhosts());
+            unsigned int central_tag = h_body.data[first_idx];
 
-        assert(central_tag <= m_pdata->getMaximumTag());
-        unsigned int central_idx = h_rtag.data[central_tag];
+            assert(central_tag <= m_pdata->getMaximumTag());
+            unsigned int central_idx = h_rtag.data[central_tag];
 
-        if (central_idx >= n_particles_local)
-            continue;
+            if (central_idx >= n_particles_local)
+                continue;
 
-        // the central particle must be present
-        assert(central_tag == h_tag.data[first_idx]);
+            // the central particle must be present
+            assert(central_tag == h_tag.data[first_idx]);
 
-        // central particle position and orientation
-        Scalar4 postype = h_postype.data[central_idx];
-        quat<Scalar> orientation(h_orientation.data[central_idx]);
+            // central particle position and orientation
+            Scalar4 postype = h_postype.data[central_idx];
+            quat<Scalar> orientation(h_orientation.data[central_idx]);
 
-        // body type
-        unsigned int type = __scalar_as_int(postype.w);
+            // body type
+            unsigned int type = __scalar_as_int(postype.w);
 
-        // sum up forces and torques from constituent particles
-        for (unsigned int constituent_index = 0; constituent_index < h_molecule_length.data[ibody];
-             ++constituent_index)
-            {
-            unsigned int idxj = h_molecule_list.data[molecule_indexer(constituent_index, ibody)];
-            assert(idxj < m_pdata->getN() + m_pdata->getNGhosts());
+            // sum up forces and torques from constituent particles
+            for (unsigned int constituent_index = 0;
+                 constituent_index < h_molecule_length.data[ibody];
+                 ++constituent_index)
+                {
+                unsigned int idxj
+                    = h_molecule_list.data[molecule_indexer(constituent_index, ibody)];
+                assert(idxj < m_pdata->getN() + m_pdata->getNGhosts());
 
-            assert(idxj == central_idx || constituent_index > 0);
-            if (idxj == central_idx)
-                continue;
+                assert(idxj == central_idx || constituent_index > 0);
+                if (idxj == central_idx)
+                    continue;
 
-            // force and torque on particle
-            Scalar4 net_force = h_net_force.data[idxj];
-            Scalar4 net_torque = h_net_torque.data[idxj];
-            vec3<Scalar> f(net_force);
+                // force and torque on particle
+                Scalar4 net_force = h_net_force.data[idxj];
+                Scalar4 net_torque = h_net_torque.data[idxj];
+                vec3<Scalar> f(net_force);
 
-            // zero net energy on constituent particles to avoid double counting
-            // also zero net force and torque for consistency
-            h_net_force.data[idxj] = make_scalar4(0.0, 0.0, 0.0, 0.0);
-            h_net_torque.data[idxj] = make_scalar4(0.0, 0.0, 0.0, 0.0);
+                // zero net energy on constituent particles to avoid double counting
+                // also zero net force and torque for consistency
+                h_net_force.data[idxj] = make_scalar4(0.0, 0.0, 0.0, 0.0);
+                h_net_torque.data[idxj] = make_scalar4(0.0, 0.0, 0.0, 0.0);
 
-            // only add forces for local central particles
-            if (central_idx < m_pdata->getN())
-                {
-                // if the central particle is local, the molecule should be complete
-                if (h_molecule_length.data[ibody] != h_body_len.data[type] + 1)
+                // only add forces for local central particles
+                if (central_idx < m_pdata->getN())
                     {
-                    std::ostringstream error_msg;
-                    error_msg << "Composite particle with body tag " << central_tag
-                              << " is incomplete.";
-                    throw std::runtime_error(error_msg.str());
-                    }
+                    // if the central particle is local, the molecule should be complete
+                    if (h_molecule_length.data[ibody] != h_body_len.data[type] + 1)
+                        {
+                        std::ostringstream error_msg;
+                        error_msg << "Composite particle with body tag " << central_tag
+                                  << " is incomplete.";
+                        throw std::runtime_error(error_msg.str());
+                        }
 
-                // sum up center of mass force
-                h_force.data[central_idx].x += f.x;
-                h_force.data[central_idx].y += f.y;
-                h_force.data[central_idx].z += f.z;
+                    // sum up center of mass force
+                    h_force.data[central_idx].x += f.x;
+                    h_force.data[central_idx].y += f.y;
+                    h_force.data[central_idx].z += f.z;
 
-                // sum up energy
-                h_force.data[central_idx].w += net_force.w;
+                    // sum up energy
+                    h_force.data[central_idx].w += net_force.w;
 
-                // fetch relative position from rigid body definition
-                vec3<Scalar> dr(h_body_pos.data[m_body_idx(type, constituent_index - 1)]);
+                    // fetch relative position from rigid body definition
+                    vec3<Scalar> dr(h_body_pos.data[m_body_idx(type, constituent_index - 1)]);
 
-                // rotate into space frame
-                vec3<Scalar> dr_space = rotate(orientation, dr);
+                    // rotate into space frame
+                    vec3<Scalar> dr_space = rotate(orientation, dr);
 
-                // torque = r x f
-                vec3<Scalar> delta_torque(cross(dr_space, f));
-                h_torque.data[central_idx].x += delta_torque.x;
-                h_torque.data[central_idx].y += delta_torque.y;
-                h_torque.data[central_idx].z += delta_torque.z;
+                    // torque = r x f
+                    vec3<Scalar> delta_torque(cross(dr_space, f));
+                    h_torque.data[central_idx].x += delta_torque.x;
+                    h_torque.data[central_idx].y += delta_torque.y;
+                    h_torque.data[central_idx].z += delta_torque.z;
 
-                /* from previous rigid body implementation: Access Torque elements from a single
-                   particle. Right now I will am assuming that the particle and rigid body reference
-                   frames are the same. Probably have to rotate first.
-                 */
-                h_torque.data[central_idx].x += net_torque.x;
-                h_torque.data[central_idx].y += net_torque.y;
-                h_torque.data[central_idx].z += net_torque.z;
+                    /* from previous rigid body implementation: Access Torque elements from a
+                       single particle. Right now I will am assuming that the particle and rigid
+                       body reference frames are the same. Probably have to rotate first.
+                     */
+                    h_torque.data[central_idx].x += net_torque.x;
+                    h_torque.data[central_idx].y += net_torque.y;
+                    h_torque.data[central_idx].z += net_torque.z;
 
-                if (compute_virial)
-                    {
-                    // sum up virial
-                    Scalar virialxx = h_net_virial.data[0 * net_virial_pitch + idxj];
-                    Scalar virialxy = h_net_virial.data[1 * net_virial_pitch + idxj];
-                    Scalar virialxz = h_net_virial.data[2 * net_virial_pitch + idxj];
-                    Scalar virialyy = h_net_virial.data[3 * net_virial_pitch + idxj];
-                    Scalar virialyz = h_net_virial.data[4 * net_virial_pitch + idxj];
-                    Scalar virialzz = h_net_virial.data[5 * net_virial_pitch + idxj];
-
-                    // subtract intra-body virial prt
-                    h_virial.data[0 * m_virial_pitch + central_idx] += virialxx - f.x * dr_space.x;
-                    h_virial.data[1 * m_virial_pitch + central_idx] += virialxy - f.x * dr_space.y;
-                    h_virial.data[2 * m_virial_pitch + central_idx] += virialxz - f.x * dr_space.z;
-                    h_virial.data[3 * m_virial_pitch + central_idx] += virialyy - f.y * dr_space.y;
-                    h_virial.data[4 * m_virial_pitch + central_idx] += virialyz - f.y * dr_space.z;
-                    h_virial.data[5 * m_virial_pitch + central_idx] += virialzz - f.z * dr_space.z;
+                    if (compute_virial)
+                        {
+                        // sum up virial
+                        Scalar virialxx = h_net_virial.data[0 * net_virial_pitch + idxj];
+                        Scalar virialxy = h_net_virial.data[1 * net_virial_pitch + idxj];
+                        Scalar virialxz = h_net_virial.data[2 * net_virial_pitch + idxj];
+                        Scalar virialyy = h_net_virial.data[3 * net_virial_pitch + idxj];
+                        Scalar virialyz = h_net_virial.data[4 * net_virial_pitch + idxj];
+                        Scalar virialzz = h_net_virial.data[5 * net_virial_pitch + idxj];
+
+                        // subtract intra-body virial prt
+                        h_virial.data[0 * m_virial_pitch + central_idx]
+                            += virialxx - f.x * dr_space.x;
+                        h_virial.data[1 * m_virial_pitch + central_idx]
+                            += virialxy - f.x * dr_space.y;
+                        h_virial.data[2 * m_virial_pitch + central_idx]
+                            += virialxz - f.x * dr_space.z;
+                        h_virial.data[3 * m_virial_pitch + central_idx]
+                            += virialyy - f.y * dr_space.y;
+                        h_virial.data[4 * m_virial_pitch + central_idx]
+                            += virialyz - f.y * dr_space.z;
+                        h_virial.data[5 * m_virial_pitch + central_idx]
+                            += virialzz - f.z * dr_space.z;
+                        }
                     }
-                }
 
-            // zero net virial
-            h_net_virial.data[0 * net_virial_pitch + idxj] = 0.0;
-            h_net_virial.data[1 * net_virial_pitch + idxj] = 0.0;
-            h_net_virial.data[2 * net_virial_pitch + idxj] = 0.0;
-            h_net_virial.data[3 * net_virial_pitch + idxj] = 0.0;
-            h_net_virial.data[4 * net_virial_pitch + idxj] = 0.0;
-            h_net_virial.data[5 * net_virial_pitch + idxj] = 0.0;
+                // zero net virial
+                h_net_virial.data[0 * net_virial_pitch + idxj] = 0.0;
+                h_net_virial.data[1 * net_virial_pitch + idxj] = 0.0;
+                h_net_virial.data[2 * net_virial_pitch + idxj] = 0.0;
+                h_net_virial.data[3 * net_virial_pitch + idxj] = 0.0;
+                h_net_virial.data[4 * net_virial_pitch + idxj] = 0.0;
+                h_net_virial.data[5 * net_virial_pitch + idxj] = 0.0;
+                }
             }
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nmol),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { compute_bodies(r.begin(), r.end()); });
+            });
+        return;
         }
+#endif
+
+    compute_bodies(0, nmol);
     }
 
 /* Set position, velocity, and type of constituent particles in rigid bodies in the 1st or second
@@ -891,102 +924,124 @@ void ForceComposite::updateCompositeParticles(uint64_t timestep)
 
     // we need to update both local and ghost particles
     unsigned int n_particles_local = m_pdata->getN() + m_pdata->getNGhosts();
-    for (unsigned int particle_index = 0; particle_index < n_particles_local; particle_index++)
+    // each constituent particle reads the central particle of its body and writes only to itself,
+    // so threads can update different particles concurrently
+    auto update_particles = [&](unsigned int begin, unsigned int end)
         {
-        unsigned int central_tag = h_body.data[particle_index];
-
-        // Do nothing with floppy bodies, since we don't need to update their positions or
-        // orientations here.
-        if (central_tag >= MIN_FLOPPY)
+        for (unsigned int particle_index = begin; particle_index < end; particle_index++)
             {
-            continue;
-            }
+            unsigned int central_tag = h_body.data[particle_index];
 
-        // body tag equals tag for central particle
-        assert(central_tag <= m_pdata->getMaximumTag());
-        unsigned int central_idx = h_rtag.data[central_tag];
+            // Do nothing with floppy bodies, since we don't need to update their positions or
+            // orientations here.
+            if (central_tag >= MIN_FLOPPY)
+                {
+                continue;
+                }
 
-        // If this is a rigid body center continue, since we do not need to update its position or
-        // orientation (the integrator methods do this).
-        if (particle_index == central_idx)
-            {
-            continue;
-            }
+            // body tag equals tag for central particle
+            assert(central_tag <= m_pdata->getMaximumTag());
+            unsigned int central_idx = h_rtag.data[central_tag];
 
-        // If the central particle is not local, then we cannot update the position and orientation
-        // of this particle. Ideally, this would perform an error check. However, that is not
-        // feasible as ForceComposite does not have knowledge of which ghost particles are within
-        // the interaction ghost width (and need therefore need to be updated) vs those that are
-        // communicated to make bodies whole.
-        if (central_idx == NOT_LOCAL)
-            {
-            continue;
-            }
+            // If this is a rigid body center continue, since we do not need to update its position
+            // or orientation (the integrator methods do this).
+            if (particle_index == central_idx)
+                {
+                continue;
+                }
 
-        // central particle position and orientation
-        assert(central_idx <= m_pdata->getN() + m_pdata->getNGhosts());
+            // If the central particle is not local, then we cannot update the position and
+            // orientation of this particle. Ideally, this would perform an error check. However,
+            // that is not feasible as ForceComposite does not have knowledge of which ghost
+            // particles are within the interaction ghost width (and need therefore need to be
+            // updated) vs those that are communicated to make bodies whole.
+            if (central_idx == NOT_LOCAL)
+                {
+                continue;
+                }
 
-        Scalar4 postype = h_postype.data[central_idx];
-        vec3<Scalar> pos(postype);
-        quat<Scalar> orientation(h_orientation.data[central_idx]);
+            // central particle position and orientation
+            assert(central_idx <= m_pdata->getN() + m_pdata->getNGhosts());
 
-        // body type
-        unsigned int type = __scalar_as_int(postype.w);
+            Scalar4 postype = h_postype.data[central_idx];
+            vec3<Scalar> pos(postype);
+            quat<Scalar> orientation(h_orientation.data[central_idx]);
 
-        unsigned int body_len = h_body_len.data[type];
-        unsigned int mol_idx = h_molecule_idx.data[particle_index];
-        // Checks if the number of local particle in a molecule denoted by
-        // h_molecule_len.data[particle_index] is equal to the number of particles in the rigid body
-        // definition `body_len`. As above, this error check *should* be performed for all local and
-        // ghost particles within the interaction ghost width. However, that check is not feasible
-        // here. At least catch this error for particles local to this rank.
-        if (body_len != h_molecule_len.data[mol_idx] - 1)
-            {
-            if (particle_index < m_pdata->getN())
+            // body type
+            unsigned int type = __scalar_as_int(postype.w);
+
+            unsigned int body_len = h_body_len.data[type];
+            unsigned int mol_idx = h_molecule_idx.data[particle_index];
+            // Checks if the number of local particle in a molecule denoted by
+            // h_molecule_len.data[particle_index] is equal to the number of particles in the rigid
+            // body definition `body_len`. As above, this error check *should* be performed for all
+            // local and ghost particles within the interaction ghost width. However, that check is
+            // not feasible here. At least catch this error for particles local to this rank.
+            if (body_len != h_molecule_len.data[mol_idx] - 1)
                 {
-                // if the molecule is incomplete and has local members, this is an error
-                std::ostringstream error_msg;
-                error_msg << "Error while updating constituent particles:"
-                          << "Composite particle with body tag " << central_tag << " incomplete: "
-                          << "body_len=" << body_len
-                          << ", molecule_len=" << h_molecule_len.data[mol_idx] - 1;
-                throw std::runtime_error(error_msg.str());
+                if (particle_index < m_pdata->getN())
+                    {
+                    // if the molecule is incomplete and has local members, this is an error
+                    std::ostringstream error_msg;
+                    error_msg << "Error while updating constituent particles:"
+                              << "Composite particle with body tag " << central_tag
+                              << " incomplete: "
+                              << "body_len=" << body_len
+                              << ", molecule_len=" << h_molecule_len.data[mol_idx] - 1;
+                    throw std::runtime_error(error_msg.str());
+                    }
+
+                // otherwise we must ignore it
+                continue;
                 }
 
-            // otherwise we must ignore it
-            continue;
-            }
+            int3 img = h_image.data[central_idx];
 
-        int3 img = h_image.data[central_idx];
+            // fetch relative index in body from molecule list
+            assert(h_molecule_order.data[particle_index] > 0);
+            unsigned int idx_in_body = h_molecule_order.data[particle_index] - 1;
 
-        // fetch relative index in body from molecule list
-        assert(h_molecule_order.data[particle_index] > 0);
-        unsigned int idx_in_body = h_molecule_order.data[particle_index] - 1;
+            vec3<Scalar> local_pos(h_body_pos.data[m_body_idx(type, idx_in_body)]);
+            vec3<Scalar> dr_space = rotate(orientation, local_pos);
 
-        vec3<Scalar> local_pos(h_body_pos.data[m_body_idx(type, idx_in_body)]);
-        vec3<Scalar> dr_space = rotate(orientation, local_pos);
+            // update position and orientation
+            vec3<Scalar> updated_pos(pos);
+            quat<Scalar> local_orientation(h_body_orientation.data[m_body_idx(type, idx_in_body)]);
 
-        // update position and orientation
-        vec3<Scalar> updated_pos(pos);
-        quat<Scalar> local_orientation(h_body_orientation.data[m_body_idx(type, idx_in_body)]);
+            updated_pos += dr_space;
+            quat<Scalar> updated_orientation = orientation * local_orientation;
 
-        updated_pos += dr_space;
-        quat<Scalar> updated_orientation = orientation * local_orientation;
+            // this runs before the ForceComputes,
+            // wrap into box, allowing rigid bodies to span multiple images
+            int3 imgi = box.getImage(vec_to_scalar3(updated_pos));
+            int3 negimgi = make_int3(-imgi.x, -imgi.y, -imgi.z);
+            updated_pos = global_box.shift(updated_pos, negimgi);
 
-        // this runs before the ForceComputes,
-        // wrap into box, allowing rigid bodies to span multiple images
-        int3 imgi = box.getImage(vec_to_scalar3(updated_pos));
-        int3 negimgi = make_int3(-imgi.x, -imgi.y, -imgi.z);
-        updated_pos = global_box.shift(updated_pos, negimgi);
+            h_postype.data[particle_index]
+                = make_scalar4(updated_pos.x,
+                               updated_pos.y,
+                               updated_pos.z,
+                               __int_as_scalar(h_body_types.data[m_body_idx(type, idx_in_body)]));
+            h_orientation.data[particle_index] = quat_to_scalar4(updated_orientation);
+            h_image.data[particle_index] = img + imgi;
+            }
+        };
 
-        h_postype.data[particle_index]
-            = make_scalar4(updated_pos.x,
-                           updated_pos.y,
-                           updated_pos.z,
-                           __int_as_scalar(h_body_types.data[m_body_idx(type, idx_in_body)]));
-        h_orientation.data[particle_index] = quat_to_scalar4(updated_orientation);
-        h_image.data[particle_index] = img + imgi;
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_particles_local),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { update_particles(r.begin(), r.end()); });
+            });
+        return;
         }
+#endif
+
+    update_particles(0, n_particles_local);
     }
 
 namespace detail
@@ -20,7 +20,10 @@ ForceDistanceConstraint::ForceDistanceConstraint(std::shared_ptr<SystemDefinitio
     : MolecularForceCompute(sysdef), m_cdata(m_sysdef->getConstraintData()), m_cmatrix(m_exec_conf),
       m_cvec(m_exec_conf), m_lagrange(m_exec_conf), m_rel_tol(1e-3),
       m_constraint_violated(m_exec_conf), m_condition(m_exec_conf), m_sparse_idxlookup(m_exec_conf),
-      m_constraint_reorder(true), m_constraints_added_removed(true), m_d_max(0.0)
+      m_constraint_reorder(true), m_constraints_added_removed(true), m_d_max(0.0),
+      m_solver(solver_lu), m_solver_tol(1e-6), m_max_iterations(100), m_solver_iterations(0),
+      m_cdiag(m_exec_conf), m_crn(m_exec_conf), m_cqn(m_exec_conf), m_cidx(m_exec_conf),
+      m_caccum(m_exec_conf)
     {
     m_constraint_violated.resetFlags(0);
 
@@ -118,17 +121,40 @@ void ForceDistanceConstraint::computeForces(uint64_t timestep)
 
     // reallocate through amortized resizin
     unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
-    m_cmatrix.resize(n_constraint * n_constraint);
     m_cvec.resize(n_constraint);
 
-    // populate the terms in the matrix vector equation
-    fillMatrixVector(timestep);
+    if (m_solver == solver_iterative)
+        {
+        // the iterative solver never forms the dense matrix
+        m_cdiag.resize(n_constraint);
+        m_crn.resize(n_constraint);
+        m_cqn.resize(n_constraint);
+        m_cidx.resize(n_constraint);
+        m_caccum.resize(3 * (m_pdata->getN() + m_pdata->getNGhosts()));
+
+        // populate the diagonal and the right hand side
+        fillIterativeSystem(timestep);
+
+        // check violations
+        checkConstraints(timestep);
+
+        // solve the constraint equation
+        solveConstraintsIterative(timestep);
+        }
+    else
+        {
+        m_solver_iterations = 0;
+        m_cmatrix.resize(n_constraint * n_constraint);
+
+        // populate the terms in the matrix vector equation
+        fillMatrixVector(timestep);
 
-    // check violations
-    checkConstraints(timestep);
+        // check violations
+        checkConstraints(timestep);
 
-    // solve the matrix vector equation
-    solveConstraints(timestep);
+        // solve the matrix vector equation
+        solveConstraints(timestep);
+        }
 
     // compute forces
     computeConstraintForces(timestep);
@@ -423,6 +449,184 @@ void ForceDistanceConstraint::solveConstraints(uint64_t timestep)
     map_lagrange = m_sparse_solver.solve(map_vec);
     }
 
+/*! \param solver Name of the solver
+ */
+void ForceDistanceConstraint::setSolver(const std::string& solver)
+    {
+    if (solver == "lu")
+        {
+        m_solver = solver_lu;
+        }
+    else if (solver == "iterative")
+        {
+        m_solver = solver_iterative;
+        }
+    else
+        {
+        throw std::invalid_argument("Unknown constraint solver: " + solver);
+        }
+    }
+
+std::string ForceDistanceConstraint::getSolver()
+    {
+    return m_solver == solver_iterative ? "iterative" : "lu";
+    }
+
+/*! \param timestep Current time step
+
+    Computes the same right hand side as fillMatrixVector(), and instead of the full matrix only
+    the diagonal elements and the separation vectors that define the off-diagonal elements:
+
+        M_nm = 4 sum_{p in n and m} s_n(p) s_m(p) q_n . r_m / m_p
+
+    where s_n(p) is +1 (-1) when p is the first (second) particle of constraint n.
+*/
+void ForceDistanceConstraint::fillIterativeSystem(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_netforce(m_pdata->getNetForce(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::overwrite);
+    ArrayHandle<double> h_cdiag(m_cdiag, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_crn(m_crn, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_cqn(m_cqn, access_location::host, access_mode::overwrite);
+    ArrayHandle<uint2> h_cidx(m_cidx, access_location::host, access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    unsigned int max_local = m_pdata->getN() + m_pdata->getNGhosts();
+    for (unsigned int n = 0; n < n_constraint; ++n)
+        {
+        const ConstraintData::members_t constraint = m_cdata->getMembersByIndex(n);
+        unsigned int idx_a = h_rtag.data[constraint.tag[0]];
+        unsigned int idx_b = h_rtag.data[constraint.tag[1]];
+
+        if (idx_a >= max_local || idx_b >= max_local)
+            {
+            this->m_exec_conf->msg->error()
+                << "constrain.distance(): constraint " << constraint.tag[0] << " "
+                << constraint.tag[1] << " incomplete." << std::endl
+                << std::endl;
+            throw std::runtime_error("Error in constraint calculation");
+            }
+
+        vec3<Scalar> rn(box.minImage(vec3<Scalar>(h_pos.data[idx_a])
+                                     - vec3<Scalar>(h_pos.data[idx_b])));
+
+        vec3<Scalar> va(h_vel.data[idx_a]);
+        Scalar ma(h_vel.data[idx_a].w);
+        vec3<Scalar> vb(h_vel.data[idx_b]);
+        Scalar mb(h_vel.data[idx_b].w);
+
+        vec3<Scalar> qn(rn + (va - vb) * m_deltaT);
+
+        h_cidx.data[n] = make_uint2(idx_a, idx_b);
+        h_crn.data[n] = make_scalar4(rn.x, rn.y, rn.z, Scalar(1.0) / ma);
+        h_cqn.data[n] = make_scalar4(qn.x, qn.y, qn.z, Scalar(1.0) / mb);
+        h_cdiag.data[n] = double(4.0) * dot(qn, rn) * (double(1.0) / ma + double(1.0) / mb);
+
+        // get constraint distance
+        Scalar d = m_cdata->getValueByIndex(n);
+
+        // check distance violation
+        if (fast::sqrt(dot(rn, rn)) - d >= m_rel_tol * d || std::isnan(dot(rn, rn)))
+            {
+            m_constraint_violated.resetFlags(n + 1);
+            }
+
+        // fill vector component
+        h_cvec.data[n] = (dot(qn, qn) - d * d) / m_deltaT / m_deltaT;
+        h_cvec.data[n] += double(2.0)
+                          * dot(qn,
+                                vec3<Scalar>(h_netforce.data[idx_a]) / ma
+                                    - vec3<Scalar>(h_netforce.data[idx_b]) / mb);
+        }
+    }
+
+/*! \param timestep Current time step
+
+    Each Jacobi iteration first sums g_p = sum_{m containing p} s_m(p) lambda_m r_m for every
+    particle, so that (M lambda)_n = 4 q_n . (g_a / m_a - g_b / m_b), and then updates
+    lambda_n += (b_n - (M lambda)_n) / M_nn. The iterations stop when the largest update is smaller
+    than the solver tolerance times the largest multiplier.
+*/
+void ForceDistanceConstraint::solveConstraintsIterative(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+    m_solver_iterations = 0;
+
+    if (n_constraint == 0)
+        return;
+
+    // start from the solution of the previous step, the constraint forces change slowly
+    if (m_lagrange.size() != n_constraint)
+        {
+        m_lagrange.resize(n_constraint);
+        ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::overwrite);
+        memset(h_lagrange.data, 0, sizeof(double) * n_constraint);
+        }
+
+    ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::readwrite);
+    ArrayHandle<double> h_cvec(m_cvec, access_location::host, access_mode::read);
+    ArrayHandle<double> h_cdiag(m_cdiag, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_crn(m_crn, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_cqn(m_cqn, access_location::host, access_mode::read);
+    ArrayHandle<uint2> h_cidx(m_cidx, access_location::host, access_mode::read);
+    ArrayHandle<double> h_caccum(m_caccum, access_location::host, access_mode::overwrite);
+
+    while (m_solver_iterations < m_max_iterations)
+        {
+        m_solver_iterations++;
+
+        memset(h_caccum.data, 0, sizeof(double) * m_caccum.size());
+        for (unsigned int n = 0; n < n_constraint; ++n)
+            {
+            Scalar4 rn = h_crn.data[n];
+            uint2 idx = h_cidx.data[n];
+            double lambda = h_lagrange.data[n];
+
+            h_caccum.data[3 * idx.x + 0] += lambda * rn.x;
+            h_caccum.data[3 * idx.x + 1] += lambda * rn.y;
+            h_caccum.data[3 * idx.x + 2] += lambda * rn.z;
+            h_caccum.data[3 * idx.y + 0] -= lambda * rn.x;
+            h_caccum.data[3 * idx.y + 1] -= lambda * rn.y;
+            h_caccum.data[3 * idx.y + 2] -= lambda * rn.z;
+            }
+
+        double max_delta(0.0);
+        double max_lambda(0.0);
+        for (unsigned int n = 0; n < n_constraint; ++n)
+            {
+            Scalar4 rn = h_crn.data[n];
+            Scalar4 qn = h_cqn.data[n];
+            uint2 idx = h_cidx.data[n];
+
+            // the masses were stored as 1/m_a in rn.w and 1/m_b in qn.w
+            const double* ga = h_caccum.data + 3 * idx.x;
+            const double* gb = h_caccum.data + 3 * idx.y;
+            double m_lambda = double(4.0)
+                              * (qn.x * (ga[0] * rn.w - gb[0] * qn.w)
+                                 + qn.y * (ga[1] * rn.w - gb[1] * qn.w)
+                                 + qn.z * (ga[2] * rn.w - gb[2] * qn.w));
+
+            double delta = (h_cvec.data[n] - m_lambda) / h_cdiag.data[n];
+            h_lagrange.data[n] += delta;
+
+            max_delta = std::max(max_delta, std::fabs(delta));
+            max_lambda = std::max(max_lambda, std::fabs(h_lagrange.data[n]));
+            }
+
+        if (max_delta <= m_solver_tol * max_lambda)
+            break;
+        }
+    }
+
 void ForceDistanceConstraint::computeConstraintForces(uint64_t timestep)
     {
     ArrayHandle<double> h_lagrange(m_lagrange, access_location::host, access_mode::read);
@@ -658,7 +862,17 @@ void export_ForceDistanceConstraint(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
         .def_property("tolerance",
                       &ForceDistanceConstraint::getRelativeTolerance,
-                      &ForceDistanceConstraint::setRelativeTolerance);
+                      &ForceDistanceConstraint::setRelativeTolerance)
+        .def_property("solver",
+                      &ForceDistanceConstraint::getSolver,
+                      &ForceDistanceConstraint::setSolver)
+        .def_property("solver_tolerance",
+                      &ForceDistanceConstraint::getSolverTolerance,
+                      &ForceDistanceConstraint::setSolverTolerance)
+        .def_property("max_iterations",
+                      &ForceDistanceConstraint::getMaxIterations,
+                      &ForceDistanceConstraint::setMaxIterations)
+        .def_property_readonly("solver_iterations", &ForceDistanceConstraint::getSolverIterations);
     }
 
     } // end namespace detail
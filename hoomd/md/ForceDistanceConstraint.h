@@ -22,6 +22,8 @@
 #include <Eigen/Dense>
 #include <Eigen/SparseLU>
 
+#include <string>
+
 namespace hoomd
     {
 namespace md
@@ -34,6 +36,13 @@ namespace md
    Simulations,” J. Comput. Phys., vol. 172, no. 1, pp. 188–197, Sep. 2001.
 
     See Integrator for detailed documentation on constraint force implementation.
+
+    The default solver assembles the constraint matrix and factors it with a sparse LU
+    decomposition. The iterative solver never forms the matrix. Like the matrix expansion of
+    P-LINCS, it applies the matrix as a sum over the constraints of each particle and refines the
+    Lagrange multipliers with Jacobi iterations, starting from the solution of the previous step.
+    Its cost scales linearly with the number of constraints, but it converges slowly for strongly
+    coupled constraints such as rings of triangles.
     \ingroup computes
 */
 class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
@@ -63,6 +72,42 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
         return m_rel_tol;
         }
 
+    /// Set the constraint solver ("lu" or "iterative")
+    void setSolver(const std::string& solver);
+
+    /// Get the constraint solver
+    std::string getSolver();
+
+    /// Set the relative tolerance of the iterative solver
+    void setSolverTolerance(Scalar solver_tol)
+        {
+        m_solver_tol = solver_tol;
+        }
+
+    /// Get the relative tolerance of the iterative solver
+    Scalar getSolverTolerance()
+        {
+        return m_solver_tol;
+        }
+
+    /// Set the maximum number of iterations of the iterative solver
+    void setMaxIterations(unsigned int max_iterations)
+        {
+        m_max_iterations = max_iterations;
+        }
+
+    /// Get the maximum number of iterations of the iterative solver
+    unsigned int getMaxIterations()
+        {
+        return m_max_iterations;
+        }
+
+    /// Get the number of iterations in the last solve of the iterative solver
+    unsigned int getSolverIterations()
+        {
+        return m_solver_iterations;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
@@ -95,6 +140,24 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
 
     Scalar m_d_max; //!< Maximum constraint extension
 
+    //! Constraint solvers
+    enum solver_type
+        {
+        solver_lu = 0,   //!< Sparse LU decomposition of the constraint matrix
+        solver_iterative //!< Jacobi iterations with the matrix applied per particle
+        };
+
+    solver_type m_solver;             //!< The constraint solver
+    Scalar m_solver_tol;              //!< Relative tolerance of the iterative solver
+    unsigned int m_max_iterations;    //!< Maximum number of iterations of the iterative solver
+    unsigned int m_solver_iterations; //!< Number of iterations in the last iterative solve
+
+    GPUVector<double> m_cdiag;  //!< Diagonal of the constraint matrix
+    GPUVector<Scalar4> m_crn;   //!< Constraint separations (xyz) and 1/m_a (w)
+    GPUVector<Scalar4> m_cqn;   //!< Separations at t + deltaT (xyz) and 1/m_b (w)
+    GPUVector<uint2> m_cidx;    //!< Particle indices of the constraints
+    GPUVector<double> m_caccum; //!< Per-particle sum of the signed lambda * r_n (3 per particle)
+
     //! Compute the forces
     virtual void computeForces(uint64_t timestep);
 
@@ -110,6 +173,12 @@ class PYBIND11_EXPORT ForceDistanceConstraint : public MolecularForceCompute
     //! Solve the linear matrix-vector equation
     virtual void computeConstraintForces(uint64_t timestep);
 
+    //! Populate the diagonal and the right hand side for the iterative solver
+    virtual void fillIterativeSystem(uint64_t timestep);
+
+    //! Solve the constraint equation iteratively
+    virtual void solveConstraintsIterative(uint64_t timestep);
+
     //! Method called when constraint order changes
     virtual void slotConstraintReorder()
         {
@@ -19,7 +19,7 @@ namespace md
 /*! \param sysdef SystemDefinition containing the ParticleData to compute forces on
  */
 ForceDistanceConstraintGPU::ForceDistanceConstraintGPU(std::shared_ptr<SystemDefinition> sysdef)
-    : ForceDistanceConstraint(sysdef)
+    : ForceDistanceConstraint(sysdef), m_solver_max(2, m_exec_conf)
 #ifdef CUSOLVER_AVAILABLE
       ,
       m_cusolver_rf_initialized(false), m_nnz_L_tot(0), m_nnz_U_tot(0), m_csr_val_L(m_exec_conf),
@@ -34,7 +34,22 @@ ForceDistanceConstraintGPU::ForceDistanceConstraintGPU(std::shared_ptr<SystemDef
     m_tuner_force.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                          m_exec_conf,
                                          "dist_constraint_force"));
-    m_autotuners.insert(m_autotuners.end(), {m_tuner_fill, m_tuner_force});
+    m_tuner_fill_iterative.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                         m_exec_conf,
+                         "dist_constraint_fill_iterative"));
+    m_tuner_accumulate.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                              m_exec_conf,
+                                              "dist_constraint_accumulate"));
+    m_tuner_jacobi.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                          m_exec_conf,
+                                          "dist_constraint_jacobi"));
+    m_autotuners.insert(m_autotuners.end(),
+                        {m_tuner_fill,
+                         m_tuner_force,
+                         m_tuner_fill_iterative,
+                         m_tuner_accumulate,
+                         m_tuner_jacobi});
 
 #ifdef CUSOLVER_AVAILABLE
     // initialize cuSPARSE
@@ -768,6 +783,159 @@ void ForceDistanceConstraintGPU::computeConstraintForces(uint64_t timestep)
     m_tuner_force->end();
     }
 
+void ForceDistanceConstraintGPU::fillIterativeSystem(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+
+    ArrayHandle<double> d_cvec(m_cvec, access_location::device, access_mode::overwrite);
+    ArrayHandle<double> d_cdiag(m_cdiag, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_crn(m_crn, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_cqn(m_cqn, access_location::device, access_mode::overwrite);
+    ArrayHandle<uint2> d_cidx(m_cidx, access_location::device, access_mode::overwrite);
+
+    ArrayHandle<ConstraintData::members_t> d_members(m_cdata->getMembersArray(),
+                                                     access_location::device,
+                                                     access_mode::read);
+    ArrayHandle<typeval_t> d_group_typeval(m_cdata->getTypeValArray(),
+                                           access_location::device,
+                                           access_mode::read);
+
+    // access particle data
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<unsigned int> d_rtag(m_pdata->getRTags(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> d_netforce(m_pdata->getNetForce(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    m_tuner_fill_iterative->begin();
+    kernel::gpu_fill_iterative_system(n_constraint,
+                                      m_pdata->getN() + m_pdata->getNGhosts(),
+                                      d_cvec.data,
+                                      d_cdiag.data,
+                                      d_crn.data,
+                                      d_cqn.data,
+                                      d_cidx.data,
+                                      m_rel_tol,
+                                      m_constraint_violated.getDeviceFlags(),
+                                      d_pos.data,
+                                      d_vel.data,
+                                      d_netforce.data,
+                                      d_rtag.data,
+                                      d_members.data,
+                                      d_group_typeval.data,
+                                      m_deltaT,
+                                      m_pdata->getBox(),
+                                      m_tuner_fill_iterative->getParam()[0]);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    m_tuner_fill_iterative->end();
+    }
+
+/*! The matrix-vector product is split in a per-particle gather over the GPU constraint table and
+    a per-constraint Jacobi update, so neither kernel needs atomic additions. The host reads back
+    the largest update after each iteration to test for convergence.
+*/
+void ForceDistanceConstraintGPU::solveConstraintsIterative(uint64_t timestep)
+    {
+    unsigned int n_constraint = m_cdata->getN() + m_cdata->getNGhosts();
+    m_solver_iterations = 0;
+
+    if (n_constraint == 0)
+        return;
+
+    // start from the solution of the previous step, the constraint forces change slowly
+    if (m_lagrange.size() != n_constraint)
+        {
+        m_lagrange.resize(n_constraint);
+        ArrayHandle<double> d_lagrange(m_lagrange, access_location::device, access_mode::overwrite);
+        hipMemset(d_lagrange.data, 0, sizeof(double) * n_constraint);
+        }
+
+    unsigned int nptl = m_pdata->getN() + m_pdata->getNGhosts();
+
+    while (m_solver_iterations < m_max_iterations)
+        {
+        m_solver_iterations++;
+
+            {
+            ArrayHandle<double> d_lagrange(m_lagrange,
+                                           access_location::device,
+                                           access_mode::readwrite);
+            ArrayHandle<double> d_cvec(m_cvec, access_location::device, access_mode::read);
+            ArrayHandle<double> d_cdiag(m_cdiag, access_location::device, access_mode::read);
+            ArrayHandle<Scalar4> d_crn(m_crn, access_location::device, access_mode::read);
+            ArrayHandle<Scalar4> d_cqn(m_cqn, access_location::device, access_mode::read);
+            ArrayHandle<uint2> d_cidx(m_cidx, access_location::device, access_mode::read);
+            ArrayHandle<double> d_caccum(m_caccum,
+                                         access_location::device,
+                                         access_mode::overwrite);
+            ArrayHandle<unsigned int> d_solver_max(m_solver_max,
+                                                   access_location::device,
+                                                   access_mode::overwrite);
+
+            ArrayHandle<ConstraintData::members_t> d_gpu_clist(m_cdata->getGPUTable(),
+                                                               access_location::device,
+                                                               access_mode::read);
+            ArrayHandle<unsigned int> d_gpu_n_constraints(m_cdata->getNGroupsArray(),
+                                                          access_location::device,
+                                                          access_mode::read);
+            ArrayHandle<unsigned int> d_gpu_cpos(m_cdata->getGPUPosTable(),
+                                                 access_location::device,
+                                                 access_mode::read);
+
+            m_tuner_accumulate->begin();
+            kernel::gpu_accumulate_lagrange(nptl,
+                                            d_caccum.data,
+                                            d_lagrange.data,
+                                            d_crn.data,
+                                            d_gpu_clist.data,
+                                            m_cdata->getGPUTableIndexer(),
+                                            d_gpu_n_constraints.data,
+                                            d_gpu_cpos.data,
+                                            m_tuner_accumulate->getParam()[0]);
+
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+
+            m_tuner_accumulate->end();
+
+            m_tuner_jacobi->begin();
+            kernel::gpu_update_lagrange_jacobi(n_constraint,
+                                               d_lagrange.data,
+                                               d_cvec.data,
+                                               d_cdiag.data,
+                                               d_crn.data,
+                                               d_cqn.data,
+                                               d_cidx.data,
+                                               d_caccum.data,
+                                               d_solver_max.data,
+                                               m_tuner_jacobi->getParam()[0]);
+
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+
+            m_tuner_jacobi->end();
+            }
+
+        ArrayHandle<unsigned int> h_solver_max(m_solver_max,
+                                               access_location::host,
+                                               access_mode::read);
+        float max_delta, max_lambda;
+        memcpy(&max_delta, &h_solver_max.data[0], sizeof(float));
+        memcpy(&max_lambda, &h_solver_max.data[1], sizeof(float));
+
+        if (max_delta <= m_solver_tol * max_lambda)
+            break;
+        }
+    }
+
 namespace detail
     {
 void export_ForceDistanceConstraintGPU(pybind11::module& m)
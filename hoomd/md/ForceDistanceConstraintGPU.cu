@@ -423,6 +423,284 @@ hipError_t gpu_compute_constraint_forces(const Scalar4* d_pos,
     return hipSuccess;
     }
 
+//! Kernel to fill the diagonal and the right hand side for the iterative solver
+__global__ void gpu_fill_iterative_system_kernel(unsigned int n_constraint,
+                                                 unsigned int max_local,
+                                                 double* d_vec,
+                                                 double* d_diag,
+                                                 Scalar4* d_crn,
+                                                 Scalar4* d_cqn,
+                                                 uint2* d_cidx,
+                                                 Scalar rel_tol,
+                                                 unsigned int* d_constraint_violated,
+                                                 const Scalar4* d_pos,
+                                                 const Scalar4* d_vel,
+                                                 const Scalar4* d_netforce,
+                                                 const unsigned int* d_rtag,
+                                                 const group_storage<2>* d_members,
+                                                 const typeval_union* d_group_typeval,
+                                                 Scalar deltaT,
+                                                 const BoxDim box)
+    {
+    unsigned int n = blockDim.x * blockIdx.x + threadIdx.x;
+
+    if (n >= n_constraint)
+        return;
+
+    group_storage<2> constraint = d_members[n];
+    unsigned int idx_na = d_rtag[constraint.tag[0]];
+    unsigned int idx_nb = d_rtag[constraint.tag[1]];
+
+    if (idx_na >= max_local || idx_nb >= max_local)
+        {
+        // an incomplete constraint does not contribute
+        d_vec[n] = 0.0;
+        d_diag[n] = 1.0;
+        d_crn[n] = make_scalar4(0.0, 0.0, 0.0, 0.0);
+        d_cqn[n] = make_scalar4(0.0, 0.0, 0.0, 0.0);
+        d_cidx[n] = make_uint2(0, 0);
+        return;
+        }
+
+    // constraint separation
+    vec3<Scalar> rn(box.minImage(vec3<Scalar>(d_pos[idx_na]) - vec3<Scalar>(d_pos[idx_nb])));
+
+    // get masses
+    Scalar ma = d_vel[idx_na].w;
+    Scalar mb = d_vel[idx_nb].w;
+
+    // constraint separation at t+2*deltaT
+    vec3<Scalar> qn(rn + deltaT * (vec3<Scalar>(d_vel[idx_na]) - vec3<Scalar>(d_vel[idx_nb])));
+
+    d_cidx[n] = make_uint2(idx_na, idx_nb);
+    d_crn[n] = make_scalar4(rn.x, rn.y, rn.z, Scalar(1.0) / ma);
+    d_cqn[n] = make_scalar4(qn.x, qn.y, qn.z, Scalar(1.0) / mb);
+    d_diag[n] = double(4.0) * dot(qn, rn) * (double(1.0) / ma + double(1.0) / mb);
+
+    // the constraint distance
+    Scalar d = d_group_typeval[n].val;
+
+    if (fast::sqrt(dot(rn, rn)) - d >= rel_tol * d || isnan(dot(rn, rn)))
+        {
+        *d_constraint_violated = n + 1;
+        }
+
+    d_vec[n] = (dot(qn, qn) - d * d) / deltaT / deltaT
+               + double(2.0)
+                     * dot(qn,
+                           vec3<Scalar>(d_netforce[idx_na]) / ma
+                               - vec3<Scalar>(d_netforce[idx_nb]) / mb);
+    }
+
+hipError_t gpu_fill_iterative_system(unsigned int n_constraint,
+                                     unsigned int max_local,
+                                     double* d_vec,
+                                     double* d_diag,
+                                     Scalar4* d_crn,
+                                     Scalar4* d_cqn,
+                                     uint2* d_cidx,
+                                     Scalar rel_tol,
+                                     unsigned int* d_constraint_violated,
+                                     const Scalar4* d_pos,
+                                     const Scalar4* d_vel,
+                                     const Scalar4* d_netforce,
+                                     const unsigned int* d_rtag,
+                                     const group_storage<2>* d_members,
+                                     const typeval_union* d_group_typeval,
+                                     Scalar deltaT,
+                                     const BoxDim box,
+                                     unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_fill_iterative_system_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // run configuration
+    unsigned int run_block_size = min(block_size, max_block_size);
+    unsigned int n_blocks = n_constraint / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_fill_iterative_system_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       n_constraint,
+                       max_local,
+                       d_vec,
+                       d_diag,
+                       d_crn,
+                       d_cqn,
+                       d_cidx,
+                       rel_tol,
+                       d_constraint_violated,
+                       d_pos,
+                       d_vel,
+                       d_netforce,
+                       d_rtag,
+                       d_members,
+                       d_group_typeval,
+                       deltaT,
+                       box);
+
+    return hipSuccess;
+    }
+
+//! Kernel to sum the signed lambda_m r_m over the constraints of each particle
+__global__ void gpu_accumulate_lagrange_kernel(unsigned int nptl,
+                                               double* d_accum,
+                                               const double* d_lagrange,
+                                               const Scalar4* d_crn,
+                                               const group_storage<2>* d_gpu_clist,
+                                               const Index2D gpu_clist_indexer,
+                                               const unsigned int* d_gpu_n_constraints,
+                                               const unsigned int* d_gpu_cpos)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= nptl)
+        return;
+
+    unsigned int n_constraint_ptl = d_gpu_n_constraints[idx];
+
+    double gx(0.0);
+    double gy(0.0);
+    double gz(0.0);
+
+    for (unsigned int cidx = 0; cidx < n_constraint_ptl; cidx++)
+        {
+        unsigned int m = d_gpu_clist[gpu_clist_indexer(idx, cidx)].idx[1];
+
+        // the first particle of the constraint adds, the second subtracts
+        double lambda = d_lagrange[m];
+        if (d_gpu_cpos[gpu_clist_indexer(idx, cidx)] != 0)
+            lambda = -lambda;
+
+        Scalar4 rm = d_crn[m];
+        gx += lambda * rm.x;
+        gy += lambda * rm.y;
+        gz += lambda * rm.z;
+        }
+
+    d_accum[3 * idx + 0] = gx;
+    d_accum[3 * idx + 1] = gy;
+    d_accum[3 * idx + 2] = gz;
+    }
+
+hipError_t gpu_accumulate_lagrange(unsigned int nptl,
+                                   double* d_accum,
+                                   const double* d_lagrange,
+                                   const Scalar4* d_crn,
+                                   const group_storage<2>* d_gpu_clist,
+                                   const Index2D& gpu_clist_indexer,
+                                   const unsigned int* d_gpu_n_constraints,
+                                   const unsigned int* d_gpu_cpos,
+                                   unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_accumulate_lagrange_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // run configuration
+    unsigned int run_block_size = min(block_size, max_block_size);
+    unsigned int n_blocks = nptl / run_block_size + 1;
+
+    hipLaunchKernelGGL((gpu_accumulate_lagrange_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       nptl,
+                       d_accum,
+                       d_lagrange,
+                       d_crn,
+                       d_gpu_clist,
+                       gpu_clist_indexer,
+                       d_gpu_n_constraints,
+                       d_gpu_cpos);
+
+    return hipSuccess;
+    }
+
+//! Kernel to perform one Jacobi update of the Lagrange multipliers
+/*! d_max[0] and d_max[1] receive the largest |update| and the largest |lambda| as the bit patterns
+    of non-negative floats, which order like unsigned integers.
+*/
+__global__ void gpu_update_lagrange_jacobi_kernel(unsigned int n_constraint,
+                                                  double* d_lagrange,
+                                                  const double* d_vec,
+                                                  const double* d_diag,
+                                                  const Scalar4* d_crn,
+                                                  const Scalar4* d_cqn,
+                                                  const uint2* d_cidx,
+                                                  const double* d_accum,
+                                                  unsigned int* d_max)
+    {
+    unsigned int n = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (n >= n_constraint)
+        return;
+
+    Scalar4 rn = d_crn[n];
+    Scalar4 qn = d_cqn[n];
+    uint2 idx = d_cidx[n];
+
+    // the masses are stored as 1/m_a in rn.w and 1/m_b in qn.w
+    const double* ga = d_accum + 3 * idx.x;
+    const double* gb = d_accum + 3 * idx.y;
+    double m_lambda = double(4.0)
+                      * (qn.x * (ga[0] * rn.w - gb[0] * qn.w) + qn.y * (ga[1] * rn.w - gb[1] * qn.w)
+                         + qn.z * (ga[2] * rn.w - gb[2] * qn.w));
+
+    double delta = (d_vec[n] - m_lambda) / d_diag[n];
+    double lambda = d_lagrange[n] + delta;
+    d_lagrange[n] = lambda;
+
+    atomicMax(&d_max[0], __float_as_uint(float(fabs(delta))));
+    atomicMax(&d_max[1], __float_as_uint(float(fabs(lambda))));
+    }
+
+hipError_t gpu_update_lagrange_jacobi(unsigned int n_constraint,
+                                      double* d_lagrange,
+                                      const double* d_vec,
+                                      const double* d_diag,
+                                      const Scalar4* d_crn,
+                                      const Scalar4* d_cqn,
+                                      const uint2* d_cidx,
+                                      const double* d_accum,
+                                      unsigned int* d_max,
+                                      unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_update_lagrange_jacobi_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    // run configuration
+    unsigned int run_block_size = min(block_size, max_block_size);
+    unsigned int n_blocks = n_constraint / run_block_size + 1;
+
+    hipMemsetAsync(d_max, 0, sizeof(unsigned int) * 2);
+
+    hipLaunchKernelGGL((gpu_update_lagrange_jacobi_kernel),
+                       dim3(n_blocks),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       n_constraint,
+                       d_lagrange,
+                       d_vec,
+                       d_diag,
+                       d_crn,
+                       d_cqn,
+                       d_cidx,
+                       d_accum,
+                       d_max);
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
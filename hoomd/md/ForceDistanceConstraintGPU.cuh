@@ -72,6 +72,46 @@ hipError_t gpu_compute_constraint_forces(const Scalar4* d_pos,
                                          unsigned int nptl_local,
                                          unsigned int block_size,
                                          double* d_lagrange);
+
+hipError_t gpu_fill_iterative_system(unsigned int n_constraint,
+                                     unsigned int max_local,
+                                     double* d_vec,
+                                     double* d_diag,
+                                     Scalar4* d_crn,
+                                     Scalar4* d_cqn,
+                                     uint2* d_cidx,
+                                     Scalar rel_tol,
+                                     unsigned int* d_constraint_violated,
+                                     const Scalar4* d_pos,
+                                     const Scalar4* d_vel,
+                                     const Scalar4* d_netforce,
+                                     const unsigned int* d_rtag,
+                                     const group_storage<2>* d_members,
+                                     const typeval_union* d_group_typeval,
+                                     Scalar deltaT,
+                                     const BoxDim box,
+                                     unsigned int block_size);
+
+hipError_t gpu_accumulate_lagrange(unsigned int nptl,
+                                   double* d_accum,
+                                   const double* d_lagrange,
+                                   const Scalar4* d_crn,
+                                   const group_storage<2>* d_gpu_clist,
+                                   const Index2D& gpu_clist_indexer,
+                                   const unsigned int* d_gpu_n_constraints,
+                                   const unsigned int* d_gpu_cpos,
+                                   unsigned int block_size);
+
+hipError_t gpu_update_lagrange_jacobi(unsigned int n_constraint,
+                                      double* d_lagrange,
+                                      const double* d_vec,
+                                      const double* d_diag,
+                                      const Scalar4* d_crn,
+                                      const Scalar4* d_cqn,
+                                      const uint2* d_cidx,
+                                      const double* d_accum,
+                                      unsigned int* d_max,
+                                      unsigned int block_size);
 #endif
 
     } // end namespace kernel
@@ -53,6 +53,11 @@ class ForceDistanceConstraintGPU : public ForceDistanceConstraint
     protected:
     std::shared_ptr<Autotuner<1>> m_tuner_fill;  //!< Autotuner for filling the constraint matrix
     std::shared_ptr<Autotuner<1>> m_tuner_force; //!< Autotuner for populating the force array
+    std::shared_ptr<Autotuner<1>> m_tuner_fill_iterative; //!< Autotuner for the iterative system
+    std::shared_ptr<Autotuner<1>> m_tuner_accumulate;     //!< Autotuner for the per-particle sums
+    std::shared_ptr<Autotuner<1>> m_tuner_jacobi;         //!< Autotuner for the Jacobi update
+
+    GPUArray<unsigned int> m_solver_max; //!< Largest update and multiplier of the last iteration
 
 #ifdef CUSOLVER_AVAILABLE
     cusparseHandle_t m_cusparse_handle;        //!< cuSPARSE handle
@@ -107,6 +112,12 @@ class ForceDistanceConstraintGPU : public ForceDistanceConstraint
 
     //! Compute the constraint forces using the Lagrange multipliers
     virtual void computeConstraintForces(uint64_t timestep);
+
+    //! Populate the diagonal and the right hand side for the iterative solver
+    virtual void fillIterativeSystem(uint64_t timestep);
+
+    //! Solve the constraint equation iteratively
+    virtual void solveConstraintsIterative(uint64_t timestep);
     };
 
     } // end namespace md
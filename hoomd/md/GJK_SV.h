@@ -33,16 +33,23 @@ HOSTDEVICE inline vec3<Scalar> rotate(const Scalar (&mat)[3][3], const vec3<Scal
 HOSTDEVICE inline void support_polyhedron(const ManagedArray<vec3<Scalar>>& verts,
                                           const vec3<Scalar>& vector,
                                           const Scalar (&mat)[3][3],
-                                          const vec3<Scalar> shift,
                                           unsigned int& idx)
     {
-    // Compute the support function of the polyhedron.
+    // Compute the support function of the polyhedron. The vertex that maximizes
+    // dot(mat * vert + shift, vector) also maximizes dot(vert, mat^T * vector) for any shift, so
+    // rotate the search direction into the body frame once instead of rotating every vertex.
+    const vec3<Scalar> body_vector(mat[0][0] * vector.x + mat[1][0] * vector.y
+                                       + mat[2][0] * vector.z,
+                                   mat[0][1] * vector.x + mat[1][1] * vector.y
+                                       + mat[2][1] * vector.z,
+                                   mat[0][2] * vector.x + mat[1][2] * vector.y
+                                       + mat[2][2] * vector.z);
     unsigned int index = 0;
 
-    Scalar max_dist_sq = dot((rotate(mat, verts[index]) + shift), vector);
+    Scalar max_dist_sq = dot(verts[index], body_vector);
     for (unsigned int i = 1; i < verts.size(); ++i)
         {
-        Scalar dist_sq = dot((rotate(mat, verts[i]) + shift), vector);
+        Scalar dist_sq = dot(verts[i], body_vector);
 
         if (dist_sq > max_dist_sq)
             {
@@ -680,8 +687,8 @@ HOSTDEVICE inline void gjk(const ManagedArray<vec3<Scalar>>& verts1,
         // support_{A-B}(-v) = support(A, -v) - support(B, v)
         vec3<Scalar> ellipsoid_support1, ellipsoid_support2;
         unsigned int i1, i2;
-        support_polyhedron(verts1, -v, mati, vec3<Scalar>(0, 0, 0), i1);
-        support_polyhedron(verts2, v, matj, Scalar(-1.0) * dr, i2);
+        support_polyhedron(verts1, -v, mati, i1);
+        support_polyhedron(verts2, v, matj, i2);
         if (has_rounding1)
             {
             support_ellipsoid(rounding_radii1, -v, qi, ellipsoid_support1);
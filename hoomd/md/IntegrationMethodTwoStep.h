@@ -7,6 +7,10 @@
 
 #include <memory>
 
+#ifdef ENABLE_HIP
+#include "hoomd/Integrator.cuh"
+#endif
+
 #ifndef __INTEGRATION_METHOD_TWO_STEP_H__
 #define __INTEGRATION_METHOD_TWO_STEP_H__
 
@@ -114,6 +118,26 @@ class PYBIND11_EXPORT IntegrationMethodTwoStep : public Autotuned
      */
     virtual void integrateStepTwo(uint64_t timestep) { }
 
+#ifdef ENABLE_HIP
+    //! Sum the net force and perform the second step of the integration in one pass
+    /*! \param timestep Current time step
+        \param net_force_sum Net force arrays and the forces to sum
+
+        \returns false when the method cannot sum the net force. The caller then sums the net
+        force and calls integrateStepTwo().
+
+        IntegratorTwoStep calls this instead of integrateStepTwo() when the method is the only one
+        and nothing else reads the net force before the second step. Methods that implement it
+        must write the net force of every local particle, so they can only do so when their group
+        contains all local particles.
+    */
+    virtual bool integrateStepTwoSumNetForce(uint64_t timestep,
+                                             const hoomd::kernel::gpu_net_force_sum& net_force_sum)
+        {
+        return false;
+        }
+#endif
+
     //! Calculates force which keeps paricles on manifold in RATTLE integrators
     /*! \param timestep Current time step
      */
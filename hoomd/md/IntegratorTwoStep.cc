@@ -76,6 +76,11 @@ void IntegratorTwoStep::update(uint64_t timestep)
         // a) that particles have migrated to the correct domains
         // b) that forces are calculated correctly, if ghost atom positions are updated every time
         // step
+        // computeNetForce() completes the ghost update, which allows force computes to work on
+        // the local particles while the ghost positions are in flight. Rigid bodies need the
+        // complete ghosts to place their constituents.
+        if (!m_rigid_bodies)
+            m_comm->deferFinishUpdateGhosts();
         m_comm->communicate(timestep + 1);
 
         // Communicator uses a compute callback to trigger updateRigidBodies again and ensure that
@@ -92,7 +97,14 @@ void IntegratorTwoStep::update(uint64_t timestep)
     // compute the net force on all particles
 #ifdef ENABLE_HIP
     if (m_exec_conf->isCUDAEnabled())
+        {
+        // a single method may sum the net force in its second step kernel when nothing reads the
+        // net force in between
+        m_fuse_step_two = m_methods.size() == 1 && !m_half_step_hook;
+        m_step_two_fused = false;
         computeNetForceGPU(timestep + 1);
+        m_fuse_step_two = false;
+        }
     else
 #endif
         computeNetForce(timestep + 1);
@@ -108,7 +120,10 @@ void IntegratorTwoStep::update(uint64_t timestep)
     for (auto method_ptr = m_methods.rbegin(); method_ptr != m_methods.rend(); method_ptr++)
         {
         auto method = *method_ptr;
-        method->integrateStepTwo(timestep);
+#ifdef ENABLE_HIP
+        if (!m_step_two_fused)
+#endif
+            method->integrateStepTwo(timestep);
         method->includeRATTLEForce(timestep + 1);
         }
 
@@ -207,6 +222,19 @@ Scalar IntegratorTwoStep::getRotationalDOF(std::shared_ptr<ParticleGroup> group)
     return res;
     }
 
+/*! The degrees of freedom each method grants to a group depend on the members of the method's
+    group.
+*/
+std::vector<std::shared_ptr<ParticleGroup>> IntegratorTwoStep::getDOFGroups()
+    {
+    std::vector<std::shared_ptr<ParticleGroup>> groups;
+    for (auto& method : m_methods)
+        {
+        groups.push_back(method->getGroup());
+        }
+    return groups;
+    }
+
 /*!  \param integrate_rotational_dofs true to integrate orientations, false to not
  */
 void IntegratorTwoStep::setIntegrateRotationalDOF(bool integrate_rotational_dof)
@@ -302,6 +330,11 @@ void IntegratorTwoStep::updateRigidBodies(uint64_t timestep)
     // update the composite particle positions of any rigid bodies
     if (m_rigid_bodies)
         {
+#ifdef ENABLE_MPI
+        // the constituents of ghost bodies are placed from the ghost positions
+        if (m_comm)
+            m_comm->finishUpdateGhosts(timestep);
+#endif
         m_rigid_bodies->updateCompositeParticles(timestep);
         }
     }
@@ -356,6 +389,23 @@ void IntegratorTwoStep::computeNetForceGPU(uint64_t timestep)
         m_constraint_forces.pop_back();
         }
     }
+
+/** \param timestep Time step of the forces
+    \param net_force_sum Net force arrays and the forces to sum
+
+    update() sets m_fuse_step_two when the only integration method may take its second step
+    while it sums the net force. The forces are evaluated at the end of the step, so the method
+    integrates step \a timestep - 1.
+*/
+bool IntegratorTwoStep::sumNetForceFusedGPU(uint64_t timestep,
+                                            const hoomd::kernel::gpu_net_force_sum& net_force_sum)
+    {
+    if (!m_fuse_step_two)
+        return false;
+
+    m_step_two_fused = m_methods[0]->integrateStepTwoSumNetForce(timestep - 1, net_force_sum);
+    return m_step_two_fused;
+    }
 #endif
 
 #ifdef ENABLE_MPI
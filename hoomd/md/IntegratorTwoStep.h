@@ -62,6 +62,9 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
     /// Get the number of degrees of freedom granted to a given group
     virtual Scalar getRotationalDOF(std::shared_ptr<ParticleGroup> group);
 
+    /// Get the groups of the integration methods
+    virtual std::vector<std::shared_ptr<ParticleGroup>> getDOFGroups();
+
     /// Set the integrate orientation flag
     virtual void setIntegrateRotationalDOF(bool integrate_rotational_dofs);
 
@@ -80,6 +83,10 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 #ifdef ENABLE_HIP
     /// helper function to compute net force/virial on the GPU
     virtual void computeNetForceGPU(uint64_t timestep);
+
+    /// Sum the net force in the second step of the integration method
+    virtual bool sumNetForceFusedGPU(uint64_t timestep,
+                                     const hoomd::kernel::gpu_net_force_sum& net_force_sum);
 #endif
 
 #ifdef ENABLE_MPI
@@ -123,6 +130,14 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 
     /// True when orientation degrees of freedom should be integrated
     bool m_integrate_rotational_dof = false;
+
+#ifdef ENABLE_HIP
+    /// True while the net force may be summed in the second step
+    bool m_fuse_step_two = false;
+
+    /// True when the method performed the second step while summing the net force
+    bool m_step_two_fused = false;
+#endif
     };
 
     } // end namespace md
@@ -0,0 +1,413 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "LBFGSEnergyMinimizer.h"
+
+using namespace std;
+
+/*! \file LBFGSEnergyMinimizer.cc
+    \brief Contains code for the LBFGSEnergyMinimizer class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef SystemDefinition this method will act on. Must not be NULL.
+    \param max_displacement maximum distance a particle moves in one iteration
+    \param memory number of steps kept to estimate the inverse Hessian
+
+    \post The method is constructed with the given particle data.
+*/
+LBFGSEnergyMinimizer::LBFGSEnergyMinimizer(std::shared_ptr<SystemDefinition> sysdef,
+                                           Scalar max_displacement,
+                                           unsigned int memory)
+    : IntegratorTwoStep(sysdef, Scalar(0.0)), m_max_displacement(Scalar(0.1)), m_memory(5),
+      m_ftol(Scalar(1e-1)), m_etol(Scalar(1e-3)), m_energy_total(Scalar(0.0)),
+      m_old_energy(Scalar(0.0)), m_run_minsteps(10), m_n_pairs(0), m_newest(0),
+      m_gamma(Scalar(1.0))
+    {
+    m_exec_conf->msg->notice(5) << "Constructing LBFGSEnergyMinimizer" << endl;
+
+    // sanity check
+    assert(m_sysdef);
+    assert(m_pdata);
+
+    setMaxDisplacement(max_displacement);
+    setMemory(memory);
+
+    // the history is stored by local particle index
+    m_pdata->getParticleSortSignal()
+        .connect<LBFGSEnergyMinimizer, &LBFGSEnergyMinimizer::resetHistory>(this);
+
+    reset();
+    }
+
+LBFGSEnergyMinimizer::~LBFGSEnergyMinimizer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying LBFGSEnergyMinimizer" << endl;
+    m_pdata->getParticleSortSignal()
+        .disconnect<LBFGSEnergyMinimizer, &LBFGSEnergyMinimizer::resetHistory>(this);
+    }
+
+/*! \param max_displacement is the new maximum displacement to set
+ */
+void LBFGSEnergyMinimizer::setMaxDisplacement(Scalar max_displacement)
+    {
+    if (!(max_displacement > 0.0))
+        {
+        throw runtime_error("max_displacement must be positive.");
+        }
+    m_max_displacement = max_displacement;
+    }
+
+/*! \param memory is the new number of steps to keep
+ */
+void LBFGSEnergyMinimizer::setMemory(unsigned int memory)
+    {
+    if (memory == 0)
+        {
+        throw runtime_error("memory must be positive.");
+        }
+    m_memory = memory;
+    m_s.resize(size_t(m_memory) * m_members.size());
+    m_y.resize(size_t(m_memory) * m_members.size());
+    m_rho.resize(m_memory);
+    m_alpha.resize(m_memory);
+    m_n_pairs = 0;
+    m_newest = 0;
+    }
+
+void LBFGSEnergyMinimizer::reset()
+    {
+    m_converged = false;
+    m_n_since_start = 0;
+    m_was_reset = true;
+    m_energy_total = 0.0;
+    resetHistory();
+    }
+
+/*! \param timestep Current time step
+ */
+void LBFGSEnergyMinimizer::prepRun(uint64_t timestep)
+    {
+    if (m_rigid_bodies)
+        {
+        throw runtime_error("LBFGS does not support rigid bodies.");
+        }
+    IntegratorTwoStep::prepRun(timestep);
+    }
+
+void LBFGSEnergyMinimizer::updateMembers()
+    {
+    m_members.clear();
+    for (auto& method : m_methods)
+        {
+        std::shared_ptr<ParticleGroup> current_group = method->getGroup();
+        unsigned int group_size = current_group->getNumMembers();
+        for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+            {
+            m_members.push_back(current_group->getMemberIndex(group_idx));
+            }
+        }
+
+    if (m_members.size() != m_force.size())
+        {
+        const size_t n = m_members.size();
+        m_force.resize(n);
+        m_dir.resize(n);
+        m_old_force.resize(n);
+        m_step.resize(n);
+        m_s.resize(size_t(m_memory) * n);
+        m_y.resize(size_t(m_memory) * n);
+        resetHistory();
+        }
+    }
+
+/*! \param value Value on this rank
+    \returns The sum of \a value over all ranks
+*/
+Scalar LBFGSEnergyMinimizer::allReduceSum(Scalar value)
+    {
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &value,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return value;
+    }
+
+/*! \param a First vector, one element per member
+    \param b Second vector, one element per member
+*/
+Scalar LBFGSEnergyMinimizer::dot(const vec3<Scalar>* a, const vec3<Scalar>* b)
+    {
+    Scalar result(0.0);
+    for (size_t i = 0; i < m_members.size(); i++)
+        {
+        result += hoomd::dot(a[i], b[i]);
+        }
+    return allReduceSum(result);
+    }
+
+/*! Evaluate the two loop recursion (Nocedal, Math. Comp. 35, 773 (1980)) with the gradient
+    g = -F and the initial inverse Hessian gamma I.
+*/
+void LBFGSEnergyMinimizer::computeDirection()
+    {
+    const size_t n = m_members.size();
+
+    // without history, take a steepest descent step
+    if (m_n_pairs == 0)
+        {
+        m_dir = m_force;
+        return;
+        }
+
+    // start from F = -g, which flips the sign of q, alpha, r, and beta so that the recursion ends
+    // with the search direction -H g
+    m_dir = m_force;
+    for (unsigned int k = 0; k < m_n_pairs; k++)
+        {
+        const unsigned int pair = (m_newest + m_memory - k) % m_memory;
+        const vec3<Scalar>* s = m_s.data() + size_t(pair) * n;
+        const vec3<Scalar>* y = m_y.data() + size_t(pair) * n;
+        m_alpha[pair] = m_rho[pair] * dot(s, m_dir.data());
+        for (size_t i = 0; i < n; i++)
+            {
+            m_dir[i] -= m_alpha[pair] * y[i];
+            }
+        }
+
+    for (size_t i = 0; i < n; i++)
+        {
+        m_dir[i] *= m_gamma;
+        }
+
+    for (unsigned int k = m_n_pairs; k > 0; k--)
+        {
+        const unsigned int pair = (m_newest + m_memory - (k - 1)) % m_memory;
+        const vec3<Scalar>* s = m_s.data() + size_t(pair) * n;
+        const vec3<Scalar>* y = m_y.data() + size_t(pair) * n;
+        const Scalar beta = m_rho[pair] * dot(y, m_dir.data());
+        for (size_t i = 0; i < n; i++)
+            {
+            m_dir[i] += (m_alpha[pair] - beta) * s[i];
+            }
+        }
+    }
+
+/*! \param displacement Displacement of each member
+    \param factor Scale factor applied to the displacements
+*/
+void LBFGSEnergyMinimizer::displace(const std::vector<vec3<Scalar>>& displacement, Scalar factor)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::readwrite);
+
+    const BoxDim& box = m_pdata->getBox();
+    for (size_t i = 0; i < m_members.size(); i++)
+        {
+        const unsigned int j = m_members[i];
+        h_pos.data[j].x += factor * displacement[i].x;
+        h_pos.data[j].y += factor * displacement[i].y;
+        h_pos.data[j].z += factor * displacement[i].z;
+        box.wrap(h_pos.data[j], h_image.data[j]);
+        }
+    }
+
+/*! \param timestep Current time step
+ */
+void LBFGSEnergyMinimizer::computeForces(uint64_t timestep)
+    {
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        // migrate particles and update the ghosts at the new positions
+        m_comm->communicate(timestep + 1);
+        }
+#endif
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        computeNetForceGPU(timestep + 1);
+    else
+#endif
+        computeNetForce(timestep + 1);
+    }
+
+/*! \param timestep is the current timestep
+ */
+void LBFGSEnergyMinimizer::update(uint64_t timestep)
+    {
+    Integrator::update(timestep);
+    if (m_converged)
+        return;
+
+    updateMembers();
+    const size_t n = m_members.size();
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
+
+    // the net force holds the force and energy at the positions set by the last iteration
+    Scalar pe_total(0.0);
+        {
+        ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (size_t i = 0; i < n; i++)
+            {
+            const Scalar4 net_force = h_net_force.data[m_members[i]];
+            m_force[i] = vec3<Scalar>(net_force.x, net_force.y, is_2d ? Scalar(0.0) : net_force.z);
+            pe_total += net_force.w;
+            }
+        }
+
+    pe_total = allReduceSum(pe_total);
+    const Scalar total_group_size = allReduceSum(Scalar(n));
+    m_energy_total = pe_total;
+    const Scalar energy = pe_total / total_group_size;
+
+    if (m_was_reset)
+        {
+        m_was_reset = false;
+        m_old_energy = energy + Scalar(100000) * m_etol;
+        }
+
+    if (m_have_step)
+        {
+        if (energy > m_old_energy)
+            {
+            // backtrack to the midpoint of the last step, the history no longer describes the
+            // local curvature
+            m_exec_conf->msg->notice(6) << "LBFGS backtrack" << std::endl;
+            for (size_t i = 0; i < n; i++)
+                {
+                m_step[i] *= Scalar(0.5);
+                }
+            displace(m_step, Scalar(-1.0));
+            m_n_pairs = 0;
+            m_n_since_start++;
+            computeForces(timestep);
+            return;
+            }
+
+        // the displacement and change in the gradient over the accepted step
+        const unsigned int pair = (m_newest + 1) % m_memory;
+        vec3<Scalar>* s = m_s.data() + size_t(pair) * n;
+        vec3<Scalar>* y = m_y.data() + size_t(pair) * n;
+        for (size_t i = 0; i < n; i++)
+            {
+            s[i] = m_step[i];
+            y[i] = m_old_force[i] - m_force[i];
+            }
+
+        const Scalar sy = dot(s, y);
+        const Scalar yy = dot(y, y);
+        if (sy > Scalar(0.0) && yy > Scalar(0.0))
+            {
+            m_newest = pair;
+            m_rho[pair] = Scalar(1.0) / sy;
+            m_gamma = sy / yy;
+            m_n_pairs = std::min(m_n_pairs + 1, m_memory);
+            }
+        else
+            {
+            // negative curvature along the step, restart from steepest descent
+            m_n_pairs = 0;
+            }
+        }
+
+    const Scalar fnorm = sqrt(dot(m_force.data(), m_force.data()));
+    const Scalar ndof = total_group_size * Scalar(m_sysdef->getNDimensions());
+    if ((fnorm / sqrt(ndof) < m_ftol && fabs(energy - m_old_energy) < m_etol)
+        && m_n_since_start >= m_run_minsteps)
+        {
+        m_converged = true;
+        return;
+        }
+
+    computeDirection();
+
+    // fall back to steepest descent when the direction is not downhill
+    if (!(dot(m_force.data(), m_dir.data()) > Scalar(0.0)))
+        {
+        m_exec_conf->msg->notice(6) << "LBFGS steepest descent restart" << std::endl;
+        m_dir = m_force;
+        m_n_pairs = 0;
+        }
+
+    // limit the largest displacement of any particle
+    Scalar max_dir_sq(0.0);
+    for (size_t i = 0; i < n; i++)
+        {
+        max_dir_sq = std::max(max_dir_sq, hoomd::dot(m_dir[i], m_dir[i]));
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_dir_sq,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    Scalar factor(1.0);
+    const Scalar max_dir = sqrt(max_dir_sq);
+    if (max_dir > m_max_displacement)
+        {
+        factor = m_max_displacement / max_dir;
+        }
+
+    for (size_t i = 0; i < n; i++)
+        {
+        m_step[i] = factor * m_dir[i];
+        }
+    displace(m_step, Scalar(1.0));
+
+    m_old_force = m_force;
+    m_old_energy = energy;
+    m_have_step = true;
+    m_n_since_start++;
+
+    computeForces(timestep);
+    }
+
+namespace detail
+    {
+void export_LBFGSEnergyMinimizer(pybind11::module& m)
+    {
+    pybind11::class_<LBFGSEnergyMinimizer,
+                     IntegratorTwoStep,
+                     std::shared_ptr<LBFGSEnergyMinimizer>>(m, "LBFGSEnergyMinimizer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar, unsigned int>())
+        .def("reset", &LBFGSEnergyMinimizer::reset)
+        .def_property_readonly("converged", &LBFGSEnergyMinimizer::hasConverged)
+        .def_property_readonly("energy", &LBFGSEnergyMinimizer::getEnergy)
+        .def_property("max_displacement",
+                      &LBFGSEnergyMinimizer::getMaxDisplacement,
+                      &LBFGSEnergyMinimizer::setMaxDisplacement)
+        .def_property("memory", &LBFGSEnergyMinimizer::getMemory, &LBFGSEnergyMinimizer::setMemory)
+        .def_property("force_tol", &LBFGSEnergyMinimizer::getFtol, &LBFGSEnergyMinimizer::setFtol)
+        .def_property("energy_tol",
+                      &LBFGSEnergyMinimizer::getEtol,
+                      &LBFGSEnergyMinimizer::setEtol)
+        .def_property("min_steps_conv",
+                      &LBFGSEnergyMinimizer::getMinSteps,
+                      &LBFGSEnergyMinimizer::setMinSteps);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
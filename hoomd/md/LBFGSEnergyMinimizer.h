@@ -0,0 +1,199 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "IntegratorTwoStep.h"
+#include "hoomd/VectorMath.h"
+
+#include <memory>
+#include <vector>
+
+#ifndef __LBFGS_ENERGY_MINIMIZER_H__
+#define __LBFGS_ENERGY_MINIMIZER_H__
+
+/*! \file LBFGSEnergyMinimizer.h
+    \brief Declares the L-BFGS energy minimizer class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Finds the nearest basin in the potential energy landscape with L-BFGS
+/*! \b Overview
+
+    LBFGSEnergyMinimizer moves the particles in the groups of its integration methods along the
+    limited memory BFGS direction -H g, where g is the gradient of the potential energy (minus the
+    net force) and H the inverse Hessian estimated from the last \a memory steps and changes in the
+    gradient. The methods only select the particles, their integrateStep functions are not called.
+
+    Each call to update() evaluates the forces once, like FIREEnergyMinimizer. Instead of a line
+    search, the step is limited so that no particle moves more than the maximum displacement. When
+    the energy increases over a step, the minimizer backtracks to the midpoint of the step and
+    discards the history. Backtracking repeats until the energy no longer increases, so successive
+    iterations perform a bisection line search along the last direction.
+
+    The history is stored per local particle index. It is discarded when the particles are sorted
+    or migrate to other ranks, after which the minimizer restarts with a steepest descent step.
+
+    The minimizer runs on the host. On the GPU, each iteration copies the net force and positions
+    of all particles to the host.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT LBFGSEnergyMinimizer : public IntegratorTwoStep
+    {
+    public:
+    //! Constructs the minimizer and associates it with the system
+    LBFGSEnergyMinimizer(std::shared_ptr<SystemDefinition> sysdef,
+                         Scalar max_displacement,
+                         unsigned int memory);
+    virtual ~LBFGSEnergyMinimizer();
+
+    //! Reset the minimization
+    virtual void reset();
+
+    //! Prepare for the run
+    virtual void prepRun(uint64_t timestep);
+
+    //! Perform one minimization iteration
+    virtual void update(uint64_t timestep);
+
+    //! Return whether or not the minimization has converged
+    bool hasConverged() const
+        {
+        return m_converged;
+        }
+
+    //! Return the potential energy of the particles in the groups after the last iteration
+    Scalar getEnergy() const
+        {
+        return m_energy_total;
+        }
+
+    //! Set the maximum distance a particle may move in one iteration
+    void setMaxDisplacement(Scalar max_displacement);
+
+    //! Get the maximum distance a particle may move in one iteration
+    Scalar getMaxDisplacement()
+        {
+        return m_max_displacement;
+        }
+
+    //! Set the number of steps kept to estimate the inverse Hessian
+    void setMemory(unsigned int memory);
+
+    //! Get the number of steps kept to estimate the inverse Hessian
+    unsigned int getMemory()
+        {
+        return m_memory;
+        }
+
+    //! Set the stopping criterion based on the total force on all particles in the system
+    /*! \param ftol is the new force tolerance to set
+     */
+    void setFtol(Scalar ftol)
+        {
+        m_ftol = ftol;
+        }
+
+    //! Get the stopping criterion based on the total force on all particles in the system
+    Scalar getFtol()
+        {
+        return m_ftol;
+        }
+
+    //! Set the stopping criterion based on the change in energy between successive iterations
+    /*! \param etol is the new energy tolerance to set
+     */
+    void setEtol(Scalar etol)
+        {
+        m_etol = etol;
+        }
+
+    //! Get the stopping criterion based on the change in energy between successive iterations
+    Scalar getEtol()
+        {
+        return m_etol;
+        }
+
+    //! Set the a minimum number of steps before the other stopping criteria will be evaluated
+    /*! \param steps is the minimum number of steps (attempts) that will be made
+     */
+    void setMinSteps(unsigned int steps)
+        {
+        m_run_minsteps = steps;
+        }
+
+    //! Get the minimum number of steps before the other stopping criteria will be evaluated
+    unsigned int getMinSteps()
+        {
+        return m_run_minsteps;
+        }
+
+    protected:
+    Scalar m_max_displacement;    //!< maximum distance a particle moves in one iteration
+    unsigned int m_memory;        //!< number of steps kept to estimate the inverse Hessian
+    Scalar m_ftol;                //!< stopping tolerance based on total force
+    Scalar m_etol;                //!< stopping tolerance based on the change in energy
+    Scalar m_energy_total;        //!< total energy of all integrator groups
+    Scalar m_old_energy;          //!< energy per particle at the last accepted configuration
+    bool m_converged;             //!< whether the minimization has converged
+    unsigned int m_run_minsteps;  //!< a minimum number of search attempts the search will use
+    unsigned int m_n_since_start; //!< counts the number of search attempts
+    bool m_was_reset;             //!< whether or not the minimizer was reset
+
+    std::vector<unsigned int> m_members; //!< local indices of the particles in the groups
+    std::vector<vec3<Scalar>> m_force;   //!< net force on the members
+    std::vector<vec3<Scalar>> m_dir;     //!< search direction of the members
+
+    //! Net force on the members at the last accepted configuration
+    std::vector<vec3<Scalar>> m_old_force;
+
+    //! Displacement of the members applied by the last iteration
+    std::vector<vec3<Scalar>> m_step;
+
+    std::vector<vec3<Scalar>> m_s; //!< history of displacements, by pair and member
+    std::vector<vec3<Scalar>> m_y; //!< history of gradient changes, by pair and member
+    std::vector<Scalar> m_rho;     //!< 1 / (s . y) for each pair in the history
+    std::vector<Scalar> m_alpha;   //!< scratch space for the two loop recursion
+    unsigned int m_n_pairs;        //!< number of pairs in the history
+    unsigned int m_newest;         //!< index of the newest pair in the history
+    Scalar m_gamma;                //!< scale of the initial inverse Hessian
+    bool m_have_step;              //!< whether m_step and m_old_force are valid
+
+    //! Discard the per-particle history
+    void resetHistory()
+        {
+        m_n_pairs = 0;
+        m_have_step = false;
+        }
+
+    //! Collect the local indices of the particles in the groups
+    void updateMembers();
+
+    //! Sum a value over all ranks
+    Scalar allReduceSum(Scalar value);
+
+    //! Dot product of two per-member vectors, summed over all ranks
+    Scalar dot(const vec3<Scalar>* a, const vec3<Scalar>* b);
+
+    //! Compute the L-BFGS direction -H g into m_dir
+    void computeDirection();
+
+    //! Displace the members by \a displacement, scaled by \a factor
+    void displace(const std::vector<vec3<Scalar>>& displacement, Scalar factor);
+
+    //! Communicate the new positions and evaluate the forces
+    void computeForces(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // #ifndef __LBFGS_ENERGY_MINIMIZER_H__
@@ -16,6 +16,37 @@ namespace md
 const unsigned int INVALID_TAG = UINT_MAX;
 const Scalar INVALID_VEL = FLT_MAX; // should be ok, even for double.
 
+#ifdef ENABLE_MPI
+//! Combine the min and max particles (momentum, mass, tag) found by two ranks
+/*! Ties in the momentum go to the lower tag, so every rank agrees on the result.
+ */
+static void reduce_min_max_velocity(void* in, void* inout, int* len, MPI_Datatype*)
+    {
+    const Scalar* a = static_cast<const Scalar*>(in);
+    Scalar* b = static_cast<Scalar*>(inout);
+    for (int i = 0; i < *len; i++, a += 6, b += 6)
+        {
+        const unsigned int a_min_tag = __scalar_as_int(a[2]);
+        const unsigned int b_min_tag = __scalar_as_int(b[2]);
+        if (a[0] < b[0] || (a[0] == b[0] && a_min_tag < b_min_tag))
+            {
+            b[0] = a[0];
+            b[1] = a[1];
+            b[2] = a[2];
+            }
+
+        const unsigned int a_max_tag = __scalar_as_int(a[5]);
+        const unsigned int b_max_tag = __scalar_as_int(b[5]);
+        if (a[3] > b[3] || (a[3] == b[3] && a_max_tag < b_max_tag))
+            {
+            b[3] = a[3];
+            b[4] = a[4];
+            b[5] = a[5];
+            }
+        }
+    }
+#endif // ENABLE_MPI
+
 MuellerPlatheFlow::MuellerPlatheFlow(std::shared_ptr<SystemDefinition> sysdef,
                                      std::shared_ptr<Trigger> trigger,
                                      std::shared_ptr<ParticleGroup> group,
@@ -54,9 +85,14 @@ MuellerPlatheFlow::MuellerPlatheFlow(std::shared_ptr<SystemDefinition> sysdef,
     m_last_min_vel.z = __int_as_scalar(INVALID_TAG);
 
     m_exec_conf->msg->notice(5) << "Constructing MuellerPlatheFlow " << endl;
+
+#ifdef ENABLE_MPI
+    MPI_Type_contiguous(6, MPI_HOOMD_SCALAR, &m_mpi_min_max_type);
+    MPI_Type_commit(&m_mpi_min_max_type);
+    MPI_Op_create(&reduce_min_max_velocity, 1, &m_mpi_min_max_op);
+#endif // ENABLE_MPI
+
     this->updateDomainDecomposition();
-    // m_exec_conf->msg->notice(0)<<m_exec_conf->getRank()<<": "<< m_max_swap.gbl_rank<<"
-    // "<<m_min_swap.gbl_rank<<endl;
 
     // Check min max slab.
     this->setMinSlab(m_min_slab);
@@ -68,6 +104,11 @@ MuellerPlatheFlow::~MuellerPlatheFlow(void)
     m_exec_conf->msg->notice(5) << "Destroying MuellerPlatheFlow " << endl;
     m_pdata->getBoxChangeSignal()
         .disconnect<MuellerPlatheFlow, &MuellerPlatheFlow::forceOrthorhombicBoxCheck>(this);
+
+#ifdef ENABLE_MPI
+    MPI_Op_free(&m_mpi_min_max_op);
+    MPI_Type_free(&m_mpi_min_max_type);
+#endif // ENABLE_MPI
     }
 
 void MuellerPlatheFlow::update(uint64_t timestep)
@@ -163,9 +204,6 @@ void MuellerPlatheFlow::swapMinMaxSlab(void)
 
     std::swap(m_has_max_slab, m_has_min_slab);
 
-#ifdef ENABLE_MPI
-    std::swap(m_max_swap, m_min_swap);
-#endif // ENABLE_MPI
     m_exec_conf->msg->notice(4) << "MuellerPlatheUpdater swapped min/max slab: "
                                 << this->getMinSlab() << " " << this->getMaxSlab() << endl;
     }
@@ -230,13 +268,6 @@ void MuellerPlatheFlow::updateDomainDecomposition(void)
         m_has_max_slab = false;
         if (my_pos == this->getMaxSlab() / (m_N_slabs / my_grid))
             m_has_max_slab = true;
-
-        // Create the communicator.
-        const int min_color = this->hasMinSlab() ? 0 : MPI_UNDEFINED;
-        initMPISwap(&m_min_swap, min_color);
-
-        const int max_color = this->hasMaxSlab() ? 0 : MPI_UNDEFINED;
-        initMPISwap(&m_max_swap, max_color);
         }
 #endif // ENABLE_MPI
     }
@@ -302,7 +333,7 @@ void MuellerPlatheFlow::searchMinMaxVelocity(void)
                 if (index == this->getMinSlab() && m_last_min_vel.x > vel && this->hasMinSlab())
                     {
                     m_last_min_vel.x = vel;
-                    m_last_max_vel.y = mass;
+                    m_last_min_vel.y = mass;
                     m_last_min_vel.z = __int_as_scalar(h_tag.data[j]);
                     }
                 }
@@ -377,88 +408,26 @@ void MuellerPlatheFlow::verifyOrthorhombicBox(void)
     }
 #ifdef ENABLE_MPI
 
-// Not performance optimized: could be slow. It is meant for init.
-void MuellerPlatheFlow::initMPISwap(struct MPI_SWAP* ms, const int color)
-    {
-    if (ms->initialized && ms->rank != MPI_UNDEFINED)
-        MPI_Comm_free(&(ms->comm));
-
-    MPI_Comm_split(m_exec_conf->getMPICommunicator(), color, m_exec_conf->getRank(), &(ms->comm));
-    if (color != MPI_UNDEFINED)
-        {
-        MPI_Comm_rank(ms->comm, &(ms->rank));
-        MPI_Comm_size(ms->comm, &(ms->size));
-        }
-    else
-        {
-        ms->rank = MPI_UNDEFINED;
-        ms->size = MPI_UNDEFINED;
-        }
-    int send = 0;
-    if (ms->rank == 0)
-        {
-        send = 1;
-        }
-    vector<int> recv;
-    all_gather_v(send, recv, m_exec_conf->getMPICommunicator());
-
-    // ARG_MAX;
-    ms->gbl_rank = -1;
-    for (unsigned int i = 0; i < recv.size(); i++)
-        {
-        if (recv[i] == 1)
-            {
-            assert(ms->gbl_rank == -1);
-            ms->gbl_rank = i;
-            }
-        }
-    assert(ms->gbl_rank > -1);
-    ms->initialized = true;
-    }
-
-void MuellerPlatheFlow::bcastVelToAll(struct MPI_SWAP* ms, Scalar3* vel, const MPI_Op op)
-    {
-    if (ms->rank != MPI_UNDEFINED)
-        {
-        Scalar_Int tmp;
-        tmp.s = vel->x;
-        tmp.i = ms->rank;
-        MPI_Allreduce(MPI_IN_PLACE, &tmp, 1, MPI_HOOMD_SCALAR_INT, op, ms->comm);
-        // Send to subset local rank
-        if (tmp.i != 0)
-            {
-            if (ms->rank == 0)
-                {
-                recv(vel->x, tmp.i, ms->comm);
-                recv(vel->y, tmp.i, ms->comm);
-                recv(vel->z, tmp.i, ms->comm);
-                }
-            if (ms->rank == tmp.i)
-                {
-                send(vel->x, 0, ms->comm);
-                send(vel->y, 0, ms->comm);
-                send(vel->z, 0, ms->comm);
-                }
-            }
-        // ms->rank == 0 has the definite answer
-        }
-    // Broadcast the result to every rank.
-    // This way, each rank can check, whether
-    // it needs to update and can determine the exchanged momentum.
-    bcast(vel->x, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    bcast(vel->y, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    bcast(vel->z, ms->gbl_rank, m_exec_conf->getMPICommunicator());
-    }
-
 void MuellerPlatheFlow::mpiExchangeVelocity(void)
     {
-#ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
-        bcastVelToAll(&m_min_swap, &m_last_min_vel, MPI_MINLOC);
-        bcastVelToAll(&m_max_swap, &m_last_max_vel, MPI_MAXLOC);
+        // ranks without the slabs contribute the invalid initial values
+        Scalar min_max[6] = {m_last_min_vel.x,
+                             m_last_min_vel.y,
+                             m_last_min_vel.z,
+                             m_last_max_vel.x,
+                             m_last_max_vel.y,
+                             m_last_max_vel.z};
+        MPI_Allreduce(MPI_IN_PLACE,
+                      min_max,
+                      1,
+                      m_mpi_min_max_type,
+                      m_mpi_min_max_op,
+                      m_exec_conf->getMPICommunicator());
+        m_last_min_vel = make_scalar3(min_max[0], min_max[1], min_max[2]);
+        m_last_max_vel = make_scalar3(min_max[3], min_max[4], min_max[5]);
         }
-#endif // ENABLE_MPI
     }
 
 #endif // ENABLE_MPI
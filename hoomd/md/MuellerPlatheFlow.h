@@ -207,23 +207,11 @@ class PYBIND11_EXPORT MuellerPlatheFlow : public Updater
     //! Returns if box is orthorhombic, but throws a runtime_error, if the box is not orthorhombic.
     void verifyOrthorhombicBox(void);
 #ifdef ENABLE_MPI
-    struct MPI_SWAP
-        {
-        MPI_Comm comm;
-        int rank;
-        int size;
-        int gbl_rank;     //!< global rank of zero in the comm.
-        bool initialized; //!< initialized struct, manually set.
-        MPI_SWAP()
-            : comm(MPI_COMM_NULL), rank(MPI_UNDEFINED), size(MPI_UNDEFINED),
-              gbl_rank(MPI_UNDEFINED), initialized(false)
-            {
-            }
-        };
-    struct MPI_SWAP m_min_swap;
-    struct MPI_SWAP m_max_swap;
-    void initMPISwap(struct MPI_SWAP* ms, const int color);
-    void bcastVelToAll(struct MPI_SWAP* ms, Scalar3* vel, const MPI_Op op);
+    //! Six Scalars: momentum, mass and tag of the min followed by those of the max particle
+    MPI_Datatype m_mpi_min_max_type;
+    //! Reduction that keeps the min particle of the first and the max particle of the second half
+    MPI_Op m_mpi_min_max_op;
+    //! Find the global min and max particles with a single reduction over all ranks
     void mpiExchangeVelocity(void);
 #endif // ENABLE_MPI
     };
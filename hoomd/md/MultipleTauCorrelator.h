@@ -0,0 +1,213 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file MultipleTauCorrelator.h
+    \brief Declares a multiple-tau correlator for time correlation functions
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Computes time correlation functions on the fly with the multiple-tau algorithm
+/** The correlator keeps a hierarchy of shift registers with \a points entries each. Level 0 holds
+    the last \a points samples. Each higher level receives the average of \a averaging consecutive
+    values of the level below, so level l spans lags up to points * averaging^l samples. Memory
+    and work per sample grow with the number of levels, i.e. with log(T) of the longest lag T.
+
+    Every sample holds one value per channel, and the correlation at each lag averages over the
+    channels and time origins. In product mode, the correlation is < a(t) a(t + tau) >. In
+    squared_difference mode it is < (a(t + tau) - a(t))^2 >, e.g. the mean squared displacement
+    in one direction when the channels are unwrapped coordinates.
+
+    See J. Ramirez, S. K. Sukumaran, B. Vorselaars, and A. E. Likhtman. 2010. "Efficient on the fly
+    calculation of time correlation functions in computer simulations." J. Chem. Phys. 133, 154103.
+*/
+class MultipleTauCorrelator
+    {
+    public:
+    /// Correlation to compute
+    enum mode
+        {
+        product,           //!< < a(t) a(t + tau) >
+        squared_difference //!< < (a(t + tau) - a(t))^2 >
+        };
+
+    /// Constructor
+    /*! \param channels Number of values in each sample
+        \param points Number of entries in each shift register
+        \param averaging Number of values averaged into one value of the next level
+        \param levels Number of levels
+        \param correlation_mode Correlation to compute
+    */
+    MultipleTauCorrelator(unsigned int channels,
+                          unsigned int points,
+                          unsigned int averaging,
+                          unsigned int levels,
+                          mode correlation_mode)
+        : m_channels(channels), m_points(points), m_averaging(averaging), m_levels(levels),
+          m_mode(correlation_mode)
+        {
+        m_shift.resize(size_t(m_levels) * m_points * m_channels);
+        m_accumulator.resize(size_t(m_levels) * m_channels);
+        m_scratch.resize(size_t(m_levels) * m_channels);
+        m_head.resize(m_levels);
+        m_n_shift.resize(m_levels);
+        m_n_accumulated.resize(m_levels);
+        m_correlation.resize(size_t(m_levels) * m_points);
+        m_n_correlation.resize(size_t(m_levels) * m_points);
+        reset();
+        }
+
+    /// Discard all samples
+    void reset()
+        {
+        std::fill(m_shift.begin(), m_shift.end(), 0.0);
+        std::fill(m_accumulator.begin(), m_accumulator.end(), 0.0);
+        std::fill(m_head.begin(), m_head.end(), 0);
+        std::fill(m_n_shift.begin(), m_n_shift.end(), 0);
+        std::fill(m_n_accumulated.begin(), m_n_accumulated.end(), 0);
+        std::fill(m_correlation.begin(), m_correlation.end(), 0.0);
+        std::fill(m_n_correlation.begin(), m_n_correlation.end(), 0);
+        }
+
+    /// Add a sample
+    /*! \param values One value per channel
+     */
+    void add(const double* values)
+        {
+        add(0, values);
+        }
+
+    /// Get the number of channels
+    unsigned int getNumChannels() const
+        {
+        return m_channels;
+        }
+
+    /// Get the lags of the correlation, in samples
+    std::vector<uint64_t> getLags() const
+        {
+        std::vector<uint64_t> lags;
+        uint64_t stride = 1;
+        for (unsigned int level = 0; level < m_levels; level++)
+            {
+            for (unsigned int j = firstLag(level); j < m_points; j++)
+                {
+                lags.push_back(j * stride);
+                }
+            stride *= m_averaging;
+            }
+        return lags;
+        }
+
+    /// Get the correlation at each lag in getLags(), NaN at lags without samples
+    std::vector<double> getCorrelation() const
+        {
+        std::vector<double> correlation;
+        for (unsigned int level = 0; level < m_levels; level++)
+            {
+            for (unsigned int j = firstLag(level); j < m_points; j++)
+                {
+                const size_t k = size_t(level) * m_points + j;
+                if (m_n_correlation[k] > 0)
+                    {
+                    correlation.push_back(m_correlation[k]
+                                          / (double(m_n_correlation[k]) * m_channels));
+                    }
+                else
+                    {
+                    correlation.push_back(std::numeric_limits<double>::quiet_NaN());
+                    }
+                }
+            }
+        return correlation;
+        }
+
+    private:
+    unsigned int m_channels;  //!< Number of values in each sample
+    unsigned int m_points;    //!< Number of entries in each shift register
+    unsigned int m_averaging; //!< Number of values averaged into one value of the next level
+    unsigned int m_levels;    //!< Number of levels
+    mode m_mode;              //!< Correlation to compute
+
+    std::vector<double> m_shift;               //!< Shift registers by level, entry, and channel
+    std::vector<double> m_accumulator;         //!< Running sums for the next level
+    std::vector<double> m_scratch;             //!< Averages passed to the next level
+    std::vector<unsigned int> m_head;          //!< Entry holding the newest value of each level
+    std::vector<unsigned int> m_n_shift;       //!< Number of filled entries of each level
+    std::vector<unsigned int> m_n_accumulated; //!< Number of values in each accumulator
+    std::vector<double> m_correlation;         //!< Sums of the correlation, by level and lag
+    std::vector<uint64_t> m_n_correlation;     //!< Number of time origins in each sum
+
+    /// Smallest lag index of a level that is not already covered by the level below
+    unsigned int firstLag(unsigned int level) const
+        {
+        return level == 0 ? 0 : m_points / m_averaging;
+        }
+
+    /// Add a value to a level and correlate it with the values held there
+    void add(unsigned int level, const double* values)
+        {
+        if (level >= m_levels)
+            return;
+
+        const unsigned int head = (m_head[level] + 1) % m_points;
+        m_head[level] = head;
+        m_n_shift[level] = std::min(m_n_shift[level] + 1, m_points);
+
+        double* shift = m_shift.data() + size_t(level) * m_points * m_channels;
+        double* newest = shift + size_t(head) * m_channels;
+        std::copy(values, values + m_channels, newest);
+
+        for (unsigned int j = firstLag(level); j < m_n_shift[level]; j++)
+            {
+            const double* origin = shift + size_t((head + m_points - j) % m_points) * m_channels;
+            double sum = 0.0;
+            if (m_mode == product)
+                {
+                for (unsigned int c = 0; c < m_channels; c++)
+                    sum += newest[c] * origin[c];
+                }
+            else
+                {
+                for (unsigned int c = 0; c < m_channels; c++)
+                    {
+                    const double delta = newest[c] - origin[c];
+                    sum += delta * delta;
+                    }
+                }
+
+            const size_t k = size_t(level) * m_points + j;
+            m_correlation[k] += sum;
+            m_n_correlation[k]++;
+            }
+
+        // pass the block average on to the next level
+        double* accumulator = m_accumulator.data() + size_t(level) * m_channels;
+        for (unsigned int c = 0; c < m_channels; c++)
+            accumulator[c] += values[c];
+
+        if (++m_n_accumulated[level] == m_averaging)
+            {
+            double* average = m_scratch.data() + size_t(level) * m_channels;
+            for (unsigned int c = 0; c < m_channels; c++)
+                {
+                average[c] = accumulator[c] / m_averaging;
+                accumulator[c] = 0.0;
+                }
+            m_n_accumulated[level] = 0;
+            add(level + 1, average);
+            }
+        }
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
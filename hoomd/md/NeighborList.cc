@@ -8,6 +8,7 @@
 #include "NeighborList.h"
 #include "hoomd/BondedGroupData.h"
 
+#include <algorithm>
 #include <iostream>
 #include <stdexcept>
 
@@ -33,7 +34,7 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
     : Compute(sysdef), m_typpair_idx(m_pdata->getNTypes()), m_rcut_max_max(0.0), m_rcut_min(0.0),
       m_r_buff(r_buff), m_filter_body(false), m_storage_mode(half), m_meshbond_data(NULL),
       m_rcut_changed(true), m_updates(0), m_forced_updates(0), m_dangerous_updates(0),
-      m_force_update(true), m_dist_check(true), m_has_been_updated_once(false)
+      m_force_update(true), m_compact_requested(false), m_dist_check(true), m_has_been_updated_once(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing Neighborlist" << endl;
 
@@ -55,6 +56,7 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
     // initialize box length at last update
     m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
     m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
+    m_last_box = m_pdata->getGlobalBox();
 
     // allocate r_cut pairwise storage
     GlobalArray<Scalar> r_cut(m_typpair_idx.getNumElements(), m_exec_conf);
@@ -106,6 +108,22 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
         }
 #endif
 
+    // per type pair buffers default to the global buffer
+    GlobalArray<Scalar> r_buff_pair(m_typpair_idx.getNumElements(), m_exec_conf);
+    m_r_buff_pair.swap(r_buff_pair);
+    TAG_ALLOCATION(m_r_buff_pair);
+        {
+        ArrayHandle<Scalar> h_r_buff_pair(m_r_buff_pair,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        std::fill(h_r_buff_pair.data, h_r_buff_pair.data + m_r_buff_pair.getNumElements(), -1.0);
+        }
+
+    // holds the minimum buffer on a per type basis
+    GlobalArray<Scalar> r_buff_min(m_pdata->getNTypes(), m_exec_conf);
+    m_r_buff_min.swap(r_buff_min);
+    TAG_ALLOCATION(m_r_buff_min);
+
     // allocate the r_listsq array which accelerates CPU calculations
     GlobalArray<Scalar> r_listsq(m_typpair_idx.getNumElements(), m_exec_conf);
     m_r_listsq.swap(r_listsq);
@@ -379,6 +397,8 @@ void NeighborList::compute(uint64_t timestep)
     if (!shouldCompute(timestep) && !m_force_update)
         return;
 
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+
     // when the number of particles or bonds in the system changes, rebuild the exclusion list
     if (m_n_particles_changed || m_topology_changed)
         {
@@ -403,37 +423,86 @@ void NeighborList::compute(uint64_t timestep)
         }
 
     // check if the list needs to be updated and update it
+    bool forced = m_force_update;
     if (needsUpdating(timestep))
         {
-        // check simulation box size is OK
-        checkBoxSize();
+#ifdef ENABLE_MPI
+        // building the list reads the ghost positions
+        if (m_comm)
+            m_comm->finishUpdateGhosts(timestep);
+#endif
 
-        // rebuild the list until there is no overflow
-        bool overflowed = false;
-        do
+        if (!forced && updateNlistPartial())
+            {
+            m_n_partial_since_full++;
+            m_partial_updates++;
+            }
+        else
             {
-            buildNlist(timestep);
+            // check simulation box size is OK
+            checkBoxSize();
 
-            overflowed = checkConditions();
-            // if we overflowed, need to reallocate memory and reset the conditions
-            if (overflowed)
+            // rebuild the list until there is no overflow
+            bool overflowed = false;
+            do
                 {
-                // always rebuild the head list after an overflow
-                buildHeadList();
+                if (hasClusterPairs())
+                    allocateClusterPairs();
 
-                // zero out the conditions for the next build
-                resetConditions();
+                buildNlist(timestep);
+
+                overflowed = checkConditions();
+                // if we overflowed, need to reallocate memory and reset the conditions
+                if (overflowed)
+                    {
+                    // always rebuild the head list after an overflow
+                    buildHeadList();
+
+                    // zero out the conditions for the next build
+                    resetConditions();
+                    }
+                } while (overflowed);
+
+            if (m_exclusions_set && !buildFiltersExclusions())
+                {
+                filterNlist();
+                m_cluster_pairs_built = false;
                 }
-            } while (overflowed);
 
-        if (m_exclusions_set)
-            filterNlist();
+            setLastUpdatedPos();
+            m_n_partial_since_full = 0;
+            }
 
-        setLastUpdatedPos();
+        // lists that do not build the cluster pairs in their traversal derive them afterwards
+        if (hasClusterPairs() && !m_cluster_pairs_built)
+            buildClusterPairs();
+        m_cluster_pairs_built = false;
+
+        m_pair_list_valid = false;
         m_has_been_updated_once = true;
         }
     }
 
+/*! \param typ1 First type index in the pair
+    \param typ2 Second type index in the pair
+    \param r_buff Buffer radius to set, or a negative value to use the global buffer
+    \note Buffers larger than the global buffer radius are limited to the global buffer radius.
+*/
+void NeighborList::setRBuffPair(unsigned int typ1, unsigned int typ2, Scalar r_buff)
+    {
+    validateTypes(typ1, typ2, "setting the pair buffer");
+        {
+        ArrayHandle<Scalar> h_r_buff_pair(m_r_buff_pair,
+                                          access_location::host,
+                                          access_mode::readwrite);
+        h_r_buff_pair.data[m_typpair_idx(typ1, typ2)] = r_buff;
+        h_r_buff_pair.data[m_typpair_idx(typ2, typ1)] = r_buff;
+        }
+
+    notifyRCutMatrixChange();
+    forceUpdate();
+    }
+
 /*! \param r_buff New buffer radius to set
     \note Changing the buffer radius does NOT immediately update the neighborlist.
             The new buffer will take effect when compute is called for the next timestep.
@@ -489,12 +558,14 @@ void NeighborList::updateRList()
 
     // update the maximum cutoff of all those set so far
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_r_buff_min(m_r_buff_min, access_location::host, access_mode::overwrite);
 
     Scalar r_cut_max = 0.0f;
     for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
         {
-        // get the maximum cutoff for this type
+        // get the maximum cutoff and minimum buffer for this type
         Scalar r_cut_max_i = 0.0f;
+        Scalar r_buff_min_i = m_r_buff;
         for (unsigned int j = 0; j < m_pdata->getNTypes(); ++j)
             {
             const Scalar r_cut_ij = h_r_cut.data[m_typpair_idx(i, j)];
@@ -502,10 +573,14 @@ void NeighborList::updateRList()
                 r_cut_max_i = r_cut_ij;
 
             // precompute rlistsq while we're at it
-            Scalar r_list = (r_cut_ij > Scalar(0.0)) ? r_cut_ij + m_r_buff : Scalar(0.0);
+            const Scalar r_buff_ij = getRBuffPair(i, j);
+            Scalar r_list = (r_cut_ij > Scalar(0.0)) ? r_cut_ij + r_buff_ij : Scalar(0.0);
             h_r_listsq.data[m_typpair_idx(i, j)] = r_list * r_list;
+            if (r_cut_ij > Scalar(0.0) && r_buff_ij < r_buff_min_i)
+                r_buff_min_i = r_buff_ij;
             }
         h_rcut_max.data[i] = r_cut_max_i;
+        h_r_buff_min.data[i] = r_buff_min_i;
         if (r_cut_max_i > r_cut_max)
             r_cut_max = r_cut_max_i;
         }
@@ -560,6 +635,120 @@ void NeighborList::checkBoxSize()
         }
     }
 
+/*! \param type_level Set to the level of each type, or no_cell_level for types without neighbors
+    \returns The cell width of each level
+
+    The size of a type is its neighbor list radius with itself, or its largest neighbor list radius
+    when it does not interact with itself. Sorted by size, the types are grouped into levels so that
+    the sizes in a level differ by at most a factor of 2, and each level nominally uses cells as
+    wide as its smallest type. A single cell list sized for the smallest type would need a number
+    of cells that grows with the cube of the size ratio regardless of how few small particles there
+    are. To bound the memory, the width of a level is increased so that it has no more cells than
+    local particles.
+*/
+std::vector<Scalar> NeighborList::computeCellLevels(std::vector<unsigned int>& type_level)
+    {
+    // make sure r_list is current
+    getMaxRCut();
+
+    const unsigned int ntypes = m_pdata->getNTypes();
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    std::vector<Scalar> type_size(ntypes, Scalar(0.0));
+    std::vector<unsigned int> sorted_types;
+    for (unsigned int i = 0; i < ntypes; ++i)
+        {
+        if (h_r_cut.data[m_typpair_idx(i, i)] > Scalar(0.0))
+            {
+            type_size[i] = slow::sqrt(h_r_listsq.data[m_typpair_idx(i, i)]);
+            }
+        else
+            {
+            for (unsigned int j = 0; j < ntypes; ++j)
+                {
+                if (h_r_cut.data[m_typpair_idx(i, j)] > Scalar(0.0))
+                    {
+                    type_size[i]
+                        = std::max(type_size[i], slow::sqrt(h_r_listsq.data[m_typpair_idx(i, j)]));
+                    }
+                }
+            }
+
+        if (type_size[i] > Scalar(0.0))
+            sorted_types.push_back(i);
+        }
+
+    std::stable_sort(sorted_types.begin(),
+                     sorted_types.end(),
+                     [&type_size](unsigned int a, unsigned int b)
+                     { return type_size[a] < type_size[b]; });
+
+    type_level.assign(ntypes, no_cell_level);
+    std::vector<Scalar> level_width;
+    for (unsigned int type : sorted_types)
+        {
+        if (level_width.empty() || type_size[type] > Scalar(2.0) * level_width.back())
+            level_width.push_back(type_size[type]);
+        type_level[type] = (unsigned int)level_width.size() - 1;
+        }
+
+    // count the local particles in each level
+    std::vector<unsigned int> level_n(level_width.size(), 0);
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+            {
+            const unsigned int level = type_level[__scalar_as_int(h_pos.data[i].w)];
+            if (level != no_cell_level)
+                level_n[level]++;
+            }
+        }
+
+    // no more cells than particles in a level
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const Scalar volume = m_pdata->getBox().getVolume(ndim == 2);
+    for (unsigned int level = 0; level < level_width.size(); ++level)
+        {
+        const Scalar min_width
+            = pow(volume / Scalar(std::max(level_n[level], 1u)), Scalar(1.0) / Scalar(ndim));
+        level_width[level] = std::max(level_width[level], min_width);
+        }
+
+    return level_width;
+    }
+
+/*! \param type_level Level of each type from computeCellLevels()
+    \param level Level to search
+    \returns The largest neighbor list radius of each type with the types in \a level, or -1 when
+              the type has no neighbors in \a level
+*/
+std::vector<Scalar>
+NeighborList::computeCellLevelRStencil(const std::vector<unsigned int>& type_level,
+                                       unsigned int level)
+    {
+    const unsigned int ntypes = m_pdata->getNTypes();
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    std::vector<Scalar> rstencil(ntypes, Scalar(-1.0));
+    for (unsigned int i = 0; i < ntypes; ++i)
+        {
+        for (unsigned int j = 0; j < ntypes; ++j)
+            {
+            if (type_level[j] == level && h_r_cut.data[m_typpair_idx(i, j)] > Scalar(0.0))
+                {
+                rstencil[i]
+                    = std::max(rstencil[i], slow::sqrt(h_r_listsq.data[m_typpair_idx(i, j)]));
+                }
+            }
+        }
+
+    return rstencil;
+    }
+
 /*! \param tag1 TAG (not index) of the first particle in the pair
     \param tag2 TAG (not index) of the second particle in the pair
     \post The pair \a tag1, \a tag2 will not appear in the neighborlist
@@ -1229,17 +1418,14 @@ bool NeighborList::distanceCheck(uint64_t timestep)
 
     // get a local copy of the simulation box too
     const BoxDim& box = m_pdata->getBox();
+    const BoxDim global_box = m_pdata->getGlobalBox();
 
-    // get current nearest plane distances
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
-
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : (Scalar)lambda.z;
+    // the box deformation since the last update shrinks distances by at most lambda_min
+    const Scalar lambda_min = getMinimumStretch();
 
     ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_buff_min(m_r_buff_min, access_location::host, access_mode::read);
 
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         {
@@ -1248,16 +1434,18 @@ bool NeighborList::distanceCheck(uint64_t timestep)
         // minimum distance within which all particles should be included
         Scalar old_rmin = h_rcut_max.data[type_i];
 
-        // maximum value we have checked for neighbors, defined by the buffer layer
-        Scalar rmax = old_rmin + m_r_buff;
+        // maximum value we have checked for neighbors, defined by the smallest buffer layer
+        Scalar rmax = old_rmin + h_r_buff_min.data[type_i];
 
         // max displacement for each particle (after subtraction of homogeneous dilations)
         const Scalar delta_max = (rmax * lambda_min - old_rmin) / Scalar(2.0);
         Scalar maxsq = (delta_max > 0) ? delta_max * delta_max : 0;
 
-        Scalar3 dx = make_scalar3(h_pos.data[i].x - lambda.x * h_last_pos.data[i].x,
-                                  h_pos.data[i].y - lambda.y * h_last_pos.data[i].y,
-                                  h_pos.data[i].z - lambda.z * h_last_pos.data[i].z);
+        // displacement relative to the affinely deformed reference position
+        const Scalar3 last_pos
+            = make_scalar3(h_last_pos.data[i].x, h_last_pos.data[i].y, h_last_pos.data[i].z);
+        const Scalar3 affine_pos = global_box.makeCoordinates(m_last_box.makeFraction(last_pos));
+        Scalar3 dx = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z) - affine_pos;
 
         dx = box.minImage(dx);
 
@@ -1288,6 +1476,133 @@ bool NeighborList::distanceCheck(uint64_t timestep)
     return result;
     }
 
+/*! \param type Particle type
+    \returns The smallest buffer of any pair that \a type participates in
+
+    distanceCheck() updates the list when a particle moves farther than half of this buffer.
+*/
+Scalar NeighborList::getDisplacementBuffer(unsigned int type)
+    {
+    ArrayHandle<Scalar> h_r_buff_min(m_r_buff_min, access_location::host, access_mode::read);
+    return h_r_buff_min.data[type];
+    }
+
+/*! \param type Particle type of the ghost particles
+    \returns The ghost layer width needed for particles of \a type, 0 when they do not interact
+
+    Particles of types i and j move at most half of their displacement buffers before the next
+    update, so a pair with r_cut(i,j) > 0 needs ghosts of type j out to r_cut(i,j) plus the sum of
+    those displacements. See the class documentation.
+*/
+Scalar NeighborList::getGhostLayerWidth(unsigned int type)
+    {
+    if (m_rcut_changed)
+        {
+        updateRList();
+        }
+
+    const Scalar r_buff_j = getDisplacementBuffer(type);
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+
+    Scalar r_ghost = Scalar(0.0);
+    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+        {
+        const Scalar r_cut_ij = h_r_cut.data[m_typpair_idx(i, type)];
+        if (r_cut_ij > Scalar(0.0)) // ensure communication is required
+            {
+            const Scalar r_ghost_ij
+                = r_cut_ij + (getDisplacementBuffer(i) + r_buff_j) / Scalar(2.0);
+            r_ghost = std::max(r_ghost, r_ghost_ij);
+            }
+        }
+
+    return r_ghost;
+    }
+
+/*! The box matrices H = (a, b, c) of m_last_box and the current global box define the affine
+    deformation F = H H_last^-1 that maps the reference positions to the current box. F changes the
+    distance between two particles by at least its smallest singular value, the square root of the
+    smallest eigenvalue of F^T F. Without shear, this is the smallest ratio of box lengths.
+
+    \returns The smallest singular value of F
+*/
+Scalar NeighborList::getMinimumStretch()
+    {
+    const BoxDim global_box = m_pdata->getGlobalBox();
+    const bool is_two_dimensions = m_sysdef->getNDimensions() == 2;
+
+    // upper triangular box matrices
+    double h[3][3] = {};
+    double h_last[3][3] = {};
+    for (unsigned int j = 0; j < 3; j++)
+        {
+        const Scalar3 v = global_box.getLatticeVector(j);
+        const Scalar3 v_last = m_last_box.getLatticeVector(j);
+        h[0][j] = v.x;
+        h[1][j] = v.y;
+        h[2][j] = v.z;
+        h_last[0][j] = v_last.x;
+        h_last[1][j] = v_last.y;
+        h_last[2][j] = v_last.z;
+        }
+
+    if (is_two_dimensions)
+        {
+        h[0][2] = h[1][2] = h_last[0][2] = h_last[1][2] = 0.0;
+        h[2][2] = h_last[2][2] = 1.0;
+        }
+
+    // inverse of the upper triangular h_last
+    double inv[3][3] = {};
+    inv[0][0] = 1.0 / h_last[0][0];
+    inv[1][1] = 1.0 / h_last[1][1];
+    inv[2][2] = 1.0 / h_last[2][2];
+    inv[0][1] = -h_last[0][1] * inv[0][0] * inv[1][1];
+    inv[1][2] = -h_last[1][2] * inv[1][1] * inv[2][2];
+    inv[0][2] = (h_last[0][1] * h_last[1][2] - h_last[0][2] * h_last[1][1]) * inv[0][0] * inv[1][1]
+                * inv[2][2];
+
+    // F = h inv and M = F^T F
+    double F[3][3] = {};
+    for (unsigned int i = 0; i < 3; i++)
+        for (unsigned int j = 0; j < 3; j++)
+            for (unsigned int k = 0; k < 3; k++)
+                F[i][j] += h[i][k] * inv[k][j];
+
+    double M[3][3] = {};
+    for (unsigned int i = 0; i < 3; i++)
+        for (unsigned int j = 0; j < 3; j++)
+            for (unsigned int k = 0; k < 3; k++)
+                M[i][j] += F[k][i] * F[k][j];
+
+    // smallest eigenvalue of the symmetric matrix M (Smith, Comm. ACM 4, 168 (1961))
+    double eig_min;
+    const double p1 = M[0][1] * M[0][1] + M[0][2] * M[0][2] + M[1][2] * M[1][2];
+    if (p1 == 0.0)
+        {
+        eig_min = std::min(M[0][0], std::min(M[1][1], M[2][2]));
+        }
+    else
+        {
+        const double q = (M[0][0] + M[1][1] + M[2][2]) / 3.0;
+        const double p2 = (M[0][0] - q) * (M[0][0] - q) + (M[1][1] - q) * (M[1][1] - q)
+                          + (M[2][2] - q) * (M[2][2] - q) + 2.0 * p1;
+        const double p = sqrt(p2 / 6.0);
+        double B[3][3];
+        for (unsigned int i = 0; i < 3; i++)
+            for (unsigned int j = 0; j < 3; j++)
+                B[i][j] = (M[i][j] - (i == j ? q : 0.0)) / p;
+        const double det_B = B[0][0] * (B[1][1] * B[2][2] - B[1][2] * B[2][1])
+                             - B[0][1] * (B[1][0] * B[2][2] - B[1][2] * B[2][0])
+                             + B[0][2] * (B[1][0] * B[2][1] - B[1][1] * B[2][0]);
+        const double r = std::max(-1.0, std::min(1.0, det_B / 2.0));
+        const double phi = acos(r) / 3.0;
+        eig_min = q + 2.0 * p * cos(phi + 2.0 * M_PI / 3.0);
+        }
+
+    return Scalar(sqrt(std::max(eig_min, 0.0)));
+    }
+
 /*! Copies the current positions of all particles over to m_last_x etc...
  */
 void NeighborList::setLastUpdatedPos()
@@ -1308,6 +1623,7 @@ void NeighborList::setLastUpdatedPos()
     // update last box nearest plane distance
     m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
     m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
+    m_last_box = m_pdata->getGlobalBox();
     }
 
 bool NeighborList::shouldCheckDistance(uint64_t timestep)
@@ -1420,6 +1736,7 @@ bool NeighborList::needsUpdating(uint64_t timestep)
 void NeighborList::resetStats()
     {
     m_updates = m_forced_updates = m_dangerous_updates = 0;
+    m_partial_updates = 0;
 
     for (unsigned int i = 0; i < m_update_periods.size(); i++)
         m_update_periods[i] = 0;
@@ -1462,6 +1779,8 @@ void NeighborList::updateExListIdx()
                                             access_location::host,
                                             access_mode::overwrite);
 
+    m_ex_mask.resize(m_pdata->getN());
+
     // translate the number and exclusions from one array to the other
     for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
         {
@@ -1473,6 +1792,7 @@ void NeighborList::updateExListIdx()
         h_n_ex_idx.data[idx] = n;
 
         // construct the exclusion list
+        uint64_t mask = 0;
         for (unsigned int offset = 0; offset < n; offset++)
             {
             unsigned int ex_tag = h_ex_list_tag.data[m_ex_list_indexer_tag(tag, offset)];
@@ -1480,13 +1800,23 @@ void NeighborList::updateExListIdx()
 
             // store excluded particle idx
             h_ex_list_idx.data[m_ex_list_indexer(idx, offset)] = ex_idx;
+            mask |= uint64_t(1) << (ex_idx % 64);
             }
+        m_ex_mask[idx] = mask;
         }
     }
 
 /*! Loops through the neighbor list and filters out any excluded pairs
  */
 void NeighborList::filterNlist()
+    {
+    filterNlistRows(nullptr, m_pdata->getN());
+    }
+
+/*! \param rows Indices of the particles to filter, or nullptr to filter particles 0 to n_rows - 1
+    \param n_rows Number of particles to filter
+ */
+void NeighborList::filterNlistRows(const unsigned int* rows, unsigned int n_rows)
     {
     // access data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
@@ -1498,11 +1828,11 @@ void NeighborList::filterNlist()
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
 
     // for each particle's neighbor list
-    for (unsigned int idx = 0; idx < m_pdata->getN(); idx++)
+    for (unsigned int row = 0; row < n_rows; row++)
         {
+        unsigned int idx = rows ? rows[row] : row;
         size_t myHead = h_head_list.data[idx];
         unsigned int n_neigh = h_n_neigh.data[idx];
-        unsigned int n_ex = h_n_ex_idx.data[idx];
         unsigned int new_n_neigh = 0;
 
         // loop over the list, regenerating it as we go
@@ -1510,20 +1840,8 @@ void NeighborList::filterNlist()
             {
             unsigned int cur_neigh = h_nlist.data[myHead + cur_neigh_idx];
 
-            // test if excluded
-            bool excluded = false;
-            for (unsigned int cur_ex_idx = 0; cur_ex_idx < n_ex; cur_ex_idx++)
-                {
-                unsigned int cur_ex = h_ex_list_idx.data[m_ex_list_indexer(idx, cur_ex_idx)];
-                if (cur_ex == cur_neigh)
-                    {
-                    excluded = true;
-                    break;
-                    }
-                }
-
             // add it back to the list if it is not excluded
-            if (!excluded)
+            if (!isExcluded(idx, cur_neigh, h_n_ex_idx.data, h_ex_list_idx.data))
                 {
                 h_nlist.data[myHead + new_n_neigh] = cur_neigh;
                 new_n_neigh++;
@@ -1535,6 +1853,301 @@ void NeighborList::filterNlist()
         }
     }
 
+/*! Updates the neighbor list in place when only a few particles have moved farther than r_buff / 2
+    from their reference positions since the last update. The reference position of each displaced
+    particle is reset to its current position and its neighbors are recomputed against the
+    reference positions of all other particles, which keeps the invariant described in the class
+    documentation.
+
+    \returns true if the partial update succeeded, false if the caller must rebuild the full list
+ */
+bool NeighborList::updateNlistPartial()
+    {
+    if (!m_incremental || !m_has_been_updated_once || m_exec_conf->isCUDAEnabled()
+        || m_n_partial_since_full >= max_partial_updates)
+        return false;
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition() || m_pdata->getNGhosts() > 0)
+        return false;
+#endif
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    if (!(box == m_last_box))
+        return false;
+
+    const unsigned int N = m_pdata->getN();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::readwrite);
+
+    // find the particles that moved too far from their reference positions
+    ArrayHandle<Scalar> h_r_buff_min(m_r_buff_min, access_location::host, access_mode::read);
+    const unsigned int max_movers = (unsigned int)(max_partial_fraction * Scalar(N));
+    std::vector<unsigned int> movers;
+    std::vector<char> is_mover(N, 0);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 dx = make_scalar3(h_pos.data[i].x - h_last_pos.data[i].x,
+                                  h_pos.data[i].y - h_last_pos.data[i].y,
+                                  h_pos.data[i].z - h_last_pos.data[i].z);
+        dx = box.minImage(dx);
+        const Scalar delta_max
+            = h_r_buff_min.data[__scalar_as_int(h_pos.data[i].w)] / Scalar(2.0);
+        if (dot(dx, dx) >= delta_max * delta_max)
+            {
+            if (movers.size() >= max_movers)
+                return false;
+            movers.push_back(i);
+            is_mover[i] = 1;
+            }
+        }
+
+    // bin the reference positions in cells no smaller than the largest r_list
+    const Scalar3 L = box.getNearestPlaneDistance();
+    const Scalar r_list_max = getMaxRList();
+    const bool is_2d = m_sysdef->getNDimensions() == 2;
+    const uint3 dim = make_uint3((unsigned int)(L.x / r_list_max),
+                                 (unsigned int)(L.y / r_list_max),
+                                 is_2d ? 1 : (unsigned int)(L.z / r_list_max));
+    if (dim.x < 3 || dim.y < 3 || (!is_2d && dim.z < 3))
+        return false;
+
+    auto cell_of = [&](const Scalar4& p)
+        {
+        Scalar3 f = box.makeFraction(make_scalar3(p.x, p.y, p.z));
+        int3 c = make_int3(int(f.x * Scalar(dim.x)), int(f.y * Scalar(dim.y)), 0);
+        if (!is_2d)
+            c.z = int(f.z * Scalar(dim.z));
+        c.x = std::min(std::max(c.x, 0), int(dim.x) - 1);
+        c.y = std::min(std::max(c.y, 0), int(dim.y) - 1);
+        c.z = std::min(std::max(c.z, 0), int(dim.z) - 1);
+        return c;
+        };
+
+    const unsigned int empty = 0xffffffff;
+    Index3D cell_indexer(dim.x, dim.y, dim.z);
+    std::vector<unsigned int> cell_head(cell_indexer.getNumElements(), empty);
+    std::vector<unsigned int> cell_next(N, empty);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        if (is_mover[i])
+            h_last_pos.data[i]
+                = make_scalar4(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z, Scalar(0.0));
+
+        int3 c = cell_of(h_last_pos.data[i]);
+        unsigned int cell = cell_indexer(c.x, c.y, c.z);
+        cell_next[i] = cell_head[cell];
+        cell_head[cell] = i;
+        }
+
+    // rows of the neighbor list that gained entries
+    std::vector<unsigned int> rows(movers);
+
+    // the handles must be released before filtering the list
+    {
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::readwrite);
+
+    // add j to the list of i unless it is already there, returns false on overflow
+    auto insert_neighbor = [&](unsigned int i, unsigned int j, bool check_existing)
+        {
+        const size_t head = h_head_list.data[i];
+        const unsigned int n_neigh = h_n_neigh.data[i];
+        if (check_existing)
+            {
+            for (unsigned int k = 0; k < n_neigh; k++)
+                {
+                if (h_nlist.data[head + k] == j)
+                    return true;
+                }
+            }
+
+        if (n_neigh >= h_Nmax.data[__scalar_as_int(h_pos.data[i].w)])
+            return false;
+
+        h_nlist.data[head + n_neigh] = j;
+        h_n_neigh.data[i] = n_neigh + 1;
+        if (!is_mover[i])
+            rows.push_back(i);
+        return true;
+        };
+
+    for (unsigned int m : movers)
+        h_n_neigh.data[m] = 0;
+
+    const bool full_storage = m_storage_mode == full;
+    for (unsigned int m : movers)
+        {
+        const Scalar3 ref_m
+            = make_scalar3(h_last_pos.data[m].x, h_last_pos.data[m].y, h_last_pos.data[m].z);
+        const unsigned int type_m = __scalar_as_int(h_pos.data[m].w);
+        const unsigned int body_m = h_body.data[m];
+        const int3 c = cell_of(h_last_pos.data[m]);
+
+        const int dz_max = is_2d ? 0 : 1;
+        for (int dz = -dz_max; dz <= dz_max; dz++)
+            {
+            for (int dy = -1; dy <= 1; dy++)
+                {
+                for (int dx = -1; dx <= 1; dx++)
+                    {
+                    unsigned int cell = cell_indexer((c.x + dx + dim.x) % dim.x,
+                                                     (c.y + dy + dim.y) % dim.y,
+                                                     (c.z + dz + dim.z) % dim.z);
+                    for (unsigned int j = cell_head[cell]; j != empty; j = cell_next[j])
+                        {
+                        const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+                        const unsigned int typpair_idx = m_typpair_idx(type_m, type_j);
+                        bool excluded = j == m || h_r_cut.data[typpair_idx] <= Scalar(0.0);
+                        if (m_filter_body && body_m != NO_BODY)
+                            excluded = excluded || (body_m == h_body.data[j]);
+                        if (excluded)
+                            continue;
+
+                        Scalar3 dr = ref_m
+                                     - make_scalar3(h_last_pos.data[j].x,
+                                                    h_last_pos.data[j].y,
+                                                    h_last_pos.data[j].z);
+                        dr = box.minImage(dr);
+                        if (dot(dr, dr) > h_r_listsq.data[typpair_idx])
+                            continue;
+
+                        // rows of other displaced particles are rebuilt in this same loop
+                        bool success = true;
+                        if (full_storage || m < j)
+                            success = insert_neighbor(m, j, false);
+                        if (success && !is_mover[j] && (full_storage || m > j))
+                            success = insert_neighbor(j, m, true);
+                        if (!success)
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (m_exclusions_set)
+        {
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+        filterNlistRows(rows.data(), (unsigned int)rows.size());
+        }
+
+    return true;
+    }
+
+/*! The pairs of each i-cluster are stored in the region of the per-particle list of its
+    particles: an i-cluster has no more j-clusters than its particles have neighbors, so the
+    cluster pair list never needs more room than the per-particle list. The cluster head list has
+    one extra entry that holds the end of the list.
+*/
+void NeighborList::allocateClusterPairs()
+    {
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_clusters = (N + cluster_size - 1) / cluster_size;
+
+    if (m_cluster_n_pairs.getNumElements() < n_clusters + 1)
+        {
+        GlobalArray<unsigned int> cluster_n_pairs(n_clusters + 1, m_exec_conf);
+        m_cluster_n_pairs.swap(cluster_n_pairs);
+        TAG_ALLOCATION(m_cluster_n_pairs);
+
+        GlobalArray<size_t> cluster_head_list(n_clusters + 1, m_exec_conf);
+        m_cluster_head_list.swap(cluster_head_list);
+        TAG_ALLOCATION(m_cluster_head_list);
+        }
+
+    // follow the size of the per-particle list, which already grows and compacts as needed
+    if (m_cluster_pair_list.getNumElements() != m_nlist.getNumElements())
+        {
+        GlobalArray<uint2> cluster_pair_list(m_nlist.getNumElements(), m_exec_conf);
+        m_cluster_pair_list.swap(cluster_pair_list);
+        TAG_ALLOCATION(m_cluster_pair_list);
+        }
+
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_cluster_head_list(m_cluster_head_list,
+                                            access_location::host,
+                                            access_mode::overwrite);
+
+    for (unsigned int cluster_i = 0; cluster_i < n_clusters; cluster_i++)
+        h_cluster_head_list.data[cluster_i] = h_head_list.data[cluster_i * cluster_size];
+    h_cluster_head_list.data[n_clusters] = m_cluster_pair_list.getNumElements();
+    }
+
+/*! Groups the local particles into clusters of cluster_size consecutive indices and collects,
+    for every i-cluster, the j-clusters that hold its neighbors along with the interaction mask.
+    Lists that build the cluster pairs in their own traversal with buildParticles() skip this
+    pass after a full build. It remains for the partial updates and for the lists that filter
+    their neighbors after the build.
+*/
+void NeighborList::buildClusterPairs()
+    {
+    allocateClusterPairs();
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_clusters = (N + cluster_size - 1) / cluster_size;
+    const unsigned int n_j_clusters = (N + m_pdata->getNGhosts() + cluster_size - 1) / cluster_size;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+
+    ArrayHandle<unsigned int> h_cluster_n_pairs(m_cluster_n_pairs,
+                                                access_location::host,
+                                                access_mode::overwrite);
+    ArrayHandle<size_t> h_cluster_head_list(m_cluster_head_list,
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<uint2> h_cluster_pair_list(m_cluster_pair_list,
+                                           access_location::host,
+                                           access_mode::overwrite);
+
+    auto build_cluster = [&](unsigned int cluster_i, ClusterPairBuilder& builder)
+        {
+        builder.begin(h_cluster_pair_list.data, h_cluster_head_list.data, cluster_i, n_j_clusters);
+        const unsigned int last = std::min((cluster_i + 1) * cluster_size, N);
+        for (unsigned int i = cluster_i * cluster_size; i < last; i++)
+            {
+            const size_t head = h_head_list.data[i];
+            for (unsigned int k = 0; k < h_n_neigh.data[i]; k++)
+                builder.add(i % cluster_size, h_nlist.data[head + k]);
+            }
+        h_cluster_n_pairs.data[cluster_i] = builder.end();
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_clusters),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      ClusterPairBuilder& builder
+                                          = m_thread_cluster_builders.local();
+                                      for (unsigned int c = r.begin(); c != r.end(); ++c)
+                                          build_cluster(c, builder);
+                                  });
+            });
+        }
+    else
+#endif
+        {
+        for (unsigned int cluster_i = 0; cluster_i < n_clusters; cluster_i++)
+            build_cluster(cluster_i, m_cluster_builder);
+        }
+    }
+
 /*!
  * Iterates through each particle, and calculates a running sum of the starting index for that
  * particle in the flat array of neighbors.
@@ -1589,6 +2202,70 @@ void NeighborList::resizeNlist(size_t size)
 
         m_nlist.resize(alloc_size);
         }
+    else if (m_compact_requested)
+        {
+        size_t alloc_size = (size > 4) ? (size + 3) & ~3 : 4;
+        if (alloc_size < m_nlist.getNumElements())
+            {
+            m_exec_conf->msg->notice(6) << "nlist: Compacting neighbor list, new size "
+                                        << alloc_size << " uints " << endl;
+            m_nlist.resize(alloc_size);
+            }
+        }
+    m_compact_requested = false;
+    }
+
+/*! \returns The number of bytes allocated for the neighbor list, head list, neighbor counts,
+    exclusions, and cluster pair list
+*/
+size_t NeighborList::getMemoryUsage() const
+    {
+    return m_nlist.getNumElements() * sizeof(unsigned int)
+           + m_n_neigh.getNumElements() * sizeof(unsigned int)
+           + m_head_list.getNumElements() * sizeof(size_t)
+           + m_last_pos.getNumElements() * sizeof(Scalar4)
+           + m_ex_list_tag.getNumElements() * sizeof(unsigned int)
+           + m_ex_list_idx.getNumElements() * sizeof(unsigned int)
+           + m_n_ex_tag.getNumElements() * sizeof(unsigned int)
+           + m_n_ex_idx.getNumElements() * sizeof(unsigned int)
+           + m_cluster_n_pairs.getNumElements() * sizeof(unsigned int)
+           + m_cluster_head_list.getNumElements() * sizeof(size_t)
+           + m_cluster_pair_list.getNumElements() * sizeof(uint2);
+    }
+
+/*! The neighbor list never shrinks on its own: m_Nmax only grows when a build overflows, so a
+    transient spike in density (e.g. a collapsing cluster) keeps its memory for the rest of the
+    run. compactMemory() lowers m_Nmax to the largest neighbor count of each type in the last
+    build and forces a rebuild, which reallocates m_nlist to the size the new head list needs.
+    A later build that needs more neighbors grows the list again through the usual overflow path.
+*/
+void NeighborList::compactMemory()
+    {
+    if (!m_has_been_updated_once)
+        return;
+
+        {
+        ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::readwrite);
+
+        std::vector<unsigned int> max_n_neigh(m_pdata->getNTypes(), 0);
+        for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+            {
+            unsigned int type = __scalar_as_int(h_pos.data[i].w);
+            max_n_neigh[type] = std::max(max_n_neigh[type], h_n_neigh.data[i]);
+            }
+
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            h_Nmax.data[i] = (max_n_neigh[i] > 4) ? (max_n_neigh[i] + 3) & ~3 : 4;
+            }
+        }
+
+    m_compact_requested = true;
+    forceUpdate();
     }
 
 /*!
@@ -1728,37 +2405,37 @@ void NeighborList::updateMemoryMapping()
     }
 #endif
 
-pybind11::array_t<uint32_t> NeighborList::getLocalPairListPython(uint64_t timestep)
+/*! The pairs of particle i are stored in the order of its neighbor list, and the particles in the
+    order of their local index. In full storage mode, a pair of two local particles i > j is
+    skipped because the pair (j, i) is also in the list.
+*/
+void NeighborList::buildPairList()
     {
-    compute(timestep);
+    const unsigned int N = m_pdata->getN();
+    const bool third_law = getStorageMode() == NeighborList::half;
 
-    bool third_law = getStorageMode() == NeighborList::half;
-
-    ArrayHandle<unsigned int> h_n_neigh(getNNeighArray(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_nlist(getNListArray(), access_location::host, access_mode::read);
-    ArrayHandle<size_t> h_head_list(getHeadList(), access_location::host, access_mode::read);
-
-    auto* pair_list = new std::vector<vec2<uint32_t>>();
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
 
-    // We can get an upper bound for the number of pairs by accumulating n_neigh,
-    // but without explicitly checking tags we cannot be sure of the number of duplicates
-    size_t max_n_elem = 0;
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // the number of entries in the neighbor list bounds the number of pairs
+    size_t max_n_pairs = 0;
+    for (unsigned int i = 0; i < N; i++)
         {
-        max_n_elem += h_n_neigh.data[i];
+        max_n_pairs += h_n_neigh.data[i];
         }
 
-    pair_list->reserve(max_n_elem);
+    if (m_pair_list.getNumElements() < max_n_pairs)
+        {
+        GlobalArray<uint2> pair_list(max_n_pairs, m_exec_conf);
+        m_pair_list.swap(pair_list);
+        TAG_ALLOCATION(m_pair_list);
+        }
 
-    pybind11::capsule delete_when_done(pair_list,
-                                       [](void* f)
-                                       {
-                                           auto data
-                                               = reinterpret_cast<std::vector<vec2<uint32_t>>*>(f);
-                                           delete data;
-                                       });
+    ArrayHandle<uint2> h_pair_list(m_pair_list, access_location::host, access_mode::overwrite);
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    size_t n_pairs = 0;
+    for (unsigned int i = 0; i < N; i++)
         {
         const size_t my_head = h_head_list.data[i];
         const unsigned int size = h_n_neigh.data[i];
@@ -1766,14 +2443,60 @@ pybind11::array_t<uint32_t> NeighborList::getLocalPairListPython(uint64_t timest
             {
             const unsigned int j = h_nlist.data[my_head + k];
             // if j is not a ghost, only accept it if i < j
-            if (!third_law && j < m_pdata->getN() && i > j)
+            if (!third_law && j < N && i > j)
                 continue;
 
-            pair_list->push_back(vec2(i, j));
+            h_pair_list.data[n_pairs++] = make_uint2(i, j);
             }
         }
 
-    pair_list->shrink_to_fit();
+    m_n_pairs = n_pairs;
+    }
+
+void NeighborList::computePairDisplacements()
+    {
+    if (m_pair_dr.getNumElements() < m_n_pairs)
+        {
+        GlobalArray<Scalar3> pair_dr(m_pair_list.getNumElements(), m_exec_conf);
+        m_pair_dr.swap(pair_dr);
+        TAG_ALLOCATION(m_pair_dr);
+        }
+
+    const BoxDim& box = m_pdata->getBox();
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<uint2> h_pair_list(m_pair_list, access_location::host, access_mode::read);
+    ArrayHandle<Scalar3> h_pair_dr(m_pair_dr, access_location::host, access_mode::overwrite);
+
+    for (size_t p = 0; p < m_n_pairs; p++)
+        {
+        const uint2 pair = h_pair_list.data[p];
+        const Scalar4 pos_i = h_pos.data[pair.x];
+        const Scalar4 pos_j = h_pos.data[pair.y];
+        Scalar3 dr = make_scalar3(pos_i.x - pos_j.x, pos_i.y - pos_j.y, pos_i.z - pos_j.z);
+        h_pair_dr.data[p] = box.minImage(dr);
+        }
+    }
+
+pybind11::array_t<uint32_t> NeighborList::getLocalPairListPython(uint64_t timestep)
+    {
+    compute(timestep);
+    updatePairList();
+
+    ArrayHandle<uint2> h_pair_list(m_pair_list, access_location::host, access_mode::read);
+    auto* pair_list = new std::vector<vec2<uint32_t>>();
+    pair_list->reserve(m_n_pairs);
+    for (size_t p = 0; p < m_n_pairs; p++)
+        {
+        pair_list->push_back(vec2<uint32_t>(h_pair_list.data[p].x, h_pair_list.data[p].y));
+        }
+
+    pybind11::capsule delete_when_done(pair_list,
+                                       [](void* f)
+                                       {
+                                           auto data
+                                               = reinterpret_cast<std::vector<vec2<uint32_t>>*>(f);
+                                           delete data;
+                                       });
 
     unsigned long shape[] = {pair_list->size(), 2};
     unsigned long stride[] = {2 * sizeof(uint32_t), sizeof(uint32_t)};
@@ -1976,6 +2699,25 @@ void NeighborList::setRCutPython(pybind11::tuple types, Scalar r_cut)
     setRcut(typ1, typ2, r_cut);
     }
 
+void NeighborList::setPairBufferPython(pybind11::tuple types, pybind11::object r_buff)
+    {
+    auto typ1 = m_pdata->getTypeByName(types[0].cast<std::string>());
+    auto typ2 = m_pdata->getTypeByName(types[1].cast<std::string>());
+    setRBuffPair(typ1, typ2, r_buff.is_none() ? Scalar(-1.0) : r_buff.cast<Scalar>());
+    }
+
+pybind11::object NeighborList::getPairBufferPython(pybind11::tuple types)
+    {
+    auto typ1 = m_pdata->getTypeByName(types[0].cast<std::string>());
+    auto typ2 = m_pdata->getTypeByName(types[1].cast<std::string>());
+    validateTypes(typ1, typ2, "getting the pair buffer.");
+    ArrayHandle<Scalar> h_r_buff_pair(m_r_buff_pair, access_location::host, access_mode::read);
+    const Scalar r_buff = h_r_buff_pair.data[m_typpair_idx(typ1, typ2)];
+    if (r_buff < Scalar(0.0))
+        return pybind11::none();
+    return pybind11::cast(r_buff);
+    }
+
 Scalar NeighborList::getRCut(pybind11::tuple types)
     {
     auto typ1 = m_pdata->getTypeByName(types[0].cast<std::string>());
@@ -1997,6 +2739,10 @@ void export_NeighborList(pybind11::module& m)
                       &NeighborList::setRebuildCheckDelay)
         .def_property("check_dist", &NeighborList::getDistCheck, &NeighborList::setDistCheck)
         .def("setStorageMode", &NeighborList::setStorageMode)
+        .def_property("clusters", &NeighborList::getClusterPairs, &NeighborList::setClusterPairs)
+        .def_property("incremental",
+                      &NeighborList::getIncremental,
+                      &NeighborList::setIncremental)
         .def_property("exclusions", &NeighborList::getExclusions, &NeighborList::setExclusions)
         .def("addMesh", &NeighborList::AddMesh)
         .def("getMaxRCut", &NeighborList::getMaxRCut)
@@ -2008,10 +2754,15 @@ void export_NeighborList(pybind11::module& m)
         .def("getNumUpdates", &NeighborList::getNumUpdates)
         .def("getNumExclusions", &NeighborList::getNumExclusions)
         .def_property_readonly("num_builds", &NeighborList::getNumUpdates)
+        .def_property_readonly("num_partial_updates", &NeighborList::getNumPartialUpdates)
+        .def_property_readonly("memory_usage", &NeighborList::getMemoryUsage)
+        .def("compactMemory", &NeighborList::compactMemory)
         .def("getLocalPairList", &NeighborList::getLocalPairListPython)
         .def("getPairList", &NeighborList::getPairListPython)
         .def("setRCut", &NeighborList::setRCutPython)
         .def("getRCut", &NeighborList::getRCut)
+        .def("setPairBuffer", &NeighborList::setPairBufferPython)
+        .def("getPairBuffer", &NeighborList::getPairBufferPython)
         .def("compute", &NeighborList::compute);
 
     pybind11::enum_<NeighborList::storageMode>(nlist, "storageMode")
@@ -10,10 +10,17 @@
 #include "hoomd/PythonLocalDataAccess.h"
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <vector>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file NeighborList.h
     \brief Declares the NeighborList class
 */
@@ -105,6 +112,12 @@ namespace md
    removes any particles that are excluded. This allows an arbitrary number of exclusions to be
    processed without slowing the performance of the buildNlist() step itself.
 
+   updateExListIdx() also sets a 64 bit mask per particle in which bit j % 64 is set for every
+   excluded index j. isExcluded() rejects most pairs that are not excluded with a single test of
+   the mask and only searches the exclusion list of particle i when the bit is set. Derived classes
+   that test every candidate pair with isExcluded() while they build the list return true from
+   buildFiltersExclusions(), which skips the separate filterNlist() pass.
+
     <b>Overflow handling:</b>
     For easy support of derived GPU classes to implement overflow detection the overflow condition
    is stored in the GlobalArray \a d_conditions.
@@ -116,6 +129,61 @@ namespace md
     Condition flags are to be set during the buildNlist() call and will be checked by compute()
    which will then take the appropriate action.
 
+    <b>Cluster pair list:</b>
+    When enabled with setClusterPairs(), the CPU neighbor list also stores its contents as a list
+   of cluster pairs in the style of the GROMACS NxM scheme. Particle indices are grouped into
+   clusters of cluster_size consecutive indices, which are spatially compact because ParticleData is
+   sorted along a space filling curve. For each i-cluster, the list stores the j-clusters that
+   contain at least one neighbor together with a cluster_size x cluster_size interaction mask. Bit
+   <code>a * cluster_size + b</code> of the mask is set when particle <code>cluster_size * I +
+   a</code> has particle <code>cluster_size * J + b</code> in its neighbor list, so the cluster pair
+   list honors the storage mode, r_cut, and exclusions exactly. Lists that build with
+   buildParticles() record the cluster pairs during the same traversal that writes the
+   per-particle list. The other lists, and partial updates, derive them from the per-particle list
+   in buildClusterPairs(). The pairs of i-cluster \a I are stored in the per-particle list region
+   of its particles, so the cluster pair list needs no more memory than the per-particle list.
+
+     - <code>J = cluster_pairs[cluster_head_list[I] + n].x</code> is the index of j-cluster \a n
+   of i-cluster \a I, and <code>cluster_pairs[cluster_head_list[I] + n].y</code> is its mask,
+   where \a n can vary from 0 to <code>cluster_n_pairs[I] - 1</code>.
+
+    <b>Local pair list:</b>
+    updatePairList() flattens the per-particle list into an array of (i, j) local index pairs,
+   getPairListArray(), with the same contents as getLocalPairListPython(). It stores each pair of
+   two local particles once in both storage modes. The array is rebuilt only when the neighbor list
+   has changed since the last call, and it is built on the device by the GPU neighbor lists, so
+   external consumers can read the same pairs that the pair potentials use without a host copy.
+   updatePairDisplacements() fills getPairDisplacementArray() with the minimum image vectors
+   r_i - r_j of the pairs from the current positions.
+
+    <b>Per type pair buffers:</b>
+    By default, the neighbor list includes all pairs within r_cut(i,j) + r_buff. A buffer set for a
+    type pair with setPairBuffer() replaces r_buff for that pair and must not exceed r_buff, so the
+    cell list widths, ghost layers, and box size checks that use r_buff remain valid. Particles of
+    type i trigger an update when they move farther than half of the smallest buffer of any pair
+    that type i participates in. The GPU neighbor lists always include pairs out to
+    r_cut(i,j) + r_buff.
+
+    <b>Ghost layer:</b>
+    Between updates, the distance check limits the displacement of a particle of type i to half of
+    getDisplacementBuffer(i). A ghost particle of type j can only come within r_cut(i,j) of a local
+    particle of type i when it was within r_cut(i,j) + (getDisplacementBuffer(i) +
+    getDisplacementBuffer(j)) / 2 of the domain at the last ghost exchange. getGhostLayerWidth()
+    requests the largest of these widths over all types i that interact with j, so small pair
+    buffers shrink the ghost layer along with the list.
+
+    <b>Incremental updates:</b>
+    When enabled with setIncremental(), the CPU neighbor list replaces full rebuilds with partial
+   updates where possible. m_last_pos holds a reference position for every particle and the list
+   contains every pair whose reference positions are closer than r_list. Any pair missing from the
+   list is then farther apart than r_cut as long as no particle is displaced more than r_buff / 2
+   from its reference position. A partial update resets the reference position of only the
+   displaced particles and recomputes their neighbors against the reference positions of all
+   other particles. Entries for pairs that moved apart remain in the list until the next full
+   rebuild, which happens after max_partial_updates partial updates, when more than
+   max_partial_fraction of the particles are displaced, or whenever a partial update is not
+   possible (box changes, forced updates, neighbor list overflow, domain decomposition).
+
     \ingroup computes
 */
 class PYBIND11_EXPORT NeighborList : public Compute
@@ -128,6 +196,18 @@ class PYBIND11_EXPORT NeighborList : public Compute
         full  //!< All neighbors are stored
         };
 
+    /// Number of particles in each cluster of the cluster pair list
+    static constexpr unsigned int cluster_size = 4;
+
+    /// Maximum number of consecutive partial updates before a full rebuild
+    static constexpr unsigned int max_partial_updates = 20;
+
+    /// Maximum fraction of displaced particles handled by a partial update
+    static constexpr Scalar max_partial_fraction = Scalar(0.1);
+
+    /// Level assigned to the types without neighbors in a multilevel cell list
+    static constexpr unsigned int no_cell_level = 0xffffffff;
+
     //! Constructs the compute
     NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
 
@@ -235,6 +315,20 @@ class PYBIND11_EXPORT NeighborList : public Compute
         forceUpdate();
         }
 
+    /// Set whether to build the cluster pair list
+    void setClusterPairs(bool enable)
+        {
+        m_cluster_pairs = enable;
+        forceUpdate();
+        }
+
+    /// Set whether to update the list incrementally
+    void setIncremental(bool enable)
+        {
+        m_incremental = enable;
+        forceUpdate();
+        }
+
     // @}
     //! \name Get properties
     // @{
@@ -245,6 +339,36 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_storage_mode;
         }
 
+    /// Get whether the cluster pair list is requested
+    bool getClusterPairs() const
+        {
+        return m_cluster_pairs;
+        }
+
+    /// Test whether the cluster pair list is available on the host
+    bool hasClusterPairs() const
+        {
+        return m_cluster_pairs && !m_exec_conf->isCUDAEnabled();
+        }
+
+    /// Get whether incremental updates are requested
+    bool getIncremental() const
+        {
+        return m_incremental;
+        }
+
+    /// Get the number of partial updates performed
+    uint64_t getNumPartialUpdates() const
+        {
+        return m_partial_updates;
+        }
+
+    /// Get the number of bytes allocated for the per-particle neighbor list arrays
+    size_t getMemoryUsage() const;
+
+    /// Release neighbor list capacity that exceeds the current needs
+    virtual void compactMemory();
+
     //! Get the maximum of all rcut
     Scalar getMaxRCut()
         {
@@ -279,6 +403,14 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_r_buff;
         }
 
+    /// Get the buffer used for a type pair
+    Scalar getRBuffPair(unsigned int typ1, unsigned int typ2)
+        {
+        ArrayHandle<Scalar> h_r_buff_pair(m_r_buff_pair, access_location::host, access_mode::read);
+        const Scalar r_buff_pair = h_r_buff_pair.data[m_typpair_idx(typ1, typ2)];
+        return (r_buff_pair >= Scalar(0.0)) ? std::min(r_buff_pair, m_r_buff) : m_r_buff;
+        }
+
     // @}
     //! \name Statistics
     // @{
@@ -311,6 +443,59 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_head_list;
         }
 
+    /// Get the number of j-clusters for each i-cluster
+    const GlobalArray<unsigned int>& getClusterNPairsArray() const
+        {
+        return m_cluster_n_pairs;
+        }
+
+    /// Get the cluster pair head list
+    const GlobalArray<size_t>& getClusterHeadList() const
+        {
+        return m_cluster_head_list;
+        }
+
+    /// Get the cluster pair list (x: j-cluster, y: interaction mask)
+    const GlobalArray<uint2>& getClusterPairArray() const
+        {
+        return m_cluster_pair_list;
+        }
+
+    /// Get the local pair list (x: i, y: j), valid after updatePairList()
+    const GlobalArray<uint2>& getPairListArray() const
+        {
+        return m_pair_list;
+        }
+
+    /// Get the pair displacements r_i - r_j, valid after updatePairDisplacements()
+    const GlobalArray<Scalar3>& getPairDisplacementArray() const
+        {
+        return m_pair_dr;
+        }
+
+    /// Get the number of pairs in the local pair list
+    size_t getNPairs() const
+        {
+        return m_n_pairs;
+        }
+
+    /// Rebuild the local pair list when the neighbor list changed since the last build
+    void updatePairList()
+        {
+        if (!m_pair_list_valid)
+            {
+            buildPairList();
+            m_pair_list_valid = true;
+            }
+        }
+
+    /// Compute the displacements of the pairs in the local pair list from the current positions
+    void updatePairDisplacements()
+        {
+        updatePairList();
+        computePairDisplacements();
+        }
+
     //! Get the number of exclusions array
     const GlobalArray<unsigned int>& getNExArray()
         {
@@ -376,25 +561,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
         }
 
     //! Return the requested ghost layer width
-    virtual Scalar getGhostLayerWidth(unsigned int type)
-        {
-        if (m_rcut_changed)
-            {
-            updateRList();
-            }
-
-        ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
-        const Scalar rcut_max_i = h_rcut_max.data[type];
-
-        if (rcut_max_i > Scalar(0.0)) // ensure communication is required
-            {
-            return rcut_max_i + m_r_buff;
-            }
-        else
-            {
-            return Scalar(0.0);
-            }
-        }
+    virtual Scalar getGhostLayerWidth(unsigned int type);
 
     // @}
 
@@ -469,6 +636,16 @@ class PYBIND11_EXPORT NeighborList : public Compute
     /// Set the rcut for a single type pair using a tuple of strings
     virtual void setRCutPython(pybind11::tuple types, Scalar r_cut);
 
+    /// Set the buffer for a single type pair, a negative value selects the global buffer
+    void setRBuffPair(unsigned int typ1, unsigned int typ2, Scalar r_buff);
+
+    /// Set the buffer for a single type pair using a tuple of strings, None selects the global
+    /// buffer
+    void setPairBufferPython(pybind11::tuple types, pybind11::object r_buff);
+
+    /// Get the buffer set for a single type pair, None when it uses the global buffer
+    pybind11::object getPairBufferPython(pybind11::tuple types);
+
     protected:
     Index2D m_typpair_idx;           //!< Indexer for full type pair storage
     GlobalArray<Scalar> m_r_cut;     //!< The potential cutoffs stored by pair type
@@ -476,6 +653,9 @@ class PYBIND11_EXPORT NeighborList : public Compute
     GlobalArray<Scalar> m_rcut_max;  //!< The maximum value of rcut per particle type
     GlobalArray<Scalar> m_rcut_base; //!< The base rcut values
 
+    GlobalArray<Scalar> m_r_buff_pair; //!< Buffer set per type pair, negative to use m_r_buff
+    GlobalArray<Scalar> m_r_buff_min;  //!< The minimum buffer of any pair per particle type
+
     /// List of r_cut matrices from neighborlist consumers
     std::vector<std::shared_ptr<GlobalArray<Scalar>>> m_consumer_r_cut;
 
@@ -490,6 +670,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     GlobalArray<Scalar4> m_last_pos;     //!< coordinates of last updated particle positions
     Scalar3 m_last_L;                    //!< Box lengths at last update
     Scalar3 m_last_L_local;              //!< Local Box lengths at last update
+    BoxDim m_last_box;                   //!< Global box at last full update
 
     GlobalArray<size_t> m_head_list; //!< Indexes for particles to read from the neighbor list
     GlobalArray<unsigned int>
@@ -504,9 +685,101 @@ class PYBIND11_EXPORT NeighborList : public Compute
     Index2D m_ex_list_indexer;               //!< Indexer for accessing the exclusion list
     Index2D m_ex_list_indexer_tag;           //!< Indexer for accessing the by-tag exclusion list
     bool m_exclusions_set;                   //!< True if any exclusions have been set
+    std::vector<uint64_t> m_ex_mask;         //!< Bit j % 64 is set if particle i excludes index j
 
     std::shared_ptr<MeshBondData> m_meshbond_data;
 
+    /// Merges the neighbors of one i-cluster into its entries of the cluster pair list
+    class ClusterPairBuilder
+        {
+        public:
+        /// Start i-cluster \a cluster_i
+        /*! \param pair_list Cluster pair list
+            \param cluster_head_list Cluster head list, with the end of the list in the last entry
+            \param cluster_i Index of the i-cluster
+            \param n_j_clusters Number of j-clusters, including the ghost particles
+        */
+        void begin(uint2* pair_list,
+                   const size_t* cluster_head_list,
+                   unsigned int cluster_i,
+                   unsigned int n_j_clusters)
+            {
+            if (m_slot.size() < n_j_clusters)
+                m_slot.resize(n_j_clusters, NOT_FOUND);
+
+            m_pairs = pair_list + cluster_head_list[cluster_i];
+            m_capacity = cluster_head_list[cluster_i + 1] - cluster_head_list[cluster_i];
+            m_n_pairs = 0;
+            }
+
+        /// Record particle \a j as a neighbor of particle \a a of the i-cluster
+        void add(unsigned int a, unsigned int j)
+            {
+            const unsigned int cluster_j = j / cluster_size;
+            const unsigned int bit = 1u << (a * cluster_size + j % cluster_size);
+            const unsigned int slot = m_slot[cluster_j];
+            if (slot != NOT_FOUND)
+                {
+                m_pairs[slot].y |= bit;
+                }
+            else if (m_n_pairs < m_capacity)
+                {
+                // the capacity is only exceeded when a particle overflows Nmax, which triggers
+                // another build
+                m_slot[cluster_j] = m_n_pairs;
+                m_pairs[m_n_pairs++] = make_uint2(cluster_j, bit);
+                }
+            }
+
+        /// Finish the i-cluster
+        /*! \returns The number of j-clusters of the i-cluster
+         */
+        unsigned int end()
+            {
+            for (unsigned int n = 0; n < m_n_pairs; n++)
+                m_slot[m_pairs[n].x] = NOT_FOUND;
+            return m_n_pairs;
+            }
+
+        private:
+        static constexpr unsigned int NOT_FOUND = 0xffffffff;
+
+        std::vector<unsigned int> m_slot; //!< Entry of each j-cluster in the current i-cluster
+        uint2* m_pairs = nullptr;         //!< Pairs of the current i-cluster
+        size_t m_capacity = 0;            //!< Maximum number of pairs of the current i-cluster
+        unsigned int m_n_pairs = 0;       //!< Number of pairs of the current i-cluster
+        };
+
+    /// True when the cluster pair list should be built
+    bool m_cluster_pairs = false;
+
+    /// True when buildNlist() built the cluster pair list along with the per-particle list
+    bool m_cluster_pairs_built = false;
+
+    GlobalArray<unsigned int> m_cluster_n_pairs; //!< Number of j-clusters per i-cluster
+    GlobalArray<size_t> m_cluster_head_list;     //!< Head list of the cluster pair list
+    GlobalArray<uint2> m_cluster_pair_list;      //!< j-cluster index and interaction mask
+
+    ClusterPairBuilder m_cluster_builder; //!< Scratch space of the serial cluster pair builds
+#ifdef ENABLE_TBB
+    /// Scratch space of the threaded cluster pair builds
+    tbb::enumerable_thread_specific<ClusterPairBuilder> m_thread_cluster_builders;
+#endif
+
+    GlobalArray<uint2> m_pair_list; //!< Local pair list (x: i, y: j)
+    GlobalArray<Scalar3> m_pair_dr; //!< Displacement r_i - r_j of each pair
+    size_t m_n_pairs = 0;           //!< Number of pairs in m_pair_list
+    bool m_pair_list_valid = false; //!< False when the neighbor list changed after the last build
+
+    /// True when the list should be updated incrementally
+    bool m_incremental = false;
+
+    /// Number of consecutive partial updates since the last full rebuild
+    unsigned int m_n_partial_since_full = 0;
+
+    /// Total number of partial updates
+    uint64_t m_partial_updates = 0;
+
     /// True if the number of particles has changed.
     bool m_n_particles_changed = false;
 
@@ -524,6 +797,12 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Performs the distance check
     virtual bool distanceCheck(uint64_t timestep);
 
+    //! Buffer whose half bounds the displacement of particles of a type between updates
+    virtual Scalar getDisplacementBuffer(unsigned int type);
+
+    //! Smallest stretch of the affine deformation from m_last_box to the current global box
+    Scalar getMinimumStretch();
+
     //! Updates the previous position table for use in the next distance check
     virtual void setLastUpdatedPos();
 
@@ -539,9 +818,69 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Checks that box is big enough for neighbor list cutoff
     void checkBoxSize();
 
+    /// Group the particle types into the levels of a multilevel cell list
+    std::vector<Scalar> computeCellLevels(std::vector<unsigned int>& type_level);
+
+    /// Get the stencil radius of each type for searching the particles in one level
+    std::vector<Scalar> computeCellLevelRStencil(const std::vector<unsigned int>& type_level,
+                                                 unsigned int level);
+
     //! Filter the neighbor list of excluded particles
     virtual void filterNlist();
 
+    /// Filter the excluded particles from the neighbor lists of the given particles
+    void filterNlistRows(const unsigned int* rows, unsigned int n_rows);
+
+    /// Whether buildNlist() removes the excluded pairs as it builds the list
+    virtual bool buildFiltersExclusions()
+        {
+        return false;
+        }
+
+    //! Test if particle j is excluded from the neighbor list of the local particle i
+    /*! \param i Index of the local particle
+        \param j Index of the candidate neighbor
+        \param h_n_ex_idx Number of exclusions per particle index
+        \param h_ex_list_idx Excluded particle indices, indexed by m_ex_list_indexer
+
+        Requires that m_exclusions_set is true and that updateExListIdx() has run since the last
+        particle sort.
+    */
+    bool isExcluded(unsigned int i,
+                    unsigned int j,
+                    const unsigned int* h_n_ex_idx,
+                    const unsigned int* h_ex_list_idx) const
+        {
+        if (!(m_ex_mask[i] & (uint64_t(1) << (j % 64))))
+            return false;
+
+        const unsigned int n_ex = h_n_ex_idx[i];
+        for (unsigned int cur_ex_idx = 0; cur_ex_idx < n_ex; cur_ex_idx++)
+            {
+            if (h_ex_list_idx[m_ex_list_indexer(i, cur_ex_idx)] == j)
+                return true;
+            }
+        return false;
+        }
+
+    /// Try to update the list for the displaced particles only
+    bool updateNlistPartial();
+
+    /// Size the cluster pair list to the per-particle list and set the cluster head list
+    void allocateClusterPairs();
+
+    /// Build the cluster pair list from the per-particle neighbor list
+    void buildClusterPairs();
+
+    /// Find the neighbors of every local particle, in parallel when threads are enabled
+    template<class BuildParticle> void buildParticles(const BuildParticle& build_particle);
+
+    /// Build the local pair list from the per-particle neighbor list
+    virtual void buildPairList();
+
+    /// Compute the displacements of the pairs in the local pair list
+    virtual void computePairDisplacements();
+
     //! Build the head list to allocated memory
     virtual void buildHeadList();
 
@@ -584,6 +923,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     uint64_t m_forced_updates;    //!< Number of times the neighbor list has been forcibly updated
     uint64_t m_dangerous_updates; //!< Number of dangerous builds counted
     bool m_force_update;          //!< Flag to handle the forcing of neighborlist updates
+    bool m_compact_requested;     //!< True when the next head list build may shrink m_nlist
     bool m_dist_check;            //!< Set to false to disable distance checks (nlist always built
                                   //!< m_rebuild_check_delay steps)
     bool m_has_been_updated_once; //!< True if the neighbor list has been updated at least once
@@ -665,12 +1005,19 @@ class PYBIND11_EXPORT LocalNeighborListData : public LocalDataAccess<Output, Nei
     public:
     LocalNeighborListData(NeighborList& data, size_t N_particles)
         : LocalDataAccess<Output, NeighborList>(data), m_nlist_handle(), m_head_list_handle(),
-          m_n_neigh_handle(), m_N_particles(N_particles)
+          m_n_neigh_handle(), m_pair_list_handle(), m_pair_dr_handle(), m_N_particles(N_particles)
         {
         }
 
     virtual ~LocalNeighborListData() = default;
 
+    /// Enter the context manager and bring the local pair list up to date
+    void enter()
+        {
+        this->m_data.updatePairList();
+        LocalDataAccess<Output, NeighborList>::enter();
+        }
+
     Output getHeadList()
         {
         // This can cause errors when sizeof(unsigned long) != sizeof(size_t)
@@ -701,6 +1048,30 @@ class PYBIND11_EXPORT LocalNeighborListData : public LocalDataAccess<Output, Nei
                                                                     false);
         }
 
+    Output getPairList()
+        {
+        return this->template getBuffer<uint2, unsigned int>(m_pair_list_handle,
+                                                             &NeighborList::getPairListArray,
+                                                             {this->m_data.getNPairs(), 2},
+                                                             false);
+        }
+
+    Output getPairDisplacements()
+        {
+        if (!m_pair_dr_handle)
+            {
+            this->checkManager();
+            // computing the displacements reads the pair list, so release its handle first. The
+            // pair list is not reallocated and a previously returned buffer stays valid.
+            m_pair_list_handle.reset(nullptr);
+            this->m_data.updatePairDisplacements();
+            }
+        return this->template getBuffer<Scalar3, Scalar>(m_pair_dr_handle,
+                                                         &NeighborList::getPairDisplacementArray,
+                                                         {this->m_data.getNPairs(), 3},
+                                                         false);
+        }
+
     bool isHalfNlist()
         {
         return this->m_data.getStorageMode() == NeighborList::storageMode::half;
@@ -712,12 +1083,16 @@ class PYBIND11_EXPORT LocalNeighborListData : public LocalDataAccess<Output, Nei
         m_head_list_handle.reset(nullptr);
         m_nlist_handle.reset(nullptr);
         m_n_neigh_handle.reset(nullptr);
+        m_pair_list_handle.reset(nullptr);
+        m_pair_dr_handle.reset(nullptr);
         }
 
     private:
     std::unique_ptr<ArrayHandle<unsigned int>> m_nlist_handle;
     std::unique_ptr<ArrayHandle<size_t>> m_head_list_handle;
     std::unique_ptr<ArrayHandle<unsigned int>> m_n_neigh_handle;
+    std::unique_ptr<ArrayHandle<uint2>> m_pair_list_handle;
+    std::unique_ptr<ArrayHandle<Scalar3>> m_pair_dr_handle;
     size_t m_N_particles;
     };
 
@@ -733,12 +1108,98 @@ template<class Output> void export_LocalNeighborListData(pybind11::module& m, st
         .def("getNList", &LocalNeighborListData<Output>::getNList)
         .def("getHeadList", &LocalNeighborListData<Output>::getHeadList)
         .def("getNNeigh", &LocalNeighborListData<Output>::getNNeigh)
+        .def("getPairList", &LocalNeighborListData<Output>::getPairList)
+        .def("getPairDisplacements", &LocalNeighborListData<Output>::getPairDisplacements)
         .def("isHalfNlist", &LocalNeighborListData<Output>::isHalfNlist)
         .def("enter", &LocalNeighborListData<Output>::enter)
         .def("exit", &LocalNeighborListData<Output>::exit);
     };
     } // end namespace detail
 
+/*! \param build_particle Function that finds the neighbors of one particle
+
+    <code>build_particle(i, conditions, cluster_builder)</code> writes the neighbors of the local
+    particle \a i to the per-particle list and records any overflow of Nmax in \a conditions. When
+    \a cluster_builder is not null, it also passes every stored neighbor \a j to
+    <code>cluster_builder->add(i % cluster_size, j)</code>. The particles are then processed one
+    i-cluster at a time, so the cluster pair list is built in the same traversal as the
+    per-particle list.
+*/
+template<class BuildParticle> void NeighborList::buildParticles(const BuildParticle& build_particle)
+    {
+    const unsigned int nparticles = m_pdata->getN();
+    const bool build_clusters = hasClusterPairs();
+    const unsigned int n_items
+        = build_clusters ? (nparticles + cluster_size - 1) / cluster_size : nparticles;
+    const unsigned int n_j_clusters
+        = (nparticles + m_pdata->getNGhosts() + cluster_size - 1) / cluster_size;
+
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_cluster_n_pairs(m_cluster_n_pairs,
+                                                access_location::host,
+                                                access_mode::overwrite);
+    ArrayHandle<size_t> h_cluster_head_list(m_cluster_head_list,
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<uint2> h_cluster_pair_list(m_cluster_pair_list,
+                                           access_location::host,
+                                           access_mode::overwrite);
+
+    // item k is either particle k or i-cluster k
+    auto build_item = [&](unsigned int k, unsigned int* conditions, ClusterPairBuilder& builder)
+        {
+        if (!build_clusters)
+            {
+            build_particle(k, conditions, nullptr);
+            return;
+            }
+
+        builder.begin(h_cluster_pair_list.data, h_cluster_head_list.data, k, n_j_clusters);
+        const unsigned int last = std::min((k + 1) * cluster_size, nparticles);
+        for (unsigned int i = k * cluster_size; i < last; i++)
+            build_particle(i, conditions, &builder);
+        h_cluster_n_pairs.data[k] = builder.end();
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each thread records its own overflow conditions, which are merged below
+        const unsigned int n_types = m_pdata->getNTypes();
+        tbb::enumerable_thread_specific<std::vector<unsigned int>> thread_conditions(n_types, 0);
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, n_items),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      unsigned int* conditions = thread_conditions.local().data();
+                                      ClusterPairBuilder& builder
+                                          = m_thread_cluster_builders.local();
+                                      for (unsigned int k = r.begin(); k != r.end(); ++k)
+                                          build_item(k, conditions, builder);
+                                  });
+            });
+
+        for (const auto& conditions : thread_conditions)
+            {
+            for (unsigned int t = 0; t < n_types; ++t)
+                h_conditions.data[t] = std::max(h_conditions.data[t], conditions[t]);
+            }
+        }
+    else
+#endif
+        {
+        for (unsigned int k = 0; k < n_items; k++)
+            build_item(k, h_conditions.data, m_cluster_builder);
+        }
+
+    m_cluster_pairs_built = build_clusters;
+    }
+
     } // end namespace md
     } // end namespace hoomd
 
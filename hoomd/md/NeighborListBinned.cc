@@ -75,12 +75,15 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // access the neighbor list data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_conditions(m_conditions,
-                                           access_location::host,
-                                           access_mode::readwrite);
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
+    // access the exclusions, which are removed as the list is built
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
     // access indexers
     Index3D ci = m_cl->getCellIndexer();
     Index2D cli = m_cl->getCellListIndexer();
@@ -89,10 +92,10 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // get periodic flags
     uchar3 periodic = box.getPeriodic();
 
-    // for each local particle
-    unsigned int nparticles = m_pdata->getN();
-
-    for (int i = 0; i < (int)nparticles; i++)
+    // find the neighbors of particle i, recording any overflow of Nmax in conditions and passing
+    // the stored neighbors to cluster_builder
+    auto build_particle
+        = [&](unsigned int i, unsigned int* conditions, ClusterPairBuilder* cluster_builder)
         {
         unsigned int cur_n_neigh = 0;
 
@@ -141,7 +144,7 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
                 // (1) they are the same particle, or
                 // (2) the r_cut(i,j) indicates to skip, or
                 // (3) they are in the same body
-                bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
+                bool excluded = ((i == cur_neigh) || (r_cut <= Scalar(0.0)));
                 if (m_filter_body && body_i != NO_BODY)
                     excluded = excluded | (body_i == h_body.data[cur_neigh]);
                 if (excluded)
@@ -156,8 +159,12 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
                 Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
                 if (dr_sq <= r_listsq && !excluded)
                     {
+                    if (m_exclusions_set
+                        && isExcluded(i, cur_neigh, h_n_ex_idx.data, h_ex_list_idx.data))
+                        continue;
+
                     // Add the neighbor index to the list.
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    if (m_storage_mode == full || i < cur_neigh)
                         {
                         // local neighbor
                         if (cur_n_neigh < Nmax_i)
@@ -165,8 +172,10 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
                             h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
                             }
                         else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
+                            conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+                        if (cluster_builder)
+                            cluster_builder->add(i % cluster_size, cur_neigh);
 
                         cur_n_neigh++;
                         }
@@ -175,7 +184,9 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
             }
 
         h_n_neigh.data[i] = cur_n_neigh;
-        }
+        };
+
+    buildParticles(build_particle);
     }
 
 namespace detail
@@ -66,6 +66,13 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
         return m_cl->getNmax();
         }
 
+    /// Release neighbor list and cell list capacity that exceeds the current needs
+    virtual void compactMemory()
+        {
+        NeighborList::compactMemory();
+        m_cl->compactMemory();
+        }
+
     protected:
     std::shared_ptr<CellList> m_cl; //!< The cell list
 
@@ -74,6 +81,12 @@ class PYBIND11_EXPORT NeighborListBinned : public NeighborList
 
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
+
+    /// The build removes the excluded pairs
+    virtual bool buildFiltersExclusions()
+        {
+        return true;
+        }
     };
 
     } // end namespace md
@@ -40,13 +40,8 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
     BoxDim box = m_pdata->getBox();
     ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::read);
 
-    // get current global nearest plane distance
-    Scalar3 L_g = m_pdata->getGlobalBox().getNearestPlaneDistance();
-
-    // Find direction of maximum box length contraction (smallest eigenvalue of deformation tensor)
-    Scalar3 lambda = L_g / m_last_L;
-    Scalar lambda_min = (lambda.x < lambda.y) ? lambda.x : lambda.y;
-    lambda_min = (lambda_min < lambda.z) ? lambda_min : lambda.z;
+    // the box deformation since the last update shrinks distances by at most lambda_min
+    const Scalar lambda_min = getMinimumStretch();
 
     ArrayHandle<Scalar> d_rcut_max(m_rcut_max, access_location::device, access_mode::read);
 
@@ -64,7 +59,8 @@ bool NeighborListGPU::distanceCheck(uint64_t timestep)
                                                  m_r_buff,
                                                  m_pdata->getNTypes(),
                                                  lambda_min,
-                                                 lambda,
+                                                 m_last_box,
+                                                 m_pdata->getGlobalBox(),
                                                  ++m_checkn,
                                                  m_pdata->getGPUPartition());
 
@@ -220,6 +216,112 @@ void NeighborListGPU::buildHeadList()
     updateMemoryMapping();
     }
 
+void NeighborListGPU::buildPairList()
+    {
+    const unsigned int N = m_pdata->getN();
+    if (m_pair_head.getNumElements() < N)
+        {
+        GlobalArray<size_t> pair_head(N, m_exec_conf);
+        m_pair_head.swap(pair_head);
+        TAG_ALLOCATION(m_pair_head);
+        }
+    if (m_n_pairs_flag.isNull())
+        {
+        GlobalArray<size_t> n_pairs_flag(1, m_exec_conf);
+        m_n_pairs_flag.swap(n_pairs_flag);
+        TAG_ALLOCATION(m_n_pairs_flag);
+        }
+
+    if (!N)
+        {
+        m_n_pairs = 0;
+        return;
+        }
+
+    const bool third_law = getStorageMode() == NeighborList::half;
+
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+
+        {
+        ArrayHandle<size_t> d_pair_head(m_pair_head,
+                                        access_location::device,
+                                        access_mode::overwrite);
+        ArrayHandle<size_t> d_n_pairs_flag(m_n_pairs_flag,
+                                           access_location::device,
+                                           access_mode::overwrite);
+
+        kernel::gpu_nlist_count_pairs(d_pair_head.data,
+                                      d_n_pairs_flag.data,
+                                      d_n_neigh.data,
+                                      d_nlist.data,
+                                      d_head_list.data,
+                                      N,
+                                      third_law,
+                                      128);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
+
+    // the only host synchronization, needed to size the pair list
+        {
+        ArrayHandle<size_t> h_n_pairs_flag(m_n_pairs_flag,
+                                           access_location::host,
+                                           access_mode::read);
+        m_n_pairs = *h_n_pairs_flag.data;
+        }
+
+    if (m_pair_list.getNumElements() < m_n_pairs)
+        {
+        GlobalArray<uint2> pair_list(m_n_pairs, m_exec_conf);
+        m_pair_list.swap(pair_list);
+        TAG_ALLOCATION(m_pair_list);
+        }
+
+    ArrayHandle<size_t> d_pair_head(m_pair_head, access_location::device, access_mode::read);
+    ArrayHandle<uint2> d_pair_list(m_pair_list, access_location::device, access_mode::overwrite);
+
+    kernel::gpu_nlist_fill_pairs(d_pair_list.data,
+                                 d_pair_head.data,
+                                 d_n_neigh.data,
+                                 d_nlist.data,
+                                 d_head_list.data,
+                                 N,
+                                 third_law,
+                                 128);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+void NeighborListGPU::computePairDisplacements()
+    {
+    if (m_pair_dr.getNumElements() < m_n_pairs)
+        {
+        GlobalArray<Scalar3> pair_dr(m_pair_list.getNumElements(), m_exec_conf);
+        m_pair_dr.swap(pair_dr);
+        TAG_ALLOCATION(m_pair_dr);
+        }
+
+    if (!m_n_pairs)
+        {
+        return;
+        }
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<uint2> d_pair_list(m_pair_list, access_location::device, access_mode::read);
+    ArrayHandle<Scalar3> d_pair_dr(m_pair_dr, access_location::device, access_mode::overwrite);
+
+    kernel::gpu_nlist_pair_displacements(d_pair_dr.data,
+                                         d_pair_list.data,
+                                         d_pos.data,
+                                         m_pdata->getBox(),
+                                         m_n_pairs,
+                                         256);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
 namespace detail
     {
 void export_NeighborListGPU(pybind11::module& m)
@@ -32,7 +32,8 @@ namespace kernel
     \param r_buff The buffer size that particles can move in
     \param ntypes The number of particle types
     \param lambda_min Minimum contraction of deformation tensor
-    \param lambda Diagonal deformation tensor (for orthorhombic boundaries)
+    \param last_box Global box at the time the nlist was last updated
+    \param global_box Current global box
     \param checkn
 
     gpu_nlist_needs_update_check_new_kernel() executes one thread per particle. Every particle's
@@ -48,7 +49,8 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
                                                         const Scalar r_buff,
                                                         const unsigned int ntypes,
                                                         const Scalar lambda_min,
-                                                        const Scalar3 lambda,
+                                                        const BoxDim last_box,
+                                                        const BoxDim global_box,
                                                         const unsigned int checkn,
                                                         const unsigned int offset)
     {
@@ -66,7 +68,8 @@ __global__ void gpu_nlist_needs_update_check_new_kernel(unsigned int* d_result,
         Scalar4 last_postype = d_last_pos[idx];
         Scalar3 last_pos = make_scalar3(last_postype.x, last_postype.y, last_postype.z);
 
-        Scalar3 dx = cur_pos - lambda * last_pos;
+        // displacement relative to the affinely deformed reference position
+        Scalar3 dx = cur_pos - global_box.makeCoordinates(last_box.makeFraction(last_pos));
         dx = box.minImage(dx);
 
         const Scalar rmin = __ldg(d_rcut_max + cur_type);
@@ -92,7 +95,8 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                                             const Scalar r_buff,
                                             const unsigned int ntypes,
                                             const Scalar lambda_min,
-                                            const Scalar3 lambda,
+                                            const BoxDim& last_box,
+                                            const BoxDim& global_box,
                                             const unsigned int checkn,
                                             const GPUPartition& gpu_partition)
     {
@@ -119,7 +123,8 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                            r_buff,
                            ntypes,
                            lambda_min,
-                           lambda,
+                           last_box,
+                           global_box,
                            checkn,
                            range.first);
         }
@@ -455,6 +460,272 @@ hipError_t gpu_nlist_build_head_list(size_t* d_head_list,
     return hipSuccess;
     }
 
+/*! \param d_pair_head Number of pairs of each particle (output)
+ * \param d_n_pairs Number of pairs of the last particle (output)
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Head list of the neighbor list
+ * \param N the number of particles on this rank
+ * \param third_law True when the neighbor list is stored in half mode
+ *
+ * In full mode, a pair of two local particles i > j is not counted for i because the pair (j, i)
+ * is counted for j.
+ */
+__global__ void gpu_nlist_count_pairs_kernel(size_t* d_pair_head,
+                                             size_t* d_n_pairs,
+                                             const unsigned int* d_n_neigh,
+                                             const unsigned int* d_nlist,
+                                             const size_t* d_head_list,
+                                             const unsigned int N,
+                                             const bool third_law)
+    {
+    // particle index
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    // one thread per particle
+    if (idx >= N)
+        return;
+
+    const size_t my_head = d_head_list[idx];
+    const unsigned int n_neigh = d_n_neigh[idx];
+
+    size_t n_pairs = n_neigh;
+    if (!third_law)
+        {
+        n_pairs = 0;
+        for (unsigned int k = 0; k < n_neigh; ++k)
+            {
+            const unsigned int j = d_nlist[my_head + k];
+            if (j >= N || idx < j)
+                ++n_pairs;
+            }
+        }
+
+    d_pair_head[idx] = n_pairs;
+
+    // last thread presets its number of pairs in the total as well
+    if (idx == (N - 1))
+        {
+        *d_n_pairs = n_pairs;
+        }
+    }
+
+/*! \param d_n_pairs Total number of pairs
+ * \param d_pair_head Scanned pair head list
+ * \param N the number of particles on this rank
+ */
+__global__ void
+gpu_nlist_get_n_pairs_kernel(size_t* d_n_pairs, const size_t* d_pair_head, const unsigned int N)
+    {
+    *d_n_pairs += d_pair_head[N - 1];
+    }
+
+/*! \param d_pair_head Index of the first pair of each particle (output)
+ * \param d_n_pairs Total number of pairs (output)
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Head list of the neighbor list
+ * \param N the number of particles on this rank
+ * \param third_law True when the neighbor list is stored in half mode
+ * \param block_size Number of threads per block for gpu_nlist_count_pairs_kernel()
+ *
+ * \return hipSuccess on completion
+ *
+ * \b Implementation
+ * The pairs of each particle are counted, then an exclusive prefix sum is performed in place on
+ * \a d_pair_head. As in gpu_nlist_build_head_list(), a single thread completes the total on the
+ * device.
+ */
+hipError_t gpu_nlist_count_pairs(size_t* d_pair_head,
+                                 size_t* d_n_pairs,
+                                 const unsigned int* d_n_neigh,
+                                 const unsigned int* d_nlist,
+                                 const size_t* d_head_list,
+                                 const unsigned int N,
+                                 const bool third_law,
+                                 const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_count_pairs_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_nlist_count_pairs_kernel),
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_pair_head,
+                       d_n_pairs,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N,
+                       third_law);
+
+    thrust::device_ptr<size_t> t_pair_head = thrust::device_pointer_cast(d_pair_head);
+    thrust::exclusive_scan(t_pair_head, t_pair_head + N, t_pair_head);
+
+    hipLaunchKernelGGL((gpu_nlist_get_n_pairs_kernel),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       0,
+                       d_n_pairs,
+                       d_pair_head,
+                       N);
+
+    return hipSuccess;
+    }
+
+/*! \param d_pair_list Local pair list (output)
+ * \param d_pair_head Index of the first pair of each particle
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Head list of the neighbor list
+ * \param N the number of particles on this rank
+ * \param third_law True when the neighbor list is stored in half mode
+ *
+ * The pairs of each particle are written in the order of its neighbor list, matching the pair list
+ * built on the host.
+ */
+__global__ void gpu_nlist_fill_pairs_kernel(uint2* d_pair_list,
+                                            const size_t* d_pair_head,
+                                            const unsigned int* d_n_neigh,
+                                            const unsigned int* d_nlist,
+                                            const size_t* d_head_list,
+                                            const unsigned int N,
+                                            const bool third_law)
+    {
+    // particle index
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+
+    // one thread per particle
+    if (idx >= N)
+        return;
+
+    const size_t my_head = d_head_list[idx];
+    const unsigned int n_neigh = d_n_neigh[idx];
+    size_t pair_idx = d_pair_head[idx];
+
+    for (unsigned int k = 0; k < n_neigh; ++k)
+        {
+        const unsigned int j = d_nlist[my_head + k];
+        if (!third_law && j < N && idx > j)
+            continue;
+
+        d_pair_list[pair_idx++] = make_uint2(idx, j);
+        }
+    }
+
+/*! \param d_pair_list Local pair list (output)
+ * \param d_pair_head Index of the first pair of each particle
+ * \param d_n_neigh Number of neighbors of each particle
+ * \param d_nlist Neighbor list
+ * \param d_head_list Head list of the neighbor list
+ * \param N the number of particles on this rank
+ * \param third_law True when the neighbor list is stored in half mode
+ * \param block_size Number of threads per block
+ *
+ * \return hipSuccess on completion
+ */
+hipError_t gpu_nlist_fill_pairs(uint2* d_pair_list,
+                                const size_t* d_pair_head,
+                                const unsigned int* d_n_neigh,
+                                const unsigned int* d_nlist,
+                                const size_t* d_head_list,
+                                const unsigned int N,
+                                const bool third_law,
+                                const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_fill_pairs_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_nlist_fill_pairs_kernel),
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_pair_list,
+                       d_pair_head,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N,
+                       third_law);
+
+    return hipSuccess;
+    }
+
+/*! \param d_pair_dr Displacement r_i - r_j of each pair (output)
+ * \param d_pair_list Local pair list
+ * \param d_pos Particle positions
+ * \param box Local box
+ * \param n_pairs Number of pairs
+ */
+__global__ void gpu_nlist_pair_displacements_kernel(Scalar3* d_pair_dr,
+                                                    const uint2* d_pair_list,
+                                                    const Scalar4* d_pos,
+                                                    const BoxDim box,
+                                                    const size_t n_pairs)
+    {
+    // pair index
+    const size_t idx = size_t(blockDim.x) * blockIdx.x + threadIdx.x;
+
+    // one thread per pair
+    if (idx >= n_pairs)
+        return;
+
+    const uint2 pair = d_pair_list[idx];
+    const Scalar4 pos_i = d_pos[pair.x];
+    const Scalar4 pos_j = d_pos[pair.y];
+    Scalar3 dr = make_scalar3(pos_i.x - pos_j.x, pos_i.y - pos_j.y, pos_i.z - pos_j.z);
+    d_pair_dr[idx] = box.minImage(dr);
+    }
+
+/*! \param d_pair_dr Displacement r_i - r_j of each pair (output)
+ * \param d_pair_list Local pair list
+ * \param d_pos Particle positions
+ * \param box Local box
+ * \param n_pairs Number of pairs
+ * \param block_size Number of threads per block
+ *
+ * \return hipSuccess on completion
+ */
+hipError_t gpu_nlist_pair_displacements(Scalar3* d_pair_dr,
+                                        const uint2* d_pair_list,
+                                        const Scalar4* d_pos,
+                                        const BoxDim& box,
+                                        const size_t n_pairs,
+                                        const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_nlist_pair_displacements_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_nlist_pair_displacements_kernel),
+                       dim3(static_cast<unsigned int>(n_pairs / run_block_size + 1)),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_pair_dr,
+                       d_pair_list,
+                       d_pos,
+                       box,
+                       n_pairs);
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
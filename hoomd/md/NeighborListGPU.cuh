@@ -31,7 +31,8 @@ hipError_t gpu_nlist_needs_update_check_new(unsigned int* d_result,
                                             const Scalar r_buff,
                                             const unsigned int ntypes,
                                             const Scalar lambda_min,
-                                            const Scalar3 lambda,
+                                            const BoxDim& last_box,
+                                            const BoxDim& global_box,
                                             const unsigned int checkn,
                                             const GPUPartition& gpu_partition);
 
@@ -65,6 +66,34 @@ hipError_t gpu_update_exclusion_list(const unsigned int* d_tag,
                                      const Index2D& ex_list_indexer,
                                      const unsigned int N);
 
+//! Kernel driver to count the pairs of each particle and the total number of local pairs
+hipError_t gpu_nlist_count_pairs(size_t* d_pair_head,
+                                 size_t* d_n_pairs,
+                                 const unsigned int* d_n_neigh,
+                                 const unsigned int* d_nlist,
+                                 const size_t* d_head_list,
+                                 const unsigned int N,
+                                 const bool third_law,
+                                 const unsigned int block_size);
+
+//! Kernel driver to write the local pair list
+hipError_t gpu_nlist_fill_pairs(uint2* d_pair_list,
+                                const size_t* d_pair_head,
+                                const unsigned int* d_n_neigh,
+                                const unsigned int* d_nlist,
+                                const size_t* d_head_list,
+                                const unsigned int N,
+                                const bool third_law,
+                                const unsigned int block_size);
+
+//! Kernel driver to compute the displacements of the local pairs
+hipError_t gpu_nlist_pair_displacements(Scalar3* d_pair_dr,
+                                        const uint2* d_pair_list,
+                                        const Scalar4* d_pos,
+                                        const BoxDim& box,
+                                        const size_t n_pairs,
+                                        const unsigned int block_size);
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
@@ -108,12 +108,19 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
     //! Perform the nlist distance check on the GPU
     virtual bool distanceCheck(uint64_t timestep);
 
+    //! The GPU distance check limits the displacement of all types to half of r_buff
+    virtual Scalar getDisplacementBuffer(unsigned int type)
+        {
+        return m_r_buff;
+        }
+
     //! GPU nlists set their last updated pos in the compute kernel, this call only resets the last
-    //! box length
+    //! box
     virtual void setLastUpdatedPos()
         {
         m_last_L = m_pdata->getGlobalBox().getNearestPlaneDistance();
         m_last_L_local = m_pdata->getBox().getNearestPlaneDistance();
+        m_last_box = m_pdata->getGlobalBox();
         }
 
     //! Filter the neighbor list of excluded particles
@@ -122,6 +129,12 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
     //! Build the head list for neighbor list indexing on the GPU
     virtual void buildHeadList();
 
+    /// Build the local pair list on the GPU
+    virtual void buildPairList();
+
+    /// Compute the displacements of the pairs in the local pair list on the GPU
+    virtual void computePairDisplacements();
+
     //! Schedule the distance check kernel
     /*! \param timestep Current time step
      */
@@ -133,6 +146,9 @@ class PYBIND11_EXPORT NeighborListGPU : public NeighborList
 
     GlobalArray<unsigned int>
         m_alt_head_list; //!< Alternate array to hold the head list from prefix sum
+
+    GlobalArray<size_t> m_pair_head;    //!< Index of the first pair of each particle
+    GlobalArray<size_t> m_n_pairs_flag; //!< Total number of pairs computed on the device
     };
 
     } // end namespace md
@@ -35,12 +35,27 @@ NeighborListGPUBinned::NeighborListGPUBinned(std::shared_ptr<SystemDefinition> s
 
     CHECK_CUDA_ERROR();
 
-    // Initialize autotuner.
-    m_tuner.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
-                                    AutotunerBase::getTppListPow2(m_exec_conf)},
+    // Initialize autotuner. The third parameter selects the tiled kernel, which reads the
+    // particle data from the cell list and ignores the threads per particle.
+    std::vector<unsigned int> tiled_range = {0};
+    if (!m_use_index)
+        {
+        tiled_range.push_back(1);
+        }
+
+    m_tuner.reset(new Autotuner<3>({AutotunerBase::makeBlockSizeRange(m_exec_conf),
+                                    AutotunerBase::getTppListPow2(m_exec_conf),
+                                    tiled_range},
                                    m_exec_conf,
                                    "nlist_binned",
-                                   3));
+                                   3,
+                                   false,
+                                   [](const std::array<unsigned int, 3>& parameter) -> bool
+                                   {
+                                       unsigned int threads_per_particle = parameter[1];
+                                       unsigned int tiled = parameter[2];
+                                       return !tiled || threads_per_particle == 1;
+                                   }));
     m_autotuners.push_back(m_tuner);
     }
 
@@ -141,6 +156,7 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
     auto param = m_tuner->getParam();
     unsigned int block_size = param[0];
     unsigned int threads_per_particle = param[1];
+    bool tiled = param[2];
 
     kernel::gpu_compute_nlist_binned(
         d_nlist.data,
@@ -170,6 +186,7 @@ void NeighborListGPUBinned::buildNlist(uint64_t timestep)
         m_cl->getGhostWidth(),
         m_pdata->getGPUPartition(),
         m_use_index,
+        tiled,
         m_exec_conf->dev_prop);
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
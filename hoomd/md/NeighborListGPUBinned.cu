@@ -9,6 +9,8 @@
 #include "hoomd/TextureTools.h"
 #include "hoomd/WarpTools.cuh"
 
+#include <cassert>
+
 /*! \file NeighborListGPUBinned.cu
     \brief Defines GPU kernel code for O(N) neighbor list generation on the GPU
 */
@@ -297,6 +299,191 @@ __global__ void gpu_compute_nlist_binned_kernel(unsigned int* d_nlist,
         }
     }
 
+//! Kernel call for generating neighbor list on the GPU, staging neighbor cells in shared memory
+/*! \tparam filter_body true when body filtering is enabled.
+    \tparam enable_shared_cache true when the r_list parameters are cached in shared memory.
+    \param d_nlist Neighbor list data structure to write
+    \param d_n_neigh Number of neighbors to write
+    \param d_last_updated_pos Particle positions at this update are written to this array
+    \param d_conditions Conditions array for writing overflow condition
+    \param d_Nmax Maximum number of neighbors per type
+    \param d_head_list List of indexes to access \a d_nlist
+    \param d_pos Particle positions
+    \param N Number of particles
+    \param d_cell_size Number of particles in each cell
+    \param d_cell_xyzf Cell contents (xyzf array from CellList with flag=index)
+    \param d_cell_type_body Cell contents (TypeBody array from CellList)
+    \param d_cell_adj Cell adjacency list
+    \param cli Cell list indexer for indexing into d_cell_xyzf
+    \param cadji Adjacent cell indexer listing the 27 neighboring cells
+    \param box Simulation box dimensions
+    \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+    \param r_buff The maximum radius for which to include particles as neighbors
+    \param ntypes Number of particle types
+
+    Each block processes the particles of one home cell, one thread per particle. The block
+    cooperatively loads each adjacent cell in tiles of blockDim.x particles into shared memory, and
+    every thread then tests its particle against the whole tile. Each neighbor cell entry is read
+    from global memory once per home cell instead of once per home particle.
+*/
+template<unsigned char filter_body, unsigned char enable_shared_cache>
+__global__ void gpu_compute_nlist_binned_tiled_kernel(unsigned int* d_nlist,
+                                                      unsigned int* d_n_neigh,
+                                                      Scalar4* d_last_updated_pos,
+                                                      unsigned int* d_conditions,
+                                                      const unsigned int* d_Nmax,
+                                                      const size_t* d_head_list,
+                                                      const Scalar4* d_pos,
+                                                      const unsigned int N,
+                                                      const unsigned int* d_cell_size,
+                                                      const Scalar4* d_cell_xyzf,
+                                                      const uint2* d_cell_type_body,
+                                                      const unsigned int* d_cell_adj,
+                                                      const Index2D cli,
+                                                      const Index2D cadji,
+                                                      const BoxDim box,
+                                                      const Scalar* d_r_cut,
+                                                      const Scalar r_buff,
+                                                      const unsigned int ntypes)
+    {
+    Index2D typpair_idx(ntypes);
+    const unsigned int num_typ_parameters = typpair_idx.getNumElements();
+
+    // shared data for per type pair parameters, followed by the tile of neighbor cell entries
+    HIP_DYNAMIC_SHARED(unsigned char, s_data)
+
+    Scalar* s_r_list = (Scalar*)(&s_data[0]);
+    size_t tile_offset = 0;
+    if (enable_shared_cache)
+        {
+        tile_offset = num_typ_parameters * sizeof(Scalar);
+        tile_offset = (tile_offset + sizeof(Scalar4) - 1) / sizeof(Scalar4) * sizeof(Scalar4);
+        }
+    Scalar4* s_xyzf = (Scalar4*)(&s_data[tile_offset]);
+    uint2* s_type_body = (uint2*)(&s_data[tile_offset + blockDim.x * sizeof(Scalar4)]);
+
+    if (enable_shared_cache)
+        {
+        for (unsigned int cur_offset = 0; cur_offset < num_typ_parameters; cur_offset += blockDim.x)
+            {
+            if (cur_offset + threadIdx.x < num_typ_parameters)
+                {
+                Scalar r_cut = d_r_cut[cur_offset + threadIdx.x];
+                // force the r_list(i,j) to a skippable value if r_cut(i,j) is skippable
+                s_r_list[cur_offset + threadIdx.x]
+                    = (r_cut > Scalar(0.0)) ? r_cut + r_buff : Scalar(-1.0);
+                }
+            }
+        __syncthreads();
+        }
+
+    const unsigned int home_cell = blockIdx.x;
+    const unsigned int home_size = d_cell_size[home_cell];
+
+    // all loop bounds below are uniform across the block, so every thread reaches __syncthreads()
+    for (unsigned int home_base = 0; home_base < home_size; home_base += blockDim.x)
+        {
+        const unsigned int home_offset = home_base + threadIdx.x;
+
+        // ghost particles are binned too, but get no neighbor list
+        bool active = false;
+        unsigned int my_pidx = 0;
+        Scalar4 my_postype = make_scalar4(0, 0, 0, 0);
+        unsigned int my_type = 0;
+        unsigned int my_body = 0;
+        size_t my_head = 0;
+        unsigned int my_n_max = 0;
+        if (home_offset < home_size)
+            {
+            my_pidx = __scalar_as_int(d_cell_xyzf[cli(home_offset, home_cell)].w);
+            if (my_pidx < N)
+                {
+                active = true;
+                my_postype = d_pos[my_pidx];
+                uint2 my_type_body = d_cell_type_body[cli(home_offset, home_cell)];
+                my_type = my_type_body.x;
+                my_body = my_type_body.y;
+                my_head = d_head_list[my_pidx];
+                my_n_max = __ldg(d_Nmax + my_type);
+                }
+            }
+        const Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
+
+        unsigned int nneigh = 0;
+
+        for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); ++cur_adj)
+            {
+            const unsigned int neigh_cell = __ldg(d_cell_adj + cadji(cur_adj, home_cell));
+            const unsigned int neigh_size = __ldg(d_cell_size + neigh_cell);
+
+            for (unsigned int tile_base = 0; tile_base < neigh_size; tile_base += blockDim.x)
+                {
+                // wait until all threads are done with the previous tile
+                __syncthreads();
+                if (tile_base + threadIdx.x < neigh_size)
+                    {
+                    s_xyzf[threadIdx.x]
+                        = __ldg(d_cell_xyzf + cli(tile_base + threadIdx.x, neigh_cell));
+                    s_type_body[threadIdx.x]
+                        = __ldg(d_cell_type_body + cli(tile_base + threadIdx.x, neigh_cell));
+                    }
+                __syncthreads();
+
+                if (!active)
+                    continue;
+
+                const unsigned int tile_size = min(blockDim.x, neigh_size - tile_base);
+                for (unsigned int k = 0; k < tile_size; ++k)
+                    {
+                    const uint2 cur_type_body = s_type_body[k];
+
+                    Scalar r_list;
+                    if (enable_shared_cache)
+                        {
+                        r_list = s_r_list[typpair_idx(my_type, cur_type_body.x)];
+                        }
+                    else
+                        {
+                        Scalar r_cut = d_r_cut[typpair_idx(my_type, cur_type_body.x)];
+                        r_list = (r_cut > Scalar(0.0)) ? r_cut + r_buff : Scalar(-1.0);
+                        }
+
+                    if (r_list <= Scalar(0.0))
+                        continue;
+
+                    const Scalar4 cur_xyzf = s_xyzf[k];
+                    const unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+
+                    Scalar3 dx = my_pos - make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                    dx = box.minImage(dx);
+                    Scalar drsq = dot(dx, dx);
+
+                    bool excluded = (my_pidx == cur_neigh);
+                    if (filter_body && my_body != 0xffffffff)
+                        excluded = excluded | (my_body == cur_type_body.y);
+
+                    if (drsq <= r_list * r_list && !excluded)
+                        {
+                        if (nneigh < my_n_max)
+                            d_nlist[my_head + nneigh] = cur_neigh;
+                        nneigh++;
+                        }
+                    }
+                }
+            }
+
+        if (active)
+            {
+            // flag if we need to grow the neighbor list
+            if (nneigh >= my_n_max)
+                atomicMax(&d_conditions[my_type], nneigh);
+
+            d_n_neigh[my_pidx] = nneigh;
+            d_last_updated_pos[my_pidx] = my_postype;
+            }
+        }
+    }
+
 //! determine maximum possible block size
 template<typename T> int get_max_block_size(T func)
     {
@@ -753,6 +940,71 @@ inline void launcher<min_threads_per_particle / 2>(unsigned int* d_nlist,
     {
     }
 
+//! Arguments of the tiled neighbor list kernel
+struct nlist_binned_tiled_args_t
+    {
+    unsigned int* d_nlist;
+    unsigned int* d_n_neigh;
+    Scalar4* d_last_updated_pos;
+    unsigned int* d_conditions;
+    const unsigned int* d_Nmax;
+    const size_t* d_head_list;
+    const Scalar4* d_pos;
+    unsigned int N;
+    const unsigned int* d_cell_size;
+    const Scalar4* d_cell_xyzf;
+    const uint2* d_cell_type_body;
+    const unsigned int* d_cell_adj;
+    Index3D ci;
+    Index2D cli;
+    Index2D cadji;
+    BoxDim box;
+    const Scalar* d_r_cut;
+    Scalar r_buff;
+    unsigned int ntypes;
+    };
+
+//! Launch the tiled neighbor list kernel with the given template parameters
+/*! \param args Kernel arguments
+    \param block_size Number of threads per block
+    \param r_list_size Bytes of shared memory for the r_list parameters, padded to a Scalar4
+*/
+template<unsigned char filter_body, unsigned char enable_shared_cache>
+inline void launch_tiled(const nlist_binned_tiled_args_t& args,
+                         unsigned int block_size,
+                         size_t r_list_size)
+    {
+    unsigned int max_block_size = get_max_block_size(
+        gpu_compute_nlist_binned_tiled_kernel<filter_body, enable_shared_cache>);
+    block_size = block_size < max_block_size ? block_size : max_block_size;
+
+    size_t shared_size = r_list_size + block_size * (sizeof(Scalar4) + sizeof(uint2));
+
+    hipLaunchKernelGGL((gpu_compute_nlist_binned_tiled_kernel<filter_body, enable_shared_cache>),
+                       dim3(args.ci.getNumElements()),
+                       dim3(block_size),
+                       shared_size,
+                       0,
+                       args.d_nlist,
+                       args.d_n_neigh,
+                       args.d_last_updated_pos,
+                       args.d_conditions,
+                       args.d_Nmax,
+                       args.d_head_list,
+                       args.d_pos,
+                       args.N,
+                       args.d_cell_size,
+                       args.d_cell_xyzf,
+                       args.d_cell_type_body,
+                       args.d_cell_adj,
+                       args.cli,
+                       args.cadji,
+                       args.box,
+                       args.d_r_cut,
+                       args.r_buff,
+                       args.ntypes);
+    }
+
 hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     unsigned int* d_n_neigh,
                                     Scalar4* d_last_updated_pos,
@@ -780,10 +1032,53 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const Scalar3& ghost_width,
                                     const GPUPartition& gpu_partition,
                                     bool use_index,
+                                    bool tiled,
                                     const hipDeviceProp_t& devprop)
     {
     unsigned int ngpu = gpu_partition.getNumActiveGPUs();
 
+    if (tiled)
+        {
+        // the tiled kernel reads the particle data from the cell list of a single device
+        assert(!use_index && ngpu == 1);
+
+        Index2D typpair_idx(ntypes);
+        size_t r_list_size = sizeof(Scalar) * typpair_idx.getNumElements();
+        r_list_size = (r_list_size + sizeof(Scalar4) - 1) / sizeof(Scalar4) * sizeof(Scalar4);
+        size_t tile_size = block_size * (sizeof(Scalar4) + sizeof(uint2));
+        bool enable_shared = r_list_size + tile_size <= devprop.sharedMemPerBlock;
+
+        const nlist_binned_tiled_args_t args = {d_nlist,
+                                                d_n_neigh,
+                                                d_last_updated_pos,
+                                                d_conditions,
+                                                d_Nmax,
+                                                d_head_list,
+                                                d_pos,
+                                                N,
+                                                d_cell_size,
+                                                d_cell_xyzf,
+                                                d_cell_type_body,
+                                                d_cell_adj,
+                                                ci,
+                                                cli,
+                                                cadji,
+                                                box,
+                                                d_r_cut,
+                                                r_buff,
+                                                ntypes};
+
+        if (!filter_body && !enable_shared)
+            launch_tiled<0, 0>(args, block_size, 0);
+        else if (filter_body && !enable_shared)
+            launch_tiled<1, 0>(args, block_size, 0);
+        else if (!filter_body && enable_shared)
+            launch_tiled<0, 1>(args, block_size, r_list_size);
+        else
+            launch_tiled<1, 1>(args, block_size, r_list_size);
+        return hipSuccess;
+        }
+
     // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
     for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
         {
@@ -31,7 +31,11 @@ namespace kernel
 const unsigned int min_threads_per_particle = 1;
 const unsigned int max_threads_per_particle = WARP_SIZE;
 
-//! Kernel driver for gpu_compute_nlist_kernel()
+//! Kernel driver for gpu_compute_nlist_binned_kernel() and its tiled variant
+/*! When \a tiled is true, gpu_compute_nlist_binned_tiled_kernel() builds the list one home cell
+    per block and ignores \a threads_per_particle. The tiled kernel requires \a use_index to be
+    false and a single GPU.
+*/
 hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     unsigned int* d_n_neigh,
                                     Scalar4* d_last_updated_pos,
@@ -59,6 +63,7 @@ hipError_t gpu_compute_nlist_binned(unsigned int* d_nlist,
                                     const Scalar3& ghost_width,
                                     const GPUPartition& gpu_partition,
                                     bool use_index,
+                                    bool tiled,
                                     const hipDeviceProp_t& devprop);
 
     } // end namespace kernel
@@ -70,6 +70,13 @@ class PYBIND11_EXPORT NeighborListGPUBinned : public NeighborListGPU
         return m_cl->getNmax();
         }
 
+    /// Release neighbor list and cell list capacity that exceeds the current needs
+    virtual void compactMemory()
+        {
+        NeighborListGPU::compactMemory();
+        m_cl->compactMemory();
+        }
+
     /// Start autotuning kernel launch parameters
     virtual void startAutotuning()
         {
@@ -94,7 +101,8 @@ class PYBIND11_EXPORT NeighborListGPUBinned : public NeighborListGPU
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
-    std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
+    /// Autotuner for block size, threads per particle, and the tiled kernel
+    std::shared_ptr<Autotuner<3>> m_tuner;
 
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
@@ -0,0 +1,154 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListGPUInner.cc
+    \brief Defines NeighborListGPUInner
+*/
+
+#include "NeighborListGPUInner.h"
+#include "NeighborListGPUInner.cuh"
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListGPUInner::NeighborListGPUInner(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<NeighborList> outer,
+                                           Scalar r_buff)
+    : NeighborListGPU(sysdef, r_buff), m_outer(outer)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListGPUInner" << std::endl;
+
+    if (!m_outer)
+        {
+        throw std::invalid_argument("NeighborListGPUInner requires an outer neighbor list.");
+        }
+
+    m_outer_r_cut = std::make_shared<GlobalArray<Scalar>>(m_typpair_idx.getNumElements(),
+                                                          m_exec_conf);
+    TAG_ALLOCATION(*m_outer_r_cut);
+    m_outer->addRCutMatrix(m_outer_r_cut);
+    updateOuterRCut();
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "nlist_inner"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+NeighborListGPUInner::~NeighborListGPUInner()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListGPUInner" << std::endl;
+
+    m_outer->removeRCutMatrix(m_outer_r_cut);
+    m_outer->notifyRCutMatrixChange();
+    }
+
+/*! The outer list must find every pair within r_list(i,j) = r_cut(i,j) + r_buff of the inner list.
+ */
+void NeighborListGPUInner::updateOuterRCut()
+    {
+    updateRList();
+
+        {
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_outer_r_cut(*m_outer_r_cut,
+                                          access_location::host,
+                                          access_mode::overwrite);
+
+        for (unsigned int cur_pair = 0; cur_pair < m_typpair_idx.getNumElements(); ++cur_pair)
+            {
+            const Scalar r_cut = h_r_cut.data[cur_pair];
+            h_outer_r_cut.data[cur_pair] = (r_cut > Scalar(0.0)) ? r_cut + m_r_buff : Scalar(0.0);
+            }
+        }
+
+    m_outer->notifyRCutMatrixChange();
+    }
+
+void NeighborListGPUInner::buildNlist(uint64_t timestep)
+    {
+    if (m_storage_mode != full)
+        {
+        throw std::runtime_error("GPU neighbor lists require a full storage mode.");
+        }
+
+    // the outer list rebuilds itself when its own buffer is exhausted
+    m_outer->compute(timestep);
+
+    if (m_outer->getStorageMode() != NeighborList::full)
+        {
+        throw std::runtime_error("NeighborListGPUInner requires a full storage mode outer list.");
+        }
+
+    // acquire the particle data
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                     access_location::device,
+                                     access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    ArrayHandle<Scalar> d_r_cut(m_r_cut, access_location::device, access_mode::read);
+
+    // access the outer neighbor list
+    ArrayHandle<unsigned int> d_outer_nlist(m_outer->getNListArray(),
+                                            access_location::device,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> d_outer_n_neigh(m_outer->getNNeighArray(),
+                                              access_location::device,
+                                              access_mode::read);
+    ArrayHandle<size_t> d_outer_head_list(m_outer->getHeadList(),
+                                          access_location::device,
+                                          access_mode::read);
+
+    ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_Nmax(m_Nmax, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_conditions(m_conditions,
+                                           access_location::device,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> d_nlist(m_nlist, access_location::device, access_mode::overwrite);
+    ArrayHandle<unsigned int> d_n_neigh(m_n_neigh, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar4> d_last_pos(m_last_pos, access_location::device, access_mode::overwrite);
+
+    m_tuner->begin();
+    kernel::gpu_compute_nlist_inner(d_nlist.data,
+                                    d_n_neigh.data,
+                                    d_last_pos.data,
+                                    d_conditions.data,
+                                    d_Nmax.data,
+                                    d_head_list.data,
+                                    d_outer_nlist.data,
+                                    d_outer_n_neigh.data,
+                                    d_outer_head_list.data,
+                                    d_pos.data,
+                                    d_body.data,
+                                    m_pdata->getN(),
+                                    box,
+                                    d_r_cut.data,
+                                    m_r_buff,
+                                    m_pdata->getNTypes(),
+                                    m_filter_body,
+                                    m_tuner->getParam()[0]);
+
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+    }
+
+namespace detail
+    {
+void export_NeighborListGPUInner(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListGPUInner, NeighborListGPU, std::shared_ptr<NeighborListGPUInner>>(
+        m,
+        "NeighborListGPUInner")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar>())
+        .def("getOuter", &NeighborListGPUInner::getOuter);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,162 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborListGPUInner.cuh"
+
+/*! \file NeighborListGPUInner.cu
+    \brief Defines GPU kernel code for filtering an inner neighbor list on the GPU
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel call for filtering the inner neighbor list from the outer neighbor list
+/*! \param d_nlist Neighbor list data structure to write
+    \param d_n_neigh Number of neighbors to write
+    \param d_last_updated_pos Particle positions at this update are written to this array
+    \param d_conditions Conditions array for writing overflow condition
+    \param d_Nmax Maximum number of neighbors per type
+    \param d_head_list List of indexes to access \a d_nlist
+    \param d_outer_nlist Outer neighbor list (full storage mode)
+    \param d_outer_n_neigh Number of neighbors in the outer list
+    \param d_outer_head_list List of indexes to access \a d_outer_nlist
+    \param d_pos Particle positions
+    \param d_body Particle body indices
+    \param N Number of particles
+    \param box Simulation box dimensions
+    \param d_r_cut Cutoff radius stored by pair type r_cut(i,j)
+    \param r_buff The maximum radius for which to include particles as neighbors
+    \param ntypes Number of particle types
+    \param filter_body True when body filtering is enabled
+
+    One thread per particle tests each neighbor in the outer list against r_list(i,j).
+*/
+__global__ void gpu_compute_nlist_inner_kernel(unsigned int* d_nlist,
+                                               unsigned int* d_n_neigh,
+                                               Scalar4* d_last_updated_pos,
+                                               unsigned int* d_conditions,
+                                               const unsigned int* d_Nmax,
+                                               const size_t* d_head_list,
+                                               const unsigned int* d_outer_nlist,
+                                               const unsigned int* d_outer_n_neigh,
+                                               const size_t* d_outer_head_list,
+                                               const Scalar4* d_pos,
+                                               const unsigned int* d_body,
+                                               const unsigned int N,
+                                               const BoxDim box,
+                                               const Scalar* d_r_cut,
+                                               const Scalar r_buff,
+                                               const unsigned int ntypes,
+                                               bool filter_body)
+    {
+    // one thread per particle
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    Index2D typpair_idx(ntypes);
+
+    Scalar4 my_postype = d_pos[idx];
+    Scalar3 my_pos = make_scalar3(my_postype.x, my_postype.y, my_postype.z);
+    unsigned int my_type = __scalar_as_int(my_postype.w);
+    unsigned int my_body = d_body[idx];
+
+    size_t my_head = d_head_list[idx];
+    size_t outer_head = d_outer_head_list[idx];
+    unsigned int outer_n_neigh = d_outer_n_neigh[idx];
+    unsigned int my_n_max = d_Nmax[my_type];
+
+    unsigned int nneigh = 0;
+    for (unsigned int k = 0; k < outer_n_neigh; k++)
+        {
+        unsigned int cur_neigh = d_outer_nlist[outer_head + k];
+
+        Scalar4 neigh_postype = d_pos[cur_neigh];
+        unsigned int neigh_type = __scalar_as_int(neigh_postype.w);
+
+        // skip the pair without a distance check if r_cut(i,j) indicates to skip
+        Scalar r_cut = d_r_cut[typpair_idx(my_type, neigh_type)];
+        if (r_cut <= Scalar(0.0))
+            continue;
+
+        if (filter_body && my_body != 0xffffffff && my_body == d_body[cur_neigh])
+            continue;
+
+        Scalar3 dx = my_pos - make_scalar3(neigh_postype.x, neigh_postype.y, neigh_postype.z);
+        dx = box.minImage(dx);
+
+        Scalar r_list = r_cut + r_buff;
+        if (dot(dx, dx) <= r_list * r_list)
+            {
+            if (nneigh < my_n_max)
+                d_nlist[my_head + nneigh] = cur_neigh;
+            nneigh++;
+            }
+        }
+
+    // flag if we need to grow the neighbor list
+    if (nneigh >= my_n_max)
+        atomicMax(&d_conditions[my_type], nneigh);
+
+    d_n_neigh[idx] = nneigh;
+    d_last_updated_pos[idx] = my_postype;
+    }
+
+hipError_t gpu_compute_nlist_inner(unsigned int* d_nlist,
+                                   unsigned int* d_n_neigh,
+                                   Scalar4* d_last_updated_pos,
+                                   unsigned int* d_conditions,
+                                   const unsigned int* d_Nmax,
+                                   const size_t* d_head_list,
+                                   const unsigned int* d_outer_nlist,
+                                   const unsigned int* d_outer_n_neigh,
+                                   const size_t* d_outer_head_list,
+                                   const Scalar4* d_pos,
+                                   const unsigned int* d_body,
+                                   const unsigned int N,
+                                   const BoxDim& box,
+                                   const Scalar* d_r_cut,
+                                   const Scalar r_buff,
+                                   const unsigned int ntypes,
+                                   bool filter_body,
+                                   const unsigned int block_size)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_nlist_inner_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    hipLaunchKernelGGL((gpu_compute_nlist_inner_kernel),
+                       dim3(N / run_block_size + 1),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       d_nlist,
+                       d_n_neigh,
+                       d_last_updated_pos,
+                       d_conditions,
+                       d_Nmax,
+                       d_head_list,
+                       d_outer_nlist,
+                       d_outer_n_neigh,
+                       d_outer_head_list,
+                       d_pos,
+                       d_body,
+                       N,
+                       box,
+                       d_r_cut,
+                       r_buff,
+                       ntypes,
+                       filter_body);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
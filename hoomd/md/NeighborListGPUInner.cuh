@@ -0,0 +1,47 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __NEIGHBORLISTGPUINNER_CUH__
+#define __NEIGHBORLISTGPUINNER_CUH__
+
+#include <hip/hip_runtime.h>
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+/*! \file NeighborListGPUInner.cuh
+    \brief Declares GPU kernel code for filtering an inner neighbor list on the GPU
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Kernel driver for gpu_compute_nlist_inner_kernel()
+hipError_t gpu_compute_nlist_inner(unsigned int* d_nlist,
+                                   unsigned int* d_n_neigh,
+                                   Scalar4* d_last_updated_pos,
+                                   unsigned int* d_conditions,
+                                   const unsigned int* d_Nmax,
+                                   const size_t* d_head_list,
+                                   const unsigned int* d_outer_nlist,
+                                   const unsigned int* d_outer_n_neigh,
+                                   const size_t* d_outer_head_list,
+                                   const Scalar4* d_pos,
+                                   const unsigned int* d_body,
+                                   const unsigned int N,
+                                   const BoxDim& box,
+                                   const Scalar* d_r_cut,
+                                   const Scalar r_buff,
+                                   const unsigned int ntypes,
+                                   bool filter_body,
+                                   const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
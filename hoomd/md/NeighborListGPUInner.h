@@ -0,0 +1,76 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborListGPU.h"
+#include "hoomd/Autotuner.h"
+
+/*! \file NeighborListGPUInner.h
+    \brief Declares the NeighborListGPUInner class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTGPUINNER_H__
+#define __NEIGHBORLISTGPUINNER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list with a short cutoff filtered from the pairs of an outer neighbor list on the GPU
+/*! Implements the build of NeighborListInner on the GPU. Both the inner and outer lists must use
+    the full storage mode.
+
+    GPU kernel methods are defined in NeighborListGPUInner.cuh and defined in
+    NeighborListGPUInner.cu.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListGPUInner : public NeighborListGPU
+    {
+    public:
+    //! Constructs the compute
+    NeighborListGPUInner(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<NeighborList> outer,
+                         Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListGPUInner();
+
+    /// Notify NeighborList that a r_cut matrix value has changed
+    virtual void notifyRCutMatrixChange()
+        {
+        NeighborListGPU::notifyRCutMatrixChange();
+        updateOuterRCut();
+        }
+
+    /// Get the outer neighbor list
+    std::shared_ptr<NeighborList> getOuter()
+        {
+        return m_outer;
+        }
+
+    protected:
+    std::shared_ptr<NeighborList> m_outer; //!< The neighbor list to filter
+
+    /// Cutoff radius matrix registered with the outer neighbor list
+    std::shared_ptr<GlobalArray<Scalar>> m_outer_r_cut;
+
+    /// Autotuner for block size
+    std::shared_ptr<Autotuner<1>> m_tuner;
+
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    /// Update the cutoff radius matrix registered with the outer neighbor list
+    void updateOuterRCut();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
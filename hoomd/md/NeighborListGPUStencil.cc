@@ -38,6 +38,9 @@ NeighborListGPUStencil::NeighborListGPUStencil(std::shared_ptr<SystemDefinition>
     m_cl->setFlagIndex();
     m_cl->setComputeAdjList(false);
 
+    m_level_cl.assign(1, m_cl);
+    m_level_cls.assign(1, m_cls);
+
     CHECK_CUDA_ERROR();
 
     // Initialize autotuner.
@@ -77,6 +80,15 @@ NeighborListGPUStencil::~NeighborListGPUStencil()
 
 void NeighborListGPUStencil::updateRStencil()
     {
+    if (!m_type_level.empty())
+        {
+        for (unsigned int level = 0; level < m_level_cls.size(); ++level)
+            {
+            m_level_cls[level]->setRStencil(computeCellLevelRStencil(m_type_level, level));
+            }
+        return;
+        }
+
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
     std::vector<Scalar> rstencil(m_pdata->getNTypes(), -1.0);
     for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
@@ -91,6 +103,59 @@ void NeighborListGPUStencil::updateRStencil()
     m_cls->setRStencil(rstencil);
     }
 
+/*! Without multilevel cell lists, m_cl holds all particles and its width is set by the smallest
+    cutoff. With multilevel cell lists, each level of types from computeCellLevels() has its own
+    cell list and stencil, m_cl is the finest level.
+*/
+void NeighborListGPUStencil::updateCellLevels()
+    {
+    std::vector<Scalar> level_width;
+    if (m_multilevel)
+        level_width = computeCellLevels(m_type_level);
+
+    if (level_width.empty())
+        {
+        if (!m_override_cell_width)
+            {
+            Scalar rmin = getMinRCut() + m_r_buff;
+            m_cl->setNominalWidth(rmin);
+            }
+
+        if (!m_type_level.empty())
+            m_cl->setTypeMask(std::vector<unsigned int>());
+        m_type_level.clear();
+        m_level_cl.assign(1, m_cl);
+        m_level_cls.assign(1, m_cls);
+        return;
+        }
+
+    m_level_cl.resize(level_width.size());
+    m_level_cls.resize(level_width.size());
+    m_level_cl[0] = m_cl;
+    m_level_cls[0] = m_cls;
+    for (unsigned int level = 0; level < level_width.size(); ++level)
+        {
+        if (!m_level_cl[level])
+            {
+            m_level_cl[level] = std::make_shared<CellListGPU>(m_sysdef);
+            m_level_cl[level]->setRadius(1);
+            m_level_cl[level]->setComputeTypeBody(true);
+            m_level_cl[level]->setFlagIndex();
+            m_level_cl[level]->setComputeAdjList(false);
+            m_level_cls[level] = std::make_shared<CellListStencil>(m_sysdef, m_level_cl[level]);
+            }
+
+        std::vector<unsigned int> type_mask(m_pdata->getNTypes(), 0);
+        for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+            type_mask[cur_type] = (m_type_level[cur_type] == level) ? 1 : 0;
+        m_level_cl[level]->setTypeMask(type_mask);
+
+        // the user set width applies to the finest level
+        if (level > 0 || !m_override_cell_width)
+            m_level_cl[level]->setNominalWidth(level_width[level]);
+        }
+    }
+
 /*!
  * Rearranges the particle indexes by type to reduce execution divergence during the neighbor list
  * build. Radix sort is (supposed to be) stable so that the spatial sorting from SFC is also
@@ -159,15 +224,12 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
 
     if (m_update_cell_size)
         {
-        if (!m_override_cell_width)
-            {
-            Scalar rmin = getMinRCut() + m_r_buff;
-            m_cl->setNominalWidth(rmin);
-            }
+        updateCellLevels();
         m_update_cell_size = false;
         }
 
-    m_cl->compute(timestep);
+    for (auto& cl : m_level_cl)
+        cl->compute(timestep);
 
     // update the stencil radii if there was a change
     if (m_needs_restencil)
@@ -175,7 +237,8 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
         updateRStencil();
         m_needs_restencil = false;
         }
-    m_cls->compute(timestep);
+    for (auto& cls : m_level_cls)
+        cls->compute(timestep);
 
     // sort the particles by type
     if (m_needs_resort)
@@ -194,24 +257,6 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
     const BoxDim& box = m_pdata->getBox();
     Scalar3 nearest_plane_distance = box.getNearestPlaneDistance();
 
-    // access the cell list data arrays
-    ArrayHandle<unsigned int> d_cell_size(m_cl->getCellSizeArray(),
-                                          access_location::device,
-                                          access_mode::read);
-    ArrayHandle<Scalar4> d_cell_xyzf(m_cl->getXYZFArray(),
-                                     access_location::device,
-                                     access_mode::read);
-    ArrayHandle<uint2> d_cell_type_body(m_cl->getTypeBodyArray(),
-                                        access_location::device,
-                                        access_mode::read);
-    ArrayHandle<Scalar4> d_stencil(m_cls->getStencils(),
-                                   access_location::device,
-                                   access_mode::read);
-    ArrayHandle<unsigned int> d_n_stencil(m_cls->getStencilSizes(),
-                                          access_location::device,
-                                          access_mode::read);
-    const Index2D& stencil_idx = m_cls->getStencilIndexer();
-
     ArrayHandle<size_t> d_head_list(m_head_list, access_location::device, access_mode::read);
     ArrayHandle<unsigned int> d_Nmax(m_Nmax, access_location::device, access_mode::read);
     ArrayHandle<unsigned int> d_conditions(m_conditions,
@@ -256,37 +301,62 @@ void NeighborListGPUStencil::buildNlist(uint64_t timestep)
     unsigned int block_size = param[0];
     unsigned int threads_per_particle = param[1];
 
-    // launch neighbor list kernel
-    kernel::gpu_compute_nlist_stencil(d_nlist.data,
-                                      d_n_neigh.data,
-                                      d_last_pos.data,
-                                      d_conditions.data,
-                                      d_Nmax.data,
-                                      d_head_list.data,
-                                      d_pid_map.data,
-                                      d_pos.data,
-                                      d_body.data,
-                                      m_pdata->getN(),
-                                      d_cell_size.data,
-                                      d_cell_xyzf.data,
-                                      d_cell_type_body.data,
-                                      m_cl->getCellIndexer(),
-                                      m_cl->getCellListIndexer(),
-                                      d_stencil.data,
-                                      d_n_stencil.data,
-                                      stencil_idx,
-                                      box,
-                                      d_r_cut.data,
-                                      m_r_buff,
-                                      m_pdata->getNTypes(),
-                                      m_cl->getGhostWidth(),
-                                      m_filter_body,
-                                      threads_per_particle,
-                                      block_size,
-                                      m_exec_conf->dev_prop);
-
-    if (m_exec_conf->isCUDAErrorCheckingEnabled())
-        CHECK_CUDA_ERROR();
+    // launch the neighbor list kernel for each level
+    for (unsigned int level = 0; level < m_level_cl.size(); ++level)
+        {
+        const std::shared_ptr<CellList>& cl = m_level_cl[level];
+        const std::shared_ptr<CellListStencil>& cls = m_level_cls[level];
+
+        // access the cell list data arrays
+        ArrayHandle<unsigned int> d_cell_size(cl->getCellSizeArray(),
+                                              access_location::device,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> d_cell_xyzf(cl->getXYZFArray(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<uint2> d_cell_type_body(cl->getTypeBodyArray(),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<Scalar4> d_stencil(cls->getStencils(),
+                                       access_location::device,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> d_n_stencil(cls->getStencilSizes(),
+                                              access_location::device,
+                                              access_mode::read);
+        const Index2D& stencil_idx = cls->getStencilIndexer();
+
+        kernel::gpu_compute_nlist_stencil(d_nlist.data,
+                                          d_n_neigh.data,
+                                          d_last_pos.data,
+                                          d_conditions.data,
+                                          d_Nmax.data,
+                                          d_head_list.data,
+                                          d_pid_map.data,
+                                          d_pos.data,
+                                          d_body.data,
+                                          m_pdata->getN(),
+                                          d_cell_size.data,
+                                          d_cell_xyzf.data,
+                                          d_cell_type_body.data,
+                                          cl->getCellIndexer(),
+                                          cl->getCellListIndexer(),
+                                          d_stencil.data,
+                                          d_n_stencil.data,
+                                          stencil_idx,
+                                          box,
+                                          d_r_cut.data,
+                                          m_r_buff,
+                                          m_pdata->getNTypes(),
+                                          cl->getGhostWidth(),
+                                          level > 0,
+                                          m_filter_body,
+                                          threads_per_particle,
+                                          block_size,
+                                          m_exec_conf->dev_prop);
+
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        }
     if (tune)
         this->m_tuner->end();
 
@@ -301,7 +371,10 @@ void export_NeighborListGPUStencil(pybind11::module& m)
                      NeighborListGPU,
                      std::shared_ptr<NeighborListGPUStencil>>(m, "NeighborListGPUStencil")
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
-        .def("setCellWidth", &NeighborListGPUStencil::setCellWidth);
+        .def("setCellWidth", &NeighborListGPUStencil::setCellWidth)
+        .def_property("multilevel",
+                      &NeighborListGPUStencil::getMultilevel,
+                      &NeighborListGPUStencil::setMultilevel);
     }
 
     } // end namespace detail
@@ -47,6 +47,7 @@ namespace kernel
     \param r_buff The maximum radius for which to include particles as neighbors
     \param ntypes Number of particle types
     \param ghost_width Width of ghost cell layer
+    \param append Set to true to append to the neighbors already in \a d_nlist
 
     \note optimized for Kepler
 */
@@ -73,7 +74,8 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
                                                  const Scalar* d_r_cut,
                                                  const Scalar r_buff,
                                                  const unsigned int ntypes,
-                                                 const Scalar3 ghost_width)
+                                                 const Scalar3 ghost_width,
+                                                 const bool append)
     {
     // cache the r_listsq parameters into shared memory
     Index2D typpair_idx(ntypes);
@@ -159,8 +161,8 @@ __global__ void gpu_compute_nlist_stencil_kernel(unsigned int* d_nlist,
 
     bool done = false;
 
-    // total number of neighbors
-    unsigned int nneigh = 0;
+    // total number of neighbors, including the ones found in the previous cell list levels
+    unsigned int nneigh = append ? d_n_neigh[my_pidx] : 0;
 
     while (!done)
         {
@@ -329,6 +331,7 @@ inline void stencil_launcher(unsigned int* d_nlist,
                              const Scalar r_buff,
                              const unsigned int ntypes,
                              const Scalar3& ghost_width,
+                             const bool append,
                              bool filter_body,
                              const unsigned int threads_per_particle,
                              const unsigned int block_size,
@@ -383,7 +386,8 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                d_r_cut,
                                r_buff,
                                ntypes,
-                               ghost_width);
+                               ghost_width,
+                               append);
             }
         else if (filter_body)
             {
@@ -421,7 +425,8 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                d_r_cut,
                                r_buff,
                                ntypes,
-                               ghost_width);
+                               ghost_width,
+                               append);
             }
         }
     else
@@ -449,6 +454,7 @@ inline void stencil_launcher(unsigned int* d_nlist,
                                       r_buff,
                                       ntypes,
                                       ghost_width,
+                                      append,
                                       filter_body,
                                       threads_per_particle,
                                       block_size,
@@ -481,6 +487,7 @@ inline void stencil_launcher<min_threads_per_particle / 2>(unsigned int* d_nlist
                                                            const Scalar r_buff,
                                                            const unsigned int ntypes,
                                                            const Scalar3& ghost_width,
+                                                           const bool append,
                                                            bool filter_body,
                                                            const unsigned int threads_per_particle,
                                                            const unsigned int block_size,
@@ -511,6 +518,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                      const Scalar r_buff,
                                      const unsigned int ntypes,
                                      const Scalar3& ghost_width,
+                                     const bool append,
                                      bool filter_body,
                                      const unsigned int threads_per_particle,
                                      const unsigned int block_size,
@@ -539,6 +547,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                                r_buff,
                                                ntypes,
                                                ghost_width,
+                                               append,
                                                filter_body,
                                                threads_per_particle,
                                                block_size,
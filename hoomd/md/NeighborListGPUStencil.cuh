@@ -53,6 +53,7 @@ hipError_t gpu_compute_nlist_stencil(unsigned int* d_nlist,
                                      const Scalar r_buff,
                                      const unsigned int ntypes,
                                      const Scalar3& ghost_width,
+                                     const bool append,
                                      bool filter_body,
                                      const unsigned int threads_per_particle,
                                      const unsigned int block_size,
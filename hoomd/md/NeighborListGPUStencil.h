@@ -15,6 +15,7 @@
 #endif
 
 #include <pybind11/pybind11.h>
+#include <vector>
 
 #ifndef __NEIGHBORLISTGPUSTENCIL_H__
 #define __NEIGHBORLISTGPUSTENCIL_H__
@@ -29,6 +30,9 @@ namespace md
     GPU kernel methods are defined in NeighborListGPUStencil.cuh and defined in
    NeighborListGPUStencil.cu.
 
+    In multilevel mode, each level of types has its own cell list and stencils, and the kernel runs
+    once per level, appending to the neighbors found in the previous levels.
+
     \ingroup computes
 */
 class PYBIND11_EXPORT NeighborListGPUStencil : public NeighborListGPU
@@ -56,6 +60,20 @@ class PYBIND11_EXPORT NeighborListGPUStencil : public NeighborListGPU
         m_cl->setNominalWidth(cell_width);
         }
 
+    /// Set whether to use one cell list per level of types with similar cutoffs
+    void setMultilevel(bool multilevel)
+        {
+        m_multilevel = multilevel;
+        m_update_cell_size = true;
+        m_needs_restencil = true;
+        }
+
+    /// Get whether to use one cell list per level of types with similar cutoffs
+    bool getMultilevel()
+        {
+        return m_multilevel;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
@@ -68,6 +86,21 @@ class PYBIND11_EXPORT NeighborListGPUStencil : public NeighborListGPU
     std::shared_ptr<CellListStencil> m_cls; //!< The cell list stencil
     bool m_override_cell_width = false;     //!< Flag to override the cell width
 
+    /// True to use one cell list per level of types
+    bool m_multilevel = false;
+
+    /// Cell lists of the levels, the first is m_cl
+    std::vector<std::shared_ptr<CellList>> m_level_cl;
+
+    /// Stencils of the levels, the first is m_cls
+    std::vector<std::shared_ptr<CellListStencil>> m_level_cls;
+
+    /// Level of each type, empty when all particles are in m_cl
+    std::vector<unsigned int> m_type_level;
+
+    /// Set up the cell lists of the levels and their widths
+    void updateCellLevels();
+
     //! Update the stencil radius
     void updateRStencil();
     bool m_needs_restencil = true; //!< Flag for updating the stencil
@@ -23,6 +23,7 @@ namespace md
  */
 NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
     : NeighborListGPU(sysdef, r_buff), m_type_bits(1), m_lbvh_errors(m_exec_conf), m_n_images(0),
+      m_max_refits(0), m_num_refits(0), m_lbvhs_refittable(false), m_lbvh_num_particles(0),
       m_types_allocated(false), m_box_changed(true), m_max_num_changed(true), m_max_types(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing NeighborListGPUTree" << std::endl;
@@ -30,6 +31,8 @@ NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysde
         .connect<NeighborListGPUTree, &NeighborListGPUTree::slotBoxChanged>(this);
     m_pdata->getMaxParticleNumberChangeSignal()
         .connect<NeighborListGPUTree, &NeighborListGPUTree::slotMaxNumChanged>(this);
+    m_pdata->getParticleSortSignal()
+        .connect<NeighborListGPUTree, &NeighborListGPUTree::slotParticleSort>(this);
 
     m_mark_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         m_exec_conf,
@@ -40,7 +43,11 @@ NeighborListGPUTree::NeighborListGPUTree(std::shared_ptr<SystemDefinition> sysde
     m_copy_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
                                         m_exec_conf,
                                         "nlist_tree_copy"));
-    m_autotuners.insert(m_autotuners.end(), {m_mark_tuner, m_count_tuner, m_copy_tuner});
+    m_refit_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                                         m_exec_conf,
+                                         "nlist_tree_refit"));
+    m_autotuners.insert(m_autotuners.end(),
+                        {m_mark_tuner, m_count_tuner, m_copy_tuner, m_refit_tuner});
     }
 
 /*!
@@ -53,6 +60,8 @@ NeighborListGPUTree::~NeighborListGPUTree()
         .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotBoxChanged>(this);
     m_pdata->getMaxParticleNumberChangeSignal()
         .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotMaxNumChanged>(this);
+    m_pdata->getParticleSortSignal()
+        .disconnect<NeighborListGPUTree, &NeighborListGPUTree::slotParticleSort>(this);
 
     // destroy all of the created streams
     for (auto stream = m_streams.begin(); stream != m_streams.end(); ++stream)
@@ -92,6 +101,12 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
         GPUArray<unsigned int> traverse_order(m_pdata->getMaxN(), m_exec_conf);
         m_traverse_order.swap(traverse_order);
 
+        GPUArray<unsigned int> built_indexes(m_pdata->getMaxN(), m_exec_conf);
+        m_built_indexes.swap(built_indexes);
+
+        GPUArray<unsigned int> refit_locks(m_pdata->getMaxN(), m_exec_conf);
+        m_refit_locks.swap(refit_locks);
+
         // all done with the particle data reallocation
         m_max_num_changed = false;
         }
@@ -136,6 +151,7 @@ void NeighborListGPUTree::buildNlist(uint64_t timestep)
 
         // all done with the type reallocation
         m_types_allocated = true;
+        m_lbvhs_refittable = false;
         }
 
     // update properties that depend on the box
@@ -339,6 +355,59 @@ void NeighborListGPUTree::buildTree()
         m_count_tuner->end();
         }
 
+    // refit the lbvhs when the particles are in the same order as at the last build
+    if (canRefit())
+        {
+        ArrayHandle<unsigned int> h_type_first(m_type_first,
+                                               access_location::host,
+                                               access_mode::read);
+        ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                   access_location::device,
+                                                   access_mode::read);
+        ArrayHandle<unsigned int> d_refit_locks(m_refit_locks,
+                                                access_location::device,
+                                                access_mode::overwrite);
+
+        m_refit_tuner->begin();
+        const unsigned int block_size = m_refit_tuner->getParam()[0];
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            const unsigned int Ni = m_lbvhs[i]->getN();
+            if (Ni == 0)
+                continue;
+
+            // each type has fewer internal nodes than particles, so the counters do not overlap
+            const unsigned int first = h_type_first.data[i];
+            m_lbvhs[i]->refit(d_pos.data,
+                              d_sorted_indexes.data + first,
+                              Ni,
+                              d_refit_locks.data + first,
+                              m_streams[i],
+                              block_size);
+            }
+        m_refit_tuner->end();
+        hipDeviceSynchronize();
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+
+        // the primitives have the same order, so only the traversers need the new bounds
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            {
+            if (m_lbvhs[i]->getN() == 0)
+                continue;
+            m_traversers[i]->setup(d_sorted_indexes.data + h_type_first.data[i],
+                                   *(m_lbvhs[i]->get()),
+                                   m_streams[i]);
+            }
+        hipDeviceSynchronize();
+
+        ++m_num_refits;
+        return;
+        }
+
         // build a lbvh for each type
         {
         ArrayHandle<unsigned int> h_type_first(m_type_first,
@@ -458,6 +527,58 @@ void NeighborListGPUTree::buildTree()
             }
         hipDeviceSynchronize();
         }
+
+    // save the particle order so that the next builds can refit the lbvhs
+    if (m_max_refits > 0)
+        {
+        ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                                   access_location::device,
+                                                   access_mode::read);
+        ArrayHandle<unsigned int> d_built_indexes(m_built_indexes,
+                                                  access_location::device,
+                                                  access_mode::overwrite);
+        m_lbvh_num_particles = m_pdata->getN() + m_pdata->getNGhosts();
+        hipMemcpy(d_built_indexes.data,
+                  d_sorted_indexes.data,
+                  sizeof(unsigned int) * m_lbvh_num_particles,
+                  hipMemcpyDeviceToDevice);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_lbvhs_refittable = true;
+        }
+    m_num_refits = 0;
+    }
+
+/*!
+ * \returns True if the LBVHs can be refit instead of built
+ *
+ * Refitting keeps the topology and the primitive order of the LBVHs. This is valid when the same
+ * particles are sorted into the same order by type as at the last build, which also implies the
+ * same type ranges. In MPI simulations, the ghost particles change at every build, so the LBVHs are
+ * always built. The LBVHs are also built from scratch after m_max_refits consecutive refits, since
+ * their quality degrades as the particles move away from their positions at the last build.
+ */
+bool NeighborListGPUTree::canRefit()
+    {
+    if (!m_lbvhs_refittable || m_num_refits >= m_max_refits)
+        return false;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        return false;
+#endif
+
+    const unsigned int N = m_pdata->getN() + m_pdata->getNGhosts();
+    if (N != m_lbvh_num_particles)
+        return false;
+
+    ArrayHandle<unsigned int> d_sorted_indexes(m_sorted_indexes,
+                                               access_location::device,
+                                               access_mode::read);
+    ArrayHandle<unsigned int> d_built_indexes(m_built_indexes,
+                                              access_location::device,
+                                              access_mode::read);
+    return kernel::gpu_nlist_indexes_equal(d_sorted_indexes.data, d_built_indexes.data, N);
     }
 
 /*!
@@ -645,7 +766,10 @@ void export_NeighborListGPUTree(pybind11::module& m)
     pybind11::class_<NeighborListGPUTree, NeighborListGPU, std::shared_ptr<NeighborListGPUTree>>(
         m,
         "NeighborListGPUTree")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("max_refits",
+                      &NeighborListGPUTree::getMaxRefits,
+                      &NeighborListGPUTree::setMaxRefits);
     }
 
     } // end namespace detail
@@ -7,6 +7,7 @@
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wconversion"
 #include <hipcub/hipcub.hpp>
+#include <thrust/equal.h>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
 #include <thrust/remove.h>
@@ -337,6 +338,19 @@ hipError_t gpu_nlist_copy_primitives(unsigned int* d_traverse_order,
     return hipSuccess;
     }
 
+/*!
+ * \param d_indexes Particle indexes sorted by type.
+ * \param d_built_indexes Particle indexes sorted by type when the LBVHs were built.
+ * \param N Number of indexes.
+ * \returns True if the two lists are the same.
+ */
+bool gpu_nlist_indexes_equal(const unsigned int* d_indexes,
+                             const unsigned int* d_built_indexes,
+                             const unsigned int N)
+    {
+    return thrust::equal(thrust::device, d_indexes, d_indexes + N, d_built_indexes);
+    }
+
 /////////////////////////////////////
 // neighbor program and wrappers
 /////////////////////////////////////
@@ -750,6 +764,76 @@ struct NeighborListOp
     unsigned int max_neigh;      //!< Maximum number of neighbors allocated
     };
 
+//! Load a float3 bypassing the non-coherent caches
+DEVICE float3 load_coherent(const float3* p)
+    {
+    const volatile float* v = reinterpret_cast<const volatile float*>(p);
+    return make_float3(v[0], v[1], v[2]);
+    }
+
+//! Kernel to refit an LBVH to new primitive bounds
+/*!
+ * \param d_lo Lower bounds of the nodes.
+ * \param d_hi Upper bounds of the nodes.
+ * \param d_parent Parent of each node.
+ * \param d_left Left child of each internal node.
+ * \param d_right Right child of each internal node.
+ * \param d_primitives Primitive of each leaf.
+ * \param d_locks Counter of the children visited for each internal node.
+ * \param insert Insert operation generating the primitive bounds.
+ * \param root Root node.
+ * \param N Number of primitives.
+ *
+ * The LBVH stores the N - 1 internal nodes first, followed by the N leaves in primitive order.
+ * Using one thread per leaf, the leaf bounds are recomputed, and then the threads walk up the
+ * tree. The first thread to reach an internal node terminates, and the second one merges the
+ * bounds of both children, which are complete at that point. This is the same bottom-up pass that
+ * neighbor uses at the end of a build, without generating and sorting the Morton codes again.
+ */
+__global__ void gpu_nlist_refit_kernel(float3* d_lo,
+                                       float3* d_hi,
+                                       const int* d_parent,
+                                       const int* d_left,
+                                       const int* d_right,
+                                       const unsigned int* d_primitives,
+                                       unsigned int* d_locks,
+                                       const PointMapInsertOp insert,
+                                       const int root,
+                                       const unsigned int N)
+    {
+    const unsigned int idx = blockDim.x * blockIdx.x + threadIdx.x;
+    if (idx >= N)
+        return;
+
+    int node = N - 1 + idx;
+    const neighbor::BoundingBox leaf = insert.get(d_primitives[idx]);
+    d_lo[node] = leaf.lo;
+    d_hi[node] = leaf.hi;
+
+    while (node != root)
+        {
+        // make the bounds of this node visible before the parent is unlocked
+        __threadfence();
+
+        const int parent = d_parent[node];
+        if (atomicAdd(d_locks + parent, 1) == 0)
+            return;
+
+        const float3 left_lo = load_coherent(d_lo + d_left[parent]);
+        const float3 left_hi = load_coherent(d_hi + d_left[parent]);
+        const float3 right_lo = load_coherent(d_lo + d_right[parent]);
+        const float3 right_hi = load_coherent(d_hi + d_right[parent]);
+
+        d_lo[parent] = make_float3(fminf(left_lo.x, right_lo.x),
+                                   fminf(left_lo.y, right_lo.y),
+                                   fminf(left_lo.z, right_lo.z));
+        d_hi[parent] = make_float3(fmaxf(left_hi.x, right_hi.x),
+                                   fmaxf(left_hi.y, right_hi.y),
+                                   fmaxf(left_hi.z, right_hi.z));
+        node = parent;
+        }
+    }
+
 //! Host function to convert a double to a float in round-down mode
 float double2float_rd(double x)
     {
@@ -833,6 +917,55 @@ void LBVHWrapper::build(const Scalar4* points,
     lbvh_->build(neighbor::LBVH::LaunchParameters(block_size, stream), insert, lof, hif);
     }
 
+/*!
+ * \param points Particle positions
+ * \param map Mapping of particles for insertion
+ * \param N Number of particles, must match the number of primitives at the last build
+ * \param d_locks Scratch space for N - 1 counters
+ * \param stream CUDA stream for execution
+ * \param block_size CUDA block size for execution
+ *
+ * The refit keeps the tree topology and the order of the primitives, so the \a map must be the
+ * same as for the last build.
+ */
+void LBVHWrapper::refit(const Scalar4* points,
+                        const unsigned int* map,
+                        unsigned int N,
+                        unsigned int* d_locks,
+                        hipStream_t stream,
+                        unsigned int block_size)
+    {
+    if (N == 0)
+        return;
+
+    if (N > 1)
+        hipMemsetAsync(d_locks, 0, sizeof(unsigned int) * (N - 1), stream);
+
+    PointMapInsertOp insert(points, map, N);
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, reinterpret_cast<const void*>(gpu_nlist_refit_kernel));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    const unsigned int run_block_size = min(block_size, max_block_size);
+    const unsigned int num_blocks = (N + run_block_size - 1) / run_block_size;
+    hipLaunchKernelGGL((gpu_nlist_refit_kernel),
+                       dim3(num_blocks),
+                       dim3(run_block_size),
+                       0,
+                       stream,
+                       lbvh_->getLowerBounds().get(),
+                       lbvh_->getUpperBounds().get(),
+                       lbvh_->getParents().get(),
+                       lbvh_->getLeftChildren().get(),
+                       lbvh_->getRightChildren().get(),
+                       lbvh_->getPrimitives().get(),
+                       d_locks,
+                       insert,
+                       lbvh_->getRoot(),
+                       N);
+    }
+
 unsigned int LBVHWrapper::getN() const
     {
     return lbvh_->getN();
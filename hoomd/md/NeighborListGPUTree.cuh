@@ -67,6 +67,11 @@ hipError_t gpu_nlist_copy_primitives(unsigned int* d_traverse_order,
                                      const unsigned int N,
                                      const unsigned int block_size);
 
+//! Kernel driver to check if the particles are in the same order as at the last build
+bool gpu_nlist_indexes_equal(const unsigned int* d_indexes,
+                             const unsigned int* d_built_indexes,
+                             const unsigned int N);
+
 //! Wrapper around the neighbor::LBVH class
 /*!
  * This wrapper only exposes data types that are natively supported in HOOMD
@@ -94,6 +99,14 @@ class LBVHWrapper
                hipStream_t stream,
                unsigned int block_size);
 
+    //! Refit the LBVH to new positions of the same primitives
+    void refit(const Scalar4* points,
+               const unsigned int* map,
+               unsigned int N,
+               unsigned int* d_locks,
+               hipStream_t stream,
+               unsigned int block_size);
+
     //! Get the underlying LBVH
     neighbor::LBVH* get()
         {
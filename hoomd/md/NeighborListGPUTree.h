@@ -47,6 +47,18 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     //! Destructor
     virtual ~NeighborListGPUTree();
 
+    /// Set the number of consecutive builds that refit the LBVHs instead of rebuilding them
+    void setMaxRefits(unsigned int max_refits)
+        {
+        m_max_refits = max_refits;
+        }
+
+    /// Get the number of consecutive builds that refit the LBVHs instead of rebuilding them
+    unsigned int getMaxRefits() const
+        {
+        return m_max_refits;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
@@ -57,6 +69,7 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     std::shared_ptr<Autotuner<1>> m_copy_tuner;     //!< Tuner for the primitive-copy kernel
     std::shared_ptr<Autotuner<1>> m_build_tuner;    //!< Tuner for LBVH builds
     std::shared_ptr<Autotuner<1>> m_traverse_tuner; //!< Tuner for LBVH traversers
+    std::shared_ptr<Autotuner<1>> m_refit_tuner;    //!< Tuner for LBVH refits
 
     GPUArray<unsigned int> m_types;          //!< Particle types (for sorting)
     GPUArray<unsigned int> m_sorted_types;   //!< Sorted particle types
@@ -77,6 +90,16 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     unsigned int m_n_images;                 //!< Number of translation vectors for traversal
     GPUArray<unsigned int> m_traverse_order; //!< Order to traverse primitives
 
+    unsigned int m_max_refits;              //!< Number of consecutive builds that refit the LBVHs
+    unsigned int m_num_refits;              //!< Number of refits since the last full build
+    bool m_lbvhs_refittable;                //!< True when the LBVHs may be refit
+    unsigned int m_lbvh_num_particles;      //!< Number of particles at the last full build
+    GPUArray<unsigned int> m_built_indexes; //!< Sorted particle indexes at the last full build
+    GPUArray<unsigned int> m_refit_locks;   //!< Node counters for the refit
+
+    //! Check if the LBVHs can be refit to the current positions
+    bool canRefit();
+
     //! Build the LBVHs using the neighbor library
     void buildTree();
 
@@ -122,6 +145,13 @@ class PYBIND11_EXPORT NeighborListGPUTree : public NeighborListGPU
     void slotMaxNumChanged()
         {
         m_max_num_changed = true;
+        m_lbvhs_refittable = false;
+        }
+
+    //! Notification of a particle sort
+    void slotParticleSort()
+        {
+        m_lbvhs_refittable = false;
         }
 
     /// set to true when the type data has been allocated
@@ -0,0 +1,235 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListInner.cc
+    \brief Defines NeighborListInner
+*/
+
+#include "NeighborListInner.h"
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListInner::NeighborListInner(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<NeighborList> outer,
+                                     Scalar r_buff)
+    : NeighborList(sysdef, r_buff), m_outer(outer)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListInner" << endl;
+
+    if (!m_outer)
+        {
+        throw std::invalid_argument("NeighborListInner requires an outer neighbor list.");
+        }
+
+    m_outer_r_cut = std::make_shared<GlobalArray<Scalar>>(m_typpair_idx.getNumElements(),
+                                                          m_exec_conf);
+    TAG_ALLOCATION(*m_outer_r_cut);
+    m_outer->addRCutMatrix(m_outer_r_cut);
+    updateOuterRCut();
+    }
+
+NeighborListInner::~NeighborListInner()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListInner" << endl;
+
+    m_outer->removeRCutMatrix(m_outer_r_cut);
+    m_outer->notifyRCutMatrixChange();
+    }
+
+/*! The outer list must find every pair within r_list(i,j) of the inner list. r_cut(i,j) + r_buff
+    bounds r_list(i,j) for all pair buffers.
+*/
+void NeighborListInner::updateOuterRCut()
+    {
+    updateRList();
+
+        {
+        ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+        ArrayHandle<Scalar> h_outer_r_cut(*m_outer_r_cut,
+                                          access_location::host,
+                                          access_mode::overwrite);
+
+        for (unsigned int cur_pair = 0; cur_pair < m_typpair_idx.getNumElements(); ++cur_pair)
+            {
+            const Scalar r_cut = h_r_cut.data[cur_pair];
+            h_outer_r_cut.data[cur_pair] = (r_cut > Scalar(0.0)) ? r_cut + m_r_buff : Scalar(0.0);
+            }
+        }
+
+    m_outer->notifyRCutMatrixChange();
+    }
+
+void NeighborListInner::buildNlist(uint64_t timestep)
+    {
+    // the outer list rebuilds itself when its own buffer is exhausted
+    m_outer->compute(timestep);
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    // access the outer neighbor list
+    ArrayHandle<unsigned int> h_outer_nlist(m_outer->getNListArray(),
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<unsigned int> h_outer_n_neigh(m_outer->getNNeighArray(),
+                                              access_location::host,
+                                              access_mode::read);
+    ArrayHandle<size_t> h_outer_head_list(m_outer->getHeadList(),
+                                          access_location::host,
+                                          access_mode::read);
+
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+
+    // access the exclusions, which are removed as the list is built
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    unsigned int nparticles = m_pdata->getN();
+
+    // test if the outer neighbor j of particle i is an inner neighbor
+    auto is_neighbor = [&](unsigned int i, unsigned int j)
+        {
+        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+        const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+        if (h_r_cut.data[m_typpair_idx(type_i, type_j)] <= Scalar(0.0))
+            return false;
+
+        const unsigned int body_i = h_body.data[i];
+        if (m_filter_body && body_i != NO_BODY && body_i == h_body.data[j])
+            return false;
+
+        Scalar3 dx = make_scalar3(h_pos.data[i].x - h_pos.data[j].x,
+                                  h_pos.data[i].y - h_pos.data[j].y,
+                                  h_pos.data[i].z - h_pos.data[j].z);
+        dx = box.minImage(dx);
+        if (dot(dx, dx) > h_r_listsq.data[m_typpair_idx(type_i, type_j)])
+            return false;
+
+        return !(m_exclusions_set && isExcluded(i, j, h_n_ex_idx.data, h_ex_list_idx.data));
+        };
+
+    // append j to the list of particle i, recording any overflow of Nmax in conditions
+    auto add_neighbor = [&](unsigned int i, unsigned int j, unsigned int* conditions)
+        {
+        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+        const unsigned int cur_n_neigh = h_n_neigh.data[i];
+        if (cur_n_neigh < h_Nmax.data[type_i])
+            h_nlist.data[h_head_list.data[i] + cur_n_neigh] = j;
+        else
+            conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+        h_n_neigh.data[i] = cur_n_neigh + 1;
+        };
+
+    if (m_outer->getStorageMode() == half && m_storage_mode == full)
+        {
+        // a half outer list holds each local pair once, add it to the lists of both particles
+        memset(h_n_neigh.data, 0, sizeof(unsigned int) * nparticles);
+        for (unsigned int i = 0; i < nparticles; i++)
+            {
+            const size_t outer_head_i = h_outer_head_list.data[i];
+            for (unsigned int k = 0; k < h_outer_n_neigh.data[i]; k++)
+                {
+                const unsigned int j = h_outer_nlist.data[outer_head_i + k];
+                if (!is_neighbor(i, j))
+                    continue;
+
+                add_neighbor(i, j, h_conditions.data);
+                if (j < nparticles)
+                    add_neighbor(j, i, h_conditions.data);
+                }
+            }
+        return;
+        }
+
+    // filter the outer neighbors of particle i, keeping only i < j in half mode
+    auto build_particle = [&](unsigned int i, unsigned int* conditions)
+        {
+        h_n_neigh.data[i] = 0;
+
+        const size_t outer_head_i = h_outer_head_list.data[i];
+        for (unsigned int k = 0; k < h_outer_n_neigh.data[i]; k++)
+            {
+            const unsigned int j = h_outer_nlist.data[outer_head_i + k];
+            if ((m_storage_mode == full || i < j) && is_neighbor(i, j))
+                add_neighbor(i, j, conditions);
+            }
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each thread records its own overflow conditions, which are merged below
+        const unsigned int n_types = m_pdata->getNTypes();
+        tbb::enumerable_thread_specific<std::vector<unsigned int>> thread_conditions(n_types, 0);
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, nparticles),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  {
+                                      unsigned int* conditions = thread_conditions.local().data();
+                                      for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                          build_particle(i, conditions);
+                                  });
+            });
+
+        for (const auto& conditions : thread_conditions)
+            {
+            for (unsigned int t = 0; t < n_types; ++t)
+                h_conditions.data[t] = max(h_conditions.data[t], conditions[t]);
+            }
+        }
+    else
+#endif
+        {
+        for (unsigned int i = 0; i < nparticles; i++)
+            build_particle(i, h_conditions.data);
+        }
+    }
+
+namespace detail
+    {
+void export_NeighborListInner(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListInner, NeighborList, std::shared_ptr<NeighborListInner>>(
+        m,
+        "NeighborListInner")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar>())
+        .def("getOuter", &NeighborListInner::getOuter);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,80 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+
+/*! \file NeighborListInner.h
+    \brief Declares the NeighborListInner class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTINNER_H__
+#define __NEIGHBORLISTINNER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Neighbor list with a short cutoff filtered from the pairs of an outer neighbor list
+/*! NeighborListInner builds its list by testing only the pairs in the outer neighbor list against
+    its own r_list(i,j), so the short range forces of a system with a second, much longer cutoff
+    do not need a second cell list pass. NeighborListInner adds r_cut(i,j) + r_buff to the r_cut
+    matrices of the outer list, so the outer list always contains every pair that the inner list
+    needs. The outer list is computed (and rebuilt when needed) before each inner list build.
+
+    Pairs that the outer list excludes are also absent from the inner list.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListInner : public NeighborList
+    {
+    public:
+    //! Constructs the compute
+    NeighborListInner(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<NeighborList> outer,
+                      Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListInner();
+
+    /// Notify NeighborList that a r_cut matrix value has changed
+    virtual void notifyRCutMatrixChange()
+        {
+        NeighborList::notifyRCutMatrixChange();
+        updateOuterRCut();
+        }
+
+    /// Get the outer neighbor list
+    std::shared_ptr<NeighborList> getOuter()
+        {
+        return m_outer;
+        }
+
+    protected:
+    std::shared_ptr<NeighborList> m_outer; //!< The neighbor list to filter
+
+    /// Cutoff radius matrix registered with the outer neighbor list
+    std::shared_ptr<GlobalArray<Scalar>> m_outer_r_cut;
+
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    /// The build removes the excluded pairs
+    virtual bool buildFiltersExclusions()
+        {
+        return true;
+        }
+
+    /// Update the cutoff radius matrix registered with the outer neighbor list
+    void updateOuterRCut();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
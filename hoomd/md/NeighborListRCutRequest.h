@@ -0,0 +1,112 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListRCutRequest.h
+    \brief Declares a helper that registers one r_cut for all type pairs with a neighbor list
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "NeighborList.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Registers the same r_cut for all type pairs with a neighbor list
+/** Analyses that take their pairs from a neighbor list, such as RDFAnalyzer and
+    SteinhardtCompute, need every pair closer than r_max regardless of the r_cut of the pair
+    potentials that share the list. NeighborListRCutRequest adds an r_cut matrix filled with r_max
+    to the neighbor list on construction and removes it on destruction or in detach().
+*/
+class NeighborListRCutRequest
+    {
+    public:
+    /// Constructor
+    /*! \param nlist Neighbor list to register the r_cut matrix with
+        \param exec_conf Execution configuration
+        \param ntypes Number of particle types
+        \param r_cut Cutoff for all type pairs
+        \param name Name of the owner in error messages
+    */
+    NeighborListRCutRequest(std::shared_ptr<NeighborList> nlist,
+                            std::shared_ptr<const ExecutionConfiguration> exec_conf,
+                            unsigned int ntypes,
+                            Scalar r_cut,
+                            const std::string& name)
+        : m_nlist(nlist),
+          m_r_cut_nlist(std::make_shared<GlobalArray<Scalar>>(ntypes * ntypes, exec_conf)),
+          m_name(name)
+        {
+        assert(m_nlist);
+        fillRCutMatrix(r_cut);
+        m_nlist->addRCutMatrix(m_r_cut_nlist);
+        }
+
+    /// Destructor
+    ~NeighborListRCutRequest()
+        {
+        detach();
+        }
+
+    NeighborListRCutRequest(const NeighborListRCutRequest&) = delete;
+    NeighborListRCutRequest& operator=(const NeighborListRCutRequest&) = delete;
+
+    /// Set the cutoff for all type pairs
+    void setRCut(Scalar r_cut)
+        {
+        fillRCutMatrix(r_cut);
+        m_nlist->notifyRCutMatrixChange();
+        }
+
+    /// Remove the r_cut matrix from the neighbor list
+    void detach()
+        {
+        if (m_attached)
+            {
+            m_nlist->removeRCutMatrix(m_r_cut_nlist);
+            }
+        m_attached = false;
+        }
+
+    private:
+    /// Neighbor list the r_cut matrix is registered with
+    std::shared_ptr<NeighborList> m_nlist;
+
+    /// r_cut for every type pair
+    std::shared_ptr<GlobalArray<Scalar>> m_r_cut_nlist;
+
+    /// Name of the owner in error messages
+    std::string m_name;
+
+    /// True while the r_cut matrix is registered with the neighbor list
+    bool m_attached = true;
+
+    /// Validate r_cut and write it to the r_cut matrix
+    void fillRCutMatrix(Scalar r_cut)
+        {
+        if (!(r_cut > Scalar(0.0)))
+            {
+            throw std::invalid_argument(m_name + " r_max must be positive.");
+            }
+
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        for (size_t i = 0; i < m_r_cut_nlist->getNumElements(); i++)
+            {
+            h_r_cut_nlist.data[i] = r_cut;
+            }
+        }
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -36,6 +36,9 @@ NeighborListStencil::NeighborListStencil(std::shared_ptr<SystemDefinition> sysde
     m_cl->setComputeTypeBody(true);
     m_cl->setFlagIndex();
     m_cl->setComputeAdjList(false);
+
+    m_level_cl.assign(1, m_cl);
+    m_level_cls.assign(1, m_cls);
     }
 
 NeighborListStencil::~NeighborListStencil()
@@ -45,6 +48,15 @@ NeighborListStencil::~NeighborListStencil()
 
 void NeighborListStencil::updateRStencil()
     {
+    if (!m_type_level.empty())
+        {
+        for (unsigned int level = 0; level < m_level_cls.size(); ++level)
+            {
+            m_level_cls[level]->setRStencil(computeCellLevelRStencil(m_type_level, level));
+            }
+        return;
+        }
+
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
     std::vector<Scalar> rstencil(m_pdata->getNTypes(), -1.0);
     for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
@@ -59,9 +71,17 @@ void NeighborListStencil::updateRStencil()
     m_cls->setRStencil(rstencil);
     }
 
-void NeighborListStencil::buildNlist(uint64_t timestep)
+/*! Without multilevel cell lists, m_cl holds all particles and its width is set by the smallest
+    cutoff. With multilevel cell lists, each level of types from computeCellLevels() has its own
+    cell list and stencil, m_cl is the finest level.
+*/
+void NeighborListStencil::updateCellLevels()
     {
-    if (m_update_cell_size)
+    std::vector<Scalar> level_width;
+    if (m_multilevel)
+        level_width = computeCellLevels(m_type_level);
+
+    if (level_width.empty())
         {
         // update the cell size if the user has not forced a specific size
         if (!m_override_cell_width)
@@ -71,10 +91,52 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
             m_cl->setNominalWidth(rmin);
             }
 
+        if (!m_type_level.empty())
+            m_cl->setTypeMask(std::vector<unsigned int>());
+        m_type_level.clear();
+        m_level_cl.assign(1, m_cl);
+        m_level_cls.assign(1, m_cls);
+        return;
+        }
+
+    m_level_cl.resize(level_width.size());
+    m_level_cls.resize(level_width.size());
+    m_level_cl[0] = m_cl;
+    m_level_cls[0] = m_cls;
+    for (unsigned int level = 0; level < level_width.size(); ++level)
+        {
+        if (!m_level_cl[level])
+            {
+            m_level_cl[level] = std::make_shared<CellList>(m_sysdef);
+            m_level_cl[level]->setRadius(1);
+            m_level_cl[level]->setComputeTypeBody(true);
+            m_level_cl[level]->setFlagIndex();
+            m_level_cl[level]->setComputeAdjList(false);
+            m_level_cl[level]->setSortCellList(m_cl->getSortCellList());
+            m_level_cls[level] = std::make_shared<CellListStencil>(m_sysdef, m_level_cl[level]);
+            }
+
+        std::vector<unsigned int> type_mask(m_pdata->getNTypes(), 0);
+        for (unsigned int cur_type = 0; cur_type < m_pdata->getNTypes(); ++cur_type)
+            type_mask[cur_type] = (m_type_level[cur_type] == level) ? 1 : 0;
+        m_level_cl[level]->setTypeMask(type_mask);
+
+        // the user set width applies to the finest level
+        if (level > 0 || !m_override_cell_width)
+            m_level_cl[level]->setNominalWidth(level_width[level]);
+        }
+    }
+
+void NeighborListStencil::buildNlist(uint64_t timestep)
+    {
+    if (m_update_cell_size)
+        {
+        updateCellLevels();
         m_update_cell_size = false;
         }
 
-    m_cl->compute(timestep);
+    for (auto& cl : m_level_cl)
+        cl->compute(timestep);
 
     // update the stencil radii if there was a change
     if (m_needs_restencil)
@@ -82,10 +144,8 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
         updateRStencil();
         m_needs_restencil = false;
         }
-    m_cls->compute(timestep);
-
-    uint3 dim = m_cl->getDim();
-    Scalar3 ghost_width = m_cl->getGhostWidth();
+    for (auto& cls : m_level_cls)
+        cls->compute(timestep);
 
     // acquire the particle data and box dimension
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
@@ -122,22 +182,7 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
 
     // access the rlist data
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
-
-    // access the cell list data arrays
-    ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
-                                          access_location::host,
-                                          access_mode::read);
-    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
-                                     access_location::host,
-                                     access_mode::read);
-    ArrayHandle<uint2> h_cell_type_body(m_cl->getTypeBodyArray(),
-                                        access_location::host,
-                                        access_mode::read);
-    ArrayHandle<Scalar4> h_stencil(m_cls->getStencils(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_n_stencil(m_cls->getStencilSizes(),
-                                          access_location::host,
-                                          access_mode::read);
-    const Index2D& stencil_idx = m_cls->getStencilIndexer();
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
 
     // access the neighbor list data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
@@ -148,157 +193,196 @@ void NeighborListStencil::buildNlist(uint64_t timestep)
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
-    // access indexers
-    Index3D ci = m_cl->getCellIndexer();
-    Index2D cli = m_cl->getCellListIndexer();
+    // access the exclusions, which are removed as the list is built
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
 
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
+    for (unsigned int level = 0; level < m_level_cl.size(); ++level)
         {
-        unsigned int cur_n_neigh = 0;
-
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
-
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
-        int ib = (unsigned int)(f.x * dim.x);
-        int jb = (unsigned int)(f.y * dim.y);
-        int kb = (unsigned int)(f.z * dim.z);
-
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
-
-        // loop through all neighboring bins
-        unsigned int n_stencil = h_n_stencil.data[type_i];
-        for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
+        const std::shared_ptr<CellList>& cl = m_level_cl[level];
+        const std::shared_ptr<CellListStencil>& cls = m_level_cls[level];
+
+        uint3 dim = cl->getDim();
+        Scalar3 ghost_width = cl->getGhostWidth();
+
+        // access the cell list data arrays
+        ArrayHandle<unsigned int> h_cell_size(cl->getCellSizeArray(),
+                                              access_location::host,
+                                              access_mode::read);
+        ArrayHandle<Scalar4> h_cell_xyzf(cl->getXYZFArray(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<uint2> h_cell_type_body(cl->getTypeBodyArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<Scalar4> h_stencil(cls->getStencils(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> h_n_stencil(cls->getStencilSizes(),
+                                              access_location::host,
+                                              access_mode::read);
+        const Index2D& stencil_idx = cls->getStencilIndexer();
+
+        // access indexers
+        Index3D ci = cl->getCellIndexer();
+        Index2D cli = cl->getCellListIndexer();
+
+        for (int i = 0; i < (int)nparticles; i++)
             {
-            // compute the stenciled cell cartesian coordinates
-            Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
-            int sib = ib + __scalar_as_int(stencil.x);
-            int sjb = jb + __scalar_as_int(stencil.y);
-            int skb = kb + __scalar_as_int(stencil.z);
-            Scalar cell_dist2 = stencil.w;
-            // wrap through the boundary
-            if (periodic.x)
+            // the levels append to the neighbors found in the previous levels
+            unsigned int cur_n_neigh = (level == 0) ? 0 : h_n_neigh.data[i];
+
+            const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int body_i = h_body.data[i];
+
+            const unsigned int Nmax_i = h_Nmax.data[type_i];
+            const size_t head_idx_i = h_head_list.data[i];
+
+            // find the bin each particle belongs in
+            Scalar3 f = box.makeFraction(my_pos, ghost_width);
+            int ib = (unsigned int)(f.x * dim.x);
+            int jb = (unsigned int)(f.y * dim.y);
+            int kb = (unsigned int)(f.z * dim.z);
+
+            // need to handle the case where the particle is exactly at the box hi
+            if (ib == (int)dim.x && periodic.x)
+                ib = 0;
+            if (jb == (int)dim.y && periodic.y)
+                jb = 0;
+            if (kb == (int)dim.z && periodic.z)
+                kb = 0;
+
+            // loop through all neighboring bins
+            unsigned int n_stencil = h_n_stencil.data[type_i];
+            for (unsigned int cur_stencil = 0; cur_stencil < n_stencil; ++cur_stencil)
                 {
-                if (sib >= (int)dim.x)
-                    sib -= dim.x;
-                else if (sib < 0)
-                    sib += dim.x;
+                // compute the stenciled cell cartesian coordinates
+                Scalar4 stencil = h_stencil.data[stencil_idx(cur_stencil, type_i)];
+                int sib = ib + __scalar_as_int(stencil.x);
+                int sjb = jb + __scalar_as_int(stencil.y);
+                int skb = kb + __scalar_as_int(stencil.z);
+                Scalar cell_dist2 = stencil.w;
+                // wrap through the boundary
+                if (periodic.x)
+                    {
+                    if (sib >= (int)dim.x)
+                        sib -= dim.x;
+                    else if (sib < 0)
+                        sib += dim.x;
 
-                // wrapping and the stencil construction should ensure this is in bounds
-                assert(sib >= 0 && sib < (int)dim.x);
-                }
-            else if (sib < 0 || sib >= (int)dim.x)
-                {
-                // in aperiodic systems the stencil could maybe extend out of the grid
-                continue;
-                }
+                    // wrapping and the stencil construction should ensure this is in bounds
+                    assert(sib >= 0 && sib < (int)dim.x);
+                    }
+                else if (sib < 0 || sib >= (int)dim.x)
+                    {
+                    // in aperiodic systems the stencil could maybe extend out of the grid
+                    continue;
+                    }
 
-            if (periodic.y)
-                {
-                if (sjb >= (int)dim.y)
-                    sjb -= dim.y;
-                else if (sjb < 0)
-                    sjb += dim.y;
+                if (periodic.y)
+                    {
+                    if (sjb >= (int)dim.y)
+                        sjb -= dim.y;
+                    else if (sjb < 0)
+                        sjb += dim.y;
 
-                assert(sjb >= 0 && sjb < (int)dim.y);
-                }
-            else if (sjb < 0 || sjb >= (int)dim.y)
-                {
-                continue;
-                }
+                    assert(sjb >= 0 && sjb < (int)dim.y);
+                    }
+                else if (sjb < 0 || sjb >= (int)dim.y)
+                    {
+                    continue;
+                    }
 
-            if (periodic.z)
-                {
-                if (skb >= (int)dim.z)
-                    skb -= dim.z;
-                else if (skb < 0)
-                    skb += dim.z;
+                if (periodic.z)
+                    {
+                    if (skb >= (int)dim.z)
+                        skb -= dim.z;
+                    else if (skb < 0)
+                        skb += dim.z;
 
-                assert(skb >= 0 && skb < (int)dim.z);
-                }
-            else if (skb < 0 || skb >= (int)dim.z)
-                {
-                continue;
-                }
+                    assert(skb >= 0 && skb < (int)dim.z);
+                    }
+                else if (skb < 0 || skb >= (int)dim.z)
+                    {
+                    continue;
+                    }
 
-            unsigned int neigh_cell = ci(sib, sjb, skb);
+                unsigned int neigh_cell = ci(sib, sjb, skb);
 
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
-                {
-                // read in the particle type (diameter and body as well while we've got the Scalar4
-                // in)
-                const uint2& neigh_type_body = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
-                const unsigned int type_j = neigh_type_body.x;
-                const unsigned int body_j = neigh_type_body.y;
-
-                // skip any particles belonging to the same body if requested
-                if (m_filter_body && body_i != NO_BODY && body_i == body_j)
-                    continue;
+                // check against all the particles in that neighboring bin to see if it is a
+                // neighbor
+                unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+                    {
+                    // read in the particle type (diameter and body as well while we've got the
+                    // Scalar4 in)
+                    const uint2& neigh_type_body
+                        = h_cell_type_body.data[cli(cur_offset, neigh_cell)];
+                    const unsigned int type_j = neigh_type_body.x;
+                    const unsigned int body_j = neigh_type_body.y;
 
-                // read cutoff and skip if pair is inactive
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
-                if (r_cut <= Scalar(0.0))
-                    continue;
+                    // skip any particles belonging to the same body if requested
+                    if (m_filter_body && body_i != NO_BODY && body_i == body_j)
+                        continue;
 
-                // compute the rlist based on the particle type we're interacting with
-                Scalar r_list = r_cut + m_r_buff;
-                Scalar r_listsq = r_list * r_list;
+                    // read cutoff and skip if pair is inactive
+                    Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, type_j)];
+                    if (r_cut <= Scalar(0.0))
+                        continue;
 
-                // compare the check distance to the minimum cell distance, and pass without
-                // distance check if unnecessary
-                if (cell_dist2 > r_listsq)
-                    continue;
+                    // read the rlist based on the particle type we're interacting with
+                    Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, type_j)];
 
-                // only load in the particle position and id if distance check is satisfied
-                const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
+                    // compare the check distance to the minimum cell distance, and pass without
+                    // distance check if unnecessary
+                    if (cell_dist2 > r_listsq)
+                        continue;
 
-                // a particle cannot neighbor itself
-                if (i == (int)cur_neigh)
-                    continue;
+                    // only load in the particle position and id if distance check is satisfied
+                    const Scalar4& neigh_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                    unsigned int cur_neigh = __scalar_as_int(neigh_xyzf.w);
 
-                Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
+                    // a particle cannot neighbor itself
+                    if (i == (int)cur_neigh)
+                        continue;
 
-                Scalar dr_sq = dot(dx, dx);
+                    Scalar3 neigh_pos = make_scalar3(neigh_xyzf.x, neigh_xyzf.y, neigh_xyzf.z);
+                    Scalar3 dx = my_pos - neigh_pos;
+                    dx = box.minImage(dx);
 
-                if (dr_sq <= r_listsq)
-                    {
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    Scalar dr_sq = dot(dx, dx);
+
+                    if (dr_sq <= r_listsq)
                         {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        if (m_exclusions_set
+                            && isExcluded(i, cur_neigh, h_n_ex_idx.data, h_ex_list_idx.data))
+                            continue;
+
+                        if (m_storage_mode == full || i < (int)cur_neigh)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            // local neighbor
+                            if (cur_n_neigh < Nmax_i)
+                                {
+                                h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                }
+                            else
+                                h_conditions.data[type_i]
+                                    = max(h_conditions.data[type_i], cur_n_neigh + 1);
+
+                            ++cur_n_neigh;
                             }
-                        else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        ++cur_n_neigh;
                         }
                     }
                 }
-            }
 
-        h_n_neigh.data[i] = cur_n_neigh;
+            h_n_neigh.data[i] = cur_n_neigh;
+            }
         }
     }
 
@@ -315,7 +399,10 @@ void export_NeighborListStencil(pybind11::module& m)
                       &NeighborListStencil::setCellWidth)
         .def_property("deterministic",
                       &NeighborListStencil::getDeterministic,
-                      &NeighborListStencil::setDeterministic);
+                      &NeighborListStencil::setDeterministic)
+        .def_property("multilevel",
+                      &NeighborListStencil::getMultilevel,
+                      &NeighborListStencil::setMultilevel);
     }
 
     } // end namespace detail
@@ -14,6 +14,7 @@
 #endif
 
 #include <pybind11/pybind11.h>
+#include <vector>
 
 #ifndef __NEIGHBORLISTSTENCIL_H__
 #define __NEIGHBORLISTSTENCIL_H__
@@ -25,6 +26,10 @@ namespace md
 //! Efficient neighbor list build on the CPU with multiple bin stencils
 /*! Implements the O(N) neighbor list build on the CPU using a cell list with multiple bin stencils.
 
+    In multilevel mode, the types are grouped into levels of similar cutoffs, each with its own cell
+    list and stencils (see NeighborList::computeCellLevels()). The particles search the cell list
+    of every level with a stencil sized for their largest cutoff with the types in that level.
+
     \sa CellListStencil
     \ingroup computes
 */
@@ -56,6 +61,8 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
     void setDeterministic(bool deterministic)
         {
         m_cl->setSortCellList(deterministic);
+        for (auto& cl : m_level_cl)
+            cl->setSortCellList(deterministic);
         }
 
     bool getDeterministic()
@@ -68,10 +75,30 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
         return m_cl->getNominalWidth();
         }
 
+    /// Set whether to use one cell list per level of types with similar cutoffs
+    void setMultilevel(bool multilevel)
+        {
+        m_multilevel = multilevel;
+        m_update_cell_size = true;
+        m_needs_restencil = true;
+        }
+
+    /// Get whether to use one cell list per level of types with similar cutoffs
+    bool getMultilevel()
+        {
+        return m_multilevel;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
 
+    /// The build removes the excluded pairs
+    virtual bool buildFiltersExclusions()
+        {
+        return true;
+        }
+
     private:
     std::shared_ptr<CellList> m_cl;         //!< The cell list
     std::shared_ptr<CellListStencil> m_cls; //!< The cell list stencil
@@ -82,8 +109,23 @@ class PYBIND11_EXPORT NeighborListStencil : public NeighborList
     /// Track when the cell size needs to be updated
     bool m_update_cell_size = true;
 
+    /// True to use one cell list per level of types
+    bool m_multilevel = false;
+
+    /// Cell lists of the levels, the first is m_cl
+    std::vector<std::shared_ptr<CellList>> m_level_cl;
+
+    /// Stencils of the levels, the first is m_cls
+    std::vector<std::shared_ptr<CellListStencil>> m_level_cls;
+
+    /// Level of each type, empty when all particles are in m_cl
+    std::vector<unsigned int> m_type_level;
+
     //! Update the stencil radius
     void updateRStencil();
+
+    /// Set up the cell lists of the levels and their widths
+    void updateCellLevels();
     };
 
     } // end namespace md
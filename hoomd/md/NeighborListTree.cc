@@ -12,6 +12,12 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -72,6 +78,8 @@ void NeighborListTree::setupTree()
         // fixed using scoped pointers as well
         m_aabb_trees.clear();
         m_aabb_trees.resize(m_pdata->getNTypes());
+        m_wide_aabb_trees.clear();
+        m_wide_aabb_trees.resize(m_pdata->getNTypes());
 
         m_num_per_type.resize(m_pdata->getNTypes(), 0);
         m_type_head.resize(m_pdata->getNTypes(), 0);
@@ -256,21 +264,64 @@ void NeighborListTree::buildTree()
         h_aabbs.data[my_aabb_idx] = hoomd::detail::AABB(my_pos, i);
         }
 
+    /* The trees may be refit to the new positions when the particles have the same indices as at
+     * the last build. Refitting keeps the tree topology, so the trees are rebuilt from scratch
+     * after m_max_refits consecutive refits. In MPI simulations, the ghost particles change at
+     * every build.
+     */
+    const unsigned int n_particles = m_pdata->getN() + m_pdata->getNGhosts();
+    bool refit = m_trees_refittable && m_num_refits < m_max_refits
+                 && n_particles == m_trees_num_particles;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        refit = false;
+#endif
+    if (refit)
+        {
+        m_num_refits++;
+        }
+    else
+        {
+        m_num_refits = 0;
+        m_trees_num_particles = n_particles;
+        m_trees_refittable = true;
+        }
+
     // call the tree build routine, one tree per type
-    for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+    auto build_type_tree = [&](unsigned int i)
         {
         if (m_num_per_type[i] > 0)
             {
-            m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
+            if (refit)
+                m_aabb_trees[i].refit(&(h_aabbs.data[0]) + m_type_head[i], m_num_per_type[i]);
+            else
+                m_aabb_trees[i].buildTree(&(h_aabbs.data[0]) + m_type_head[i],
+                                          m_num_per_type[i]);
+
+            m_wide_aabb_trees[i].build(m_aabb_trees[i]);
             }
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // the trees of different types are independent
+        m_exec_conf->getTaskArena()->execute(
+            [&] { tbb::parallel_for((unsigned int)0, m_pdata->getNTypes(), build_type_tree); });
+        }
+    else
+#endif
+        {
+        for (unsigned int i = 0; i < m_pdata->getNTypes(); ++i)
+            build_type_tree(i);
         }
     }
 
 /*!
- * Each AABBTree is traversed in a stackless fashion. One traversal is performed (per particle)-(per
- * tree)-(per image). The stackless traversal is a variation on left descent, where each node knows
- * how far ahead to advance in the list of nodes if there is no intersection between the current
- * node AABB and the query AABB. Otherwise, the search advances by one to the next node in the list.
+ * One traversal is performed (per particle)-(per tree)-(per image) on the WideAABBTree collapsed
+ * from each AABBTree. Each node of the wide tree tests the query AABB against its four children
+ * with SIMD instructions, so the traversal visits fewer nodes than the stackless traversal of the
+ * binary tree.
  */
 void NeighborListTree::traverseTree()
     {
@@ -283,18 +334,24 @@ void NeighborListTree::traverseTree()
                                      access_mode::read);
 
     ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
 
     // neighborlist data
     ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_conditions(m_conditions,
-                                           access_location::host,
-                                           access_mode::readwrite);
     ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
     ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
 
-    // Loop over all particles
-    for (unsigned int i = 0; i < m_pdata->getN(); ++i)
+    // access the exclusions, which are removed as the list is built
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // traverse the trees for particle i, recording any overflow of Nmax in conditions and passing
+    // the stored neighbors to cluster_builder
+    auto traverse_particle
+        = [&](unsigned int i, unsigned int* conditions, ClusterPairBuilder* cluster_builder)
         {
         // read in the current position and orientation
         const Scalar4 postype_i = h_postype.data[i];
@@ -319,11 +376,10 @@ void NeighborListTree::traverseTree()
                 continue;
 
             // Determine the minimum r_cut_i (with buffer) for this particle
-            Scalar r_cut_i = r_cut + m_r_buff;
-            Scalar r_cutsq_i = r_cut_i * r_cut_i;
-            Scalar r_list_i = r_cut_i;
+            Scalar r_cutsq_i = h_r_listsq.data[m_typpair_idx(type_i, cur_pair_type)];
+            Scalar r_list_i = slow::sqrt(r_cutsq_i);
 
-            hoomd::detail::AABBTree* cur_aabb_tree = &m_aabb_trees[cur_pair_type];
+            const hoomd::detail::WideAABBTree& cur_aabb_tree = m_wide_aabb_trees[cur_pair_type];
 
             for (unsigned int cur_image = 0; cur_image < m_n_images;
                  ++cur_image) // for each image vector
@@ -332,64 +388,53 @@ void NeighborListTree::traverseTree()
                 vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
                 hoomd::detail::AABB aabb = hoomd::detail::AABB(pos_i_image, r_list_i);
 
-                // stackless traversal of the tree
-                for (unsigned int cur_node_idx = 0; cur_node_idx < cur_aabb_tree->getNumNodes();
-                     ++cur_node_idx)
+                // the tree stores the particle index as the tag of each leaf entry
+                cur_aabb_tree.query(
+                    aabb,
+                    [&](unsigned int, unsigned int j)
                     {
-                    if (aabb.overlaps(cur_aabb_tree->getNodeAABB(cur_node_idx)))
-                        {
-                        if (cur_aabb_tree->isNodeLeaf(cur_node_idx))
+                        // skip self-interaction always
+                        bool excluded = (i == j);
+
+                        if (m_filter_body && body_i != NO_BODY)
+                            excluded = excluded | (body_i == h_body.data[j]);
+
+                        if (excluded)
+                            return true;
+
+                        // compute distance
+                        Scalar4 postype_j = h_postype.data[j];
+                        Scalar3 drij = make_scalar3(postype_j.x, postype_j.y, postype_j.z)
+                                       - vec_to_scalar3(pos_i_image);
+                        Scalar dr_sq = dot(drij, drij);
+
+                        if (dr_sq <= r_cutsq_i)
                             {
-                            for (unsigned int cur_p = 0;
-                                 cur_p < cur_aabb_tree->getNodeNumParticles(cur_node_idx);
-                                 ++cur_p)
+                            if (m_exclusions_set
+                                && isExcluded(i, j, h_n_ex_idx.data, h_ex_list_idx.data))
+                                return true;
+
+                            if (m_storage_mode == full || i < j)
                                 {
-                                // neighbor j
-                                unsigned int j
-                                    = cur_aabb_tree->getNodeParticleTag(cur_node_idx, cur_p);
-
-                                // skip self-interaction always
-                                bool excluded = (i == j);
-
-                                if (m_filter_body && body_i != NO_BODY)
-                                    excluded = excluded | (body_i == h_body.data[j]);
-
-                                if (!excluded)
-                                    {
-                                    // compute distance
-                                    Scalar4 postype_j = h_postype.data[j];
-                                    Scalar3 drij
-                                        = make_scalar3(postype_j.x, postype_j.y, postype_j.z)
-                                          - vec_to_scalar3(pos_i_image);
-                                    Scalar dr_sq = dot(drij, drij);
-
-                                    if (dr_sq <= r_cutsq_i)
-                                        {
-                                        if (m_storage_mode == full || i < j)
-                                            {
-                                            if (n_neigh_i < Nmax_i)
-                                                h_nlist.data[nlist_head_i + n_neigh_i] = j;
-                                            else
-                                                h_conditions.data[type_i]
-                                                    = max(h_conditions.data[type_i], n_neigh_i + 1);
-
-                                            ++n_neigh_i;
-                                            }
-                                        }
-                                    }
+                                if (n_neigh_i < Nmax_i)
+                                    h_nlist.data[nlist_head_i + n_neigh_i] = j;
+                                else
+                                    conditions[type_i] = max(conditions[type_i], n_neigh_i + 1);
+
+                                if (cluster_builder)
+                                    cluster_builder->add(i % cluster_size, j);
+
+                                ++n_neigh_i;
                                 }
                             }
-                        }
-                    else
-                        {
-                        // skip ahead
-                        cur_node_idx += cur_aabb_tree->getNodeSkip(cur_node_idx);
-                        }
-                    } // end stackless search
+                        return true;
+                    });
                 }     // end loop over images
             }         // end loop over pair types
         h_n_neigh.data[i] = n_neigh_i;
-        } // end loop over particles
+        };
+
+    buildParticles(traverse_particle);
     }
 
 namespace detail
@@ -399,7 +444,10 @@ void export_NeighborListTree(pybind11::module& m)
     pybind11::class_<NeighborListTree, NeighborList, std::shared_ptr<NeighborListTree>>(
         m,
         "NeighborListTree")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("max_refits",
+                      &NeighborListTree::getMaxRefits,
+                      &NeighborListTree::setMaxRefits);
     }
 
     } // end namespace detail
@@ -3,6 +3,7 @@
 
 #include "NeighborList.h"
 #include "hoomd/AABBTree.h"
+#include "hoomd/WideAABBTree.h"
 #include <vector>
 
 /*! \file NeighborListTree.h
@@ -49,10 +50,28 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     //! Destructor
     virtual ~NeighborListTree();
 
+    /// Set the number of consecutive builds that refit the trees instead of rebuilding them
+    void setMaxRefits(unsigned int max_refits)
+        {
+        m_max_refits = max_refits;
+        }
+
+    /// Get the number of consecutive builds that refit the trees instead of rebuilding them
+    unsigned int getMaxRefits() const
+        {
+        return m_max_refits;
+        }
+
     protected:
     //! Builds the neighbor list
     virtual void buildNlist(uint64_t timestep);
 
+    /// The build removes the excluded pairs
+    virtual bool buildFiltersExclusions()
+        {
+        return true;
+        }
+
     private:
     //! Notification of a box size change
     void slotBoxChanged()
@@ -70,6 +89,7 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     void slotRemapParticles()
         {
         m_remap_particles = true;
+        m_trees_refittable = false;
         }
 
     bool m_box_changed;     //!< Flag if box size has changed
@@ -79,9 +99,24 @@ class PYBIND11_EXPORT NeighborListTree : public NeighborList
     /// set to true when the type data has been allocated
     bool m_types_allocated;
 
+    /// Number of consecutive builds that refit the trees
+    unsigned int m_max_refits = 0;
+
+    /// Number of refits since the trees were last built from scratch
+    unsigned int m_num_refits = 0;
+
+    /// True when the particle indices are unchanged since the trees were built
+    bool m_trees_refittable = false;
+
+    /// Number of local and ghost particles when the trees were built
+    unsigned int m_trees_num_particles = 0;
+
     // we use stl vectors here because these tree data structures should *never* be
     // accessed on the GPU, they were optimized for the CPU with SIMD support
     std::vector<hoomd::detail::AABBTree> m_aabb_trees; //!< Flat array of AABB trees of all types
+
+    /// 4-wide trees collapsed from m_aabb_trees, used for traversal
+    std::vector<hoomd::detail::WideAABBTree> m_wide_aabb_trees;
     GPUVector<hoomd::detail::AABB> m_aabbs;            //!< Flat array of AABBs of all types
     std::vector<unsigned int> m_num_per_type;          //!< Total number of particles per type
     std::vector<unsigned int> m_type_head; //!< Index of first particle of each type, after sorting
@@ -0,0 +1,358 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "PPPMDispersionForceCompute.h"
+#include "EvaluatorPairDispersionEwald.h"
+
+#include <map>
+
+/*! \file PPPMDispersionForceCompute.cc
+    \brief Contains code for the PPPMDispersionForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef The system definition
+    \param nlist Neighbor list that provides the exclusions
+    \param group Particles to include in the sum
+*/
+PPPMDispersionForceCompute::PPPMDispersionForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                                       std::shared_ptr<NeighborList> nlist,
+                                                       std::shared_ptr<ParticleGroup> group)
+    : PPPMForceCompute(sysdef, nlist, group), m_c(m_pdata->getNTypes(), Scalar(0.0)),
+      m_particle_c(m_pdata->getN(), m_exec_conf)
+    {
+    }
+
+/*! \param type_name Name of the particle type
+    \param c6 Dispersion coefficient C6 of a pair of particles of this type
+*/
+void PPPMDispersionForceCompute::setC6(const std::string& type_name, Scalar c6)
+    {
+    if (c6 < Scalar(0.0))
+        {
+        throw std::invalid_argument("C6 must be non-negative.");
+        }
+
+    m_c[m_pdata->getTypeByName(type_name)] = sqrt(c6);
+
+    // the coefficient sums change
+    m_ptls_added_removed = true;
+    }
+
+Scalar PPPMDispersionForceCompute::getC6(const std::string& type_name)
+    {
+    Scalar c = m_c[m_pdata->getTypeByName(type_name)];
+    return c * c;
+    }
+
+void PPPMDispersionForceCompute::updateParticleCoefficients()
+    {
+    if (m_particle_c.getNumElements() < m_pdata->getN())
+        {
+        m_particle_c.resize(m_pdata->getN());
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar> h_particle_c(m_particle_c, access_location::host, access_mode::overwrite);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        h_particle_c.data[i] = m_c[__scalar_as_int(h_postype.data[i].w)];
+        }
+    }
+
+void PPPMDispersionForceCompute::computeForces(uint64_t timestep)
+    {
+    // particles are reordered and migrate between ranks, refresh the coefficients every step
+    updateParticleCoefficients();
+
+    PPPMForceCompute::computeForces(timestep);
+    }
+
+void PPPMDispersionForceCompute::setupCoeffs()
+    {
+    ArrayHandle<Scalar> h_particle_c(m_particle_c, access_location::host, access_mode::read);
+
+    // the sums of the coefficients take the place of the charge sums
+    m_q = Scalar(0.0);
+    m_q2 = Scalar(0.0);
+
+    unsigned int group_size = m_group->getNumMembers();
+    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+        {
+        unsigned int j = m_group->getMemberIndex(group_idx);
+
+        m_q += h_particle_c.data[j];
+        m_q2 += h_particle_c.data[j] * h_particle_c.data[j];
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &m_q,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &m_q2,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    // initialize coefficients for charge assignment
+    compute_rho_coeff();
+
+    // initialize coefficients for Green's function
+    compute_gf_denom();
+    }
+
+/*! With b = k / (2 beta), the Fourier transform of -(1 - g(beta r)) / r^6 is
+    -pi^(3/2) beta^3 / 3 [(1 - 2 b^2) exp(-b^2) + 2 b^3 sqrt(pi) erfc(b)].
+*/
+Scalar PPPMDispersionForceCompute::computeReferencePotential(Scalar ksq)
+    {
+    Scalar beta = m_kappa;
+    Scalar b = sqrt(ksq) / (Scalar(2.0) * beta);
+    Scalar bsq = b * b;
+    Scalar f = (Scalar(1.0) - Scalar(2.0) * bsq) * exp(-bsq)
+               + Scalar(2.0) * bsq * b * sqrt(Scalar(M_PI)) * erfc(b);
+
+    return -pow(Scalar(M_PI), Scalar(1.5)) * beta * beta * beta / Scalar(3.0) * f;
+    }
+
+Scalar PPPMDispersionForceCompute::computeVirialFactor(Scalar ksq)
+    {
+    Scalar beta = m_kappa;
+    Scalar b = sqrt(ksq) / (Scalar(2.0) * beta);
+    Scalar bsq = b * b;
+    Scalar expfac = exp(-bsq);
+    Scalar sqrtpi_b_erfc = sqrt(Scalar(M_PI)) * b * erfc(b);
+    Scalar f = (Scalar(1.0) - Scalar(2.0) * bsq) * expfac + Scalar(2.0) * bsq * sqrtpi_b_erfc;
+
+    // df/db = 6 b (sqrt(pi) b erfc(b) - exp(-b^2)) and db/dk = 1 / (2 beta)
+    return Scalar(6.0) * (sqrtpi_b_erfc - expfac) / (Scalar(4.0) * beta * beta * f);
+    }
+
+/*! The long-range part of the interaction of a particle with itself is -c_i^2 beta^6 / 6.
+    \returns The self-energy of the group members
+*/
+Scalar PPPMDispersionForceCompute::computeSelfEnergy()
+    {
+    Scalar beta_sq = m_kappa * m_kappa;
+    return -m_q2 * beta_sq * beta_sq * beta_sq / Scalar(12.0);
+    }
+
+void PPPMDispersionForceCompute::computeInfluenceFunction()
+    {
+    PPPMForceCompute::computeInfluenceFunction();
+
+    // the k = 0 term does not vanish, the assignment conserves the sum of the coefficients so the
+    // influence function is the reference potential there
+    if (m_n_inner_cells == 0)
+        return;
+
+    ArrayHandle<Scalar> h_inf_f(m_inf_f, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar3> h_k(m_k, access_location::host, access_mode::read);
+
+    // only the rank that holds the DC bin stores k = 0 in its first cell
+    Scalar3 k = h_k.data[0];
+    if (k.x == Scalar(0.0) && k.y == Scalar(0.0) && k.z == Scalar(0.0))
+        {
+        h_inf_f.data[0] = computeReferencePotential(Scalar(0.0));
+        }
+    }
+
+/*! The reciprocal space sum includes the long-range part of the interaction between all pairs,
+    subtract it for the excluded pairs.
+*/
+void PPPMDispersionForceCompute::fixExclusions()
+    {
+    unsigned int group_size = m_group->getNumMembers();
+    if (group_size == 0)
+        return;
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::readwrite);
+
+    // reset virial (but not forces, interpolateForces resets them)
+    memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    size_t virial_pitch = m_virial.getPitch();
+
+    ArrayHandle<unsigned int> h_group_members(m_group->getIndexArray(),
+                                              access_location::host,
+                                              access_mode::read);
+    const BoxDim& box = m_pdata->getBox();
+    ArrayHandle<unsigned int> h_exlist(m_nlist->getExListArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<unsigned int> h_n_ex(m_nlist->getNExArray(),
+                                     access_location::host,
+                                     access_mode::read);
+    Index2D nex = m_nlist->getExListIndexer();
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    for (unsigned int i = 0; i < group_size; i++)
+        {
+        Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
+        Scalar virial[6];
+        for (unsigned int k = 0; k < 6; k++)
+            virial[k] = Scalar(0.0);
+        unsigned int idx = h_group_members.data[i];
+        Scalar4 postypei = h_pos.data[idx];
+        Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+        Scalar ci = m_c[__scalar_as_int(postypei.w)];
+
+        unsigned int n_neigh = h_n_ex.data[idx];
+        for (unsigned int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
+            {
+            // excluded partners may be ghosts, look up their coefficient by type
+            unsigned int cur_j = h_exlist.data[nex(idx, neigh_idx)];
+            Scalar4 postypej = h_pos.data[cur_j];
+            Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+            Scalar cicj = ci * m_c[__scalar_as_int(postypej.w)];
+
+            if (cicj == Scalar(0.0))
+                continue;
+
+            Scalar3 dx = box.minImage(posi - posj);
+            Scalar rsq = dot(dx, dx);
+
+            // subtracting the attractive long-range part adds cicj (1 - g) / r^6
+            Scalar pair_eng(0.0);
+            Scalar force_divr(0.0);
+            eval_dispersion_long_range(m_kappa, rsq, pair_eng, force_divr);
+            pair_eng *= cicj;
+            force_divr *= cicj;
+
+            virial[0] += Scalar(0.5) * dx.x * dx.x * force_divr;
+            virial[1] += Scalar(0.5) * dx.y * dx.x * force_divr;
+            virial[2] += Scalar(0.5) * dx.z * dx.x * force_divr;
+            virial[3] += Scalar(0.5) * dx.y * dx.y * force_divr;
+            virial[4] += Scalar(0.5) * dx.z * dx.y * force_divr;
+            virial[5] += Scalar(0.5) * dx.z * dx.z * force_divr;
+            force.x += dx.x * force_divr;
+            force.y += dx.y * force_divr;
+            force.z += dx.z * force_divr;
+            force.w += pair_eng;
+            }
+        force.w *= Scalar(0.5);
+        h_force.data[idx].x += force.x;
+        h_force.data[idx].y += force.y;
+        h_force.data[idx].z += force.z;
+        h_force.data[idx].w += force.w;
+        for (unsigned int k = 0; k < 6; k++)
+            h_virial.data[k * virial_pitch + idx] += virial[k];
+        }
+    }
+
+void PPPMDispersionForceCompute::computeBodyCorrection()
+    {
+    // do an N^2 search over particles in a body, subtracting the long-range part of the
+    // interactions within the body from the PPPM energy
+
+    // have a global view of all particles on rank 0
+    SnapshotParticleData<Scalar> snap;
+    m_pdata->takeSnapshot(snap);
+
+    unsigned int nptl = snap.size;
+
+    m_body_energy = Scalar(0.0);
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+
+    if (m_exec_conf->getRank() == 0)
+        {
+        std::multimap<unsigned int, unsigned> body_map;
+
+        // the correction is the same for all bodies of the same type, cache it by the type of
+        // the central particle
+        std::map<unsigned int, Scalar> body_type;
+
+        for (unsigned int i = 0; i < nptl; ++i)
+            {
+            unsigned int ibody = snap.body[i];
+            if (ibody != NO_BODY)
+                body_map.insert(std::make_pair(ibody, i));
+            }
+
+        for (auto it = body_map.begin(); it != body_map.end(); it = body_map.upper_bound(it->first))
+            {
+            auto body_end = body_map.upper_bound(it->first);
+
+            unsigned int type
+                = it->first < MIN_FLOPPY ? snap.type[it->first] : snap.type[it->second];
+            auto energy_it = body_type.find(type);
+
+            if (energy_it != body_type.end())
+                {
+                m_body_energy += energy_it->second;
+                continue;
+                }
+
+            Scalar body_energy(0.0);
+            for (auto iti = it; iti != body_end; ++iti)
+                {
+                unsigned int i = iti->second;
+                vec3<Scalar> posi(snap.pos[i]);
+                int3 img_i = snap.image[i];
+                Scalar ci = m_c[snap.type[i]];
+
+                for (auto itj = it; itj != body_end; ++itj)
+                    {
+                    unsigned int j = itj->second;
+                    Scalar cicj = ci * m_c[snap.type[j]];
+
+                    if (cicj != Scalar(0.0) && i != j)
+                        {
+                        // shift into the body reference frame
+                        int3 delta_img = snap.image[j] - img_i;
+                        Scalar3 pos_j_shift = box.shift(vec_to_scalar3(vec3<Scalar>(snap.pos[j])),
+                                                        delta_img);
+                        Scalar3 dx = pos_j_shift - vec_to_scalar3(posi);
+                        Scalar rsq = dot(dx, dx);
+
+                        Scalar pair_eng(0.0);
+                        Scalar force_divr(0.0);
+                        eval_dispersion_long_range(m_kappa, rsq, pair_eng, force_divr);
+
+                        // subtract the attractive long-range part
+                        body_energy += Scalar(0.5) * cicj * pair_eng;
+                        }
+                    }
+                }
+
+            m_body_energy += body_energy;
+            body_type.insert(std::make_pair(type, body_energy));
+            }
+        }
+    }
+
+namespace detail
+    {
+void export_PPPMDispersionForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<PPPMDispersionForceCompute,
+                     PPPMForceCompute,
+                     std::shared_ptr<PPPMDispersionForceCompute>>(m, "PPPMDispersionForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            std::shared_ptr<ParticleGroup>>())
+        .def("setC6", &PPPMDispersionForceCompute::setC6)
+        .def("getC6", &PPPMDispersionForceCompute::getC6);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,92 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PPPM_DISPERSION_FORCE_COMPUTE_H__
+#define __PPPM_DISPERSION_FORCE_COMPUTE_H__
+
+#include "PPPMForceCompute.h"
+
+#include <string>
+#include <vector>
+
+/*! \file PPPMDispersionForceCompute.h
+    \brief Declares the reciprocal space part of the dispersion (LJ-PME) Ewald sum
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Compute the long-ranged part of the r^-6 dispersion interaction with PPPM
+/*! PPPMDispersionForceCompute evaluates the attractive long-range part
+    -C6_ij (1 - g(beta r)) / r^6 of the dispersion interaction between all pairs, with
+    g(x) = exp(-x^2) (1 + x^2 + x^4 / 2), on the PPPM mesh. It reuses the charge assignment, FFTs,
+    and force interpolation of PPPMForceCompute and replaces the charges with c_i = sqrt(C6_i), so
+    the pair coefficients follow the geometric mixing rule C6_ij = c_i c_j.
+
+    Unlike the Coulomb sum, the k = 0 term contributes to the energy and the virial. The real space
+    complement is computed by EvaluatorPairDispersionEwald.
+
+    The mesh is always computed on the host, also when the execution configuration is a GPU.
+*/
+class PYBIND11_EXPORT PPPMDispersionForceCompute : public PPPMForceCompute
+    {
+    public:
+    //! Constructor
+    PPPMDispersionForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                               std::shared_ptr<NeighborList> nlist,
+                               std::shared_ptr<ParticleGroup> group);
+    virtual ~PPPMDispersionForceCompute() { }
+
+    //! Set the dispersion coefficient of a particle type
+    void setC6(const std::string& type_name, Scalar c6);
+
+    //! Get the dispersion coefficient of a particle type
+    Scalar getC6(const std::string& type_name);
+
+    virtual void computeForces(uint64_t timestep);
+
+    protected:
+    std::vector<Scalar> m_c;           //!< Square root of the dispersion coefficient per type
+    GlobalArray<Scalar> m_particle_c; //!< Square root of the dispersion coefficient per particle
+
+    //! Get the per-particle coefficients that are assigned to the mesh
+    virtual const GlobalArray<Scalar>& getMeshCharges()
+        {
+        return m_particle_c;
+        }
+
+    //! Fourier transform of the long-range part of the dispersion interaction
+    virtual Scalar computeReferencePotential(Scalar ksq);
+
+    //! Logarithmic derivative of the reference potential, used in the virial
+    virtual Scalar computeVirialFactor(Scalar ksq);
+
+    //! Self-energy included in the reciprocal space sum
+    virtual Scalar computeSelfEnergy();
+
+    //! Compute the optimal influence function, including the k = 0 term
+    virtual void computeInfluenceFunction();
+
+    //! Compute the sums of the coefficients and the assignment coefficients
+    virtual void setupCoeffs();
+
+    //! Correct forces on excluded particles
+    virtual void fixExclusions();
+
+    //! Compute rigid body correction
+    virtual void computeBodyCorrection();
+
+    private:
+    //! Copy the per-type coefficients to the particles
+    void updateParticleCoefficients();
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
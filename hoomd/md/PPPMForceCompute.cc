@@ -4,6 +4,12 @@
 #include "PPPMForceCompute.h"
 #include <map>
 
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace md
@@ -38,8 +44,9 @@ PPPMForceCompute::PPPMForceCompute(std::shared_ptr<SystemDefinition> sysdef,
     : ForceCompute(sysdef), m_nlist(nlist), m_group(group), m_n_ghost_cells(make_uint3(0, 0, 0)),
       m_grid_dim(make_uint3(0, 0, 0)), m_ghost_width(make_scalar3(0, 0, 0)), m_ghost_offset(0),
       m_n_cells(0), m_radius(1), m_n_inner_cells(0), m_need_initialize(true), m_params_set(false),
-      m_box_changed(false), m_q(0.0), m_q2(0.0), m_body_energy(0.0), m_ptls_added_removed(false),
-      m_kiss_fft_initialized(false), m_dfft_initialized(false)
+      m_box_changed(false), m_box_tolerance(0.0), m_q(0.0), m_q2(0.0), m_body_energy(0.0),
+      m_ptls_added_removed(false), m_pencil_fft(false), m_kiss_fft_initialized(false),
+      m_dfft_initialized(false)
     {
     m_pdata->getBoxChangeSignal().connect<PPPMForceCompute, &PPPMForceCompute::setBoxChange>(this);
     // reset virial
@@ -472,56 +479,78 @@ void PPPMForceCompute::initializeFFT()
                 make_uint3(m_grid_dim.x, m_grid_dim.y, m_grid_dim.z),
                 m_n_ghost_cells,
                 false));
-        // set up distributed FFTs
-        int gdim[3];
-        int pdim[3];
-        Index3D decomp_idx = m_pdata->getDomainDecomposition()->getDomainIndexer();
-        pdim[0] = decomp_idx.getD();
-        pdim[1] = decomp_idx.getH();
-        pdim[2] = decomp_idx.getW();
-        gdim[0] = m_mesh_points.z * pdim[0];
-        gdim[1] = m_mesh_points.y * pdim[1];
-        gdim[2] = m_mesh_points.x * pdim[2];
         int embed[3];
         embed[0] = m_mesh_points.z + 2 * m_n_ghost_cells.z;
         embed[1] = m_mesh_points.y + 2 * m_n_ghost_cells.y;
         embed[2] = m_mesh_points.x + 2 * m_n_ghost_cells.x;
         m_ghost_offset
             = (m_n_ghost_cells.z * embed[1] + m_n_ghost_cells.y) * embed[2] + m_n_ghost_cells.x;
-        uint3 pcoord = m_pdata->getDomainDecomposition()->getGridPos();
-        int pidx[3];
-        pidx[0] = pcoord.z;
-        pidx[1] = pcoord.y;
-        pidx[2] = pcoord.x;
-        int row_m = 0; /* both local grid and proc grid are row major, no transposition necessary */
-        ArrayHandle<unsigned int> h_cart_ranks(m_pdata->getDomainDecomposition()->getCartRanks(),
-                                               access_location::host,
-                                               access_mode::read);
-        dfft_create_plan(&m_dfft_plan_forward,
-                         3,
-                         gdim,
-                         embed,
-                         NULL,
-                         pdim,
-                         pidx,
-                         row_m,
-                         0,
-                         1,
-                         m_exec_conf->getMPICommunicator(),
-                         (int*)h_cart_ranks.data);
-        dfft_create_plan(&m_dfft_plan_inverse,
-                         3,
-                         gdim,
-                         NULL,
-                         embed,
-                         pdim,
-                         pidx,
-                         row_m,
-                         0,
-                         1,
-                         m_exec_conf->getMPICommunicator(),
-                         (int*)h_cart_ranks.data);
-        m_dfft_initialized = true;
+
+        // free plans if they have already been initialized, e.g. after new parameters are set
+        if (m_dfft_initialized)
+            {
+            dfft_destroy_plan(m_dfft_plan_forward);
+            dfft_destroy_plan(m_dfft_plan_inverse);
+            m_dfft_initialized = false;
+            }
+        m_pencil_fft_plan.reset();
+
+        if (m_pencil_fft)
+            {
+            // distributed FFT on its own pencil decomposition of the ranks
+            m_pencil_fft_plan = std::unique_ptr<PencilFFT>(
+                new PencilFFT(m_sysdef, m_mesh_points, m_grid_dim));
+            }
+        else
+            {
+            // set up distributed FFTs
+            int gdim[3];
+            int pdim[3];
+            Index3D decomp_idx = m_pdata->getDomainDecomposition()->getDomainIndexer();
+            pdim[0] = decomp_idx.getD();
+            pdim[1] = decomp_idx.getH();
+            pdim[2] = decomp_idx.getW();
+            gdim[0] = m_mesh_points.z * pdim[0];
+            gdim[1] = m_mesh_points.y * pdim[1];
+            gdim[2] = m_mesh_points.x * pdim[2];
+            uint3 pcoord = m_pdata->getDomainDecomposition()->getGridPos();
+            int pidx[3];
+            pidx[0] = pcoord.z;
+            pidx[1] = pcoord.y;
+            pidx[2] = pcoord.x;
+            /* both local grid and proc grid are row major, no transposition necessary */
+            int row_m = 0;
+            ArrayHandle<unsigned int> h_cart_ranks(
+                m_pdata->getDomainDecomposition()->getCartRanks(),
+                access_location::host,
+                access_mode::read);
+
+            dfft_create_plan(&m_dfft_plan_forward,
+                             3,
+                             gdim,
+                             embed,
+                             NULL,
+                             pdim,
+                             pidx,
+                             row_m,
+                             0,
+                             1,
+                             m_exec_conf->getMPICommunicator(),
+                             (int*)h_cart_ranks.data);
+            dfft_create_plan(&m_dfft_plan_inverse,
+                             3,
+                             gdim,
+                             NULL,
+                             embed,
+                             pdim,
+                             pidx,
+                             row_m,
+                             0,
+                             1,
+                             m_exec_conf->getMPICommunicator(),
+                             (int*)h_cart_ranks.data);
+            m_dfft_initialized = true;
+            }
         }
 #endif // ENABLE_MPI
 
@@ -707,7 +736,6 @@ void PPPMForceCompute::computeInfluenceFunction()
         if (n.x != 0 || n.y != 0 || n.z != 0)
             {
             Scalar sum1(0.0);
-            Scalar numerator = Scalar(4.0 * M_PI) / dot(k, k);
 
             Scalar denominator = gf_denom(snx * snx, sny * sny, snz * snz);
 
@@ -752,16 +780,13 @@ void PPPMForceCompute::computeInfluenceFunction()
 
                         Scalar3 kn = knx + kny + knz;
                         Scalar dot1 = dot(kn, k);
-                        Scalar dot2 = dot(kn, kn) + m_alpha * m_alpha;
-
-                        Scalar arg_gauss = Scalar(0.25) * dot2 / m_kappa / m_kappa;
-                        Scalar gauss = exp(-arg_gauss);
 
-                        sum1 += (dot1 / dot2) * gauss * wx * wx * wy * wy * wz * wz;
+                        sum1 += dot1 * computeReferencePotential(dot(kn, kn)) * wx * wx * wy
+                                * wy * wz * wz;
                         }
                     }
                 }
-            h_inf_f.data[cell_idx] = numerator * sum1 / denominator;
+            h_inf_f.data[cell_idx] = sum1 / (dot(k, k) * denominator);
             }
         else // q=0
             {
@@ -772,6 +797,104 @@ void PPPMForceCompute::computeInfluenceFunction()
         }
     }
 
+/*! The influence function is rescaled only when m_box_tolerance is positive and no box length
+    changed by more than a fraction m_box_tolerance and no tilt factor changed by more than
+    m_box_tolerance since the last full computation.
+*/
+bool PPPMForceCompute::canRescaleInfluenceFunction()
+    {
+    if (m_box_tolerance <= Scalar(0.0))
+        return false;
+
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    Scalar3 L = global_box.getL();
+    Scalar3 L_ref = m_inf_f_box.getL();
+
+    Scalar delta = fabs(L.x - L_ref.x) / L_ref.x;
+    delta = std::max(delta, fabs(L.y - L_ref.y) / L_ref.y);
+    delta = std::max(delta, fabs(L.z - L_ref.z) / L_ref.z);
+    delta = std::max(delta, fabs(global_box.getTiltFactorXY() - m_inf_f_box.getTiltFactorXY()));
+    delta = std::max(delta, fabs(global_box.getTiltFactorXZ() - m_inf_f_box.getTiltFactorXZ()));
+    delta = std::max(delta, fabs(global_box.getTiltFactorYZ() - m_inf_f_box.getTiltFactorYZ()));
+
+    return delta <= m_box_tolerance;
+    }
+
+/*! The influence function is dominated by the term without aliasing, the reference potential
+    computeReferencePotential(k^2), which depends on the box only through k. Multiply each element
+    by the ratio of this term at the new and old k values and neglect the change in the aliasing
+    sums, which is small for small box changes.
+*/
+void PPPMForceCompute::rescaleInfluenceFunction()
+    {
+    ArrayHandle<Scalar> h_inf_f(m_inf_f, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar3> h_k(m_k, access_location::host, access_mode::readwrite);
+
+    // lattice vectors of the box that the stored k values belong to
+    Scalar3 a1 = m_k_box.getLatticeVector(0);
+    Scalar3 a2 = m_k_box.getLatticeVector(1);
+    Scalar3 a3 = m_k_box.getLatticeVector(2);
+
+    // reciprocal lattice vectors of the current box
+    const BoxDim& global_box = m_pdata->getGlobalBox();
+    vec3<Scalar> c1(global_box.getLatticeVector(0));
+    vec3<Scalar> c2(global_box.getLatticeVector(1));
+    vec3<Scalar> c3(global_box.getLatticeVector(2));
+    Scalar V_box = global_box.getVolume();
+    Scalar3 b1 = Scalar(2.0 * M_PI) * vec_to_scalar3(cross(c2, c3)) / V_box;
+    Scalar3 b2 = Scalar(2.0 * M_PI) * vec_to_scalar3(cross(c3, c1)) / V_box;
+    Scalar3 b3 = Scalar(2.0 * M_PI) * vec_to_scalar3(cross(c1, c2)) / V_box;
+
+    for (unsigned int cell_idx = 0; cell_idx < m_n_inner_cells; ++cell_idx)
+        {
+        // recover the Miller indices from the old k value
+        Scalar3 k_old = h_k.data[cell_idx];
+        Scalar3 n = make_scalar3(round(dot(k_old, a1) / Scalar(2.0 * M_PI)),
+                                 round(dot(k_old, a2) / Scalar(2.0 * M_PI)),
+                                 round(dot(k_old, a3) / Scalar(2.0 * M_PI)));
+        Scalar3 k = n.x * b1 + n.y * b2 + n.z * b3;
+
+        if (h_inf_f.data[cell_idx] != Scalar(0.0))
+            {
+            h_inf_f.data[cell_idx] *= computeReferencePotential(dot(k, k))
+                                      / computeReferencePotential(dot(k_old, k_old));
+            }
+
+        h_k.data[cell_idx] = k;
+        }
+    }
+
+/*! \param ksq Squared wave vector
+    \returns The Fourier transform of the screened Coulomb potential
+        4 pi / (k^2 + alpha^2) exp(-(k^2 + alpha^2) / (4 kappa^2))
+*/
+Scalar PPPMForceCompute::computeReferencePotential(Scalar ksq)
+    {
+    Scalar ksq_alpha = ksq + m_alpha * m_alpha;
+    return Scalar(4.0 * M_PI) / ksq_alpha
+           * exp(-ksq_alpha / (Scalar(4.0) * m_kappa * m_kappa));
+    }
+
+/*! \param ksq Squared wave vector (non-zero)
+    \returns The logarithmic derivative (d phi / d k) / (k phi) of the reference potential
+*/
+Scalar PPPMForceCompute::computeVirialFactor(Scalar ksq)
+    {
+    return -Scalar(2.0) * (Scalar(1.0) / ksq + Scalar(0.25) / (m_kappa * m_kappa));
+    }
+
+/*! See Frenkel and Smit, and Salin and Caillol.
+    \returns The self-energy of the charges in the group
+*/
+Scalar PPPMForceCompute::computeSelfEnergy()
+    {
+    // the k = 0 term is excluded by the vanishing influence function in the DC bin
+    return m_q2
+           * (m_kappa / sqrt(Scalar(M_PI))
+                  * exp(-m_alpha * m_alpha / (Scalar(4.0) * m_kappa * m_kappa))
+              - Scalar(0.5) * m_alpha * erfc(m_alpha / (Scalar(2.0) * m_kappa)));
+    }
+
 //! Assignment of particles to mesh using variable order interpolation scheme
 void PPPMForceCompute::assignParticles()
     {
@@ -779,7 +902,7 @@ void PPPMForceCompute::assignParticles()
                                    access_location::host,
                                    access_mode::read);
     ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getMeshCharges(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
 
@@ -790,140 +913,180 @@ void PPPMForceCompute::assignParticles()
 
     Scalar V_cell = box.getVolume() / (Scalar)(m_mesh_points.x * m_mesh_points.y * m_mesh_points.z);
 
-    // loop over group
+    // spread the charges of group members [begin, end) onto mesh
     unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    ArrayHandle<unsigned int> h_index_array(m_group->getIndexArray(),
+                                            access_location::host,
+                                            access_mode::read);
+    auto assign_items = [&](unsigned int begin, unsigned int end, kiss_fft_cpx* mesh)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
-
-        Scalar4 postype = h_postype.data[idx];
-        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-
-        // ignore if NaN
-        if (std::isnan(pos.x) || std::isnan(pos.y) || std::isnan(pos.z))
+        for (unsigned int group_idx = begin; group_idx < end; group_idx++)
             {
-            continue;
-            }
-
-        Scalar qi = h_charge.data[idx];
-
-        // compute coordinates in units of the mesh size
-        Scalar3 f = box.makeFraction(pos);
-        Scalar3 reduced_pos = make_scalar3(f.x * (Scalar)m_mesh_points.x,
-                                           f.y * (Scalar)m_mesh_points.y,
-                                           f.z * (Scalar)m_mesh_points.z);
+            unsigned int idx = h_index_array.data[group_idx];
 
-        reduced_pos.x += (Scalar)m_n_ghost_cells.x;
-        reduced_pos.y += (Scalar)m_n_ghost_cells.y;
-        reduced_pos.z += (Scalar)m_n_ghost_cells.z;
+            Scalar4 postype = h_postype.data[idx];
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
-        Scalar shift, shiftone;
+            // ignore if NaN
+            if (std::isnan(pos.x) || std::isnan(pos.y) || std::isnan(pos.z))
+                {
+                continue;
+                }
 
-        if (m_order % 2)
-            {
-            shift = 0.5;
-            shiftone = 0.0;
-            }
-        else
-            {
-            shift = 0.0;
-            shiftone = 0.5;
-            }
+            Scalar qi = h_charge.data[idx];
 
-        // find cell of the mesh the particle is in
-        int ix = int(reduced_pos.x + shift);
-        int iy = int(reduced_pos.y + shift);
-        int iz = int(reduced_pos.z + shift);
-
-        Scalar dx = shiftone + (Scalar)ix - reduced_pos.x;
-        Scalar dy = shiftone + (Scalar)iy - reduced_pos.y;
-        Scalar dz = shiftone + (Scalar)iz - reduced_pos.z;
-
-        // handle particles on the boundary
-        if (ix == (int)m_grid_dim.x && !m_n_ghost_cells.x)
-            ix = 0;
-        if (iy == (int)m_grid_dim.y && !m_n_ghost_cells.y)
-            iy = 0;
-        if (iz == (int)m_grid_dim.z && !m_n_ghost_cells.z)
-            iz = 0;
-
-        if (ix < 0 || ix >= (int)m_grid_dim.x || iy < 0 || iy >= (int)m_grid_dim.y || iz < 0
-            || iz >= (int)m_grid_dim.z)
-            {
-            // ignore, error will be thrown elsewhere (in CellList)
-            continue;
-            }
+            // compute coordinates in units of the mesh size
+            Scalar3 f = box.makeFraction(pos);
+            Scalar3 reduced_pos = make_scalar3(f.x * (Scalar)m_mesh_points.x,
+                                               f.y * (Scalar)m_mesh_points.y,
+                                               f.z * (Scalar)m_mesh_points.z);
 
-        int mult_fact = 2 * m_order + 1;
-        Scalar Wx, Wy, Wz;
+            reduced_pos.x += (Scalar)m_n_ghost_cells.x;
+            reduced_pos.y += (Scalar)m_n_ghost_cells.y;
+            reduced_pos.z += (Scalar)m_n_ghost_cells.z;
 
-        int nlower = -(m_order - 1) / 2;
-        int nupper = m_order / 2;
+            Scalar shift, shiftone;
 
-        for (int i = nlower; i <= nupper; ++i)
-            {
-            Wx = Scalar(0.0);
-            for (int iorder = m_order - 1; iorder >= 0; iorder--)
+            if (m_order % 2)
                 {
-                Wx = h_rho_coeff.data[i - nlower + iorder * mult_fact] + Wx * dx;
+                shift = 0.5;
+                shiftone = 0.0;
+                }
+            else
+                {
+                shift = 0.0;
+                shiftone = 0.5;
                 }
 
-            int neighi = (int)ix + i;
-
-            if (!m_n_ghost_cells.x)
+            // find cell of the mesh the particle is in
+            int ix = int(reduced_pos.x + shift);
+            int iy = int(reduced_pos.y + shift);
+            int iz = int(reduced_pos.z + shift);
+
+            Scalar dx = shiftone + (Scalar)ix - reduced_pos.x;
+            Scalar dy = shiftone + (Scalar)iy - reduced_pos.y;
+            Scalar dz = shiftone + (Scalar)iz - reduced_pos.z;
+
+            // handle particles on the boundary
+            if (ix == (int)m_grid_dim.x && !m_n_ghost_cells.x)
+                ix = 0;
+            if (iy == (int)m_grid_dim.y && !m_n_ghost_cells.y)
+                iy = 0;
+            if (iz == (int)m_grid_dim.z && !m_n_ghost_cells.z)
+                iz = 0;
+
+            if (ix < 0 || ix >= (int)m_grid_dim.x || iy < 0 || iy >= (int)m_grid_dim.y || iz < 0
+                || iz >= (int)m_grid_dim.z)
                 {
-                if (neighi >= (int)m_grid_dim.x)
-                    neighi -= m_grid_dim.x;
-                else if (neighi < 0)
-                    neighi += m_grid_dim.x;
+                // ignore, error will be thrown elsewhere (in CellList)
+                continue;
                 }
 
-            for (int j = nlower; j <= nupper; ++j)
+            int mult_fact = 2 * m_order + 1;
+            Scalar Wx, Wy, Wz;
+
+            int nlower = -(m_order - 1) / 2;
+            int nupper = m_order / 2;
+
+            for (int i = nlower; i <= nupper; ++i)
                 {
-                Wy = Scalar(0.0);
+                Wx = Scalar(0.0);
                 for (int iorder = m_order - 1; iorder >= 0; iorder--)
                     {
-                    Wy = h_rho_coeff.data[j - nlower + iorder * mult_fact] + Wy * dy;
+                    Wx = h_rho_coeff.data[i - nlower + iorder * mult_fact] + Wx * dx;
                     }
 
-                int neighj = (int)iy + j;
+                int neighi = (int)ix + i;
 
-                if (!m_n_ghost_cells.y)
+                if (!m_n_ghost_cells.x)
                     {
-                    if (neighj >= (int)m_grid_dim.y)
-                        neighj -= m_grid_dim.y;
-                    else if (neighj < 0)
-                        neighj += m_grid_dim.y;
+                    if (neighi >= (int)m_grid_dim.x)
+                        neighi -= m_grid_dim.x;
+                    else if (neighi < 0)
+                        neighi += m_grid_dim.x;
                     }
 
-                for (int k = nlower; k <= nupper; ++k)
+                for (int j = nlower; j <= nupper; ++j)
                     {
-                    Wz = Scalar(0.0);
+                    Wy = Scalar(0.0);
                     for (int iorder = m_order - 1; iorder >= 0; iorder--)
                         {
-                        Wz = h_rho_coeff.data[k - nlower + iorder * mult_fact] + Wz * dz;
+                        Wy = h_rho_coeff.data[j - nlower + iorder * mult_fact] + Wy * dy;
                         }
 
-                    int neighk = (int)iz + k;
-                    if (!m_n_ghost_cells.z)
+                    int neighj = (int)iy + j;
+
+                    if (!m_n_ghost_cells.y)
                         {
-                        if (neighk >= (int)m_grid_dim.z)
-                            neighk -= m_grid_dim.z;
-                        else if (neighk < 0)
-                            neighk += m_grid_dim.z;
+                        if (neighj >= (int)m_grid_dim.y)
+                            neighj -= m_grid_dim.y;
+                        else if (neighj < 0)
+                            neighj += m_grid_dim.y;
                         }
 
-                    Scalar W = Wx * Wy * Wz;
+                    for (int k = nlower; k <= nupper; ++k)
+                        {
+                        Wz = Scalar(0.0);
+                        for (int iorder = m_order - 1; iorder >= 0; iorder--)
+                            {
+                            Wz = h_rho_coeff.data[k - nlower + iorder * mult_fact] + Wz * dz;
+                            }
+
+                        int neighk = (int)iz + k;
+                        if (!m_n_ghost_cells.z)
+                            {
+                            if (neighk >= (int)m_grid_dim.z)
+                                neighk -= m_grid_dim.z;
+                            else if (neighk < 0)
+                                neighk += m_grid_dim.z;
+                            }
+
+                        Scalar W = Wx * Wy * Wz;
 
-                    // store in row major order
-                    unsigned int neigh_idx
-                        = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
+                        // store in row major order
+                        unsigned int neigh_idx
+                            = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
 
-                    h_mesh.data[neigh_idx].r += float(qi * W / V_cell);
+                        mesh[neigh_idx].r += float(qi * W / V_cell);
+                        }
                     }
                 }
-            }
-        } // end loop over particles
+            } // end loop over particles
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                // the stencils of different particles overlap, spread into thread-local meshes
+                // and sum them afterwards
+                size_t n_elements = m_mesh.getNumElements();
+                hoomd::detail::ThreadBuffers<kiss_fft_cpx> thread_mesh(m_exec_conf,
+                                                                       n_elements,
+                                                                       kiss_fft_cpx {0, 0});
+
+                thread_mesh.parallel_for(
+                    0,
+                    group_size,
+                    [&](unsigned int begin, unsigned int end, unsigned int k)
+                    { assign_items(begin, end, thread_mesh[k].data()); });
+
+                tbb::parallel_for(tbb::blocked_range<size_t>(0, n_elements),
+                                  [&](const tbb::blocked_range<size_t>& r)
+                                  {
+                                      for (const auto& mesh : thread_mesh)
+                                          for (size_t i = r.begin(); i != r.end(); ++i)
+                                              h_mesh.data[i].r += mesh[i].r;
+                                  });
+            });
+        }
+    else
+#endif
+        {
+        assign_items(0, group_size, h_mesh.data);
+        }
     }
 
 void PPPMForceCompute::updateMeshes()
@@ -954,10 +1117,17 @@ void PPPMForceCompute::updateMeshes()
                                                  access_location::host,
                                                  access_mode::overwrite);
 
-        dfft_execute((cpx_t*)(h_mesh.data + m_ghost_offset),
-                     (cpx_t*)h_fourier_mesh.data,
-                     0,
-                     m_dfft_plan_forward);
+        if (m_pencil_fft_plan)
+            {
+            m_pencil_fft_plan->forward(h_mesh.data + m_ghost_offset, h_fourier_mesh.data);
+            }
+        else
+            {
+            dfft_execute((cpx_t*)(h_mesh.data + m_ghost_offset),
+                         (cpx_t*)h_fourier_mesh.data,
+                         0,
+                         m_dfft_plan_forward);
+            }
         }
 #endif
 
@@ -1050,18 +1220,30 @@ void PPPMForceCompute::updateMeshes()
                                                        access_location::host,
                                                        access_mode::overwrite);
 
-        dfft_execute((cpx_t*)h_fourier_mesh_G_x.data,
-                     (cpx_t*)(h_inv_fourier_mesh_x.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
-        dfft_execute((cpx_t*)h_fourier_mesh_G_y.data,
-                     (cpx_t*)(h_inv_fourier_mesh_y.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
-        dfft_execute((cpx_t*)h_fourier_mesh_G_z.data,
-                     (cpx_t*)(h_inv_fourier_mesh_z.data + m_ghost_offset),
-                     1,
-                     m_dfft_plan_inverse);
+        if (m_pencil_fft_plan)
+            {
+            m_pencil_fft_plan->inverse(h_fourier_mesh_G_x.data,
+                                       h_inv_fourier_mesh_x.data + m_ghost_offset);
+            m_pencil_fft_plan->inverse(h_fourier_mesh_G_y.data,
+                                       h_inv_fourier_mesh_y.data + m_ghost_offset);
+            m_pencil_fft_plan->inverse(h_fourier_mesh_G_z.data,
+                                       h_inv_fourier_mesh_z.data + m_ghost_offset);
+            }
+        else
+            {
+            dfft_execute((cpx_t*)h_fourier_mesh_G_x.data,
+                         (cpx_t*)(h_inv_fourier_mesh_x.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            dfft_execute((cpx_t*)h_fourier_mesh_G_y.data,
+                         (cpx_t*)(h_inv_fourier_mesh_y.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            dfft_execute((cpx_t*)h_fourier_mesh_G_z.data,
+                         (cpx_t*)(h_inv_fourier_mesh_z.data + m_ghost_offset),
+                         1,
+                         m_dfft_plan_inverse);
+            }
         }
 #endif
 
@@ -1085,7 +1267,7 @@ void PPPMForceCompute::interpolateForces()
     ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(getMeshCharges(), access_location::host, access_mode::read);
 
     // access inverse Fourier transform mesh
     ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x,
@@ -1108,147 +1290,171 @@ void PPPMForceCompute::interpolateForces()
 
     const BoxDim& box = m_pdata->getBox();
 
-    // loop over group
+    // interpolate the forces on group members [begin, end)
     unsigned int group_size = m_group->getNumMembers();
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    ArrayHandle<unsigned int> h_index_array(m_group->getIndexArray(),
+                                            access_location::host,
+                                            access_mode::read);
+    auto interpolate_items = [&](unsigned int begin, unsigned int end)
         {
-        unsigned int idx = m_group->getMemberIndex(group_idx);
-        Scalar4 postype = h_postype.data[idx];
-
-        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-
-        // ignore if NaN
-        if (std::isnan(pos.x) || std::isnan(pos.y) || std::isnan(pos.z))
+        for (unsigned int group_idx = begin; group_idx < end; group_idx++)
             {
-            continue;
-            }
-
-        Scalar qi = h_charge.data[idx];
-
-        // compute coordinates in units of the mesh size
-        Scalar3 f = box.makeFraction(pos);
-        Scalar3 reduced_pos = make_scalar3(f.x * (Scalar)m_mesh_points.x,
-                                           f.y * (Scalar)m_mesh_points.y,
-                                           f.z * (Scalar)m_mesh_points.z);
-        reduced_pos.x += (Scalar)m_n_ghost_cells.x;
-        reduced_pos.y += (Scalar)m_n_ghost_cells.y;
-        reduced_pos.z += (Scalar)m_n_ghost_cells.z;
+            unsigned int idx = h_index_array.data[group_idx];
+            Scalar4 postype = h_postype.data[idx];
 
-        Scalar shift, shiftone;
-
-        if (m_order % 2)
-            {
-            shift = 0.5;
-            shiftone = 0.0;
-            }
-        else
-            {
-            shift = 0.0;
-            shiftone = 0.5;
-            }
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
 
-        // find cell of the force mesh the particle is in
-        int ix = int(reduced_pos.x + shift);
-        int iy = int(reduced_pos.y + shift);
-        int iz = int(reduced_pos.z + shift);
-
-        Scalar dx = shiftone + (Scalar)ix - reduced_pos.x;
-        Scalar dy = shiftone + (Scalar)iy - reduced_pos.y;
-        Scalar dz = shiftone + (Scalar)iz - reduced_pos.z;
-
-        // handle particles on the boundary
-        if (ix == (int)m_grid_dim.x && !m_n_ghost_cells.x)
-            ix = 0;
-        if (iy == (int)m_grid_dim.y && !m_n_ghost_cells.y)
-            iy = 0;
-        if (iz == (int)m_grid_dim.z && !m_n_ghost_cells.z)
-            iz = 0;
-
-        if (ix < 0 || ix >= (int)m_grid_dim.x || iy < 0 || iy >= (int)m_grid_dim.y || iz < 0
-            || iz >= (int)m_grid_dim.z)
-            {
-            // ignore, error will be thrown elsewhere (in CellList)
-            continue;
-            }
+            // ignore if NaN
+            if (std::isnan(pos.x) || std::isnan(pos.y) || std::isnan(pos.z))
+                {
+                continue;
+                }
 
-        Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+            Scalar qi = h_charge.data[idx];
 
-        int mult_fact = 2 * m_order + 1;
-        Scalar Wx, Wy, Wz;
+            // compute coordinates in units of the mesh size
+            Scalar3 f = box.makeFraction(pos);
+            Scalar3 reduced_pos = make_scalar3(f.x * (Scalar)m_mesh_points.x,
+                                               f.y * (Scalar)m_mesh_points.y,
+                                               f.z * (Scalar)m_mesh_points.z);
+            reduced_pos.x += (Scalar)m_n_ghost_cells.x;
+            reduced_pos.y += (Scalar)m_n_ghost_cells.y;
+            reduced_pos.z += (Scalar)m_n_ghost_cells.z;
 
-        int nlower = -(m_order - 1) / 2;
-        int nupper = m_order / 2;
+            Scalar shift, shiftone;
 
-        for (int i = nlower; i <= nupper; ++i)
-            {
-            Wx = Scalar(0.0);
-            for (int iorder = m_order - 1; iorder >= 0; iorder--)
+            if (m_order % 2)
                 {
-                Wx = h_rho_coeff.data[i - nlower + iorder * mult_fact] + Wx * dx;
+                shift = 0.5;
+                shiftone = 0.0;
+                }
+            else
+                {
+                shift = 0.0;
+                shiftone = 0.5;
                 }
 
-            int neighi = (int)ix + i;
-
-            if (!m_n_ghost_cells.x)
+            // find cell of the force mesh the particle is in
+            int ix = int(reduced_pos.x + shift);
+            int iy = int(reduced_pos.y + shift);
+            int iz = int(reduced_pos.z + shift);
+
+            Scalar dx = shiftone + (Scalar)ix - reduced_pos.x;
+            Scalar dy = shiftone + (Scalar)iy - reduced_pos.y;
+            Scalar dz = shiftone + (Scalar)iz - reduced_pos.z;
+
+            // handle particles on the boundary
+            if (ix == (int)m_grid_dim.x && !m_n_ghost_cells.x)
+                ix = 0;
+            if (iy == (int)m_grid_dim.y && !m_n_ghost_cells.y)
+                iy = 0;
+            if (iz == (int)m_grid_dim.z && !m_n_ghost_cells.z)
+                iz = 0;
+
+            if (ix < 0 || ix >= (int)m_grid_dim.x || iy < 0 || iy >= (int)m_grid_dim.y || iz < 0
+                || iz >= (int)m_grid_dim.z)
                 {
-                if (neighi >= (int)m_grid_dim.x)
-                    neighi -= m_grid_dim.x;
-                else if (neighi < 0)
-                    neighi += m_grid_dim.x;
+                // ignore, error will be thrown elsewhere (in CellList)
+                continue;
                 }
 
-            for (int j = nlower; j <= nupper; ++j)
+            Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
+
+            int mult_fact = 2 * m_order + 1;
+            Scalar Wx, Wy, Wz;
+
+            int nlower = -(m_order - 1) / 2;
+            int nupper = m_order / 2;
+
+            for (int i = nlower; i <= nupper; ++i)
                 {
-                Wy = Scalar(0.0);
+                Wx = Scalar(0.0);
                 for (int iorder = m_order - 1; iorder >= 0; iorder--)
                     {
-                    Wy = h_rho_coeff.data[j - nlower + iorder * mult_fact] + Wy * dy;
+                    Wx = h_rho_coeff.data[i - nlower + iorder * mult_fact] + Wx * dx;
                     }
 
-                int neighj = (int)iy + j;
+                int neighi = (int)ix + i;
 
-                if (!m_n_ghost_cells.y)
+                if (!m_n_ghost_cells.x)
                     {
-                    if (neighj >= (int)m_grid_dim.y)
-                        neighj -= m_grid_dim.y;
-                    else if (neighj < 0)
-                        neighj += m_grid_dim.y;
+                    if (neighi >= (int)m_grid_dim.x)
+                        neighi -= m_grid_dim.x;
+                    else if (neighi < 0)
+                        neighi += m_grid_dim.x;
                     }
 
-                for (int k = nlower; k <= nupper; ++k)
+                for (int j = nlower; j <= nupper; ++j)
                     {
-                    Wz = Scalar(0.0);
+                    Wy = Scalar(0.0);
                     for (int iorder = m_order - 1; iorder >= 0; iorder--)
                         {
-                        Wz = h_rho_coeff.data[k - nlower + iorder * mult_fact] + Wz * dz;
+                        Wy = h_rho_coeff.data[j - nlower + iorder * mult_fact] + Wy * dy;
                         }
 
-                    int neighk = (int)iz + k;
-                    if (!m_n_ghost_cells.z)
+                    int neighj = (int)iy + j;
+
+                    if (!m_n_ghost_cells.y)
                         {
-                        if (neighk >= (int)m_grid_dim.z)
-                            neighk -= m_grid_dim.z;
-                        else if (neighk < 0)
-                            neighk += m_grid_dim.z;
+                        if (neighj >= (int)m_grid_dim.y)
+                            neighj -= m_grid_dim.y;
+                        else if (neighj < 0)
+                            neighj += m_grid_dim.y;
                         }
 
-                    unsigned int neigh_idx
-                        = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
+                    for (int k = nlower; k <= nupper; ++k)
+                        {
+                        Wz = Scalar(0.0);
+                        for (int iorder = m_order - 1; iorder >= 0; iorder--)
+                            {
+                            Wz = h_rho_coeff.data[k - nlower + iorder * mult_fact] + Wz * dz;
+                            }
+
+                        int neighk = (int)iz + k;
+                        if (!m_n_ghost_cells.z)
+                            {
+                            if (neighk >= (int)m_grid_dim.z)
+                                neighk -= m_grid_dim.z;
+                            else if (neighk < 0)
+                                neighk += m_grid_dim.z;
+                            }
+
+                        unsigned int neigh_idx
+                            = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
 
-                    kiss_fft_cpx E_x = h_inv_fourier_mesh_x.data[neigh_idx];
-                    kiss_fft_cpx E_y = h_inv_fourier_mesh_y.data[neigh_idx];
-                    kiss_fft_cpx E_z = h_inv_fourier_mesh_z.data[neigh_idx];
+                        kiss_fft_cpx E_x = h_inv_fourier_mesh_x.data[neigh_idx];
+                        kiss_fft_cpx E_y = h_inv_fourier_mesh_y.data[neigh_idx];
+                        kiss_fft_cpx E_z = h_inv_fourier_mesh_z.data[neigh_idx];
 
-                    Scalar W = Wx * Wy * Wz;
-                    force.x += qi * W * E_x.r;
-                    force.y += qi * W * E_y.r;
-                    force.z += qi * W * E_z.r;
+                        Scalar W = Wx * Wy * Wz;
+                        force.x += qi * W * E_x.r;
+                        force.y += qi * W * E_y.r;
+                        force.z += qi * W * E_z.r;
+                        }
                     }
                 }
-            }
 
-        h_force.data[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
-        } // end of loop over particles
+            h_force.data[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
+            } // end of loop over particles
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each particle only reads the mesh and writes its own force
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, group_size),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { interpolate_items(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        interpolate_items(0, group_size);
+        }
     }
 
 Scalar PPPMForceCompute::computePE()
@@ -1260,28 +1466,12 @@ Scalar PPPMForceCompute::computePE()
 
     Scalar sum(0.0);
 
-    bool exclude_dc = true;
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
-        }
-#endif
-
+    // the influence function vanishes in the DC bin unless the k = 0 term contributes
     for (unsigned int k = 0; k < m_n_inner_cells; ++k)
         {
-        bool exclude = false;
-        if (exclude_dc)
-            // exclude DC bin
-            exclude = (k == 0);
-
-        if (!exclude)
-            {
-            sum += (h_fourier_mesh.data[k].r * h_fourier_mesh.data[k].r
-                    + h_fourier_mesh.data[k].i * h_fourier_mesh.data[k].i)
-                   * h_inf_f.data[k];
-            }
+        sum += (h_fourier_mesh.data[k].r * h_fourier_mesh.data[k].r
+                + h_fourier_mesh.data[k].i * h_fourier_mesh.data[k].i)
+               * h_inf_f.data[k];
         }
 
     Scalar V = m_pdata->getGlobalBox().getVolume();
@@ -1290,14 +1480,8 @@ Scalar PPPMForceCompute::computePE()
 
     if (m_exec_conf->getRank() == 0)
         {
-        // subtract self-energy on rank 0 (see Frenkel and Smit, and Salin and Caillol)
-        sum -= m_q2
-               * (m_kappa / sqrt(Scalar(M_PI))
-                      * exp(-m_alpha * m_alpha / (Scalar(4.0) * m_kappa * m_kappa))
-                  - Scalar(0.5) * m_alpha * erfc(m_alpha / (Scalar(2.0) * m_kappa)));
-
-        // k = 0 term already accounted for by exclude_dc
-        // sum -= Scalar(0.5*M_PI)*m_q*m_q / (m_kappa*m_kappa* V);
+        // subtract self-energy on rank 0
+        sum -= computeSelfEnergy();
         }
 
     // apply rigid body correction
@@ -1334,13 +1518,23 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
             throw std::runtime_error("Error computing PPPM forces");
             }
 
-        // allocate memory and initialize arrays
-        setupMesh();
+        // the mesh and the influence function do not depend on the particles, a change in the
+        // number of particles only requires new charge sums and a new rigid body correction
+        if (m_need_initialize)
+            {
+            // allocate memory and initialize arrays
+            setupMesh();
+            }
 
         // setup tables and do misc validation
         setupCoeffs();
 
-        computeInfluenceFunction();
+        if (m_need_initialize)
+            {
+            computeInfluenceFunction();
+            m_inf_f_box = m_pdata->getGlobalBox();
+            m_k_box = m_inf_f_box;
+            }
 
         if (m_nlist->getFilterBody())
             {
@@ -1365,7 +1559,17 @@ void PPPMForceCompute::computeForces(uint64_t timestep)
         {
         if (ghost_cell_num_changed)
             setupMesh();
-        computeInfluenceFunction();
+
+        if (!ghost_cell_num_changed && canRescaleInfluenceFunction())
+            {
+            rescaleInfluenceFunction();
+            }
+        else
+            {
+            computeInfluenceFunction();
+            m_inf_f_box = m_pdata->getGlobalBox();
+            }
+        m_k_box = m_pdata->getGlobalBox();
         m_box_changed = false;
         }
 
@@ -1409,40 +1613,27 @@ void PPPMForceCompute::computeVirial()
     for (unsigned int i = 0; i < 6; ++i)
         virial[i] = Scalar(0.0);
 
-    bool exclude_dc = true;
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
-        }
-#endif
-
     for (unsigned int kidx = 0; kidx < m_n_inner_cells; ++kidx)
         {
-        bool exclude = false;
-        if (exclude_dc)
-            // exclude DC bin
-            exclude = (kidx == 0);
+        kiss_fft_cpx fourier = h_fourier_mesh.data[kidx];
 
-        if (!exclude)
-            {
-            // non-zero wave vector
-            kiss_fft_cpx fourier = h_fourier_mesh.data[kidx];
+        Scalar rhog = (fourier.r * fourier.r + fourier.i * fourier.i) * h_inf_f.data[kidx];
 
-            Scalar3 k = h_k.data[kidx];
-            Scalar ksq = dot(k, k);
+        // the DC bin only contributes when the influence function is non-zero there, and then
+        // only to the diagonal
+        if (rhog == Scalar(0.0))
+            continue;
 
-            Scalar rhog = (fourier.r * fourier.r + fourier.i * fourier.i) * h_inf_f.data[kidx];
+        Scalar3 k = h_k.data[kidx];
+        Scalar ksq = dot(k, k);
 
-            Scalar vterm = -Scalar(2.0) * (Scalar(1.0) / ksq + Scalar(0.25) / (m_kappa * m_kappa));
-            virial[0] += rhog * (Scalar(1.0) + vterm * k.x * k.x); // xx
-            virial[1] += rhog * (vterm * k.x * k.y);               // xy
-            virial[2] += rhog * (vterm * k.x * k.z);               // xz
-            virial[3] += rhog * (Scalar(1.0) + vterm * k.y * k.y); // yy
-            virial[4] += rhog * (vterm * k.y * k.z);               // yz
-            virial[5] += rhog * (Scalar(1.0) + vterm * k.z * k.z); // zz
-            }
+        Scalar vterm = ksq > Scalar(0.0) ? computeVirialFactor(ksq) : Scalar(0.0);
+        virial[0] += rhog * (Scalar(1.0) + vterm * k.x * k.x); // xx
+        virial[1] += rhog * (vterm * k.x * k.y);               // xy
+        virial[2] += rhog * (vterm * k.x * k.z);               // xz
+        virial[3] += rhog * (Scalar(1.0) + vterm * k.y * k.y); // yy
+        virial[4] += rhog * (vterm * k.y * k.z);               // yz
+        virial[5] += rhog * (Scalar(1.0) + vterm * k.z * k.z); // zz
         }
 
     Scalar V = m_pdata->getGlobalBox().getVolume();
@@ -1489,8 +1680,6 @@ void PPPMForceCompute::computeBodyCorrection()
 
     m_body_energy = Scalar(0.0);
 
-    std::multimap<unsigned int, unsigned int> body_map;
-    std::map<unsigned int, Scalar> body_type;
     const BoxDim& box = m_pdata->getGlobalBox();
 
     bool is_rank_zero = true;
@@ -1504,6 +1693,9 @@ void PPPMForceCompute::computeBodyCorrection()
     if (is_rank_zero)
         {
         std::multimap<unsigned int, unsigned> body_map;
+
+        // the correction is the same for all bodies of the same type, cache it by the type of
+        // the central particle
         std::map<unsigned int, Scalar> body_type;
 
         if (m_group->getNumMembers() != nptl)
@@ -1526,7 +1718,9 @@ void PPPMForceCompute::computeBodyCorrection()
             {
             auto body_end = body_map.upper_bound(it->first);
 
-            unsigned int type = snap.type[it->second];
+            // the body id of a rigid body is the tag (snapshot index) of its central particle
+            unsigned int type
+                = it->first < MIN_FLOPPY ? snap.type[it->first] : snap.type[it->second];
             auto energy_it = body_type.find(type);
 
             if (energy_it != body_type.end())
@@ -1584,36 +1778,60 @@ void PPPMForceCompute::computeBodyCorrection()
 
 void PPPMForceCompute::fixExclusions()
     {
-    unsigned int group_size = m_group->getNumMembers();
+    detail::fix_ewald_exclusions(m_pdata, m_nlist, m_group, m_force, m_virial, m_kappa, m_alpha);
+    }
+
+namespace detail
+    {
+/*! \param pdata Particle data
+    \param nlist Neighbor list that provides the exclusions
+    \param group Particles to correct
+    \param force_array Force array to add the correction to
+    \param virial_array Virial array to reset and add the correction to
+    \param kappa Splitting parameter of the Ewald sum
+    \param alpha Debye screening parameter
+
+    The reciprocal space part of the Ewald sum includes the long-range part of the interaction
+    between all pairs, subtract it for the excluded pairs.
+*/
+void fix_ewald_exclusions(std::shared_ptr<ParticleData> pdata,
+                          std::shared_ptr<NeighborList> nlist,
+                          std::shared_ptr<ParticleGroup> group,
+                          GlobalArray<Scalar4>& force_array,
+                          GlobalArray<Scalar>& virial_array,
+                          Scalar kappa,
+                          Scalar alpha)
+    {
+    unsigned int group_size = group->getNumMembers();
     // just drop out if the group is an empty group
     if (group_size == 0)
         return;
 
-    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::readwrite);
-    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_force(force_array, access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_virial(virial_array, access_location::host, access_mode::readwrite);
 
-    // reset virial (but not forces, we reset them above)
-    memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+    // reset virial (but not forces, the caller resets them)
+    memset(h_virial.data, 0, sizeof(Scalar) * virial_array.getNumElements());
 
-    size_t virial_pitch = m_virial.getPitch();
+    size_t virial_pitch = virial_array.getPitch();
 
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
 
-    ArrayHandle<unsigned int> d_group_members(m_group->getIndexArray(),
+    ArrayHandle<unsigned int> d_group_members(group->getIndexArray(),
                                               access_location::host,
                                               access_mode::read);
-    const BoxDim& box = m_pdata->getBox();
-    ArrayHandle<unsigned int> d_exlist(m_nlist->getExListArray(),
+    const BoxDim& box = pdata->getBox();
+    ArrayHandle<unsigned int> d_exlist(nlist->getExListArray(),
                                        access_location::host,
                                        access_mode::read);
-    ArrayHandle<unsigned int> d_n_ex(m_nlist->getNExArray(),
+    ArrayHandle<unsigned int> d_n_ex(nlist->getNExArray(),
                                      access_location::host,
                                      access_mode::read);
-    Index2D nex = m_nlist->getExListIndexer();
+    Index2D nex = nlist->getExListIndexer();
 
-    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_pos(pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(pdata->getCharges(), access_location::host, access_mode::read);
 
     for (unsigned int i = 0; i < group_size; i++)
         {
@@ -1655,7 +1873,7 @@ void PPPMForceCompute::fixExclusions()
             if (qiqj != Scalar(0.0))
                 {
                 // evaluate the long-range pair potential
-                eval_pppm_real_space(m_alpha, m_kappa, rsq, pair_eng, force_divr);
+                eval_pppm_real_space(alpha, kappa, rsq, pair_eng, force_divr);
 
                 // subtract long-range part of pair-interaction
                 force_divr = -qiqj * force_divr;
@@ -1682,6 +1900,7 @@ void PPPMForceCompute::fixExclusions()
             h_virial.data[k * virial_pitch + idx] += virial[k];
         }
     }
+    } // end namespace detail
 
 Scalar PPPMForceCompute::getQSum()
     {
@@ -1755,7 +1974,13 @@ void export_PPPMForceCompute(pybind11::module& m)
         .def_property_readonly("order", &PPPMForceCompute::getOrder)
         .def_property_readonly("kappa", &PPPMForceCompute::getKappa)
         .def_property_readonly("r_cut", &PPPMForceCompute::getRCut)
-        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha);
+        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha)
+        .def_property("box_tolerance",
+                      &PPPMForceCompute::getBoxTolerance,
+                      &PPPMForceCompute::setBoxTolerance)
+        .def_property("pencil_fft",
+                      &PPPMForceCompute::getPencilFFT,
+                      &PPPMForceCompute::setPencilFFT);
     }
 
     } // end namespace detail
@@ -10,6 +10,7 @@
 
 #ifdef ENABLE_MPI
 #include "CommunicatorGrid.h"
+#include "PencilFFT.h"
 #include "hoomd/extern/dfftlib/src/dfft_host.h"
 #endif
 
@@ -84,6 +85,34 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         return m_alpha;
         }
 
+    //! Set the maximum relative box change between full influence function computations
+    void setBoxTolerance(Scalar box_tolerance)
+        {
+        m_box_tolerance = box_tolerance;
+        }
+
+    //! Get the maximum relative box change between full influence function computations
+    Scalar getBoxTolerance()
+        {
+        return m_box_tolerance;
+        }
+
+    //! Set whether the distributed FFT uses a pencil decomposition of the ranks
+    void setPencilFFT(bool pencil_fft)
+        {
+        if (pencil_fft != m_pencil_fft)
+            {
+            m_pencil_fft = pencil_fft;
+            m_need_initialize = true;
+            }
+        }
+
+    //! Get whether the distributed FFT uses a pencil decomposition of the ranks
+    bool getPencilFFT()
+        {
+        return m_pencil_fft;
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     /*! \param timestep Current time step
@@ -135,6 +164,9 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     bool m_need_initialize;       //!< True if we have not yet computed the influence function
     bool m_params_set;            //!< True if parameters are set
     bool m_box_changed;           //!< True if box has changed since last compute
+    Scalar m_box_tolerance;       //!< Maximum relative box change to rescale the influence function
+    BoxDim m_inf_f_box;           //!< Global box of the last full influence function computation
+    BoxDim m_k_box;               //!< Global box of the current influence function and k values
 
     GlobalArray<Scalar> m_virial_mesh; //!< k-space mesh of virial tensor values
 
@@ -151,6 +183,7 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
 
     Scalar m_body_energy;      //!< Energy correction due to rigid body exclusions
     bool m_ptls_added_removed; //!< True if global particle number changed
+    bool m_pencil_fft;         //!< True to use PencilFFT instead of dfft in MPI simulations
 
     //! Helper function to be called when particle number changes
     void slotGlobalParticleNumberChange()
@@ -173,6 +206,12 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Compute the optimal influence function
     virtual void computeInfluenceFunction();
 
+    //! Test whether the box is close enough to m_inf_f_box to rescale the influence function
+    bool canRescaleInfluenceFunction();
+
+    //! Rescale the influence function and k values to the current box
+    void rescaleInfluenceFunction();
+
     //! Helper function to assign particle coordinates to mesh
     virtual void assignParticles();
 
@@ -197,6 +236,27 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! Compute rigid body correction
     virtual void computeBodyCorrection();
 
+    //! Get the per-particle charges that are assigned to the mesh
+    virtual const GlobalArray<Scalar>& getMeshCharges()
+        {
+        return m_pdata->getCharges();
+        }
+
+    //! Fourier transform of the long-range part of the pair interaction
+    virtual Scalar computeReferencePotential(Scalar ksq);
+
+    //! Logarithmic derivative of the reference potential, used in the virial
+    virtual Scalar computeVirialFactor(Scalar ksq);
+
+    //! Self-energy included in the reciprocal space sum
+    virtual Scalar computeSelfEnergy();
+
+    //! computes coefficients for assigning charges to grid points
+    void compute_rho_coeff();
+
+    //! computes auxiliary table for optimized influence function
+    void compute_gf_denom();
+
     private:
     kiss_fftnd_cfg m_kiss_fft = NULL;  //!< The FFT configuration
     kiss_fftnd_cfg m_kiss_ifft = NULL; //!< Inverse FFT configuration
@@ -204,6 +264,7 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
 #ifdef ENABLE_MPI
     dfft_plan m_dfft_plan_forward; //!< Distributed FFT for forward transform
     dfft_plan m_dfft_plan_inverse; //!< Distributed FFT for inverse transform
+    std::unique_ptr<PencilFFT> m_pencil_fft_plan; //!< Pencil decomposed FFT, if enabled
     std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>
         m_grid_comm_forward; //!< Communicator for charge mesh
     std::unique_ptr<CommunicatorGrid<kiss_fft_cpx>>
@@ -238,16 +299,22 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     //! root mean square error in force calculation
     Scalar rms(Scalar h, Scalar prd, Scalar natoms);
 
-    //! computes coefficients for assigning charges to grid points
-    void compute_rho_coeff();
-
-    //! computes auxiliary table for optimized influence function
-    void compute_gf_denom();
-
     //! computes coefficients for the Green's function
     Scalar gf_denom(Scalar x, Scalar y, Scalar z);
     };
 
+namespace detail
+    {
+//! Subtract the long-range part of the Ewald sum from the forces between excluded pairs
+void fix_ewald_exclusions(std::shared_ptr<ParticleData> pdata,
+                          std::shared_ptr<NeighborList> nlist,
+                          std::shared_ptr<ParticleGroup> group,
+                          GlobalArray<Scalar4>& force_array,
+                          GlobalArray<Scalar>& virial_array,
+                          Scalar kappa,
+                          Scalar alpha);
+    } // end namespace detail
+
     } // end namespace md
     } // end namespace hoomd
 
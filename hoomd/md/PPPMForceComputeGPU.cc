@@ -18,7 +18,7 @@ PPPMForceComputeGPU::PPPMForceComputeGPU(std::shared_ptr<SystemDefinition> sysde
                                          std::shared_ptr<NeighborList> nlist,
                                          std::shared_ptr<ParticleGroup> group)
     : PPPMForceCompute(sysdef, nlist, group), m_local_fft(true), m_sum(m_exec_conf),
-      m_block_size(256)
+      m_block_size(256), m_n_sum_partial(0)
     {
     m_tuner_assign.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                           m_exec_conf,
@@ -85,6 +85,13 @@ void PPPMForceComputeGPU::initializeFFT()
 #ifdef ENABLE_MPI
     m_local_fft = !m_pdata->getDomainDecomposition();
 
+    if (!m_local_fft && m_pencil_fft)
+        {
+        m_exec_conf->msg->warning()
+            << "PPPM: pencil_fft is not implemented on the GPU, using the domain decomposition."
+            << std::endl;
+        }
+
     if (!m_local_fft)
         {
         // ghost cell communicator for charge interpolation
@@ -275,10 +282,16 @@ void PPPMForceComputeGPU::initializeFFT()
         }
 #endif
 
+    // updateMeshes() writes one partial energy sum per block of its tuned block size, which is at
+    // least the warp size
+    unsigned int n_pe_blocks = (m_mesh_points.x * m_mesh_points.y * m_mesh_points.z)
+                                   / m_exec_conf->dev_prop.warpSize
+                               + 1;
+    GlobalArray<Scalar> sum_partial(n_pe_blocks, m_exec_conf);
+    m_sum_partial.swap(sum_partial);
+
     unsigned int n_blocks
         = (m_mesh_points.x * m_mesh_points.y * m_mesh_points.z) / m_block_size + 1;
-    GlobalArray<Scalar> sum_partial(n_blocks, m_exec_conf);
-    m_sum_partial.swap(sum_partial);
 
     GlobalArray<Scalar> sum_virial_partial(6 * n_blocks, m_exec_conf);
     m_sum_virial_partial.swap(sum_virial_partial);
@@ -412,18 +425,25 @@ void PPPMForceComputeGPU::updateMeshes()
 
         ArrayHandle<Scalar> d_inf_f(m_inf_f, access_location::device, access_mode::read);
         ArrayHandle<Scalar3> d_k(m_k, access_location::device, access_mode::read);
+        ArrayHandle<Scalar> d_sum_partial(m_sum_partial,
+                                          access_location::device,
+                                          access_mode::overwrite);
 
+        // also compute the partial energy sums to avoid another pass over the mesh in computePE()
         unsigned int block_size = m_tuner_update->getParam()[0];
         m_tuner_update->begin();
-        kernel::gpu_update_meshes(m_n_inner_cells,
-                                  d_mesh.data + m_ghost_offset,
-                                  d_inv_fourier_mesh_x.data + m_ghost_offset,
-                                  d_inv_fourier_mesh_y.data + m_ghost_offset,
-                                  d_inv_fourier_mesh_z.data + m_ghost_offset,
-                                  d_inf_f.data,
-                                  d_k.data,
-                                  m_global_dim.x * m_global_dim.y * m_global_dim.z,
-                                  block_size);
+        m_n_sum_partial
+            = kernel::gpu_update_meshes(m_n_inner_cells,
+                                        d_mesh.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_x.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_y.data + m_ghost_offset,
+                                        d_inv_fourier_mesh_z.data + m_ghost_offset,
+                                        d_inf_f.data,
+                                        d_k.data,
+                                        m_global_dim.x * m_global_dim.y * m_global_dim.z,
+                                        d_sum_partial.data,
+                                        excludeDC(),
+                                        block_size);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -613,14 +633,7 @@ void PPPMForceComputeGPU::computeVirial()
                                       access_location::device,
                                       access_mode::overwrite);
 
-    bool exclude_dc = true;
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
-        }
-#endif
+    bool exclude_dc = excludeDC();
 
     kernel::gpu_compute_mesh_virial(m_n_inner_cells,
                                     d_mesh.data + m_ghost_offset,
@@ -660,32 +673,13 @@ void PPPMForceComputeGPU::computeVirial()
         m_external_virial[i] = Scalar(0.5) * V * scale * scale * h_sum_virial.data[i];
     }
 
+/*! updateMeshes() computes the partial sums of the energy, reduce them here.
+ */
 Scalar PPPMForceComputeGPU::computePE()
     {
-    ArrayHandle<hipfftComplex> d_mesh(m_mesh, access_location::device, access_mode::read);
-    ArrayHandle<Scalar> d_inf_f(m_inf_f, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_sum_partial(m_sum_partial, access_location::device, access_mode::read);
 
-    ArrayHandle<Scalar> d_sum_partial(m_sum_partial,
-                                      access_location::device,
-                                      access_mode::overwrite);
-
-    bool exclude_dc = true;
-#ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
-        {
-        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
-        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
-        }
-#endif
-
-    kernel::gpu_compute_pe(m_n_inner_cells,
-                           d_sum_partial.data,
-                           m_sum.getDeviceFlags(),
-                           d_mesh.data + m_ghost_offset,
-                           d_inf_f.data,
-                           m_block_size,
-                           m_mesh_points,
-                           exclude_dc);
+    kernel::gpu_reduce_pe(d_sum_partial.data, m_n_sum_partial, m_sum.getDeviceFlags());
 
     if (m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -730,6 +724,23 @@ Scalar PPPMForceComputeGPU::computePE()
     return sum;
     }
 
+/*! In MPI simulations, only the rank that owns the origin of the distributed Fourier mesh excludes
+    the k = 0 term.
+*/
+bool PPPMForceComputeGPU::excludeDC()
+    {
+    bool exclude_dc = true;
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        uint3 my_pos = m_pdata->getDomainDecomposition()->getGridPos();
+        exclude_dc = !my_pos.x && !my_pos.y && !my_pos.z;
+        }
+#endif
+
+    return exclude_dc;
+    }
+
 //! Compute the optimal influence function
 void PPPMForceComputeGPU::computeInfluenceFunction()
     {
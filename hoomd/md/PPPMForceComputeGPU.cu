@@ -481,49 +481,94 @@ __global__ void gpu_update_meshes_kernel(const unsigned int n_wave_vectors,
                                          hipfftComplex* d_fourier_mesh_G_z,
                                          const Scalar* d_inf_f,
                                          const Scalar3* d_k,
-                                         unsigned int NNN)
+                                         unsigned int NNN,
+                                         Scalar* d_sum_partial,
+                                         const bool exclude_dc)
     {
+    HIP_DYNAMIC_SHARED(Scalar, sdata)
+
     unsigned int k;
 
     k = blockDim.x * blockIdx.x + threadIdx.x;
 
-    if (k >= n_wave_vectors)
-        return;
+    Scalar mySum = Scalar(0.0);
+
+    if (k < n_wave_vectors)
+        {
+        hipfftComplex f = d_fourier_mesh[k];
+
+        Scalar inf_f = d_inf_f[k];
+        Scalar scaled_inf_f = inf_f / ((Scalar)NNN);
+
+        Scalar3 kvec = d_k[k];
+
+        // Normalization
+        hipfftComplex fourier_G_x;
+        fourier_G_x.x = f.y * kvec.x * scaled_inf_f;
+        fourier_G_x.y = -f.x * kvec.x * scaled_inf_f;
+
+        hipfftComplex fourier_G_y;
+        fourier_G_y.x = f.y * kvec.y * scaled_inf_f;
+        fourier_G_y.y = -f.x * kvec.y * scaled_inf_f;
 
-    hipfftComplex f = d_fourier_mesh[k];
+        hipfftComplex fourier_G_z;
+        fourier_G_z.x = f.y * kvec.z * scaled_inf_f;
+        fourier_G_z.y = -f.x * kvec.z * scaled_inf_f;
 
-    Scalar scaled_inf_f = d_inf_f[k] / ((Scalar)NNN);
+        // store in global memory
+        d_fourier_mesh_G_x[k] = fourier_G_x;
+        d_fourier_mesh_G_y[k] = fourier_G_y;
+        d_fourier_mesh_G_z[k] = fourier_G_z;
 
-    Scalar3 kvec = d_k[k];
+        // energy of this wave vector, accumulated in Scalar precision
+        if (!exclude_dc || k != 0)
+            {
+            mySum = (Scalar(f.x) * Scalar(f.x) + Scalar(f.y) * Scalar(f.y)) * inf_f;
+            }
+        }
 
-    // Normalization
-    hipfftComplex fourier_G_x;
-    fourier_G_x.x = f.y * kvec.x * scaled_inf_f;
-    fourier_G_x.y = -f.x * kvec.x * scaled_inf_f;
+    sdata[threadIdx.x] = mySum;
+
+    __syncthreads();
 
-    hipfftComplex fourier_G_y;
-    fourier_G_y.x = f.y * kvec.y * scaled_inf_f;
-    fourier_G_y.y = -f.x * kvec.y * scaled_inf_f;
+    // reduce the energy sum, the tuned block size is not necessarily a power of two
+    unsigned int offs = 1;
+    while (offs < blockDim.x)
+        offs <<= 1;
+    offs >>= 1;
 
-    hipfftComplex fourier_G_z;
-    fourier_G_z.x = f.y * kvec.z * scaled_inf_f;
-    fourier_G_z.y = -f.x * kvec.z * scaled_inf_f;
+    while (offs > 0)
+        {
+        if (threadIdx.x < offs && threadIdx.x + offs < blockDim.x)
+            {
+            sdata[threadIdx.x] += sdata[threadIdx.x + offs];
+            }
+        offs >>= 1;
+        __syncthreads();
+        }
 
-    // store in global memory
-    d_fourier_mesh_G_x[k] = fourier_G_x;
-    d_fourier_mesh_G_y[k] = fourier_G_y;
-    d_fourier_mesh_G_z[k] = fourier_G_z;
+    // write result to global memory
+    if (threadIdx.x == 0)
+        d_sum_partial[blockIdx.x] = sdata[0];
     }
 
-void gpu_update_meshes(const unsigned int n_wave_vectors,
-                       hipfftComplex* d_fourier_mesh,
-                       hipfftComplex* d_fourier_mesh_G_x,
-                       hipfftComplex* d_fourier_mesh_G_y,
-                       hipfftComplex* d_fourier_mesh_G_z,
-                       const Scalar* d_inf_f,
-                       const Scalar3* d_k,
-                       unsigned int NNN,
-                       unsigned int block_size)
+/*! Multiply the Fourier transformed charge density by the influence function and the wave vectors
+    to generate the force meshes, and compute the partial sums of the energy while the mesh and the
+    influence function are in registers.
+
+    \returns The number of partial sums written to \a d_sum_partial
+*/
+unsigned int gpu_update_meshes(const unsigned int n_wave_vectors,
+                               hipfftComplex* d_fourier_mesh,
+                               hipfftComplex* d_fourier_mesh_G_x,
+                               hipfftComplex* d_fourier_mesh_G_y,
+                               hipfftComplex* d_fourier_mesh_G_z,
+                               const Scalar* d_inf_f,
+                               const Scalar3* d_k,
+                               unsigned int NNN,
+                               Scalar* d_sum_partial,
+                               const bool exclude_dc,
+                               unsigned int block_size)
 
     {
     unsigned int max_block_size;
@@ -532,12 +577,13 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
     max_block_size = attr.maxThreadsPerBlock;
 
     unsigned int run_block_size = min(max_block_size, block_size);
-    dim3 grid(n_wave_vectors / run_block_size + 1, 1, 1);
+    unsigned int n_blocks = n_wave_vectors / run_block_size + 1;
+    dim3 grid(n_blocks, 1, 1);
 
     hipLaunchKernelGGL((gpu_update_meshes_kernel),
                        dim3(grid),
                        dim3(run_block_size),
-                       0,
+                       run_block_size * sizeof(Scalar),
                        0,
                        n_wave_vectors,
                        d_fourier_mesh,
@@ -546,7 +592,11 @@ void gpu_update_meshes(const unsigned int n_wave_vectors,
                        d_fourier_mesh_G_z,
                        d_inf_f,
                        d_k,
-                       NNN);
+                       NNN,
+                       d_sum_partial,
+                       exclude_dc);
+
+    return n_blocks;
     }
 
 __global__ void gpu_compute_forces_kernel(const unsigned int work_size,
@@ -758,53 +808,6 @@ void gpu_compute_forces(const unsigned int N,
         }
     }
 
-__global__ void kernel_calculate_pe_partial(int n_wave_vectors,
-                                            Scalar* sum_partial,
-                                            const hipfftComplex* d_fourier_mesh,
-                                            const Scalar* d_inf_f,
-                                            const bool exclude_dc)
-    {
-    HIP_DYNAMIC_SHARED(Scalar, sdata)
-
-    unsigned int tidx = threadIdx.x;
-
-    unsigned int j;
-
-    j = blockDim.x * blockIdx.x + threadIdx.x;
-
-    Scalar mySum = Scalar(0.0);
-
-    if (j < n_wave_vectors)
-        {
-        if (!exclude_dc || j != 0)
-            {
-            mySum = d_fourier_mesh[j].x * d_fourier_mesh[j].x
-                    + d_fourier_mesh[j].y * d_fourier_mesh[j].y;
-            mySum *= d_inf_f[j];
-            }
-        }
-
-    sdata[tidx] = mySum;
-
-    __syncthreads();
-
-    // reduce the sum
-    int offs = blockDim.x >> 1;
-    while (offs > 0)
-        {
-        if (tidx < offs)
-            {
-            sdata[tidx] += sdata[tidx + offs];
-            }
-        offs >>= 1;
-        __syncthreads();
-        }
-
-    // write result to global memory
-    if (tidx == 0)
-        sum_partial[blockIdx.x] = sdata[0];
-    }
-
 __global__ void kernel_final_reduce_pe(Scalar* sum_partial, unsigned int nblocks, Scalar* sum)
     {
     HIP_DYNAMIC_SHARED(Scalar, smem)
@@ -839,35 +842,12 @@ __global__ void kernel_final_reduce_pe(Scalar* sum_partial, unsigned int nblocks
         }
     }
 
-void gpu_compute_pe(unsigned int n_wave_vectors,
-                    Scalar* d_sum_partial,
-                    Scalar* d_sum,
-                    const hipfftComplex* d_fourier_mesh,
-                    const Scalar* d_inf_f,
-                    const unsigned int block_size,
-                    const uint3 mesh_dim,
-                    const bool exclude_dc)
+//! Reduce the partial energy sums written by gpu_update_meshes
+void gpu_reduce_pe(Scalar* d_sum_partial, unsigned int n_blocks, Scalar* d_sum)
     {
-    unsigned int n_blocks = n_wave_vectors / block_size + 1;
-
-    unsigned int shared_size = (unsigned int)(block_size * sizeof(Scalar));
-
-    dim3 grid(n_blocks, 1, 1);
-
-    hipLaunchKernelGGL((kernel_calculate_pe_partial),
-                       dim3(grid),
-                       dim3(block_size),
-                       shared_size,
-                       0,
-                       n_wave_vectors,
-                       d_sum_partial,
-                       d_fourier_mesh,
-                       d_inf_f,
-                       exclude_dc);
-
     // calculate final sum of mesh values
     const unsigned int final_block_size = 256;
-    shared_size = final_block_size * sizeof(Scalar);
+    unsigned int shared_size = final_block_size * sizeof(Scalar);
     hipLaunchKernelGGL((kernel_final_reduce_pe),
                        dim3(1),
                        dim3(final_block_size),
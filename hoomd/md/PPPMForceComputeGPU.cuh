@@ -55,15 +55,17 @@ void gpu_compute_mesh_virial(const unsigned int n_wave_vectors,
                              const bool exclude_dc,
                              Scalar kappa);
 
-void gpu_update_meshes(const unsigned int n_wave_vectors,
-                       hipfftComplex* d_fourier_mesh,
-                       hipfftComplex* d_fourier_mesh_G_x,
-                       hipfftComplex* d_fourier_mesh_G_y,
-                       hipfftComplex* d_fourier_mesh_G_z,
-                       const Scalar* d_inf_f,
-                       const Scalar3* d_k,
-                       unsigned int NNN,
-                       unsigned int block_size);
+unsigned int gpu_update_meshes(const unsigned int n_wave_vectors,
+                               hipfftComplex* d_fourier_mesh,
+                               hipfftComplex* d_fourier_mesh_G_x,
+                               hipfftComplex* d_fourier_mesh_G_y,
+                               hipfftComplex* d_fourier_mesh_G_z,
+                               const Scalar* d_inf_f,
+                               const Scalar3* d_k,
+                               unsigned int NNN,
+                               Scalar* d_sum_partial,
+                               const bool exclude_dc,
+                               unsigned int block_size);
 
 void gpu_compute_forces(const unsigned int N,
                         const Scalar4* d_postype,
@@ -84,14 +86,7 @@ void gpu_compute_forces(const unsigned int N,
                         bool local_fft,
                         unsigned int inv_mesh_elements);
 
-void gpu_compute_pe(unsigned int n_wave_vectors,
-                    Scalar* d_sum_partial,
-                    Scalar* d_sum,
-                    const hipfftComplex* d_fourier_mesh,
-                    const Scalar* d_inf_f,
-                    const unsigned int block_size,
-                    const uint3 mesh_dim,
-                    const bool exclude_dc);
+void gpu_reduce_pe(Scalar* d_sum_partial, unsigned int n_blocks, Scalar* d_sum);
 
 void gpu_compute_virial(unsigned int n_wave_vectors,
                         Scalar* d_sum_virial_partial,
@@ -133,6 +133,10 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
     GlobalArray<Scalar> m_sum_virial_partial; //!< Partial sums over virial mesh values
     GlobalArray<Scalar> m_sum_virial;         //!< Final sum over virial mesh values
     unsigned int m_block_size;                //!< Block size for fourier mesh reduction
+    unsigned int m_n_sum_partial; //!< Number of partial energy sums written by updateMeshes()
+
+    //! Test whether this rank owns the k = 0 term of the distributed mesh
+    bool excludeDC();
     };
 
     } // end namespace md
@@ -0,0 +1,57 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file PairParticleEnergy.h
+    \brief Declares the interface of pair potentials that evaluate single particle energies
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "NeighborList.h"
+
+#include <memory>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Interface of pair potentials that evaluate the energy of a single particle
+/** Monte Carlo updaters that run alongside MD, such as TypeSwapUpdater, evaluate trial moves with
+    the same pair potentials and neighbor lists that the integrator uses. PairParticleEnergy gives
+    those updaters access without knowing the evaluator type of the PotentialPair template.
+*/
+class PairParticleEnergy
+    {
+    public:
+    /// Destructor
+    virtual ~PairParticleEnergy() { }
+
+    /// Get the neighbor list that the pair potential evaluates
+    virtual std::shared_ptr<NeighborList> getNeighborList() = 0;
+
+    /// Get the cutoff radius of the type pair (type_i, type_j)
+    virtual Scalar getTypePairRCut(unsigned int type_i, unsigned int type_j) = 0;
+
+    /// Compute the energy of all pairs in the neighbor list that include the local particle idx
+    /** Requires a full neighbor list that is up to date with the current particle positions. The
+        energy uses the current types in the particle data.
+    */
+    virtual Scalar computeParticleEnergy(unsigned int idx) = 0;
+
+    /// Add the energies of several local particles to energy
+    /** Adds the energy of particle idx[k] to energy[k] for k < n, with the same requirements as
+        computeParticleEnergy(). Entries of idx that are not local particle indices are skipped. GPU
+        implementations evaluate all particles in one kernel.
+    */
+    virtual void addParticleEnergies(const GlobalArray<unsigned int>& idx,
+                                     unsigned int n,
+                                     GlobalArray<Scalar>& energy)
+        = 0;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
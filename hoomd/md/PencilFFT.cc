@@ -0,0 +1,399 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifdef ENABLE_MPI
+
+#include "PencilFFT.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+/*! \file PencilFFT.cc
+    \brief Defines the pencil decomposed distributed FFT
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace
+    {
+//! First index of block i when n indices are split into p blocks
+inline unsigned int block_begin(unsigned int n, unsigned int p, unsigned int i)
+    {
+    return (unsigned int)((uint64_t)n * i / p);
+    }
+
+//! Block that contains index g when n indices are split into p blocks
+inline unsigned int block_owner(unsigned int n, unsigned int p, unsigned int g)
+    {
+    unsigned int i = (unsigned int)((uint64_t)g * p / n);
+    while (i + 1 < p && block_begin(n, p, i + 1) <= g)
+        i++;
+    while (block_begin(n, p, i) > g)
+        i--;
+    return i;
+    }
+
+//! Number of indices in block i when n indices are split into p blocks
+inline unsigned int block_size(unsigned int n, unsigned int p, unsigned int i)
+    {
+    return block_begin(n, p, i + 1) - block_begin(n, p, i);
+    }
+    } // end anonymous namespace
+
+/*! \param sysdef The system definition
+    \param dim Dimensions of the local block of the mesh
+    \param embed Embedding dimensions of the local block (including ghost cells)
+
+    The global mesh dimensions are dim times the dimensions of the domain decomposition.
+*/
+PencilFFT::PencilFFT(std::shared_ptr<SystemDefinition> sysdef, uint3 dim, uint3 embed)
+    : m_exec_conf(sysdef->getParticleData()->getExecConf()), m_dim(dim), m_embed(embed)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing PencilFFT" << std::endl;
+
+    std::shared_ptr<DomainDecomposition> decomposition
+        = sysdef->getParticleData()->getDomainDecomposition();
+    const Index3D& di = decomposition->getDomainIndexer();
+    uint3 my_pos = decomposition->getGridPos();
+
+    m_global_dim = make_uint3(dim.x * di.getW(), dim.y * di.getH(), dim.z * di.getD());
+
+    MPI_Comm comm = m_exec_conf->getMPICommunicator();
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    // choose the most square pencil grid
+    int pencil_dims[2] = {0, 0};
+    MPI_Dims_create(size, 2, pencil_dims);
+    m_pencil_grid = make_uint2(pencil_dims[0], pencil_dims[1]);
+    unsigned int P1 = m_pencil_grid.x;
+    unsigned int P2 = m_pencil_grid.y;
+
+    if (P1 > std::min(m_global_dim.x, m_global_dim.y)
+        || P2 > std::min(m_global_dim.y, m_global_dim.z))
+        {
+        throw std::runtime_error("The mesh is too small for a pencil decomposition on this "
+                                 "number of ranks.");
+        }
+
+    unsigned int r1 = rank % P1;
+    unsigned int r2 = rank / P1;
+
+    MPI_Comm_split(comm, r2, r1, &m_row_comm);
+    MPI_Comm_split(comm, r1, r2, &m_col_comm);
+
+    const uint3 N = m_global_dim;
+
+    // x pencils: all x, block r1 of y, block r2 of z
+    const unsigned int x_ny = block_size(N.y, P1, r1);
+    const unsigned int x_nz = block_size(N.z, P2, r2);
+    const unsigned int x_y0 = block_begin(N.y, P1, r1);
+    const unsigned int x_z0 = block_begin(N.z, P2, r2);
+
+    // y pencils: block r1 of x, all y, block r2 of z
+    const unsigned int y_nx = block_size(N.x, P1, r1);
+    const unsigned int y_x0 = block_begin(N.x, P1, r1);
+
+    // z pencils: block r1 of x, block r2 of y, all z
+    const unsigned int z_ny = block_size(N.y, P2, r2);
+    const unsigned int z_y0 = block_begin(N.y, P2, r2);
+
+    m_pencil_x.resize((size_t)N.x * x_ny * x_nz);
+    m_pencil_y.resize((size_t)y_nx * N.y * x_nz);
+    m_pencil_z.resize((size_t)y_nx * z_ny * N.z);
+
+    std::vector<unsigned int> src_idx;
+    std::vector<int> dest_rank;
+    std::vector<unsigned int> dest_idx;
+
+    // blocks to x pencils
+    for (unsigned int n = 0; n < dim.z; n++)
+        for (unsigned int m = 0; m < dim.y; m++)
+            for (unsigned int l = 0; l < dim.x; l++)
+                {
+                unsigned int gx = my_pos.x * dim.x + l;
+                unsigned int gy = my_pos.y * dim.y + m;
+                unsigned int gz = my_pos.z * dim.z + n;
+
+                unsigned int d1 = block_owner(N.y, P1, gy);
+                unsigned int d2 = block_owner(N.z, P2, gz);
+                unsigned int ny = block_size(N.y, P1, d1);
+
+                src_idx.push_back(l + embed.x * (m + embed.y * n));
+                dest_rank.push_back(d1 + P1 * d2);
+                dest_idx.push_back(gx
+                                   + N.x
+                                         * ((gy - block_begin(N.y, P1, d1))
+                                            + ny * (gz - block_begin(N.z, P2, d2))));
+                }
+    initRemap(m_block_to_x, comm, src_idx, dest_rank, dest_idx);
+
+    // x pencils to y pencils, within a row
+    src_idx.clear();
+    dest_rank.clear();
+    dest_idx.clear();
+    for (unsigned int k = 0; k < x_nz; k++)
+        for (unsigned int j = 0; j < x_ny; j++)
+            for (unsigned int gx = 0; gx < N.x; gx++)
+                {
+                unsigned int gy = x_y0 + j;
+                unsigned int d1 = block_owner(N.x, P1, gx);
+                unsigned int nx = block_size(N.x, P1, d1);
+
+                src_idx.push_back(gx + N.x * (j + x_ny * k));
+                dest_rank.push_back(d1);
+                dest_idx.push_back(gy + N.y * ((gx - block_begin(N.x, P1, d1)) + nx * k));
+                }
+    initRemap(m_x_to_y, m_row_comm, src_idx, dest_rank, dest_idx);
+
+    // y pencils to z pencils, within a column
+    src_idx.clear();
+    dest_rank.clear();
+    dest_idx.clear();
+    for (unsigned int k = 0; k < x_nz; k++)
+        for (unsigned int i = 0; i < y_nx; i++)
+            for (unsigned int gy = 0; gy < N.y; gy++)
+                {
+                unsigned int gz = x_z0 + k;
+                unsigned int d2 = block_owner(N.y, P2, gy);
+                unsigned int ny = block_size(N.y, P2, d2);
+
+                src_idx.push_back(gy + N.y * (i + y_nx * k));
+                dest_rank.push_back(d2);
+                dest_idx.push_back(gz + N.z * (i + y_nx * (gy - block_begin(N.y, P2, d2))));
+                }
+    initRemap(m_y_to_z, m_col_comm, src_idx, dest_rank, dest_idx);
+
+    // z pencils to the cyclic output layout
+    src_idx.clear();
+    dest_rank.clear();
+    dest_idx.clear();
+        {
+        ArrayHandle<unsigned int> h_cart_ranks(decomposition->getCartRanks(),
+                                               access_location::host,
+                                               access_mode::read);
+
+        for (unsigned int j = 0; j < z_ny; j++)
+            for (unsigned int i = 0; i < y_nx; i++)
+                for (unsigned int gz = 0; gz < N.z; gz++)
+                    {
+                    unsigned int gx = y_x0 + i;
+                    unsigned int gy = z_y0 + j;
+
+                    unsigned int l = gx / di.getW();
+                    unsigned int m = gy / di.getH();
+                    unsigned int n = gz / di.getD();
+
+                    src_idx.push_back(gz + N.z * (i + y_nx * j));
+                    dest_rank.push_back(
+                        h_cart_ranks.data[di(gx % di.getW(), gy % di.getH(), gz % di.getD())]);
+                    dest_idx.push_back(l + dim.x * (m + dim.y * n));
+                    }
+        }
+    initRemap(m_z_to_k, comm, src_idx, dest_rank, dest_idx);
+
+    size_t max_buf = std::max(std::max(m_pencil_x.size(), m_pencil_y.size()),
+                              std::max(m_pencil_z.size(), (size_t)dim.x * dim.y * dim.z));
+    m_send_buf.resize(max_buf);
+    m_recv_buf.resize(max_buf);
+    m_line.resize(std::max(N.x, std::max(N.y, N.z)));
+
+    const unsigned int n_points[3] = {N.x, N.y, N.z};
+    for (unsigned int axis = 0; axis < 3; axis++)
+        {
+        m_fft[axis] = kiss_fft_alloc(n_points[axis], 0, NULL, NULL);
+        m_ifft[axis] = kiss_fft_alloc(n_points[axis], 1, NULL, NULL);
+        }
+
+    m_exec_conf->msg->notice(6) << "PencilFFT: " << P1 << " x " << P2 << " pencil grid for a "
+                                << N.x << " x " << N.y << " x " << N.z << " mesh" << std::endl;
+    }
+
+PencilFFT::~PencilFFT()
+    {
+    for (unsigned int axis = 0; axis < 3; axis++)
+        {
+        kiss_fft_free(m_fft[axis]);
+        kiss_fft_free(m_ifft[axis]);
+        }
+
+    MPI_Comm_free(&m_row_comm);
+    MPI_Comm_free(&m_col_comm);
+    }
+
+/*! \param remap The remap to initialize
+    \param comm Communicator of the ranks that exchange data
+    \param src_idx Local index of every source element
+    \param dest_rank Rank in comm that receives every source element
+    \param dest_idx Index of every source element on the receiving rank
+
+    The destination indices are exchanged once here, later transforms only send the values.
+*/
+void PencilFFT::initRemap(Remap& remap,
+                          MPI_Comm comm,
+                          const std::vector<unsigned int>& src_idx,
+                          const std::vector<int>& dest_rank,
+                          const std::vector<unsigned int>& dest_idx)
+    {
+    int size;
+    MPI_Comm_size(comm, &size);
+
+    remap.comm = comm;
+
+    // sort the source elements by destination rank
+    std::vector<int> send_count(size, 0);
+    for (int r : dest_rank)
+        send_count[r]++;
+
+    std::vector<int> send_offset(size, 0);
+    for (int r = 1; r < size; r++)
+        send_offset[r] = send_offset[r - 1] + send_count[r - 1];
+
+    remap.send_idx.resize(src_idx.size());
+    std::vector<unsigned int> send_dest_idx(src_idx.size());
+    std::vector<int> fill = send_offset;
+    for (size_t i = 0; i < src_idx.size(); i++)
+        {
+        int pos = fill[dest_rank[i]]++;
+        remap.send_idx[pos] = src_idx[i];
+        send_dest_idx[pos] = dest_idx[i];
+        }
+
+    std::vector<int> recv_count(size, 0);
+    MPI_Alltoall(send_count.data(), 1, MPI_INT, recv_count.data(), 1, MPI_INT, comm);
+
+    std::vector<int> recv_offset(size, 0);
+    for (int r = 1; r < size; r++)
+        recv_offset[r] = recv_offset[r - 1] + recv_count[r - 1];
+
+    remap.recv_idx.resize(recv_offset[size - 1] + recv_count[size - 1]);
+    MPI_Alltoallv(send_dest_idx.data(),
+                  send_count.data(),
+                  send_offset.data(),
+                  MPI_UNSIGNED,
+                  remap.recv_idx.data(),
+                  recv_count.data(),
+                  recv_offset.data(),
+                  MPI_UNSIGNED,
+                  comm);
+
+    remap.send_bytes.resize(size);
+    remap.send_displs.resize(size);
+    remap.recv_bytes.resize(size);
+    remap.recv_displs.resize(size);
+    for (int r = 0; r < size; r++)
+        {
+        remap.send_bytes[r] = send_count[r] * (int)sizeof(kiss_fft_cpx);
+        remap.send_displs[r] = send_offset[r] * (int)sizeof(kiss_fft_cpx);
+        remap.recv_bytes[r] = recv_count[r] * (int)sizeof(kiss_fft_cpx);
+        remap.recv_displs[r] = recv_offset[r] * (int)sizeof(kiss_fft_cpx);
+        }
+    }
+
+/*! \param remap The remap to execute
+    \param src Source data
+    \param dest Destination data
+    \param reverse True to move the data from the destination layout back to the source layout
+*/
+void PencilFFT::executeRemap(const Remap& remap,
+                             const kiss_fft_cpx* src,
+                             kiss_fft_cpx* dest,
+                             bool reverse)
+    {
+    const std::vector<unsigned int>& pack_idx = reverse ? remap.recv_idx : remap.send_idx;
+    const std::vector<unsigned int>& unpack_idx = reverse ? remap.send_idx : remap.recv_idx;
+
+    for (size_t i = 0; i < pack_idx.size(); i++)
+        m_send_buf[i] = src[pack_idx[i]];
+
+    MPI_Alltoallv(m_send_buf.data(),
+                  reverse ? remap.recv_bytes.data() : remap.send_bytes.data(),
+                  reverse ? remap.recv_displs.data() : remap.send_displs.data(),
+                  MPI_BYTE,
+                  m_recv_buf.data(),
+                  reverse ? remap.send_bytes.data() : remap.recv_bytes.data(),
+                  reverse ? remap.send_displs.data() : remap.recv_displs.data(),
+                  MPI_BYTE,
+                  remap.comm);
+
+    for (size_t i = 0; i < unpack_idx.size(); i++)
+        dest[unpack_idx[i]] = m_recv_buf[i];
+    }
+
+/*! \param cfg 1D transform of length n
+    \param data Lines of length n, stored contiguously one after another
+    \param n Length of a line
+    \param n_lines Number of lines
+*/
+void PencilFFT::transformLines(kiss_fft_cfg cfg,
+                               kiss_fft_cpx* data,
+                               unsigned int n,
+                               size_t n_lines)
+    {
+    for (size_t line = 0; line < n_lines; line++)
+        {
+        kiss_fft(cfg, data + line * n, m_line.data());
+        std::copy(m_line.begin(), m_line.begin() + n, data + line * n);
+        }
+    }
+
+/*! \param in Local block of the mesh, with the embedding dimensions given on construction
+    \param out Local part of the transform in the cyclic layout
+*/
+void PencilFFT::forward(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    executeRemap(m_block_to_x, in, m_pencil_x.data(), false);
+    transformLines(m_fft[0],
+                   m_pencil_x.data(),
+                   m_global_dim.x,
+                   m_pencil_x.size() / m_global_dim.x);
+
+    executeRemap(m_x_to_y, m_pencil_x.data(), m_pencil_y.data(), false);
+    transformLines(m_fft[1],
+                   m_pencil_y.data(),
+                   m_global_dim.y,
+                   m_pencil_y.size() / m_global_dim.y);
+
+    executeRemap(m_y_to_z, m_pencil_y.data(), m_pencil_z.data(), false);
+    transformLines(m_fft[2],
+                   m_pencil_z.data(),
+                   m_global_dim.z,
+                   m_pencil_z.size() / m_global_dim.z);
+
+    executeRemap(m_z_to_k, m_pencil_z.data(), out, false);
+    }
+
+/*! \param in Local part of the transform in the cyclic layout
+    \param out Local block of the mesh, with the embedding dimensions given on construction. Ghost
+        cells are not written.
+*/
+void PencilFFT::inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out)
+    {
+    executeRemap(m_z_to_k, in, m_pencil_z.data(), true);
+    transformLines(m_ifft[2],
+                   m_pencil_z.data(),
+                   m_global_dim.z,
+                   m_pencil_z.size() / m_global_dim.z);
+
+    executeRemap(m_y_to_z, m_pencil_z.data(), m_pencil_y.data(), true);
+    transformLines(m_ifft[1],
+                   m_pencil_y.data(),
+                   m_global_dim.y,
+                   m_pencil_y.size() / m_global_dim.y);
+
+    executeRemap(m_x_to_y, m_pencil_y.data(), m_pencil_x.data(), true);
+    transformLines(m_ifft[0],
+                   m_pencil_x.data(),
+                   m_global_dim.x,
+                   m_pencil_x.size() / m_global_dim.x);
+
+    executeRemap(m_block_to_x, m_pencil_x.data(), out, true);
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_MPI
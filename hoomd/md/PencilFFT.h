@@ -0,0 +1,123 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PENCIL_FFT_H__
+#define __PENCIL_FFT_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/SystemDefinition.h"
+#include "hoomd/extern/kiss_fft.h"
+
+#include <memory>
+#include <vector>
+
+/*! \file PencilFFT.h
+    \brief Declares the pencil decomposed distributed FFT
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#ifdef ENABLE_MPI
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Distributed 3D FFT on a 2D (pencil) decomposition of the ranks
+/*! The input mesh is distributed in blocks over the domain decomposition, as in PPPMForceCompute.
+    PencilFFT redistributes it to pencils that hold complete lines along x, transforms them,
+    transposes to pencils along y and then z, and transforms those. The pencil grid is a P1 x P2
+    factorization of all ranks that does not depend on the domain decomposition, and the
+    transposes only communicate within rows (x <-> y) or columns (y <-> z) of the pencil grid.
+
+    The forward transform writes its output in the cyclic layout of dfft: the local element
+    (l, m, n) on the domain at grid position p holds the wave vector (l * W + p.x, m * H + p.y,
+    n * D + p.z), with the domain grid dimensions W x H x D. The inverse transform reads that
+    layout and writes the blocks back. Neither transform is normalized.
+
+    All redistribution patterns are computed once on construction. A transform packs the send
+    buffer with precomputed indices and exchanges it with a single MPI_Alltoallv.
+*/
+class PYBIND11_EXPORT PencilFFT
+    {
+    public:
+    //! Constructor
+    PencilFFT(std::shared_ptr<SystemDefinition> sysdef, uint3 dim, uint3 embed);
+
+    //! Destructor
+    ~PencilFFT();
+
+    //! Forward transform
+    void forward(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    //! Inverse transform
+    void inverse(const kiss_fft_cpx* in, kiss_fft_cpx* out);
+
+    //! Get the dimensions of the pencil grid
+    uint2 getPencilGrid() const
+        {
+        return m_pencil_grid;
+        }
+
+    private:
+    //! Redistribution of mesh points between two layouts
+    struct Remap
+        {
+        MPI_Comm comm;                      //!< Communicator of the participating ranks
+        std::vector<int> send_bytes;        //!< Bytes sent to every rank
+        std::vector<int> send_displs;       //!< Byte offset of every rank in the send buffer
+        std::vector<int> recv_bytes;        //!< Bytes received from every rank
+        std::vector<int> recv_displs;       //!< Byte offset of every rank in the recv buffer
+        std::vector<unsigned int> send_idx; //!< Source index of every element in the send buffer
+        std::vector<unsigned int> recv_idx; //!< Destination index of every received element
+        };
+
+    std::shared_ptr<const ExecutionConfiguration> m_exec_conf; //!< Execution configuration
+
+    uint3 m_global_dim;  //!< Global mesh dimensions
+    uint3 m_dim;         //!< Dimensions of the local block
+    uint3 m_embed;       //!< Embedding dimensions of the local block
+    uint2 m_pencil_grid; //!< Dimensions of the pencil grid (P1, P2)
+
+    MPI_Comm m_row_comm; //!< Ranks with the same z range in the x and y pencils
+    MPI_Comm m_col_comm; //!< Ranks with the same x range in the y and z pencils
+
+    Remap m_block_to_x; //!< Blocks to x pencils
+    Remap m_x_to_y;     //!< x pencils to y pencils
+    Remap m_y_to_z;     //!< y pencils to z pencils
+    Remap m_z_to_k;     //!< z pencils to the cyclic output layout
+
+    std::vector<kiss_fft_cpx> m_pencil_x; //!< Local x pencils
+    std::vector<kiss_fft_cpx> m_pencil_y; //!< Local y pencils
+    std::vector<kiss_fft_cpx> m_pencil_z; //!< Local z pencils
+    std::vector<kiss_fft_cpx> m_send_buf; //!< Send buffer
+    std::vector<kiss_fft_cpx> m_recv_buf; //!< Receive buffer
+    std::vector<kiss_fft_cpx> m_line;     //!< Scratch space for one line
+
+    kiss_fft_cfg m_fft[3];  //!< Forward 1D transforms along x, y, and z
+    kiss_fft_cfg m_ifft[3]; //!< Inverse 1D transforms along x, y, and z
+
+    //! Set up the exchange pattern of a remap
+    void initRemap(Remap& remap,
+                   MPI_Comm comm,
+                   const std::vector<unsigned int>& src_idx,
+                   const std::vector<int>& dest_rank,
+                   const std::vector<unsigned int>& dest_idx);
+
+    //! Move data along a remap, or against it if reverse is true
+    void executeRemap(const Remap& remap,
+                      const kiss_fft_cpx* src,
+                      kiss_fft_cpx* dest,
+                      bool reverse);
+
+    //! Transform all contiguous lines of length n in place
+    void transformLines(kiss_fft_cfg cfg, kiss_fft_cpx* data, unsigned int n, size_t n_lines);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_MPI
+#endif // __PENCIL_FFT_H__
@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "BondedForceLoop.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GPUArray.h"
 #include "hoomd/MeshDefinition.h"
@@ -60,6 +61,9 @@ template<class evaluator, class Bonds> class PotentialBond : public ForceCompute
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
 #endif
 
+    //! Compute the total bond energy without accumulating or writing forces and virials
+    virtual Scalar computeEnergy(uint64_t timestep);
+
     protected:
     GPUArray<param_type> m_params;      //!< Bond parameters per type
     std::shared_ptr<Bonds> m_bond_data; //!< Bond data to use in computing bonds
@@ -197,10 +201,6 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     PDataFlags flags = this->m_pdata->getFlags();
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
-    Scalar bond_virial[6];
-    for (unsigned int i = 0; i < 6; i++)
-        bond_virial[i] = Scalar(0.0);
-
     ArrayHandle<typename Bonds::members_t> h_bonds(m_bond_data->getMembersArray(),
                                                    access_location::host,
                                                    access_mode::read);
@@ -213,19 +213,160 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
     // for each of the bonds
     const unsigned int size = (unsigned int)m_bond_data->getN();
 
-    for (unsigned int i = 0; i < size; i++)
+    auto compute_bonds = [&](unsigned int begin,
+                             unsigned int end,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
         {
-        // lookup the tag of each of the particles participating in the bond
-        const typename Bonds::members_t& bond = h_bonds.data[i];
-        assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
-        assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
+        for (unsigned int i = begin; i < end; i++)
+            {
+            // lookup the tag of each of the particles participating in the bond
+            const typename Bonds::members_t& bond = h_bonds.data[i];
+            assert(bond.tag[0] < m_pdata->getMaximumTag() + 1);
+            assert(bond.tag[1] < m_pdata->getMaximumTag() + 1);
+
+            // transform a and b into indices into the particle data arrays
+            // (MEM TRANSFER: 4 integers)
+            unsigned int idx_a = h_rtag.data[bond.tag[0]];
+            unsigned int idx_b = h_rtag.data[bond.tag[1]];
+
+            // throw an error if this bond is incomplete
+            if (idx_a >= max_local || idx_b >= max_local)
+                {
+                std::ostringstream stream;
+                stream << "Error: bond " << bond.tag[0] << " " << bond.tag[1]
+                       << " is incomplete.";
+                throw std::runtime_error(stream.str());
+                }
+
+            // calculate d\vec{r}
+            // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
+            Scalar3 posa
+                = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
+            Scalar3 posb
+                = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+
+            Scalar3 dx = posb - posa;
+
+            // access charge (if needed)
+            Scalar charge_a = Scalar(0.0);
+            Scalar charge_b = Scalar(0.0);
+            if (evaluator::needsCharge())
+                {
+                charge_a = h_charge.data[idx_a];
+                charge_b = h_charge.data[idx_b];
+                }
+
+            // if the vector crosses the box, pull it back
+            dx = box.minImage(dx);
+
+            // calculate r_ab squared
+            Scalar rsq = dot(dx, dx);
+
+            // compute the force and potential energy
+            Scalar force_divr = Scalar(0.0);
+            Scalar bond_eng = Scalar(0.0);
+            evaluator eval(rsq, h_params.data[h_typeval.data[i].type]);
+            if (evaluator::needsCharge())
+                eval.setCharge(charge_a, charge_b);
+
+            bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+
+            // Bond energy must be halved
+            bond_eng *= Scalar(0.5);
+
+            if (evaluated)
+                {
+                // calculate virial
+                Scalar bond_virial[6];
+                if (compute_virial)
+                    {
+                    Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
+                    bond_virial[0] = dx.x * dx.x * force_div2r; // xx
+                    bond_virial[1] = dx.x * dx.y * force_div2r; // xy
+                    bond_virial[2] = dx.x * dx.z * force_div2r; // xz
+                    bond_virial[3] = dx.y * dx.y * force_div2r; // yy
+                    bond_virial[4] = dx.y * dx.z * force_div2r; // yz
+                    bond_virial[5] = dx.z * dx.z * force_div2r; // zz
+                    }
+
+                // add the force to the particles (only for non-ghost particles)
+                if (idx_b < m_pdata->getN())
+                    {
+                    force[idx_b].x += force_divr * dx.x;
+                    force[idx_b].y += force_divr * dx.y;
+                    force[idx_b].z += force_divr * dx.z;
+                    force[idx_b].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_b] += bond_virial[i];
+                    }
+
+                if (idx_a < m_pdata->getN())
+                    {
+                    force[idx_a].x -= force_divr * dx.x;
+                    force[idx_a].y -= force_divr * dx.y;
+                    force[idx_a].z -= force_divr * dx.z;
+                    force[idx_a].w += bond_eng;
+                    if (compute_virial)
+                        for (unsigned int i = 0; i < 6; i++)
+                            virial[i * virial_pitch + idx_a] += bond_virial[i];
+                    }
+                }
+            else
+                {
+                this->m_exec_conf->msg->error()
+                    << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
+                    << std::endl;
+                throw std::runtime_error("Error in bond calculation");
+                }
+            }
+        };
+
+    detail::for_each_bonded_group(m_exec_conf,
+                                  size,
+                                  m_pdata->getN(),
+                                  compute_virial,
+                                  h_force.data,
+                                  h_virial.data,
+                                  m_virial_pitch,
+                                  compute_bonds);
+    }
+
+/*! \param timestep Current time step
+    \returns The total bond energy on all ranks
+
+    Each local member of a bond adds half of the bond energy, as in computeForces(), so a bond
+    that spans two ranks is counted once. The force and virial arrays are left unchanged. The GPU
+    implementations use this host implementation.
+*/
+template<class evaluator, class Bonds>
+Scalar PotentialBond<evaluator, Bonds>::computeEnergy(uint64_t timestep)
+    {
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<param_type> h_params(m_params, access_location::host, access_mode::read);
+    ArrayHandle<typename Bonds::members_t> h_bonds(m_bond_data->getMembersArray(),
+                                                   access_location::host,
+                                                   access_mode::read);
+    ArrayHandle<typeval_t> h_typeval(m_bond_data->getTypeValArray(),
+                                     access_location::host,
+                                     access_mode::read);
 
-        // transform a and b into indices into the particle data arrays
-        // (MEM TRANSFER: 4 integers)
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+    const unsigned int max_local = N + m_pdata->getNGhosts();
+
+    double energy = 0.0;
+    for (unsigned int i = 0; i < (unsigned int)m_bond_data->getN(); i++)
+        {
+        const typename Bonds::members_t& bond = h_bonds.data[i];
         unsigned int idx_a = h_rtag.data[bond.tag[0]];
         unsigned int idx_b = h_rtag.data[bond.tag[1]];
-
-        // throw an error if this bond is incomplete
         if (idx_a >= max_local || idx_b >= max_local)
             {
             std::ostringstream stream;
@@ -233,85 +374,38 @@ void PotentialBond<evaluator, Bonds>::computeForces(uint64_t timestep)
             throw std::runtime_error(stream.str());
             }
 
-        // calculate d\vec{r}
-        // (MEM TRANSFER: 6 Scalars / FLOPS: 3)
         Scalar3 posa = make_scalar3(h_pos.data[idx_a].x, h_pos.data[idx_a].y, h_pos.data[idx_a].z);
         Scalar3 posb = make_scalar3(h_pos.data[idx_b].x, h_pos.data[idx_b].y, h_pos.data[idx_b].z);
+        Scalar3 dx = box.minImage(posb - posa);
 
-        Scalar3 dx = posb - posa;
-
-        // access charge (if needed)
-        Scalar charge_a = Scalar(0.0);
-        Scalar charge_b = Scalar(0.0);
-        if (evaluator::needsCharge())
-            {
-            charge_a = h_charge.data[idx_a];
-            charge_b = h_charge.data[idx_b];
-            }
-
-        // if the vector crosses the box, pull it back
-        dx = box.minImage(dx);
-
-        // calculate r_ab squared
-        Scalar rsq = dot(dx, dx);
-
-        // compute the force and potential energy
         Scalar force_divr = Scalar(0.0);
         Scalar bond_eng = Scalar(0.0);
-        evaluator eval(rsq, h_params.data[h_typeval.data[i].type]);
+        evaluator eval(dot(dx, dx), h_params.data[h_typeval.data[i].type]);
         if (evaluator::needsCharge())
-            eval.setCharge(charge_a, charge_b);
-
-        bool evaluated = eval.evalForceAndEnergy(force_divr, bond_eng);
+            eval.setCharge(h_charge.data[idx_a], h_charge.data[idx_b]);
 
-        // Bond energy must be halved
-        bond_eng *= Scalar(0.5);
-
-        if (evaluated)
+        if (!eval.evalForceAndEnergy(force_divr, bond_eng))
             {
-            // calculate virial
-            if (compute_virial)
-                {
-                Scalar force_div2r = Scalar(1.0 / 2.0) * force_divr;
-                bond_virial[0] = dx.x * dx.x * force_div2r; // xx
-                bond_virial[1] = dx.x * dx.y * force_div2r; // xy
-                bond_virial[2] = dx.x * dx.z * force_div2r; // xz
-                bond_virial[3] = dx.y * dx.y * force_div2r; // yy
-                bond_virial[4] = dx.y * dx.z * force_div2r; // yz
-                bond_virial[5] = dx.z * dx.z * force_div2r; // zz
-                }
+            throw std::runtime_error("Error in bond calculation: bond out of bounds");
+            }
 
-            // add the force to the particles (only for non-ghost particles)
-            if (idx_b < m_pdata->getN())
-                {
-                h_force.data[idx_b].x += force_divr * dx.x;
-                h_force.data[idx_b].y += force_divr * dx.y;
-                h_force.data[idx_b].z += force_divr * dx.z;
-                h_force.data[idx_b].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_b] += bond_virial[i];
-                }
+        unsigned int n_local = (idx_a < N ? 1 : 0) + (idx_b < N ? 1 : 0);
+        energy += Scalar(0.5) * bond_eng * Scalar(n_local);
+        }
 
-            if (idx_a < m_pdata->getN())
-                {
-                h_force.data[idx_a].x -= force_divr * dx.x;
-                h_force.data[idx_a].y -= force_divr * dx.y;
-                h_force.data[idx_a].z -= force_divr * dx.z;
-                h_force.data[idx_a].w += bond_eng;
-                if (compute_virial)
-                    for (unsigned int i = 0; i < 6; i++)
-                        h_virial.data[i * m_virial_pitch + idx_a] += bond_virial[i];
-                }
-            }
-        else
-            {
-            this->m_exec_conf->msg->error()
-                << "bond." << evaluator::getName() << ": bond out of bounds" << std::endl
-                << std::endl;
-            throw std::runtime_error("Error in bond calculation");
-            }
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &energy,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
         }
+#endif
+
+    return Scalar(energy);
     }
 
 #ifdef ENABLE_MPI
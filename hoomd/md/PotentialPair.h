@@ -4,13 +4,16 @@
 #ifndef __POTENTIAL_PAIR_H__
 #define __POTENTIAL_PAIR_H__
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <type_traits>
 
 #include "NeighborList.h"
+#include "PairParticleEnergy.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GlobalArray.h"
 #include "hoomd/HOOMDMath.h"
@@ -26,6 +29,12 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file PotentialPair.h
     \brief Defines the template class for standard pair potentials
     \details The heart of the code that computes pair potentials is in this file.
@@ -40,6 +49,21 @@ namespace hoomd
     {
 namespace md
     {
+namespace detail
+    {
+/// Number of energy components that a pair evaluator reports separately, 0 when it has none
+template<class evaluator, class = void> struct PairEnergyComponents
+    {
+    static constexpr unsigned int value = 0;
+    };
+
+template<class evaluator>
+struct PairEnergyComponents<evaluator, std::void_t<decltype(evaluator::n_components)>>
+    {
+    static constexpr unsigned int value = evaluator::n_components;
+    };
+    } // end namespace detail
+
 //! Template class for computing pair potentials
 /*! <b>Overview:</b>
     PotentialPair computes standard pair potentials (and forces) between all particle pairs in the
@@ -80,8 +104,12 @@ namespace md
    values are stored in GlobalArray for easy access on the GPU by a derived class. The type of the
    parameters is defined by \a param_type in the potential evaluator class passed in. See the
    appropriate documentation for the evaluator for the definition of each element of the parameters.
+
+    Evaluators that define \a n_components, such as EvaluatorPairComposite, also report the energy
+   of each component through getComponentEnergy(). computeForces() then tallies the component
+   energies of the pairs of each local particle in m_component_energy.
 */
-template<class evaluator> class PotentialPair : public ForceCompute
+template<class evaluator> class PotentialPair : public ForceCompute, public PairParticleEnergy
     {
     public:
     //! Param type from evaluator
@@ -185,6 +213,12 @@ template<class evaluator> class PotentialPair : public ForceCompute
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+
+    //! Computes the forces on interior particles while the ghost update is in flight
+    virtual bool overlapsGhostUpdate()
+        {
+        return true;
+        }
 #endif
 
     //! Calculates the energy between two lists of particles.
@@ -199,6 +233,30 @@ template<class evaluator> class PotentialPair : public ForceCompute
     computeEnergyBetweenSetsPythonList(pybind11::array_t<int, pybind11::array::c_style> tags1,
                                        pybind11::array_t<int, pybind11::array::c_style> tags2);
 
+    //! Compute the total pair energy without accumulating or writing forces and virials
+    virtual Scalar computeEnergy(uint64_t timestep);
+
+    //! Get the neighbor list
+    virtual std::shared_ptr<NeighborList> getNeighborList()
+        {
+        return m_nlist;
+        }
+
+    //! Get the cutoff radius of a type pair
+    virtual Scalar getTypePairRCut(unsigned int type_i, unsigned int type_j)
+        {
+        ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+        return sqrt(h_rcutsq.data[m_typpair_idx(type_i, type_j)]);
+        }
+
+    //! Compute the energy of all pairs that include one local particle
+    virtual Scalar computeParticleEnergy(unsigned int idx);
+
+    //! Add the energies of several local particles
+    virtual void addParticleEnergies(const GlobalArray<unsigned int>& idx,
+                                     unsigned int n,
+                                     GlobalArray<Scalar>& energy);
+
     std::vector<std::string> getTypeShapeMapping() const
         {
         std::vector<std::string> type_shape_mapping(m_pdata->getNTypes());
@@ -242,14 +300,59 @@ template<class evaluator> class PotentialPair : public ForceCompute
     /// Keep track of number of each type of particle
     std::vector<unsigned int> m_num_particles_by_type;
 
+    /// Number of energy components reported by the evaluator
+    static constexpr unsigned int n_energy_components
+        = detail::PairEnergyComponents<evaluator>::value;
+
+    /// Energy of each component on the local particles, indexed by i * n_energy_components + c
+    /*! The energy of a pair with a local j in a half list is tallied on i alone, so the sum over
+        all particles is the total energy of the component.
+    */
+    std::vector<AccumReal> m_component_energy;
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
+
+    /// Work items ordered so that the items that interact only with local particles come first
+    std::vector<unsigned int> m_item_order;
+
+    /// Number of items at the start of m_item_order that interact only with local particles
+    unsigned int m_n_interior_items = 0;
+
+    /// Number of neighbor list updates when m_item_order was computed
+    uint64_t m_item_order_nlist_updates = 0;
 #endif
 
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
 
+    //! Evaluate the force and energy of a single pair
+    /*! \param rsq Squared distance between the particles
+        \param typpair_idx Index of the type pair
+        \param qi Charge of particle i
+        \param qj Charge of particle j
+        \param rcutsq_array Per type pair squared cutoff radii
+        \param ronsq_array Per type pair squared XPLOR smoothing radii
+        \param force_divr Output: force divided by r
+        \param pair_eng Output: pair energy
+        \param component_eng Output: energy of each component, when the evaluator reports them
+
+        Applies the energy shift and XPLOR smoothing selected by the shift mode. Sets
+        \a force_divr and \a pair_eng to 0 when the pair is not evaluated.
+
+        \returns true when the pair is within the cutoff
+    */
+    inline bool evaluatePair(Scalar rsq,
+                             unsigned int typpair_idx,
+                             Scalar qi,
+                             Scalar qj,
+                             const Scalar* rcutsq_array,
+                             const Scalar* ronsq_array,
+                             Scalar& force_divr,
+                             Scalar& pair_eng,
+                             Scalar* component_eng = nullptr) const;
+
     //! Compute the long-range corrections to energy and pressure to account for truncating the pair
     //! potentials
     virtual void computeTailCorrection()
@@ -579,6 +682,100 @@ void PotentialPair<evaluator>::setROnPython(pybind11::tuple types, Scalar r_on)
     setRon(typ1, typ2, r_on);
     }
 
+template<class evaluator>
+inline bool PotentialPair<evaluator>::evaluatePair(Scalar rsq,
+                                                  unsigned int typpair_idx,
+                                                  Scalar qi,
+                                                  Scalar qj,
+                                                  const Scalar* rcutsq_array,
+                                                  const Scalar* ronsq_array,
+                                                  Scalar& force_divr,
+                                                  Scalar& pair_eng,
+                                                  Scalar* component_eng) const
+    {
+    // get parameters for this type pair
+    const param_type& param = m_params[typpair_idx];
+    Scalar rcutsq = rcutsq_array[typpair_idx];
+    Scalar ronsq = Scalar(0.0);
+    if (m_shift_mode == xplor)
+        ronsq = ronsq_array[typpair_idx];
+
+    // design specifies that energies are shifted if
+    // 1) shift mode is set to shift
+    // or 2) shift mode is explor and ron > rcut
+    bool energy_shift = false;
+    if (m_shift_mode == shift)
+        energy_shift = true;
+    else if (m_shift_mode == xplor)
+        {
+        if (ronsq > rcutsq)
+            energy_shift = true;
+        }
+
+    // compute the force and potential energy
+    force_divr = Scalar(0.0);
+    pair_eng = Scalar(0.0);
+    evaluator eval(rsq, rcutsq, param);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, qj);
+
+    bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+    if constexpr (n_energy_components > 0)
+        {
+        if (component_eng)
+            {
+            for (unsigned int c = 0; c < n_energy_components; c++)
+                component_eng[c] = eval.getComponentEnergy(c);
+            }
+        }
+
+    if (evaluated)
+        {
+        // modify the potential for xplor shifting
+        if (m_shift_mode == xplor)
+            {
+            if (rsq >= ronsq && rsq < rcutsq)
+                {
+                // Implement XPLOR smoothing (FLOPS: 16)
+                Scalar old_pair_eng = pair_eng;
+                Scalar old_force_divr = force_divr;
+
+                // calculate 1.0 / (xplor denominator)
+                Scalar xplor_denom_inv
+                    = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+
+                Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+                Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                           * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+                Scalar ds_dr_divr
+                    = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+                // make modifications to the old pair energy and force
+                pair_eng = old_pair_eng * s;
+                if constexpr (n_energy_components > 0)
+                    {
+                    if (component_eng)
+                        {
+                        for (unsigned int c = 0; c < n_energy_components; c++)
+                            component_eng[c] *= s;
+                        }
+                    }
+                // note: I'm not sure why the minus sign needs to be there: my notes have a
+                // + But this is verified correct via plotting
+                force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+                }
+            }
+        }
+    else
+        {
+        force_divr = Scalar(0.0);
+        pair_eng = Scalar(0.0);
+        }
+
+    return evaluated;
+    }
+
 /*! \post The pair forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
@@ -605,7 +802,22 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
                                     access_location::host,
                                     access_mode::read);
 
-    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    // access the cluster pair list, when the neighbor list provides one
+    const bool use_clusters = m_nlist->hasClusterPairs();
+    ArrayHandle<unsigned int> h_cluster_n_pairs(m_nlist->getClusterNPairsArray(),
+                                                access_location::host,
+                                                access_mode::read);
+    ArrayHandle<size_t> h_cluster_head_list(m_nlist->getClusterHeadList(),
+                                            access_location::host,
+                                            access_mode::read);
+    ArrayHandle<uint2> h_cluster_pair_list(m_nlist->getClusterPairArray(),
+                                           access_location::host,
+                                           access_mode::read);
+
+    // the positions are released while a deferred ghost update completes
+    auto h_pos = std::make_unique<ArrayHandle<Scalar4>>(m_pdata->getPositions(),
+                                                        access_location::host,
+                                                        access_mode::read);
     ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
     // force arrays
@@ -623,12 +835,20 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
     memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
 
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    const unsigned int N = m_pdata->getN();
+
+    // each item writes the component energies of its own particles
+    if constexpr (n_energy_components > 0)
+        m_component_energy.resize(size_t(N) * n_energy_components);
+
+    // Compute the force, energy, and virial on particle i and accumulate the results in the given
+    // arrays. When third_law is set, the reaction on neighbor j is also accumulated. The output
+    // arrays are either the Scalar force arrays or AccumReal accumulation buffers.
+    auto compute_particle = [&](unsigned int i, auto* force, auto* virial, size_t virial_pitch)
         {
         // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        Scalar3 pi = make_scalar3(h_pos->data[i].x, h_pos->data[i].y, h_pos->data[i].z);
+        unsigned int typei = __scalar_as_int(h_pos->data[i].w);
 
         // sanity check
         assert(typei < m_pdata->getNTypes());
@@ -639,14 +859,18 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
             qi = h_charge.data[i];
 
         // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar virialxxi = 0.0;
-        Scalar virialxyi = 0.0;
-        Scalar virialxzi = 0.0;
-        Scalar virialyyi = 0.0;
-        Scalar virialyzi = 0.0;
-        Scalar virialzzi = 0.0;
+        AccumReal fxi = 0.0;
+        AccumReal fyi = 0.0;
+        AccumReal fzi = 0.0;
+        AccumReal pei = 0.0;
+        AccumReal virialxxi = 0.0;
+        AccumReal virialxyi = 0.0;
+        AccumReal virialxzi = 0.0;
+        AccumReal virialyyi = 0.0;
+        AccumReal virialyzi = 0.0;
+        AccumReal virialzzi = 0.0;
+        std::array<AccumReal, n_energy_components> component_eng_i {};
+        std::array<Scalar, n_energy_components> pair_component_eng;
 
         // loop over all of the neighbors of this particle
         const size_t myHead = h_head_list.data[i];
@@ -655,14 +879,14 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
             {
             // access the index of this neighbor (MEM TRANSFER: 1 scalar)
             unsigned int j = h_nlist.data[myHead + k];
-            assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+            assert(j < N + m_pdata->getNGhosts());
 
             // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            Scalar3 pj = make_scalar3(h_pos->data[j].x, h_pos->data[j].y, h_pos->data[j].z);
             Scalar3 dx = pi - pj;
 
             // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+            unsigned int typej = __scalar_as_int(h_pos->data[j].w);
             assert(typej < m_pdata->getNTypes());
 
             // access charge (if needed)
@@ -676,70 +900,35 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
             // calculate r_ij squared (FLOPS: 5)
             Scalar rsq = dot(dx, dx);
 
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const param_type& param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
-                {
-                if (ronsq > rcutsq)
-                    energy_shift = true;
-                }
-
             // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-            if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
-
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+            Scalar force_divr;
+            Scalar pair_eng;
+            bool evaluated = evaluatePair(rsq,
+                                          m_typpair_idx(typei, typej),
+                                          qi,
+                                          qj,
+                                          h_rcutsq.data,
+                                          h_ronsq.data,
+                                          force_divr,
+                                          pair_eng,
+                                          pair_component_eng.data());
 
             if (evaluated)
                 {
-                // modify the potential for xplor shifting
-                if (m_shift_mode == xplor)
+                if constexpr (n_energy_components > 0)
                     {
-                    if (rsq >= ronsq && rsq < rcutsq)
-                        {
-                        // Implement XPLOR smoothing (FLOPS: 16)
-                        Scalar old_pair_eng = pair_eng;
-                        Scalar old_force_divr = force_divr;
-
-                        // calculate 1.0 / (xplor denominator)
-                        Scalar xplor_denom_inv
-                            = Scalar(1.0)
-                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
-
-                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
-                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
-                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
-                                   * xplor_denom_inv;
-                        Scalar ds_dr_divr
-                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
-
-                        // make modifications to the old pair energy and force
-                        pair_eng = old_pair_eng * s;
-                        // note: I'm not sure why the minus sign needs to be there: my notes have a
-                        // + But this is verified correct via plotting
-                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
-                        }
+                    // the share of a local j in a half list is tallied on i
+                    Scalar weight = (third_law && j < N) ? Scalar(1.0) : Scalar(0.5);
+                    for (unsigned int c = 0; c < n_energy_components; c++)
+                        component_eng_i[c] += weight * pair_component_eng[c];
                     }
 
                 Scalar force_div2r = force_divr * Scalar(0.5);
                 // add the force, potential energy and virial to the particle i
                 // (FLOPS: 8)
-                fi += dx * force_divr;
+                fxi += dx.x * force_divr;
+                fyi += dx.y * force_divr;
+                fzi += dx.z * force_divr;
                 pei += pair_eng * Scalar(0.5);
                 if (compute_virial)
                     {
@@ -753,21 +942,21 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10
                 // scalars / FLOPS: 8) only add force to local particles
-                if (third_law && j < m_pdata->getN())
+                if (third_law && j < N)
                     {
                     unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
+                    force[mem_idx].x -= dx.x * force_divr;
+                    force[mem_idx].y -= dx.y * force_divr;
+                    force[mem_idx].z -= dx.z * force_divr;
+                    force[mem_idx].w += pair_eng * Scalar(0.5);
                     if (compute_virial)
                         {
-                        h_virial.data[0 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
-                        h_virial.data[1 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
-                        h_virial.data[2 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
-                        h_virial.data[3 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
-                        h_virial.data[4 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
-                        h_virial.data[5 * m_virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                        virial[0 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
+                        virial[1 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
+                        virial[2 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
+                        virial[3 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
+                        virial[4 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
+                        virial[5 * virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
                         }
                     }
                 }
@@ -775,19 +964,400 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
         // finally, increment the force, potential energy and virial for particle i
         unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
+        force[mem_idx].x += fxi;
+        force[mem_idx].y += fyi;
+        force[mem_idx].z += fzi;
+        force[mem_idx].w += pei;
         if (compute_virial)
             {
-            h_virial.data[0 * m_virial_pitch + mem_idx] += virialxxi;
-            h_virial.data[1 * m_virial_pitch + mem_idx] += virialxyi;
-            h_virial.data[2 * m_virial_pitch + mem_idx] += virialxzi;
-            h_virial.data[3 * m_virial_pitch + mem_idx] += virialyyi;
-            h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
-            h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
+            virial[0 * virial_pitch + mem_idx] += virialxxi;
+            virial[1 * virial_pitch + mem_idx] += virialxyi;
+            virial[2 * virial_pitch + mem_idx] += virialxzi;
+            virial[3 * virial_pitch + mem_idx] += virialyyi;
+            virial[4 * virial_pitch + mem_idx] += virialyzi;
+            virial[5 * virial_pitch + mem_idx] += virialzzi;
+            }
+        if constexpr (n_energy_components > 0)
+            {
+            for (unsigned int c = 0; c < n_energy_components; c++)
+                m_component_energy[size_t(i) * n_energy_components + c] = component_eng_i[c];
+            }
+        };
+
+    // Compute the forces on the particles of i-cluster cluster_i using the cluster pair list. Each
+    // particle of a j-cluster is loaded once and interacts with all particles in the i-cluster
+    // selected by the interaction mask.
+    auto compute_cluster
+        = [&](unsigned int cluster_i, auto* force, auto* virial, size_t virial_pitch)
+        {
+        constexpr unsigned int cluster_size = NeighborList::cluster_size;
+
+        Scalar3 pos_i[cluster_size];
+        unsigned int type_i[cluster_size];
+        Scalar q_i[cluster_size];
+        AccumReal f_i[3][cluster_size];
+        AccumReal pe_i[cluster_size];
+        AccumReal virial_i[6][cluster_size];
+        std::array<std::array<AccumReal, n_energy_components>, cluster_size> component_eng_i {};
+        std::array<Scalar, n_energy_components> pair_component_eng;
+
+        for (unsigned int a = 0; a < cluster_size; a++)
+            {
+            unsigned int i = cluster_i * cluster_size + a;
+            pos_i[a] = make_scalar3(0, 0, 0);
+            type_i[a] = 0;
+            q_i[a] = Scalar(0.0);
+            if (i < N)
+                {
+                pos_i[a] = make_scalar3(h_pos->data[i].x, h_pos->data[i].y, h_pos->data[i].z);
+                type_i[a] = __scalar_as_int(h_pos->data[i].w);
+                if (evaluator::needsCharge())
+                    q_i[a] = h_charge.data[i];
+                }
+            f_i[0][a] = f_i[1][a] = f_i[2][a] = AccumReal(0.0);
+            pe_i[a] = AccumReal(0.0);
+            for (unsigned int v = 0; v < 6; v++)
+                virial_i[v][a] = AccumReal(0.0);
+            }
+
+        const size_t head = h_cluster_head_list.data[cluster_i];
+        const unsigned int n_pairs = h_cluster_n_pairs.data[cluster_i];
+        for (unsigned int k = 0; k < n_pairs; k++)
+            {
+            const uint2 cluster_pair = h_cluster_pair_list.data[head + k];
+            for (unsigned int b = 0; b < cluster_size; b++)
+                {
+                // select the particles of the i-cluster that interact with particle b
+                unsigned int column = 0;
+                for (unsigned int a = 0; a < cluster_size; a++)
+                    column |= ((cluster_pair.y >> (a * cluster_size + b)) & 1) << a;
+                if (!column)
+                    continue;
+
+                unsigned int j = cluster_pair.x * cluster_size + b;
+                assert(j < N + m_pdata->getNGhosts());
+                Scalar3 pj = make_scalar3(h_pos->data[j].x, h_pos->data[j].y, h_pos->data[j].z);
+                unsigned int typej = __scalar_as_int(h_pos->data[j].w);
+                Scalar qj = Scalar(0.0);
+                if (evaluator::needsCharge())
+                    qj = h_charge.data[j];
+
+                AccumReal f_j[3] = {0, 0, 0};
+                AccumReal pe_j = AccumReal(0.0);
+                AccumReal virial_j[6] = {0, 0, 0, 0, 0, 0};
+
+                for (unsigned int a = 0; a < cluster_size; a++)
+                    {
+                    if (!(column & (1u << a)))
+                        continue;
+
+                    Scalar3 dx = box.minImage(pos_i[a] - pj);
+                    Scalar force_divr;
+                    Scalar pair_eng;
+                    if (!evaluatePair(dot(dx, dx),
+                                      m_typpair_idx(type_i[a], typej),
+                                      q_i[a],
+                                      qj,
+                                      h_rcutsq.data,
+                                      h_ronsq.data,
+                                      force_divr,
+                                      pair_eng,
+                                      pair_component_eng.data()))
+                        continue;
+
+                    if constexpr (n_energy_components > 0)
+                        {
+                        // the share of a local j in a half list is tallied on i
+                        Scalar weight = (third_law && j < N) ? Scalar(1.0) : Scalar(0.5);
+                        for (unsigned int c = 0; c < n_energy_components; c++)
+                            component_eng_i[a][c] += weight * pair_component_eng[c];
+                        }
+
+                    f_i[0][a] += dx.x * force_divr;
+                    f_i[1][a] += dx.y * force_divr;
+                    f_i[2][a] += dx.z * force_divr;
+                    pe_i[a] += pair_eng * Scalar(0.5);
+                    f_j[0] -= dx.x * force_divr;
+                    f_j[1] -= dx.y * force_divr;
+                    f_j[2] -= dx.z * force_divr;
+                    pe_j += pair_eng * Scalar(0.5);
+                    if (compute_virial)
+                        {
+                        Scalar force_div2r = force_divr * Scalar(0.5);
+                        Scalar pair_virial[6] = {force_div2r * dx.x * dx.x,
+                                                 force_div2r * dx.x * dx.y,
+                                                 force_div2r * dx.x * dx.z,
+                                                 force_div2r * dx.y * dx.y,
+                                                 force_div2r * dx.y * dx.z,
+                                                 force_div2r * dx.z * dx.z};
+                        for (unsigned int v = 0; v < 6; v++)
+                            {
+                            virial_i[v][a] += pair_virial[v];
+                            virial_j[v] += pair_virial[v];
+                            }
+                        }
+                    }
+
+                // only add the reaction to local particles
+                if (third_law && j < N)
+                    {
+                    force[j].x += f_j[0];
+                    force[j].y += f_j[1];
+                    force[j].z += f_j[2];
+                    force[j].w += pe_j;
+                    if (compute_virial)
+                        {
+                        for (unsigned int v = 0; v < 6; v++)
+                            virial[v * virial_pitch + j] += virial_j[v];
+                        }
+                    }
+                }
+            }
+
+        // finally, increment the force, potential energy and virial for the i-cluster
+        for (unsigned int a = 0; a < cluster_size; a++)
+            {
+            unsigned int i = cluster_i * cluster_size + a;
+            if (i >= N)
+                break;
+
+            force[i].x += f_i[0][a];
+            force[i].y += f_i[1][a];
+            force[i].z += f_i[2][a];
+            force[i].w += pe_i[a];
+            if (compute_virial)
+                {
+                for (unsigned int v = 0; v < 6; v++)
+                    virial[v * virial_pitch + i] += virial_i[v][a];
+                }
+            if constexpr (n_energy_components > 0)
+                {
+                for (unsigned int c = 0; c < n_energy_components; c++)
+                    m_component_energy[size_t(i) * n_energy_components + c] = component_eng_i[a][c];
+                }
             }
+        };
+
+    // work items are either particles or i-clusters
+    const unsigned int n_items
+        = use_clusters ? (N + NeighborList::cluster_size - 1) / NeighborList::cluster_size : N;
+    auto compute_item = [&](unsigned int item, auto* force, auto* virial, size_t virial_pitch)
+        {
+        if (use_clusters)
+            compute_cluster(item, force, virial, virial_pitch);
+        else
+            compute_particle(item, force, virial, virial_pitch);
+        };
+
+    // While a ghost update is in flight, first process the items that interact only with local
+    // particles. Then complete the update and process the items that interact with ghosts.
+    unsigned int n_first_items = n_items;
+    const unsigned int* item_order = nullptr;
+#ifdef ENABLE_MPI
+    const bool overlap_ghost_update = m_comm && m_comm->isGhostUpdatePending();
+    if (overlap_ghost_update)
+        {
+        if (m_item_order.size() != n_items || m_nlist->hasBeenUpdated(timestep)
+            || m_item_order_nlist_updates != m_nlist->getNumUpdates())
+            {
+            auto interacts_with_ghosts = [&](unsigned int item)
+                {
+                if (use_clusters)
+                    {
+                    const size_t head = h_cluster_head_list.data[item];
+                    for (unsigned int k = 0; k < h_cluster_n_pairs.data[item]; k++)
+                        {
+                        if ((h_cluster_pair_list.data[head + k].x + 1) * NeighborList::cluster_size
+                            > N)
+                            return true;
+                        }
+                    }
+                else
+                    {
+                    const size_t head = h_head_list.data[item];
+                    for (unsigned int k = 0; k < h_n_neigh.data[item]; k++)
+                        {
+                        if (h_nlist.data[head + k] >= N)
+                            return true;
+                        }
+                    }
+                return false;
+                };
+
+            m_item_order.clear();
+            for (unsigned int item = 0; item < n_items; item++)
+                {
+                if (!interacts_with_ghosts(item))
+                    m_item_order.push_back(item);
+                }
+            m_n_interior_items = (unsigned int)m_item_order.size();
+            for (unsigned int item = 0; item < n_items; item++)
+                {
+                if (interacts_with_ghosts(item))
+                    m_item_order.push_back(item);
+                }
+            m_item_order_nlist_updates = m_nlist->getNumUpdates();
+            }
+
+        n_first_items = m_n_interior_items;
+        item_order = m_item_order.data();
+        }
+#endif
+
+    // process the entries [begin, end) of the item order
+    auto compute_items = [&](unsigned int begin,
+                             unsigned int end,
+                             auto* force,
+                             auto* virial,
+                             size_t virial_pitch)
+        {
+        for (unsigned int k = begin; k != end; ++k)
+            compute_item(item_order ? item_order[k] : k, force, virial, virial_pitch);
+        };
+
+    // call process_range(begin, end) on the items before and after the ghost update completes
+    auto for_item_ranges = [&](const auto& process_range)
+        {
+        process_range(0, n_first_items);
+#ifdef ENABLE_MPI
+        if (overlap_ghost_update)
+            {
+            h_pos.reset();
+            m_comm->finishUpdateGhosts(timestep);
+            h_pos = std::make_unique<ArrayHandle<Scalar4>>(m_pdata->getPositions(),
+                                                           access_location::host,
+                                                           access_mode::read);
+            }
+#endif
+        process_range(n_first_items, n_items);
+        };
+
+#if defined(ENABLE_TBB) || HOOMD_ACCUMREAL_SIZE != HOOMD_LONGREAL_SIZE
+    // Store the accumulated force and virial on particles [begin, end). The per-thread partial
+    // sums are added in AccumReal precision before they are rounded to Scalar.
+    auto store_accumulated = [&](const auto& thread_force,
+                                 const auto& thread_virial,
+                                 unsigned int begin,
+                                 unsigned int end)
+        {
+        for (unsigned int i = begin; i != end; ++i)
+            {
+            AccumReal4 f = {0, 0, 0, 0};
+            for (const auto& force : thread_force)
+                {
+                f.x += force[i].x;
+                f.y += force[i].y;
+                f.z += force[i].z;
+                f.w += force[i].w;
+                }
+            h_force.data[i] = make_scalar4(Scalar(f.x), Scalar(f.y), Scalar(f.z), Scalar(f.w));
+            }
+
+        if (compute_virial)
+            {
+            for (unsigned int k = 0; k < 6; k++)
+                for (unsigned int i = begin; i != end; ++i)
+                    {
+                    AccumReal v = 0.0;
+                    for (const auto& virial : thread_virial)
+                        v += virial[k * size_t(N) + i];
+                    h_virial.data[k * m_virial_pitch + i] = Scalar(v);
+                    }
+            }
+        };
+#endif
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                if (third_law)
+                    {
+                    // Newton's third law writes to neighbor j, which may be processed by any
+                    // thread. Accumulate into thread-local arrays and reduce them afterwards.
+                    hoomd::detail::ThreadBuffers<AccumReal4> thread_force(
+                        m_exec_conf,
+                        N,
+                        AccumReal4 {0, 0, 0, 0});
+                    hoomd::detail::ThreadBuffers<AccumReal> thread_virial(
+                        m_exec_conf,
+                        compute_virial ? 6 * size_t(N) : 0,
+                        AccumReal(0.0));
+
+                    for_item_ranges(
+                        [&](unsigned int begin, unsigned int end)
+                        {
+                            thread_force.parallel_for(
+                                begin,
+                                end,
+                                [&](unsigned int r_begin, unsigned int r_end, unsigned int k)
+                                {
+                                    compute_items(r_begin,
+                                                  r_end,
+                                                  thread_force[k].data(),
+                                                  thread_virial[k].data(),
+                                                  N);
+                                });
+                        });
+
+                    // sum the per-thread contributions
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          store_accumulated(thread_force,
+                                                            thread_virial,
+                                                            r.begin(),
+                                                            r.end());
+                                      });
+                    }
+                else
+                    {
+                    // with a full neighbor list, each thread only writes to its own particles
+                    for_item_ranges(
+                        [&](unsigned int begin, unsigned int end)
+                        {
+                            tbb::parallel_for(
+                                tbb::blocked_range<unsigned int>(begin, end),
+                                [&](const tbb::blocked_range<unsigned int>& r)
+                                {
+                                    compute_items(r.begin(),
+                                                  r.end(),
+                                                  h_force.data,
+                                                  h_virial.data,
+                                                  m_virial_pitch);
+                                });
+                        });
+                    }
+            });
+        }
+    else
+#endif
+#if HOOMD_ACCUMREAL_SIZE != HOOMD_LONGREAL_SIZE
+        if (third_law)
+        {
+        // the reactions on neighbor j are summed over many particles, accumulate them in AccumReal
+        // precision before storing the result
+        std::vector<std::vector<AccumReal4>> force(
+            1,
+            std::vector<AccumReal4>(N, AccumReal4 {0, 0, 0, 0}));
+        std::vector<std::vector<AccumReal>> virial(
+            1,
+            std::vector<AccumReal>(compute_virial ? 6 * size_t(N) : 0, AccumReal(0.0)));
+
+        for_item_ranges([&](unsigned int begin, unsigned int end)
+                        { compute_items(begin, end, force[0].data(), virial[0].data(), N); });
+
+        store_accumulated(force, virial, 0, N);
+        }
+    else
+#endif
+        {
+        // for each particle or cluster
+        for_item_ranges(
+            [&](unsigned int begin, unsigned int end)
+            { compute_items(begin, end, h_force.data, h_virial.data, m_virial_pitch); });
         }
 
     computeTailCorrection();
@@ -990,6 +1560,195 @@ inline void PotentialPair<evaluator>::computeEnergyBetweenSets(InputIterator fir
 #endif
     }
 
+/*! \param timestep Current time step
+    \returns The total pair energy on all ranks, including the tail correction
+
+    Evaluates the same pairs as computeForces(), but sums only the pair energies. The force and
+    virial arrays are left unchanged. A pair stored in a half neighbor list contributes its full
+    energy, unless the neighbor is a ghost. The rank that owns the ghost adds the other half.
+*/
+template<class evaluator> Scalar PotentialPair<evaluator>::computeEnergy(uint64_t timestep)
+    {
+    ScopedOperationTimer timer(m_timer, typeid(*this));
+    m_nlist->compute(timestep);
+
+    const bool third_law = m_nlist->getStorageMode() == NeighborList::half;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int N = m_pdata->getN();
+
+    // sum the pair energies of particles [begin, end)
+    auto sum_energy = [&](unsigned int begin, unsigned int end)
+        {
+        AccumReal energy = AccumReal(0.0);
+        for (unsigned int i = begin; i < end; i++)
+            {
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            Scalar qi = Scalar(0.0);
+            if (evaluator::needsCharge())
+                qi = h_charge.data[i];
+
+            const size_t head = h_head_list.data[i];
+            const unsigned int n_neigh = h_n_neigh.data[i];
+            for (unsigned int k = 0; k < n_neigh; k++)
+                {
+                unsigned int j = h_nlist.data[head + k];
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                Scalar qj = Scalar(0.0);
+                if (evaluator::needsCharge())
+                    qj = h_charge.data[j];
+
+                Scalar3 dx = box.minImage(pi - pj);
+                Scalar force_divr;
+                Scalar pair_eng;
+                evaluatePair(dot(dx, dx),
+                             m_typpair_idx(typei, typej),
+                             qi,
+                             qj,
+                             h_rcutsq.data,
+                             h_ronsq.data,
+                             force_divr,
+                             pair_eng);
+
+                energy += (third_law && j < N) ? pair_eng : pair_eng * Scalar(0.5);
+                }
+            }
+        return energy;
+        };
+
+    double energy = 0.0;
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&] { energy = hoomd::detail::parallel_sum(m_exec_conf, 0, N, sum_energy); });
+        }
+    else
+#endif
+        {
+        energy = sum_energy(0, N);
+        }
+
+    // the tail correction is added on the root rank only
+    computeTailCorrection();
+    energy += m_external_energy;
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &energy,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return Scalar(energy);
+    }
+
+/*! \param idx Local index of the particle
+    \returns The sum of the pair energies of particle idx with all of its neighbors
+
+    The energy uses the types in the particle data at the time of the call, so Monte Carlo moves
+    that change types may evaluate the energy before and after the change. The neighbor list must
+    be full and include all pairs within the cutoff of the current types.
+*/
+template<class evaluator> Scalar PotentialPair<evaluator>::computeParticleEnergy(unsigned int idx)
+    {
+    if (m_nlist->getStorageMode() != NeighborList::full)
+        {
+        throw std::runtime_error("Particle energies require a full neighbor list.");
+        }
+    assert(idx < m_pdata->getN());
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    Scalar3 pi = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
+    unsigned int typei = __scalar_as_int(h_pos.data[idx].w);
+    Scalar qi = Scalar(0.0);
+    if (evaluator::needsCharge())
+        qi = h_charge.data[idx];
+
+    AccumReal energy = AccumReal(0.0);
+    const size_t head = h_head_list.data[idx];
+    const unsigned int n_neigh = h_n_neigh.data[idx];
+    for (unsigned int k = 0; k < n_neigh; k++)
+        {
+        unsigned int j = h_nlist.data[head + k];
+        Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+        unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+        Scalar qj = Scalar(0.0);
+        if (evaluator::needsCharge())
+            qj = h_charge.data[j];
+
+        Scalar3 dx = box.minImage(pi - pj);
+        Scalar force_divr;
+        Scalar pair_eng;
+        evaluatePair(dot(dx, dx),
+                     m_typpair_idx(typei, typej),
+                     qi,
+                     qj,
+                     h_rcutsq.data,
+                     h_ronsq.data,
+                     force_divr,
+                     pair_eng);
+        energy += pair_eng;
+        }
+
+    return Scalar(energy);
+    }
+
+/*! \param idx Local indices of the particles
+    \param n Number of particles
+    \param energy Energy of each particle, added to
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::addParticleEnergies(const GlobalArray<unsigned int>& idx,
+                                                   unsigned int n,
+                                                   GlobalArray<Scalar>& energy)
+    {
+    ArrayHandle<unsigned int> h_idx(idx, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_energy(energy, access_location::host, access_mode::readwrite);
+
+    const unsigned int N = m_pdata->getN();
+    for (unsigned int k = 0; k < n; k++)
+        {
+        if (h_idx.data[k] < N)
+            h_energy.data[k] += computeParticleEnergy(h_idx.data[k]);
+        }
+    }
+
 //! Calculates the energy between two lists of particles.
 template<class evaluator>
 Scalar PotentialPair<evaluator>::computeEnergyBetweenSetsPythonList(
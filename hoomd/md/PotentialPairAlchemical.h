@@ -90,6 +90,26 @@ class PotentialPairAlchemical : public PotentialPair<evaluator>
             = false;
         }
 
+#ifdef ENABLE_MPI
+    //! computeForces() does not split the particles, compute the forces after the ghost update
+    virtual bool overlapsGhostUpdate()
+        {
+        return false;
+        }
+#endif
+
+    //! The energy depends on the alchemical parameters, compute it together with the forces
+    virtual Scalar computeEnergy(uint64_t timestep)
+        {
+        return ForceCompute::computeEnergy(timestep);
+        }
+
+    //! Single particle energies do not include the alchemical parameters
+    virtual Scalar computeParticleEnergy(unsigned int idx)
+        {
+        throw std::runtime_error("Alchemical pair potentials do not support particle energies.");
+        }
+
     protected:
     typedef std::bitset<evaluator::num_alchemical_parameters> mask_type;
     typedef std::array<Scalar, evaluator::num_alchemical_parameters> alpha_array_t;
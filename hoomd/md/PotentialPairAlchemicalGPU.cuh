@@ -0,0 +1,200 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#include <assert.h>
+
+/*! \file PotentialPairAlchemicalGPU.cuh
+    \brief Defines templated GPU kernel code for calculating alchemical derivatives of pair
+    potentials.
+*/
+
+#ifndef __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
+#define __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Wraps arguments to gpu_compute_alchemical_derivatives
+struct alchemical_derivative_args_t
+    {
+    //! Construct an alchemical_derivative_args_t
+    alchemical_derivative_args_t(Scalar* _d_derivatives,
+                                 const unsigned int _N,
+                                 const Scalar4* _d_pos,
+                                 const BoxDim& _box,
+                                 const unsigned int* _d_n_neigh,
+                                 const unsigned int* _d_nlist,
+                                 const size_t* _d_head_list,
+                                 const Scalar* _d_rcutsq,
+                                 const Scalar* _d_alphas,
+                                 const unsigned int _ntypes,
+                                 const unsigned int _alchemy_index,
+                                 const unsigned int _param_index,
+                                 const unsigned int _block_size)
+        : d_derivatives(_d_derivatives), N(_N), d_pos(_d_pos), box(_box), d_n_neigh(_d_n_neigh),
+          d_nlist(_d_nlist), d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_alphas(_d_alphas),
+          ntypes(_ntypes), alchemy_index(_alchemy_index), param_index(_param_index),
+          block_size(_block_size) { };
+
+    Scalar* d_derivatives;            //!< Per particle derivatives of one alchemical particle
+    const unsigned int N;             //!< Number of particles
+    const Scalar4* d_pos;             //!< particle positions
+    const BoxDim box;                 //!< Simulation box in GPU format
+    const unsigned int* d_n_neigh;    //!< Number of neighbors of each particle
+    const unsigned int* d_nlist;      //!< Neighbor list
+    const size_t* d_head_list;        //!< Head list indexes for accessing d_nlist
+    const Scalar* d_rcutsq;           //!< r_cut squared per particle type pair
+    const Scalar* d_alphas;           //!< num_alchemical_parameters alphas of the type pair
+    const unsigned int ntypes;        //!< Number of particle types in the simulation
+    const unsigned int alchemy_index; //!< Upper triangular index of the alchemical type pair
+    const unsigned int param_index;   //!< Index of the alchemical parameter
+    const unsigned int block_size;    //!< Block size to execute
+    };
+
+#ifdef __HIPCC__
+
+//! Kernel for calculating the alchemical derivatives of one alchemical particle
+/*! Each thread sums -1/2 dU/d alpha over the neighbors of one particle that form the alchemical
+    type pair. With a full neighbor list, every pair contributes half of its derivative to each of
+    its two particles, which matches the CPU implementation with a half neighbor list. The kernel
+    overwrites all N entries of \a d_derivatives, so they need not be zeroed first.
+
+    The derivatives are evaluated with the parameters before the alchemical scaling, as in
+    PotentialPairAlchemical.
+
+    \tparam evaluator EvaluatorPair class that implements evalAlchemyDerivatives()
+*/
+template<class evaluator>
+__global__ void
+gpu_compute_alchemical_derivatives_kernel(Scalar* d_derivatives,
+                                          const unsigned int N,
+                                          const Scalar4* d_pos,
+                                          const BoxDim box,
+                                          const unsigned int* d_n_neigh,
+                                          const unsigned int* d_nlist,
+                                          const size_t* d_head_list,
+                                          const typename evaluator::param_type* d_params,
+                                          const Scalar* d_rcutsq,
+                                          const Scalar* d_alphas,
+                                          const unsigned int ntypes,
+                                          const unsigned int alchemy_index,
+                                          const unsigned int param_index)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    Index2D typpair_idx(ntypes);
+    Index2DUpperTriangular alchemy_idx(ntypes);
+
+    Scalar alphas[evaluator::num_alchemical_parameters];
+    for (unsigned int k = 0; k < evaluator::num_alchemical_parameters; k++)
+        alphas[k] = d_alphas[k];
+    Scalar alchemical_derivatives[evaluator::num_alchemical_parameters];
+
+    Scalar4 postypei = __ldg(d_pos + idx);
+    Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+    unsigned int typei = __scalar_as_int(postypei.w);
+
+    Scalar derivative = Scalar(0.0);
+
+    const size_t my_head = d_head_list[idx];
+    const unsigned int n_neigh = d_n_neigh[idx];
+    for (unsigned int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
+        {
+        unsigned int j = __ldg(d_nlist + my_head + neigh_idx);
+        Scalar4 postypej = __ldg(d_pos + j);
+        unsigned int typej = __scalar_as_int(postypej.w);
+
+        if (alchemy_idx(typei, typej) != alchemy_index)
+            continue;
+
+        Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+        Scalar3 dx = box.minImage(posi - posj);
+        Scalar rsq = dot(dx, dx);
+
+        unsigned int cur_typpair = typpair_idx(typei, typej);
+        Scalar rcutsq = d_rcutsq[cur_typpair];
+
+        if (rsq < rcutsq)
+            {
+            evaluator eval(rsq, rcutsq, d_params[cur_typpair]);
+            eval.evalAlchemyDerivatives(alchemical_derivatives, alphas);
+            derivative -= alchemical_derivatives[param_index] * Scalar(0.5);
+            }
+        }
+
+    d_derivatives[idx] = derivative;
+    }
+
+//! Driver function for the alchemical derivative kernel
+/*! \param args Other arguments to pass onto the kernel
+    \param d_params Parameters for the potential before the alchemical scaling, stored per type
+    pair
+
+    This is just a driver function for gpu_compute_alchemical_derivatives_kernel(), see it for
+    details.
+*/
+template<class evaluator>
+hipError_t gpu_compute_alchemical_derivatives(const alchemical_derivative_args_t& args,
+                                              const typename evaluator::param_type* d_params)
+    {
+    assert(d_params);
+    assert(args.d_rcutsq);
+    assert(args.d_alphas);
+    assert(args.ntypes > 0);
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(
+        &attr,
+        reinterpret_cast<const void*>(&gpu_compute_alchemical_derivatives_kernel<evaluator>));
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size
+        = args.block_size < max_block_size ? args.block_size : max_block_size;
+    dim3 grid(args.N / run_block_size + 1, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_alchemical_derivatives_kernel<evaluator>),
+                       dim3(grid),
+                       dim3(run_block_size),
+                       0,
+                       0,
+                       args.d_derivatives,
+                       args.N,
+                       args.d_pos,
+                       args.box,
+                       args.d_n_neigh,
+                       args.d_nlist,
+                       args.d_head_list,
+                       d_params,
+                       args.d_rcutsq,
+                       args.d_alphas,
+                       args.ntypes,
+                       args.alchemy_index,
+                       args.param_index);
+
+    return hipSuccess;
+    }
+#else
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_alchemical_derivatives(const alchemical_derivative_args_t& args,
+                                   const typename evaluator::param_type* d_params);
+#endif
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __POTENTIAL_PAIR_ALCHEMICAL_GPU_CUH__
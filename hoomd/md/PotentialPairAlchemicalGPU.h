@@ -0,0 +1,349 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#ifdef ENABLE_HIP
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "PotentialPairAlchemical.h"
+#include "PotentialPairAlchemicalGPU.cuh"
+#include "PotentialPairGPU.cuh"
+
+#include "hoomd/Autotuner.h"
+
+/*! \file PotentialPairAlchemicalGPU.h
+    \brief Defines the template class for alchemical pair potentials on the GPU
+    \note This header cannot be compiled by nvcc
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Template class for computing alchemical pair potentials on the GPU
+/*! Derived from PotentialPairAlchemical, this class provides the same interface and evaluates the
+    forces with the kernel of PotentialPairGPU.
+
+    The alphas are uniform for each type pair, so the class applies them to a copy of the parameters
+    once and passes the scaled copy to gpu_compute_pair_forces(). It rebuilds the copy only when
+    the alphas or the parameters change, which the alchemostat does only every period steps. On
+    the steps where the alchemostat needs them, gpu_compute_alchemical_derivatives() writes the
+    per particle alchemical derivatives directly to the device arrays of the alchemical
+    particles. Only the final sum over the particles (AlchemicalMDParticle::setNetForce()) reads
+    the derivatives on the host.
+
+    A .cu file must instantiate both gpu_compute_pair_forces() and
+    gpu_compute_alchemical_derivatives() with the evaluator (see
+    PotentialPairAlchemicalGPUKernel.cu.inc).
+
+    \tparam evaluator EvaluatorPair class with alchemical parameters
+*/
+template<class evaluator>
+class PotentialPairAlchemicalGPU : public PotentialPairAlchemical<evaluator>
+    {
+    public:
+    //! Construct the pair potential
+    PotentialPairAlchemicalGPU(std::shared_ptr<SystemDefinition> sysdef,
+                               std::shared_ptr<NeighborList> nlist);
+    //! Destructor
+    virtual ~PotentialPairAlchemicalGPU() { }
+
+    //! Set the pair parameters for a single type pair
+    virtual void setParams(unsigned int typ1,
+                           unsigned int typ2,
+                           const typename evaluator::param_type& param);
+
+    protected:
+    typedef typename evaluator::param_type param_type;
+
+    std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
+    std::shared_ptr<Autotuner<1>> m_tuner_alchemy; //!< Autotuner for the derivative kernel
+
+    //! Parameters scaled by the alphas, indexed like m_params
+    std::vector<param_type, hoomd::detail::managed_allocator<param_type>> m_alchemical_params;
+
+    GlobalArray<Scalar> m_alphas;      //!< Alphas per alchemy type pair and parameter
+    std::vector<Scalar> m_last_alphas; //!< Alphas applied to m_alchemical_params
+    bool m_params_changed = true;      //!< True when m_alchemical_params must be rebuilt
+
+    //! Apply the given alphas to m_alchemical_params and m_alphas
+    void updateAlchemicalParams(const std::vector<Scalar>& alphas);
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+template<class evaluator>
+PotentialPairAlchemicalGPU<evaluator>::PotentialPairAlchemicalGPU(
+    std::shared_ptr<SystemDefinition> sysdef,
+    std::shared_ptr<NeighborList> nlist)
+    : PotentialPairAlchemical<evaluator>(sysdef, nlist)
+    {
+    // can't run on the GPU if there aren't any GPUs in the execution configuration
+    if (!this->m_exec_conf->isCUDAEnabled())
+        {
+        this->m_exec_conf->msg->error()
+            << "Creating a PotentialPairAlchemicalGPU with no GPU in the execution configuration"
+            << std::endl;
+        throw std::runtime_error("Error initializing PotentialPairAlchemicalGPU");
+        }
+
+    m_alchemical_params = std::vector<param_type, hoomd::detail::managed_allocator<param_type>>(
+        this->m_typpair_idx.getNumElements(),
+        param_type(),
+        hoomd::detail::managed_allocator<param_type>(this->m_exec_conf->isCUDAEnabled()));
+
+    GlobalArray<Scalar> alphas(this->m_alchemy_index.getNumElements()
+                                   * evaluator::num_alchemical_parameters,
+                               this->m_exec_conf);
+    m_alphas.swap(alphas);
+
+    // Initialize autotuners.
+    m_tuner.reset(new Autotuner<2>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf),
+                                    AutotunerBase::getTppListPow2(this->m_exec_conf)},
+                                   this->m_exec_conf,
+                                   "pair_alchemical_" + evaluator::getName()));
+    m_tuner_alchemy.reset(
+        new Autotuner<1>({AutotunerBase::makeBlockSizeRange(this->m_exec_conf)},
+                         this->m_exec_conf,
+                         "pair_alchemical_derivatives_" + evaluator::getName()));
+
+    this->m_autotuners.push_back(m_tuner);
+    this->m_autotuners.push_back(m_tuner_alchemy);
+    }
+
+/*! \param typ1 First type index in the pair
+    \param typ2 Second type index in the pair
+    \param param Parameter to set
+*/
+template<class evaluator>
+void PotentialPairAlchemicalGPU<evaluator>::setParams(unsigned int typ1,
+                                                      unsigned int typ2,
+                                                      const param_type& param)
+    {
+    PotentialPairAlchemical<evaluator>::setParams(typ1, typ2, param);
+    m_params_changed = true;
+    }
+
+/*! \param alphas Alphas per alchemy type pair and parameter, indexed by
+    alchemy_index * num_alchemical_parameters + parameter_index
+*/
+template<class evaluator>
+void PotentialPairAlchemicalGPU<evaluator>::updateAlchemicalParams(
+    const std::vector<Scalar>& alphas)
+    {
+    const unsigned int n_params = evaluator::num_alchemical_parameters;
+
+    ArrayHandle<Scalar> h_alphas(m_alphas, access_location::host, access_mode::overwrite);
+    std::copy(alphas.begin(), alphas.end(), h_alphas.data);
+
+    // a previous kernel may still be reading the scaled parameters
+    hipDeviceSynchronize();
+
+    const unsigned int n_types = this->m_pdata->getNTypes();
+    for (unsigned int typei = 0; typei < n_types; typei++)
+        for (unsigned int typej = 0; typej < n_types; typej++)
+            {
+            std::array<Scalar, evaluator::num_alchemical_parameters> pair_alphas;
+            unsigned int alchemy_index = this->m_alchemy_index(typei, typej);
+            std::copy(alphas.begin() + alchemy_index * n_params,
+                      alphas.begin() + (alchemy_index + 1) * n_params,
+                      pair_alphas.begin());
+
+            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+            m_alchemical_params[typpair_idx]
+                = evaluator::updateAlchemyParams(this->m_params[typpair_idx], pair_alphas);
+            }
+
+    m_last_alphas = alphas;
+    m_params_changed = false;
+    }
+
+template<class evaluator>
+void PotentialPairAlchemicalGPU<evaluator>::computeForces(uint64_t timestep)
+    {
+    this->m_nlist->compute(timestep);
+
+    // The GPU implementation CANNOT handle a half neighborlist, error out now
+    bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
+    if (third_law)
+        {
+        this->m_exec_conf->msg->error()
+            << "PotentialPairAlchemicalGPU cannot handle a half neighborlist" << std::endl;
+        throw std::runtime_error("Error computing forces in PotentialPairAlchemicalGPU");
+        }
+
+    const unsigned int n_alchemy = this->m_alchemy_index.getNumElements();
+    const unsigned int n_params = evaluator::num_alchemical_parameters;
+
+    // Read the alphas and find the alchemical particles that need derivatives this step. Alphas
+    // of parameters without an enabled alchemical particle are 1.
+    std::vector<Scalar> alphas(size_t(n_alchemy) * n_params, Scalar(1.0));
+    std::vector<unsigned int> compute_derivatives;
+    for (unsigned int i = 0; i < n_alchemy; i++)
+        for (unsigned int k = 0; k < n_params; k++)
+            {
+            unsigned int idx = k * n_alchemy + i;
+            if (this->m_alchemy_mask[i][k])
+                {
+                alphas[i * n_params + k] = this->m_alchemical_particles[idx]->value;
+                if (this->m_alchemical_particles[idx]->m_nextTimestep == timestep)
+                    {
+                    compute_derivatives.push_back(idx);
+                    }
+                }
+            }
+
+    if (m_params_changed || alphas != m_last_alphas)
+        {
+        updateAlchemicalParams(alphas);
+        }
+
+    // access the neighbor list
+    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    // access the particle data
+    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                 access_location::device,
+                                 access_mode::read);
+
+    BoxDim box = this->m_pdata->getBox();
+
+    // access parameters
+    ArrayHandle<Scalar> d_ronsq(this->m_ronsq, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::readwrite);
+    ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::readwrite);
+
+    if (!compute_derivatives.empty())
+        {
+        this->m_exec_conf->msg->notice(10)
+            << "AlchemPotentialPairGPU: Calculating alchemical forces" << std::endl;
+
+        ArrayHandle<Scalar> d_alphas(m_alphas, access_location::device, access_mode::read);
+
+        m_tuner_alchemy->begin();
+        for (unsigned int idx : compute_derivatives)
+            {
+            auto& particle = this->m_alchemical_particles[idx];
+            unsigned int alchemy_index = idx % n_alchemy;
+            unsigned int param_index = idx / n_alchemy;
+
+            // the kernel overwrites every element, there is no need to zero the array
+            particle->setNetForceTimestep(timestep);
+            ArrayHandle<Scalar> d_derivatives(particle->m_alchemical_derivatives,
+                                              access_location::device,
+                                              access_mode::overwrite);
+
+            kernel::gpu_compute_alchemical_derivatives<evaluator>(
+                kernel::alchemical_derivative_args_t(d_derivatives.data,
+                                                     this->m_pdata->getN(),
+                                                     d_pos.data,
+                                                     box,
+                                                     d_n_neigh.data,
+                                                     d_nlist.data,
+                                                     d_head_list.data,
+                                                     d_rcutsq.data,
+                                                     d_alphas.data + alchemy_index * n_params,
+                                                     this->m_pdata->getNTypes(),
+                                                     alchemy_index,
+                                                     param_index,
+                                                     m_tuner_alchemy->getParam()[0]),
+                this->m_params.data());
+
+            if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+        m_tuner_alchemy->end();
+        }
+
+    // access flags
+    PDataFlags flags = this->m_pdata->getFlags();
+
+    this->m_exec_conf->beginMultiGPU();
+
+    m_tuner->begin();
+    auto param = m_tuner->getParam();
+    unsigned int block_size = param[0];
+    unsigned int threads_per_particle = param[1];
+
+    kernel::gpu_compute_pair_forces<evaluator>(
+        kernel::pair_args_t(d_force.data,
+                            d_virial.data,
+                            this->m_virial.getPitch(),
+                            this->m_pdata->getN(),
+                            this->m_pdata->getMaxN(),
+                            d_pos.data,
+                            d_charge.data,
+                            box,
+                            d_n_neigh.data,
+                            d_nlist.data,
+                            d_head_list.data,
+                            d_rcutsq.data,
+                            d_ronsq.data,
+                            this->m_nlist->getNListArray().getPitch(),
+                            this->m_pdata->getNTypes(),
+                            block_size,
+                            this->m_shift_mode,
+                            flags[pdata_flag::pressure_tensor],
+                            threads_per_particle,
+                            this->m_pdata->getGPUPartition(),
+                            this->m_exec_conf->dev_prop),
+        m_alchemical_params.data());
+
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+
+    m_tuner->end();
+
+    this->m_exec_conf->endMultiGPU();
+
+    // sum the per particle derivatives into the net alchemical forces
+    for (unsigned int idx : compute_derivatives)
+        {
+        this->m_alchemical_particles[idx]->setNetForce();
+        }
+
+    // energy and pressure corrections
+    this->computeTailCorrection();
+    }
+
+namespace detail
+    {
+//! Export this pair potential to python
+/*! \param name Name of the class in the exported python module
+    \tparam T Evaluator type to export.
+*/
+template<class T>
+void export_PotentialPairAlchemicalGPU(pybind11::module& m, const std::string& name)
+    {
+    pybind11::class_<PotentialPairAlchemicalGPU<T>,
+                     PotentialPairAlchemical<T>,
+                     std::shared_ptr<PotentialPairAlchemicalGPU<T>>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // ENABLE_HIP
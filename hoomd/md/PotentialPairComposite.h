@@ -0,0 +1,221 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#pragma once
+
+#include <memory>
+#include <pybind11/stl.h>
+#include <type_traits>
+#include <vector>
+
+#include "PotentialPair.h"
+
+#ifdef ENABLE_HIP
+#include "PotentialPairGPU.h"
+#endif
+
+/*! \file PotentialPairComposite.h
+    \brief Defines the template class for pair potentials that sum several evaluators
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Template class for computing composite pair potentials
+/*! PotentialPairComposite computes the forces of an EvaluatorPairComposite with the CPU or GPU
+    implementation given by \a Base, which evaluates all components in a single traversal of the
+    neighbor list. In addition, it reports the potential energy of each component separately.
+
+    On the CPU, PotentialPair tallies the component energies of each particle in the same traversal
+    that computes the forces. The GPU kernels are shared by all pair potentials and have no
+    per-component output, so PotentialPairGPU evaluates the components on the host instead. In both
+    cases the total of each component is computed once per force computation and cached. Call
+    compute() for the current timestep before getComponentEnergies().
+
+    \tparam evaluator EvaluatorPairComposite instantiation
+    \tparam Base PotentialPair<evaluator> or PotentialPairGPU<evaluator>
+*/
+template<class evaluator, class Base = PotentialPair<evaluator>>
+class PotentialPairComposite : public Base
+    {
+    public:
+    //! Construct the pair potential
+    PotentialPairComposite(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<NeighborList> nlist)
+        : Base(sysdef, nlist)
+        {
+        }
+
+    //! Destructor
+    virtual ~PotentialPairComposite() { }
+
+    //! Get the total potential energy of each component
+    std::vector<Scalar> getComponentEnergies();
+
+    protected:
+    /// Total energy of each component in the last force computation
+    std::vector<Scalar> m_component_energies;
+
+    /// True when m_component_energies holds the totals of the last force computation
+    bool m_component_energies_valid = false;
+
+    //! Compute the forces and invalidate the cached component energies
+    virtual void computeForces(uint64_t timestep)
+        {
+        Base::computeForces(timestep);
+        m_component_energies_valid = false;
+        }
+
+    //! Sum the component energies over the pairs in the neighbor list on the host
+    void evaluateComponentEnergies(std::vector<double>& energy);
+    };
+
+/*! The sum of the component energies is the total pair energy, excluding the tail correction.
+ */
+template<class evaluator, class Base>
+std::vector<Scalar> PotentialPairComposite<evaluator, Base>::getComponentEnergies()
+    {
+    if (m_component_energies_valid)
+        return m_component_energies;
+
+    std::vector<double> energy(evaluator::n_components, 0.0);
+    if constexpr (std::is_same<Base, PotentialPair<evaluator>>::value)
+        {
+        // computeForces() tallied the component energies of each local particle
+        const std::vector<AccumReal>& component_energy = this->m_component_energy;
+        for (size_t k = 0; k < component_energy.size(); k++)
+            energy[k % evaluator::n_components] += double(component_energy[k]);
+        }
+    else
+        {
+        evaluateComponentEnergies(energy);
+        }
+
+#ifdef ENABLE_MPI
+    if (this->m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      energy.data(),
+                      evaluator::n_components,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      this->m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    m_component_energies.assign(energy.begin(), energy.end());
+    m_component_energies_valid = true;
+    return m_component_energies;
+    }
+
+/*! \param energy Energy of each component, incremented by the local pairs
+
+    Splits each pair energy equally between particles i and j as in computeForces().
+*/
+template<class evaluator, class Base>
+void PotentialPairComposite<evaluator, Base>::evaluateComponentEnergies(std::vector<double>& energy)
+    {
+    // access the neighbor list
+    ArrayHandle<unsigned int> h_n_neigh(this->m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(this->m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(this->m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    ArrayHandle<Scalar4> h_pos(this->m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::read);
+    ArrayHandle<Scalar> h_charge(this->m_pdata->getCharges(),
+                                 access_location::host,
+                                 access_mode::read);
+    ArrayHandle<Scalar> h_ronsq(this->m_ronsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_rcutsq(this->m_rcutsq, access_location::host, access_mode::read);
+
+    const BoxDim box = this->m_pdata->getGlobalBox();
+    const unsigned int N = this->m_pdata->getN();
+    bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        Scalar qi = Scalar(0.0);
+        if (evaluator::needsCharge())
+            qi = h_charge.data[i];
+
+        const size_t myHead = h_head_list.data[i];
+        const unsigned int size = (unsigned int)h_n_neigh.data[i];
+        for (unsigned int k = 0; k < size; k++)
+            {
+            unsigned int j = h_nlist.data[myHead + k];
+            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+            Scalar3 dx = box.minImage(pi - pj);
+            Scalar rsq = dot(dx, dx);
+
+            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+            Scalar rcutsq = h_rcutsq.data[typpair_idx];
+            if (rsq >= rcutsq)
+                continue;
+
+            // apply the same energy shift and XPLOR smoothing as PotentialPair::evaluatePair
+            Scalar ronsq = Scalar(0.0);
+            if (this->m_shift_mode == Base::xplor)
+                ronsq = h_ronsq.data[typpair_idx];
+            bool energy_shift = this->m_shift_mode == Base::shift
+                                || (this->m_shift_mode == Base::xplor && ronsq > rcutsq);
+            Scalar s = Scalar(1.0);
+            if (this->m_shift_mode == Base::xplor && rsq >= ronsq)
+                {
+                Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+                s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                    * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
+                    / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+                }
+
+            // pairs with local j are counted twice in a full neighbor list
+            double weight = (third_law && j < N) ? 1.0 : 0.5;
+
+            evaluator eval(rsq, rcutsq, this->m_params[typpair_idx]);
+            if (evaluator::needsCharge())
+                eval.setCharge(qi, h_charge.data[j]);
+
+            for (unsigned int c = 0; c < evaluator::n_components; c++)
+                {
+                Scalar force_divr = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                if (eval.evalComponentForceAndEnergy(c, force_divr, pair_eng, energy_shift))
+                    energy[c] += weight * pair_eng * s;
+                }
+            }
+        }
+    }
+
+namespace detail
+    {
+//! Export this pair potential to python
+/*! \param name Name of the class in the exported python module
+    \tparam evaluator EvaluatorPairComposite instantiation
+    \tparam Base Base class, which must already be exported
+*/
+template<class evaluator, class Base = PotentialPair<evaluator>>
+void export_PotentialPairComposite(pybind11::module& m, const std::string& name)
+    {
+    typedef PotentialPairComposite<evaluator, Base> T;
+    pybind11::class_<T, Base, std::shared_ptr<T>>(m, name.c_str())
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>())
+        .def("getComponentEnergies", &T::getComponentEnergies);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
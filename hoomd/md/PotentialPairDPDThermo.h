@@ -62,6 +62,12 @@ template<class evaluator> class PotentialPairDPDThermo : public PotentialPair<ev
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+
+    //! The DPD forces need the ghost velocities, compute them after the ghost update
+    virtual bool overlapsGhostUpdate()
+        {
+        return false;
+        }
 #endif
 
     protected:
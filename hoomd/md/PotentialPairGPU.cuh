@@ -64,14 +64,16 @@ struct pair_args_t
                 const unsigned int _compute_virial,
                 const unsigned int _threads_per_particle,
                 const GPUPartition& _gpu_partition,
-                const hipDeviceProp_t& _devprop)
+                const hipDeviceProp_t& _devprop,
+                const unsigned int* _d_typpair_class = nullptr,
+                const unsigned int _n_classes = 0)
         : d_force(_d_force), d_virial(_d_virial), virial_pitch(_virial_pitch), N(_N), n_max(_n_max),
           d_pos(_d_pos), d_charge(_d_charge), box(_box), d_n_neigh(_d_n_neigh), d_nlist(_d_nlist),
           d_head_list(_d_head_list), d_rcutsq(_d_rcutsq), d_ronsq(_d_ronsq),
           size_neigh_list(_size_neigh_list), ntypes(_ntypes), block_size(_block_size),
           shift_mode(_shift_mode), compute_virial(_compute_virial),
           threads_per_particle(_threads_per_particle), gpu_partition(_gpu_partition),
-          devprop(_devprop) {};
+          devprop(_devprop), d_typpair_class(_d_typpair_class), n_classes(_n_classes) {};
 
     Scalar4* d_force;          //!< Force to write out
     Scalar* d_virial;          //!< Virial to write out
@@ -95,8 +97,29 @@ struct pair_args_t
     const unsigned int threads_per_particle; //!< Number of threads per particle (maximum: 1 warp)
     const GPUPartition& gpu_partition; //!< The load balancing partition of particles between GPUs
     const hipDeviceProp_t& devprop;    //!< CUDA device properties
+
+    //! Interaction class of each type pair, nullptr when the parameters are indexed by type pair
+    const unsigned int* d_typpair_class;
+    const unsigned int n_classes; //!< Number of interaction classes in d_rcutsq, d_ronsq, d_params
     };
 
+//! Block size of the energy only kernel, a power of 2
+const unsigned int gpu_pair_energy_block_size = 256;
+
+//! Number of partial sums written by gpu_compute_pair_energy()
+/*! \param gpu_partition The load balancing partition of particles between GPUs
+ */
+inline unsigned int gpu_pair_energy_num_blocks(const GPUPartition& gpu_partition)
+    {
+    unsigned int n_blocks = 0;
+    for (unsigned int idev = 0; idev < gpu_partition.getNumActiveGPUs(); idev++)
+        {
+        auto range = gpu_partition.getRange(idev);
+        n_blocks += (range.second - range.first) / gpu_pair_energy_block_size + 1;
+        }
+    return n_blocks;
+    }
+
 #ifdef __HIPCC__
 
 //! Kernel for calculating pair forces
@@ -117,13 +140,16 @@ struct pair_args_t
     \param d_rcutsq rcut squared, stored per type pair
     \param d_ronsq ron squared, stored per type pair
     \param ntypes Number of types in the simulation
+    \param d_typpair_class Interaction class of each type pair, or nullptr
+    \param n_params Number of entries in \a d_params, \a d_rcutsq, and \a d_ronsq
     \param offset Offset of first particle
 
-    \a d_params, \a d_rcutsq, and \a d_ronsq must be indexed with an Index2DUpperTriangular(typei,
-   typej) to access the unique value for that type pair. These values are all cached into shared
-   memory for quick access, so a dynamic amount of shared memory must be allocated for this kernel
-   launch. The amount is (2*sizeof(Scalar) + sizeof(typename evaluator::param_type)) *
-   typpair_idx.getNumElements()
+    \a d_params, \a d_rcutsq, and \a d_ronsq must be indexed with an Index2D(typei, typej) to access
+   the value for that type pair. When \a d_typpair_class is not null, they hold one entry per
+   interaction class instead, and d_typpair_class[Index2D(typei, typej)] is the index of that
+   entry. These values are all cached into shared memory for quick access, so a dynamic amount of
+   shared memory must be allocated for this kernel launch. The amount is (2*sizeof(Scalar) +
+   sizeof(typename evaluator::param_type)) * n_params
 
     Certain options are controlled via template parameters to avoid the performance hit when they
    are not enabled. \tparam evaluator EvaluatorPair class to evaluate V(r) and -delta V(r)/r \tparam
@@ -157,11 +183,13 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                                       const Scalar* d_rcutsq,
                                       const Scalar* d_ronsq,
                                       const unsigned int ntypes,
+                                      const unsigned int* d_typpair_class,
+                                      const unsigned int n_params,
                                       const unsigned int offset,
                                       unsigned int max_extra_bytes)
     {
     Index2D typpair_idx(ntypes);
-    const unsigned int num_typ_parameters = typpair_idx.getNumElements();
+    const unsigned int num_typ_parameters = n_params;
 
     // shared arrays for per type pair parameters
     HIP_DYNAMIC_SHARED(char, s_data)
@@ -219,14 +247,14 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
     // add offset to get actual particle index
     idx += offset;
 
-    // initialize the force to 0
-    Scalar4 force = make_scalar4(Scalar(0.0), Scalar(0.0), Scalar(0.0), Scalar(0.0));
-    Scalar virialxx = Scalar(0.0);
-    Scalar virialxy = Scalar(0.0);
-    Scalar virialxz = Scalar(0.0);
-    Scalar virialyy = Scalar(0.0);
-    Scalar virialyz = Scalar(0.0);
-    Scalar virialzz = Scalar(0.0);
+    // initialize the force to 0, the pair contributions are summed in AccumReal precision
+    AccumReal4 force = {AccumReal(0.0), AccumReal(0.0), AccumReal(0.0), AccumReal(0.0)};
+    AccumReal virialxx = AccumReal(0.0);
+    AccumReal virialxy = AccumReal(0.0);
+    AccumReal virialxz = AccumReal(0.0);
+    AccumReal virialyy = AccumReal(0.0);
+    AccumReal virialyz = AccumReal(0.0);
+    AccumReal virialzz = AccumReal(0.0);
 
     if (active)
         {
@@ -277,6 +305,8 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
                 // access the per type pair parameters
                 unsigned int typpair
                     = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+                if (d_typpair_class)
+                    typpair = __ldg(d_typpair_class + typpair);
                 Scalar rcutsq;
                 const typename evaluator::param_type* param = nullptr;
                 Scalar ronsq = Scalar(0.0);
@@ -367,11 +397,11 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
             }
 
         // potential energy per particle must be halved
-        force.w *= Scalar(0.5);
+        force.w *= AccumReal(0.5);
         }
 
     // reduce force over threads in cta
-    hoomd::detail::WarpReduce<Scalar, tpp> reducer;
+    hoomd::detail::WarpReduce<AccumReal, tpp> reducer;
     force.x = reducer.Sum(force.x);
     force.y = reducer.Sum(force.y);
     force.z = reducer.Sum(force.z);
@@ -379,7 +409,8 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
 
     // now that the force calculation is complete, write out the result
     if (active && threadIdx.x % tpp == 0)
-        d_force[idx] = force;
+        d_force[idx]
+            = make_scalar4(Scalar(force.x), Scalar(force.y), Scalar(force.z), Scalar(force.w));
 
     if (compute_virial)
         {
@@ -393,12 +424,12 @@ gpu_compute_pair_forces_shared_kernel(Scalar4* d_force,
         // if we are the first thread in the cta, write out virial to global mem
         if (active && threadIdx.x % tpp == 0)
             {
-            d_virial[0 * virial_pitch + idx] = virialxx;
-            d_virial[1 * virial_pitch + idx] = virialxy;
-            d_virial[2 * virial_pitch + idx] = virialxz;
-            d_virial[3 * virial_pitch + idx] = virialyy;
-            d_virial[4 * virial_pitch + idx] = virialyz;
-            d_virial[5 * virial_pitch + idx] = virialzz;
+            d_virial[0 * virial_pitch + idx] = Scalar(virialxx);
+            d_virial[1 * virial_pitch + idx] = Scalar(virialxy);
+            d_virial[2 * virial_pitch + idx] = Scalar(virialxz);
+            d_virial[3 * virial_pitch + idx] = Scalar(virialyy);
+            d_virial[4 * virial_pitch + idx] = Scalar(virialyz);
+            d_virial[5 * virial_pitch + idx] = Scalar(virialzz);
             }
         }
     }
@@ -448,9 +479,11 @@ struct PairForceComputeKernel
             bool enable_shared_cache = true;
 
             Index2D typpair_idx(pair_args.ntypes);
+            const unsigned int n_params = pair_args.d_typpair_class
+                                              ? pair_args.n_classes
+                                              : typpair_idx.getNumElements();
             size_t param_shared_bytes
-                = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type))
-                  * typpair_idx.getNumElements();
+                = (2 * sizeof(Scalar) + sizeof(typename evaluator::param_type)) * n_params;
 
             unsigned int max_block_size;
             max_block_size
@@ -481,7 +514,7 @@ struct PairForceComputeKernel
             // determine dynamically requested shared memory in nested managed arrays
             char* ptr = nullptr;
             unsigned int available_bytes = max_extra_bytes;
-            for (unsigned int i = 0; i < typpair_idx.getNumElements(); ++i)
+            for (unsigned int i = 0; i < n_params; ++i)
                 {
                 d_params[i].allocate_shared(ptr, available_bytes);
                 }
@@ -516,6 +549,8 @@ struct PairForceComputeKernel
                                    pair_args.d_rcutsq,
                                    pair_args.d_ronsq,
                                    pair_args.ntypes,
+                                   pair_args.d_typpair_class,
+                                   n_params,
                                    offset,
                                    max_extra_bytes);
                 }
@@ -544,6 +579,8 @@ struct PairForceComputeKernel
                                    pair_args.d_rcutsq,
                                    pair_args.d_ronsq,
                                    pair_args.ntypes,
+                                   pair_args.d_typpair_class,
+                                   n_params,
                                    offset,
                                    max_extra_bytes);
                 }
@@ -654,11 +691,461 @@ gpu_compute_pair_forces(const pair_args_t& pair_args,
 
     return hipSuccess;
     }
+
+//! Evaluate the energy of one pair
+/*! \param rsq Squared distance between the particles
+    \param qi Charge of the first particle
+    \param qj Charge of the second particle
+    \param param Parameters of the type pair
+    \param rcutsq rcut squared of the type pair
+    \param ronsq ron squared of the type pair, only used when \a shift_mode is 2
+
+    Applies the same shifting and XPLOR smoothing as gpu_compute_pair_forces_shared_kernel().
+*/
+template<class evaluator, unsigned int shift_mode>
+__device__ inline Scalar gpu_eval_pair_energy(Scalar rsq,
+                                              Scalar qi,
+                                              Scalar qj,
+                                              const typename evaluator::param_type& param,
+                                              Scalar rcutsq,
+                                              Scalar ronsq)
+    {
+    bool energy_shift = false;
+    if (shift_mode == 1)
+        energy_shift = true;
+    else if (shift_mode == 2)
+        {
+        if (ronsq > rcutsq)
+            energy_shift = true;
+        }
+
+    Scalar force_divr = Scalar(0.0);
+    Scalar pair_eng = Scalar(0.0);
+    evaluator eval(rsq, rcutsq, param);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, qj);
+    eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+    if (shift_mode == 2)
+        {
+        if (rsq >= ronsq && rsq < rcutsq)
+            {
+            // XPLOR smoothing of the energy
+            Scalar xplor_denom_inv
+                = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+            Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+            Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                       * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+            pair_eng *= s;
+            }
+        }
+
+    return pair_eng;
+    }
+
+//! Kernel for calculating the total pair energy
+/*! \param d_block_energy Partial energy sum of each block
+    \param N number of particles handled by this launch
+    \param d_pos particle positions
+    \param d_charge particle charges
+    \param box Box dimensions used to implement periodic boundary conditions
+    \param d_n_neigh Device memory array listing the number of neighbors for each particle
+    \param d_nlist Device memory array containing the neighbor list contents
+    \param d_head_list Indexes for reading \a d_nlist
+    \param d_params Parameters for the potential
+    \param d_rcutsq rcut squared
+    \param d_ronsq ron squared
+    \param ntypes Number of types in the simulation
+    \param d_typpair_class Interaction class of each type pair, or nullptr
+    \param offset Offset of first particle
+
+    Evaluates the same pairs as gpu_compute_pair_forces_shared_kernel() with one thread per
+    particle, but accumulates only the energy. The threads of a block reduce their energies in
+    shared memory and thread 0 writes the block sum. No forces or virials are written. The
+    parameters are read from global memory, so the kernel needs only blockDim.x AccumReal of shared
+    memory.
+*/
+template<class evaluator, unsigned int shift_mode>
+__global__ void gpu_compute_pair_energy_kernel(AccumReal* d_block_energy,
+                                               const unsigned int N,
+                                               const Scalar4* d_pos,
+                                               const Scalar* d_charge,
+                                               const BoxDim box,
+                                               const unsigned int* d_n_neigh,
+                                               const unsigned int* d_nlist,
+                                               const size_t* d_head_list,
+                                               const typename evaluator::param_type* d_params,
+                                               const Scalar* d_rcutsq,
+                                               const Scalar* d_ronsq,
+                                               const unsigned int ntypes,
+                                               const unsigned int* d_typpair_class,
+                                               const unsigned int offset)
+    {
+    Index2D typpair_idx(ntypes);
+    HIP_DYNAMIC_SHARED(char, s_data)
+    AccumReal* s_energy = reinterpret_cast<AccumReal*>(s_data);
+
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    AccumReal energy = AccumReal(0.0);
+
+    if (idx < N)
+        {
+        idx += offset;
+        unsigned int n_neigh = d_n_neigh[idx];
+        Scalar4 postypei = __ldg(d_pos + idx);
+        Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+
+        Scalar qi = Scalar(0);
+        if (evaluator::needsCharge())
+            qi = __ldg(d_charge + idx);
+
+        size_t my_head = d_head_list[idx];
+        for (unsigned int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
+            {
+            unsigned int cur_j = __ldg(d_nlist + my_head + neigh_idx);
+            Scalar4 postypej = __ldg(d_pos + cur_j);
+            Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+
+            Scalar qj = Scalar(0.0);
+            if (evaluator::needsCharge())
+                qj = __ldg(d_charge + cur_j);
+
+            Scalar3 dx = box.minImage(posi - posj);
+            Scalar rsq = dot(dx, dx);
+
+            unsigned int typpair
+                = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+            if (d_typpair_class)
+                typpair = __ldg(d_typpair_class + typpair);
+
+            Scalar ronsq = Scalar(0.0);
+            if (shift_mode == 2)
+                ronsq = d_ronsq[typpair];
+            energy += gpu_eval_pair_energy<evaluator, shift_mode>(rsq,
+                                                                 qi,
+                                                                 qj,
+                                                                 d_params[typpair],
+                                                                 d_rcutsq[typpair],
+                                                                 ronsq);
+            }
+
+        // the full neighbor list includes each pair twice
+        energy *= AccumReal(0.5);
+        }
+
+    s_energy[threadIdx.x] = energy;
+    __syncthreads();
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride /= 2)
+        {
+        if (threadIdx.x < stride)
+            s_energy[threadIdx.x] += s_energy[threadIdx.x + stride];
+        __syncthreads();
+        }
+
+    if (threadIdx.x == 0)
+        d_block_energy[blockIdx.x] = s_energy[0];
+    }
+
+//! Kernel driver that computes the partial sums of the pair energy
+/*! \param pair_args Other arguments to pass onto the kernel, the force and virial pointers and the
+           launch parameters are not used
+    \param d_params Parameters for the potential
+    \param d_block_energy Output: gpu_pair_energy_num_blocks() partial sums of the energy
+
+    The caller sums \a d_block_energy after synchronizing the devices.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_energy(const pair_args_t& pair_args,
+                        const typename evaluator::param_type* d_params,
+                        AccumReal* d_block_energy)
+    {
+    assert(d_params);
+    assert(d_block_energy);
+
+    // the partial sums of the GPUs are stored one after the other
+    unsigned int block_offset = 0;
+    for (unsigned int idev = 0; idev < pair_args.gpu_partition.getNumActiveGPUs(); idev++)
+        {
+        auto range = pair_args.gpu_partition.getRangeAndSetGPU(idev);
+        unsigned int N = range.second - range.first;
+        dim3 grid(N / gpu_pair_energy_block_size + 1, 1, 1);
+        size_t shared_bytes = gpu_pair_energy_block_size * sizeof(AccumReal);
+
+        switch (pair_args.shift_mode)
+            {
+        case 0:
+            hipLaunchKernelGGL((gpu_compute_pair_energy_kernel<evaluator, 0>),
+                               grid,
+                               dim3(gpu_pair_energy_block_size),
+                               shared_bytes,
+                               0,
+                               d_block_energy + block_offset,
+                               N,
+                               pair_args.d_pos,
+                               pair_args.d_charge,
+                               pair_args.box,
+                               pair_args.d_n_neigh,
+                               pair_args.d_nlist,
+                               pair_args.d_head_list,
+                               d_params,
+                               pair_args.d_rcutsq,
+                               pair_args.d_ronsq,
+                               pair_args.ntypes,
+                               pair_args.d_typpair_class,
+                               range.first);
+            break;
+        case 1:
+            hipLaunchKernelGGL((gpu_compute_pair_energy_kernel<evaluator, 1>),
+                               grid,
+                               dim3(gpu_pair_energy_block_size),
+                               shared_bytes,
+                               0,
+                               d_block_energy + block_offset,
+                               N,
+                               pair_args.d_pos,
+                               pair_args.d_charge,
+                               pair_args.box,
+                               pair_args.d_n_neigh,
+                               pair_args.d_nlist,
+                               pair_args.d_head_list,
+                               d_params,
+                               pair_args.d_rcutsq,
+                               pair_args.d_ronsq,
+                               pair_args.ntypes,
+                               pair_args.d_typpair_class,
+                               range.first);
+            break;
+        case 2:
+            hipLaunchKernelGGL((gpu_compute_pair_energy_kernel<evaluator, 2>),
+                               grid,
+                               dim3(gpu_pair_energy_block_size),
+                               shared_bytes,
+                               0,
+                               d_block_energy + block_offset,
+                               N,
+                               pair_args.d_pos,
+                               pair_args.d_charge,
+                               pair_args.box,
+                               pair_args.d_n_neigh,
+                               pair_args.d_nlist,
+                               pair_args.d_head_list,
+                               d_params,
+                               pair_args.d_rcutsq,
+                               pair_args.d_ronsq,
+                               pair_args.ntypes,
+                               pair_args.d_typpair_class,
+                               range.first);
+            break;
+        default:
+            break;
+            }
+
+        block_offset += grid.x;
+        }
+
+    return hipSuccess;
+    }
+
+//! Kernel that adds the energies of selected particles
+/*! \param d_energy Energy of each selected particle, added to (output)
+    \param d_idx Local indices of the selected particles
+    \param n Number of selected particles
+    \param N Number of local particles
+    \param d_pos particle positions
+    \param d_charge particle charges
+    \param box Box dimensions used to implement periodic boundary conditions
+    \param d_n_neigh Device memory array listing the number of neighbors for each particle
+    \param d_nlist Device memory array containing the full neighbor list
+    \param d_head_list Indexes for reading \a d_nlist
+    \param d_params Parameters for the potential, stored per type pair
+    \param d_rcutsq rcut squared, stored per type pair
+    \param d_ronsq ron squared, stored per type pair
+    \param ntypes Number of types in the simulation
+
+    One thread sums the pair energies of one selected particle with all of its neighbors. Entries
+    of \a d_idx that are not smaller than \a N are skipped.
+*/
+template<class evaluator, unsigned int shift_mode>
+__global__ void
+gpu_compute_pair_particle_energy_kernel(Scalar* d_energy,
+                                        const unsigned int* d_idx,
+                                        const unsigned int n,
+                                        const unsigned int N,
+                                        const Scalar4* d_pos,
+                                        const Scalar* d_charge,
+                                        const BoxDim box,
+                                        const unsigned int* d_n_neigh,
+                                        const unsigned int* d_nlist,
+                                        const size_t* d_head_list,
+                                        const typename evaluator::param_type* d_params,
+                                        const Scalar* d_rcutsq,
+                                        const Scalar* d_ronsq,
+                                        const unsigned int ntypes)
+    {
+    unsigned int k = blockIdx.x * blockDim.x + threadIdx.x;
+    if (k >= n)
+        return;
+
+    unsigned int idx = d_idx[k];
+    if (idx >= N)
+        return;
+
+    Index2D typpair_idx(ntypes);
+    Scalar4 postypei = __ldg(d_pos + idx);
+    Scalar3 posi = make_scalar3(postypei.x, postypei.y, postypei.z);
+    Scalar qi = Scalar(0);
+    if (evaluator::needsCharge())
+        qi = __ldg(d_charge + idx);
+
+    AccumReal energy = AccumReal(0.0);
+    unsigned int n_neigh = d_n_neigh[idx];
+    size_t my_head = d_head_list[idx];
+    for (unsigned int neigh_idx = 0; neigh_idx < n_neigh; neigh_idx++)
+        {
+        unsigned int cur_j = __ldg(d_nlist + my_head + neigh_idx);
+        Scalar4 postypej = __ldg(d_pos + cur_j);
+        Scalar3 posj = make_scalar3(postypej.x, postypej.y, postypej.z);
+
+        Scalar qj = Scalar(0.0);
+        if (evaluator::needsCharge())
+            qj = __ldg(d_charge + cur_j);
+
+        Scalar3 dx = box.minImage(posi - posj);
+        unsigned int typpair
+            = typpair_idx(__scalar_as_int(postypei.w), __scalar_as_int(postypej.w));
+        Scalar ronsq = Scalar(0.0);
+        if (shift_mode == 2)
+            ronsq = d_ronsq[typpair];
+        energy += gpu_eval_pair_energy<evaluator, shift_mode>(dot(dx, dx),
+                                                             qi,
+                                                             qj,
+                                                             d_params[typpair],
+                                                             d_rcutsq[typpair],
+                                                             ronsq);
+        }
+
+    d_energy[k] += Scalar(energy);
+    }
+
+//! Kernel driver that adds the energies of selected particles
+/*! \param pair_args Other arguments to pass onto the kernel, the force and virial pointers, the
+           interaction classes, and the GPU partition are not used
+    \param d_params Parameters for the potential, stored per type pair
+    \param d_idx Local indices of the selected particles
+    \param n Number of selected particles
+    \param d_energy Energy of each selected particle, added to (output)
+
+    The selected particles are few and scattered, so the kernel runs on the current GPU.
+*/
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_particle_energy(const pair_args_t& pair_args,
+                                 const typename evaluator::param_type* d_params,
+                                 const unsigned int* d_idx,
+                                 const unsigned int n,
+                                 Scalar* d_energy)
+    {
+    assert(d_params);
+    assert(d_idx);
+    assert(d_energy);
+
+    if (n == 0)
+        return hipSuccess;
+
+    dim3 grid(n / gpu_pair_energy_block_size + 1, 1, 1);
+    dim3 threads(gpu_pair_energy_block_size, 1, 1);
+
+    switch (pair_args.shift_mode)
+        {
+    case 0:
+        hipLaunchKernelGGL((gpu_compute_pair_particle_energy_kernel<evaluator, 0>),
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_energy,
+                           d_idx,
+                           n,
+                           pair_args.N,
+                           pair_args.d_pos,
+                           pair_args.d_charge,
+                           pair_args.box,
+                           pair_args.d_n_neigh,
+                           pair_args.d_nlist,
+                           pair_args.d_head_list,
+                           d_params,
+                           pair_args.d_rcutsq,
+                           pair_args.d_ronsq,
+                           pair_args.ntypes);
+        break;
+    case 1:
+        hipLaunchKernelGGL((gpu_compute_pair_particle_energy_kernel<evaluator, 1>),
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_energy,
+                           d_idx,
+                           n,
+                           pair_args.N,
+                           pair_args.d_pos,
+                           pair_args.d_charge,
+                           pair_args.box,
+                           pair_args.d_n_neigh,
+                           pair_args.d_nlist,
+                           pair_args.d_head_list,
+                           d_params,
+                           pair_args.d_rcutsq,
+                           pair_args.d_ronsq,
+                           pair_args.ntypes);
+        break;
+    case 2:
+        hipLaunchKernelGGL((gpu_compute_pair_particle_energy_kernel<evaluator, 2>),
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_energy,
+                           d_idx,
+                           n,
+                           pair_args.N,
+                           pair_args.d_pos,
+                           pair_args.d_charge,
+                           pair_args.box,
+                           pair_args.d_n_neigh,
+                           pair_args.d_nlist,
+                           pair_args.d_head_list,
+                           d_params,
+                           pair_args.d_rcutsq,
+                           pair_args.d_ronsq,
+                           pair_args.ntypes);
+        break;
+    default:
+        break;
+        }
+
+    return hipSuccess;
+    }
 #else
 template<class evaluator>
 __attribute__((visibility("default"))) hipError_t
 gpu_compute_pair_forces(const pair_args_t& pair_args,
                         const typename evaluator::param_type* d_params);
+
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_energy(const pair_args_t& pair_args,
+                        const typename evaluator::param_type* d_params,
+                        AccumReal* d_block_energy);
+
+template<class evaluator>
+__attribute__((visibility("default"))) hipError_t
+gpu_compute_pair_particle_energy(const pair_args_t& pair_args,
+                                 const typename evaluator::param_type* d_params,
+                                 const unsigned int* d_idx,
+                                 const unsigned int n,
+                                 Scalar* d_energy);
 #endif
 
     } // end namespace kernel
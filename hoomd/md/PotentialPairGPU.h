@@ -7,6 +7,9 @@
 #ifdef ENABLE_HIP
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "PotentialPair.h"
 #include "PotentialPairGPU.cuh"
@@ -39,6 +42,14 @@ namespace md
    function to call gpu_compute_pair_forces() instantiated with the same evaluator. (See
    PotentialPairLJGPU.cu and PotentialPairLJGPU.cuh for an example).
 
+    The kernel caches the per type pair parameters in shared memory. With many particle types, the
+   dense tables grow as the square of the number of types and no longer fit, while many type pairs
+   share identical parameters. PotentialPairGPU therefore maps each type pair to an interaction
+   class, one for each distinct combination of params, r_cut, and r_on, and passes the per class
+   tables to the kernel when the dense tables do not fit in shared memory. Parameters are compared
+   bitwise, so parameters that differ only in padding bytes or that own separate arrays (such as
+   tabulated potentials) form separate classes.
+
     \tparam evaluator EvaluatorPair class used to evaluate V(r) and F(r)/r
 
     \sa export_PotentialPairGPU()
@@ -46,14 +57,69 @@ namespace md
 template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluator>
     {
     public:
+    //! Param type from evaluator
+    typedef typename evaluator::param_type param_type;
+
     //! Construct the pair potential
     PotentialPairGPU(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<NeighborList> nlist);
     //! Destructor
     virtual ~PotentialPairGPU() { }
 
+    //! Set the pair parameters for a single type pair
+    virtual void setParams(unsigned int typ1, unsigned int typ2, const param_type& param)
+        {
+        PotentialPair<evaluator>::setParams(typ1, typ2, param);
+        m_params_changed = true;
+        }
+
+    //! Set the rcut for a single type pair
+    virtual void setRcut(unsigned int typ1, unsigned int typ2, Scalar rcut)
+        {
+        PotentialPair<evaluator>::setRcut(typ1, typ2, rcut);
+        m_params_changed = true;
+        }
+
+    //! Set ron for a single type pair
+    virtual void setRon(unsigned int typ1, unsigned int typ2, Scalar ron)
+        {
+        PotentialPair<evaluator>::setRon(typ1, typ2, ron);
+        m_params_changed = true;
+        }
+
+    //! Compute the total pair energy with the energy only kernel
+    virtual Scalar computeEnergy(uint64_t timestep);
+
+    //! Add the energies of several local particles on the GPU
+    virtual void addParticleEnergies(const GlobalArray<unsigned int>& idx,
+                                     unsigned int n,
+                                     GlobalArray<Scalar>& energy);
+
+#ifdef ENABLE_MPI
+    //! The GPU kernel processes all particles at once, compute the forces after the ghost update
+    virtual bool overlapsGhostUpdate()
+        {
+        return false;
+        }
+#endif
+
     protected:
     std::shared_ptr<Autotuner<2>> m_tuner; //!< Autotuner for block size and threads per particle
 
+    GlobalArray<unsigned int> m_typpair_class; //!< Interaction class of each type pair
+    GlobalArray<Scalar> m_class_rcutsq;        //!< Cutoff radius squared per interaction class
+    GlobalArray<Scalar> m_class_ronsq;         //!< ron squared per interaction class
+
+    /// Potential parameters per interaction class
+    std::vector<param_type, hoomd::detail::managed_allocator<param_type>> m_class_params;
+
+    bool m_params_changed = true; //!< True when the interaction classes must be rebuilt
+    bool m_use_classes = false;   //!< True when the kernel reads the per class tables
+
+    GlobalArray<AccumReal> m_block_energy; //!< Partial sums of the energy only kernel
+
+    //! Rebuild the interaction classes from the per type pair tables
+    void updateInteractionClasses();
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
     };
@@ -61,7 +127,10 @@ template<class evaluator> class PotentialPairGPU : public PotentialPair<evaluato
 template<class evaluator>
 PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition> sysdef,
                                               std::shared_ptr<NeighborList> nlist)
-    : PotentialPair<evaluator>(sysdef, nlist)
+    : PotentialPair<evaluator>(sysdef, nlist),
+      m_typpair_class(this->m_typpair_idx.getNumElements(), this->m_exec_conf),
+      m_class_rcutsq(this->m_typpair_idx.getNumElements(), this->m_exec_conf),
+      m_class_ronsq(this->m_typpair_idx.getNumElements(), this->m_exec_conf)
     {
     // can't run on the GPU if there aren't any GPUs in the execution configuration
     if (!this->m_exec_conf->isCUDAEnabled())
@@ -86,10 +155,73 @@ PotentialPairGPU<evaluator>::PotentialPairGPU(std::shared_ptr<SystemDefinition>
 #endif
     }
 
+/*! Type pairs with bitwise identical params, r_cut squared, and r_on squared share a class. The
+    per class tables are only used when the per type pair tables would not fit in shared memory.
+*/
+template<class evaluator> void PotentialPairGPU<evaluator>::updateInteractionClasses()
+    {
+    const unsigned int n_pairs = this->m_typpair_idx.getNumElements();
+
+    // a previous kernel may still be reading the per class parameters
+    hipDeviceSynchronize();
+
+    ArrayHandle<Scalar> h_rcutsq(this->m_rcutsq, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_ronsq(this->m_ronsq, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_typpair_class(m_typpair_class,
+                                              access_location::host,
+                                              access_mode::overwrite);
+
+    // the first type pair of each class
+    std::vector<unsigned int> class_pair;
+    std::unordered_map<std::string, unsigned int> class_of_key;
+    for (unsigned int i = 0; i < n_pairs; i++)
+        {
+        std::string key(reinterpret_cast<const char*>(&this->m_params[i]), sizeof(param_type));
+        key.append(reinterpret_cast<const char*>(&h_rcutsq.data[i]), sizeof(Scalar));
+        key.append(reinterpret_cast<const char*>(&h_ronsq.data[i]), sizeof(Scalar));
+
+        auto result = class_of_key.emplace(key, static_cast<unsigned int>(class_pair.size()));
+        if (result.second)
+            class_pair.push_back(i);
+        h_typpair_class.data[i] = result.first->second;
+        }
+
+    const unsigned int n_classes = static_cast<unsigned int>(class_pair.size());
+    ArrayHandle<Scalar> h_class_rcutsq(m_class_rcutsq,
+                                       access_location::host,
+                                       access_mode::overwrite);
+    ArrayHandle<Scalar> h_class_ronsq(m_class_ronsq,
+                                      access_location::host,
+                                      access_mode::overwrite);
+    m_class_params = std::vector<param_type, hoomd::detail::managed_allocator<param_type>>(
+        n_classes,
+        param_type(),
+        hoomd::detail::managed_allocator<param_type>(this->m_exec_conf->isCUDAEnabled()));
+    for (unsigned int c = 0; c < n_classes; c++)
+        {
+        h_class_rcutsq.data[c] = h_rcutsq.data[class_pair[c]];
+        h_class_ronsq.data[c] = h_ronsq.data[class_pair[c]];
+        m_class_params[c] = this->m_params[class_pair[c]];
+        }
+
+    const size_t dense_bytes = (2 * sizeof(Scalar) + sizeof(param_type)) * size_t(n_pairs);
+    m_use_classes = n_classes < n_pairs
+                    && dense_bytes > size_t(this->m_exec_conf->dev_prop.sharedMemPerBlock);
+
+    this->m_exec_conf->msg->notice(7)
+        << "PotentialPairGPU<" << evaluator::getName() << ">: " << n_classes
+        << " interaction classes for " << n_pairs << " type pairs" << std::endl;
+
+    m_params_changed = false;
+    }
+
 template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64_t timestep)
     {
     this->m_nlist->compute(timestep);
 
+    if (m_params_changed)
+        updateInteractionClasses();
+
     // The GPU implementation CANNOT handle a half neighborlist, error out now
     bool third_law = this->m_nlist->getStorageMode() == NeighborList::half;
     if (third_law)
@@ -120,9 +252,16 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
 
     BoxDim box = this->m_pdata->getBox();
 
-    // access parameters
-    ArrayHandle<Scalar> d_ronsq(this->m_ronsq, access_location::device, access_mode::read);
-    ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+    // access parameters, per interaction class when the per type pair tables are too large
+    ArrayHandle<Scalar> d_ronsq(m_use_classes ? m_class_ronsq : this->m_ronsq,
+                                access_location::device,
+                                access_mode::read);
+    ArrayHandle<Scalar> d_rcutsq(m_use_classes ? m_class_rcutsq : this->m_rcutsq,
+                                 access_location::device,
+                                 access_mode::read);
+    ArrayHandle<unsigned int> d_typpair_class(m_typpair_class,
+                                              access_location::device,
+                                              access_mode::read);
     ArrayHandle<Scalar4> d_force(this->m_force, access_location::device, access_mode::readwrite);
     ArrayHandle<Scalar> d_virial(this->m_virial, access_location::device, access_mode::readwrite);
 
@@ -157,8 +296,10 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
                             flags[pdata_flag::pressure_tensor],
                             threads_per_particle,
                             this->m_pdata->getGPUPartition(),
-                            this->m_exec_conf->dev_prop),
-        this->m_params.data());
+                            this->m_exec_conf->dev_prop,
+                            m_use_classes ? d_typpair_class.data : nullptr,
+                            static_cast<unsigned int>(m_class_params.size())),
+        m_use_classes ? m_class_params.data() : this->m_params.data());
 
     if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
         CHECK_CUDA_ERROR();
@@ -171,6 +312,187 @@ template<class evaluator> void PotentialPairGPU<evaluator>::computeForces(uint64
     this->computeTailCorrection();
     }
 
+/*! \param timestep Current time step
+    \returns The total pair energy on all ranks, including the tail correction
+*/
+template<class evaluator> Scalar PotentialPairGPU<evaluator>::computeEnergy(uint64_t timestep)
+    {
+    ScopedOperationTimer timer(this->m_timer, typeid(*this));
+    this->m_nlist->compute(timestep);
+
+    if (m_params_changed)
+        updateInteractionClasses();
+
+    if (this->m_nlist->getStorageMode() == NeighborList::half)
+        {
+        throw std::runtime_error("PotentialPairGPU cannot handle a half neighborlist");
+        }
+
+    const GPUPartition& gpu_partition = this->m_pdata->getGPUPartition();
+    const unsigned int n_blocks = kernel::gpu_pair_energy_num_blocks(gpu_partition);
+    if (m_block_energy.getNumElements() < n_blocks)
+        {
+        GlobalArray<AccumReal> block_energy(n_blocks, this->m_exec_conf);
+        m_block_energy.swap(block_energy);
+        TAG_ALLOCATION(m_block_energy);
+        }
+
+        {
+        ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+                                            access_location::device,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                          access_location::device,
+                                          access_mode::read);
+        ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                        access_location::device,
+                                        access_mode::read);
+        ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                     access_location::device,
+                                     access_mode::read);
+        ArrayHandle<Scalar> d_ronsq(m_use_classes ? m_class_ronsq : this->m_ronsq,
+                                    access_location::device,
+                                    access_mode::read);
+        ArrayHandle<Scalar> d_rcutsq(m_use_classes ? m_class_rcutsq : this->m_rcutsq,
+                                     access_location::device,
+                                     access_mode::read);
+        ArrayHandle<unsigned int> d_typpair_class(m_typpair_class,
+                                                  access_location::device,
+                                                  access_mode::read);
+        ArrayHandle<AccumReal> d_block_energy(m_block_energy,
+                                              access_location::device,
+                                              access_mode::overwrite);
+
+        this->m_exec_conf->beginMultiGPU();
+        kernel::gpu_compute_pair_energy<evaluator>(
+            kernel::pair_args_t(nullptr,
+                                nullptr,
+                                0,
+                                this->m_pdata->getN(),
+                                this->m_pdata->getMaxN(),
+                                d_pos.data,
+                                d_charge.data,
+                                this->m_pdata->getBox(),
+                                d_n_neigh.data,
+                                d_nlist.data,
+                                d_head_list.data,
+                                d_rcutsq.data,
+                                d_ronsq.data,
+                                this->m_nlist->getNListArray().getPitch(),
+                                this->m_pdata->getNTypes(),
+                                kernel::gpu_pair_energy_block_size,
+                                this->m_shift_mode,
+                                0,
+                                1,
+                                gpu_partition,
+                                this->m_exec_conf->dev_prop,
+                                m_use_classes ? d_typpair_class.data : nullptr,
+                                static_cast<unsigned int>(m_class_params.size())),
+            m_use_classes ? m_class_params.data() : this->m_params.data(),
+            d_block_energy.data);
+
+        if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        this->m_exec_conf->endMultiGPU();
+        }
+
+    // the partial sums are reduced on the host, there are only N / block_size of them
+    ArrayHandle<AccumReal> h_block_energy(m_block_energy, access_location::host, access_mode::read);
+    double energy = 0.0;
+    for (unsigned int i = 0; i < n_blocks; i++)
+        energy += h_block_energy.data[i];
+
+    // the tail correction is added on the root rank only
+    this->computeTailCorrection();
+    energy += this->m_external_energy;
+
+#ifdef ENABLE_MPI
+    if (this->m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &energy,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      this->m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return Scalar(energy);
+    }
+
+/*! \param idx Local indices of the particles
+    \param n Number of particles
+    \param energy Energy of each particle, added to
+
+    Reads the per type pair tables, which are always current, instead of the interaction classes.
+*/
+template<class evaluator>
+void PotentialPairGPU<evaluator>::addParticleEnergies(const GlobalArray<unsigned int>& idx,
+                                                      unsigned int n,
+                                                      GlobalArray<Scalar>& energy)
+    {
+    if (this->m_nlist->getStorageMode() != NeighborList::full)
+        {
+        throw std::runtime_error("Particle energies require a full neighbor list.");
+        }
+
+    ArrayHandle<unsigned int> d_n_neigh(this->m_nlist->getNNeighArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(this->m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(this->m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+    ArrayHandle<Scalar4> d_pos(this->m_pdata->getPositions(),
+                               access_location::device,
+                               access_mode::read);
+    ArrayHandle<Scalar> d_charge(this->m_pdata->getCharges(),
+                                 access_location::device,
+                                 access_mode::read);
+    ArrayHandle<Scalar> d_ronsq(this->m_ronsq, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_rcutsq(this->m_rcutsq, access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_idx(idx, access_location::device, access_mode::read);
+    ArrayHandle<Scalar> d_energy(energy, access_location::device, access_mode::readwrite);
+
+    kernel::gpu_compute_pair_particle_energy<evaluator>(
+        kernel::pair_args_t(nullptr,
+                            nullptr,
+                            0,
+                            this->m_pdata->getN(),
+                            this->m_pdata->getMaxN(),
+                            d_pos.data,
+                            d_charge.data,
+                            this->m_pdata->getBox(),
+                            d_n_neigh.data,
+                            d_nlist.data,
+                            d_head_list.data,
+                            d_rcutsq.data,
+                            d_ronsq.data,
+                            this->m_nlist->getNListArray().getPitch(),
+                            this->m_pdata->getNTypes(),
+                            kernel::gpu_pair_energy_block_size,
+                            this->m_shift_mode,
+                            0,
+                            1,
+                            this->m_pdata->getGPUPartition(),
+                            this->m_exec_conf->dev_prop,
+                            nullptr,
+                            0),
+        this->m_params.data(),
+        d_idx.data,
+        n,
+        d_energy.data);
+
+    if (this->m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
 namespace detail
     {
 //! Export this pair potential to python
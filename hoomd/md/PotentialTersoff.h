@@ -8,6 +8,7 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
@@ -15,6 +16,12 @@
 #include "hoomd/HOOMDMath.h"
 #include "hoomd/Index1D.h"
 
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 /*! \file PotentialTersoff.h
     \brief Defines the template class for standard three-body potentials
     \details The heart of the code that computes three-body potentials is in this file.
@@ -583,9 +590,22 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
         memset(h_virial.data, 0, sizeof(Scalar) * 6 * m_virial_pitch);
 
         unsigned int ntypes = m_pdata->getNTypes();
+        const unsigned int N = m_pdata->getN();
+
+        // compute the forces on particles [begin, end) and add them, and the reactions on their
+        // neighbors, to force and virial
+        auto compute_particles = [&](unsigned int begin,
+                                     unsigned int end,
+                                     Scalar4* force,
+                                     Scalar* virial,
+                                     size_t virial_pitch)
+        {
+        // separation vectors and squared distances from particle i to its neighbors, computed once
+        // per neighbor and reused by the pair and the triplet loops
+        std::vector<Scalar3> dx_neigh;
+        std::vector<Scalar> rsq_neigh;
 
-        // for each particle
-        for (int i = 0; i < (int)m_pdata->getN(); i++)
+        for (unsigned int i = begin; i < end; i++)
             {
             // access the particle's position and type (MEM TRANSFER: 4 scalars)
             Scalar3 posi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
@@ -615,6 +635,21 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
 
             // all neighbors of this particle
             const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            dx_neigh.resize(size);
+            rsq_neigh.resize(size);
+            for (unsigned int k = 0; k < size; k++)
+                {
+                unsigned int kk = h_nlist.data[head_i + k];
+                assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
+
+                Scalar3 posk = make_scalar3(h_pos.data[kk].x, h_pos.data[kk].y, h_pos.data[kk].z);
+
+                // apply periodic boundary conditions
+                Scalar3 dxik = box.minImage(posi - posk);
+                dx_neigh[k] = dxik;
+                rsq_neigh[k] = dot(dxik, dxik);
+                }
+
             if (evaluator::hasPerParticleEnergy())
                 {
                 for (unsigned int j = 0; j < size; j++)
@@ -623,20 +658,11 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                     unsigned int jj = h_nlist.data[head_i + j];
                     assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
 
-                    // access the position and type of particle j
-                    Scalar3 posj
-                        = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
+                    // access the type of particle j
                     unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
                     assert(typej < m_pdata->getNTypes());
 
-                    // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                    Scalar3 dxij = posi - posj;
-
-                    // apply periodic boundary conditions
-                    dxij = box.minImage(dxij);
-
-                    // compute rij_sq (FLOPS: 5)
-                    Scalar rij_sq = dot(dxij, dxij);
+                    Scalar rij_sq = rsq_neigh[j];
 
                     // get parameters for this type pair
                     unsigned int typpair_idx = m_typpair_idx(typei, typej);
@@ -668,8 +694,7 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                 unsigned int jj = h_nlist.data[head_i + j];
                 assert(jj < m_pdata->getN() + m_pdata->getNGhosts());
 
-                // access the position and type of particle j
-                Scalar3 posj = make_scalar3(h_pos.data[jj].x, h_pos.data[jj].y, h_pos.data[jj].z);
+                // access the type of particle j
                 unsigned int typej = __scalar_as_int(h_pos.data[jj].w);
                 assert(typej < m_pdata->getNTypes());
 
@@ -677,14 +702,8 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                 Scalar3 fj = make_scalar3(0.0, 0.0, 0.0);
                 Scalar pej = 0.0;
 
-                // calculate dr_ij (MEM TRANSFER: 3 scalars / FLOPS: 3)
-                Scalar3 dxij = posi - posj;
-
-                // apply periodic boundary conditions
-                dxij = box.minImage(dxij);
-
-                // compute rij_sq (FLOPS: 5)
-                Scalar rij_sq = dot(dxij, dxij);
+                const Scalar3 dxij = dx_neigh[j];
+                Scalar rij_sq = rsq_neigh[j];
 
                 // get parameters for this type pair
                 unsigned int typpair_idx = m_typpair_idx(typei, typej);
@@ -716,10 +735,7 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                             unsigned int kk = h_nlist.data[head_i + k];
                             assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
 
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
+                            // access the type of neighbor k
                             unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
                             assert(typek < m_pdata->getNTypes());
 
@@ -732,14 +748,8 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
 
                             if (kk != jj && temp_evaluated)
                                 {
-                                // compute drik
-                                Scalar3 dxik = posi - posk;
-
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
-
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                                const Scalar3 dxik = dx_neigh[k];
+                                Scalar rik_sq = rsq_neigh[k];
 
                                 // compute the bond angle (if needed)
                                 Scalar cos_th = Scalar(0.0);
@@ -803,10 +813,7 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                             unsigned int kk = h_nlist.data[head_i + k];
                             assert(kk < m_pdata->getN() + m_pdata->getNGhosts());
 
-                            // access the position and type of neighbor k
-                            Scalar3 posk = make_scalar3(h_pos.data[kk].x,
-                                                        h_pos.data[kk].y,
-                                                        h_pos.data[kk].z);
+                            // access the type of neighbor k
                             unsigned int typek = __scalar_as_int(h_pos.data[kk].w);
                             assert(typek < m_pdata->getNTypes());
 
@@ -822,14 +829,8 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                                 // create variable for the force on k
                                 Scalar3 fk = make_scalar3(0.0, 0.0, 0.0);
 
-                                // compute dr_ik
-                                Scalar3 dxik = posi - posk;
-
-                                // apply periodic boundary conditions
-                                dxik = box.minImage(dxik);
-
-                                // compute rik_sq
-                                Scalar rik_sq = dot(dxik, dxik);
+                                const Scalar3 dxik = dx_neigh[k];
+                                Scalar rik_sq = rsq_neigh[k];
 
                                 // compute the bond angle (if needed)
                                 Scalar cos_th = Scalar(0.0);
@@ -902,30 +903,30 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
 
                                 // increment the force for particle k
                                 unsigned int mem_idx = kk;
-                                h_force.data[mem_idx].x += fk.x;
-                                h_force.data[mem_idx].y += fk.y;
-                                h_force.data[mem_idx].z += fk.z;
+                                force[mem_idx].x += fk.x;
+                                force[mem_idx].y += fk.y;
+                                force[mem_idx].z += fk.z;
 
                                 if (compute_virial)
                                     {
                                     Scalar force_div2r_ij = Scalar(0.5) * force_divr_ij.z;
                                     Scalar force_div2r_ik = Scalar(0.5) * force_divr_ik.z;
-                                    h_virial.data[0 * m_virial_pitch + mem_idx]
+                                    virial[0 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.x
                                            + force_div2r_ik * dxik.x * dxik.x;
-                                    h_virial.data[1 * m_virial_pitch + mem_idx]
+                                    virial[1 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.y
                                            + force_div2r_ik * dxik.x * dxik.y;
-                                    h_virial.data[2 * m_virial_pitch + mem_idx]
+                                    virial[2 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.x * dxij.z
                                            + force_div2r_ik * dxik.x * dxik.z;
-                                    h_virial.data[3 * m_virial_pitch + mem_idx]
+                                    virial[3 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.y * dxij.y
                                            + force_div2r_ik * dxik.y * dxik.y;
-                                    h_virial.data[4 * m_virial_pitch + mem_idx]
+                                    virial[4 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.y * dxij.z
                                            + force_div2r_ik * dxik.y * dxik.z;
-                                    h_virial.data[5 * m_virial_pitch + mem_idx]
+                                    virial[5 * virial_pitch + mem_idx]
                                         += force_div2r_ij * dxij.z * dxij.z
                                            + force_div2r_ik * dxik.z * dxik.z;
                                     }
@@ -935,38 +936,107 @@ template<class evaluator> void PotentialTersoff<evaluator>::computeForces(uint64
                     }
                 // increment the force and potential energy for particle j
                 unsigned int mem_idx = jj;
-                h_force.data[mem_idx].x += fj.x;
-                h_force.data[mem_idx].y += fj.y;
-                h_force.data[mem_idx].z += fj.z;
-                h_force.data[mem_idx].w += pej;
+                force[mem_idx].x += fj.x;
+                force[mem_idx].y += fj.y;
+                force[mem_idx].z += fj.z;
+                force[mem_idx].w += pej;
 
                 if (compute_virial)
                     {
-                    h_virial.data[0 * m_virial_pitch + mem_idx] += virialj_xx;
-                    h_virial.data[1 * m_virial_pitch + mem_idx] += virialj_xy;
-                    h_virial.data[2 * m_virial_pitch + mem_idx] += virialj_xz;
-                    h_virial.data[3 * m_virial_pitch + mem_idx] += virialj_yy;
-                    h_virial.data[4 * m_virial_pitch + mem_idx] += virialj_yz;
-                    h_virial.data[5 * m_virial_pitch + mem_idx] += virialj_zz;
+                    virial[0 * virial_pitch + mem_idx] += virialj_xx;
+                    virial[1 * virial_pitch + mem_idx] += virialj_xy;
+                    virial[2 * virial_pitch + mem_idx] += virialj_xz;
+                    virial[3 * virial_pitch + mem_idx] += virialj_yy;
+                    virial[4 * virial_pitch + mem_idx] += virialj_yz;
+                    virial[5 * virial_pitch + mem_idx] += virialj_zz;
                     }
                 }
             // finally, increment the force and potential energy for particle i
             unsigned int mem_idx = i;
-            h_force.data[mem_idx].x += fi.x;
-            h_force.data[mem_idx].y += fi.y;
-            h_force.data[mem_idx].z += fi.z;
-            h_force.data[mem_idx].w += pei;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
 
             if (compute_virial)
                 {
-                h_virial.data[0 * m_virial_pitch + mem_idx] += viriali_xx;
-                h_virial.data[1 * m_virial_pitch + mem_idx] += viriali_xy;
-                h_virial.data[2 * m_virial_pitch + mem_idx] += viriali_xz;
-                h_virial.data[3 * m_virial_pitch + mem_idx] += viriali_yy;
-                h_virial.data[4 * m_virial_pitch + mem_idx] += viriali_yz;
-                h_virial.data[5 * m_virial_pitch + mem_idx] += viriali_zz;
+                virial[0 * virial_pitch + mem_idx] += viriali_xx;
+                virial[1 * virial_pitch + mem_idx] += viriali_xy;
+                virial[2 * virial_pitch + mem_idx] += viriali_xz;
+                virial[3 * virial_pitch + mem_idx] += viriali_yy;
+                virial[4 * virial_pitch + mem_idx] += viriali_yz;
+                virial[5 * virial_pitch + mem_idx] += viriali_zz;
                 }
             }
+        };
+
+#ifdef ENABLE_TBB
+        if (m_exec_conf->getNumThreads() > 1)
+            {
+            const unsigned int n_all = N + m_pdata->getNGhosts();
+            m_exec_conf->getTaskArena()->execute(
+                [&]
+                {
+                    // the forces on neighbors j and k may be written by any thread, accumulate
+                    // into thread-local arrays and reduce them afterwards
+                    hoomd::detail::ThreadBuffers<Scalar4> thread_force(
+                        m_exec_conf,
+                        n_all,
+                        make_scalar4(0, 0, 0, 0));
+                    hoomd::detail::ThreadBuffers<Scalar> thread_virial(
+                        m_exec_conf,
+                        compute_virial ? 6 * size_t(n_all) : 0,
+                        Scalar(0.0));
+
+                    thread_force.parallel_for(
+                        0,
+                        N,
+                        [&](unsigned int begin, unsigned int end, unsigned int k)
+                        {
+                            compute_particles(begin,
+                                              end,
+                                              thread_force[k].data(),
+                                              thread_virial[k].data(),
+                                              size_t(n_all));
+                        });
+
+                    // sum the per-thread contributions
+                    tbb::parallel_for(
+                        tbb::blocked_range<unsigned int>(0, n_all),
+                        [&](const tbb::blocked_range<unsigned int>& r)
+                        {
+                            for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                {
+                                Scalar4 f = make_scalar4(0, 0, 0, 0);
+                                for (const auto& force : thread_force)
+                                    {
+                                    f.x += force[i].x;
+                                    f.y += force[i].y;
+                                    f.z += force[i].z;
+                                    f.w += force[i].w;
+                                    }
+                                h_force.data[i] = f;
+                                }
+
+                            if (compute_virial)
+                                {
+                                for (unsigned int k = 0; k < 6; k++)
+                                    for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                        {
+                                        Scalar v(0.0);
+                                        for (const auto& virial : thread_virial)
+                                            v += virial[k * size_t(n_all) + i];
+                                        h_virial.data[k * m_virial_pitch + i] = v;
+                                        }
+                                }
+                        });
+                });
+            }
+        else
+#endif
+            {
+            compute_particles(0, N, h_force.data, h_virial.data, m_virial_pitch);
+            }
         }
     }
 
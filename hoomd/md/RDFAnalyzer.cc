@@ -0,0 +1,217 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RDFAnalyzer.cc
+    \brief Defines the RDFAnalyzer class
+*/
+
+#include "RDFAnalyzer.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <pybind11/numpy.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to sample
+    \param nlist Neighbor list to take the pairs from
+    \param r_max Maximum pair distance
+    \param bins Number of bins between 0 and r_max
+*/
+RDFAnalyzer::RDFAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<Trigger> trigger,
+                         std::shared_ptr<NeighborList> nlist,
+                         Scalar r_max,
+                         unsigned int bins)
+    : Analyzer(sysdef, trigger), m_nlist(nlist),
+      m_r_cut_request(nlist, m_exec_conf, m_pdata->getNTypes(), r_max, "RDF"), m_r_max(r_max),
+      m_bins(bins)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing RDFAnalyzer" << endl;
+    assert(m_nlist);
+
+    if (m_bins == 0)
+        {
+        throw std::invalid_argument("RDF bins must be positive.");
+        }
+
+    m_histogram.resize(m_bins, 0.0);
+    }
+
+RDFAnalyzer::~RDFAnalyzer()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying RDFAnalyzer" << endl;
+    }
+
+/*! \param r_max Maximum pair distance
+ */
+void RDFAnalyzer::setRMax(Scalar r_max)
+    {
+    m_r_cut_request.setRCut(r_max);
+    m_r_max = r_max;
+    reset();
+    }
+
+/*! \param bins Number of bins
+ */
+void RDFAnalyzer::setBins(unsigned int bins)
+    {
+    if (bins == 0)
+        {
+        throw std::invalid_argument("RDF bins must be positive.");
+        }
+
+    m_bins = bins;
+    reset();
+    }
+
+void RDFAnalyzer::reset()
+    {
+    m_histogram.assign(m_bins, 0.0);
+    m_num_samples = 0;
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Count every ordered pair (i, j) with a local particle i once. A half neighbor list stores a
+    pair of local particles only once, so it counts twice. A pair with a ghost is stored on each
+    of the two ranks that own one of its particles, so it counts once on each.
+*/
+void RDFAnalyzer::analyze(uint64_t timestep)
+    {
+    Analyzer::analyze(timestep);
+
+    const uint64_t N_global = m_pdata->getNGlobal();
+    if (N_global < 2)
+        {
+        return;
+        }
+
+    // the neighbor list includes a buffer, so an update is only needed when particles moved far
+    m_nlist->compute(timestep);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int N = m_pdata->getN();
+    const bool half_nlist = m_nlist->getStorageMode() == NeighborList::half;
+    const Scalar r_maxsq = m_r_max * m_r_max;
+    const Scalar bins_per_length = Scalar(m_bins) / m_r_max;
+
+    std::vector<uint64_t> counts(m_bins, 0);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const size_t head_i = h_head_list.data[i];
+        const unsigned int n_neigh = h_n_neigh.data[i];
+
+        for (unsigned int k = 0; k < n_neigh; k++)
+            {
+            const unsigned int j = h_nlist.data[head_i + k];
+            const Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            const Scalar3 dx = box.minImage(pi - pj);
+            const Scalar rsq = dot(dx, dx);
+
+            if (rsq < r_maxsq)
+                {
+                unsigned int bin = (unsigned int)(slow::sqrt(rsq) * bins_per_length);
+                if (bin >= m_bins)
+                    {
+                    bin = m_bins - 1;
+                    }
+                counts[bin] += (half_nlist && j < N) ? 2 : 1;
+                }
+            }
+        }
+
+    // normalize by the ideal gas pair density of this sample
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const double volume = m_pdata->getGlobalBox().getVolume(two_d);
+    const double norm = volume / (double(N_global) * double(N_global - 1));
+    for (unsigned int bin = 0; bin < m_bins; bin++)
+        {
+        m_histogram[bin] += double(counts[bin]) * norm;
+        }
+    m_num_samples++;
+    }
+
+/*! \returns g(r) in each bin as a numpy array on the root rank, None on the other ranks
+ */
+pybind11::object RDFAnalyzer::getRDF()
+    {
+    std::vector<double> histogram(m_histogram);
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Reduce(m_histogram.data(),
+                   histogram.data(),
+                   (unsigned int)m_histogram.size(),
+                   MPI_DOUBLE,
+                   MPI_SUM,
+                   0,
+                   m_exec_conf->getMPICommunicator());
+        }
+
+    if (!m_exec_conf->isRoot())
+        return pybind11::none();
+#endif
+
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const double dr = double(m_r_max) / m_bins;
+    std::vector<double> rdf(m_bins, 0.0);
+    if (m_num_samples > 0)
+        {
+        for (unsigned int bin = 0; bin < m_bins; bin++)
+            {
+            const double r_low = bin * dr;
+            const double r_high = (bin + 1) * dr;
+            const double shell
+                = two_d ? M_PI * (r_high * r_high - r_low * r_low)
+                        : 4.0 / 3.0 * M_PI * (r_high * r_high * r_high - r_low * r_low * r_low);
+            rdf[bin] = histogram[bin] / (double(m_num_samples) * shell);
+            }
+        }
+
+    return pybind11::array_t<double>(rdf.size(), rdf.data());
+    }
+
+namespace detail
+    {
+void export_RDFAnalyzer(pybind11::module& m)
+    {
+    pybind11::class_<RDFAnalyzer, Analyzer, std::shared_ptr<RDFAnalyzer>>(m, "RDFAnalyzer")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<NeighborList>,
+                            Scalar,
+                            unsigned int>())
+        .def_property("r_max", &RDFAnalyzer::getRMax, &RDFAnalyzer::setRMax)
+        .def_property("bins", &RDFAnalyzer::getBins, &RDFAnalyzer::setBins)
+        .def_property_readonly("num_samples", &RDFAnalyzer::getNumSamples)
+        .def_property_readonly("rdf", &RDFAnalyzer::getRDF)
+        .def("reset", &RDFAnalyzer::reset);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
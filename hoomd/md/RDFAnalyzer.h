@@ -0,0 +1,113 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file RDFAnalyzer.h
+    \brief Declares an analyzer that accumulates the radial distribution function
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "NeighborList.h"
+#include "NeighborListRCutRequest.h"
+#include "hoomd/Analyzer.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Accumulates the time averaged radial distribution function from a neighbor list
+/** Each call to analyze() bins the distances between all pairs of particles in the neighbor list
+    that are closer than r_max. RDFAnalyzer adds r_max to the neighbor list's r_cut matrix for all
+    type pairs, so the list holds every such pair regardless of the r_cut of the pair potentials
+    that share it. Pairs that the neighbor list excludes (e.g. bonded particles) are not counted.
+
+    Every sample is normalized by the ideal gas pair density N (N - 1) / V of that step, so the
+    accumulated histogram averages correctly over steps with changing volume. getRDF() divides by
+    the number of samples and the volume of each shell to obtain g(r).
+
+    The histogram is accumulated on the host from the neighbor list arrays. In MPI simulations,
+    each rank bins the pairs of its local particles and getRDF() sums the histograms on the root
+    rank.
+*/
+class PYBIND11_EXPORT RDFAnalyzer : public Analyzer
+    {
+    public:
+    /// Constructor
+    RDFAnalyzer(std::shared_ptr<SystemDefinition> sysdef,
+                std::shared_ptr<Trigger> trigger,
+                std::shared_ptr<NeighborList> nlist,
+                Scalar r_max,
+                unsigned int bins);
+
+    /// Destructor
+    virtual ~RDFAnalyzer();
+
+    /// Bin the pair distances of the current configuration
+    virtual void analyze(uint64_t timestep);
+
+    /// Get the maximum pair distance
+    Scalar getRMax() const
+        {
+        return m_r_max;
+        }
+
+    /// Set the maximum pair distance and discard the accumulated samples
+    void setRMax(Scalar r_max);
+
+    /// Get the number of bins
+    unsigned int getBins() const
+        {
+        return m_bins;
+        }
+
+    /// Set the number of bins and discard the accumulated samples
+    void setBins(unsigned int bins);
+
+    /// Get the number of accumulated samples
+    uint64_t getNumSamples() const
+        {
+        return m_num_samples;
+        }
+
+    /// Discard the accumulated samples
+    void reset();
+
+    /// Get the time averaged radial distribution function
+    pybind11::object getRDF();
+
+    /// Remove the r_cut matrix from the neighbor list
+    virtual void notifyDetach()
+        {
+        m_r_cut_request.detach();
+        }
+
+    private:
+    /// Neighbor list to take the pairs from
+    std::shared_ptr<NeighborList> m_nlist;
+
+    /// r_max for every type pair, registered with the neighbor list
+    NeighborListRCutRequest m_r_cut_request;
+
+    /// Maximum pair distance
+    Scalar m_r_max;
+
+    /// Number of bins
+    unsigned int m_bins;
+
+    /// Sum over samples of the normalized pair counts in each bin
+    std::vector<double> m_histogram;
+
+    /// Number of accumulated samples
+    uint64_t m_num_samples = 0;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
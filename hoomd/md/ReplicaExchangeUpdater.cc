@@ -0,0 +1,228 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ReplicaExchangeUpdater.cc
+    \brief Defines the ReplicaExchangeUpdater class
+*/
+
+#include "ReplicaExchangeUpdater.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to attempt swaps
+    \param replica_kT Temperature set point of this partition, updated after each swap
+    \param kT Temperatures of the replicas, one per partition
+*/
+ReplicaExchangeUpdater::ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger,
+                                               std::shared_ptr<VariantConstant> replica_kT,
+                                               const std::vector<Scalar>& kT)
+    : Updater(sysdef, trigger), m_replica_kT(replica_kT), m_kT(kT)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ReplicaExchangeUpdater" << endl;
+    assert(m_replica_kT);
+
+    auto mpi_config = m_exec_conf->getMPIConfig();
+    if (m_kT.size() != mpi_config->getNPartitions())
+        {
+        throw std::runtime_error("ReplicaExchange needs one temperature per partition, "
+                                 "provide "
+                                 + std::to_string(mpi_config->getNPartitions())
+                                 + " temperatures.");
+        }
+
+    for (Scalar kT_value : m_kT)
+        {
+        if (!(kT_value > Scalar(0.0)))
+            {
+            throw std::runtime_error("ReplicaExchange temperatures must be positive.");
+            }
+        }
+
+    m_partition = mpi_config->getPartition();
+    m_slot_of_partition.resize(m_kT.size());
+    m_partition_of_slot.resize(m_kT.size());
+    for (unsigned int i = 0; i < m_kT.size(); i++)
+        {
+        m_slot_of_partition[i] = i;
+        m_partition_of_slot[i] = i;
+        }
+
+    // all partitions must draw the same random numbers to reach the same decisions
+    m_seed = m_sysdef->getSeed();
+#ifdef ENABLE_MPI
+    MPI_Bcast(&m_seed, 1, MPI_UINT16_T, 0, m_exec_conf->getHOOMDWorldMPICommunicator());
+#endif
+
+    m_replica_kT->setValue(m_kT[m_partition]);
+    }
+
+ReplicaExchangeUpdater::~ReplicaExchangeUpdater()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ReplicaExchangeUpdater" << endl;
+    }
+
+/*! \returns The potential energy of the particles in this partition
+
+    Sum the energies in the net force array, which the integrator computed at the current positions
+    at the end of the previous step. Like ComputeThermo, skip the constituent particles of rigid
+    bodies.
+*/
+Scalar ReplicaExchangeUpdater::computePotentialEnergy()
+    {
+    ArrayHandle<Scalar4> h_net_force(m_pdata->getNetForce(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    double energy = 0.0;
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        if (h_body.data[i] >= MIN_FLOPPY || h_body.data[i] == h_tag.data[i])
+            {
+            energy += double(h_net_force.data[i].w);
+            }
+        }
+
+    energy += m_pdata->getExternalEnergy();
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &energy,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return Scalar(energy);
+    }
+
+/*! \param factor Scale factor to apply
+ */
+void ReplicaExchangeUpdater::rescaleMomenta(Scalar factor)
+    {
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                  access_location::host,
+                                  access_mode::readwrite);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        h_vel.data[i].x *= factor;
+        h_vel.data[i].y *= factor;
+        h_vel.data[i].z *= factor;
+
+        h_angmom.data[i].x *= factor;
+        h_angmom.data[i].y *= factor;
+        h_angmom.data[i].z *= factor;
+        h_angmom.data[i].w *= factor;
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void ReplicaExchangeUpdater::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    const unsigned int n_replicas = static_cast<unsigned int>(m_kT.size());
+    if (n_replicas < 2)
+        {
+        return;
+        }
+
+    // gather the potential energy of every partition
+    std::vector<Scalar> energy(n_replicas);
+#ifdef ENABLE_MPI
+    auto mpi_config = m_exec_conf->getMPIConfig();
+    const unsigned int n_ranks = mpi_config->getNRanks();
+    Scalar local_energy = computePotentialEnergy();
+    std::vector<Scalar> rank_energy(size_t(n_ranks) * n_replicas);
+    MPI_Allgather(&local_energy,
+                  1,
+                  MPI_HOOMD_SCALAR,
+                  rank_energy.data(),
+                  1,
+                  MPI_HOOMD_SCALAR,
+                  m_exec_conf->getHOOMDWorldMPICommunicator());
+    for (unsigned int p = 0; p < n_replicas; p++)
+        {
+        energy[p] = rank_energy[size_t(p) * n_ranks];
+        }
+#endif
+
+    const unsigned int old_slot = m_slot_of_partition[m_partition];
+
+    for (unsigned int s = m_odd ? 1 : 0; s + 1 < n_replicas; s += 2)
+        {
+        const unsigned int a = m_partition_of_slot[s];
+        const unsigned int b = m_partition_of_slot[s + 1];
+        const Scalar delta
+            = (Scalar(1.0) / m_kT[s] - Scalar(1.0) / m_kT[s + 1]) * (energy[a] - energy[b]);
+
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::UpdaterReplicaExchange, timestep, m_seed),
+            hoomd::Counter(s));
+
+        m_n_attempted++;
+        if (delta >= Scalar(0.0) || hoomd::detail::generate_canonical<Scalar>(rng) < exp(delta))
+            {
+            m_n_accepted++;
+            m_partition_of_slot[s] = b;
+            m_partition_of_slot[s + 1] = a;
+            m_slot_of_partition[a] = s + 1;
+            m_slot_of_partition[b] = s;
+            }
+        }
+    m_odd = !m_odd;
+
+    const unsigned int new_slot = m_slot_of_partition[m_partition];
+    if (new_slot != old_slot)
+        {
+        rescaleMomenta(slow::sqrt(m_kT[new_slot] / m_kT[old_slot]));
+        m_replica_kT->setValue(m_kT[new_slot]);
+        }
+    }
+
+namespace detail
+    {
+void export_ReplicaExchangeUpdater(pybind11::module& m)
+    {
+    pybind11::class_<ReplicaExchangeUpdater, Updater, std::shared_ptr<ReplicaExchangeUpdater>>(
+        m,
+        "ReplicaExchangeUpdater")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            std::shared_ptr<VariantConstant>,
+                            const std::vector<Scalar>&>())
+        .def_property_readonly("kT", &ReplicaExchangeUpdater::getKT)
+        .def_property_readonly("replica_index", &ReplicaExchangeUpdater::getReplicaIndex)
+        .def_property_readonly("num_swaps_accepted", &ReplicaExchangeUpdater::getNumSwapsAccepted)
+        .def_property_readonly("num_swaps_attempted",
+                               &ReplicaExchangeUpdater::getNumSwapsAttempted);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,117 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ReplicaExchangeUpdater.h
+    \brief Declares an updater that exchanges temperatures between partitions
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "hoomd/Updater.h"
+#include "hoomd/Variant.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Exchanges temperatures between replicas that run in separate partitions
+/** Each partition simulates one replica of the system. The replicas hold the temperatures in m_kT,
+    one per partition, and ReplicaExchangeUpdater swaps them between partitions that hold
+    neighboring temperatures with the parallel tempering acceptance criterion:
+
+        P = min(1, exp((1/kT_s - 1/kT_{s+1}) (U_a - U_b)))
+
+    where U_a is the potential energy of the replica at temperature kT_s and U_b that of the replica
+    at kT_{s+1}. Attempts alternate between the even and the odd pairs of neighboring temperatures.
+
+    Only the potential energies travel between partitions: one MPI_Allgather of a single value per
+    rank per attempt. Every rank draws the same random numbers from the seed of the first partition,
+    so all ranks reach the same decisions without further communication. The particle data never
+    leaves its partition. Instead, the updater sets the new temperature in m_replica_kT, which the
+    integration methods of this partition take as their temperature set point, and rescales the
+    velocities and angular momenta by sqrt(kT_new / kT_old).
+*/
+class PYBIND11_EXPORT ReplicaExchangeUpdater : public Updater
+    {
+    public:
+    /// Constructor
+    ReplicaExchangeUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger,
+                           std::shared_ptr<VariantConstant> replica_kT,
+                           const std::vector<Scalar>& kT);
+
+    /// Destructor
+    virtual ~ReplicaExchangeUpdater();
+
+    /// Get the temperatures of the replicas
+    const std::vector<Scalar>& getKT() const
+        {
+        return m_kT;
+        }
+
+    /// Get the index in getKT() of the temperature this partition holds
+    unsigned int getReplicaIndex() const
+        {
+        return m_slot_of_partition[m_partition];
+        }
+
+    /// Get the number of accepted swaps
+    uint64_t getNumSwapsAccepted() const
+        {
+        return m_n_accepted;
+        }
+
+    /// Get the number of attempted swaps
+    uint64_t getNumSwapsAttempted() const
+        {
+        return m_n_attempted;
+        }
+
+    /// Attempt to swap temperatures between partitions
+    virtual void update(uint64_t timestep);
+
+    private:
+    /// Compute the potential energy of this partition's replica
+    Scalar computePotentialEnergy();
+
+    /// Rescale the velocities and angular momenta of this partition's particles
+    void rescaleMomenta(Scalar factor);
+
+    /// Temperature set point of this partition, shared with the integration methods
+    std::shared_ptr<VariantConstant> m_replica_kT;
+
+    /// Temperatures of the replicas
+    std::vector<Scalar> m_kT;
+
+    /// Index of this partition
+    unsigned int m_partition = 0;
+
+    /// Index of the temperature held by each partition
+    std::vector<unsigned int> m_slot_of_partition;
+
+    /// Index of the partition that holds each temperature
+    std::vector<unsigned int> m_partition_of_slot;
+
+    /// Seed shared by all partitions
+    uint16_t m_seed = 0;
+
+    /// Attempt to swap the odd pairs of neighboring temperatures next
+    bool m_odd = false;
+
+    /// Number of accepted swaps
+    uint64_t m_n_accepted = 0;
+
+    /// Number of attempted swaps
+    uint64_t m_n_attempted = 0;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
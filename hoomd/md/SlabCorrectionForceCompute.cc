@@ -0,0 +1,120 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "SlabCorrectionForceCompute.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <string.h>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \file SlabCorrectionForceCompute.cc
+    \brief Contains code for the SlabCorrectionForceCompute class
+*/
+
+/*! \param sysdef System to compute the correction for
+ */
+SlabCorrectionForceCompute::SlabCorrectionForceCompute(std::shared_ptr<SystemDefinition> sysdef)
+    : ForceCompute(sysdef)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing SlabCorrectionForceCompute" << endl;
+
+    if (m_sysdef->getNDimensions() == 2)
+        {
+        throw runtime_error("The slab correction is not valid in 2D simulations.");
+        }
+    }
+
+SlabCorrectionForceCompute::~SlabCorrectionForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying SlabCorrectionForceCompute" << endl;
+    }
+
+/*! \param timestep Current time step
+
+    The correction is a function of the net charge and dipole moment of the whole system, which are
+    summed over all ranks. It does not contribute to the virial.
+*/
+void SlabCorrectionForceCompute::computeForces(uint64_t timestep)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_torque(m_torque, access_location::host, access_mode::overwrite);
+
+    memset(h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset(h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+    memset(h_torque.data, 0, sizeof(Scalar4) * m_torque.getNumElements());
+
+    unsigned int N = m_pdata->getN();
+
+    // net charge and dipole moment along z, the per particle energies include the -Q q_i z_i^2 term
+    double sums[2] = {0.0, 0.0};
+    for (unsigned int i = 0; i < N; i++)
+        {
+        double q = h_charge.data[i];
+        double z = h_pos.data[i].z;
+        sums[0] += q;
+        sums[1] += q * z;
+        }
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      sums,
+                      2,
+                      MPI_DOUBLE,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    double Q = sums[0];
+    double M_z = sums[1];
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+    double V = box.getVolume();
+    double L_z = box.getL().z;
+    double prefactor = 2.0 * M_PI / V;
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        double q = h_charge.data[i];
+        double z = h_pos.data[i].z;
+
+        h_force.data[i].z = Scalar(-2.0 * prefactor * q * (M_z - Q * z));
+        h_force.data[i].w = Scalar(prefactor * q * z * (M_z - Q * z));
+        }
+
+    // the constant term of the non-neutral correction is not associated with any particle, store it
+    // as rank 0's contribution to the external energy
+    m_external_energy = Scalar(0.0);
+    if (m_exec_conf->getRank() == 0)
+        m_external_energy = Scalar(-prefactor * Q * Q * L_z * L_z / 12.0);
+    for (unsigned int k = 0; k < 6; k++)
+        m_external_virial[k] = Scalar(0.0);
+    }
+
+namespace detail
+    {
+void export_SlabCorrectionForceCompute(pybind11::module& m)
+    {
+    pybind11::class_<SlabCorrectionForceCompute,
+                     ForceCompute,
+                     std::shared_ptr<SlabCorrectionForceCompute>>(m, "SlabCorrectionForceCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,54 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/ForceCompute.h"
+#include "hoomd/HOOMDMath.h"
+#include <memory>
+
+/*! \file SlabCorrectionForceCompute.h
+    \brief Declares a class for computing the dipole correction for slab geometries
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __SLABCORRECTIONFORCECOMPUTE_H__
+#define __SLABCORRECTIONFORCECOMPUTE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Computes the Yeh-Berkowitz dipole correction for slab geometries
+/*! Fully periodic Ewald sums of a slab that is periodic in x and y and separated from its periodic
+    images in z by vacuum include a spurious interaction between the net dipole moments of the
+    images. SlabCorrectionForceCompute removes it:
+
+    \f[ U = \frac{2\pi}{V} \left( M_z^2 - Q \sum_i q_i z_i^2 - Q^2 \frac{L_z^2}{12} \right) \f]
+
+    where \f$ M_z = \sum_i q_i z_i \f$ is the net dipole moment along z and \f$ Q \f$ is the net
+    charge. The terms with \f$ Q \f$ correct non-neutral systems (Ballenegger, Arnold, and Cerda
+    2009).
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT SlabCorrectionForceCompute : public ForceCompute
+    {
+    public:
+    //! Constructs the compute
+    SlabCorrectionForceCompute(std::shared_ptr<SystemDefinition> sysdef);
+
+    //! Destructor
+    ~SlabCorrectionForceCompute();
+
+    protected:
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+#endif
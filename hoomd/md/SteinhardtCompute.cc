@@ -0,0 +1,295 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SteinhardtCompute.cc
+    \brief Defines the SteinhardtCompute class
+*/
+
+#include "SteinhardtCompute.h"
+
+#include <pybind11/numpy.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param nlist Neighbor list to take the bonds from
+    \param l Spherical harmonic degree
+    \param r_max Maximum bond length
+*/
+SteinhardtCompute::SteinhardtCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<NeighborList> nlist,
+                                     unsigned int l,
+                                     Scalar r_max)
+    : Compute(sysdef), m_nlist(nlist),
+      m_r_cut_request(nlist, m_exec_conf, m_pdata->getNTypes(), r_max, "Steinhardt"), m_l(0),
+      m_r_max(r_max), m_sums(steinhardt_max_l + 2, m_exec_conf)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing SteinhardtCompute" << endl;
+    assert(m_nlist);
+
+    setL(l);
+
+    GlobalArray<Scalar> particle_order(m_pdata->getMaxN(), m_exec_conf);
+    m_particle_order.swap(particle_order);
+    TAG_ALLOCATION(m_particle_order);
+
+    GlobalArray<unsigned int> num_neighbors(m_pdata->getMaxN(), m_exec_conf);
+    m_num_neighbors.swap(num_neighbors);
+    TAG_ALLOCATION(m_num_neighbors);
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        m_gather_tag_order = GatherTagOrder(m_exec_conf->getMPICommunicator());
+        }
+#endif
+    }
+
+SteinhardtCompute::~SteinhardtCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying SteinhardtCompute" << endl;
+    }
+
+/*! \param l Spherical harmonic degree
+ */
+void SteinhardtCompute::setL(unsigned int l)
+    {
+    if (l == 0 || l > steinhardt_max_l)
+        {
+        throw std::invalid_argument("Steinhardt l must be between 1 and "
+                                    + std::to_string(steinhardt_max_l) + ".");
+        }
+
+    m_l = l;
+    m_force_compute = true;
+    }
+
+/*! \param r_max Maximum bond length
+ */
+void SteinhardtCompute::setRMax(Scalar r_max)
+    {
+    m_r_cut_request.setRCut(r_max);
+    m_r_max = r_max;
+    m_force_compute = true;
+    }
+
+void SteinhardtCompute::resizeParticleArrays()
+    {
+    const unsigned int max_N = m_pdata->getMaxN();
+    if (m_particle_order.getNumElements() < max_N)
+        {
+        m_particle_order.resize(max_N);
+        m_num_neighbors.resize(max_N);
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void SteinhardtCompute::compute(uint64_t timestep)
+    {
+    Compute::compute(timestep);
+    if (!shouldCompute(timestep))
+        return;
+
+    // the neighbor list includes a buffer, so an update is only needed when particles moved far
+    m_nlist->compute(timestep);
+
+    resizeParticleArrays();
+    computeOrder();
+
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        ArrayHandle<Scalar2> h_sums(m_sums, access_location::host, access_mode::readwrite);
+        MPI_Allreduce(MPI_IN_PLACE,
+                      h_sums.data,
+                      2 * (m_l + 2),
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    }
+
+/*! A half neighbor list stores a bond between two local particles once. The bond vector from j to
+    i is the negative of the one from i to j, and Y_lm(-r) = (-1)^l Y_lm(r), so the bond adds to the
+    sums of j with the sign (-1)^l. A bond with a ghost adds only to the local particle, the rank
+    that owns the ghost counts it for its own particle.
+*/
+void SteinhardtCompute::computeOrder()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    ArrayHandle<Scalar> h_particle_order(m_particle_order,
+                                         access_location::host,
+                                         access_mode::overwrite);
+    ArrayHandle<unsigned int> h_num_neighbors(m_num_neighbors,
+                                              access_location::host,
+                                              access_mode::overwrite);
+    ArrayHandle<Scalar2> h_sums(m_sums, access_location::host, access_mode::overwrite);
+
+    const BoxDim box = m_pdata->getBox();
+    const unsigned int N = m_pdata->getN();
+    const bool half_nlist = m_nlist->getStorageMode() == NeighborList::half;
+    const Scalar r_maxsq = m_r_max * m_r_max;
+    const Scalar reverse_sign = (m_l % 2 == 0) ? Scalar(1.0) : Scalar(-1.0);
+    const unsigned int n_m = m_l + 1;
+
+    std::vector<Scalar2> qlm(size_t(N) * n_m, make_scalar2(0.0, 0.0));
+    std::fill(h_num_neighbors.data, h_num_neighbors.data + N, 0);
+
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+        const size_t head_i = h_head_list.data[i];
+        const unsigned int n_neigh = h_n_neigh.data[i];
+
+        for (unsigned int k = 0; k < n_neigh; k++)
+            {
+            const unsigned int j = h_nlist.data[head_i + k];
+            const Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+            const Scalar3 dx = box.minImage(pj - pi);
+            const Scalar rsq = dot(dx, dx);
+
+            if (rsq < r_maxsq && rsq > Scalar(0.0))
+                {
+                steinhardt_add_bond(m_l, dx, Scalar(1.0), &qlm[size_t(i) * n_m]);
+                h_num_neighbors.data[i]++;
+
+                if (half_nlist && j < N)
+                    {
+                    steinhardt_add_bond(m_l, dx, reverse_sign, &qlm[size_t(j) * n_m]);
+                    h_num_neighbors.data[j]++;
+                    }
+                }
+            }
+        }
+
+    std::fill(h_sums.data, h_sums.data + m_l + 2, make_scalar2(0.0, 0.0));
+    for (unsigned int i = 0; i < N; i++)
+        {
+        const Scalar2* S = &qlm[size_t(i) * n_m];
+        h_particle_order.data[i] = steinhardt_order(m_l, S, Scalar(h_num_neighbors.data[i]));
+
+        for (unsigned int m = 0; m < n_m; m++)
+            {
+            h_sums.data[m].x += S[m].x;
+            h_sums.data[m].y += S[m].y;
+            }
+        h_sums.data[n_m].x += Scalar(h_num_neighbors.data[i]);
+        }
+    }
+
+/*! \returns The global order parameter Q_l, the order parameter of the sum over all bonds
+ */
+Scalar SteinhardtCompute::getOrder()
+    {
+    ArrayHandle<Scalar2> h_sums(m_sums, access_location::host, access_mode::read);
+    return steinhardt_order(m_l, h_sums.data, h_sums.data[m_l + 1].x);
+    }
+
+/*! \param array Per-particle array indexed by the local particle index
+    \returns The values in tag order as a numpy array on the root rank, None on the other ranks
+*/
+template<class T>
+pybind11::object SteinhardtCompute::gatherParticleArray(const GlobalArray<T>& array)
+    {
+    bool root = true;
+#ifdef ENABLE_MPI
+    // if we are not the root processor, return None
+    root = m_exec_conf->isRoot();
+#endif
+
+    std::vector<size_t> dims(1);
+    if (root)
+        {
+        dims[0] = m_pdata->getNGlobal();
+        }
+    else
+        {
+        dims[0] = 0;
+        }
+    std::vector<T> global_values(dims[0]);
+
+    // sort the values by particle tag
+    const unsigned int N = m_pdata->getN();
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<T> h_array(array, access_location::host, access_mode::read);
+
+    std::vector<unsigned int> local_tag(h_tag.data, h_tag.data + N);
+    std::sort(local_tag.begin(), local_tag.end());
+    std::vector<T> local_values;
+    local_values.reserve(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        local_values.push_back(h_array.data[h_rtag.data[local_tag[i]]]);
+        }
+
+    if (m_sysdef->isDomainDecomposed())
+        {
+#ifdef ENABLE_MPI
+        m_gather_tag_order.setLocalTagsSorted(local_tag);
+        m_gather_tag_order.gatherArray(global_values, local_values);
+#endif
+        }
+    else
+        {
+        global_values = std::move(local_values);
+        }
+
+    if (root)
+        {
+        return pybind11::array(dims, global_values.data());
+        }
+    return pybind11::none();
+    }
+
+pybind11::object SteinhardtCompute::getParticleOrderPython()
+    {
+    return gatherParticleArray(m_particle_order);
+    }
+
+pybind11::object SteinhardtCompute::getNumNeighborsPython()
+    {
+    return gatherParticleArray(m_num_neighbors);
+    }
+
+namespace detail
+    {
+void export_SteinhardtCompute(pybind11::module& m)
+    {
+    pybind11::class_<SteinhardtCompute, Compute, std::shared_ptr<SteinhardtCompute>>(
+        m,
+        "SteinhardtCompute")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            unsigned int,
+                            Scalar>())
+        .def_property("l", &SteinhardtCompute::getL, &SteinhardtCompute::setL)
+        .def_property("r_max", &SteinhardtCompute::getRMax, &SteinhardtCompute::setRMax)
+        .def_property_readonly("order", &SteinhardtCompute::getOrder)
+        .def_property_readonly("particle_order", &SteinhardtCompute::getParticleOrderPython)
+        .def_property_readonly("num_neighbors", &SteinhardtCompute::getNumNeighborsPython);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,139 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SteinhardtCompute.h
+    \brief Declares a compute for the Steinhardt bond order parameters
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "NeighborList.h"
+#include "NeighborListRCutRequest.h"
+#include "SteinhardtComputeTypes.h"
+#include "hoomd/Compute.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Computes the Steinhardt bond order parameter q_l over a neighbor list
+/** The bonds of particle i are all pairs (i, j) in the neighbor list that are closer than r_max.
+    SteinhardtCompute adds r_max to the neighbor list's r_cut matrix for all type pairs, like
+    RDFAnalyzer. For each particle, compute() evaluates
+
+        q_l(i) = sqrt(4 pi / (2l + 1) sum_m |q_lm(i)|^2), q_lm(i) = 1/N_b(i) sum_j Y_lm(r_ij)
+
+    and the number of bonds N_b(i), which measures the local density. The global order parameter
+    Q_l uses the same expression with Q_lm = sum_i N_b(i) q_lm(i) / sum_i N_b(i), the average
+    over all bonds in the system.
+
+    The CPU implementation accepts half and full neighbor lists. The GPU implementation requires a
+    full neighbor list and reduces the global sums on the device.
+*/
+class PYBIND11_EXPORT SteinhardtCompute : public Compute
+    {
+    public:
+    /// Constructor
+    SteinhardtCompute(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<NeighborList> nlist,
+                      unsigned int l,
+                      Scalar r_max);
+
+    /// Destructor
+    virtual ~SteinhardtCompute();
+
+    /// Compute the order parameters of the current configuration
+    virtual void compute(uint64_t timestep);
+
+    /// Get the spherical harmonic degree
+    unsigned int getL() const
+        {
+        return m_l;
+        }
+
+    /// Set the spherical harmonic degree
+    void setL(unsigned int l);
+
+    /// Get the maximum bond length
+    Scalar getRMax() const
+        {
+        return m_r_max;
+        }
+
+    /// Set the maximum bond length
+    void setRMax(Scalar r_max);
+
+    /// Get the global order parameter Q_l computed by the last call to compute()
+    Scalar getOrder();
+
+    /// Get q_l of each particle in tag order
+    pybind11::object getParticleOrderPython();
+
+    /// Get the number of bonds of each particle in tag order
+    pybind11::object getNumNeighborsPython();
+
+    /// Remove the r_cut matrix from the neighbor list
+    virtual void notifyDetach()
+        {
+        m_r_cut_request.detach();
+        }
+
+    protected:
+    /// Neighbor list to take the bonds from
+    std::shared_ptr<NeighborList> m_nlist;
+
+    /// r_max for every type pair, registered with the neighbor list
+    NeighborListRCutRequest m_r_cut_request;
+
+    /// Spherical harmonic degree
+    unsigned int m_l;
+
+    /// Maximum bond length
+    Scalar m_r_max;
+
+    /// q_l of each local particle
+    GlobalArray<Scalar> m_particle_order;
+
+    /// Number of bonds of each local particle
+    GlobalArray<unsigned int> m_num_neighbors;
+
+    /// Sums over all bonds of the ranks: S_m for m = 0 .. l, followed by the number of bonds in .x
+    GPUArray<Scalar2> m_sums;
+
+    /// Compute the per-particle order parameters and the local sums in m_sums
+    virtual void computeOrder();
+
+    /// Resize the per-particle arrays to hold all local particles
+    void resizeParticleArrays();
+
+    private:
+#ifdef ENABLE_MPI
+    /// Helper class to gather the per-particle values
+    GatherTagOrder m_gather_tag_order;
+#endif
+
+    /// Gather a per-particle array in tag order on the root rank
+    template<class T> pybind11::object gatherParticleArray(const GlobalArray<T>& array);
+    };
+
+namespace detail
+    {
+/// Export SteinhardtCompute to python
+void export_SteinhardtCompute(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
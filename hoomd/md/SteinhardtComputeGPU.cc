@@ -0,0 +1,120 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SteinhardtComputeGPU.cc
+    \brief Defines the SteinhardtComputeGPU class
+*/
+
+#include "SteinhardtComputeGPU.h"
+#include "SteinhardtComputeGPU.cuh"
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param nlist Neighbor list to take the bonds from
+    \param l Spherical harmonic degree
+    \param r_max Maximum bond length
+*/
+SteinhardtComputeGPU::SteinhardtComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                           std::shared_ptr<NeighborList> nlist,
+                                           unsigned int l,
+                                           Scalar r_max)
+    : SteinhardtCompute(sysdef, nlist, l, r_max)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error(
+            "Creating a SteinhardtComputeGPU with no GPU in the execution configuration");
+        }
+
+    GlobalArray<Scalar2> qlm(m_pdata->getMaxN(), steinhardt_max_l + 2, m_exec_conf);
+    m_qlm.swap(qlm);
+    TAG_ALLOCATION(m_qlm);
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "steinhardt"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+void SteinhardtComputeGPU::computeOrder()
+    {
+    if (m_nlist->getStorageMode() != NeighborList::full)
+        {
+        throw std::runtime_error("SteinhardtComputeGPU requires a full neighbor list.");
+        }
+
+    if (m_qlm.getPitch() < m_pdata->getMaxN())
+        {
+        m_qlm.resize(m_pdata->getMaxN(), steinhardt_max_l + 2);
+        }
+
+    ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(), access_location::device, access_mode::read);
+    ArrayHandle<unsigned int> d_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::device,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> d_nlist(m_nlist->getNListArray(),
+                                      access_location::device,
+                                      access_mode::read);
+    ArrayHandle<size_t> d_head_list(m_nlist->getHeadList(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    ArrayHandle<Scalar> d_particle_order(m_particle_order,
+                                         access_location::device,
+                                         access_mode::overwrite);
+    ArrayHandle<unsigned int> d_num_neighbors(m_num_neighbors,
+                                              access_location::device,
+                                              access_mode::overwrite);
+    ArrayHandle<Scalar2> d_qlm(m_qlm, access_location::device, access_mode::overwrite);
+    ArrayHandle<Scalar2> d_sums(m_sums, access_location::device, access_mode::overwrite);
+
+    const unsigned int N = m_pdata->getN();
+    const size_t qlm_pitch = m_qlm.getPitch();
+
+    m_tuner->begin();
+    kernel::gpu_compute_steinhardt_particles(d_particle_order.data,
+                                             d_num_neighbors.data,
+                                             d_qlm.data,
+                                             qlm_pitch,
+                                             d_pos.data,
+                                             m_pdata->getBox(),
+                                             d_n_neigh.data,
+                                             d_nlist.data,
+                                             d_head_list.data,
+                                             N,
+                                             m_l,
+                                             m_r_max * m_r_max,
+                                             m_tuner->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner->end();
+
+    kernel::gpu_reduce_steinhardt_sums(d_sums.data, d_qlm.data, qlm_pitch, N, m_l);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    }
+
+namespace detail
+    {
+void export_SteinhardtComputeGPU(pybind11::module& m)
+    {
+    pybind11::class_<SteinhardtComputeGPU,
+                     SteinhardtCompute,
+                     std::shared_ptr<SteinhardtComputeGPU>>(m, "SteinhardtComputeGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<NeighborList>,
+                            unsigned int,
+                            Scalar>());
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
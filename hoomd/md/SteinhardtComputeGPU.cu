@@ -0,0 +1,223 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "SteinhardtComputeGPU.cuh"
+#include "SteinhardtComputeTypes.h"
+
+#include <assert.h>
+
+/*! \file SteinhardtComputeGPU.cu
+    \brief Defines GPU kernel code for the Steinhardt bond order parameters. Used by
+    SteinhardtComputeGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Block size of gpu_reduce_steinhardt_sums_kernel, a power of two
+const unsigned int steinhardt_reduce_block_size = 256;
+
+//! Kernel that computes the order parameters of each particle
+/*! \param d_particle_order q_l of each particle (output)
+    \param d_num_neighbors Number of bonds of each particle (output)
+    \param d_qlm Sums q_lm of each particle, row m of length \a qlm_pitch for m = 0 .. l, followed
+           by the number of bonds in row l + 1 (output)
+    \param qlm_pitch Pitch of the rows of \a d_qlm
+    \param d_pos Particle positions
+    \param box Local box
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Full neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param l Spherical harmonic degree
+    \param r_maxsq Square of the maximum bond length
+
+    One thread computes all bonds of one particle and keeps the sums in registers.
+*/
+__global__ void gpu_compute_steinhardt_particles_kernel(Scalar* d_particle_order,
+                                                        unsigned int* d_num_neighbors,
+                                                        Scalar2* d_qlm,
+                                                        const size_t qlm_pitch,
+                                                        const Scalar4* d_pos,
+                                                        const BoxDim box,
+                                                        const unsigned int* d_n_neigh,
+                                                        const unsigned int* d_nlist,
+                                                        const size_t* d_head_list,
+                                                        const unsigned int N,
+                                                        const unsigned int l,
+                                                        const Scalar r_maxsq)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N)
+        return;
+
+    Scalar2 S[steinhardt_max_l + 1];
+    for (unsigned int m = 0; m <= l; m++)
+        S[m] = make_scalar2(0.0, 0.0);
+
+    const Scalar4 postypei = __ldg(d_pos + i);
+    const Scalar3 pi = make_scalar3(postypei.x, postypei.y, postypei.z);
+    const size_t head_i = __ldg(d_head_list + i);
+    const unsigned int n_neigh = __ldg(d_n_neigh + i);
+    unsigned int n_bonds = 0;
+
+    for (unsigned int k = 0; k < n_neigh; k++)
+        {
+        const unsigned int j = __ldg(d_nlist + head_i + k);
+        const Scalar4 postypej = __ldg(d_pos + j);
+        const Scalar3 dx = box.minImage(make_scalar3(postypej.x, postypej.y, postypej.z) - pi);
+        const Scalar rsq = dot(dx, dx);
+
+        if (rsq < r_maxsq && rsq > Scalar(0.0))
+            {
+            steinhardt_add_bond(l, dx, Scalar(1.0), S);
+            n_bonds++;
+            }
+        }
+
+    d_particle_order[i] = steinhardt_order(l, S, Scalar(n_bonds));
+    d_num_neighbors[i] = n_bonds;
+    for (unsigned int m = 0; m <= l; m++)
+        d_qlm[m * qlm_pitch + i] = S[m];
+    d_qlm[(l + 1) * qlm_pitch + i] = make_scalar2(Scalar(n_bonds), 0.0);
+    }
+
+//! Kernel that sums the rows of d_qlm
+/*! \param d_sums Sum of each row (output)
+    \param d_qlm Per-particle values, one row per sum
+    \param qlm_pitch Pitch of the rows of \a d_qlm
+    \param N Number of local particles
+
+    One block reduces one row. Each thread first sums a strided subset of the row, then the block
+    reduces the partial sums in shared memory. The order of the additions does not depend on the
+    launch, so the result is deterministic.
+*/
+__global__ void gpu_reduce_steinhardt_sums_kernel(Scalar2* d_sums,
+                                                  const Scalar2* d_qlm,
+                                                  const size_t qlm_pitch,
+                                                  const unsigned int N)
+    {
+    __shared__ Scalar2 sdata[steinhardt_reduce_block_size];
+
+    const Scalar2* row = d_qlm + blockIdx.x * qlm_pitch;
+    Scalar2 sum = make_scalar2(0.0, 0.0);
+    for (unsigned int i = threadIdx.x; i < N; i += blockDim.x)
+        {
+        const Scalar2 v = row[i];
+        sum.x += v.x;
+        sum.y += v.y;
+        }
+    sdata[threadIdx.x] = sum;
+    __syncthreads();
+
+    for (unsigned int offs = blockDim.x / 2; offs > 0; offs >>= 1)
+        {
+        if (threadIdx.x < offs)
+            {
+            sdata[threadIdx.x].x += sdata[threadIdx.x + offs].x;
+            sdata[threadIdx.x].y += sdata[threadIdx.x + offs].y;
+            }
+        __syncthreads();
+        }
+
+    if (threadIdx.x == 0)
+        d_sums[blockIdx.x] = sdata[0];
+    }
+
+/*! \param d_particle_order q_l of each particle (output)
+    \param d_num_neighbors Number of bonds of each particle (output)
+    \param d_qlm Sums q_lm of each particle (output)
+    \param qlm_pitch Pitch of the rows of \a d_qlm
+    \param d_pos Particle positions
+    \param box Local box
+    \param d_n_neigh Number of neighbors of each particle
+    \param d_nlist Full neighbor list
+    \param d_head_list Index of the first neighbor of each particle in \a d_nlist
+    \param N Number of local particles
+    \param l Spherical harmonic degree
+    \param r_maxsq Square of the maximum bond length
+    \param block_size Block size to execute
+*/
+hipError_t gpu_compute_steinhardt_particles(Scalar* d_particle_order,
+                                            unsigned int* d_num_neighbors,
+                                            Scalar2* d_qlm,
+                                            const size_t qlm_pitch,
+                                            const Scalar4* d_pos,
+                                            const BoxDim& box,
+                                            const unsigned int* d_n_neigh,
+                                            const unsigned int* d_nlist,
+                                            const size_t* d_head_list,
+                                            const unsigned int N,
+                                            const unsigned int l,
+                                            const Scalar r_maxsq,
+                                            const unsigned int block_size)
+    {
+    assert(l <= steinhardt_max_l);
+
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_compute_steinhardt_particles_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid(N / run_block_size + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_compute_steinhardt_particles_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_particle_order,
+                       d_num_neighbors,
+                       d_qlm,
+                       qlm_pitch,
+                       d_pos,
+                       box,
+                       d_n_neigh,
+                       d_nlist,
+                       d_head_list,
+                       N,
+                       l,
+                       r_maxsq);
+
+    return hipSuccess;
+    }
+
+/*! \param d_sums Sums over all particles: q_lm for m = 0 .. l, followed by the number of bonds
+    \param d_qlm Per-particle values written by gpu_compute_steinhardt_particles()
+    \param qlm_pitch Pitch of the rows of \a d_qlm
+    \param N Number of local particles
+    \param l Spherical harmonic degree
+*/
+hipError_t gpu_reduce_steinhardt_sums(Scalar2* d_sums,
+                                      const Scalar2* d_qlm,
+                                      const size_t qlm_pitch,
+                                      const unsigned int N,
+                                      const unsigned int l)
+    {
+    dim3 grid(l + 2, 1, 1);
+    dim3 threads(steinhardt_reduce_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_reduce_steinhardt_sums_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_sums,
+                       d_qlm,
+                       qlm_pitch,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,48 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file SteinhardtComputeGPU.cuh
+    \brief Declares GPU kernel code for the Steinhardt bond order parameters. Used by
+    SteinhardtComputeGPU.
+*/
+
+#ifndef __STEINHARDT_COMPUTE_GPU_CUH__
+#define __STEINHARDT_COMPUTE_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Compute q_l, the number of bonds and the sums q_lm of each particle
+hipError_t gpu_compute_steinhardt_particles(Scalar* d_particle_order,
+                                            unsigned int* d_num_neighbors,
+                                            Scalar2* d_qlm,
+                                            const size_t qlm_pitch,
+                                            const Scalar4* d_pos,
+                                            const BoxDim& box,
+                                            const unsigned int* d_n_neigh,
+                                            const unsigned int* d_nlist,
+                                            const size_t* d_head_list,
+                                            const unsigned int N,
+                                            const unsigned int l,
+                                            const Scalar r_maxsq,
+                                            const unsigned int block_size);
+
+//! Sum the per-particle q_lm and bond counts over all particles
+hipError_t gpu_reduce_steinhardt_sums(Scalar2* d_sums,
+                                      const Scalar2* d_qlm,
+                                      const size_t qlm_pitch,
+                                      const unsigned int N,
+                                      const unsigned int l);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
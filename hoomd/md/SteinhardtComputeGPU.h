@@ -0,0 +1,58 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file SteinhardtComputeGPU.h
+    \brief Declares the GPU implementation of SteinhardtCompute
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "SteinhardtCompute.h"
+#include "hoomd/Autotuner.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Computes the Steinhardt bond order parameter q_l on the GPU
+/** SteinhardtComputeGPU requires a full neighbor list. One thread computes the bonds of one
+    particle and writes q_l, the number of bonds and the sums q_lm of the particle. A second kernel
+    reduces the q_lm and the bond counts over all particles, so only the l + 2 global sums are
+    copied to the host.
+*/
+class PYBIND11_EXPORT SteinhardtComputeGPU : public SteinhardtCompute
+    {
+    public:
+    /// Constructor
+    SteinhardtComputeGPU(std::shared_ptr<SystemDefinition> sysdef,
+                         std::shared_ptr<NeighborList> nlist,
+                         unsigned int l,
+                         Scalar r_max);
+
+    protected:
+    /// Per-particle sums q_lm, one row of pitch getMaxN() for each of m = 0 .. l and the bonds
+    GlobalArray<Scalar2> m_qlm;
+
+    /// Autotuner for the block size of the per-particle kernel
+    std::shared_ptr<Autotuner<1>> m_tuner;
+
+    /// Compute the per-particle order parameters and the local sums in m_sums
+    virtual void computeOrder();
+    };
+
+namespace detail
+    {
+/// Export SteinhardtComputeGPU to python
+void export_SteinhardtComputeGPU(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,109 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _STEINHARDT_COMPUTE_TYPES_H_
+#define _STEINHARDT_COMPUTE_TYPES_H_
+
+#include "hoomd/HOOMDMath.h"
+
+// HOSTDEVICE is __host__ __device__ when included in nvcc and blank when included into the host
+// compiler
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__
+#else
+#define HOSTDEVICE
+#endif
+
+/*! \file SteinhardtComputeTypes.h
+    \brief Bond order routines common to both CPU and GPU implementations of SteinhardtCompute
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Largest supported spherical harmonic degree
+const unsigned int steinhardt_max_l = 12;
+
+//! Add the spherical harmonics of one bond to the per-m sums
+/*! \param l Spherical harmonic degree
+    \param dx Bond vector
+    \param sign Factor applied to the contribution (-1 or 1)
+    \param S Sums for m = 0 .. l (real and imaginary part)
+
+    Up to the normalization and a sign that depends only on m, Y_lm(dx) is
+    p_l^m(z/r) ((x + i y) / r)^m, where p_l^m is the associated Legendre function without the
+    (1 - x^2)^(m/2) factor. p_l^m follows from the usual upward recurrence in l starting from
+    p_m^m = (2m - 1)!!. This avoids all trigonometric functions. steinhardt_order() applies the
+    normalization. Only m >= 0 is stored, since |q_l,-m| = |q_lm|.
+*/
+HOSTDEVICE inline void
+steinhardt_add_bond(unsigned int l, const Scalar3& dx, Scalar sign, Scalar2* S)
+    {
+    const Scalar rinv = fast::rsqrt(dot(dx, dx));
+    const Scalar c = dx.z * rinv;
+    const Scalar wx = dx.x * rinv;
+    const Scalar wy = dx.y * rinv;
+
+    // ((x + i y) / r)^m, times sign
+    Scalar ex = sign;
+    Scalar ey = Scalar(0.0);
+    // (2m - 1)!!
+    Scalar p_mm = Scalar(1.0);
+
+    for (unsigned int m = 0; m <= l; m++)
+        {
+        if (m > 0)
+            {
+            p_mm *= Scalar(2 * m - 1);
+            const Scalar ex_new = ex * wx - ey * wy;
+            ey = ex * wy + ey * wx;
+            ex = ex_new;
+            }
+
+        Scalar p_prev = Scalar(0.0);
+        Scalar p = p_mm;
+        for (unsigned int k = m + 1; k <= l; k++)
+            {
+            const Scalar p_next
+                = (Scalar(2 * k - 1) * c * p - Scalar(k + m - 1) * p_prev) / Scalar(k - m);
+            p_prev = p;
+            p = p_next;
+            }
+
+        S[m].x += p * ex;
+        S[m].y += p * ey;
+        }
+    }
+
+//! Compute the bond order parameter q_l from the sums of steinhardt_add_bond()
+/*! \param l Spherical harmonic degree
+    \param S Sums for m = 0 .. l
+    \param n_bonds Number of bonds in the sums
+
+    \returns q_l = sqrt(4 pi / (2l + 1) sum_m |q_lm|^2) with q_lm = S_m / n_bonds, or 0 when there
+    are no bonds
+*/
+HOSTDEVICE inline Scalar steinhardt_order(unsigned int l, const Scalar2* S, Scalar n_bonds)
+    {
+    if (n_bonds == Scalar(0.0))
+        return Scalar(0.0);
+
+    Scalar sum = Scalar(0.0);
+    for (unsigned int m = 0; m <= l; m++)
+        {
+        // 4 pi / (2l + 1) N_lm^2 = (l - m)! / (l + m)!
+        Scalar norm = (m == 0) ? Scalar(1.0) : Scalar(2.0);
+        for (unsigned int k = l - m + 1; k <= l + m; k++)
+            norm /= Scalar(k);
+
+        sum += norm * (S[m].x * S[m].x + S[m].y * S[m].y);
+        }
+
+    return slow::sqrt(sum) / n_bonds;
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
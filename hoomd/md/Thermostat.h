@@ -72,6 +72,37 @@ class Thermostat
     */
     virtual void advanceThermostat(uint64_t timestep, Scalar deltaT, bool aniso) { }
 
+    /** Advance the thermostat given the kinetic energy of the group.
+
+        Integration methods that sum the kinetic energy of the group in their own pass over the
+        particles call this method instead of advanceThermostat() when
+        advancesFromKineticEnergy() is true. This saves the separate pass over the particles in
+        ComputeThermo.
+
+        @param timestep Current simulation timestep.
+        @param deltaT Simulation step size.
+        @param aniso Set to true when the integration method is applied to rotational degrees of
+                     freedom.
+        @param translational_kinetic_energy Translational kinetic energy of the group summed over
+                                            all ranks.
+        @param rotational_kinetic_energy Rotational kinetic energy of the group summed over all
+                                         ranks.
+    */
+    virtual void advanceThermostatFromKineticEnergy(uint64_t timestep,
+                                                    Scalar deltaT,
+                                                    bool aniso,
+                                                    Scalar translational_kinetic_energy,
+                                                    Scalar rotational_kinetic_energy)
+        {
+        advanceThermostat(timestep, deltaT, aniso);
+        }
+
+    /// Returns true when advanceThermostat() needs only the kinetic energy of the group.
+    virtual bool advancesFromKineticEnergy() const
+        {
+        return false;
+        }
+
     /// Get the temperature variant.
     std::shared_ptr<Variant> getT()
         {
@@ -164,7 +195,26 @@ class MTTKThermostat : public Thermostat
         // compute the current thermodynamic properties
         m_thermo->compute(timestep);
 
-        Scalar curr_T_trans = m_thermo->getTranslationalTemperature();
+        advanceThermostatFromKineticEnergy(timestep,
+                                           deltaT,
+                                           aniso,
+                                           m_thermo->getTranslationalKineticEnergy(),
+                                           aniso ? m_thermo->getRotationalKineticEnergy()
+                                                 : Scalar(0.0));
+        }
+
+    void advanceThermostatFromKineticEnergy(uint64_t timestep,
+                                            Scalar deltaT,
+                                            bool aniso,
+                                            Scalar translational_kinetic_energy,
+                                            Scalar rotational_kinetic_energy) override
+        {
+        Scalar curr_T_trans = Scalar(0.0);
+        if (m_group->getTranslationalDOF() > 0)
+            {
+            curr_T_trans
+                = Scalar(2.0) / m_group->getTranslationalDOF() * translational_kinetic_energy;
+            }
         Scalar T = m_T->operator()(timestep);
 
         // update the state variables Xi and eta
@@ -179,7 +229,7 @@ class MTTKThermostat : public Thermostat
         if (aniso)
             {
             // update thermostat for rotational DOF
-            Scalar curr_ke_rot = m_thermo->getRotationalKineticEnergy();
+            Scalar curr_ke_rot = rotational_kinetic_energy;
             Scalar ndof_rot = m_group->getRotationalDOF();
 
             Scalar xi_prime_rot = m_state.xi_rot
@@ -193,6 +243,12 @@ class MTTKThermostat : public Thermostat
             }
         }
 
+    /// The MTTK update depends only on the kinetic energy.
+    bool advancesFromKineticEnergy() const override
+        {
+        return true;
+        }
+
     /** Get the thermostat's contribution to the total Hamiltonian of the system.
 
         @param timestep Current simulation timestep.
@@ -0,0 +1,288 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "TorchForceCompute.h"
+
+#include <stdexcept>
+
+#include <torch/csrc/autograd/autograd.h>
+#include <torch/cuda.h>
+
+namespace py = pybind11;
+
+using namespace std;
+
+/*! \file TorchForceCompute.cc
+    \brief Contains code for the TorchForceCompute class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace
+    {
+/// Torch data type of Scalar
+const torch::Dtype scalar_dtype = sizeof(Scalar) == 8 ? torch::kFloat64 : torch::kFloat32;
+
+/// Torch data type of size_t
+const torch::Dtype size_t_dtype = sizeof(size_t) == 8 ? torch::kInt64 : torch::kInt32;
+    } // end anonymous namespace
+
+/*! \param sysdef System to compute forces on
+    \param nlist Neighbor list to read the pairs from
+    \param filename TorchScript model file
+    \param r_cut Cutoff radius of the model
+*/
+TorchForceCompute::TorchForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                                     std::shared_ptr<NeighborList> nlist,
+                                     const std::string& filename,
+                                     Scalar r_cut)
+    : ForceCompute(sysdef), m_nlist(nlist), m_r_cut(r_cut), m_filename(filename),
+      m_device(torch::kCPU)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing TorchForceCompute" << endl;
+
+#ifdef ENABLE_HIP
+    if (m_exec_conf->isCUDAEnabled())
+        {
+        if (!torch::cuda::is_available())
+            {
+            throw runtime_error("libtorch was built without support for the GPU.");
+            }
+        m_device = torch::Device(torch::kCUDA,
+                                 static_cast<torch::DeviceIndex>(m_exec_conf->getGPUIds()[0]));
+        }
+#endif
+
+    try
+        {
+        m_model = torch::jit::load(m_filename, m_device);
+        }
+    catch (const c10::Error& e)
+        {
+        throw runtime_error("Error loading TorchScript model " + m_filename + ": " + e.what());
+        }
+    m_model.eval();
+
+    // the model computes energies of local particles from directed pairs
+    m_nlist->setStorageMode(NeighborList::full);
+
+    unsigned int n_types = m_pdata->getNTypes();
+    m_r_cut_nlist = std::make_shared<GlobalArray<Scalar>>(n_types * n_types, m_exec_conf);
+    nlist->addRCutMatrix(m_r_cut_nlist);
+    setRCut(r_cut);
+    }
+
+TorchForceCompute::~TorchForceCompute()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying TorchForceCompute" << endl;
+
+    if (m_attached)
+        {
+        m_nlist->removeRCutMatrix(m_r_cut_nlist);
+        }
+    }
+
+/*! \param r_cut Cutoff radius of the model, used for all type pairs
+ */
+void TorchForceCompute::setRCut(Scalar r_cut)
+    {
+    if (r_cut < 0)
+        {
+        throw runtime_error("r_cut must be non-negative.");
+        }
+    m_r_cut = r_cut;
+
+        {
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        for (unsigned int i = 0; i < m_r_cut_nlist->getNumElements(); i++)
+            {
+            h_r_cut_nlist.data[i] = r_cut;
+            }
+        }
+
+    m_nlist->notifyRCutMatrixChange();
+    }
+
+/*! The pairs are expanded from the full neighbor list with tensor operations on m_device: particle
+    i is repeated n_neigh[i] times and entry k of its neighbor list is read at head_list[i] + k.
+*/
+void TorchForceCompute::buildPairs()
+    {
+    const unsigned int N = m_pdata->getN();
+    const access_location::Enum location
+        = m_device.is_cuda() ? access_location::device : access_location::host;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(), location, access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(), location, access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(), location, access_mode::read);
+
+    auto options = torch::TensorOptions().device(m_device);
+    torch::Tensor n_neigh
+        = torch::from_blob(h_n_neigh.data, {N}, options.dtype(torch::kInt32)).to(torch::kInt64);
+    torch::Tensor head_list
+        = torch::from_blob(h_head_list.data, {N}, options.dtype(size_t_dtype)).to(torch::kInt64);
+    torch::Tensor nlist
+        = torch::from_blob(h_nlist.data,
+                           {static_cast<int64_t>(m_nlist->getNListArray().getNumElements())},
+                           options.dtype(torch::kInt32));
+
+    torch::Tensor i = torch::repeat_interleave(torch::arange(N, options.dtype(torch::kInt64)),
+                                               n_neigh);
+    torch::Tensor first = torch::cumsum(n_neigh, 0) - n_neigh;
+    torch::Tensor k = torch::arange(i.size(0), options.dtype(torch::kInt64))
+                      - torch::repeat_interleave(first, n_neigh);
+    torch::Tensor j = nlist.index_select(0, head_list.index_select(0, i) + k).to(torch::kInt64);
+
+    m_pairs = torch::stack({i, j}, 1);
+    }
+
+/*! \param timestep Current timestep
+ */
+void TorchForceCompute::computeForces(uint64_t timestep)
+    {
+    if (m_nlist->getStorageMode() != NeighborList::full)
+        {
+        throw runtime_error("TorchForceCompute requires a neighbor list in full storage mode.");
+        }
+
+    m_nlist->compute(timestep);
+
+    if (!m_pairs.defined() || m_nlist->getNumUpdates() != m_pairs_nlist_updates)
+        {
+        buildPairs();
+        m_pairs_nlist_updates = m_nlist->getNumUpdates();
+        }
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int N_total = N + m_pdata->getNGhosts();
+    const access_location::Enum location
+        = m_device.is_cuda() ? access_location::device : access_location::host;
+    const bool compute_virial = m_pdata->getFlags()[pdata_flag::pressure_tensor];
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), location, access_mode::read);
+    ArrayHandle<Scalar4> h_force(m_force, location, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, location, access_mode::overwrite);
+
+    auto options = torch::TensorOptions().device(m_device);
+
+    // read the positions and the types stored in the w component in place
+    const int64_t ints_per_scalar = sizeof(Scalar) / sizeof(int);
+    torch::Tensor postype = torch::from_blob(h_pos.data, {N_total, 4}, options.dtype(scalar_dtype));
+    torch::Tensor pos = postype.slice(1, 0, 3);
+    torch::Tensor types = torch::from_blob(h_pos.data,
+                                           {N_total, 4 * ints_per_scalar},
+                                           options.dtype(torch::kInt32))
+                              .select(1, 3 * ints_per_scalar)
+                              .to(torch::kInt64);
+
+    torch::Tensor i = m_pairs.select(1, 0);
+    torch::Tensor j = m_pairs.select(1, 1);
+
+    // apply the minimum image convention as BoxDim::minImage does
+    const BoxDim& box = m_pdata->getBox();
+    const Scalar3 L = box.getL();
+    const uchar3 periodic = box.getPeriodic();
+    torch::Tensor dr = pos.index_select(0, i) - pos.index_select(0, j);
+    torch::Tensor dx = dr.select(1, 0);
+    torch::Tensor dy = dr.select(1, 1);
+    torch::Tensor dz = dr.select(1, 2);
+    if (periodic.z)
+        {
+        torch::Tensor img = torch::round(dz / L.z);
+        dz -= L.z * img;
+        dy -= L.z * box.getTiltFactorYZ() * img;
+        dx -= L.z * box.getTiltFactorXZ() * img;
+        }
+    if (periodic.y)
+        {
+        torch::Tensor img = torch::round(dy / L.y);
+        dy -= L.y * img;
+        dx -= L.y * box.getTiltFactorXY() * img;
+        }
+    if (periodic.x)
+        {
+        dx -= L.x * torch::round(dx / L.x);
+        }
+    dr = dr.detach().requires_grad_(true);
+
+    torch::Tensor energy
+        = m_model.forward({types, m_pairs, dr, static_cast<int64_t>(N)}).toTensor();
+    if (energy.dim() != 1 || energy.size(0) != N)
+        {
+        throw runtime_error("The TorchScript model must return the energy of each local particle.");
+        }
+    torch::Tensor grad = torch::autograd::grad({energy.sum()}, {dr})[0];
+
+    // the pair term acts with -grad on i and +grad on j
+    dr = dr.detach();
+    torch::Tensor pair_force = -grad.detach().to(scalar_dtype);
+    torch::Tensor force = torch::zeros({N_total, 3}, options.dtype(scalar_dtype));
+    force.index_add_(0, i, pair_force);
+    force.index_add_(0, j, -pair_force);
+
+    torch::Tensor force_out
+        = torch::from_blob(h_force.data, {N_total, 4}, options.dtype(scalar_dtype));
+    force_out.slice(1, 0, 3).copy_(force);
+    force_out.select(1, 3).zero_();
+    force_out.slice(0, 0, N).select(1, 3).copy_(energy.detach().to(scalar_dtype));
+
+    torch::Tensor virial_out
+        = torch::from_blob(h_virial.data,
+                           {6, static_cast<int64_t>(m_virial_pitch)},
+                           options.dtype(scalar_dtype));
+    virial_out.zero_();
+    if (compute_virial)
+        {
+        // reverse communication only sends forces, so local particle i carries the pair virial
+        torch::Tensor pair_virial = torch::stack({dr.select(1, 0) * pair_force.select(1, 0),
+                                                  dr.select(1, 0) * pair_force.select(1, 1),
+                                                  dr.select(1, 0) * pair_force.select(1, 2),
+                                                  dr.select(1, 1) * pair_force.select(1, 1),
+                                                  dr.select(1, 1) * pair_force.select(1, 2),
+                                                  dr.select(1, 2) * pair_force.select(1, 2)},
+                                                 0);
+        virial_out.slice(1, 0, N).index_add_(1, i, pair_virial);
+        }
+    }
+
+#ifdef ENABLE_MPI
+/*! \param timestep Current time step
+ */
+CommFlags TorchForceCompute::getRequestedCommFlags(uint64_t timestep)
+    {
+    CommFlags flags = CommFlags(0);
+
+    flags |= ForceCompute::getRequestedCommFlags(timestep);
+
+    // enable reverse communication of forces
+    flags[comm_flag::reverse_net_force] = 1;
+
+    // reverse net force requires tags
+    flags[comm_flag::tag] = 1;
+
+    return flags;
+    }
+#endif
+
+namespace detail
+    {
+void export_TorchForceCompute(py::module& m)
+    {
+    py::class_<TorchForceCompute, ForceCompute, std::shared_ptr<TorchForceCompute>>(
+        m,
+        "TorchForceCompute")
+        .def(py::init<std::shared_ptr<SystemDefinition>,
+                      std::shared_ptr<NeighborList>,
+                      const std::string&,
+                      Scalar>())
+        .def_property("r_cut", &TorchForceCompute::getRCut, &TorchForceCompute::setRCut)
+        .def_property_readonly("filename", &TorchForceCompute::getFilename);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,143 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/ForceCompute.h"
+
+#include <memory>
+#include <string>
+
+#include <torch/script.h>
+
+/*! \file TorchForceCompute.h
+    \brief Declares a class for computing forces with a TorchScript model
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __TORCHFORCECOMPUTE_H__
+#define __TORCHFORCECOMPUTE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Computes forces with a machine learned potential in TorchScript
+/*! TorchForceCompute evaluates a TorchScript model in process with libtorch, on the GPU when
+    HOOMD executes on the GPU. The model maps the neighbor pairs of the local particles to the
+    potential energy of each local particle:
+
+    <code>energy = model(types, pairs, dr, n_local)</code>
+
+    - \a types (N_total,) int64: Type index of the local and ghost particles.
+    - \a pairs (N_pairs, 2) int64: Directed pairs (i, j) with local i, one for each entry of the
+      full neighbor list. Pairs of two local particles appear in both directions.
+    - \a dr (N_pairs, 3) Scalar: Minimum image displacement r_i - r_j.
+    - \a n_local int: Number of local particles.
+    - \a energy (n_local,): Potential energy of each local particle.
+
+    The force on each particle follows by differentiating the total energy with respect to \a dr.
+    The pair tensor is rebuilt on the device from the neighbor list arrays only when the neighbor
+    list changes, and the positions are read in place. Forces on ghost particles are sent back to
+    their owners by reverse net force communication. The virial of each pair is assigned to the
+    local particle i, so the total virial is exact.
+
+    The model must accept and return the floating point type of Scalar.
+*/
+class PYBIND11_EXPORT TorchForceCompute : public ForceCompute
+    {
+    public:
+    /// Constructs the compute
+    TorchForceCompute(std::shared_ptr<SystemDefinition> sysdef,
+                      std::shared_ptr<NeighborList> nlist,
+                      const std::string& filename,
+                      Scalar r_cut);
+
+    /// Destructor
+    virtual ~TorchForceCompute();
+
+    /// Set the cutoff radius of the model
+    void setRCut(Scalar r_cut);
+
+    /// Get the cutoff radius of the model
+    Scalar getRCut()
+        {
+        return m_r_cut;
+        }
+
+    /// Get the name of the model file
+    std::string getFilename()
+        {
+        return m_filename;
+        }
+
+    virtual void notifyDetach()
+        {
+        if (m_attached)
+            {
+            m_nlist->removeRCutMatrix(m_r_cut_nlist);
+            }
+        m_attached = false;
+        }
+
+#ifdef ENABLE_MPI
+    /// Get ghost particle fields requested by this force
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+#endif
+
+    /// Start autotuning kernel launch parameters
+    virtual void startAutotuning()
+        {
+        ForceCompute::startAutotuning();
+        m_nlist->startAutotuning();
+        }
+
+    /// Check if autotuning is complete.
+    virtual bool isAutotuningComplete()
+        {
+        bool result = ForceCompute::isAutotuningComplete();
+        return result && m_nlist->isAutotuningComplete();
+        }
+
+    protected:
+    /// Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+
+    /// Build the pair tensor from the neighbor list arrays
+    void buildPairs();
+
+    std::shared_ptr<NeighborList> m_nlist; //!< The neighbor list to use for the computation
+
+    /// Cutoff radius of the model
+    Scalar m_r_cut;
+
+    /// Cutoff radius matrix registered with the neighbor list
+    std::shared_ptr<GlobalArray<Scalar>> m_r_cut_nlist;
+
+    /// Name of the model file
+    std::string m_filename;
+
+    /// The TorchScript model
+    torch::jit::script::Module m_model;
+
+    /// Device to evaluate the model on
+    torch::Device m_device;
+
+    /// Directed neighbor pairs (i, j) on m_device
+    torch::Tensor m_pairs;
+
+    /// Number of neighbor list updates when m_pairs was built
+    uint64_t m_pairs_nlist_updates = 0;
+
+    /// Track whether we are attached to the simulation
+    bool m_attached = true;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -267,7 +267,15 @@ void TwoStepConstantPressure::integrateStepOne(uint64_t timestep)
     m_pdata->setGlobalBox(global_box);
     m_V = global_box.getVolume(is_two_dimensions); // volume
 
-    if (m_rescale_all)
+    // When the group holds all particles, rescale and wrap them in the same pass that advances
+    // them.
+    const bool fuse_all = group_size == m_pdata->getN();
+    const bool rescale_separately = m_rescale_all && !fuse_all;
+
+    // Get new local box
+    BoxDim box = m_pdata->getBox();
+
+    if (rescale_separately)
         {
         // rescale all particle positions
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
@@ -300,6 +308,9 @@ void TwoStepConstantPressure::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
                                    access_mode::readwrite);
+        ArrayHandle<int3> h_image(m_pdata->getImages(),
+                                  access_location::host,
+                                  access_mode::readwrite);
 
         // precompute loop invariant quantity
         for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
@@ -321,7 +332,7 @@ void TwoStepConstantPressure::integrateStepOne(uint64_t timestep)
             // apply thermostat update of velocity
             v *= rescaleFactors[0];
 
-            if (!m_rescale_all)
+            if (!rescale_separately)
                 {
                 r.x = m_mat_exp_r[0] * r.x + m_mat_exp_r[1] * r.y + m_mat_exp_r[2] * r.z;
                 r.y = m_mat_exp_r[3] * r.y + m_mat_exp_r[4] * r.z;
@@ -341,12 +352,13 @@ void TwoStepConstantPressure::integrateStepOne(uint64_t timestep)
             h_pos.data[j].x = r.x;
             h_pos.data[j].y = r.y;
             h_pos.data[j].z = r.z;
+
+            if (fuse_all)
+                box.wrap(h_pos.data[j], h_image.data[j]);
             }
         } // end of GPUArray scope
 
-    // Get new local box
-    BoxDim box = m_pdata->getBox();
-
+    if (!fuse_all)
         {
         ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                    access_location::host,
@@ -125,10 +125,14 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
     m_pdata->setGlobalBox(global_box);
     m_V = global_box.getVolume(twod); // volume
 
-    // update the propagator matrix
-    updatePropagator();
+    // When the group holds all particles, rescale and wrap them in the step one kernel.
+    const bool fuse_all = m_group->getNumMembers() == m_pdata->getN();
+    const bool rescale_separately = m_rescale_all && !fuse_all;
 
-    if (m_rescale_all)
+    // Get new (local) box lengths
+    BoxDim box = m_pdata->getBox();
+
+    if (rescale_separately)
         {
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
@@ -166,6 +170,9 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
                                    access_mode::readwrite);
+        ArrayHandle<int3> d_image(m_pdata->getImages(),
+                                  access_location::device,
+                                  access_mode::readwrite);
 
         ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                                 access_location::device,
@@ -185,7 +192,10 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
                                          m_mat_exp_r,
                                          m_mat_exp_r_int,
                                          m_deltaT,
-                                         m_rescale_all,
+                                         rescale_separately,
+                                         d_image.data,
+                                         box,
+                                         fuse_all,
                                          m_tuner_one->getParam()[0]);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
@@ -195,9 +205,7 @@ void TwoStepConstantPressureGPU::integrateStepOne(uint64_t timestep)
         m_exec_conf->endMultiGPU();
         } // end of GPUArray scope
 
-    // Get new (local) box lengths
-    BoxDim box = m_pdata->getBox();
-
+    if (!fuse_all)
         {
         ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
                                    access_location::device,
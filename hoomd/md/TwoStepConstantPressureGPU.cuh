@@ -33,6 +33,9 @@ hipError_t gpu_npt_rescale_step_one(Scalar4* d_pos,
                                     Scalar* mat_exp_r_int,
                                     Scalar deltaT,
                                     bool rescale_all,
+                                    int3* d_image,
+                                    const BoxDim& box,
+                                    bool wrap,
                                     const unsigned int block_size);
 
 //! Kernel driver for wrapping particles back in the box (part of first step)
@@ -4,6 +4,10 @@
 #include "TwoStepConstantVolume.h"
 #include "hoomd/VectorMath.h"
 
+#ifdef ENABLE_MPI
+#include "hoomd/HOOMDMPI.h"
+#endif
+
 void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
     {
     if (m_group->getNumMembersGlobal() == 0)
@@ -16,8 +20,20 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
     unsigned int group_size = m_group->getNumMembers();
 
+    // sum the kinetic energy for the thermostat in the integration loops, so that the thermostat
+    // does not need to compute it in a separate pass
+    const bool sum_kinetic_energy = m_thermostat && m_thermostat->advancesFromKineticEnergy();
+    double translational_kinetic_energy = 0.0;
+    double rotational_kinetic_energy = 0.0;
+
         // scope array handles for proper releasing before calling the thermo compute
         {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
         ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
                                    access_location::host,
                                    access_mode::readwrite);
@@ -61,6 +77,16 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
             h_pos.data[j].x = pos.x;
             h_pos.data[j].y = pos.y;
             h_pos.data[j].z = pos.z;
+
+            // ignore rigid body constituent particles in the sum, as ComputeThermo does
+            if (sum_kinetic_energy
+                && (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j]))
+                {
+                translational_kinetic_energy
+                    += (double)h_vel.data[j].w
+                       * ((double)v.x * (double)v.x + (double)v.y * (double)v.y
+                          + (double)v.z * (double)v.z);
+                }
             }
 
         // particles may have been moved slightly outside the box by the above steps, wrap them back
@@ -83,6 +109,12 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
     // time-reversal symmetric integration scheme of Miller et al., extended by thermostat
     if (m_aniso)
         {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> h_tag(m_pdata->getTags(),
+                                        access_location::host,
+                                        access_mode::read);
         ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                            access_location::host,
                                            access_mode::readwrite);
@@ -200,11 +232,54 @@ void hoomd::md::TwoStepConstantVolume::integrateStepOne(uint64_t timestep)
 
             h_orientation.data[j] = quat_to_scalar4(q);
             h_angmom.data[j] = quat_to_scalar4(p);
+
+            if (sum_kinetic_energy
+                && (h_body.data[j] >= MIN_FLOPPY || h_body.data[j] == h_tag.data[j]))
+                {
+                quat<Scalar> s(Scalar(0.5) * conj(q) * p);
+
+                // only if the moment of inertia along one principal axis is non-zero, that axis
+                // carries angular momentum
+                if (I.x > 0)
+                    {
+                    rotational_kinetic_energy += s.v.x * s.v.x / I.x;
+                    }
+                if (I.y > 0)
+                    {
+                    rotational_kinetic_energy += s.v.y * s.v.y / I.y;
+                    }
+                if (I.z > 0)
+                    {
+                    rotational_kinetic_energy += s.v.z * s.v.z / I.z;
+                    }
+                }
             }
         }
 
     // get temperature and advance thermostat
-    if (m_thermostat)
+    if (sum_kinetic_energy)
+        {
+#ifdef ENABLE_MPI
+        if (m_sysdef->isDomainDecomposed())
+            {
+            double kinetic_energy[2] = {translational_kinetic_energy, rotational_kinetic_energy};
+            MPI_Allreduce(MPI_IN_PLACE,
+                          kinetic_energy,
+                          2,
+                          MPI_DOUBLE,
+                          MPI_SUM,
+                          m_exec_conf->getMPICommunicator());
+            translational_kinetic_energy = kinetic_energy[0];
+            rotational_kinetic_energy = kinetic_energy[1];
+            }
+#endif
+        m_thermostat->advanceThermostatFromKineticEnergy(timestep,
+                                                         m_deltaT,
+                                                         m_aniso,
+                                                         Scalar(0.5 * translational_kinetic_energy),
+                                                         Scalar(0.5 * rotational_kinetic_energy));
+        }
+    else if (m_thermostat)
         {
         m_thermostat->advanceThermostat(timestep, m_deltaT, m_aniso);
         }
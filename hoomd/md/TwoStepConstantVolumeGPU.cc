@@ -147,9 +147,40 @@ void TwoStepConstantVolumeGPU::integrateStepOne(uint64_t timestep)
 
 void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
     {
-    unsigned int group_size = m_group->getNumMembers();
+    ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                      access_location::device,
+                                      access_mode::read);
+
+    stepTwo(timestep, d_net_force.data, d_net_torque.data, nullptr);
+    }
 
-    const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
+/*! \param timestep Current time step
+    \param net_force_sum Net force arrays and the forces to sum
+
+    The caller holds the net force arrays, so the step two kernels access them through
+    \a net_force_sum.
+*/
+bool TwoStepConstantVolumeGPU::integrateStepTwoSumNetForce(
+    uint64_t timestep,
+    const hoomd::kernel::gpu_net_force_sum& net_force_sum)
+    {
+    // the step two kernel visits only the members of the group
+    if (m_group->getNumMembers() != m_pdata->getN())
+        return false;
+
+    stepTwo(timestep, nullptr, net_force_sum.d_net_torque, &net_force_sum);
+    return true;
+    }
+
+void TwoStepConstantVolumeGPU::stepTwo(uint64_t timestep,
+                                       Scalar4* d_net_force,
+                                       Scalar4* d_net_torque,
+                                       const hoomd::kernel::gpu_net_force_sum* net_force_sum)
+    {
+    unsigned int group_size = m_group->getNumMembers();
 
     ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                             access_location::device,
@@ -165,21 +196,35 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
         ArrayHandle<Scalar3> d_accel(m_pdata->getAccelerations(),
                                      access_location::device,
                                      access_mode::readwrite);
-        ArrayHandle<Scalar4> d_net_force(net_force, access_location::device, access_mode::read);
 
         m_exec_conf->beginMultiGPU();
 
         // perform the update on the GPU
         m_tuner_two->begin();
-        kernel::gpu_nvt_rescale_step_two(d_vel.data,
-                                         d_accel.data,
-                                         d_index_array.data,
-                                         group_size,
-                                         d_net_force.data,
-                                         m_tuner_two->getParam()[0],
-                                         m_deltaT,
-                                         rescalingFactors[0],
-                                         m_group->getGPUPartition());
+        if (net_force_sum)
+            {
+            kernel::gpu_nvt_rescale_step_two_sum_net_force(d_vel.data,
+                                                           d_accel.data,
+                                                           d_index_array.data,
+                                                           group_size,
+                                                           *net_force_sum,
+                                                           m_tuner_two->getParam()[0],
+                                                           m_deltaT,
+                                                           rescalingFactors[0],
+                                                           m_group->getGPUPartition());
+            }
+        else
+            {
+            kernel::gpu_nvt_rescale_step_two(d_vel.data,
+                                             d_accel.data,
+                                             d_index_array.data,
+                                             group_size,
+                                             d_net_force,
+                                             m_tuner_two->getParam()[0],
+                                             m_deltaT,
+                                             rescalingFactors[0],
+                                             m_group->getGPUPartition());
+            }
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -197,9 +242,6 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
         ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
                                       access_location::device,
                                       access_mode::readwrite);
-        ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
-                                          access_location::device,
-                                          access_mode::read);
         ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
                                        access_location::device,
                                        access_mode::read);
@@ -209,7 +251,7 @@ void TwoStepConstantVolumeGPU::integrateStepTwo(uint64_t timestep)
         kernel::gpu_nve_angular_step_two(d_orientation.data,
                                          d_angmom.data,
                                          d_inertia.data,
-                                         d_net_torque.data,
+                                         d_net_torque,
                                          d_index_array.data,
                                          m_group->getGPUPartition(),
                                          m_deltaT,
@@ -259,6 +259,142 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
     return hipSuccess;
     }
 
+//! Sums the net force and takes the second 1/2 step forward in the NVT integration step
+/*! \param d_vel array of particle velocities
+    \param d_accel array of particle accelerations
+    \param d_group_members Device array listing the indices of the members of the group to integrate
+    \param work_size Number of members in the group for this GPU
+    \param net_force_sum Net force arrays and the forces to sum
+    \param deltaT Amount of real time to step forward in one time step
+    \param rescale_factor Exponential velocity scaling factor
+    \param offset The offset of this GPU into the list of particles
+
+    This kernel performs the same update as gpu_nvt_rescale_step_two_kernel(), but sums the net
+    force of each member instead of reading it. The group must contain all local particles.
+
+    \tparam compute_virial When set to 0, the virial sum is not computed
+*/
+template<unsigned int compute_virial>
+__global__ void
+gpu_nvt_rescale_step_two_sum_net_force_kernel(Scalar4* d_vel,
+                                              Scalar3* d_accel,
+                                              unsigned int* d_group_members,
+                                              unsigned int work_size,
+                                              const hoomd::kernel::gpu_net_force_sum net_force_sum,
+                                              Scalar deltaT,
+                                              Scalar rescale_factor,
+                                              unsigned int offset)
+    {
+    // determine which particle this thread works on
+    int group_idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (group_idx < work_size)
+        {
+        unsigned int idx = d_group_members[group_idx + offset];
+
+        // sum the net force and calculate the acceleration
+        Scalar4 net_force = hoomd::kernel::sum_net_force<compute_virial>(net_force_sum, idx);
+        Scalar3 accel = make_scalar3(net_force.x, net_force.y, net_force.z);
+
+        Scalar4 vel = d_vel[idx];
+        Scalar3 v = make_scalar3(vel.x, vel.y, vel.z);
+
+        Scalar mass = vel.w;
+        accel = accel / mass;
+
+        // rescale
+        v *= rescale_factor;
+
+        // update
+        v += Scalar(1.0 / 2.0) * deltaT * accel;
+
+        // write out data
+        d_vel[idx] = make_scalar4(v.x, v.y, v.z, vel.w);
+
+        // since we calculate the acceleration, we need to write it for the next step
+        d_accel[idx] = accel;
+        }
+    }
+
+/*! \param d_vel array of particle velocities
+    \param d_accel array of particle accelerations
+    \param d_group_members Device array listing the indices of the members of the group to integrate
+    \param group_size Number of members in the group
+    \param net_force_sum Net force arrays and the forces to sum
+    \param block_size Size of the block to execute on the device
+    \param deltaT Amount of real time to step forward in one time step
+    \param rescale_factor Exponential velocity scaling factor
+*/
+hipError_t
+gpu_nvt_rescale_step_two_sum_net_force(Scalar4* d_vel,
+                                       Scalar3* d_accel,
+                                       unsigned int* d_group_members,
+                                       unsigned int group_size,
+                                       const hoomd::kernel::gpu_net_force_sum& net_force_sum,
+                                       unsigned int block_size,
+                                       Scalar deltaT,
+                                       Scalar rescale_factor,
+                                       const GPUPartition& gpu_partition)
+    {
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    if (net_force_sum.compute_virial)
+        hipFuncGetAttributes(&attr, (const void*)gpu_nvt_rescale_step_two_sum_net_force_kernel<1>);
+    else
+        hipFuncGetAttributes(&attr, (const void*)gpu_nvt_rescale_step_two_sum_net_force_kernel<0>);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+
+    // iterate over active GPUs in reverse, to end up on first GPU when returning from this function
+    for (int idev = gpu_partition.getNumActiveGPUs() - 1; idev >= 0; --idev)
+        {
+        auto range = gpu_partition.getRangeAndSetGPU(idev);
+
+        unsigned int nwork = range.second - range.first;
+
+        // setup the grid to run the kernel
+        dim3 grid((nwork / run_block_size) + 1, 1, 1);
+        dim3 threads(run_block_size, 1, 1);
+
+        // run the kernel
+        if (net_force_sum.compute_virial)
+            {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_nvt_rescale_step_two_sum_net_force_kernel<1>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               0,
+                               d_vel,
+                               d_accel,
+                               d_group_members,
+                               nwork,
+                               net_force_sum,
+                               deltaT,
+                               rescale_factor,
+                               range.first);
+            }
+        else
+            {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_nvt_rescale_step_two_sum_net_force_kernel<0>),
+                               dim3(grid),
+                               dim3(threads),
+                               0,
+                               0,
+                               d_vel,
+                               d_accel,
+                               d_group_members,
+                               nwork,
+                               net_force_sum,
+                               deltaT,
+                               rescale_factor,
+                               range.first);
+            }
+        }
+
+    return hipSuccess;
+    }
+
     } // end namespace kernel
     } // end namespace md
     } // end namespace hoomd
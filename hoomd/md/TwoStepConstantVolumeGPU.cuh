@@ -3,6 +3,7 @@
 
 #include "hoomd/GPUPartition.cuh"
 #include "hoomd/HOOMDMath.h"
+#include "hoomd/Integrator.cuh"
 #include "hoomd/ParticleData.cuh"
 
 #ifndef HOOMD_TWOSTEPNVTBASEGPU_CUH
@@ -40,6 +41,18 @@ hipError_t gpu_nvt_rescale_step_two(Scalar4* d_vel,
                                     Scalar rescale_factor,
                                     const GPUPartition& gpu_partition);
 
+//! Kernel driver for the second part of the NVT update that also sums the net force
+hipError_t
+gpu_nvt_rescale_step_two_sum_net_force(Scalar4* d_vel,
+                                       Scalar3* d_accel,
+                                       unsigned int* d_group_members,
+                                       unsigned int group_size,
+                                       const hoomd::kernel::gpu_net_force_sum& net_force_sum,
+                                       unsigned int block_size,
+                                       Scalar deltaT,
+                                       Scalar rescale_factor,
+                                       const GPUPartition& gpu_partition);
+
     }  // end namespace kernel
     }  // end namespace md
     }  // end namespace hoomd
@@ -25,7 +25,22 @@ class PYBIND11_EXPORT TwoStepConstantVolumeGPU : public TwoStepConstantVolume
 
     virtual void integrateStepTwo(uint64_t timestep);
 
+    /// Sum the net force and perform the second step of the integration in one pass.
+    virtual bool integrateStepTwoSumNetForce(uint64_t timestep,
+                                             const hoomd::kernel::gpu_net_force_sum& net_force_sum);
+
     protected:
+    /// Perform the second step of the integration.
+    /** \param timestep Current time step.
+        \param d_net_force Net force to read, unused when \a net_force_sum is set.
+        \param d_net_torque Net torque to read.
+        \param net_force_sum When not null, sum the net force in the step two kernel.
+    */
+    void stepTwo(uint64_t timestep,
+                 Scalar4* d_net_force,
+                 Scalar4* d_net_torque,
+                 const hoomd::kernel::gpu_net_force_sum* net_force_sum);
+
     /// Autotuner for block size (step one kernel).
     std::shared_ptr<Autotuner<1>> m_tuner_one;
 
@@ -40,6 +40,15 @@ TwoStepLangevinGPU::TwoStepLangevinGPU(std::shared_ptr<SystemDefinition> sysdef,
     GPUArray<Scalar> partial_sum1(m_num_blocks, m_exec_conf);
     m_partial_sum1.swap(partial_sum1);
 
+    GPUArray<unsigned int> tally_counter(1, m_exec_conf);
+    m_tally_counter.swap(tally_counter);
+        {
+        ArrayHandle<unsigned int> h_tally_counter(m_tally_counter,
+                                                  access_location::host,
+                                                  access_mode::overwrite);
+        h_tally_counter.data[0] = 0;
+        }
+
     m_tuner_one.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
                                        m_exec_conf,
                                        "langevin_nve"));
@@ -142,18 +151,56 @@ void TwoStepLangevinGPU::integrateStepOne(uint64_t timestep)
 */
 void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
     {
-    const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
+    ArrayHandle<Scalar4> d_net_force(m_pdata->getNetForce(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
+                                      access_location::device,
+                                      access_mode::read);
 
+    stepTwo(timestep, d_net_force.data, d_net_torque.data, nullptr);
+    }
+
+/*! \param timestep Current time step
+    \param net_force_sum Net force arrays and the forces to sum
+
+    The caller holds the net force arrays, so the step two kernels access them through
+    \a net_force_sum.
+*/
+bool TwoStepLangevinGPU::integrateStepTwoSumNetForce(
+    uint64_t timestep,
+    const hoomd::kernel::gpu_net_force_sum& net_force_sum)
+    {
+    // the step two kernel visits only the members of the group
+    if (m_group->getNumMembers() != m_pdata->getN())
+        return false;
+
+    stepTwo(timestep, nullptr, net_force_sum.d_net_torque, &net_force_sum);
+    return true;
+    }
+
+void TwoStepLangevinGPU::stepTwo(uint64_t timestep,
+                                 Scalar4* d_net_force,
+                                 Scalar4* d_net_torque,
+                                 const hoomd::kernel::gpu_net_force_sum* net_force_sum)
+    {
     // get the dimensionality of the system
     const unsigned int D = m_sysdef->getNDimensions();
 
-    ArrayHandle<Scalar4> d_net_force(net_force, access_location::device, access_mode::read);
     ArrayHandle<Scalar> d_gamma(m_gamma, access_location::device, access_mode::read);
     ArrayHandle<Scalar3> d_gamma_r(m_gamma_r, access_location::device, access_mode::read);
     ArrayHandle<unsigned int> d_index_array(m_group->getIndexArray(),
                                             access_location::device,
                                             access_mode::read);
 
+    // the group may have grown since the partial sum array was allocated
+    unsigned int group_size = m_group->getNumMembers();
+    m_num_blocks = group_size / m_block_size + 1;
+    if (m_partial_sum1.getNumElements() < m_num_blocks)
+        {
+        m_partial_sum1.resize(m_num_blocks);
+        }
+
         {
         ArrayHandle<Scalar> d_partial_sumBD(m_partial_sum1,
                                             access_location::device,
@@ -171,9 +218,9 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
         ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
                                         access_location::device,
                                         access_mode::read);
-
-        unsigned int group_size = m_group->getNumMembers();
-        m_num_blocks = group_size / m_block_size + 1;
+        ArrayHandle<unsigned int> d_tally_counter(m_tally_counter,
+                                                  access_location::device,
+                                                  access_mode::readwrite);
 
         // perform the update on the GPU
         kernel::langevin_step_two_args args(d_gamma.data,
@@ -189,6 +236,7 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
                                             m_noiseless_r,
                                             m_tally,
                                             m_exec_conf->dev_prop);
+        args.d_tally_counter = d_tally_counter.data;
 
         kernel::gpu_langevin_step_two(d_pos.data,
                                       d_vel.data,
@@ -196,10 +244,11 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
                                       d_tag.data,
                                       d_index_array.data,
                                       group_size,
-                                      d_net_force.data,
+                                      d_net_force,
                                       args,
                                       m_deltaT,
-                                      D);
+                                      D,
+                                      net_force_sum);
 
         if (m_exec_conf->isCUDAErrorCheckingEnabled())
             CHECK_CUDA_ERROR();
@@ -213,19 +262,15 @@ void TwoStepLangevinGPU::integrateStepTwo(uint64_t timestep)
             ArrayHandle<Scalar4> d_angmom(m_pdata->getAngularMomentumArray(),
                                           access_location::device,
                                           access_mode::readwrite);
-            ArrayHandle<Scalar4> d_net_torque(m_pdata->getNetTorqueArray(),
-                                              access_location::device,
-                                              access_mode::read);
             ArrayHandle<Scalar3> d_inertia(m_pdata->getMomentsOfInertiaArray(),
                                            access_location::device,
                                            access_mode::read);
 
-            unsigned int group_size = m_group->getNumMembers();
             gpu_langevin_angular_step_two(d_pos.data,
                                           d_orientation.data,
                                           d_angmom.data,
                                           d_inertia.data,
-                                          d_net_torque.data,
+                                          d_net_torque,
                                           d_index_array.data,
                                           d_gamma_r.data,
                                           d_tag.data,
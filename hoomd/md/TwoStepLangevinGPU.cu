@@ -40,14 +40,23 @@ namespace kernel
     \param D Dimensionality of the system
     \param tally Boolean indicating whether energy tally is performed or not
     \param d_partial_sum_bdenergy Placeholder for the partial sum
+    \param d_sum_bdenergy Placeholder for the sum
+    \param d_tally_counter Number of blocks that have written their partial sum, must be 0
 
     This kernel is implemented in a very similar manner to gpu_nve_step_two_kernel(), see it for
    design details.
 
-    This kernel will tally the energy transfer from the bd thermal reservoir and the particle system
+    This kernel will tally the energy transfer from the bd thermal reservoir and the particle
+    system. The last block to write its partial sum reduces the partial sums of all blocks and
+    resets \a d_tally_counter, so no separate reduction kernel is needed.
 
     This kernel must be launched with enough dynamic shared memory per block to read in d_gamma
+
+    \tparam sum_mode When set to 0, the kernel reads \a d_net_force. When set to 1 (or 2), it
+    sums the net force (and virial) of each member with \a net_force_sum, which requires a group
+    that contains all local particles.
 */
+template<unsigned int sum_mode>
 __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
                                              Scalar4* d_vel,
                                              Scalar3* d_accel,
@@ -65,7 +74,10 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
                                              unsigned int D,
                                              bool tally,
                                              Scalar* d_partial_sum_bdenergy,
-                                             bool enable_shared_cache)
+                                             Scalar* d_sum_bdenergy,
+                                             unsigned int* d_tally_counter,
+                                             bool enable_shared_cache,
+                                             const hoomd::kernel::gpu_net_force_sum net_force_sum)
     {
     HIP_DYNAMIC_SHARED(char, s_data)
     Scalar* s_gammas = (Scalar*)s_data;
@@ -131,7 +143,11 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
             bd_force.z = randomz * coeff - gamma * vel.z;
 
         // read in the net force and calculate the acceleration MEM TRANSFER: 16 bytes
-        Scalar4 net_force = d_net_force[idx];
+        Scalar4 net_force;
+        if (sum_mode)
+            net_force = hoomd::kernel::sum_net_force<sum_mode == 2>(net_force_sum, idx);
+        else
+            net_force = d_net_force[idx];
         Scalar3 accel = make_scalar3(net_force.x, net_force.y, net_force.z);
         // MEM TRANSFER: 4 bytes   FLOPS: 3
         Scalar mass = vel.w;
@@ -174,51 +190,50 @@ __global__ void gpu_langevin_step_two_kernel(const Scalar4* d_pos,
             }
 
         // write out our partial sum
+        __shared__ bool s_last_block;
         if (threadIdx.x == 0)
             {
             d_partial_sum_bdenergy[blockIdx.x] = bdtally_sdata[0];
-            }
-        }
-    }
-
-//! Kernel function for reducing a partial sum to a full sum (one value)
-/*! \param d_sum Placeholder for the sum
-    \param d_partial_sum Array containing the partial sum
-    \param num_blocks Number of blocks to execute
-*/
-__global__ void
-gpu_bdtally_reduce_partial_sum_kernel(Scalar* d_sum, Scalar* d_partial_sum, unsigned int num_blocks)
-    {
-    Scalar sum = Scalar(0.0);
-    HIP_DYNAMIC_SHARED(char, s_data)
-    Scalar* bdtally_sdata = (Scalar*)&s_data[0];
 
-    // sum up the values in the partial sum via a sliding window
-    for (int start = 0; start < num_blocks; start += blockDim.x)
-        {
-        __syncthreads();
-        if (start + threadIdx.x < num_blocks)
-            bdtally_sdata[threadIdx.x] = d_partial_sum[start + threadIdx.x];
-        else
-            bdtally_sdata[threadIdx.x] = Scalar(0.0);
+            // make the partial sum visible to the other blocks before counting this block, the
+            // counter wraps back to 0 in the last block
+            __threadfence();
+            s_last_block = atomicInc(d_tally_counter, gridDim.x - 1) == gridDim.x - 1;
+            }
         __syncthreads();
 
-        // reduce the sum in parallel
-        int offs = blockDim.x >> 1;
-        while (offs > 0)
+        if (s_last_block)
             {
-            if (threadIdx.x < offs)
-                bdtally_sdata[threadIdx.x] += bdtally_sdata[threadIdx.x + offs];
-            offs >>= 1;
-            __syncthreads();
+            // sum up the values in the partial sum via a sliding window, in a fixed order so that
+            // the result does not depend on which block finishes last
+            const volatile Scalar* partial_sum = d_partial_sum_bdenergy;
+            Scalar sum = Scalar(0.0);
+            for (unsigned int start = 0; start < gridDim.x; start += blockDim.x)
+                {
+                __syncthreads();
+                if (start + threadIdx.x < gridDim.x)
+                    bdtally_sdata[threadIdx.x] = partial_sum[start + threadIdx.x];
+                else
+                    bdtally_sdata[threadIdx.x] = Scalar(0.0);
+                __syncthreads();
+
+                // reduce the sum in parallel
+                int offs = blockDim.x >> 1;
+                while (offs > 0)
+                    {
+                    if (threadIdx.x < offs)
+                        bdtally_sdata[threadIdx.x] += bdtally_sdata[threadIdx.x + offs];
+                    offs >>= 1;
+                    __syncthreads();
+                    }
+
+                sum += bdtally_sdata[0];
+                }
+
+            if (threadIdx.x == 0)
+                *d_sum_bdenergy = sum;
             }
-
-        // everybody sums up sum2K
-        sum += bdtally_sdata[0];
         }
-
-    if (threadIdx.x == 0)
-        *d_sum = sum;
     }
 
 //! NO_SQUISH angular part of the second half step
@@ -470,6 +485,7 @@ hipError_t gpu_langevin_angular_step_two(const Scalar4* d_pos,
     \param langevin_args Collected arguments for gpu_langevin_step_two_kernel() and
    gpu_langevin_angular_step_two() \param deltaT Amount of real time to step forward in one time
    step \param D Dimensionality of the system
+    \param net_force_sum When not null, sum the net force instead of reading \a d_net_force
 
     This is just a driver for gpu_langevin_step_two_kernel(), see it for details.
 */
@@ -482,13 +498,12 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
                                  Scalar4* d_net_force,
                                  const langevin_step_two_args& langevin_args,
                                  Scalar deltaT,
-                                 unsigned int D)
+                                 unsigned int D,
+                                 const hoomd::kernel::gpu_net_force_sum* net_force_sum)
     {
     // setup the grid to run the kernel
     dim3 grid(langevin_args.num_blocks, 1, 1);
-    dim3 grid1(1, 1, 1);
     dim3 threads(langevin_args.block_size, 1, 1);
-    dim3 threads1(256, 1, 1);
 
     auto shared_bytes = max((sizeof(Scalar) * langevin_args.n_types),
                             (langevin_args.block_size * sizeof(Scalar)));
@@ -501,41 +516,103 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
         shared_bytes = 0;
         }
 
-    // run the kernel
-    hipLaunchKernelGGL((gpu_langevin_step_two_kernel),
-                       grid,
-                       threads,
-                       shared_bytes,
-                       0,
-                       d_pos,
-                       d_vel,
-                       d_accel,
-                       d_tag,
-                       d_group_members,
-                       group_size,
-                       d_net_force,
-                       langevin_args.d_gamma,
-                       langevin_args.n_types,
-                       langevin_args.timestep,
-                       langevin_args.seed,
-                       langevin_args.T,
-                       langevin_args.noiseless_t,
-                       deltaT,
-                       D,
-                       langevin_args.tally,
-                       langevin_args.d_partial_sum_bdenergy,
-                       enable_shared_cache);
+    // the kernel reads the net force when there is nothing to sum
+    hoomd::kernel::gpu_net_force_sum sum_args = {};
+    unsigned int sum_mode = 0;
+    if (net_force_sum)
+        {
+        sum_args = *net_force_sum;
+        sum_mode = net_force_sum->compute_virial ? 2 : 1;
+        }
 
-    // run the summation kernel
-    if (langevin_args.tally)
-        hipLaunchKernelGGL((gpu_bdtally_reduce_partial_sum_kernel),
-                           dim3(grid1),
-                           dim3(threads1),
-                           langevin_args.block_size * sizeof(Scalar),
-                           0,
-                           &langevin_args.d_sum_bdenergy[0],
-                           langevin_args.d_partial_sum_bdenergy,
-                           langevin_args.num_blocks);
+    // run the kernel
+    if (sum_mode == 0)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_langevin_step_two_kernel<0>),
+                               grid,
+                               threads,
+                               shared_bytes,
+                               0,
+                               d_pos,
+                               d_vel,
+                               d_accel,
+                               d_tag,
+                               d_group_members,
+                               group_size,
+                               d_net_force,
+                               langevin_args.d_gamma,
+                               langevin_args.n_types,
+                               langevin_args.timestep,
+                               langevin_args.seed,
+                               langevin_args.T,
+                               langevin_args.noiseless_t,
+                               deltaT,
+                               D,
+                               langevin_args.tally,
+                               langevin_args.d_partial_sum_bdenergy,
+                               langevin_args.d_sum_bdenergy,
+                               langevin_args.d_tally_counter,
+                               enable_shared_cache,
+                               sum_args);
+        }
+    else if (sum_mode == 1)
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_langevin_step_two_kernel<1>),
+                               grid,
+                               threads,
+                               shared_bytes,
+                               0,
+                               d_pos,
+                               d_vel,
+                               d_accel,
+                               d_tag,
+                               d_group_members,
+                               group_size,
+                               d_net_force,
+                               langevin_args.d_gamma,
+                               langevin_args.n_types,
+                               langevin_args.timestep,
+                               langevin_args.seed,
+                               langevin_args.T,
+                               langevin_args.noiseless_t,
+                               deltaT,
+                               D,
+                               langevin_args.tally,
+                               langevin_args.d_partial_sum_bdenergy,
+                               langevin_args.d_sum_bdenergy,
+                               langevin_args.d_tally_counter,
+                               enable_shared_cache,
+                               sum_args);
+        }
+    else
+        {
+            hipLaunchKernelGGL(HIP_KERNEL_NAME(gpu_langevin_step_two_kernel<2>),
+                               grid,
+                               threads,
+                               shared_bytes,
+                               0,
+                               d_pos,
+                               d_vel,
+                               d_accel,
+                               d_tag,
+                               d_group_members,
+                               group_size,
+                               d_net_force,
+                               langevin_args.d_gamma,
+                               langevin_args.n_types,
+                               langevin_args.timestep,
+                               langevin_args.seed,
+                               langevin_args.T,
+                               langevin_args.noiseless_t,
+                               deltaT,
+                               D,
+                               langevin_args.tally,
+                               langevin_args.d_partial_sum_bdenergy,
+                               langevin_args.d_sum_bdenergy,
+                               langevin_args.d_tally_counter,
+                               enable_shared_cache,
+                               sum_args);
+        }
 
     return hipSuccess;
     }
@@ -6,6 +6,7 @@
 */
 
 #include "hoomd/HOOMDMath.h"
+#include "hoomd/Integrator.cuh"
 #include "hoomd/ParticleData.cuh"
 #include <hip/hip_runtime.h>
 
@@ -54,6 +55,9 @@ struct langevin_step_two_args
     bool noiseless_r; //!<  If set true, there will be no rotational noise (random torque)
     bool tally;       //!< Set to true is bd thermal reservoir energy tally is to be performed
     const hipDeviceProp_t& devprop; //!< Device properties.
+
+    /// Number of blocks that have written their partial sum, required when \a tally is set
+    unsigned int* d_tally_counter = nullptr;
     };
 
 //! Kernel driver for the second part of the Langevin update called by TwoStepLangevinGPU
@@ -66,7 +70,8 @@ hipError_t gpu_langevin_step_two(const Scalar4* d_pos,
                                  Scalar4* d_net_force,
                                  const langevin_step_two_args& langevin_args,
                                  Scalar deltaT,
-                                 unsigned int D);
+                                 unsigned int D,
+                                 const hoomd::kernel::gpu_net_force_sum* net_force_sum = nullptr);
 
 //! Kernel driver for the second part of the angular Langevin update (NO_SQUISH) by
 //! TwoStepLangevinGPU
@@ -36,12 +36,30 @@ class PYBIND11_EXPORT TwoStepLangevinGPU : public TwoStepLangevin
     //! Performs the second step of the integration
     virtual void integrateStepTwo(uint64_t timestep);
 
+    //! Sums the net force and performs the second step of the integration in one pass
+    virtual bool integrateStepTwoSumNetForce(uint64_t timestep,
+                                             const hoomd::kernel::gpu_net_force_sum& net_force_sum);
+
     protected:
+    //! Performs the second step of the integration
+    /*! \param timestep Current time step
+        \param d_net_force Net force to read, unused when \a net_force_sum is set
+        \param d_net_torque Net torque to read
+        \param net_force_sum When not null, sum the net force in the step two kernel
+    */
+    void stepTwo(uint64_t timestep,
+                 Scalar4* d_net_force,
+                 Scalar4* d_net_torque,
+                 const hoomd::kernel::gpu_net_force_sum* net_force_sum);
+
     unsigned int m_block_size;       //!< block size for partial sum memory
     unsigned int m_num_blocks;       //!< number of memory blocks reserved for partial sum memory
     GPUArray<Scalar> m_partial_sum1; //!< memory space for partial sum over bd energy transfers
     GPUArray<Scalar> m_sum;          //!< memory space for sum over bd energy transfers
 
+    /// Number of blocks that have written their partial sum, reset to 0 by the last block
+    GPUArray<unsigned int> m_tally_counter;
+
     /// Autotuner for block size (step one kernel)
     std::shared_ptr<Autotuner<1>> m_tuner_one;
 
@@ -22,6 +22,13 @@
 
 #include <pybind11/pybind11.h>
 
+#include <atomic>
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace md
@@ -397,7 +404,7 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint
     const GlobalArray<Scalar4>& net_force = m_pdata->getNetForce();
     const GlobalArray<Scalar>& net_virial = m_pdata->getNetVirial();
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar4> h_net_force(net_force, access_location::host, access_mode::readwrite);
     ArrayHandle<Scalar> h_net_virial(net_virial, access_location::host, access_mode::readwrite);
@@ -407,124 +414,155 @@ template<class Manifold> void TwoStepRATTLEBD<Manifold>::includeRATTLEForce(uint
 
     uint16_t seed = m_sysdef->getSeed();
 
+    ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                      access_location::host,
+                                      access_mode::read);
+
     // perform the first half step
     // r(t+deltaT) = r(t) + (Fc(t) + Fr)*deltaT/gamma
     // iterative: r(t+deltaT) = r(t+deltaT) - J^(-1)*residual
     // v(t+deltaT) = random distribution consistent with T
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    // each particle's Newton iteration is independent, so the particles are solved in parallel
+    std::atomic<bool> exceeded_max_iterations(false);
+    auto solve_constraint = [&](unsigned int group_begin, unsigned int group_end)
         {
-        unsigned int ptag = m_group->getMemberTag(group_idx);
-        unsigned int j = h_rtag.data[ptag];
+        for (unsigned int group_idx = group_begin; group_idx < group_end; group_idx++)
+            {
+            unsigned int j = h_index.data[group_idx];
+            unsigned int ptag = h_tag.data[j];
 
-        // Initialize the RNG
-        RandomGenerator rng_b(hoomd::Seed(RNGIdentifier::TwoStepBD, timestep, seed),
-                              hoomd::Counter(ptag, 2));
+            // Initialize the RNG
+            RandomGenerator rng_b(hoomd::Seed(RNGIdentifier::TwoStepBD, timestep, seed),
+                                  hoomd::Counter(ptag, 2));
 
-        Scalar gamma;
-        unsigned int type = __scalar_as_int(h_pos.data[j].w);
-        gamma = h_gamma.data[type];
-        Scalar deltaT_gamma = m_deltaT / gamma;
+            Scalar gamma;
+            unsigned int type = __scalar_as_int(h_pos.data[j].w);
+            gamma = h_gamma.data[type];
+            Scalar deltaT_gamma = m_deltaT / gamma;
 
-        Scalar3 next_pos;
-        next_pos.x = h_pos.data[j].x;
-        next_pos.y = h_pos.data[j].y;
-        next_pos.z = h_pos.data[j].z;
-
-        Scalar3 normal = m_manifold.derivative(next_pos);
-        Scalar norm_normal = fast::rsqrt(dot(normal, normal));
+            Scalar3 next_pos;
+            next_pos.x = h_pos.data[j].x;
+            next_pos.y = h_pos.data[j].y;
+            next_pos.z = h_pos.data[j].z;
 
-        normal.x *= norm_normal;
-        normal.y *= norm_normal;
-        normal.z *= norm_normal;
+            Scalar3 normal = m_manifold.derivative(next_pos);
+            Scalar norm_normal = fast::rsqrt(dot(normal, normal));
 
-        Scalar rx, ry, rz, coeff;
+            normal.x *= norm_normal;
+            normal.y *= norm_normal;
+            normal.z *= norm_normal;
 
-        if (currentTemp > 0)
-            {
-            // compute the random force
-            UniformDistribution<Scalar> uniform(Scalar(-1), Scalar(1));
-            rx = uniform(rng_b);
-            ry = uniform(rng_b);
-            rz = uniform(rng_b);
+            Scalar rx, ry, rz, coeff;
 
-            Scalar normal_r = rx * normal.x + ry * normal.y + rz * normal.z;
+            if (currentTemp > 0)
+                {
+                // compute the random force
+                UniformDistribution<Scalar> uniform(Scalar(-1), Scalar(1));
+                rx = uniform(rng_b);
+                ry = uniform(rng_b);
+                rz = uniform(rng_b);
+
+                Scalar normal_r = rx * normal.x + ry * normal.y + rz * normal.z;
+
+                rx = rx - normal_r * normal.x;
+                ry = ry - normal_r * normal.y;
+                rz = rz - normal_r * normal.z;
+
+                // compute the bd force (the extra factor of 3 is because <rx^2> is 1/3 in the
+                // uniform -1,1 distribution it is not the dimensionality of the system
+                coeff = fast::sqrt(Scalar(6.0) * currentTemp / deltaT_gamma);
+                if (m_noiseless_t)
+                    coeff = Scalar(0.0);
+                }
+            else
+                {
+                rx = 0;
+                ry = 0;
+                rz = 0;
+                coeff = 0;
+                }
 
-            rx = rx - normal_r * normal.x;
-            ry = ry - normal_r * normal.y;
-            rz = rz - normal_r * normal.z;
+            Scalar Fr_x = rx * coeff;
+            Scalar Fr_y = ry * coeff;
+            Scalar Fr_z = rz * coeff;
 
-            // compute the bd force (the extra factor of 3 is because <rx^2> is 1/3 in the uniform
-            // -1,1 distribution it is not the dimensionality of the system
-            coeff = fast::sqrt(Scalar(6.0) * currentTemp / deltaT_gamma);
-            if (m_noiseless_t)
-                coeff = Scalar(0.0);
-            }
-        else
-            {
-            rx = 0;
-            ry = 0;
-            rz = 0;
-            coeff = 0;
-            }
+            // update position
+            Scalar mu = 0.0;
 
-        Scalar Fr_x = rx * coeff;
-        Scalar Fr_y = ry * coeff;
-        Scalar Fr_z = rz * coeff;
+            Scalar inv_alpha = -Scalar(1.0) / deltaT_gamma;
 
-        // update position
-        Scalar mu = 0.0;
+            Scalar3 residual;
+            Scalar resid;
 
-        Scalar inv_alpha = -Scalar(1.0) / deltaT_gamma;
+            unsigned int iteration = 0;
+            do
+                {
+                iteration++;
+                residual.x = h_pos.data[j].x - next_pos.x
+                             + (h_net_force.data[j].x + Fr_x - mu * normal.x) * deltaT_gamma;
+                residual.y = h_pos.data[j].y - next_pos.y
+                             + (h_net_force.data[j].y + Fr_y - mu * normal.y) * deltaT_gamma;
+                residual.z = h_pos.data[j].z - next_pos.z
+                             + (h_net_force.data[j].z + Fr_z - mu * normal.z) * deltaT_gamma;
+                resid = m_manifold.implicitFunction(next_pos);
 
-        Scalar3 residual;
-        Scalar resid;
+                Scalar3 next_normal = m_manifold.derivative(next_pos);
 
-        unsigned int iteration = 0;
-        do
-            {
-            iteration++;
-            residual.x = h_pos.data[j].x - next_pos.x
-                         + (h_net_force.data[j].x + Fr_x - mu * normal.x) * deltaT_gamma;
-            residual.y = h_pos.data[j].y - next_pos.y
-                         + (h_net_force.data[j].y + Fr_y - mu * normal.y) * deltaT_gamma;
-            residual.z = h_pos.data[j].z - next_pos.z
-                         + (h_net_force.data[j].z + Fr_z - mu * normal.z) * deltaT_gamma;
-            resid = m_manifold.implicitFunction(next_pos);
+                Scalar nndotr = dot(next_normal, residual);
+                Scalar nndotn = dot(next_normal, normal);
+                Scalar beta = (resid + nndotr) / nndotn;
 
-            Scalar3 next_normal = m_manifold.derivative(next_pos);
+                next_pos.x = next_pos.x - beta * normal.x + residual.x;
+                next_pos.y = next_pos.y - beta * normal.y + residual.y;
+                next_pos.z = next_pos.z - beta * normal.z + residual.z;
+                mu = mu - beta * inv_alpha;
 
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
+                } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
 
-            next_pos.x = next_pos.x - beta * normal.x + residual.x;
-            next_pos.y = next_pos.y - beta * normal.y + residual.y;
-            next_pos.z = next_pos.z - beta * normal.z + residual.z;
-            mu = mu - beta * inv_alpha;
+            if (iteration == maxiteration)
+                {
+                exceeded_max_iterations = true;
+                }
 
-            } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
+            h_net_force.data[j].x -= mu * normal.x;
+            h_net_force.data[j].y -= mu * normal.y;
+            h_net_force.data[j].z -= mu * normal.z;
+
+            h_net_virial.data[0 * net_virial_pitch + j] -= mu * normal.x * h_pos.data[j].x;
+            h_net_virial.data[1 * net_virial_pitch + j]
+                -= 0.5 * mu * (normal.y * h_pos.data[j].x + normal.x * h_pos.data[j].y);
+            h_net_virial.data[2 * net_virial_pitch + j]
+                -= 0.5 * mu * (normal.z * h_pos.data[j].x + normal.x * h_pos.data[j].z);
+            h_net_virial.data[3 * net_virial_pitch + j] -= mu * normal.y * h_pos.data[j].y;
+            h_net_virial.data[4 * net_virial_pitch + j]
+                -= 0.5 * mu * (normal.y * h_pos.data[j].z + normal.z * h_pos.data[j].y);
+            h_net_virial.data[5 * net_virial_pitch + j] -= mu * normal.z * h_pos.data[j].z;
+            }
+        };
 
-        if (iteration == maxiteration)
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
             {
-            m_exec_conf->msg->warning()
-                << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
-                << "It is recomended to change the initial configuration or lower the step size."
-                << std::endl;
-            }
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, group_size),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { solve_constraint(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        solve_constraint(0, group_size);
+        }
 
-        h_net_force.data[j].x -= mu * normal.x;
-        h_net_force.data[j].y -= mu * normal.y;
-        h_net_force.data[j].z -= mu * normal.z;
-
-        h_net_virial.data[0 * net_virial_pitch + j] -= mu * normal.x * h_pos.data[j].x;
-        h_net_virial.data[1 * net_virial_pitch + j]
-            -= 0.5 * mu * (normal.y * h_pos.data[j].x + normal.x * h_pos.data[j].y);
-        h_net_virial.data[2 * net_virial_pitch + j]
-            -= 0.5 * mu * (normal.z * h_pos.data[j].x + normal.x * h_pos.data[j].z);
-        h_net_virial.data[3 * net_virial_pitch + j] -= mu * normal.y * h_pos.data[j].y;
-        h_net_virial.data[4 * net_virial_pitch + j]
-            -= 0.5 * mu * (normal.y * h_pos.data[j].z + normal.z * h_pos.data[j].y);
-        h_net_virial.data[5 * net_virial_pitch + j] -= mu * normal.z * h_pos.data[j].z;
+    if (exceeded_max_iterations)
+        {
+        m_exec_conf->msg->warning()
+            << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
+            << "It is recomended to change the initial configuration or lower the step size."
+            << std::endl;
         }
     }
 
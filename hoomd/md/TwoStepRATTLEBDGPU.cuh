@@ -260,7 +260,9 @@ __global__ void gpu_rattle_brownian_step_one_kernel(Scalar4* d_pos,
         // rotational random force and orientation quaternion updates
         if (aniso)
             {
-            unsigned int type_r = __scalar_as_int(d_pos[idx].w);
+            // the type is unchanged by the translational update, there is no need to read d_pos
+            // again
+            unsigned int type_r = typ;
 
             // gamma_r is stored in the second half of s_gammas a.k.a s_gammas_r
             Scalar3 gamma_r = s_gammas_r[type_r];
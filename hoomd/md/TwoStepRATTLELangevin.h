@@ -20,6 +20,13 @@
 
 #include <pybind11/pybind11.h>
 
+#include <atomic>
+
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace md
@@ -630,85 +637,116 @@ template<class Manifold> void TwoStepRATTLELangevin<Manifold>::includeRATTLEForc
 
     size_t net_virial_pitch = net_virial.getPitch();
 
+    ArrayHandle<unsigned int> h_index(m_group->getIndexArray(),
+                                      access_location::host,
+                                      access_mode::read);
+
     // perform the first half step of the RATTLE algorithm applied on velocity verlet
     // v(t+deltaT/2) = v(t) + (1/2)*deltaT*(a-alpha*n_manifold(x(t))/m)
     // iterative: x(t+deltaT) = x(t+deltaT) - J^(-1)*residual
-    for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
+    // each particle's Newton iteration is independent, so the particles are solved in parallel
+    std::atomic<bool> exceeded_max_iterations(false);
+    auto solve_constraint = [&](unsigned int group_begin, unsigned int group_end)
         {
-        unsigned int j = m_group->getMemberIndex(group_idx);
+        for (unsigned int group_idx = group_begin; group_idx < group_end; group_idx++)
+            {
+            unsigned int j = h_index.data[group_idx];
 
-        Scalar alpha = 0.0;
+            Scalar alpha = 0.0;
 
-        Scalar3 next_pos;
-        next_pos.x = h_pos.data[j].x;
-        next_pos.y = h_pos.data[j].y;
-        next_pos.z = h_pos.data[j].z;
+            Scalar3 next_pos;
+            next_pos.x = h_pos.data[j].x;
+            next_pos.y = h_pos.data[j].y;
+            next_pos.z = h_pos.data[j].z;
 
-        Scalar3 normal = m_manifold.derivative(next_pos);
+            Scalar3 normal = m_manifold.derivative(next_pos);
 
-        Scalar inv_mass = Scalar(1.0) / h_vel.data[j].w;
-        Scalar deltaT_half = Scalar(1.0 / 2.0) * m_deltaT;
-        Scalar inv_alpha = -deltaT_half * m_deltaT * inv_mass;
-        inv_alpha = Scalar(1.0) / inv_alpha;
+            Scalar inv_mass = Scalar(1.0) / h_vel.data[j].w;
+            Scalar deltaT_half = Scalar(1.0 / 2.0) * m_deltaT;
+            Scalar inv_alpha = -deltaT_half * m_deltaT * inv_mass;
+            inv_alpha = Scalar(1.0) / inv_alpha;
 
-        Scalar3 residual;
-        Scalar resid;
-        Scalar3 half_vel;
+            Scalar3 residual;
+            Scalar resid;
+            Scalar3 half_vel;
 
-        unsigned int maxiteration = 10;
-        unsigned int iteration = 0;
-        do
-            {
-            iteration++;
-            half_vel.x
-                = h_vel.data[j].x + deltaT_half * (h_accel.data[j].x - inv_mass * alpha * normal.x);
-            half_vel.y
-                = h_vel.data[j].y + deltaT_half * (h_accel.data[j].y - inv_mass * alpha * normal.y);
-            half_vel.z
-                = h_vel.data[j].z + deltaT_half * (h_accel.data[j].z - inv_mass * alpha * normal.z);
-
-            residual.x = h_pos.data[j].x - next_pos.x + m_deltaT * half_vel.x;
-            residual.y = h_pos.data[j].y - next_pos.y + m_deltaT * half_vel.y;
-            residual.z = h_pos.data[j].z - next_pos.z + m_deltaT * half_vel.z;
-            resid = m_manifold.implicitFunction(next_pos);
-
-            Scalar3 next_normal = m_manifold.derivative(next_pos);
-            Scalar nndotr = dot(next_normal, residual);
-            Scalar nndotn = dot(next_normal, normal);
-            Scalar beta = (resid + nndotr) / nndotn;
-
-            next_pos.x = next_pos.x - beta * normal.x + residual.x;
-            next_pos.y = next_pos.y - beta * normal.y + residual.y;
-            next_pos.z = next_pos.z - beta * normal.z + residual.z;
-            alpha = alpha - beta * inv_alpha;
-
-            } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
+            unsigned int maxiteration = 10;
+            unsigned int iteration = 0;
+            do
+                {
+                iteration++;
+                half_vel.x = h_vel.data[j].x
+                             + deltaT_half * (h_accel.data[j].x - inv_mass * alpha * normal.x);
+                half_vel.y = h_vel.data[j].y
+                             + deltaT_half * (h_accel.data[j].y - inv_mass * alpha * normal.y);
+                half_vel.z = h_vel.data[j].z
+                             + deltaT_half * (h_accel.data[j].z - inv_mass * alpha * normal.z);
+
+                residual.x = h_pos.data[j].x - next_pos.x + m_deltaT * half_vel.x;
+                residual.y = h_pos.data[j].y - next_pos.y + m_deltaT * half_vel.y;
+                residual.z = h_pos.data[j].z - next_pos.z + m_deltaT * half_vel.z;
+                resid = m_manifold.implicitFunction(next_pos);
+
+                Scalar3 next_normal = m_manifold.derivative(next_pos);
+                Scalar nndotr = dot(next_normal, residual);
+                Scalar nndotn = dot(next_normal, normal);
+                Scalar beta = (resid + nndotr) / nndotn;
+
+                next_pos.x = next_pos.x - beta * normal.x + residual.x;
+                next_pos.y = next_pos.y - beta * normal.y + residual.y;
+                next_pos.z = next_pos.z - beta * normal.z + residual.z;
+                alpha = alpha - beta * inv_alpha;
+
+                } while (maxNorm(residual, resid) > m_tolerance && iteration < maxiteration);
+
+            if (iteration == maxiteration)
+                {
+                exceeded_max_iterations = true;
+                }
 
-        if (iteration == maxiteration)
-            {
-            m_exec_conf->msg->warning()
-                << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
-                << "It is recomended to change the initial configuration or lower the step size."
-                << std::endl;
+            h_net_force.data[j].x -= alpha * normal.x;
+            h_net_force.data[j].y -= alpha * normal.y;
+            h_net_force.data[j].z -= alpha * normal.z;
+
+            h_net_virial.data[0 * net_virial_pitch + j] -= alpha * normal.x * h_pos.data[j].x;
+            h_net_virial.data[1 * net_virial_pitch + j]
+                -= 0.5 * alpha * (normal.y * h_pos.data[j].x + normal.x * h_pos.data[j].y);
+            h_net_virial.data[2 * net_virial_pitch + j]
+                -= 0.5 * alpha * (normal.z * h_pos.data[j].x + normal.x * h_pos.data[j].z);
+            h_net_virial.data[3 * net_virial_pitch + j] -= alpha * normal.y * h_pos.data[j].y;
+            h_net_virial.data[4 * net_virial_pitch + j]
+                -= 0.5 * alpha * (normal.y * h_pos.data[j].z + normal.z * h_pos.data[j].y);
+            h_net_virial.data[5 * net_virial_pitch + j] -= alpha * normal.z * h_pos.data[j].z;
+
+            h_accel.data[j].x -= inv_mass * alpha * normal.x;
+            h_accel.data[j].y -= inv_mass * alpha * normal.y;
+            h_accel.data[j].z -= inv_mass * alpha * normal.z;
             }
+        };
 
-        h_net_force.data[j].x -= alpha * normal.x;
-        h_net_force.data[j].y -= alpha * normal.y;
-        h_net_force.data[j].z -= alpha * normal.z;
-
-        h_net_virial.data[0 * net_virial_pitch + j] -= alpha * normal.x * h_pos.data[j].x;
-        h_net_virial.data[1 * net_virial_pitch + j]
-            -= 0.5 * alpha * (normal.y * h_pos.data[j].x + normal.x * h_pos.data[j].y);
-        h_net_virial.data[2 * net_virial_pitch + j]
-            -= 0.5 * alpha * (normal.z * h_pos.data[j].x + normal.x * h_pos.data[j].z);
-        h_net_virial.data[3 * net_virial_pitch + j] -= alpha * normal.y * h_pos.data[j].y;
-        h_net_virial.data[4 * net_virial_pitch + j]
-            -= 0.5 * alpha * (normal.y * h_pos.data[j].z + normal.z * h_pos.data[j].y);
-        h_net_virial.data[5 * net_virial_pitch + j] -= alpha * normal.z * h_pos.data[j].z;
-
-        h_accel.data[j].x -= inv_mass * alpha * normal.x;
-        h_accel.data[j].y -= inv_mass * alpha * normal.y;
-        h_accel.data[j].z -= inv_mass * alpha * normal.z;
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, group_size),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { solve_constraint(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        solve_constraint(0, group_size);
+        }
+
+    if (exceeded_max_iterations)
+        {
+        m_exec_conf->msg->warning()
+            << "The RATTLE integrator needed an unusual high number of iterations!" << std::endl
+            << "It is recomended to change the initial configuration or lower the step size."
+            << std::endl;
         }
     }
 
@@ -0,0 +1,383 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TypeSwapUpdater.cc
+    \brief Defines the TypeSwapUpdater class
+*/
+
+#include "TypeSwapUpdater.h"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <pybind11/stl.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to attempt moves
+    \param forces Pair potentials that evaluate the energy change
+    \param types Types that particles may change between
+    \param kT Temperature
+    \param trials Number of trial moves per rank and update
+*/
+TypeSwapUpdater::TypeSwapUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                                 std::shared_ptr<Trigger> trigger,
+                                 const std::vector<std::shared_ptr<ForceCompute>>& forces,
+                                 const std::vector<unsigned int>& types,
+                                 std::shared_ptr<Variant> kT,
+                                 unsigned int trials)
+    : Updater(sysdef, trigger), m_forces(forces), m_types(types), m_kT(kT), m_trials(trials)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing TypeSwapUpdater" << endl;
+
+    const unsigned int ntypes = m_pdata->getNTypes();
+    if (m_types.size() < 2)
+        {
+        throw std::runtime_error("TypeSwap needs at least two types.");
+        }
+    m_is_swap_type.resize(ntypes, false);
+    for (unsigned int type : m_types)
+        {
+        if (type >= ntypes || m_is_swap_type[type])
+            {
+            throw std::runtime_error("TypeSwap types must be distinct types of the system.");
+            }
+        m_is_swap_type[type] = true;
+        }
+
+    if (m_forces.empty())
+        {
+        throw std::runtime_error("TypeSwap needs at least one pair potential.");
+        }
+    for (auto& force : m_forces)
+        {
+        auto pair = std::dynamic_pointer_cast<PairParticleEnergy>(force);
+        if (!pair)
+            {
+            throw std::runtime_error("TypeSwap forces must be pair potentials.");
+            }
+        m_pairs.push_back(pair);
+        m_r_cut_nlist.push_back(
+            std::make_shared<GlobalArray<Scalar>>(ntypes * ntypes, m_exec_conf));
+        }
+
+    updateRCutMatrices();
+    for (unsigned int f = 0; f < m_pairs.size(); f++)
+        {
+        auto nlist = m_pairs[f]->getNeighborList();
+        nlist->setStorageMode(NeighborList::full);
+        nlist->addRCutMatrix(m_r_cut_nlist[f]);
+        }
+    }
+
+TypeSwapUpdater::~TypeSwapUpdater()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying TypeSwapUpdater" << endl;
+    notifyDetach();
+    }
+
+void TypeSwapUpdater::notifyDetach()
+    {
+    if (m_attached)
+        {
+        for (unsigned int f = 0; f < m_pairs.size(); f++)
+            {
+            m_pairs[f]->getNeighborList()->removeRCutMatrix(m_r_cut_nlist[f]);
+            }
+        }
+    m_attached = false;
+    }
+
+/*! \param mu Chemical potential of each type in the system
+ */
+void TypeSwapUpdater::setChemicalPotentials(const std::vector<Scalar>& mu)
+    {
+    if (mu.size() != m_pdata->getNTypes())
+        {
+        throw std::runtime_error("TypeSwap needs one chemical potential per type.");
+        }
+    m_mu = mu;
+    }
+
+/*! A particle of a swap type interacts with a particle of type b within the largest cutoff over
+    the swap types for b. When both types are swap types, the cutoff is the largest over all pairs
+    of swap types.
+*/
+void TypeSwapUpdater::updateRCutMatrices()
+    {
+    const unsigned int ntypes = m_pdata->getNTypes();
+    const Index2D typpair_idx(ntypes);
+    m_r_cut_max = Scalar(0.0);
+
+    // the types that each type may become
+    auto reachable = [this](unsigned int type)
+    { return m_is_swap_type[type] ? m_types : std::vector<unsigned int>(1, type); };
+
+    for (unsigned int f = 0; f < m_pairs.size(); f++)
+        {
+        std::vector<Scalar> r_cut(size_t(ntypes) * ntypes, Scalar(0.0));
+        for (unsigned int a = 0; a < ntypes; a++)
+            {
+            for (unsigned int b = 0; b < ntypes; b++)
+                {
+                Scalar& r_cut_ab = r_cut[typpair_idx(a, b)];
+                for (unsigned int a_new : reachable(a))
+                    {
+                    for (unsigned int b_new : reachable(b))
+                        {
+                        r_cut_ab = std::max(r_cut_ab, m_pairs[f]->getTypePairRCut(a_new, b_new));
+                        }
+                    }
+
+                if (m_is_swap_type[a])
+                    {
+                    m_r_cut_max = std::max(m_r_cut_max, r_cut_ab);
+                    }
+                }
+            }
+
+        // release the matrix before the neighbor list reads it
+        auto write_matrix = [&]()
+        {
+        ArrayHandle<Scalar> h_r_cut_nlist(*m_r_cut_nlist[f],
+                                          access_location::host,
+                                          access_mode::readwrite);
+        bool changed = !std::equal(r_cut.begin(), r_cut.end(), h_r_cut_nlist.data);
+        std::copy(r_cut.begin(), r_cut.end(), h_r_cut_nlist.data);
+        return changed;
+        };
+
+        if (write_matrix() && m_attached)
+            {
+            m_pairs[f]->getNeighborList()->notifyRCutMatrixChange();
+            }
+        }
+    }
+
+/*! \returns The minimum distance of a candidate from the faces of the local box, as a fraction of
+    the box in each direction
+
+    With domain decomposition, a candidate must be at least m_r_cut_max away from every face of
+    the local box that borders another rank, so all particles it interacts with are local. The
+    margin is zero in directions that are not decomposed.
+*/
+Scalar3 TypeSwapUpdater::getDomainMargin()
+    {
+    Scalar3 margin = make_scalar3(0.0, 0.0, 0.0);
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        const Scalar3 L = m_pdata->getBox().getNearestPlaneDistance();
+        const Index3D& di = m_pdata->getDomainDecomposition()->getDomainIndexer();
+        if (di.getW() > 1)
+            margin.x = m_r_cut_max / L.x;
+        if (di.getH() > 1)
+            margin.y = m_r_cut_max / L.y;
+        if (di.getD() > 1)
+            margin.z = m_r_cut_max / L.z;
+        }
+#endif
+    return margin;
+    }
+
+void TypeSwapUpdater::findCandidates()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    const BoxDim box = m_pdata->getBox();
+    const Scalar3 margin = getDomainMargin();
+
+    m_candidates.clear();
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        if (!m_is_swap_type[__scalar_as_int(h_pos.data[i].w)])
+            continue;
+
+        const Scalar3 f
+            = box.makeFraction(make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z));
+        if (f.x < margin.x || f.x > Scalar(1.0) - margin.x || f.y < margin.y
+            || f.y > Scalar(1.0) - margin.y || f.z < margin.z || f.z > Scalar(1.0) - margin.z)
+            continue;
+
+        m_candidates.push_back(i);
+        }
+    }
+
+/*! \param idx Local index of the particle
+    \returns The sum of the particle energies over all pair potentials
+*/
+Scalar TypeSwapUpdater::computeParticleEnergy(unsigned int idx)
+    {
+    Scalar energy = Scalar(0.0);
+    for (auto& pair : m_pairs)
+        {
+        energy += pair->computeParticleEnergy(idx);
+        }
+    return energy;
+    }
+
+/*! \param idx Local index of the particle
+    \param type New type
+*/
+void TypeSwapUpdater::setParticleType(unsigned int idx, unsigned int type)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    h_pos.data[idx].w = __int_as_scalar(type);
+    }
+
+/*! \param idx Local index of the particle
+ */
+unsigned int TypeSwapUpdater::getParticleType(unsigned int idx)
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    return __scalar_as_int(h_pos.data[idx].w);
+    }
+
+/*! \param timestep Current time step of the simulation
+
+    Particles keep their positions, so the neighbor lists built for the current configuration
+    remain valid for all trial moves. Selecting both particles of a swap uniformly from the same
+    candidates, and the new type of a semi-grand move uniformly from the other swap types, makes
+    the proposals symmetric.
+*/
+void TypeSwapUpdater::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    updateRCutMatrices();
+    for (auto& pair : m_pairs)
+        {
+        pair->getNeighborList()->compute(timestep);
+        }
+
+    findCandidates();
+    const unsigned int n_candidates = static_cast<unsigned int>(m_candidates.size());
+    if (n_candidates == 0)
+        {
+        return;
+        }
+
+    const Scalar kT = (*m_kT)(timestep);
+    const bool semi_grand = !m_mu.empty();
+    const unsigned int n_types = static_cast<unsigned int>(m_types.size());
+
+    for (unsigned int t = 0; t < m_trials; t++)
+        {
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::UpdaterTypeSwap, timestep, m_sysdef->getSeed()),
+            hoomd::Counter(m_exec_conf->getRank(), t));
+
+        m_n_attempted++;
+        const unsigned int a = m_candidates[hoomd::UniformIntDistribution(n_candidates - 1)(rng)];
+        const unsigned int type_a = getParticleType(a);
+
+        Scalar delta = Scalar(0.0);
+        unsigned int b = a;
+        unsigned int type_b = type_a;
+        unsigned int type_a_new = type_a;
+        if (semi_grand)
+            {
+            // pick one of the other swap types
+            unsigned int k = hoomd::UniformIntDistribution(n_types - 2)(rng);
+            type_a_new = m_types[k];
+            if (type_a_new == type_a)
+                type_a_new = m_types[n_types - 1];
+
+            const Scalar energy_old = computeParticleEnergy(a);
+            setParticleType(a, type_a_new);
+            delta = computeParticleEnergy(a) - energy_old - (m_mu[type_a_new] - m_mu[type_a]);
+            }
+        else
+            {
+            b = m_candidates[hoomd::UniformIntDistribution(n_candidates - 1)(rng)];
+            type_b = getParticleType(b);
+            if (type_b == type_a)
+                continue;
+
+            const Scalar energy_old = computeParticleEnergy(a) + computeParticleEnergy(b);
+            type_a_new = type_b;
+            setParticleType(a, type_b);
+            setParticleType(b, type_a);
+            delta = computeParticleEnergy(a) + computeParticleEnergy(b) - energy_old;
+            }
+
+        if (delta <= Scalar(0.0)
+            || hoomd::detail::generate_canonical<Scalar>(rng) < exp(-delta / kT))
+            {
+            m_n_accepted++;
+            }
+        else
+            {
+            setParticleType(a, type_a);
+            setParticleType(b, type_b);
+            }
+        }
+    }
+
+uint64_t TypeSwapUpdater::getNumAccepted()
+    {
+    uint64_t n = m_n_accepted;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &n,
+                      1,
+                      MPI_UINT64_T,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return n;
+    }
+
+uint64_t TypeSwapUpdater::getNumAttempted()
+    {
+    uint64_t n = m_n_attempted;
+#ifdef ENABLE_MPI
+    if (m_sysdef->isDomainDecomposed())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &n,
+                      1,
+                      MPI_UINT64_T,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+    return n;
+    }
+
+namespace detail
+    {
+void export_TypeSwapUpdater(pybind11::module& m)
+    {
+    pybind11::class_<TypeSwapUpdater, Updater, std::shared_ptr<TypeSwapUpdater>>(m,
+                                                                              "TypeSwapUpdater")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::vector<std::shared_ptr<ForceCompute>>&,
+                            const std::vector<unsigned int>&,
+                            std::shared_ptr<Variant>,
+                            unsigned int>())
+        .def_property("kT", &TypeSwapUpdater::getKT, &TypeSwapUpdater::setKT)
+        .def_property("trials", &TypeSwapUpdater::getTrials, &TypeSwapUpdater::setTrials)
+        .def("setChemicalPotentials", &TypeSwapUpdater::setChemicalPotentials)
+        .def("clearChemicalPotentials", &TypeSwapUpdater::clearChemicalPotentials)
+        .def_property_readonly("num_accepted", &TypeSwapUpdater::getNumAccepted)
+        .def_property_readonly("num_attempted", &TypeSwapUpdater::getNumAttempted);
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,176 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TypeSwapUpdater.h
+    \brief Declares an updater that changes particle types with Monte Carlo moves
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "PairParticleEnergy.h"
+#include "hoomd/ForceCompute.h"
+#include "hoomd/Updater.h"
+#include "hoomd/Variant.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Changes particle types with Metropolis Monte Carlo moves evaluated by MD pair potentials
+/** TypeSwapUpdater runs hybrid MD/MC simulations. Between MD steps, it attempts moves that change
+    the types of particles in the set of swap types:
+
+    - Swap moves exchange the types of two particles, which keeps the composition fixed.
+    - Semi-grand moves change the type of one particle, weighted by the chemical potential
+      difference mu_new - mu_old.
+
+    Both are accepted with the probability min(1, exp(-(Delta U - Delta mu) / kT)). The energy
+    change Delta U sums PairParticleEnergy::computeParticleEnergy() of the moved particles over all
+    pair potentials, before and after the types change. A swap changes the pair between the two
+    moved particles from (t_a, t_b) to (t_b, t_a), so the double count of that pair cancels.
+
+    The moves reuse the neighbor lists of the pair potentials instead of building their own
+    spatial data structures. To keep those lists valid when a particle changes type,
+    TypeSwapUpdater registers an r_cut matrix with each neighbor list that extends the cutoff of
+    every type pair to the largest cutoff over the swap types, and selects a full storage mode.
+    A type change then never needs a neighbor list rebuild.
+
+    With domain decomposition, each rank attempts moves on its own particles that are farther than
+    the largest cutoff from the faces it shares with other ranks. Those particles interact with
+    local particles only, so the ranks need no communication during the moves.
+*/
+class PYBIND11_EXPORT TypeSwapUpdater : public Updater
+    {
+    public:
+    /// Constructor
+    TypeSwapUpdater(std::shared_ptr<SystemDefinition> sysdef,
+                    std::shared_ptr<Trigger> trigger,
+                    const std::vector<std::shared_ptr<ForceCompute>>& forces,
+                    const std::vector<unsigned int>& types,
+                    std::shared_ptr<Variant> kT,
+                    unsigned int trials);
+
+    /// Destructor
+    virtual ~TypeSwapUpdater();
+
+    /// Get the temperature
+    std::shared_ptr<Variant> getKT() const
+        {
+        return m_kT;
+        }
+
+    /// Set the temperature
+    void setKT(std::shared_ptr<Variant> kT)
+        {
+        m_kT = kT;
+        }
+
+    /// Get the number of trial moves per rank and update
+    unsigned int getTrials() const
+        {
+        return m_trials;
+        }
+
+    /// Set the number of trial moves per rank and update
+    void setTrials(unsigned int trials)
+        {
+        m_trials = trials;
+        }
+
+    /// Set the chemical potentials of the types and attempt semi-grand moves
+    void setChemicalPotentials(const std::vector<Scalar>& mu);
+
+    /// Attempt swap moves
+    void clearChemicalPotentials()
+        {
+        m_mu.clear();
+        }
+
+    /// Get the number of accepted moves on all ranks
+    uint64_t getNumAccepted();
+
+    /// Get the number of attempted moves on all ranks
+    uint64_t getNumAttempted();
+
+    /// Attempt type changes
+    virtual void update(uint64_t timestep);
+
+    /// Remove the r_cut matrices from the neighbor lists
+    virtual void notifyDetach();
+
+    protected:
+    /// Compute the r_cut matrices and notify the neighbor lists when they change
+    void updateRCutMatrices();
+
+    /// Get the margin of the candidates from the faces of the local box
+    Scalar3 getDomainMargin();
+
+    /// Find the local particles that may change type
+    void findCandidates();
+
+    /// Compute the energy of a particle with all pair potentials
+    Scalar computeParticleEnergy(unsigned int idx);
+
+    /// Set the type of a local particle
+    void setParticleType(unsigned int idx, unsigned int type);
+
+    /// Get the type of a local particle
+    unsigned int getParticleType(unsigned int idx);
+
+    /// Pair potentials that evaluate the energy change
+    std::vector<std::shared_ptr<ForceCompute>> m_forces;
+
+    /// The pair potentials as PairParticleEnergy
+    std::vector<std::shared_ptr<PairParticleEnergy>> m_pairs;
+
+    /// Extended r_cut matrix of each pair potential, registered with its neighbor list
+    std::vector<std::shared_ptr<GlobalArray<Scalar>>> m_r_cut_nlist;
+
+    /// Types that particles may change between
+    std::vector<unsigned int> m_types;
+
+    /// True for the types in m_types, indexed by type
+    std::vector<bool> m_is_swap_type;
+
+    /// Temperature
+    std::shared_ptr<Variant> m_kT;
+
+    /// Number of trial moves per rank and update
+    unsigned int m_trials;
+
+    /// Chemical potential of each type, empty for swap moves
+    std::vector<Scalar> m_mu;
+
+    /// Largest cutoff of a pair that includes a swap type
+    Scalar m_r_cut_max = Scalar(0.0);
+
+    /// Local indices of the particles that may change type
+    std::vector<unsigned int> m_candidates;
+
+    /// True while the r_cut matrices are registered with the neighbor lists
+    bool m_attached = true;
+
+    /// Number of accepted moves on this rank
+    uint64_t m_n_accepted = 0;
+
+    /// Number of attempted moves on this rank
+    uint64_t m_n_attempted = 0;
+    };
+
+namespace detail
+    {
+/// Export TypeSwapUpdater to python
+void export_TypeSwapUpdater(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
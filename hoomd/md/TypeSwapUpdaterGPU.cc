@@ -0,0 +1,368 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TypeSwapUpdaterGPU.cc
+    \brief Defines the TypeSwapUpdaterGPU class
+*/
+
+#include "TypeSwapUpdaterGPU.h"
+#include "TypeSwapUpdaterGPU.cuh"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <pybind11/stl.h>
+
+#include <stdexcept>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System definition
+    \param trigger Select the timesteps to attempt moves
+    \param forces Pair potentials that evaluate the energy change
+    \param types Types that particles may change between
+    \param kT Temperature
+    \param trials Minimum number of trial moves per rank and update
+*/
+TypeSwapUpdaterGPU::TypeSwapUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                       std::shared_ptr<Trigger> trigger,
+                                       const std::vector<std::shared_ptr<ForceCompute>>& forces,
+                                       const std::vector<unsigned int>& types,
+                                       std::shared_ptr<Variant> kT,
+                                       unsigned int trials)
+    : TypeSwapUpdater(sysdef, trigger, forces, types, kT, trials)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error(
+            "Creating a TypeSwapUpdaterGPU with no GPU in the execution configuration");
+        }
+
+    const unsigned int ntypes = m_pdata->getNTypes();
+    GlobalArray<unsigned int> overflow(1, m_exec_conf);
+    m_overflow.swap(overflow);
+    GlobalArray<unsigned int> counters(2, m_exec_conf);
+    m_counters.swap(counters);
+    GlobalArray<unsigned int> types_gpu(static_cast<unsigned int>(m_types.size()), m_exec_conf);
+    m_types_gpu.swap(types_gpu);
+    GlobalArray<unsigned int> is_swap_type_gpu(ntypes, m_exec_conf);
+    m_is_swap_type_gpu.swap(is_swap_type_gpu);
+    GlobalArray<Scalar> mu_gpu(ntypes, m_exec_conf);
+    m_mu_gpu.swap(mu_gpu);
+
+        {
+        ArrayHandle<unsigned int> h_types(m_types_gpu,
+                                          access_location::host,
+                                          access_mode::overwrite);
+        std::copy(m_types.begin(), m_types.end(), h_types.data);
+        ArrayHandle<unsigned int> h_is_swap_type(m_is_swap_type_gpu,
+                                                 access_location::host,
+                                                 access_mode::overwrite);
+        for (unsigned int type = 0; type < ntypes; type++)
+            h_is_swap_type.data[type] = m_is_swap_type[type] ? 1 : 0;
+        }
+
+    m_tuner.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                   m_exec_conf,
+                                   "type_swap"));
+    m_autotuners.push_back(m_tuner);
+    }
+
+/*! \param n_cells Number of active cells per round
+ */
+void TypeSwapUpdaterGPU::resizeCellArrays(unsigned int n_cells)
+    {
+    if (m_cell_size.getNumElements() < n_cells
+        || m_cell_idx.getNumElements() < size_t(n_cells) * m_cell_n_max)
+        {
+        GlobalArray<unsigned int> cell_size(n_cells, m_exec_conf);
+        m_cell_size.swap(cell_size);
+        TAG_ALLOCATION(m_cell_size);
+        GlobalArray<unsigned int> cell_idx(size_t(n_cells) * m_cell_n_max, m_exec_conf);
+        m_cell_idx.swap(cell_idx);
+        TAG_ALLOCATION(m_cell_idx);
+        }
+
+    if (m_move_idx.getNumElements() < 2 * n_cells)
+        {
+        GlobalArray<unsigned int> move_idx(2 * n_cells, m_exec_conf);
+        m_move_idx.swap(move_idx);
+        GlobalArray<unsigned int> move_old_type(2 * n_cells, m_exec_conf);
+        m_move_old_type.swap(move_old_type);
+        GlobalArray<unsigned int> move_new_type(2 * n_cells, m_exec_conf);
+        m_move_new_type.swap(move_new_type);
+        GlobalArray<Scalar> energy_old(2 * n_cells, m_exec_conf);
+        m_energy_old.swap(energy_old);
+        GlobalArray<Scalar> energy_new(2 * n_cells, m_exec_conf);
+        m_energy_new.swap(energy_new);
+        }
+    }
+
+/*! \param timestep Current time step of the simulation
+ */
+void TypeSwapUpdaterGPU::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+    updateRCutMatrices();
+    for (auto& pair : m_pairs)
+        {
+        pair->getNeighborList()->compute(timestep);
+        }
+
+    if (m_trials == 0)
+        return;
+
+    // checkerboard cells at least as wide as the largest cutoff, an even number per direction
+    const bool two_d = m_sysdef->getNDimensions() == 2;
+    const BoxDim box = m_pdata->getBox();
+    const Scalar3 L = box.getNearestPlaneDistance();
+    uint3 n_cells = make_uint3(static_cast<unsigned int>(L.x / m_r_cut_max),
+                               static_cast<unsigned int>(L.y / m_r_cut_max),
+                               two_d ? 1 : static_cast<unsigned int>(L.z / m_r_cut_max));
+    n_cells.x -= n_cells.x % 2;
+    n_cells.y -= n_cells.y % 2;
+    if (!two_d)
+        n_cells.z -= n_cells.z % 2;
+    if (n_cells.x < 2 || n_cells.y < 2 || (!two_d && n_cells.z < 2))
+        {
+        throw std::runtime_error("TypeSwap on the GPU needs a local box at least 2 r_cut wide.");
+        }
+
+    kernel::type_swap_round_args_t args;
+    args.active_idx = Index3D(n_cells.x / 2, n_cells.y / 2, two_d ? 1 : n_cells.z / 2);
+    args.n_cells = n_cells;
+    args.timestep = timestep;
+    args.seed = m_sysdef->getSeed();
+    args.rank = m_exec_conf->getRank();
+    args.semi_grand = !m_mu.empty();
+    args.n_types = static_cast<unsigned int>(m_types.size());
+
+    const unsigned int n_active = args.active_idx.getNumElements();
+    const unsigned int n_rounds = (m_trials + n_active - 1) / n_active;
+    const unsigned int n_colors = two_d ? 4 : 8;
+    const Scalar3 margin = getDomainMargin();
+    const Scalar kT = (*m_kT)(timestep);
+    resizeCellArrays(n_active);
+
+    if (args.semi_grand)
+        {
+        ArrayHandle<Scalar> h_mu(m_mu_gpu, access_location::host, access_mode::overwrite);
+        std::copy(m_mu.begin(), m_mu.end(), h_mu.data);
+        }
+
+        {
+        ArrayHandle<unsigned int> d_counters(m_counters,
+                                             access_location::device,
+                                             access_mode::overwrite);
+        hipMemset(d_counters.data, 0, sizeof(unsigned int) * 2);
+        }
+
+    for (unsigned int round = 0; round < n_rounds; round++)
+        {
+        hoomd::RandomGenerator rng(
+            hoomd::Seed(hoomd::RNGIdentifier::UpdaterTypeSwap, timestep, args.seed),
+            hoomd::Counter(args.rank, round, 0, 0));
+        const unsigned int color = hoomd::UniformIntDistribution(n_colors - 1)(rng);
+        args.color = make_uint3(color & 1, (color >> 1) & 1, (color >> 2) & 1);
+        args.shift.x = hoomd::detail::generate_canonical<Scalar>(rng);
+        args.shift.y = hoomd::detail::generate_canonical<Scalar>(rng);
+        args.shift.z = two_d ? Scalar(0.0) : hoomd::detail::generate_canonical<Scalar>(rng);
+        args.round = round;
+
+        // bin the candidates, growing the cells until they fit
+        bool overflowed = true;
+        while (overflowed)
+            {
+                {
+                ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                           access_location::device,
+                                           access_mode::read);
+                ArrayHandle<unsigned int> d_is_swap_type(m_is_swap_type_gpu,
+                                                         access_location::device,
+                                                         access_mode::read);
+                ArrayHandle<unsigned int> d_cell_size(m_cell_size,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+                ArrayHandle<unsigned int> d_cell_idx(m_cell_idx,
+                                                     access_location::device,
+                                                     access_mode::overwrite);
+                ArrayHandle<unsigned int> d_overflow(m_overflow,
+                                                     access_location::device,
+                                                     access_mode::overwrite);
+                hipMemset(d_cell_size.data, 0, sizeof(unsigned int) * n_active);
+                hipMemset(d_overflow.data, 0, sizeof(unsigned int));
+
+                args.cell_n_max = m_cell_n_max;
+                m_tuner->begin();
+                kernel::gpu_type_swap_bin(d_cell_size.data,
+                                          d_cell_idx.data,
+                                          d_overflow.data,
+                                          d_pos.data,
+                                          m_pdata->getN(),
+                                          box,
+                                          d_is_swap_type.data,
+                                          margin,
+                                          args,
+                                          m_tuner->getParam()[0]);
+                if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                    CHECK_CUDA_ERROR();
+                m_tuner->end();
+                }
+
+            ArrayHandle<unsigned int> h_overflow(m_overflow,
+                                                 access_location::host,
+                                                 access_mode::read);
+            overflowed = h_overflow.data[0] > m_cell_n_max;
+            if (overflowed)
+                {
+                m_cell_n_max = h_overflow.data[0];
+                resizeCellArrays(n_active);
+                }
+            }
+
+        const unsigned int block_size = m_tuner->getParam()[0];
+
+            {
+            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::read);
+            ArrayHandle<unsigned int> d_cell_size(m_cell_size,
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<unsigned int> d_cell_idx(m_cell_idx,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_types(m_types_gpu,
+                                              access_location::device,
+                                              access_mode::read);
+            ArrayHandle<unsigned int> d_move_idx(m_move_idx,
+                                                 access_location::device,
+                                                 access_mode::overwrite);
+            ArrayHandle<unsigned int> d_move_old_type(m_move_old_type,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+            ArrayHandle<unsigned int> d_move_new_type(m_move_new_type,
+                                                      access_location::device,
+                                                      access_mode::overwrite);
+            ArrayHandle<Scalar> d_energy_old(m_energy_old,
+                                             access_location::device,
+                                             access_mode::overwrite);
+            ArrayHandle<Scalar> d_energy_new(m_energy_new,
+                                             access_location::device,
+                                             access_mode::overwrite);
+            hipMemset(d_energy_old.data, 0, sizeof(Scalar) * 2 * n_active);
+            hipMemset(d_energy_new.data, 0, sizeof(Scalar) * 2 * n_active);
+
+            args.d_types = d_types.data;
+            kernel::gpu_type_swap_propose(d_move_idx.data,
+                                          d_move_old_type.data,
+                                          d_move_new_type.data,
+                                          d_cell_size.data,
+                                          d_cell_idx.data,
+                                          d_pos.data,
+                                          args,
+                                          block_size);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+
+        for (auto& pair : m_pairs)
+            {
+            pair->addParticleEnergies(m_move_idx, 2 * n_active, m_energy_old);
+            }
+
+            {
+            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+            ArrayHandle<unsigned int> d_move_idx(m_move_idx,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_move_new_type(m_move_new_type,
+                                                      access_location::device,
+                                                      access_mode::read);
+            kernel::gpu_type_swap_apply(d_pos.data,
+                                        d_move_idx.data,
+                                        d_move_new_type.data,
+                                        2 * n_active,
+                                        block_size);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+
+        for (auto& pair : m_pairs)
+            {
+            pair->addParticleEnergies(m_move_idx, 2 * n_active, m_energy_new);
+            }
+
+            {
+            ArrayHandle<Scalar4> d_pos(m_pdata->getPositions(),
+                                       access_location::device,
+                                       access_mode::readwrite);
+            ArrayHandle<unsigned int> d_counters(m_counters,
+                                                 access_location::device,
+                                                 access_mode::readwrite);
+            ArrayHandle<unsigned int> d_move_idx(m_move_idx,
+                                                 access_location::device,
+                                                 access_mode::read);
+            ArrayHandle<unsigned int> d_move_old_type(m_move_old_type,
+                                                      access_location::device,
+                                                      access_mode::read);
+            ArrayHandle<unsigned int> d_move_new_type(m_move_new_type,
+                                                      access_location::device,
+                                                      access_mode::read);
+            ArrayHandle<unsigned int> d_cell_size(m_cell_size,
+                                                  access_location::device,
+                                                  access_mode::read);
+            ArrayHandle<Scalar> d_energy_old(m_energy_old,
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<Scalar> d_energy_new(m_energy_new,
+                                             access_location::device,
+                                             access_mode::read);
+            ArrayHandle<Scalar> d_mu(m_mu_gpu, access_location::device, access_mode::read);
+            kernel::gpu_type_swap_accept(d_pos.data,
+                                         d_counters.data,
+                                         d_move_idx.data,
+                                         d_move_old_type.data,
+                                         d_move_new_type.data,
+                                         d_cell_size.data,
+                                         d_energy_old.data,
+                                         d_energy_new.data,
+                                         d_mu.data,
+                                         kT,
+                                         args,
+                                         block_size);
+            if (m_exec_conf->isCUDAErrorCheckingEnabled())
+                CHECK_CUDA_ERROR();
+            }
+        }
+
+    ArrayHandle<unsigned int> h_counters(m_counters, access_location::host, access_mode::read);
+    m_n_accepted += h_counters.data[0];
+    m_n_attempted += h_counters.data[1];
+    }
+
+namespace detail
+    {
+void export_TypeSwapUpdaterGPU(pybind11::module& m)
+    {
+    pybind11::class_<TypeSwapUpdaterGPU, TypeSwapUpdater, std::shared_ptr<TypeSwapUpdaterGPU>>(
+        m,
+        "TypeSwapUpdaterGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>,
+                            std::shared_ptr<Trigger>,
+                            const std::vector<std::shared_ptr<ForceCompute>>&,
+                            const std::vector<unsigned int>&,
+                            std::shared_ptr<Variant>,
+                            unsigned int>());
+    }
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
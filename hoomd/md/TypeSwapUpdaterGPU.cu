@@ -0,0 +1,381 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "TypeSwapUpdaterGPU.cuh"
+#include "hoomd/RNGIdentifiers.h"
+#include "hoomd/RandomNumbers.h"
+
+#include <assert.h>
+
+/*! \file TypeSwapUpdaterGPU.cu
+    \brief Defines GPU kernel code for the checkerboard type swap moves. Used by
+    TypeSwapUpdaterGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Marks an unused entry of the move arrays
+const unsigned int type_swap_no_particle = 0xffffffff;
+
+//! Kernel that sorts the candidates of the active cells into the cells
+/*! \param d_cell_size Number of candidates in each active cell (output)
+    \param d_cell_idx Local indices of the candidates, cell_n_max per cell (output)
+    \param d_overflow Largest cell size that exceeded the capacity (output)
+    \param d_pos Particle positions and types
+    \param N Number of local particles
+    \param box Local box
+    \param d_is_swap_type Nonzero for the types that particles may change between
+    \param margin Minimum fractional distance of a candidate from the faces of the box
+    \param args Arguments of the round
+
+    Each thread places one particle. The shifted grid wraps around the box, and the number of cells
+    in each direction is even, so the active cells of one color never touch.
+*/
+__global__ void gpu_type_swap_bin_kernel(unsigned int* d_cell_size,
+                                         unsigned int* d_cell_idx,
+                                         unsigned int* d_overflow,
+                                         const Scalar4* d_pos,
+                                         const unsigned int N,
+                                         const BoxDim box,
+                                         const unsigned int* d_is_swap_type,
+                                         const Scalar3 margin,
+                                         const type_swap_round_args_t args)
+    {
+    unsigned int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if (i >= N)
+        return;
+
+    const Scalar4 postype = d_pos[i];
+    if (!d_is_swap_type[__scalar_as_int(postype.w)])
+        return;
+
+    const Scalar3 f = box.makeFraction(make_scalar3(postype.x, postype.y, postype.z));
+    if (f.x < margin.x || f.x > Scalar(1.0) - margin.x || f.y < margin.y
+        || f.y > Scalar(1.0) - margin.y || f.z < margin.z || f.z > Scalar(1.0) - margin.z)
+        return;
+
+    Scalar3 g = f + args.shift;
+    g.x -= floor(g.x);
+    g.y -= floor(g.y);
+    g.z -= floor(g.z);
+    const unsigned int cx = min((unsigned int)(g.x * args.n_cells.x), args.n_cells.x - 1);
+    const unsigned int cy = min((unsigned int)(g.y * args.n_cells.y), args.n_cells.y - 1);
+    const unsigned int cz = min((unsigned int)(g.z * args.n_cells.z), args.n_cells.z - 1);
+    if ((cx & 1) != args.color.x || (cy & 1) != args.color.y || (cz & 1) != args.color.z)
+        return;
+
+    const unsigned int cell = args.active_idx(cx / 2, cy / 2, cz / 2);
+    const unsigned int slot = atomicAdd(d_cell_size + cell, 1);
+    if (slot < args.cell_n_max)
+        d_cell_idx[cell * args.cell_n_max + slot] = i;
+    else
+        atomicMax(d_overflow, slot + 1);
+    }
+
+//! Kernel that selects the particles of one move in each active cell
+/*! \param d_move_idx Local indices of the two particles of each move (output)
+    \param d_move_old_type Current types of the particles (output)
+    \param d_move_new_type Proposed types of the particles (output)
+    \param d_cell_size Number of candidates in each active cell
+    \param d_cell_idx Local indices of the candidates
+    \param d_pos Particle positions and types
+    \param args Arguments of the round
+
+    A semi-grand move uses only the first particle. Moves that would not change any type mark
+    both particles with type_swap_no_particle.
+*/
+__global__ void gpu_type_swap_propose_kernel(unsigned int* d_move_idx,
+                                             unsigned int* d_move_old_type,
+                                             unsigned int* d_move_new_type,
+                                             const unsigned int* d_cell_size,
+                                             const unsigned int* d_cell_idx,
+                                             const Scalar4* d_pos,
+                                             const type_swap_round_args_t args)
+    {
+    unsigned int cell = blockIdx.x * blockDim.x + threadIdx.x;
+    if (cell >= args.active_idx.getNumElements())
+        return;
+
+    d_move_idx[2 * cell] = type_swap_no_particle;
+    d_move_idx[2 * cell + 1] = type_swap_no_particle;
+
+    const unsigned int size = min(d_cell_size[cell], args.cell_n_max);
+    if (size == 0)
+        return;
+
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::UpdaterTypeSwap, args.timestep, args.seed),
+        hoomd::Counter(args.rank, args.round, cell, 1));
+
+    const unsigned int* cell_idx = d_cell_idx + cell * args.cell_n_max;
+    const unsigned int a = cell_idx[hoomd::UniformIntDistribution(size - 1)(rng)];
+    const unsigned int type_a = __scalar_as_int(d_pos[a].w);
+
+    if (args.semi_grand)
+        {
+        // pick one of the other swap types
+        unsigned int k = hoomd::UniformIntDistribution(args.n_types - 2)(rng);
+        unsigned int type_a_new = args.d_types[k];
+        if (type_a_new == type_a)
+            type_a_new = args.d_types[args.n_types - 1];
+
+        d_move_idx[2 * cell] = a;
+        d_move_old_type[2 * cell] = type_a;
+        d_move_new_type[2 * cell] = type_a_new;
+        }
+    else
+        {
+        const unsigned int b = cell_idx[hoomd::UniformIntDistribution(size - 1)(rng)];
+        const unsigned int type_b = __scalar_as_int(d_pos[b].w);
+        if (type_b == type_a)
+            return;
+
+        d_move_idx[2 * cell] = a;
+        d_move_old_type[2 * cell] = type_a;
+        d_move_new_type[2 * cell] = type_b;
+        d_move_idx[2 * cell + 1] = b;
+        d_move_old_type[2 * cell + 1] = type_b;
+        d_move_new_type[2 * cell + 1] = type_a;
+        }
+    }
+
+//! Kernel that writes the new types of the proposed moves
+/*! \param d_pos Particle positions and types (output)
+    \param d_move_idx Local indices of the particles of the moves
+    \param d_move_new_type Proposed types of the particles
+    \param n_moves Number of entries in \a d_move_idx
+*/
+__global__ void gpu_type_swap_apply_kernel(Scalar4* d_pos,
+                                           const unsigned int* d_move_idx,
+                                           const unsigned int* d_move_new_type,
+                                           const unsigned int n_moves)
+    {
+    unsigned int k = blockIdx.x * blockDim.x + threadIdx.x;
+    if (k >= n_moves)
+        return;
+
+    const unsigned int idx = d_move_idx[k];
+    if (idx != type_swap_no_particle)
+        d_pos[idx].w = __int_as_scalar(d_move_new_type[k]);
+    }
+
+//! Kernel that accepts or rejects the moves
+/*! \param d_pos Particle positions and types (output)
+    \param d_counters Number of accepted and attempted moves, added to (output)
+    \param d_move_idx Local indices of the particles of the moves
+    \param d_move_old_type Types of the particles before the moves
+    \param d_move_new_type Proposed types of the particles
+    \param d_cell_size Number of candidates in each active cell
+    \param d_energy_old Energies of the particles before the moves
+    \param d_energy_new Energies of the particles after the moves
+    \param d_mu Chemical potential of each type, only read for semi-grand moves
+    \param kT Temperature
+    \param args Arguments of the round
+
+    A move is attempted in every active cell that has a candidate, like a trial of the CPU
+    implementation.
+*/
+__global__ void gpu_type_swap_accept_kernel(Scalar4* d_pos,
+                                            unsigned int* d_counters,
+                                            const unsigned int* d_move_idx,
+                                            const unsigned int* d_move_old_type,
+                                            const unsigned int* d_move_new_type,
+                                            const unsigned int* d_cell_size,
+                                            const Scalar* d_energy_old,
+                                            const Scalar* d_energy_new,
+                                            const Scalar* d_mu,
+                                            const Scalar kT,
+                                            const type_swap_round_args_t args)
+    {
+    unsigned int cell = blockIdx.x * blockDim.x + threadIdx.x;
+    if (cell >= args.active_idx.getNumElements() || d_cell_size[cell] == 0)
+        return;
+
+    atomicAdd(d_counters + 1, 1);
+
+    const unsigned int a = d_move_idx[2 * cell];
+    const unsigned int b = d_move_idx[2 * cell + 1];
+    if (a == type_swap_no_particle)
+        return;
+
+    Scalar delta = d_energy_new[2 * cell] + d_energy_new[2 * cell + 1] - d_energy_old[2 * cell]
+                   - d_energy_old[2 * cell + 1];
+    if (args.semi_grand)
+        delta -= d_mu[d_move_new_type[2 * cell]] - d_mu[d_move_old_type[2 * cell]];
+
+    hoomd::RandomGenerator rng(
+        hoomd::Seed(hoomd::RNGIdentifier::UpdaterTypeSwap, args.timestep, args.seed),
+        hoomd::Counter(args.rank, args.round, cell, 2));
+
+    if (delta <= Scalar(0.0) || hoomd::detail::generate_canonical<Scalar>(rng) < exp(-delta / kT))
+        {
+        atomicAdd(d_counters, 1);
+        }
+    else
+        {
+        d_pos[a].w = __int_as_scalar(d_move_old_type[2 * cell]);
+        if (b != type_swap_no_particle)
+            d_pos[b].w = __int_as_scalar(d_move_old_type[2 * cell + 1]);
+        }
+    }
+
+/*! \param d_cell_size Number of candidates in each active cell (output)
+    \param d_cell_idx Local indices of the candidates (output)
+    \param d_overflow Largest cell size that exceeded the capacity (output)
+    \param d_pos Particle positions and types
+    \param N Number of local particles
+    \param box Local box
+    \param d_is_swap_type Nonzero for the types that particles may change between
+    \param margin Minimum fractional distance of a candidate from the faces of the box
+    \param args Arguments of the round
+    \param block_size Number of threads per block
+
+    The caller zeroes \a d_cell_size and \a d_overflow.
+*/
+hipError_t gpu_type_swap_bin(unsigned int* d_cell_size,
+                             unsigned int* d_cell_idx,
+                             unsigned int* d_overflow,
+                             const Scalar4* d_pos,
+                             const unsigned int N,
+                             const BoxDim& box,
+                             const unsigned int* d_is_swap_type,
+                             const Scalar3 margin,
+                             const type_swap_round_args_t& args,
+                             const unsigned int block_size)
+    {
+    assert(d_cell_size);
+    assert(d_cell_idx);
+    assert(d_overflow);
+
+    hipLaunchKernelGGL((gpu_type_swap_bin_kernel),
+                       dim3(N / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_cell_size,
+                       d_cell_idx,
+                       d_overflow,
+                       d_pos,
+                       N,
+                       box,
+                       d_is_swap_type,
+                       margin,
+                       args);
+
+    return hipSuccess;
+    }
+
+/*! \param d_move_idx Local indices of the two particles of each move (output)
+    \param d_move_old_type Current types of the particles (output)
+    \param d_move_new_type Proposed types of the particles (output)
+    \param d_cell_size Number of candidates in each active cell
+    \param d_cell_idx Local indices of the candidates
+    \param d_pos Particle positions and types
+    \param args Arguments of the round
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_type_swap_propose(unsigned int* d_move_idx,
+                                 unsigned int* d_move_old_type,
+                                 unsigned int* d_move_new_type,
+                                 const unsigned int* d_cell_size,
+                                 const unsigned int* d_cell_idx,
+                                 const Scalar4* d_pos,
+                                 const type_swap_round_args_t& args,
+                                 const unsigned int block_size)
+    {
+    const unsigned int n_cells = args.active_idx.getNumElements();
+    hipLaunchKernelGGL((gpu_type_swap_propose_kernel),
+                       dim3(n_cells / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_move_idx,
+                       d_move_old_type,
+                       d_move_new_type,
+                       d_cell_size,
+                       d_cell_idx,
+                       d_pos,
+                       args);
+
+    return hipSuccess;
+    }
+
+/*! \param d_pos Particle positions and types (output)
+    \param d_move_idx Local indices of the particles of the moves
+    \param d_move_new_type Proposed types of the particles
+    \param n_moves Number of entries in \a d_move_idx
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_type_swap_apply(Scalar4* d_pos,
+                               const unsigned int* d_move_idx,
+                               const unsigned int* d_move_new_type,
+                               const unsigned int n_moves,
+                               const unsigned int block_size)
+    {
+    hipLaunchKernelGGL((gpu_type_swap_apply_kernel),
+                       dim3(n_moves / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_pos,
+                       d_move_idx,
+                       d_move_new_type,
+                       n_moves);
+
+    return hipSuccess;
+    }
+
+/*! \param d_pos Particle positions and types (output)
+    \param d_counters Number of accepted and attempted moves, added to (output)
+    \param d_move_idx Local indices of the particles of the moves
+    \param d_move_old_type Types of the particles before the moves
+    \param d_move_new_type Proposed types of the particles
+    \param d_cell_size Number of candidates in each active cell
+    \param d_energy_old Energies of the particles before the moves
+    \param d_energy_new Energies of the particles after the moves
+    \param d_mu Chemical potential of each type, only read for semi-grand moves
+    \param kT Temperature
+    \param args Arguments of the round
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_type_swap_accept(Scalar4* d_pos,
+                                unsigned int* d_counters,
+                                const unsigned int* d_move_idx,
+                                const unsigned int* d_move_old_type,
+                                const unsigned int* d_move_new_type,
+                                const unsigned int* d_cell_size,
+                                const Scalar* d_energy_old,
+                                const Scalar* d_energy_new,
+                                const Scalar* d_mu,
+                                const Scalar kT,
+                                const type_swap_round_args_t& args,
+                                const unsigned int block_size)
+    {
+    const unsigned int n_cells = args.active_idx.getNumElements();
+    hipLaunchKernelGGL((gpu_type_swap_accept_kernel),
+                       dim3(n_cells / block_size + 1),
+                       dim3(block_size),
+                       0,
+                       0,
+                       d_pos,
+                       d_counters,
+                       d_move_idx,
+                       d_move_old_type,
+                       d_move_new_type,
+                       d_cell_size,
+                       d_energy_old,
+                       d_energy_new,
+                       d_mu,
+                       kT,
+                       args);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
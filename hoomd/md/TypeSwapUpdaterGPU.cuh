@@ -0,0 +1,89 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/Index1D.h"
+
+#include <stdint.h>
+
+/*! \file TypeSwapUpdaterGPU.cuh
+    \brief Declares GPU kernel code for the checkerboard type swap moves. Used by
+    TypeSwapUpdaterGPU.
+*/
+
+#ifndef __TYPE_SWAP_UPDATER_GPU_CUH__
+#define __TYPE_SWAP_UPDATER_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Arguments of one round of checkerboard moves
+struct type_swap_round_args_t
+    {
+    Index3D active_idx;          //!< Indexes the active cells of the round
+    uint3 n_cells;               //!< Number of checkerboard cells in each direction
+    uint3 color;                 //!< Parity of the active cells in each direction
+    Scalar3 shift;               //!< Random shift of the grid, as a fraction of the box
+    uint64_t timestep;           //!< Current timestep
+    uint16_t seed;               //!< Simulation seed
+    unsigned int rank;           //!< MPI rank
+    unsigned int round;          //!< Index of the round in this update
+    unsigned int cell_n_max;     //!< Capacity of each cell
+    const unsigned int* d_types; //!< Types that particles may change between
+    unsigned int n_types;        //!< Number of entries in d_types
+    bool semi_grand;             //!< Attempt semi-grand moves instead of swaps
+    };
+
+//! Sort the candidates of the active cells into the cells
+hipError_t gpu_type_swap_bin(unsigned int* d_cell_size,
+                             unsigned int* d_cell_idx,
+                             unsigned int* d_overflow,
+                             const Scalar4* d_pos,
+                             const unsigned int N,
+                             const BoxDim& box,
+                             const unsigned int* d_is_swap_type,
+                             const Scalar3 margin,
+                             const type_swap_round_args_t& args,
+                             const unsigned int block_size);
+
+//! Select the particles of one move in each active cell
+hipError_t gpu_type_swap_propose(unsigned int* d_move_idx,
+                                 unsigned int* d_move_old_type,
+                                 unsigned int* d_move_new_type,
+                                 const unsigned int* d_cell_size,
+                                 const unsigned int* d_cell_idx,
+                                 const Scalar4* d_pos,
+                                 const type_swap_round_args_t& args,
+                                 const unsigned int block_size);
+
+//! Write the new types of the proposed moves
+hipError_t gpu_type_swap_apply(Scalar4* d_pos,
+                               const unsigned int* d_move_idx,
+                               const unsigned int* d_move_new_type,
+                               const unsigned int n_moves,
+                               const unsigned int block_size);
+
+//! Accept or reject the moves and restore the types of the rejected ones
+hipError_t gpu_type_swap_accept(Scalar4* d_pos,
+                                unsigned int* d_counters,
+                                const unsigned int* d_move_idx,
+                                const unsigned int* d_move_old_type,
+                                const unsigned int* d_move_new_type,
+                                const unsigned int* d_cell_size,
+                                const Scalar* d_energy_old,
+                                const Scalar* d_energy_new,
+                                const Scalar* d_mu,
+                                const Scalar kT,
+                                const type_swap_round_args_t& args,
+                                const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
@@ -0,0 +1,113 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file TypeSwapUpdaterGPU.h
+    \brief Declares the GPU implementation of TypeSwapUpdater
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "TypeSwapUpdater.h"
+#include "hoomd/Autotuner.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+
+#pragma once
+
+namespace hoomd
+    {
+namespace md
+    {
+/// Changes particle types with parallel Metropolis Monte Carlo moves on the GPU
+/** TypeSwapUpdaterGPU attempts the moves in rounds. Each round shifts a grid of checkerboard
+    cells by a random vector and activates the cells of one random color. The cells are at least
+    as wide as the largest cutoff of the swap types and every direction has an even number of
+    cells, so no particle in one active cell interacts with a particle in another. Each active cell
+    then attempts one move among its candidates, independently of the other cells:
+
+    1. Bin the candidates of the active cells.
+    2. Select the particles and new types of one move per cell.
+    3. Evaluate the energies of the selected particles with
+       PairParticleEnergy::addParticleEnergies().
+    4. Write the new types and evaluate the energies again.
+    5. Accept or reject each move, and restore the types of the rejected ones.
+
+    Swap moves exchange the types of two candidates of the same cell. The rounds continue until at
+    least getTrials() moves are attempted, so one update may attempt more than getTrials() moves.
+
+    The particle data stays on the GPU throughout. Only the number of accepted and attempted
+    moves is copied to the host, once per update.
+*/
+class PYBIND11_EXPORT TypeSwapUpdaterGPU : public TypeSwapUpdater
+    {
+    public:
+    /// Constructor
+    TypeSwapUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<Trigger> trigger,
+                       const std::vector<std::shared_ptr<ForceCompute>>& forces,
+                       const std::vector<unsigned int>& types,
+                       std::shared_ptr<Variant> kT,
+                       unsigned int trials);
+
+    /// Attempt type changes
+    virtual void update(uint64_t timestep);
+
+    protected:
+    /// Number of candidates in each active cell
+    GlobalArray<unsigned int> m_cell_size;
+
+    /// Local indices of the candidates of each active cell
+    GlobalArray<unsigned int> m_cell_idx;
+
+    /// Capacity of each cell in m_cell_idx
+    unsigned int m_cell_n_max = 8;
+
+    /// Largest cell size that exceeded m_cell_n_max
+    GlobalArray<unsigned int> m_overflow;
+
+    /// Local indices of the two particles of each move
+    GlobalArray<unsigned int> m_move_idx;
+
+    /// Types of the particles before the moves
+    GlobalArray<unsigned int> m_move_old_type;
+
+    /// Proposed types of the particles
+    GlobalArray<unsigned int> m_move_new_type;
+
+    /// Energies of the particles before the moves
+    GlobalArray<Scalar> m_energy_old;
+
+    /// Energies of the particles after the moves
+    GlobalArray<Scalar> m_energy_new;
+
+    /// Number of accepted and attempted moves in the current update
+    GlobalArray<unsigned int> m_counters;
+
+    /// Types that particles may change between
+    GlobalArray<unsigned int> m_types_gpu;
+
+    /// Nonzero for the types in m_types, indexed by type
+    GlobalArray<unsigned int> m_is_swap_type_gpu;
+
+    /// Chemical potential of each type
+    GlobalArray<Scalar> m_mu_gpu;
+
+    /// Autotuner for the block size of the kernels
+    std::shared_ptr<Autotuner<1>> m_tuner;
+
+    /// Resize the per-cell arrays to hold n_cells active cells
+    void resizeCellArrays(unsigned int n_cells);
+    };
+
+namespace detail
+    {
+/// Export TypeSwapUpdaterGPU to python
+void export_TypeSwapUpdaterGPU(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
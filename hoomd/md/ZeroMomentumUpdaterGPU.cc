@@ -0,0 +1,119 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.cc
+    \brief Defines the ZeroMomentumUpdaterGPU class
+*/
+
+#include "ZeroMomentumUpdaterGPU.h"
+#include "ZeroMomentumUpdaterGPU.cuh"
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to zero the momentum of
+    \param trigger Steps on which to zero the momentum
+ */
+ZeroMomentumUpdaterGPU::ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                                               std::shared_ptr<Trigger> trigger)
+    : ZeroMomentumUpdater(sysdef, trigger)
+    {
+    if (!m_exec_conf->isCUDAEnabled())
+        {
+        throw std::runtime_error("Cannot initialize ZeroMomentumUpdaterGPU on a CPU device.");
+        }
+
+    GlobalArray<Scalar4> sum(1, m_exec_conf);
+    m_sum.swap(sum);
+    TAG_ALLOCATION(m_sum);
+
+    m_tuner_sum.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                       m_exec_conf,
+                                       "zero_momentum_sum"));
+    m_tuner_subtract.reset(new Autotuner<1>({AutotunerBase::makeBlockSizeRange(m_exec_conf)},
+                                            m_exec_conf,
+                                            "zero_momentum_subtract"));
+    m_autotuners.insert(m_autotuners.end(), {m_tuner_sum, m_tuner_subtract});
+    }
+
+/*! Perform the needed calculations to zero the system's momentum
+    \param timestep Current time step of the simulation
+*/
+void ZeroMomentumUpdaterGPU::update(uint64_t timestep)
+    {
+    Updater::update(timestep);
+
+        {
+        ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::overwrite);
+        ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                                   access_location::device,
+                                   access_mode::read);
+        ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                         access_location::device,
+                                         access_mode::read);
+        ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                        access_location::device,
+                                        access_mode::read);
+
+        m_tuner_sum->begin();
+        kernel::gpu_zero_momentum_sum(d_sum.data,
+                                      d_vel.data,
+                                      d_body.data,
+                                      d_tag.data,
+                                      m_pdata->getN(),
+                                      m_exec_conf->getCachedAllocator(),
+                                      m_tuner_sum->getParam()[0]);
+        if (m_exec_conf->isCUDAErrorCheckingEnabled())
+            CHECK_CUDA_ERROR();
+        m_tuner_sum->end();
+        }
+
+#ifdef ENABLE_MPI
+    if (m_pdata->getDomainDecomposition())
+        {
+        ArrayHandle<Scalar4> h_sum(m_sum, access_location::host, access_mode::readwrite);
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &h_sum.data[0],
+                      4,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    ArrayHandle<Scalar4> d_sum(m_sum, access_location::device, access_mode::read);
+    ArrayHandle<Scalar4> d_vel(m_pdata->getVelocities(),
+                               access_location::device,
+                               access_mode::readwrite);
+    ArrayHandle<unsigned int> d_body(m_pdata->getBodies(),
+                                     access_location::device,
+                                     access_mode::read);
+    ArrayHandle<unsigned int> d_tag(m_pdata->getTags(),
+                                    access_location::device,
+                                    access_mode::read);
+
+    m_tuner_subtract->begin();
+    kernel::gpu_zero_momentum_subtract(d_vel.data,
+                                       d_body.data,
+                                       d_tag.data,
+                                       d_sum.data,
+                                       m_pdata->getN(),
+                                       m_tuner_subtract->getParam()[0]);
+    if (m_exec_conf->isCUDAErrorCheckingEnabled())
+        CHECK_CUDA_ERROR();
+    m_tuner_subtract->end();
+    }
+
+namespace detail
+    {
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m)
+    {
+    pybind11::class_<ZeroMomentumUpdaterGPU,
+                     ZeroMomentumUpdater,
+                     std::shared_ptr<ZeroMomentumUpdaterGPU>>(m, "ZeroMomentumUpdaterGPU")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<Trigger>>());
+    }
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,185 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ZeroMomentumUpdaterGPU.cuh"
+#include "hoomd/ParticleData.cuh"
+
+#include <hipcub/hipcub.hpp>
+
+/*! \file ZeroMomentumUpdaterGPU.cu
+    \brief Defines GPU kernel code for zeroing the momentum. Used by ZeroMomentumUpdaterGPU.
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Component-wise sum of Scalar4 values
+struct zero_momentum_sum_op
+    {
+    __host__ __device__ Scalar4 operator()(const Scalar4& a, const Scalar4& b) const
+        {
+        return make_scalar4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+        }
+    };
+
+//! Compute the momentum of each free particle (including floppy body particles) and each central
+//! particle of a rigid body, with a count of one in w
+__global__ void gpu_zero_momentum_particle_kernel(Scalar4* d_p,
+                                                  const Scalar4* d_vel,
+                                                  const unsigned int* d_body,
+                                                  const unsigned int* d_tag,
+                                                  const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    Scalar4 p = make_scalar4(0, 0, 0, 0);
+    unsigned int body = d_body[idx];
+    if (body >= MIN_FLOPPY || body == d_tag[idx])
+        {
+        Scalar4 vel = d_vel[idx];
+        p = make_scalar4(vel.w * vel.x, vel.w * vel.y, vel.w * vel.z, Scalar(1.0));
+        }
+    d_p[idx] = p;
+    }
+
+//! Subtract the average momentum from each free and central particle
+__global__ void gpu_zero_momentum_subtract_kernel(Scalar4* d_vel,
+                                                  const unsigned int* d_body,
+                                                  const unsigned int* d_tag,
+                                                  const Scalar4* d_sum,
+                                                  const unsigned int N)
+    {
+    unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+
+    if (idx >= N)
+        return;
+
+    unsigned int body = d_body[idx];
+    if (body >= MIN_FLOPPY || body == d_tag[idx])
+        {
+        const Scalar4 sum = *d_sum;
+        Scalar4 vel = d_vel[idx];
+        Scalar scale = Scalar(1.0) / (sum.w * vel.w);
+        vel.x -= sum.x * scale;
+        vel.y -= sum.y * scale;
+        vel.z -= sum.z * scale;
+        d_vel[idx] = vel;
+        }
+    }
+
+/*! \param d_sum Device memory to write the sum to: total momentum in x, y, z and the number of
+        contributing particles in w
+    \param d_vel Particle velocities and masses
+    \param d_body Particle body ids
+    \param d_tag Particle tags
+    \param N Number of local particles
+    \param alloc Allocator for temporary storage
+    \param block_size Number of threads per block
+
+    The sum stays on the device.
+*/
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_body,
+                                 const unsigned int* d_tag,
+                                 const unsigned int N,
+                                 CachedAllocator& alloc,
+                                 const unsigned int block_size)
+    {
+    ScopedAllocation<Scalar4> d_p(alloc, N > 0 ? N : 1);
+
+    if (N > 0)
+        {
+        unsigned int max_block_size;
+        hipFuncAttributes attr;
+        hipFuncGetAttributes(&attr, (const void*)gpu_zero_momentum_particle_kernel);
+        max_block_size = attr.maxThreadsPerBlock;
+
+        unsigned int run_block_size = min(block_size, max_block_size);
+        dim3 grid((N / run_block_size) + 1, 1, 1);
+        dim3 threads(run_block_size, 1, 1);
+
+        hipLaunchKernelGGL((gpu_zero_momentum_particle_kernel),
+                           grid,
+                           threads,
+                           0,
+                           0,
+                           d_p.data,
+                           d_vel,
+                           d_body,
+                           d_tag,
+                           N);
+        }
+
+    const Scalar4 zero = make_scalar4(0, 0, 0, 0);
+    void* d_temp_storage = NULL;
+    size_t temp_storage_bytes = 0;
+    hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_p.data,
+                                 d_sum,
+                                 N,
+                                 zero_momentum_sum_op(),
+                                 zero);
+    d_temp_storage = alloc.allocate(temp_storage_bytes);
+    hipcub::DeviceReduce::Reduce(d_temp_storage,
+                                 temp_storage_bytes,
+                                 d_p.data,
+                                 d_sum,
+                                 N,
+                                 zero_momentum_sum_op(),
+                                 zero);
+    alloc.deallocate((char*)d_temp_storage);
+
+    return hipSuccess;
+    }
+
+/*! \param d_vel Particle velocities and masses
+    \param d_body Particle body ids
+    \param d_tag Particle tags
+    \param d_sum Total momentum and particle count of the system, read on the device
+    \param N Number of local particles
+    \param block_size Number of threads per block
+*/
+hipError_t gpu_zero_momentum_subtract(Scalar4* d_vel,
+                                      const unsigned int* d_body,
+                                      const unsigned int* d_tag,
+                                      const Scalar4* d_sum,
+                                      const unsigned int N,
+                                      const unsigned int block_size)
+    {
+    if (N == 0)
+        return hipSuccess;
+
+    unsigned int max_block_size;
+    hipFuncAttributes attr;
+    hipFuncGetAttributes(&attr, (const void*)gpu_zero_momentum_subtract_kernel);
+    max_block_size = attr.maxThreadsPerBlock;
+
+    unsigned int run_block_size = min(block_size, max_block_size);
+    dim3 grid((N / run_block_size) + 1, 1, 1);
+    dim3 threads(run_block_size, 1, 1);
+
+    hipLaunchKernelGGL((gpu_zero_momentum_subtract_kernel),
+                       grid,
+                       threads,
+                       0,
+                       0,
+                       d_vel,
+                       d_body,
+                       d_tag,
+                       d_sum,
+                       N);
+
+    return hipSuccess;
+    }
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,42 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hip/hip_runtime.h"
+#include "hoomd/CachedAllocator.h"
+#include "hoomd/HOOMDMath.h"
+
+/*! \file ZeroMomentumUpdaterGPU.cuh
+    \brief Declares GPU kernel code for zeroing the momentum. Used by ZeroMomentumUpdaterGPU.
+*/
+
+#ifndef __ZERO_MOMENTUM_UPDATER_GPU_CUH__
+#define __ZERO_MOMENTUM_UPDATER_GPU_CUH__
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace kernel
+    {
+//! Sum the momentum and count the free and central particles
+hipError_t gpu_zero_momentum_sum(Scalar4* d_sum,
+                                 const Scalar4* d_vel,
+                                 const unsigned int* d_body,
+                                 const unsigned int* d_tag,
+                                 const unsigned int N,
+                                 CachedAllocator& alloc,
+                                 const unsigned int block_size);
+
+//! Subtract the average momentum from the free and central particles
+hipError_t gpu_zero_momentum_subtract(Scalar4* d_vel,
+                                      const unsigned int* d_body,
+                                      const unsigned int* d_tag,
+                                      const Scalar4* d_sum,
+                                      const unsigned int N,
+                                      const unsigned int block_size);
+
+    } // end namespace kernel
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __ZERO_MOMENTUM_UPDATER_GPU_CUH__
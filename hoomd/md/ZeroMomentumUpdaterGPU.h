@@ -0,0 +1,54 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file ZeroMomentumUpdaterGPU.h
+    \brief Declares the GPU implementation of ZeroMomentumUpdater
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include "ZeroMomentumUpdater.h"
+#include "hoomd/Autotuner.h"
+#include "hoomd/GlobalArray.h"
+
+#ifndef __ZERO_MOMENTUM_UPDATER_GPU_H__
+#define __ZERO_MOMENTUM_UPDATER_GPU_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Updates particle velocities to zero the momentum on the GPU
+/*! The momentum is summed with a device wide reduction and the subtraction kernel reads the sum
+    from device memory, so a single process update does not synchronize with the host. With
+    domain decomposition, the sum is copied to the host for the MPI reduction.
+
+    \ingroup updaters
+*/
+class PYBIND11_EXPORT ZeroMomentumUpdaterGPU : public ZeroMomentumUpdater
+    {
+    public:
+    //! Constructor
+    ZeroMomentumUpdaterGPU(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<Trigger> trigger);
+
+    //! Take one timestep forward
+    virtual void update(uint64_t timestep);
+
+    protected:
+    //! Total momentum (x, y, z) and number of contributing particles (w)
+    GlobalArray<Scalar4> m_sum;
+
+    //! Autotuner for block size (sum kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_sum;
+
+    //! Autotuner for block size (subtract kernel)
+    std::shared_ptr<Autotuner<1>> m_tuner_subtract;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __ZERO_MOMENTUM_UPDATER_GPU_H__
@@ -251,7 +251,7 @@ class Table(Bond):
         super().__init__()
         param_dict = hoomd.data.parameterdicts.ParameterDict(width=int)
         param_dict['width'] = width
-        self._param_dict = param_dict
+        self._param_dict.update(param_dict)
 
         params = TypeParameter(
             "params", "bond_types",
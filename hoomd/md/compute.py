@@ -9,10 +9,12 @@ or by direct access via the Python API.
 """
 
 from hoomd.md import _md
-from hoomd.operation import Compute
+from hoomd.operation import Compute, Writer
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import positive_real
 from hoomd.logging import log
 import hoomd
+import numpy
 
 
 class ThermodynamicQuantities(Compute):
@@ -381,3 +383,428 @@ class HarmonicAveragedThermodynamicQuantities(Compute):
         """Average pressure :math:`[\\mathrm{pressure}]`."""
         self._cpp_obj.compute(self._simulation.timestep)
         return self._cpp_obj.pressure
+
+
+class RadialDistributionFunction(Writer):
+    r"""Accumulate the time averaged radial distribution function.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to sample.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to take the pairs
+            from.
+        r_max (float): Maximum pair distance :math:`[\mathrm{length}]`.
+        bins (int): Number of bins between 0 and ``r_max``.
+
+    `RadialDistributionFunction` bins the distances between all pairs of
+    particles in the neighbor list on the timesteps selected by ``trigger`` and
+    averages the histogram over the samples:
+
+    .. math::
+
+        g(r) = \left\langle \frac{V}{N (N - 1)}
+               \frac{n(r)}{V_\mathrm{shell}(r)} \right\rangle
+
+    where :math:`n(r)` is the number of ordered pairs :math:`(i, j)` with a
+    separation in the bin at :math:`r` and :math:`V_\mathrm{shell}(r)` is the
+    volume (area in 2D) of the spherical shell that the bin covers. Sampling
+    in place avoids writing trajectories only to compute :math:`g(r)` later.
+
+    `RadialDistributionFunction` adds ``r_max`` to the neighbor list's cutoff
+    for all type pairs, so the neighbor list finds every pair closer than
+    ``r_max``. Share the neighbor list with the pair forces and choose
+    ``r_max`` no larger than their ``r_cut`` to reuse the neighbor list without
+    extra cost. Pairs that the neighbor list excludes, such as bonded particles,
+    are not counted.
+
+    Add `RadialDistributionFunction` to the simulation's operations like any
+    other writer.
+
+    Note:
+        `RadialDistributionFunction` bins the pairs on the CPU. On the GPU,
+        each sample copies the neighbor list to the host.
+
+    Changing ``r_max`` or ``bins`` discards the accumulated samples.
+
+    Example::
+
+        rdf = hoomd.md.compute.RadialDistributionFunction(
+            trigger=hoomd.trigger.Periodic(100), nlist=nl, r_max=2.5, bins=100)
+        simulation.operations.writers.append(rdf)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to sample.
+
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to take the pairs
+            from.
+
+        r_max (float): Maximum pair distance :math:`[\mathrm{length}]`.
+
+        bins (int): Number of bins between 0 and ``r_max``.
+    """
+
+    def __init__(self, trigger, nlist, r_max, bins=100):
+        super().__init__(trigger)
+        self._param_dict.update(
+            ParameterDict(nlist=hoomd.md.nlist.NeighborList,
+                          r_max=positive_real,
+                          bins=int))
+        self.nlist = nlist
+        self.r_max = r_max
+        self.bins = bins
+
+    def _attach_hook(self):
+        if (self.nlist._attached
+                and self._simulation != self.nlist._simulation):
+            raise RuntimeError(
+                f"{self} cannot use a neighbor list from another simulation.")
+        self.nlist._attach(self._simulation)
+        self._cpp_obj = _md.RDFAnalyzer(self._simulation.state._cpp_sys_def,
+                                        self.trigger, self.nlist._cpp_obj,
+                                        self.r_max, self.bins)
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    def _setattr_param(self, attr, value):
+        if attr == "nlist" and self._attached:
+            raise RuntimeError("nlist cannot be set after scheduling.")
+        super()._setattr_param(attr, value)
+
+    def reset(self):
+        """Discard the accumulated samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def rdf(self):
+        """(*bins*,) `numpy.ndarray` of `float`: :math:`g(r)` averaged over \
+        the samples.
+
+        See Also:
+            `bin_centers` defines the bin center locations.
+
+        Attention:
+            In MPI parallel execution, the array is available on rank 0 only.
+            `rdf` is `None` on ranks >= 1.
+        """
+        return self._cpp_obj.rdf
+
+    @log(category='sequence')
+    def bin_centers(self):
+        """(*bins*,) `numpy.ndarray` of `float`: The distance at the center \
+        of each bin :math:`[\\mathrm{length}]`."""
+        dr = self.r_max / self.bins
+        return numpy.arange(self.bins) * dr + dr / 2
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples accumulated in `rdf`."""
+        return self._cpp_obj.num_samples
+
+
+class MultipleTauCorrelator(Writer):
+    r"""Compute time correlation functions on the fly.
+
+    Args:
+        trigger (hoomd.trigger.Periodic): Select the timesteps to sample.
+        filter (hoomd.filter.filter_like): Particles to compute the mean squared
+            displacement and velocity autocorrelation of. Pass ``None`` to
+            compute only the pressure autocorrelation.
+        thermodynamic_quantities (ThermodynamicQuantities): Compute the
+            autocorrelation of the pressure tensor of this compute. Pass
+            ``None`` to skip it.
+        points (int): Number of entries in each level.
+        averaging (int): Number of values of a level averaged into one value
+            of the next level.
+        levels (int): Number of levels.
+
+    `MultipleTauCorrelator` samples the system on the timesteps selected by
+    ``trigger`` and accumulates:
+
+    * the mean squared displacement of the particles selected by ``filter``,
+      computed from the positions unwrapped with the image flags:
+
+      .. math::
+
+          \mathrm{MSD}(\tau) = \left\langle
+              |\vec{r}_i(t + \tau) - \vec{r}_i(t)|^2 \right\rangle
+
+    * the velocity autocorrelation of the same particles:
+
+      .. math::
+
+          C_v(\tau) = \left\langle \vec{v}_i(t) \cdot \vec{v}_i(t + \tau)
+              \right\rangle
+
+    * the autocorrelation of the off-diagonal components of the pressure
+      tensor :math:`P_{\alpha\beta}` of ``thermodynamic_quantities``, averaged
+      over :math:`xy`, :math:`xz`, and :math:`yz`:
+
+      .. math::
+
+          C_P(\tau) = \frac{1}{3} \sum_{\alpha\beta \in \{xy, xz, yz\}}
+              \left\langle P_{\alpha\beta}(t) P_{\alpha\beta}(t + \tau)
+              \right\rangle
+
+      The shear viscosity follows from the Green-Kubo relation
+      :math:`\eta = \frac{V}{kT} \int_0^\infty C_P(\tau) d\tau`.
+
+    The averages run over all particles and all time origins. The multiple-tau
+    algorithm keeps ``levels`` levels of ``points`` values. Level 0 holds the
+    most recent samples, and each higher level holds averages of ``averaging``
+    values of the level below. The lags reach
+    ``points * averaging**(levels - 1)`` samples with memory that grows only
+    with ``levels``. At lags beyond level 0, the correlation is computed from
+    the block averages.
+
+    See Also:
+        J. Ramirez, S. K. Sukumaran, B. Vorselaars, and A. E. Likhtman. 2010.
+        "Efficient on the fly calculation of time correlation functions in
+        computer simulations." J. Chem. Phys. 133, 154103.
+
+    Note:
+        `MultipleTauCorrelator` holds ``6 * points * levels`` values for each
+        particle selected by ``filter``. It runs on the CPU. On the GPU, each
+        sample copies the particle data to the host.
+
+    Note:
+        The mean squared displacement and velocity autocorrelation are not
+        available with domain decomposition. Set ``filter=None`` to compute the
+        pressure autocorrelation in MPI simulations.
+
+    Example::
+
+        thermo = hoomd.md.compute.ThermodynamicQuantities(
+            filter=hoomd.filter.All())
+        correlator = hoomd.md.compute.MultipleTauCorrelator(
+            trigger=hoomd.trigger.Periodic(1),
+            filter=hoomd.filter.All(),
+            thermodynamic_quantities=thermo)
+        simulation.operations.writers.append(correlator)
+
+    Attributes:
+        trigger (hoomd.trigger.Periodic): Select the timesteps to sample.
+
+        points (int): Number of entries in each level (read only).
+
+        averaging (int): Number of values of a level averaged into one value
+            of the next level (read only).
+
+        levels (int): Number of levels (read only).
+    """
+
+    def __init__(self,
+                 trigger,
+                 filter,
+                 thermodynamic_quantities=None,
+                 points=16,
+                 averaging=2,
+                 levels=16):
+        super().__init__(trigger)
+        if not isinstance(self.trigger, hoomd.trigger.Periodic):
+            raise ValueError("MultipleTauCorrelator requires a Periodic "
+                             "trigger.")
+        self._param_dict.update(
+            ParameterDict(points=int(points),
+                          averaging=int(averaging),
+                          levels=int(levels)))
+        self._filter = filter
+        self._thermodynamic_quantities = thermodynamic_quantities
+
+    def _attach_hook(self):
+        group = None
+        if self._filter is not None:
+            group = self._simulation.state._get_group(self._filter)
+
+        thermo = None
+        if self._thermodynamic_quantities is not None:
+            self._thermodynamic_quantities._attach(self._simulation)
+            thermo = self._thermodynamic_quantities._cpp_obj
+
+        self._cpp_obj = _md.CorrelatorAnalyzer(
+            self._simulation.state._cpp_sys_def, self.trigger, group, thermo,
+            self.points, self.averaging, self.levels)
+
+    def _detach_hook(self):
+        if self._thermodynamic_quantities is not None:
+            self._thermodynamic_quantities._detach()
+
+    def reset(self):
+        """Discard the accumulated samples."""
+        if self._attached:
+            self._cpp_obj.reset()
+
+    @log(category='sequence', requires_run=True)
+    def lag_steps(self):
+        """(*N_lags*,) `numpy.ndarray` of `int`: The lag :math:`\\tau` of \\
+        each correlation, in timesteps."""
+        return self._cpp_obj.lags * self.trigger.period
+
+    @log(category='sequence', requires_run=True)
+    def msd(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: The mean squared \\
+        displacement at each lag :math:`[\\mathrm{length}^2]`.
+
+        `msd` is `None` when ``filter`` is `None`. Lags without samples are
+        NaN.
+        """
+        return self._cpp_obj.msd
+
+    @log(category='sequence', requires_run=True)
+    def velocity_autocorrelation(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: The velocity \\
+        autocorrelation at each lag \\
+        :math:`[\\mathrm{velocity}^2]`.
+
+        `velocity_autocorrelation` is `None` when ``filter`` is `None`. Lags
+        without samples are NaN.
+        """
+        return self._cpp_obj.vacf
+
+    @log(category='sequence', requires_run=True)
+    def pressure_autocorrelation(self):
+        """(*N_lags*,) `numpy.ndarray` of `float`: The autocorrelation of \\
+        the off-diagonal pressure tensor at each lag \\
+        :math:`[\\mathrm{pressure}^2]`.
+
+        `pressure_autocorrelation` is `None` when ``thermodynamic_quantities``
+        is `None`. Lags without samples are NaN.
+        """
+        return self._cpp_obj.pressure_acf
+
+    @log(requires_run=True)
+    def num_samples(self):
+        """int: Number of samples accumulated in the correlations."""
+        return self._cpp_obj.num_samples
+
+
+class Steinhardt(Compute):
+    r"""Compute the Steinhardt bond order parameter and local density.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to take the bonds
+            from.
+        r_max (float): Maximum bond length :math:`[\mathrm{length}]`.
+        l (int): Spherical harmonic degree, between 1 and 12.
+
+    `Steinhardt` computes the bond order parameter of each particle :math:`i`
+    from the bonds to all neighbors :math:`j` closer than ``r_max``:
+
+    .. math::
+
+        q_l(i) = \sqrt{\frac{4 \pi}{2 l + 1} \sum_{m=-l}^{l}
+                 \left| \frac{1}{N_b(i)} \sum_{j} Y_{lm}(\vec{r}_{ij})
+                 \right|^2}
+
+    where :math:`N_b(i)` is the number of bonds of particle :math:`i` and
+    :math:`Y_{lm}` are the spherical harmonics. The global order parameter
+    :math:`Q_l` uses the same expression with the average of
+    :math:`Y_{lm}` over all bonds in the system. For example, :math:`q_6` is
+    0.354 in a simple cubic crystal and 0.575 in a face centered cubic crystal
+    when ``r_max`` includes only the first neighbor shell.
+
+    `Steinhardt` adds ``r_max`` to the neighbor list's cutoff for all type
+    pairs, like `RadialDistributionFunction`. Share the neighbor list with the
+    pair forces and choose ``r_max`` no larger than their ``r_cut`` to reuse
+    the neighbor list without extra cost. Pairs that the neighbor list
+    excludes are not bonds.
+
+    On the GPU, `Steinhardt` computes the order parameters and the sums over
+    all bonds on the device and copies only the requested values to the host.
+
+    Example::
+
+        steinhardt = hoomd.md.compute.Steinhardt(nlist=nl, r_max=1.5, l=6)
+        simulation.operations.computes.append(steinhardt)
+
+    Attributes:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list to take the bonds
+            from.
+
+        r_max (float): Maximum bond length :math:`[\mathrm{length}]`.
+
+        l (int): Spherical harmonic degree, between 1 and 12.
+    """
+
+    def __init__(self, nlist, r_max, l=6):  # noqa: E741 - allow l as a name
+        super().__init__()
+        self._param_dict.update(
+            ParameterDict(nlist=hoomd.md.nlist.NeighborList,
+                          r_max=positive_real,
+                          l=int))
+        self.nlist = nlist
+        self.r_max = r_max
+        self.l = l
+
+    def _attach_hook(self):
+        if (self.nlist._attached
+                and self._simulation != self.nlist._simulation):
+            raise RuntimeError(
+                f"{self} cannot use a neighbor list from another simulation.")
+        self.nlist._attach(self._simulation)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _md.SteinhardtCompute
+        else:
+            cpp_class = _md.SteinhardtComputeGPU
+        self._cpp_obj = cpp_class(self._simulation.state._cpp_sys_def,
+                                  self.nlist._cpp_obj, self.l, self.r_max)
+
+    def _detach_hook(self):
+        self.nlist._detach()
+
+    def _setattr_param(self, attr, value):
+        if attr == "nlist" and self._attached:
+            raise RuntimeError("nlist cannot be set after scheduling.")
+        super()._setattr_param(attr, value)
+
+    @log(requires_run=True)
+    def order(self):
+        """float: Global order parameter :math:`Q_l`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.order
+
+    @log(category='particle', requires_run=True)
+    def particle_order(self):
+        """(*N_particles*,) `numpy.ndarray` of `float`: Order parameter \
+        :math:`q_l` of each particle.
+
+        :math:`q_l` is 0 for particles without bonds.
+
+        Attention:
+            In MPI parallel execution, the array is available on rank 0 only.
+            `particle_order` is `None` on ranks >= 1.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.particle_order
+
+    @log(category='particle', requires_run=True)
+    def particle_num_neighbors(self):
+        """(*N_particles*,) `numpy.ndarray` of `int`: Number of bonds \
+        :math:`N_b` of each particle.
+
+        Attention:
+            In MPI parallel execution, the array is available on rank 0 only.
+            `particle_num_neighbors` is `None` on ranks >= 1.
+        """
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.num_neighbors
+
+    @log(category='particle', requires_run=True)
+    def particle_local_density(self):
+        """(*N_particles*,) `numpy.ndarray` of `float`: Number of bonds of \
+        each particle divided by the volume (area in 2D) of the sphere of \
+        radius ``r_max`` :math:`[\\mathrm{length}^{-D}]`.
+
+        Attention:
+            In MPI parallel execution, the array is available on rank 0 only.
+            `particle_local_density` is `None` on ranks >= 1.
+        """
+        num_neighbors = self.particle_num_neighbors
+        if num_neighbors is None:
+            return None
+
+        if self._simulation.state.box.is2D:
+            volume = numpy.pi * self.r_max**2
+        else:
+            volume = 4 / 3 * numpy.pi * self.r_max**3
+        return num_neighbors / volume
@@ -22,7 +22,8 @@ Warning:
 from hoomd.md import _md
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
-from hoomd.data.typeconverter import OnlyIf, to_type_converter
+from hoomd.data.typeconverter import OnlyFrom, OnlyIf, to_type_converter
+from hoomd.logging import log
 from hoomd.md.force import Force
 import hoomd
 
@@ -32,11 +33,22 @@ class Constraint(Force):
 
     `Constraint` is the base class for all constraint forces.
 
+    Note:
+        The integrator applies constraint forces on every step. `interval` is
+        always 1.
+
     Warning:
         This class should not be instantiated by users. The class can be used
         for `isinstance` or `issubclass` checks.
     """
 
+    _reserved_default_attrs = {
+        **Force._reserved_default_attrs,
+        '_param_dict':
+            lambda: ParameterDict(interval=OnlyFrom([1], preprocess=int),
+                                  _defaults={'interval': 1}),
+    }
+
     def _attach_hook(self):
         """Create the c++ mirror class."""
         if isinstance(self._simulation.device, hoomd.device.CPU):
@@ -52,6 +64,12 @@ class Distance(Constraint):
 
     Args:
         tolerance (float): Relative tolerance for constraint violation warnings.
+        solver (str): Method to solve for the constraint forces, ``'lu'`` or
+            ``'iterative'`` (defaults to ``'lu'``).
+        solver_tolerance (float): Relative tolerance of the iterative solver
+            (defaults to 1e-6).
+        max_iterations (int): Maximum number of iterations of the iterative
+            solver (defaults to 100).
 
     `Distance` applies forces between particles that constrain the distances
     between particles to specific values. The algorithm implemented is described
@@ -82,6 +100,18 @@ class Distance(Constraint):
     equations to determine the force. The constraints are satisfied at :math:`t
     + 2 \\delta t`, so the scheme is self-correcting and avoids drifts.
 
+    With ``solver='lu'``, `Distance` assembles the matrix of the linear system
+    and solves it with a sparse LU decomposition, which is exact but costs
+    memory and time that grow faster than linearly with the number of
+    constraints. ``solver='iterative'`` never forms the matrix. It refines the
+    Lagrange multipliers of the previous step with Jacobi iterations until the
+    largest change is less than ``solver_tolerance`` times the largest
+    multiplier or after ``max_iterations`` iterations. Each iteration costs
+    time linear in the number of constraints and runs in parallel on the GPU.
+    The iterations converge quickly for chains and sparse networks of
+    constraints, but slowly for strongly coupled constraints such as rigid
+    triangles.
+
     Add an instance of `Distance` to the integrator constraints list
     `hoomd.md.Integrator.constraints` to apply the force during the simulation.
 
@@ -98,12 +128,38 @@ class Distance(Constraint):
 
     Attributes:
         tolerance (float): Relative tolerance for constraint violation warnings.
+        solver (str): Method to solve for the constraint forces, ``'lu'`` or
+            ``'iterative'``.
+        solver_tolerance (float): Relative tolerance of the iterative solver.
+        max_iterations (int): Maximum number of iterations of the iterative
+            solver.
     """
 
     _cpp_class_name = "ForceDistanceConstraint"
 
-    def __init__(self, tolerance=1e-3):
-        self._param_dict.update(ParameterDict(tolerance=float(tolerance)))
+    def __init__(self,
+                 tolerance=1e-3,
+                 solver='lu',
+                 solver_tolerance=1e-6,
+                 max_iterations=100):
+        self._param_dict.update(
+            ParameterDict(tolerance=float,
+                          solver=OnlyFrom(['lu', 'iterative']),
+                          solver_tolerance=float,
+                          max_iterations=int))
+        self._param_dict.update(
+            dict(tolerance=tolerance,
+                 solver=solver,
+                 solver_tolerance=solver_tolerance,
+                 max_iterations=max_iterations))
+
+    @log(requires_run=True)
+    def solver_iterations(self):
+        """int: Number of iterations in the last iterative solve.
+
+        `solver_iterations` is 0 when `solver` is ``'lu'``.
+        """
+        return self._cpp_obj.solver_iterations
 
 
 class Rigid(Constraint):
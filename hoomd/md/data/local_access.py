@@ -52,7 +52,9 @@ class _NeighborListLocalAccessBase(hoomd.data.local_access._LocalAccess):
     _global_fields = {
         'head_list': 'getHeadList',
         'n_neigh': 'getNNeigh',
-        'nlist': 'getNList'
+        'nlist': 'getNList',
+        'pair_list': 'getPairList',
+        'pair_dr': 'getPairDisplacements'
     }
 
     @property
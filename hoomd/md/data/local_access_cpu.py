@@ -45,6 +45,13 @@ class NeighborListLocalAccess(_NeighborListLocalAccessBase):
     or two copies for each pair (False). Under MPI, pairs that cross domains
     are stored twice, once in each domain rank.
 
+    ``pair_list`` stores the same pairs as a flat array of local index pairs
+    ``(i, j)``, with each pair of two local particles stored once in both
+    storage modes. It is rebuilt only when the neighbor list changes.
+    ``pair_dr`` holds the minimum image displacements
+    :math:`\\vec{r}_i - \\vec{r}_j` of these pairs, computed from the current
+    particle positions when first accessed.
+
     Attributes:
         head_list ((N_particles,) `hoomd.data.array` of ``unsigned long``):
             Local head list.
@@ -52,6 +59,10 @@ class NeighborListLocalAccess(_NeighborListLocalAccessBase):
             Number of neighbors.
         nlist ((...) `hoomd.data.array` of ``unsigned int``):
             Raw neighbor list data.
+        pair_list ((N_pairs, 2) `hoomd.data.array` of ``unsigned int``):
+            Local pair list.
+        pair_dr ((N_pairs, 3) `hoomd.data.array` of ``float``):
+            Pair displacements. :math:`[\\mathrm{length}]`
         half_nlist (``bool``):
             Convenience property to check if the storage mode is 'half'.
     """
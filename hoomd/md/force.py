@@ -10,7 +10,7 @@ from hoomd.md import _md
 from hoomd.operation import Compute
 from hoomd.logging import log
 from hoomd.data.typeparam import TypeParameter
-from hoomd.data.typeconverter import OnlyTypes
+from hoomd.data.typeconverter import OnlyTypes, positive_real
 from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.filter import ParticleFilter
 from hoomd.md.manifold import Manifold
@@ -66,11 +66,42 @@ class Force(Compute):
         <hoomd.Operations.computes>` list to compute the forces and energy
         without influencing the system dynamics.
 
+    .. rubric:: Multiple time step integration
+
+    Set `interval` to :math:`k > 1` to apply a slowly varying force, such as
+    `hoomd.md.long_range.pppm.Coulomb`, only every :math:`k` steps. The
+    integrator then computes the force on time steps that are multiples of
+    :math:`k` and applies it with a weight of :math:`k`. On all other steps,
+    this force is not computed. The result is the impulse form of the r-RESPA
+    multiple time step method:
+
+    .. math::
+
+        \vec{F}_{\mathrm{net},i}(t) = \sum_{f \in \mathrm{forces}}
+        k_f \delta_{t \bmod k_f, 0} \vec{F}_i^f(t)
+
+    The energy and virial of the force enter the net energy and virial with a
+    weight of 1 on those steps and are absent on the other steps. Log
+    thermodynamic quantities on steps that are multiples of :math:`k`.
+
     Warning:
         This class should not be instantiated by users. The class can be used
         for `isinstance` or `issubclass` checks.
+
+    Attributes:
+        interval (int): Number of time steps between applications of the force
+            in the equations of motion (default: 1).
     """
 
+    # Subclasses that do not call Force.__init__ also provide interval.
+    _reserved_default_attrs = {
+        **Compute._reserved_default_attrs,
+        '_param_dict':
+            lambda: ParameterDict(interval=OnlyTypes(int,
+                                                     preprocess=positive_real),
+                                  _defaults={'interval': 1}),
+    }
+
     def __init__(self):
         self._in_context_manager = False
 
@@ -210,6 +241,18 @@ class Force(Compute):
                 arrays.torque[:] = ...
                 arrays.virial[:] = ...
 
+        The arrays support ``__cuda_array_interface__`` and ``__dlpack__``
+        without synchronizing the device. To write the forces from a
+        non-blocking stream (for example, a PyTorch stream), import the
+        arrays on that stream and call `hoomd.device.GPU.wait_for_stream`
+        before the context manager exits::
+
+            with self.gpu_local_force_arrays as arrays:
+                stream = torch.cuda.current_stream()
+                force = torch.from_dlpack(arrays.force)
+                force[:] = ...
+                self._simulation.device.wait_for_stream(stream.cuda_stream)
+
         Note:
             GPU local force data is not available if the chosen device for the
             simulation is `hoomd.device.CPU`.
@@ -291,6 +334,12 @@ class Custom(Force):
     Note:
         Access to the force buffers is constant (O(1)) time.
 
+    Note:
+        `Custom` calls `set_forces` in Python every time step. Implement forces
+        that must be cheap to evaluate as a C++ ``ForceCompute`` in a plugin
+        component instead. See ``example_plugins/force_plugin`` in the
+        HOOMD-blue source for an example.
+
     .. versionchanged:: 3.1.0
         `Custom` zeros the force, torque, energy, and virial arrays before
         calling the user-provided `set_forces`.
@@ -612,3 +661,107 @@ class Constant(Force):
 
         self._cpp_obj = my_class(sim.state._cpp_sys_def,
                                  sim.state._get_group(self.filter))
+
+
+class Torch(Force):
+    r"""Machine learned potential evaluated with a TorchScript model.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        filename (str): Name of the TorchScript model file.
+        r_cut (float): Cutoff radius of the model
+            :math:`[\mathrm{length}]`.
+
+    `Torch` evaluates a TorchScript model in process with libtorch, on the GPU
+    when the simulation runs on the GPU. Inputs are read from the neighbor list
+    and particle data without copies through Python, and the model output is
+    written directly to the force buffers. `Torch` calls the model as::
+
+        energy = model(types, pairs, dr, n_local)
+
+    with the arguments:
+
+    * ``types`` (*(N_total,)* ``int64``): Type index of each local and ghost
+      particle.
+    * ``pairs`` (*(N_pairs, 2)* ``int64``): Index pairs :math:`(i, j)` of
+      every neighbor :math:`j` of each local particle :math:`i`. Pairs of two
+      local particles appear in both orders. The pairs are rebuilt only when
+      the neighbor list updates.
+    * ``dr`` (*(N_pairs, 3)* ``float``): Minimum image displacement
+      :math:`\vec{r}_i - \vec{r}_j` :math:`[\mathrm{length}]`.
+    * ``n_local`` (``int``): Number of local particles.
+
+    The model returns a tensor of shape *(n_local,)* with the potential
+    energy of each local particle :math:`[\mathrm{energy}]`. `Torch`
+    differentiates the total energy with respect to ``dr`` to compute the
+    forces and virial. The model should only include pairs with
+    :math:`r < r_\mathrm{cut}`, as the neighbor list may contain pairs out to
+    :math:`r_\mathrm{cut} + r_\mathrm{buff}`.
+
+    Forces on ghost particles are communicated back to the owning MPI rank, so
+    the energy of particle :math:`i` may depend on all of its neighbors within
+    :math:`r_\mathrm{cut}`.
+
+    Note:
+        The model must accept and return tensors with the floating point
+        precision of the HOOMD-blue build (see
+        `hoomd.version.floating_point_precision`).
+
+    Note:
+        `Torch` needs a neighbor list that stores both orders of each pair. On
+        the CPU, do not share its neighbor list with `hoomd.md.pair.Pair`
+        forces.
+
+    Note:
+        `Torch` is available only when HOOMD-blue is built with
+        ``ENABLE_TORCH=on`` (see `hoomd.version.torch_enabled`).
+
+    Warning:
+        Reverse force communication is not supported on the GPU with MPI.
+
+    Example::
+
+        nl = hoomd.md.nlist.Cell(buffer=0.4)
+        torch_force = hoomd.md.force.Torch(nlist=nl,
+                                           filename='model.pt',
+                                           r_cut=5.0)
+
+    Attributes:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+
+        filename (str): Name of the TorchScript model file (*read only*).
+
+        r_cut (float): Cutoff radius of the model :math:`[\mathrm{length}]`.
+    """
+
+    def __init__(self, nlist, filename, r_cut):
+        super().__init__()
+        self._param_dict.update(
+            ParameterDict(nlist=hoomd.md.nlist.NeighborList,
+                          filename=str(filename),
+                          r_cut=float(r_cut)))
+        self.nlist = nlist
+
+    def _setattr_param(self, attr, value):
+        if attr == "nlist":
+            if self._attached:
+                raise RuntimeError("nlist cannot be set after scheduling.")
+            self._param_dict._dict["nlist"] = value
+            return
+        if attr == "filename" and self._attached:
+            raise hoomd.error.MutabilityError(attr)
+        super()._setattr_param(attr, value)
+
+    def _attach_hook(self):
+        if not hasattr(_md, "TorchForceCompute"):
+            raise RuntimeError("This build of HOOMD-blue does not support "
+                               "TorchScript models. Rebuild with "
+                               "ENABLE_TORCH=on.")
+
+        self.nlist._attach(self._simulation)
+        self._cpp_obj = _md.TorchForceCompute(
+            self._simulation.state._cpp_sys_def, self.nlist._cpp_obj,
+            self.filename, self.r_cut)
+
+    def _detach_hook(self):
+        self.nlist._detach()
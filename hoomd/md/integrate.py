@@ -184,6 +184,9 @@ class Integrator(_DynamicIntegrator):
         W_{\mathrm{net},\mathrm{additional}} &= \sum_{f \in \mathrm{forces}}
         W_\mathrm{additional}^f \\
 
+    Forces with an `interval <hoomd.md.force.Force.interval>` greater than 1
+    enter these sums only on steps that are multiples of their interval.
+
     See `md.force.Force` for definitions of these terms. Constraints are a
     special type of force used to enforce specific constraints on the system
     state, such as distances between particles with
@@ -3,4 +3,6 @@
 
 """Long-range potentials for molecular dynamics."""
 
+from . import ewald
 from . import pppm
+from . import slab
@@ -0,0 +1,220 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Long-range potentials evaluated using a direct Ewald sum."""
+
+import hoomd
+from hoomd.md.force import Force
+import math
+
+
+def make_ewald_coulomb_forces(nlist, k_max, r_cut, alpha=0):
+    """Long range Coulomb interactions evaluated using a direct Ewald sum.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        k_max (tuple[int, int, int]): Largest Miller index of the wave vectors
+          along each reciprocal lattice vector
+          :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        alpha (float): Debye screening parameter
+          :math:`\\mathrm{[length^{-1}]}`.
+
+    Evaluate the same potential energy :math:`U_\\mathrm{coulomb}` as
+    `md.long_range.pppm.make_pppm_coulomb_forces`. `md.pair.Ewald` computes the
+    real space term and `md.long_range.ewald.Coulomb` computes the reciprocal
+    space term as a direct sum over the wave vectors
+    :math:`\\vec{k} = n_1 \\vec{b}_1 + n_2 \\vec{b}_2 + n_3 \\vec{b}_3`:
+
+    .. math::
+
+        U_\\mathrm{reciprocal\\ space} = \\frac{2 \\pi}{V}
+          \\sum_{\\vec{k} \\ne 0}
+          \\frac{e^{-(k^2 + \\alpha^2) / (4 \\kappa^2)}}{k^2 + \\alpha^2}
+          \\left| \\sum_{j=0}^{N-1} q_j e^{i \\vec{k} \\cdot \\vec{r}_j}
+          \\right|^2 - U_\\mathrm{self}
+
+    where :math:`\\vec{b}_i` are the reciprocal lattice vectors, the sum
+    includes the Miller indices inside the ellipsoid
+    :math:`\\sum_i (n_i / n_{\\mathrm{max},i})^2 \\le 1`, and
+    :math:`\\kappa` is the splitting parameter. `Coulomb` chooses
+    :math:`\\kappa` to balance the estimated RMS force errors of the real
+    and reciprocal space terms (`Kolafa and Perram 1992`_).
+
+    The cost of the reciprocal space term grows with the number of particles
+    times the number of wave vectors. For small systems, the direct sum is
+    often faster than PPPM and has no discretization error. Use
+    `md.long_range.pppm.make_pppm_coulomb_forces` for large systems.
+
+    `Coulomb` corrects the reciprocal space term for the exclusions in
+    ``nlist`` like `md.long_range.pppm.Coulomb`. It does not support
+    ``'body'`` exclusions.
+
+    Returns:
+        ``real_space_force``, ``reciprocal_space_force``
+
+        Add both of these forces to the integrator.
+
+    Warning:
+        `make_ewald_coulomb_forces` sets all parameters for the returned
+        `Force` objects given the input ``k_max`` and ``r_cut``. Do not change
+        the parameters of the returned objects directly.
+
+    .. _Kolafa and Perram 1992: https://doi.org/10.1080/08927029208049126
+    """
+    real_space_force = hoomd.md.pair.Ewald(nlist)
+
+    # the real space force may be attached before the reciprocal space one
+    # set default parameters to avoid errors in this case
+    real_space_force.params.default = dict(kappa=0, alpha=0)
+    real_space_force.r_cut.default = r_cut
+
+    reciprocal_space_force = Coulomb(nlist=nlist,
+                                     k_max=k_max,
+                                     r_cut=r_cut,
+                                     alpha=alpha,
+                                     pair_force=real_space_force)
+
+    return real_space_force, reciprocal_space_force
+
+
+class Coulomb(Force):
+    """Reciprocal space part of the Ewald Coulomb forces.
+
+    Note:
+        Use `make_ewald_coulomb_forces` to create a connected pair of
+        `md.pair.Ewald` and `md.long_range.ewald.Coulomb` instances that
+        together implement the Ewald sum for electrostatics.
+
+    Attributes:
+        k_max (tuple[int, int, int]): Largest Miller index of the wave vectors
+          along each reciprocal lattice vector
+          :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        alpha (float): Debye screening parameter
+          :math:`\\mathrm{[length^{-1}]}`.
+    """
+
+    def __init__(self, nlist, k_max, r_cut, alpha, pair_force):
+        super().__init__()
+        self._nlist = hoomd.data.typeconverter.OnlyTypes(
+            hoomd.md.nlist.NeighborList)(nlist)
+        self._param_dict.update(
+            hoomd.data.parameterdicts.ParameterDict(k_max=(int, int, int),
+                                                    r_cut=float,
+                                                    alpha=float))
+
+        self.k_max = k_max
+        self.r_cut = r_cut
+        self.alpha = alpha
+        self._pair_force = pair_force
+
+    def _attach_hook(self):
+        if self._simulation.state.box.is2D:
+            raise ValueError("The Ewald sum is not implemented for 2D "
+                             "simulations.")
+
+        self.nlist._attach(self._simulation)
+
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cls = hoomd.md._md.EwaldForceCompute
+        else:
+            cls = hoomd.md._md.EwaldForceComputeGPU
+
+        # Access set parameters before attaching. These values are needed to
+        # compute derived parameters before all paramters are given to the
+        # _cpp_obj at the end.
+        k_max = self.k_max
+        rcut = self.r_cut
+        alpha = self.alpha
+
+        group = self._simulation.state._get_group(hoomd.filter.All())
+        self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
+                            self.nlist._cpp_obj, group)
+
+        q2 = self._cpp_obj.getQ2Sum()
+        N = self._simulation.state.N_particles
+        box = self._simulation.state.box
+        kappa = _solve_kappa(k_max, (box.Lx, box.Ly, box.Lz), N, q2, rcut)
+
+        # set parameters, see pppm.Coulomb for the workaround of #1068
+        particle_types = self._simulation.state.particle_types
+        for a in particle_types:
+            for b in particle_types:
+                self._pair_force.params[(a, b)] = dict(kappa=kappa, alpha=alpha)
+                self._pair_force.r_cut[(a, b)] = rcut
+
+        self._cpp_obj.setParams(*k_max, kappa, alpha)
+
+    @hoomd.logging.log(requires_run=True)
+    def kappa(self):
+        """float: Splitting parameter :math:`\\mathrm{[length^{-1}]}`."""
+        return self._cpp_obj.kappa
+
+    @hoomd.logging.log(requires_run=True)
+    def num_k_vectors(self):
+        """int: Number of wave vectors in the reciprocal space sum."""
+        return self._cpp_obj.num_k_vectors
+
+    @property
+    def nlist(self):
+        """Neighbor list used to compute the real space term."""
+        return self._nlist
+
+    @nlist.setter
+    def nlist(self, value):
+        if self._attached:
+            raise RuntimeError("nlist cannot be set after scheduling.")
+        else:
+            self._nlist = hoomd.data.typeconverter.OnlyTypes(
+                hoomd.md.nlist.NeighborList)(value)
+
+            # ensure that the pair force uses the same neighbor list
+            self._pair_force.nlist = value
+
+
+def _kspace_error(k_max, L, N, kappa, q2):
+    """Estimate the RMS force error of the reciprocal space term."""
+    value = 0.0
+    for n, prd in zip(k_max, L):
+        if n == 0:
+            continue
+        rms = 2.0 * q2 * kappa / prd * math.sqrt(
+            1.0 / (math.pi * n * N)) * math.exp(
+                -math.pi * math.pi * n * n / (kappa * kappa * prd * prd))
+        value += rms * rms
+    return math.sqrt(value) / math.sqrt(3.0)
+
+
+def _real_space_error(L, N, kappa, q2, rcut):
+    """Estimate the RMS force error of the real space term."""
+    return 2.0 * q2 * math.exp(-kappa * kappa * rcut * rcut) / math.sqrt(
+        N * rcut * L[0] * L[1] * L[2])
+
+
+def _solve_kappa(k_max, L, N, q2, rcut):
+    """Find the kappa that balances the real and reciprocal space errors."""
+    if q2 == 0:
+        return 1.0 / rcut
+
+    # the reciprocal space error increases and the real space error decreases
+    # with kappa
+    def diff(kappa):
+        return (_kspace_error(k_max, L, N, kappa, q2)
+                - _real_space_error(L, N, kappa, q2, rcut))
+
+    lower = 1e-3 / rcut
+    upper = 10.0 / rcut
+    if diff(upper) < 0:
+        return upper
+
+    for i in range(100):
+        middle = 0.5 * (lower + upper)
+        if diff(middle) <= 0:
+            lower = middle
+        else:
+            upper = middle
+
+    return 0.5 * (lower + upper)
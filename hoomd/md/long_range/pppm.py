@@ -155,6 +155,24 @@ class Coulomb(Force):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        box_tolerance (float): Maximum relative change of the box lengths (and
+          absolute change of the tilt factors) for which `Coulomb` rescales the
+          influence function instead of recomputing it
+          :math:`\\mathrm{[dimensionless]}`. Defaults to 0.
+        pencil_fft (bool): When True, MPI simulations on the CPU compute the
+          distributed FFT on a two dimensional (pencil) decomposition of all
+          ranks instead of the domain decomposition. Defaults to False.
+
+    .. rubric:: Box changes
+
+    `Coulomb` recomputes the influence function every time the box changes,
+    which is every step with `md.methods.ConstantPressure`. When
+    ``box_tolerance`` is positive, `Coulomb` instead rescales the influence
+    function to the new box using the leading (non-aliased) term of the sum
+    and recomputes it fully only when the box deviates from the box of the last
+    full computation by more than ``box_tolerance``. Small tolerances, such as
+    ``1e-3``, introduce errors that are small compared to the error of the
+    PPPM method itself.
     """
 
     def __init__(self, nlist, resolution, order, r_cut, alpha, pair_force):
@@ -165,12 +183,16 @@ class Coulomb(Force):
             hoomd.data.parameterdicts.ParameterDict(resolution=(int, int, int),
                                                     order=int,
                                                     r_cut=float,
-                                                    alpha=float))
+                                                    alpha=float,
+                                                    box_tolerance=float,
+                                                    pencil_fft=bool))
 
         self.resolution = resolution
         self.order = order
         self.r_cut = r_cut
         self.alpha = alpha
+        self.box_tolerance = 0.0
+        self.pencil_fft = False
         self._pair_force = pair_force
 
     def _attach_hook(self):
@@ -184,7 +206,7 @@ class Coulomb(Force):
         # Access set parameters before attaching. These values are needed to
         # compute derived parameters before all paramters are given to the
         # _cpp_obj at the end.
-        Nx, Ny, Nz = self.resolution
+        resolution = self.resolution
         order = self.order
         rcut = self.r_cut
         alpha = self.alpha
@@ -193,50 +215,22 @@ class Coulomb(Force):
         self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
                             self.nlist._cpp_obj, group)
 
-        # compute the kappa parameter
+        self._set_parameters(resolution, order, rcut, alpha)
+
+    def _set_parameters(self, resolution, order, rcut, alpha, kappa=None):
+        """Set the parameters of the attached real and reciprocal space forces.
+
+        Compute the kappa that balances the real and reciprocal space errors
+        when ``kappa`` is None.
+        """
+        Nx, Ny, Nz = resolution
         q2 = self._cpp_obj.getQ2Sum()
         N = self._simulation.state.N_particles
-        box = self._simulation.state.box
-        Lx = box.Lx
-        Ly = box.Ly
-        Lz = box.Lz
-
-        hx = Lx / Nx
-        hy = Ly / Ny
-        hz = Lz / Nz
-
-        gew1 = 0.0
-        kappa = gew1
-        f = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-        hmin = min(hx, hy, hz)
-        gew2 = 10.0 / hmin
-        kappa = gew2
-        fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
 
-        if f * fmid >= 0.0:
-            raise RuntimeError("Cannot compute PPPM Coloumb forces,\n"
-                               "f*fmid >= 0.0")
-
-        if f < 0.0:
-            dgew = gew2 - gew1
-            rtb = gew1
-        else:
-            dgew = gew1 - gew2
-            rtb = gew2
-
-        ncount = 0
-
-        # iteratively compute kappa to minimize the error
-        while math.fabs(dgew) > 0.00001 and fmid != 0.0:
-            dgew *= 0.5
-            kappa = rtb + dgew
-            fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
-            if fmid <= 0.0:
-                rtb = kappa
-            ncount += 1
-            if ncount > 10000.0:
-                raise RuntimeError("Cannot compute PPPM\n"
-                                   "kappa is not converging")
+        if kappa is None:
+            box = self._simulation.state.box
+            kappa = _solve_kappa(box.Lx / Nx, box.Ly / Ny, box.Lz / Nz, box.Lx,
+                                 box.Ly, box.Lz, N, order, q2, rcut)
 
         # set parameters
         particle_types = self._simulation.state.particle_types
@@ -272,15 +266,290 @@ class Coulomb(Force):
             self._pair_force.nlist = value
 
 
-def _diffpr(hx, hy, hz, xprd, yprd, zprd, N, order, kappa, q2, rcut):
-    """Part of the algorithm that computes the estimated error of the method."""
+def make_pppm_dispersion_forces(nlist,
+                                resolution,
+                                order,
+                                r_cut,
+                                beta=None,
+                                rtol=1e-3):
+    """Long range dispersion interactions evaluated using the PPPM method.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        resolution (tuple[int, int, int]): Number of grid points in the x, y,
+          and z directions :math:`\\mathrm{[dimensionless]}`.
+        order (int): Number of grid points in each direction to assign the
+          dispersion coefficients to :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        beta (float): Splitting parameter :math:`\\beta`
+          :math:`\\mathrm{[length^{-1}]}`. When `None`, choose :math:`\\beta`
+          so that :math:`g(\\beta r_\\mathrm{cut}) =` ``rtol``.
+        rtol (float): Relative size of the real space term at the cutoff
+          used to choose :math:`\\beta` :math:`\\mathrm{[dimensionless]}`.
+
+    Evaluate the potential energy of the attractive :math:`r^{-6}` dispersion
+    interaction between all pairs of particles and all periodic images
+    (LJ-PME):
+
+    .. math::
+
+        U_\\mathrm{dispersion} = \\frac{1}{2} \\sum_\\vec{n}
+          \\sum_{i=0}^{N-1} \\sum_{j=0}^{N-1} \\left(-\\frac{C_{6,ij}}
+          {|\\vec{r}_j - \\vec{r}_i + n_1 \\cdot \\vec{a}_1
+          + n_2 \\cdot \\vec{a}_2 + n_3 \\cdot \\vec{a}_3|^6}\\right)
+
+    where the :math:`i = j, \\vec{n} = 0` term is omitted and the pair
+    coefficients follow the geometric mixing rule :math:`C_{6,ij} =
+    \\sqrt{C_{6,i} C_{6,j}}` of the per-type coefficients `Dispersion.c6`.
+
+    The method splits :math:`r^{-6} = g(\\beta r) r^{-6} + (1 - g(\\beta r))
+    r^{-6}` with :math:`g(x) = e^{-x^2} (1 + x^2 + x^4 / 2)`.
+    `md.long_range.pppm.Dispersion` computes the long-range part
+    :math:`-C_{6,ij} (1 - g(\\beta r)) r^{-6}` of all pairs on a mesh.
+    Inside the cutoff, `md.pair.DispersionEwald` adds it back, so that a pair
+    potential with the full :math:`-C_{6,ij} r^{-6}` term, such as `md.pair.LJ`
+    with ``mode='none'`` and the same cutoff, is exact there. Beyond the
+    cutoff, the method neglects the short-range part :math:`-C_{6,ij}
+    g(\\beta r) r^{-6}`.
+
+    * `Essmann et. al. 1995`_ describes the Ewald sum for :math:`r^{-6}`
+      interactions.
+    * `Isele-Holder, Mitchell, and Ismail 2012`_ describes the PPPM method for
+      dispersion.
+
+    Set the dispersion coefficient of each particle type with
+    `Dispersion.c6` before the first run. For Lennard-Jones particles,
+    :math:`C_6 = 4 \\varepsilon \\sigma^6`.
+
+    .. rubric:: Exclusions
+
+    `md.long_range.pppm.Dispersion` removes the long-range part of the
+    interaction between pairs that ``nlist`` excludes, including the pairs
+    within rigid bodies when ``nlist`` excludes ``'body'``.
+
+    Important:
+        In MPI simulations with multiple ranks, the grid resolution must be a
+        power of two in each dimension.
+
+    Note:
+        `md.long_range.pppm.Dispersion` computes the mesh on the CPU also when
+        the device is a GPU.
+
+    Returns:
+        ``real_space_force``, ``reciprocal_space_force``
+
+        Add both of these forces to the integrator.
+
+    Warning:
+        `make_pppm_dispersion_forces` sets all parameters of the returned
+        `md.pair.DispersionEwald` when the forces attach. Do not change the
+        parameters of the returned objects directly, and do not change
+        `Dispersion.c6` after the first run.
+
+    .. _Essmann et. al. 1995: https://doi.org/10.1063/1.470117
+
+    .. _Isele-Holder, Mitchell, and Ismail 2012:
+      https://doi.org/10.1063/1.4764089
+    """
+    if beta is None:
+        beta = _solve_beta(r_cut, rtol)
+
+    real_space_force = hoomd.md.pair.DispersionEwald(nlist)
+
+    # the real space force may be attached before the reciprocal space one
+    # set default parameters to avoid errors in this case
+    real_space_force.params.default = dict(c6=0, beta=beta)
+    real_space_force.r_cut.default = r_cut
+
+    reciprocal_space_force = Dispersion(nlist=nlist,
+                                        resolution=resolution,
+                                        order=order,
+                                        r_cut=r_cut,
+                                        beta=beta,
+                                        pair_force=real_space_force)
+
+    return real_space_force, reciprocal_space_force
+
+
+class Dispersion(Force):
+    """Reciprocal space part of the PPPM dispersion forces.
+
+    Note:
+        Use `make_pppm_dispersion_forces` to create a connected pair of
+        `md.pair.DispersionEwald` and `md.long_range.pppm.Dispersion` instances
+        that together implement the PPPM method for dispersion.
+
+    Attributes:
+        resolution (tuple[int, int, int]): Number of grid points in the x, y,
+          and z directions :math:`\\mathrm{[dimensionless]}`.
+        order (int): Number of grid points in each direction to assign the
+          dispersion coefficients to :math:`\\mathrm{[dimensionless]}`.
+        r_cut (float): Cutoff distance between the real space and reciprocal
+          space terms :math:`\\mathrm{[length]}`.
+        beta (float): Splitting parameter :math:`\\mathrm{[length^{-1}]}`.
+        pencil_fft (bool): When True, MPI simulations compute the distributed
+          FFT on a two dimensional (pencil) decomposition of all ranks instead
+          of the domain decomposition. Defaults to False.
+
+    .. py:attribute:: c6
+
+        Dispersion coefficient :math:`C_6` of a pair of particles of each type
+        :math:`\\mathrm{[energy] \\cdot [length]^6}`.
+
+        Type: `TypeParameter` [``particle_type``, `float`]
+    """
+
+    def __init__(self, nlist, resolution, order, r_cut, beta, pair_force):
+        super().__init__()
+        self._nlist = hoomd.data.typeconverter.OnlyTypes(
+            hoomd.md.nlist.NeighborList)(nlist)
+        self._param_dict.update(
+            hoomd.data.parameterdicts.ParameterDict(resolution=(int, int, int),
+                                                    order=int,
+                                                    r_cut=float,
+                                                    beta=float,
+                                                    pencil_fft=bool))
+
+        self.resolution = resolution
+        self.order = order
+        self.r_cut = r_cut
+        self.beta = beta
+        self.pencil_fft = False
+        self._pair_force = pair_force
+
+        c6 = hoomd.data.typeparam.TypeParameter(
+            'c6', 'particle_types',
+            hoomd.data.parameterdicts.TypeParameterDict(float, len_keys=1))
+        self._add_typeparam(c6)
+
+    def _attach_hook(self):
+        if self._simulation.state.box.is2D:
+            raise ValueError("The dispersion PPPM method is not implemented "
+                             "for 2D simulations.")
+
+        self.nlist._attach(self._simulation)
+
+        # the mesh is computed on the host on all devices
+        cls = hoomd.md._md.PPPMDispersionForceCompute
+
+        # Access set parameters before attaching. The pair coefficients of the
+        # real space force derive from them.
+        Nx, Ny, Nz = self.resolution
+        order = self.order
+        rcut = self.r_cut
+        beta = self.beta
+
+        group = self._simulation.state._get_group(hoomd.filter.All())
+        self._cpp_obj = cls(self._simulation.state._cpp_sys_def,
+                            self.nlist._cpp_obj, group)
+
+        # set parameters, see Coulomb for the workaround of #1068
+        particle_types = self._simulation.state.particle_types
+        for a in particle_types:
+            for b in particle_types:
+                c6 = math.sqrt(self.c6[a] * self.c6[b])
+                self._pair_force.params[(a, b)] = dict(c6=c6, beta=beta)
+                self._pair_force.r_cut[(a, b)] = rcut
+
+        self._cpp_obj.setParams(Nx, Ny, Nz, order, beta, rcut, 0)
+
+    @property
+    def nlist(self):
+        """Neighbor list used to compute the real space term."""
+        return self._nlist
+
+    @nlist.setter
+    def nlist(self, value):
+        if self._attached:
+            raise RuntimeError("nlist cannot be set after scheduling.")
+        else:
+            self._nlist = hoomd.data.typeconverter.OnlyTypes(
+                hoomd.md.nlist.NeighborList)(value)
+
+            # ensure that the pair force uses the same neighbor list
+            self._pair_force.nlist = value
+
+
+def _solve_beta(r_cut, rtol):
+    """Find the beta where the real space term is rtol at the cutoff."""
+
+    # g(x) decreases monotonically from 1 at x = 0
+    def g(x):
+        return math.exp(-x * x) * (1.0 + x * x + 0.5 * x**4)
+
+    lower = 0.0
+    upper = 1.0
+    while g(upper) > rtol:
+        upper *= 2.0
+
+    for i in range(100):
+        middle = 0.5 * (lower + upper)
+        if g(middle) > rtol:
+            lower = middle
+        else:
+            upper = middle
+
+    return 0.5 * (lower + upper) / r_cut
+
+
+def _solve_kappa(hx, hy, hz, Lx, Ly, Lz, N, order, q2, rcut):
+    """Find the kappa that balances the real and reciprocal space errors."""
+    gew1 = 0.0
+    kappa = gew1
+    f = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+    hmin = min(hx, hy, hz)
+    gew2 = 10.0 / hmin
+    kappa = gew2
+    fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+
+    if f * fmid >= 0.0:
+        raise RuntimeError("Cannot compute PPPM Coloumb forces,\n"
+                           "f*fmid >= 0.0")
+
+    if f < 0.0:
+        dgew = gew2 - gew1
+        rtb = gew1
+    else:
+        dgew = gew1 - gew2
+        rtb = gew2
+
+    ncount = 0
+
+    # iteratively compute kappa to minimize the error
+    while math.fabs(dgew) > 0.00001 and fmid != 0.0:
+        dgew *= 0.5
+        kappa = rtb + dgew
+        fmid = _diffpr(hx, hy, hz, Lx, Ly, Lz, N, order, kappa, q2, rcut)
+        if fmid <= 0.0:
+            rtb = kappa
+        ncount += 1
+        if ncount > 10000.0:
+            raise RuntimeError("Cannot compute PPPM\n"
+                               "kappa is not converging")
+
+    return kappa
+
+
+def _kspace_error(hx, hy, hz, xprd, yprd, zprd, N, order, kappa, q2):
+    """Estimate the RMS force error of the reciprocal space term."""
     lprx = _rms(hx, xprd, N, order, kappa, q2)
     lpry = _rms(hy, yprd, N, order, kappa, q2)
     lprz = _rms(hz, zprd, N, order, kappa, q2)
-    kspace_prec = math.sqrt(lprx * lprx + lpry * lpry
-                            + lprz * lprz) / math.sqrt(3.0)
-    real_prec = 2.0 * q2 * math.exp(-kappa * kappa * rcut * rcut) / math.sqrt(
+    return math.sqrt(lprx * lprx + lpry * lpry + lprz * lprz) / math.sqrt(3.0)
+
+
+def _real_space_error(xprd, yprd, zprd, N, kappa, q2, rcut):
+    """Estimate the RMS force error of the real space term."""
+    return 2.0 * q2 * math.exp(-kappa * kappa * rcut * rcut) / math.sqrt(
         N * rcut * xprd * yprd * zprd)
+
+
+def _diffpr(hx, hy, hz, xprd, yprd, zprd, N, order, kappa, q2, rcut):
+    """Part of the algorithm that computes the estimated error of the method."""
+    kspace_prec = _kspace_error(hx, hy, hz, xprd, yprd, zprd, N, order, kappa,
+                                q2)
+    real_prec = _real_space_error(xprd, yprd, zprd, N, kappa, q2, rcut)
     value = kspace_prec - real_prec
     return value
 
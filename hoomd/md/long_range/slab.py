@@ -0,0 +1,62 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Corrections for long-range potentials in slab geometries."""
+
+import hoomd
+from hoomd.md.force import Force
+
+
+class DipoleCorrection(Force):
+    """Yeh-Berkowitz dipole correction for slab systems.
+
+    `DipoleCorrection` removes the spurious interaction between the periodic
+    images of a slab along the :math:`z` direction. Use it together with
+    `md.long_range.pppm.make_pppm_coulomb_forces` to model systems that are
+    periodic in :math:`x` and :math:`y` only:
+
+    .. math::
+
+        U_\\mathrm{slab} = \\frac{2 \\pi}{V} \\left( M_z^2
+          - Q \\sum_{i=0}^{N-1} q_i z_i^2 - \\frac{Q^2 L_z^2}{12} \\right)
+
+    where :math:`V` is the box volume, :math:`L_z` is the box length in
+    :math:`z`, :math:`Q = \\sum_i q_i` is the net charge, and
+    :math:`M_z = \\sum_i q_i z_i` is the :math:`z` component of the dipole
+    moment of the box. The terms proportional to :math:`Q` correct non-neutral
+    systems as described in `Ballenegger et. al. 2009`_. The force on particle
+    :math:`i` is:
+
+    .. math::
+
+        F_{z,i} = -\\frac{4 \\pi}{V} q_i \\left( M_z - Q z_i \\right)
+
+    `DipoleCorrection` assigns the energy
+    :math:`\\frac{2 \\pi}{V} q_i z_i (M_z - Q z_i)` to each particle and the
+    constant term to ``additional_energy``. It does not contribute to the
+    virial.
+
+    Important:
+        The correction is valid only when the slab is separated from its
+        periodic images by vacuum. Set :math:`L_z` to at least 3 times the
+        thickness of the slab (`Yeh and Berkowitz 1999`_) and prevent particles
+        from crossing the :math:`z` boundary of the box, e.g. with walls.
+
+    Note:
+        :math:`M_z` depends on the image of each particle. `DipoleCorrection`
+        uses the wrapped particle positions.
+
+    .. _Yeh and Berkowitz 1999: https://doi.org/10.1063/1.479595
+
+    .. _Ballenegger et. al. 2009: https://doi.org/10.1063/1.3216473
+    """
+
+    def __init__(self):
+        super().__init__()
+
+    def _attach_hook(self):
+        if self._simulation.state.box.is2D:
+            raise ValueError("DipoleCorrection requires a 3D simulation box.")
+
+        self._cpp_obj = hoomd.md._md.SlabCorrectionForceCompute(
+            self._simulation.state._cpp_sys_def)
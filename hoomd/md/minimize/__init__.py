@@ -4,3 +4,4 @@
 """Energy minimizer for molecular dynamics."""
 
 from hoomd.md.minimize.fire import FIRE
+from hoomd.md.minimize.lbfgs import LBFGS
@@ -0,0 +1,192 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""L-BFGS energy minimizer."""
+
+import hoomd
+
+from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data import syncedlist
+from hoomd.data.typeconverter import OnlyTypes, positive_real
+from hoomd.logging import log
+from hoomd.md import _md
+from hoomd.md.integrate import _DynamicIntegrator
+
+
+class LBFGS(_DynamicIntegrator):
+    """Energy Minimizer (L-BFGS).
+
+    Args:
+        max_displacement (float):
+            Maximum distance any particle moves in one iteration
+            :math:`[\\mathrm{length}]`.
+        force_tol (float):
+            Force convergence criteria :math:`[\\mathrm{force}]`.
+        energy_tol (float):
+            Energy convergence criteria :math:`[\\mathrm{energy}]`.
+        forces (Sequence[hoomd.md.force.Force]):
+            Sequence of forces applied to the particles in the system. All the
+            forces are summed together. The default value of ``None``
+            initializes an empty list.
+        methods (Sequence[hoomd.md.methods.ConstantVolume]):
+            Sequence of integration methods that select the particles to move.
+            The intersection of the subsets must be null. The default value of
+            ``None`` initializes an empty list.
+        constraints (Sequence[hoomd.md.constrain.Constraint]):
+            Sequence of constraint forces applied to the particles in the
+            system. The default value of ``None`` initializes an empty list.
+            Rigid body objects (i.e. `hoomd.md.constrain.Rigid`) are not
+            allowed in the list.
+        memory (int):
+            Number of previous steps used to estimate the inverse Hessian.
+        min_steps_conv (int):
+            A minimum number of attempts before convergence criteria are
+            considered.
+
+    `LBFGS` is a `hoomd.md.Integrator` that minimizes the potential energy of
+    a group of particles with the limited memory
+    Broyden-Fletcher-Goldfarb-Shanno (L-BFGS) method while keeping all other
+    particles fixed. See
+    `Nocedal, Math. Comp., 1980
+    <https://doi.org/10.1090/S0025-5718-1980-0572855-7>`_.
+
+    Each time step performs one iteration that evaluates the forces once. The
+    minimizer moves the particles along
+
+    .. math::
+
+        \\vec{d} = -H_k \\nabla U
+
+    where :math:`H_k` is the estimate of the inverse Hessian built from the
+    last `memory` displacements and changes in the forces. The step is scaled
+    down so that no particle moves further than `max_displacement`. When the
+    energy increases over a step, the minimizer returns to the midpoint of the
+    step and discards the history; repeated increases bisect the step.
+
+    Compared to `FIRE`, `LBFGS` typically needs far fewer force evaluations
+    to reach the minimum of a smooth potential energy surface. It only moves
+    particle positions: it does not integrate rotational degrees of freedom,
+    relax the box, or support rigid bodies.
+
+    The method converges when the force per degree of freedom is below
+    `force_tol` and the change in potential energy per particle from one
+    accepted step to the next is below `energy_tol`:
+
+    .. math::
+
+        \\frac{|F|}{\\sqrt{N_{dof}}} < \\mathrm{\\text{force_tol}}
+        \\;\\;, and \\;\\ \\Delta \\frac{\\sum|E|}{N} <
+        \\mathrm{\\text{energy_tol}}
+
+    Examples::
+
+        lbfgs = md.minimize.LBFGS(max_displacement=0.05,
+                                  force_tol=1e-3,
+                                  energy_tol=1e-7)
+        lbfgs.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+        sim.operations.integrator = lbfgs
+        while not(lbfgs.converged):
+           sim.run(100)
+
+    Note:
+        To use `LBFGS`, set it as the simulation's integrator in place of the
+        typical `hoomd.md.Integrator`.
+
+    Note:
+        The integration methods only select the particles to move. Their
+        thermostats are ignored and they do not update the velocities.
+
+    Note:
+        The history is discarded when the particles are sorted or migrate
+        between ranks. Call `reset` after modifying the particle positions or
+        forces between runs.
+
+    Note:
+        The minimizer runs on the CPU. On the GPU, each iteration copies the
+        forces and positions between the host and the device.
+
+    Attributes:
+        max_displacement (float):
+            Maximum distance any particle moves in one iteration
+            :math:`[\\mathrm{length}]`.
+        force_tol (float):
+            Force convergence criteria :math:`[\\mathrm{force}]`.
+        energy_tol (float):
+            Energy convergence criteria :math:`[\\mathrm{energy}]`.
+        forces (Sequence[hoomd.md.force.Force]):
+            Sequence of forces applied to the particles in the system. All the
+            forces are summed together.
+        methods (Sequence[hoomd.md.methods.ConstantVolume]):
+            Sequence of integration methods that select the particles to move.
+        constraints (Sequence[hoomd.md.constrain.Constraint]):
+            Sequence of constraint forces applied to the particles in the
+            system.
+        memory (int):
+            Number of previous steps used to estimate the inverse Hessian.
+        min_steps_conv (int):
+            A minimum number of attempts before convergence criteria are
+            considered.
+    """
+    _cpp_class_name = "LBFGSEnergyMinimizer"
+
+    def __init__(self,
+                 max_displacement,
+                 force_tol,
+                 energy_tol,
+                 forces=None,
+                 constraints=None,
+                 methods=None,
+                 memory=5,
+                 min_steps_conv=10):
+
+        super().__init__(forces, constraints, methods, None)
+
+        pdict = ParameterDict(
+            max_displacement=float(max_displacement),
+            force_tol=float(force_tol),
+            energy_tol=float(energy_tol),
+            memory=OnlyTypes(int, preprocess=positive_real),
+            min_steps_conv=OnlyTypes(int, preprocess=positive_real),
+            _defaults={
+                'memory': 5,
+                'min_steps_conv': 10
+            })
+
+        self._param_dict.update(pdict)
+
+        # set these values explicitly so they can be validated
+        self.memory = memory
+        self.min_steps_conv = min_steps_conv
+
+        # have to remove methods from old syncedlist so new syncedlist doesn't
+        # think members are attached to multiple syncedlists
+        self._methods.clear()
+
+        methods_list = syncedlist.SyncedList(
+            OnlyTypes(hoomd.md.methods.ConstantVolume),
+            syncedlist._PartialGetAttr("_cpp_obj"),
+            iterable=methods)
+        self._methods = methods_list
+
+    def _attach_hook(self):
+        self._cpp_obj = _md.LBFGSEnergyMinimizer(
+            self._simulation.state._cpp_sys_def, self.max_displacement,
+            self.memory)
+        super()._attach_hook()
+
+    @log(requires_run=True)
+    def energy(self):
+        """float: Get the energy after the last iteration of the minimizer."""
+        return self._cpp_obj.energy
+
+    @log(default=False)
+    def converged(self):
+        """bool: True when the minimizer has converged, else False."""
+        if not self._attached:
+            return False
+
+        return self._cpp_obj.converged
+
+    def reset(self):
+        """Reset the minimizer to its initial state."""
+        return self._cpp_obj.reset()
@@ -21,6 +21,9 @@ void export_ActiveForceConstraintComputeSphere(pybind11::module& m);
 void export_ActiveRotationalDiffusionUpdater(pybind11::module& m);
 void export_ComputeThermo(pybind11::module& m);
 void export_ComputeThermoHMA(pybind11::module& m);
+void export_RDFAnalyzer(pybind11::module& m);
+void export_SteinhardtCompute(pybind11::module& m);
+void export_CorrelatorAnalyzer(pybind11::module& m);
 void export_ConstantForceCompute(pybind11::module& m);
 void export_HarmonicAngleForceCompute(pybind11::module& m);
 void export_CosineSqAngleForceCompute(pybind11::module& m);
@@ -32,14 +35,21 @@ void export_TableDihedralForceCompute(pybind11::module& m);
 void export_HarmonicImproperForceCompute(pybind11::module& m);
 void export_BondTablePotential(pybind11::module& m);
 void export_CustomForceCompute(pybind11::module& m);
+#ifdef ENABLE_TORCH
+void export_TorchForceCompute(pybind11::module& m);
+#endif
 void export_NeighborList(pybind11::module& m);
 void export_NeighborListBinned(pybind11::module& m);
+void export_NeighborListInner(pybind11::module& m);
 void export_NeighborListStencil(pybind11::module& m);
 void export_NeighborListTree(pybind11::module& m);
 void export_MolecularForceCompute(pybind11::module& m);
 void export_ForceDistanceConstraint(pybind11::module& m);
 void export_ForceComposite(pybind11::module& m);
 void export_PPPMForceCompute(pybind11::module& m);
+void export_PPPMDispersionForceCompute(pybind11::module& m);
+void export_SlabCorrectionForceCompute(pybind11::module& m);
+void export_EwaldForceCompute(pybind11::module& m);
 void export_wall_data(pybind11::module& m);
 void export_wall_field(pybind11::module& m);
 void export_LocalNeighborListDataHost(pybind11::module& m);
@@ -54,6 +64,7 @@ void export_PotentialPairExpandedGaussian(pybind11::module& m);
 void export_PotentialPairExpandedMie(pybind11::module& m);
 void export_PotentialPairYukawa(pybind11::module& m);
 void export_PotentialPairEwald(pybind11::module& m);
+void export_PotentialPairDispersionEwald(pybind11::module& m);
 void export_PotentialPairMorse(pybind11::module& m);
 void export_PotentialPairMoliere(pybind11::module& m);
 void export_PotentialPairZBL(pybind11::module& m);
@@ -66,11 +77,13 @@ void export_PotentialPairTWF(pybind11::module& m);
 void export_PotentialPairLJGauss(pybind11::module& m);
 void export_PotentialPairForceShiftedLJ(pybind11::module& m);
 void export_PotentialPairTable(pybind11::module& m);
+void export_PotentialPairLJYukawa(pybind11::module& m);
 
 void export_AnisoPotentialPairALJ2D(pybind11::module& m);
 void export_AnisoPotentialPairALJ3D(pybind11::module& m);
 void export_AnisoPotentialPairDipole(pybind11::module& m);
 void export_AnisoPotentialPairGB(pybind11::module& m);
+void export_AnisoPotentialPairSiteLJ(pybind11::module& m);
 
 void export_PotentialBondHarmonic(pybind11::module& m);
 void export_PotentialBondFENE(pybind11::module& m);
@@ -104,6 +117,8 @@ void export_PotentialPairDPDThermoLJ(pybind11::module& m);
 void export_IntegratorTwoStep(pybind11::module& m);
 void export_IntegrationMethodTwoStep(pybind11::module& m);
 void export_ZeroMomentumUpdater(pybind11::module& m);
+void export_ReplicaExchangeUpdater(pybind11::module& m);
+void export_TypeSwapUpdater(pybind11::module& m);
 
 void export_Thermostat(pybind11::module& m);
 void export_MTTKThermostat(pybind11::module& m);
@@ -117,6 +132,7 @@ void export_TwoStepBD(pybind11::module& m);
 void export_TwoStepConstantPressure(pybind11::module& m);
 void export_TwoStepNVTAlchemy(pybind11::module& m);
 void export_FIREEnergyMinimizer(pybind11::module& m);
+void export_LBFGSEnergyMinimizer(pybind11::module& m);
 void export_MuellerPlatheFlow(pybind11::module& m);
 void export_AlchemostatTwoStep(pybind11::module& m);
 void export_HalfStepHook(pybind11::module& m);
@@ -168,6 +184,9 @@ void export_ActiveForceConstraintComputeSphereGPU(pybind11::module& m);
 void export_ActiveForceComputeGPU(pybind11::module& m);
 void export_ComputeThermoGPU(pybind11::module& m);
 void export_ComputeThermoHMAGPU(pybind11::module& m);
+void export_SteinhardtComputeGPU(pybind11::module& m);
+void export_TypeSwapUpdaterGPU(pybind11::module& m);
+void export_ZeroMomentumUpdaterGPU(pybind11::module& m);
 void export_ConstantForceComputeGPU(pybind11::module& m);
 void export_HarmonicAngleForceComputeGPU(pybind11::module& m);
 void export_CosineSqAngleForceComputeGPU(pybind11::module& m);
@@ -179,12 +198,14 @@ void export_HarmonicImproperForceComputeGPU(pybind11::module& m);
 void export_BondTablePotentialGPU(pybind11::module& m);
 void export_NeighborListGPU(pybind11::module& m);
 void export_NeighborListGPUBinned(pybind11::module& m);
+void export_NeighborListGPUInner(pybind11::module& m);
 void export_NeighborListGPUStencil(pybind11::module& m);
 void export_NeighborListGPUTree(pybind11::module& m);
 void export_ForceDistanceConstraintGPU(pybind11::module& m);
 void export_ForceCompositeGPU(pybind11::module& m);
 void export_PeriodicImproperForceComputeGPU(pybind11::module& m);
 void export_PPPMForceComputeGPU(pybind11::module& m);
+void export_EwaldForceComputeGPU(pybind11::module& m);
 void export_LocalNeighborListDataGPU(pybind11::module& m);
 
 void export_PotentialPairBuckinghamGPU(pybind11::module& m);
@@ -197,6 +218,7 @@ void export_PotentialPairExpandedGaussianGPU(pybind11::module& m);
 void export_PotentialPairExpandedMieGPU(pybind11::module& m);
 void export_PotentialPairYukawaGPU(pybind11::module& m);
 void export_PotentialPairEwaldGPU(pybind11::module& m);
+void export_PotentialPairDispersionEwaldGPU(pybind11::module& m);
 void export_PotentialPairMorseGPU(pybind11::module& m);
 void export_PotentialPairMoliereGPU(pybind11::module& m);
 void export_PotentialPairZBLGPU(pybind11::module& m);
@@ -209,12 +231,15 @@ void export_PotentialPairTWFGPU(pybind11::module& m);
 void export_PotentialPairLJGaussGPU(pybind11::module& m);
 void export_PotentialPairForceShiftedLJGPU(pybind11::module& m);
 void export_PotentialPairTableGPU(pybind11::module& m);
+void export_PotentialPairLJYukawaGPU(pybind11::module& m);
 void export_PotentialPairConservativeDPDGPU(pybind11::module& m);
+void export_PotentialPairAlchemicalLJGaussGPU(pybind11::module& m);
 
 void export_AnisoPotentialPairALJ2DGPU(pybind11::module& m);
 void export_AnisoPotentialPairALJ3DGPU(pybind11::module& m);
 void export_AnisoPotentialPairDipoleGPU(pybind11::module& m);
 void export_AnisoPotentialPairGBGPU(pybind11::module& m);
+void export_AnisoPotentialPairSiteLJGPU(pybind11::module& m);
 
 void export_PotentialBondHarmonicGPU(pybind11::module& m);
 void export_PotentialBondFENEGPU(pybind11::module& m);
@@ -301,6 +326,9 @@ PYBIND11_MODULE(_md, m)
     export_ActiveRotationalDiffusionUpdater(m);
     export_ComputeThermo(m);
     export_ComputeThermoHMA(m);
+    export_RDFAnalyzer(m);
+    export_SteinhardtCompute(m);
+    export_CorrelatorAnalyzer(m);
     export_ConstantForceCompute(m);
     export_HarmonicAngleForceCompute(m);
     export_CosineSqAngleForceCompute(m);
@@ -322,6 +350,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedMie(m);
     export_PotentialPairYukawa(m);
     export_PotentialPairEwald(m);
+    export_PotentialPairDispersionEwald(m);
     export_PotentialPairMorse(m);
     export_PotentialPairMoliere(m);
     export_PotentialPairZBL(m);
@@ -334,6 +363,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairLJGauss(m);
     export_PotentialPairForceShiftedLJ(m);
     export_PotentialPairTable(m);
+    export_PotentialPairLJYukawa(m);
 
     export_AlchemicalMDParticles(m);
     export_PotentialPairAlchemicalLJGauss(m);
@@ -346,6 +376,7 @@ PYBIND11_MODULE(_md, m)
     export_AnisoPotentialPairALJ3D(m);
     export_AnisoPotentialPairDipole(m);
     export_AnisoPotentialPairGB(m);
+    export_AnisoPotentialPairSiteLJ(m);
 
     export_PotentialPairDPDThermoDPD(m);
     export_PotentialPairDPDThermoLJ(m);
@@ -362,14 +393,21 @@ PYBIND11_MODULE(_md, m)
     export_PotentialSpecialPairCoulomb(m);
 
     export_CustomForceCompute(m);
+#ifdef ENABLE_TORCH
+    export_TorchForceCompute(m);
+#endif
     export_NeighborList(m);
     export_NeighborListBinned(m);
+    export_NeighborListInner(m);
     export_NeighborListStencil(m);
     export_NeighborListTree(m);
     export_MolecularForceCompute(m);
     export_ForceDistanceConstraint(m);
     export_ForceComposite(m);
     export_PPPMForceCompute(m);
+    export_PPPMDispersionForceCompute(m);
+    export_SlabCorrectionForceCompute(m);
+    export_EwaldForceCompute(m);
     export_LocalNeighborListDataHost(m);
 
     export_PotentialExternalPeriodic(m);
@@ -389,6 +427,7 @@ PYBIND11_MODULE(_md, m)
 #ifdef ENABLE_HIP
     export_NeighborListGPU(m);
     export_NeighborListGPUBinned(m);
+    export_NeighborListGPUInner(m);
     export_NeighborListGPUStencil(m);
     export_NeighborListGPUTree(m);
     export_ForceCompositeGPU(m);
@@ -404,6 +443,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairExpandedMieGPU(m);
     export_PotentialPairYukawaGPU(m);
     export_PotentialPairEwaldGPU(m);
+    export_PotentialPairDispersionEwaldGPU(m);
     export_PotentialPairMorseGPU(m);
     export_PotentialPairMoliereGPU(m);
     export_PotentialPairZBLGPU(m);
@@ -416,7 +456,9 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairLJGaussGPU(m);
     export_PotentialPairForceShiftedLJGPU(m);
     export_PotentialPairTableGPU(m);
+    export_PotentialPairLJYukawaGPU(m);
     export_PotentialPairConservativeDPDGPU(m);
+    export_PotentialPairAlchemicalLJGaussGPU(m);
 
     export_PotentialTersoffGPU(m);
     export_PotentialSquareDensityGPU(m);
@@ -429,6 +471,7 @@ PYBIND11_MODULE(_md, m)
     export_AnisoPotentialPairALJ3DGPU(m);
     export_AnisoPotentialPairDipoleGPU(m);
     export_AnisoPotentialPairGBGPU(m);
+    export_AnisoPotentialPairSiteLJGPU(m);
 
     export_PotentialBondHarmonicGPU(m);
     export_PotentialBondFENEGPU(m);
@@ -451,8 +494,12 @@ PYBIND11_MODULE(_md, m)
     export_ForceDistanceConstraintGPU(m);
     export_ComputeThermoGPU(m);
     export_ComputeThermoHMAGPU(m);
+    export_SteinhardtComputeGPU(m);
+    export_TypeSwapUpdaterGPU(m);
+    export_ZeroMomentumUpdaterGPU(m);
     export_PeriodicImproperForceComputeGPU(m);
     export_PPPMForceComputeGPU(m);
+    export_EwaldForceComputeGPU(m);
     export_ActiveForceComputeGPU(m);
     export_ActiveForceConstraintComputeCylinderGPU(m);
     export_ActiveForceConstraintComputeDiamondGPU(m);
@@ -483,12 +530,15 @@ PYBIND11_MODULE(_md, m)
     export_IntegratorTwoStep(m);
     export_IntegrationMethodTwoStep(m);
     export_ZeroMomentumUpdater(m);
+    export_ReplicaExchangeUpdater(m);
+    export_TypeSwapUpdater(m);
     export_TwoStepConstantVolume(m);
     export_TwoStepLangevinBase(m);
     export_TwoStepLangevin(m);
     export_TwoStepBD(m);
     export_TwoStepConstantPressure(m);
     export_FIREEnergyMinimizer(m);
+    export_LBFGSEnergyMinimizer(m);
     export_MuellerPlatheFlow(m);
     export_AlchemostatTwoStep(m);
     export_TwoStepNVTAlchemy(m);
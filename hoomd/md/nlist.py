@@ -36,6 +36,23 @@ Note:
     `NeighborList.buffer` between the two extremes that provides the best
     performance.
 
+Set `NeighborList.pair_buffer` to use a smaller buffer for specific pairs of
+particle types, for example the small solvent particles in a mixture with large
+colloids. The neighbor list includes pairs of types *i* and *j* within
+:math:`r_{\mathrm{cut},i,j} + \mathrm{pair\_buffer}_{i,j}` and rebuilds when
+any particle of type *i* moves a distance :math:`\mathrm{pair\_buffer}_{i,j}/2`
+for any type *j*. In MPI simulations, the ghost layer for particles of type
+*j* extends to the largest :math:`r_{\mathrm{cut},i,j}` plus the displacements
+allowed for types *i* and *j*, so smaller pair buffers also reduce the number
+of ghost particles. `hoomd.md.tune.NeighborListPairBuffer` tunes the per pair
+buffers for maximum performance.
+
+Note:
+    `NeighborList.buffer` is the upper bound of all pair buffers. Larger values
+    of `NeighborList.pair_buffer` have the same effect as
+    `NeighborList.buffer`. Only the CPU neighbor lists apply pair buffers, the
+    GPU neighbor lists always use `NeighborList.buffer`.
+
 .. rubric:: Base distance cutoff
 
 The `NeighborList.r_cut` attribute can be used to set the base cutoff distance
@@ -51,6 +68,46 @@ Attention:
     `pair_list`, `local_pair_list`, `cpu_local_nlist_arrays`, or
     `gpu_local_nlist_arrays`.
 
+.. rubric:: Cluster pair list
+
+Set `NeighborList.clusters` to `True` to also store the neighbor list as a list
+of cluster pairs. The cluster pair list groups particles into small spatially
+compact clusters and stores, for each cluster, the neighboring clusters along
+with a mask of the interacting particle pairs. `hoomd.md.pair.Pair` processes
+the neighbors one cluster at a time which reduces the amount of neighbor list
+data read during the force computation. The cluster pair list contains the same
+pairs as the per-particle list, so enabling it does not change the simulation
+results beyond floating point round off.
+
+Note:
+    The cluster pair list is only available on the CPU. `NeighborList` ignores
+    `NeighborList.clusters` when executing on the GPU.
+
+.. rubric:: Incremental updates
+
+Set `NeighborList.incremental` to `True` to update the neighbor list in place
+when only a few particles have moved far enough to require an update. Instead
+of rebuilding the whole list, `NeighborList` recomputes the neighbors of the
+displaced particles only. The list remains valid: it may contain additional
+pairs that have since moved apart, which the pair force computation skips.
+`NeighborList` falls back to a full rebuild periodically, when many particles
+are displaced, when the box changes, and when the list must be reallocated.
+
+Note:
+    Incremental updates are only available on the CPU with a single MPI rank.
+    `NeighborList` always performs full rebuilds in other cases.
+
+.. rubric:: Dual cutoffs
+
+Systems that combine a long range screened force (such as
+`hoomd.md.pair.Yukawa` or `hoomd.md.pair.DLVO` with a long screening length)
+and short range forces (such as `hoomd.md.pair.LJ`) spend most of the neighbor
+list time finding pairs for the long cutoff. Use an `Inner` neighbor list for
+the short range forces to filter their pairs from the neighbor list of the long
+range force instead of searching the cell list twice. Set
+`hoomd.md.Force.interval` on the long range force to evaluate it less often than
+the short range forces.
+
 .. rubric:: Exclusions
 
 Neighbor lists nominally include all particles within the chosen cutoff
@@ -103,6 +160,10 @@ class NeighborList(Compute):
         mesh (Mesh): mesh data structure (optional)
         default_r_cut (float): Default cutoff distance :math:`[\mathrm{length}]`
             (optional).
+        clusters (bool): When `True`, also build the cluster pair list (CPU
+            only).
+        incremental (bool): When `True`, update the neighbor list
+            incrementally when possible (CPU only).
 
     .. py:attribute:: r_cut
 
@@ -112,10 +173,25 @@ class NeighborList(Compute):
 
         Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
         `float`])
+
+    .. py:attribute:: pair_buffer
+
+        Buffer width for a pair of particle types :math:`[\mathrm{length}]`.
+        ``None`` selects `buffer`. *Optional*: defaults to ``None``.
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `float` or `None`])
     """
 
-    def __init__(self, buffer, exclusions, rebuild_check_delay, check_dist,
-                 mesh, default_r_cut):
+    def __init__(self,
+                 buffer,
+                 exclusions,
+                 rebuild_check_delay,
+                 check_dist,
+                 mesh,
+                 default_r_cut,
+                 clusters=False,
+                 incremental=False):
 
         validate_exclusions = OnlyFrom([
             'bond', 'angle', 'constraint', 'dihedral', 'special_pair', 'body',
@@ -130,11 +206,22 @@ class NeighborList(Compute):
         tp_r_cut.default = default_r_cut
         self._add_typeparam(tp_r_cut)
 
+        tp_pair_buffer = TypeParameter(
+            'pair_buffer', 'particle_types',
+            TypeParameterDict(OnlyTypes(float,
+                                        postprocess=nonnegative_real,
+                                        allow_none=True),
+                              len_keys=2))
+        tp_pair_buffer.default = None
+        self._add_typeparam(tp_pair_buffer)
+
         # default exclusions
         params = ParameterDict(exclusions=[validate_exclusions],
                                buffer=float(buffer),
                                rebuild_check_delay=int(rebuild_check_delay),
-                               check_dist=bool(check_dist))
+                               check_dist=bool(check_dist),
+                               clusters=bool(clusters),
+                               incremental=bool(incremental))
         params["exclusions"] = exclusions
         self._param_dict.update(params)
 
@@ -322,6 +409,41 @@ class NeighborList(Compute):
         """
         return self._cpp_obj.num_builds
 
+    @log(requires_run=True, default=False)
+    def num_partial_updates(self):
+        """int: The number of incremental neighbor list updates.
+
+        `num_partial_updates` is the number of neighbor list updates performed
+        incrementally, see `incremental`.
+        """
+        return self._cpp_obj.num_partial_updates
+
+    @log(requires_run=True, default=False)
+    def memory_usage(self):
+        """int: Bytes allocated for the neighbor list arrays on this rank.
+
+        The neighbor list grows when particles have more neighbors than it can
+        hold, but does not shrink when the density decreases. Call
+        `compact_memory` to release the unused capacity.
+        """
+        return self._cpp_obj.memory_usage
+
+    def compact_memory(self):
+        """Release neighbor list capacity that the last build did not need.
+
+        `compact_memory` sizes the list for the largest number of neighbors
+        of each particle type in the most recent build and rebuilds it on the
+        next time step. The list grows again when needed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            nlist.compact_memory()
+        """
+        if self._attached:
+            self._cpp_obj.compactMemory()
+
 
 class Cell(NeighborList):
     r"""Neighbor list computed via a cell list.
@@ -338,6 +460,10 @@ class Cell(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        clusters (bool): When `True`, also build the cluster pair list (CPU
+            only).
+        incremental (bool): When `True`, update the neighbor list
+            incrementally when possible (CPU only).
         default_r_cut
 
     `Cell` finds neighboring particles using a fixed width cell list, allowing
@@ -379,10 +505,12 @@ class Cell(NeighborList):
                  check_dist=True,
                  deterministic=False,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 clusters=False,
+                 incremental=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, clusters, incremental)
 
         self._param_dict.update(
             ParameterDict(deterministic=bool(deterministic)))
@@ -414,6 +542,8 @@ class Cell(NeighborList):
 
         The total memory usage of `Cell` is proportional to the product of the
         three cell list `dimensions` and the `allocated_particles_per_cell`.
+        The number of slots grows to fit the most crowded cell. Call
+        `compact_memory` to release the slots after the crowding dissipates.
         """
         return self._cpp_obj.getNmax()
 
@@ -435,6 +565,12 @@ class Stencil(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        clusters (bool): When `True`, also build the cluster pair list (CPU
+            only).
+        incremental (bool): When `True`, update the neighbor list
+            incrementally when possible (CPU only).
+        multilevel (bool): When `True`, use one cell list per group of types
+            with similar cutoffs.
 
     `Stencil` finds neighboring particles using a fixed width cell list, for
     *O(kN)* construction of the neighbor list where *k* is the number of
@@ -463,9 +599,20 @@ class Stencil(NeighborList):
     *cell_width*, and when the *cell_width* covers the simulation box with a
     roughly integer number of cells.
 
+    When the cutoffs of different types differ by more than an order of
+    magnitude, a single cell list with cells sized for the smallest cutoff
+    needs a very large number of cells. Set `multilevel` to `True` to sort the
+    types into levels whose cutoffs differ by at most a factor of 2. Each level
+    has its own cell list with cells sized for its smallest cutoff, but wide
+    enough that the level has no more cells than local particles. Each
+    particle searches every level with a stencil sized for its largest cutoff
+    with the types in that level. `cell_width` sets the width of the finest
+    level. The cell widths of the levels are chosen when the cutoffs change.
+
     Examples::
 
         nl_s = nlist.Stencil(cell_width=1.5)
+        nl_ml = nlist.Stencil(cell_width=0.5, buffer=0.4, multilevel=True)
 
     Important:
         `M.P. Howard et al. 2016 <http://dx.doi.org/10.1016/j.cpc.2016.02.003>`_
@@ -477,6 +624,8 @@ class Stencil(NeighborList):
             :math:`[\\mathrm{length}]`.
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
+        multilevel (bool): When `True`, use one cell list per group of types
+            with similar cutoffs.
     """
 
     def __init__(self,
@@ -487,13 +636,17 @@ class Stencil(NeighborList):
                  check_dist=True,
                  deterministic=False,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 clusters=False,
+                 incremental=False,
+                 multilevel=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, clusters, incremental)
 
         params = ParameterDict(deterministic=bool(deterministic),
-                               cell_width=float(cell_width))
+                               cell_width=float(cell_width),
+                               multilevel=bool(multilevel))
 
         self._param_dict.update(params)
 
@@ -520,6 +673,12 @@ class Tree(NeighborList):
         mesh (Mesh): When a mesh object is passed, the neighbor list uses the
             mesh to determine the bond exclusions in addition to all other
             set exclusions.
+        clusters (bool): When `True`, also build the cluster pair list (CPU
+            only).
+        incremental (bool): When `True`, update the neighbor list
+            incrementally when possible (CPU only).
+        max_refits (int): Number of consecutive neighbor list builds that
+            refit the BVH trees instead of building them from scratch.
 
     `Tree` creates a neighbor list using a bounding volume hierarchy (BVH) tree
     traversal in :math:`O(N \\log N)` time. A BVH tree of axis-aligned bounding
@@ -537,6 +696,15 @@ class Tree(NeighborList):
         :align: center
         :alt: BVH tree schematic
 
+    Set `max_refits` to a positive value to refit the trees between full
+    builds. A refit updates the bounding boxes of the existing tree to the
+    new particle positions in :math:`O(N)`, skipping the sort and hierarchy
+    construction. The tree keeps its topology, so it becomes less efficient
+    to traverse as the particles move away from their positions at the last
+    full build. `Tree` builds the trees from scratch after `max_refits`
+    consecutive refits, after the particles are sorted, and on every build in
+    MPI simulations (where the ghost particles change).
+
     `Tree`'s memory requirements scale with the number of particles in the
     system rather than the box volume, which may be particularly advantageous
     for large, sparse systems.
@@ -552,6 +720,10 @@ class Tree(NeighborList):
     Examples::
 
         nl_t = nlist.Tree(check_dist=False)
+
+    Attributes:
+        max_refits (int): Number of consecutive neighbor list builds that
+            refit the BVH trees instead of building them from scratch.
     """
 
     def __init__(self,
@@ -560,10 +732,18 @@ class Tree(NeighborList):
                  rebuild_check_delay=1,
                  check_dist=True,
                  mesh=None,
-                 default_r_cut=0.0):
+                 default_r_cut=0.0,
+                 clusters=False,
+                 incremental=False,
+                 max_refits=0):
 
         super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
-                         mesh, default_r_cut)
+                         mesh, default_r_cut, clusters, incremental)
+
+        self._param_dict.update(
+            ParameterDict(max_refits=OnlyTypes(int,
+                                               preprocess=nonnegative_real)))
+        self.max_refits = max_refits
 
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
@@ -573,3 +753,95 @@ class Tree(NeighborList):
         self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
                                   self.buffer)
         super()._attach_hook()
+
+
+class Inner(NeighborList):
+    r"""Neighbor list filtered from the pairs of another neighbor list.
+
+    Args:
+        outer (NeighborList): Neighbor list to filter.
+        buffer (float): Buffer width :math:`[\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exclude from the
+            neighbor list, see more details in `NeighborList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        check_dist (bool): Flag to enable / disable distance checking.
+        mesh (Mesh): When a mesh object is passed, the neighbor list uses the
+            mesh to determine the bond exclusions in addition to all other
+            set exclusions.
+        default_r_cut (float): Default cutoff distance
+            :math:`[\mathrm{length}]`.
+        clusters (bool): When `True`, also build the cluster pair list (CPU
+            only).
+        incremental (bool): When `True`, update the neighbor list
+            incrementally when possible (CPU only).
+
+    `Inner` builds its list by testing only the pairs in the `outer` neighbor
+    list, so it adds no cell list or tree search of its own. Use `Inner` for
+    short range forces when another force in the simulation needs a much
+    longer cutoff. `Inner` includes :math:`r_{\mathrm{cut},i,j} +
+    \mathrm{buffer}` in the cutoffs of `outer`, so `outer` always contains
+    every pair that `Inner` needs. Each `Inner` rebuild first brings `outer` up
+    to date.
+
+    Choose a large `outer` buffer to rebuild the outer list rarely, and set
+    `hoomd.md.Force.interval` on the long range force to evaluate it on a
+    multiple time step schedule.
+
+    Note:
+        Pairs that `outer` excludes are also absent from `Inner`. Set the
+        `outer` exclusions to a subset of the `Inner` exclusions.
+
+    Note:
+        On the GPU, `outer` must be a GPU neighbor list in full storage mode,
+        which is the default for all GPU neighbor lists.
+
+    Examples::
+
+        cell = hoomd.md.nlist.Cell(buffer=1.0)
+        inner = hoomd.md.nlist.Inner(outer=cell, buffer=0.4)
+        yukawa = hoomd.md.pair.Yukawa(nlist=cell, default_r_cut=6.0)
+        yukawa.interval = 4
+        lj = hoomd.md.pair.LJ(nlist=inner, default_r_cut=2.5)
+    """
+
+    def __init__(self,
+                 outer,
+                 buffer,
+                 exclusions=('bond',),
+                 rebuild_check_delay=1,
+                 check_dist=True,
+                 mesh=None,
+                 default_r_cut=0.0,
+                 clusters=False,
+                 incremental=False):
+
+        super().__init__(buffer, exclusions, rebuild_check_delay, check_dist,
+                         mesh, default_r_cut, clusters, incremental)
+
+        if not isinstance(outer, NeighborList):
+            raise TypeError("outer must be a hoomd.md.nlist.NeighborList.")
+        self._outer = outer
+
+    @property
+    def outer(self):
+        """NeighborList: Neighbor list to filter."""
+        return self._outer
+
+    def _attach_hook(self):
+        if (self._outer._attached
+                and self._simulation != self._outer._simulation):
+            raise RuntimeError("outer is attached to a different simulation.")
+        self._outer._attach(self._simulation)
+
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            nlist_cls = _md.NeighborListInner
+        else:
+            nlist_cls = _md.NeighborListGPUInner
+        self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
+                                  self._outer._cpp_obj, self.buffer)
+        super()._attach_hook()
+
+    def _detach_hook(self):
+        super()._detach_hook()
+        self._outer._detach()
@@ -141,6 +141,7 @@ from .pair import (
     ExpandedGaussian,
     Yukawa,
     Ewald,
+    DispersionEwald,
     Morse,
     DPD,
     DPDConservative,
@@ -160,4 +161,5 @@ from .pair import (
     Table,
     TWF,
     LJGauss,
+    LJYukawa,
 )
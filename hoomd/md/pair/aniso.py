@@ -563,3 +563,102 @@ class ALJ(AnisotropicPair):
         log shape for visualization and storage through the GSD file type.
         """
         return self._return_type_shapes()
+
+
+class SiteLJ(AnisotropicPair):
+    r"""Lennard-Jones pair force between interaction sites of rigid bodies.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list
+        default_r_cut (float): Default cutoff radius between the particle
+            centers :math:`[\mathrm{length}]`.
+        mode (str): energy shifting mode.
+
+    `SiteLJ` models each particle as a rigid body with a set of Lennard-Jones
+    interaction sites fixed in its body frame. The pair energy between
+    particles :math:`i` and :math:`j` is the sum over all pairs of sites
+    :math:`a` in :math:`i` and :math:`b` in :math:`j`:
+
+    .. math::
+
+        U(\vec{r}_{ij}, \mathbf{q}_i, \mathbf{q}_j) = \sum_{a \in i}
+            \sum_{b \in j} U_\mathrm{LJ}(|\vec{r}_{ij}
+            + \mathbf{q}_i \vec{s}_a \mathbf{q}_i^*
+            - \mathbf{q}_j \vec{s}_b \mathbf{q}_j^*|)
+
+    where :math:`\vec{s}_a` is the position of site :math:`a` in the body
+    frame and
+
+    .. math::
+
+        U_\mathrm{LJ}(r) =
+        \begin{cases}
+        4 \varepsilon \left[ \left( \frac{\sigma}{r} \right)^{12} -
+        \left( \frac{\sigma}{r} \right)^{6} \right] & r < r_\mathrm{site} \\
+        0 & r \ge r_\mathrm{site} \\
+        \end{cases}
+
+    With ``mode='shift'``, each site-site term is shifted to 0 at
+    :math:`r_\mathrm{site}`.
+
+    `SiteLJ` computes the site positions from the particle positions and
+    orientations as it evaluates the force. Unlike rigid bodies made with
+    `hoomd.md.constrain.Rigid`, the state holds only one particle per body, so
+    sorting, communication, and neighbor list builds scale with the number of
+    bodies rather than the number of sites. Integrate the bodies with
+    ``integrate_rotational_dof=True`` and set their mass and moment of inertia
+    in the state.
+
+    Important:
+        ``r_cut`` applies to the distance between the particle centers. Set it
+        to at least ``site_r_cut`` plus the largest distance of a site from the
+        center of particle :math:`i` plus that of particle :math:`j`.
+
+    Example::
+
+        nl = hoomd.md.nlist.Cell(buffer=0.4)
+        site_lj = hoomd.md.pair.aniso.SiteLJ(nlist=nl, default_r_cut=4.5)
+        site_lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0,
+                                          site_r_cut=2.5)
+        site_lj.shape['A'] = dict(positions=[(-0.5, 0, 0), (0.5, 0, 0)])
+
+    .. py:attribute:: params
+
+        The site Lennard-Jones parameters. The dictionary has the following
+        keys:
+
+        * ``epsilon`` (`float`, **required**) - energy parameter
+          :math:`\varepsilon` :math:`[\mathrm{energy}]`
+        * ``sigma`` (`float`, **required**) - particle size :math:`\sigma`
+          :math:`[\mathrm{length}]`
+        * ``site_r_cut`` (`float`, **required**) - cutoff distance between
+          sites :math:`r_\mathrm{site}` :math:`[\mathrm{length}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: shape
+
+        The interaction sites of each particle type. The dictionary has the
+        following keys:
+
+        * ``positions`` (`list` [`tuple` [`float`, `float`, `float`]],
+          **required**) - site positions :math:`\vec{s}_a` in the body frame
+          :math:`[\mathrm{length}]`
+
+        Type: `TypeParameter` [``particle_type``, `dict`]
+    """
+    _cpp_class_name = "AnisoPotentialPairSiteLJ"
+
+    def __init__(self, nlist, default_r_cut=None, mode='none'):
+        super().__init__(nlist, default_r_cut, mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(epsilon=float,
+                              sigma=float,
+                              site_r_cut=float,
+                              len_keys=2))
+        shape = TypeParameter(
+            'shape', 'particle_types',
+            TypeParameterDict(positions=[(float, float, float)], len_keys=1))
+        self._extend_typeparam((params, shape))
@@ -13,6 +13,7 @@ from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
 from hoomd.data.typeparam import TypeParameter
 import numpy as np
 from hoomd.data.typeconverter import OnlyFrom, nonnegative_real
+from hoomd.logging import log
 
 
 class Pair(force.Force):
@@ -517,6 +518,64 @@ class Ewald(Pair):
         self._add_typeparam(params)
 
 
+class DispersionEwald(Pair):
+    r"""Real space part of the dispersion Ewald sum.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+
+    `DispersionEwald` adds back the long-range part of the attractive
+    :math:`r^{-6}` interaction inside the cutoff:
+
+    .. math::
+
+        U(r) = C_6 \frac{1 - g(\beta r)}{r^6}, \quad
+        g(x) = e^{-x^2} \left(1 + x^2 + \frac{x^4}{2}\right)
+
+    Call `md.long_range.pppm.make_pppm_dispersion_forces` to create an
+    instance of `DispersionEwald` and `md.long_range.pppm.Dispersion` that
+    together implement the PPPM method for dispersion.
+
+    Example::
+
+        nl = nlist.Cell()
+        dispersion_ewald = pair.DispersionEwald(default_r_cut=2.5, nlist=nl)
+        dispersion_ewald.params[('A', 'A')] = dict(c6=4.0, beta=1.2)
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``c6`` (`float`, **required**) - Dispersion coefficient
+          :math:`C_6` :math:`[\mathrm{energy}] \cdot [\mathrm{length}]^6`
+        * ``beta`` (`float`, **required**) - Splitting parameter
+          :math:`\beta` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"``.
+
+        Type: `str`
+    """
+    _cpp_class_name = "PotentialPairDispersionEwald"
+    _accepted_modes = ("none",)
+
+    def __init__(self, nlist, default_r_cut=None):
+        super().__init__(nlist=nlist,
+                         default_r_cut=default_r_cut,
+                         default_r_on=0,
+                         mode='none')
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(c6=float, beta=float, len_keys=2))
+
+        self._add_typeparam(params)
+
+
 class Table(Pair):
     """Tabulated pair force.
 
@@ -1870,3 +1929,103 @@ class LJGauss(Pair):
             'params', 'particle_types',
             TypeParameterDict(epsilon=float, sigma=float, r0=float, len_keys=2))
         self._add_typeparam(params)
+
+
+class LJYukawa(Pair):
+    r"""Lennard-Jones plus Yukawa pair force.
+
+    Args:
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list.
+        default_r_cut (float): Default cutoff radius :math:`[\mathrm{length}]`.
+        default_r_on (float): Default turn-on radius :math:`[\mathrm{length}]`.
+        mode (str): Energy shifting/smoothing mode.
+        tail_correction (bool): Whether to apply the isotropic integrated long
+            range tail correction.
+
+    `LJYukawa` computes the sum of the Lennard-Jones (`LJ`) and Yukawa
+    (`Yukawa`) pair forces on every particle in the simulation state:
+
+    .. math::
+        U(r) = 4 \varepsilon_\mathrm{LJ} \left[ \left(
+        \frac{\sigma}{r} \right)^{12} - \left( \frac{\sigma}{r}
+        \right)^{6} \right] + \varepsilon_\mathrm{Y} \frac{ \exp \left(
+        -\kappa r \right) }{r}
+
+    `LJYukawa` evaluates both terms in a single pass over the neighbor list,
+    which is faster than adding separate `LJ` and `Yukawa` forces to the
+    integrator. Both terms share the same `r_cut`, `r_on`, and `mode`.
+
+    Example::
+
+        nl = nlist.Cell()
+        lj_yukawa = pair.LJYukawa(nl, default_r_cut=3.0)
+        lj_yukawa.params[('A', 'A')] = dict(
+            lj=dict(epsilon=1.0, sigma=1.0),
+            yukawa=dict(epsilon=0.5, kappa=1.0))
+
+    .. py:attribute:: params
+
+        The potential parameters. The dictionary has the following keys:
+
+        * ``lj`` (`dict`, **required**) - parameters of the Lennard-Jones term:
+
+          * ``epsilon`` (`float`, **required**) -
+            energy parameter :math:`\varepsilon_\mathrm{LJ}`
+            :math:`[\mathrm{energy}]`
+          * ``sigma`` (`float`, **required**) -
+            particle size :math:`\sigma` :math:`[\mathrm{length}]`
+
+        * ``yukawa`` (`dict`, **required**) - parameters of the Yukawa term:
+
+          * ``epsilon`` (`float`, **required**) -
+            energy parameter :math:`\varepsilon_\mathrm{Y}`
+            :math:`[\mathrm{energy}]`
+          * ``kappa`` (`float`, **required**) -
+            scaling parameter :math:`\kappa` :math:`[\mathrm{length}^{-1}]`
+
+        Type: `TypeParameter` [`tuple` [``particle_type``, ``particle_type``],
+        `dict`]
+
+    .. py:attribute:: mode
+
+        Energy shifting/smoothing mode: ``"none"``, ``"shift"``, or ``"xplor"``.
+
+        Type: `str`
+
+    .. py:attribute:: tail_correction
+
+        Whether to apply the isotropic integrated long range tail correction.
+
+        Type: `bool`
+    """
+    _cpp_class_name = "PotentialPairLJYukawa"
+
+    def __init__(self,
+                 nlist,
+                 default_r_cut=None,
+                 default_r_on=0.,
+                 mode='none',
+                 tail_correction=False):
+        super().__init__(nlist, default_r_cut, default_r_on, mode)
+        params = TypeParameter(
+            'params', 'particle_types',
+            TypeParameterDict(lj=dict(epsilon=float, sigma=float),
+                              yukawa=dict(epsilon=float, kappa=float),
+                              len_keys=2))
+        self._add_typeparam(params)
+        self._param_dict.update(
+            ParameterDict(tail_correction=bool(tail_correction)))
+
+    @log(requires_run=True)
+    def lj_energy(self):
+        """float: The potential energy of the Lennard-Jones term \
+        :math:`[\\mathrm{energy}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.getComponentEnergies()[0]
+
+    @log(requires_run=True)
+    def yukawa_energy(self):
+        """float: The potential energy of the Yukawa term \
+        :math:`[\\mathrm{energy}]`."""
+        self._cpp_obj.compute(self._simulation.timestep)
+        return self._cpp_obj.getComponentEnergies()[1]
@@ -61,7 +61,6 @@ def test_before_attaching(simulation_factory, two_particle_snapshot_factory,
 @pytest.mark.parametrize(
     "alchemostat_cls, extra_property_1st_value, extra_property_2nd_value",
     get_alchemostat())
-@pytest.mark.cpu
 @pytest.mark.serial
 def test_after_attaching(simulation_factory, two_particle_snapshot_factory,
                          alchemostat_cls, extra_property_1st_value,
@@ -97,7 +96,6 @@ def test_after_attaching(simulation_factory, two_particle_snapshot_factory,
     sim.run(10)
 
 
-@pytest.mark.cpu
 @pytest.mark.serial
 @pytest.mark.parametrize("alchemical_potential",
                          [hoomd.md.alchemy.pair.LJGauss])
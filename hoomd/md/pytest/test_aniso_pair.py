@@ -311,6 +311,23 @@ def _valid_params(particle_types=['A', 'B']):
         make_aniso_spec(md.pair.aniso.ALJ,
                         to_type_parameter_dicts(particle_types, alj_arg_dict1)))
 
+    site_lj_arg_dict = {
+        'params': ({
+            'epsilon': [0.5, 1.1, 0.147],
+            'sigma': [0.4, 0.5, 0.3],
+            'site_r_cut': [1.0, 1.25, 0.75]
+        }, 2),
+        'shape': ({
+            "positions": [[(0.3, 0, 0), (-0.3, 0, 0)],
+                          [(0, 0.2, 0), (0, -0.1, 0.2), (0.1, 0, -0.2)]]
+        }, 1)
+    }
+
+    valid_params_list.append(
+        make_aniso_spec(
+            md.pair.aniso.SiteLJ,
+            to_type_parameter_dicts(particle_types, site_lj_arg_dict)))
+
     return valid_params_list
 
 
@@ -487,6 +504,78 @@ def test_pickling(make_two_particle_simulation, pair_potential_spec):
     pickling_check(pair_potential)
 
 
+def _rotate(q, v):
+    """Rotate the vectors v by the quaternion q."""
+    s, u = q[0], np.asarray(q[1:])
+    v = np.asarray(v)
+    return (s * s - np.dot(u, u)) * v + 2 * np.dot(v, u)[..., None] * u \
+        + 2 * s * np.cross(u, v)
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift'])
+def test_site_lj_sum(make_two_particle_simulation, mode):
+    """Compare SiteLJ with a direct sum over the pairs of sites."""
+    epsilon, sigma, site_r_cut = 1.5, 0.5, 1.2
+    sites = {
+        'A': [(0.4, 0, 0), (-0.4, 0.1, 0), (0, 0, 0.3)],
+        'B': [(0, 0.35, 0), (0.1, -0.3, 0.2)]
+    }
+    site_lj = md.pair.aniso.SiteLJ(nlist=md.nlist.Cell(buffer=0.4),
+                                   default_r_cut=3.0,
+                                   mode=mode)
+    site_lj.params.default = dict(epsilon=epsilon,
+                                  sigma=sigma,
+                                  site_r_cut=site_r_cut)
+    for particle_type, positions in sites.items():
+        site_lj.shape[particle_type] = dict(positions=positions)
+
+    sim = make_two_particle_simulation(types=['A', 'B'], d=1.0, force=site_lj)
+    r = [np.array([0.1, -0.2, 0.0]), np.array([0.9, 0.3, 0.2])]
+    q = [
+        np.array([0.9, 0.1, 0.3, -0.2]),
+        np.array([0.7, -0.4, 0.2, 0.5]),
+    ]
+    q = [qi / np.linalg.norm(qi) for qi in q]
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = [0, 1]
+        snap.particles.position[:] = r
+        snap.particles.orientation[:] = q
+    sim.state.set_snapshot(snap)
+    sim.run(0)
+
+    def lj(rsq):
+        rsq = np.asarray(rsq)
+        r6inv = (sigma**2 / rsq)**3
+        return 4 * epsilon * (r6inv**2 - r6inv)
+
+    r_a = _rotate(q[0], sites['A'])
+    r_b = _rotate(q[1], sites['B'])
+    d = (r[0] - r[1])[None, None, :] + r_a[:, None, :] - r_b[None, :, :]
+    rsq = np.sum(d * d, axis=-1)
+    inside = rsq < site_r_cut**2
+    energy = lj(rsq)
+    if mode == 'shift':
+        energy -= lj(site_r_cut**2)
+    energy = np.sum(energy[inside])
+    r6inv = (sigma**2 / rsq)**3
+    f_ab = (24 * epsilon * (2 * r6inv**2 - r6inv) / rsq)[..., None] * d
+    f_ab[~inside] = 0
+    force = np.sum(f_ab, axis=(0, 1))
+    torque_i = np.sum(np.cross(r_a[:, None, :], f_ab), axis=(0, 1))
+    torque_j = -np.sum(np.cross(r_b[None, :, :], f_ab), axis=(0, 1))
+
+    sim_energies = site_lj.energies
+    sim_forces = site_lj.forces
+    sim_torques = site_lj.torques
+    if sim_energies is not None:
+        np.testing.assert_allclose(np.sum(sim_energies), energy, rtol=1e-5)
+        np.testing.assert_allclose(sim_forces[0], force, rtol=1e-5)
+        np.testing.assert_allclose(sim_forces[1], -force, rtol=1e-5)
+        np.testing.assert_allclose(sim_torques[0], torque_i, rtol=1e-5)
+        np.testing.assert_allclose(sim_torques[1], torque_j, rtol=1e-5)
+
+
 def _base_expected_loggable(include_type_shapes=False):
     base = {
         "forces": {
@@ -521,9 +610,10 @@ def _base_expected_loggable(include_type_shapes=False):
 @pytest.mark.parametrize(
     "cls,log_check_params",
     ((cls, log_check_params) for cls, log_check_params in zip((
-        md.pair.aniso.GayBerne, md.pair.aniso.Dipole,
-        md.pair.aniso.ALJ), (_base_expected_loggable(True),
-                             _base_expected_loggable(),
-                             _base_expected_loggable(True)))))
+        md.pair.aniso.GayBerne, md.pair.aniso.Dipole, md.pair.aniso.ALJ,
+        md.pair.aniso.SiteLJ), (_base_expected_loggable(True),
+                                _base_expected_loggable(),
+                                _base_expected_loggable(True),
+                                _base_expected_loggable()))))
 def test_logging(cls, log_check_params):
     logging_check(cls, ('md', 'pair', 'aniso'), log_check_params)
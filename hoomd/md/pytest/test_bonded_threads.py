@@ -0,0 +1,132 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Test the threaded CPU evaluation of bonded, pair, and many-body forces."""
+
+import hoomd
+import numpy
+
+
+def _chain_snapshot(n_chains=20, chain_length=12, spacing=0.9):
+    """Make a snapshot of wavy chains with bonds, angles, and dihedrals."""
+    snap = hoomd.Snapshot()
+    L = 2 * spacing * chain_length
+    snap.configuration.box = [L, L, L, 0, 0, 0]
+    snap.particles.types = ['A']
+    snap.bonds.types = ['A-A']
+    snap.angles.types = ['A-A-A']
+    snap.dihedrals.types = ['A-A-A-A']
+
+    rng = numpy.random.default_rng(5)
+    position = []
+    bonds = []
+    angles = []
+    dihedrals = []
+    for c in range(n_chains):
+        start = rng.uniform(-L / 2, L / 2, size=3)
+        for i in range(chain_length):
+            offset = [spacing * i, 0.3 * numpy.sin(i), 0.3 * numpy.cos(2 * i)]
+            position.append(start + offset)
+            tag = c * chain_length + i
+            if i >= 1:
+                bonds.append([tag - 1, tag])
+            if i >= 2:
+                angles.append([tag - 2, tag - 1, tag])
+            if i >= 3:
+                dihedrals.append([tag - 3, tag - 2, tag - 1, tag])
+
+    position = numpy.array(position)
+    position -= L * numpy.round(position / L)
+    snap.particles.N = len(position)
+    snap.particles.position[:] = position
+    snap.bonds.N = len(bonds)
+    snap.bonds.group[:] = bonds
+    snap.angles.N = len(angles)
+    snap.angles.group[:] = angles
+    snap.dihedrals.N = len(dihedrals)
+    snap.dihedrals.group[:] = dihedrals
+    return snap
+
+
+def _bonded_forces(sim, pair=False):
+    """Compute bonded forces, energies, and virials."""
+    bond = hoomd.md.bond.Harmonic()
+    bond.params['A-A'] = dict(k=30.0, r0=1.0)
+    angle = hoomd.md.angle.Harmonic()
+    angle.params['A-A-A'] = dict(k=5.0, t0=2.5)
+    dihedral = hoomd.md.dihedral.Periodic()
+    dihedral.params['A-A-A-A'] = dict(k=3.0, d=-1, n=3, phi0=0)
+    opls = hoomd.md.dihedral.OPLS()
+    opls.params['A-A-A-A'] = dict(k1=1.0, k2=0.5, k3=0.25, k4=0.1)
+    forces = [bond, angle, dihedral, opls]
+    if pair:
+        lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+        lj.params[('A', 'A')] = dict(epsilon=0.1, sigma=0.8)
+        lj.r_cut[('A', 'A')] = 2.0
+        forces.append(lj)
+
+    integrator = hoomd.md.Integrator(dt=0.005, forces=forces)
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    return [(f.forces, f.energies, f.virials) for f in forces]
+
+
+def test_threaded_bonded_forces(compare_cpu_threads):
+    """Check that threaded bonded forces match the serial evaluation."""
+    compare_cpu_threads(_chain_snapshot(), _bonded_forces)
+
+
+def _many_body_forces(sim):
+    """Compute many-body forces, energies, and virials."""
+    tersoff = hoomd.md.many_body.Tersoff(nlist=hoomd.md.nlist.Cell(buffer=0.4),
+                                         default_r_cut=1.7)
+    tersoff.params[('A', 'A')] = dict(magnitudes=(2.0, 1.0),
+                                      exp_factors=(2.0, 1.0),
+                                      lambda3=0.5,
+                                      dimer_r=1.2,
+                                      cutoff_thickness=0.5,
+                                      n=1.5,
+                                      gamma=0.5,
+                                      c=1.0,
+                                      d=2.0,
+                                      m=0.5)
+    square_density = hoomd.md.many_body.SquareDensity(
+        nlist=hoomd.md.nlist.Cell(buffer=0.4), default_r_cut=1.5)
+    square_density.params[('A', 'A')] = dict(A=2.0, B=0.5)
+    forces = [tersoff, square_density]
+
+    integrator = hoomd.md.Integrator(dt=0.005, forces=forces)
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    return [(f.forces, f.energies, f.virials) for f in forces]
+
+
+def test_threaded_many_body_forces(compare_cpu_threads):
+    """Check that threaded many-body forces match the serial evaluation."""
+    snapshot = hoomd.Snapshot()
+    L = 8.0
+    snapshot.configuration.box = [L, L, L, 0, 0, 0]
+    snapshot.particles.types = ['A']
+    snapshot.particles.N = 600
+    rng = numpy.random.default_rng(7)
+    snapshot.particles.position[:] = rng.uniform(-L / 2, L / 2, size=(600, 3))
+
+    compare_cpu_threads(snapshot, _many_body_forces)
+
+
+def test_deterministic_reduction(cpu_simulation_factory):
+    """Check that deterministic reductions reproduce the sums bitwise."""
+    snapshot = _chain_snapshot()
+    results = []
+    for _ in range(2):
+        sim = cpu_simulation_factory(snapshot, num_cpu_threads=4)
+        sim.device.deterministic_reduction = True
+        results.append(_bonded_forces(sim, pair=True))
+
+    for first_force, second_force in zip(*results):
+        for a, b in zip(first_force, second_force):
+            numpy.testing.assert_array_equal(b, a)
@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 from pathlib import Path
+import threading
 
 import hoomd
 import numpy as np
@@ -186,6 +187,37 @@ def test_burst_max_size(sim, tmp_path):
     check_write(sim, filename, 1)
 
 
+def test_burst_resize(sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.gsd"
+    burst_writer = hoomd.write.Burst(filename=filename,
+                                     trigger=hoomd.trigger.Periodic(1),
+                                     mode='wb',
+                                     dynamic=['property', 'momentum'],
+                                     max_burst_size=3,
+                                     write_at_start=True)
+    sim.operations.writers.append(burst_writer)
+    sim.run(7)
+    assert len(burst_writer) == 3
+
+    # shrinking the buffer keeps the newest frames
+    burst_writer.max_burst_size = 2
+    assert len(burst_writer) == 2
+    sim.run(2)
+    assert len(burst_writer) == 2
+
+    # an unlimited buffer grows as needed
+    burst_writer.max_burst_size = -1
+    sim.run(3)
+    assert len(burst_writer) == 5
+
+    burst_writer.dump()
+    burst_writer.flush()
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert [frame.configuration.step for frame in traj
+                   ] == [0, 8, 9, 10, 11, 12]
+
+
 def test_burst_mode_xb(sim, tmp_path):
     filename = tmp_path / "temporary_test_file.gsd"
     if sim.device.communicator.rank == 0:
@@ -242,3 +274,61 @@ def test_write_burst_log(sim, tmp_path):
         with gsd.hoomd.open(name=filename, mode='r') as traj:
             for frame, sim_ke in zip(traj[1:], kinetic_energies):
                 assert frame.log[key] == sim_ke
+
+
+def test_write_burst_log_gil_released(sim, tmp_path, capsys):
+    """Log with Burst while another Python thread runs during Simulation.run.
+
+    `Simulation.run` releases the GIL. The Burst writer must reacquire it to
+    call the logger, and messages printed from C++ during the run must
+    reacquire it to write to ``sys.stdout``.
+    """
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    logger = hoomd.logging.Logger()
+    logger.add(thermo, quantities=['kinetic_energy'])
+
+    burst_writer = hoomd.write.Burst(filename=filename,
+                                     trigger=hoomd.trigger.Periodic(1),
+                                     filter=hoomd.filter.Null(),
+                                     mode='wb',
+                                     logger=logger,
+                                     max_burst_size=-1,
+                                     write_at_start=True)
+    sim.operations.writers.append(burst_writer)
+    sim.device.notice_level = 10
+
+    # a thread that creates and destroys Python objects while the run loop
+    # calls into Python
+    stop = threading.Event()
+    n_iterations = [0]
+
+    def spin():
+        while not stop.is_set():
+            [str(i) for i in range(100)]
+            n_iterations[0] += 1
+
+    thread = threading.Thread(target=spin)
+    thread.start()
+    try:
+        sim.run(50)
+    finally:
+        stop.set()
+        thread.join()
+        sim.device.notice_level = 2
+
+    assert n_iterations[0] > 0
+    assert len(burst_writer) == 50
+    capsys.readouterr()
+
+    burst_writer.dump()
+    burst_writer.flush()
+    if sim.device.communicator.rank == 0:
+        key = "md/compute/ThermodynamicQuantities/kinetic_energy"
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == 51
+            for frame in traj:
+                assert key in frame.log
@@ -91,6 +91,14 @@ def test_attach_detach(simulation_factory, polymer_snapshot_factory):
     d.tolerance = 1e-5
     assert d.tolerance == 1e-5
 
+    assert d.solver == 'lu'
+    d.solver = 'iterative'
+    assert d.solver == 'iterative'
+    d.solver_tolerance = 1e-8
+    assert d.solver_tolerance == 1e-8
+    d.max_iterations = 50
+    assert d.max_iterations == 50
+
 
 def test_pickling(simulation_factory, polymer_snapshot_factory):
     """Test that md.constrain.Distance can be pickled and unpickled."""
@@ -146,3 +154,31 @@ def test_basic_simulation(simulation_factory, polymer_snapshot_factory):
                                       rtol=1e-5)
 
     autotuned_kernel_parameter_check(instance=d, activate=lambda: sim.run(1))
+
+
+def test_iterative_solver(simulation_factory, polymer_snapshot_factory):
+    """Ensure that the iterative solver reproduces the LU solution."""
+    d = hoomd.md.constrain.Distance(solver_tolerance=1e-10)
+
+    sim = simulation_factory(polymer_snapshot_factory())
+    integrator = hoomd.md.Integrator(dt=0.005)
+    nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    integrator.methods.append(nve)
+    integrator.constraints.append(d)
+    sim.operations.integrator = integrator
+
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.0)
+    sim.run(0)
+    lu_forces = d.forces
+    assert d.solver_iterations == 0
+
+    d.solver = 'iterative'
+    sim.run(0)
+    iterative_forces = d.forces
+    assert 0 < d.solver_iterations <= d.max_iterations
+
+    if lu_forces is not None:
+        numpy.testing.assert_allclose(iterative_forces,
+                                      lu_forces,
+                                      rtol=1e-6,
+                                      atol=1e-8)
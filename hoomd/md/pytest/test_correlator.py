@@ -0,0 +1,130 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import logging_check
+from hoomd.error import DataAccessError
+from hoomd.logging import LoggerCategories
+import pytest
+import numpy as np
+
+_velocities = np.array([[1.0, 0.5, 0.0], [-0.5, 0.0, 1.0]])
+
+
+def test_before_attaching():
+    correlator = hoomd.md.compute.MultipleTauCorrelator(
+        trigger=hoomd.trigger.Periodic(1),
+        filter=hoomd.filter.All(),
+        points=8,
+        averaging=2,
+        levels=4)
+    assert correlator.points == 8
+    assert correlator.averaging == 2
+    assert correlator.levels == 4
+
+    with pytest.raises(DataAccessError):
+        correlator.msd
+
+    with pytest.raises(ValueError):
+        hoomd.md.compute.MultipleTauCorrelator(
+            trigger=hoomd.trigger.Before(10), filter=hoomd.filter.All())
+
+
+@pytest.mark.serial
+def test_ballistic(simulation_factory, two_particle_snapshot_factory):
+    snapshot = two_particle_snapshot_factory(d=1, L=20)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.velocity[:] = _velocities
+    sim = simulation_factory(snapshot)
+
+    dt = 0.005
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=dt, methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())])
+
+    thermo = hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.All())
+    correlator = hoomd.md.compute.MultipleTauCorrelator(
+        trigger=hoomd.trigger.Periodic(1),
+        filter=hoomd.filter.All(),
+        thermodynamic_quantities=thermo,
+        points=4,
+        averaging=2,
+        levels=3)
+    sim.operations.writers.append(correlator)
+
+    # move far enough for the particles to cross the periodic boundaries
+    sim.run(2400)
+    assert correlator.num_samples == 2400
+
+    lags = correlator.lag_steps
+    np.testing.assert_array_equal(lags, [0, 1, 2, 3, 4, 6, 8, 12])
+
+    # block averages of a linear trajectory are linear, so all levels are exact
+    v_sq = np.mean(np.sum(_velocities**2, axis=1))
+    np.testing.assert_allclose(correlator.msd,
+                               v_sq * (lags * dt)**2,
+                               rtol=1e-3,
+                               atol=1e-10)
+    np.testing.assert_allclose(correlator.velocity_autocorrelation,
+                               np.full(len(lags), v_sq),
+                               rtol=1e-5)
+
+    # without forces, the pressure tensor is constant
+    p = thermo.pressure_tensor
+    expected = (p[1]**2 + p[2]**2 + p[4]**2) / 3
+    np.testing.assert_allclose(correlator.pressure_autocorrelation,
+                               np.full(len(lags), expected),
+                               rtol=1e-5)
+
+    correlator.reset()
+    assert correlator.num_samples == 0
+    assert np.all(np.isnan(correlator.msd))
+
+
+def test_pressure_only(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.005,
+        methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())])
+
+    thermo = hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.All())
+    correlator = hoomd.md.compute.MultipleTauCorrelator(
+        trigger=hoomd.trigger.Periodic(2),
+        filter=None,
+        thermodynamic_quantities=thermo,
+        points=4,
+        averaging=2,
+        levels=2)
+    sim.operations.writers.append(correlator)
+    sim.run(10)
+
+    assert correlator.num_samples == 5
+    np.testing.assert_array_equal(correlator.lag_steps, [0, 2, 4, 6, 8, 12])
+    assert correlator.msd is None
+    assert correlator.velocity_autocorrelation is None
+    assert len(correlator.pressure_autocorrelation) == 6
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.MultipleTauCorrelator, ('md', 'compute'), {
+            'lag_steps': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'msd': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'velocity_autocorrelation': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'pressure_autocorrelation': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
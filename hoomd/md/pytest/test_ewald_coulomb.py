@@ -0,0 +1,149 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import pickling_check, autotuned_kernel_parameter_check
+import math
+import pytest
+import numpy
+
+
+@pytest.fixture(scope='session')
+def two_charged_particle_snapshot_factory(two_particle_snapshot_factory):
+    """Make a snapshot with two charged particles."""
+
+    def make_snapshot(particle_types=['A'], dimensions=3, d=1, L=20, q=1):
+        s = two_particle_snapshot_factory(particle_types=particle_types,
+                                          dimensions=dimensions,
+                                          d=d,
+                                          L=L)
+
+        if s.communicator.rank == 0:
+            s.particles.charge[0] = -q
+            s.particles.charge[1] = q
+        return s
+
+    return make_snapshot
+
+
+def _make_simulation(simulation_factory, snapshot, k_max=(20, 20, 20)):
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.ewald.make_ewald_coulomb_forces(
+        nlist=nlist, k_max=k_max, r_cut=3.0)
+
+    sim = simulation_factory(snapshot)
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[ewald, coulomb])
+    sim.operations.integrator = integrator
+    sim.run(0)
+    return sim, ewald, coulomb
+
+
+def test_attach(simulation_factory, two_charged_particle_snapshot_factory):
+    """Ensure that md.long_range.ewald.Coulomb can be attached."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.ewald.make_ewald_coulomb_forces(
+        nlist=nlist, k_max=(8, 8, 8), r_cut=3.0, alpha=0)
+
+    assert ewald.nlist is nlist
+    assert coulomb.nlist is nlist
+    assert coulomb.k_max == (8, 8, 8)
+    assert coulomb.r_cut == 3.0
+    assert coulomb.alpha == 0
+
+    coulomb.k_max = (10, 12, 14)
+    assert coulomb.k_max == (10, 12, 14)
+
+    sim = simulation_factory(two_charged_particle_snapshot_factory())
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[ewald, coulomb])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    assert coulomb._attached
+    assert coulomb.k_max == (10, 12, 14)
+    assert coulomb.kappa > 0
+    assert ewald.params[('A', 'A')]['kappa'] == pytest.approx(coulomb.kappa)
+    assert coulomb.num_k_vectors > 0
+
+    with pytest.raises(AttributeError):
+        coulomb.k_max = (8, 8, 8)
+
+    pickling_check(coulomb)
+
+
+def test_kernel_parameters(simulation_factory,
+                           two_charged_particle_snapshot_factory):
+    """Test md.long_range.ewald.Coulomb's autotuned kernel parameters."""
+    sim, ewald, coulomb = _make_simulation(
+        simulation_factory, two_charged_particle_snapshot_factory())
+
+    autotuned_kernel_parameter_check(instance=coulomb,
+                                     activate=lambda: sim.run(1))
+
+
+def test_energy_and_forces(simulation_factory,
+                           two_charged_particle_snapshot_factory):
+    """Test the energy and forces of a dipole and its periodic images."""
+    L = 20
+    sim, ewald, coulomb = _make_simulation(
+        simulation_factory, two_charged_particle_snapshot_factory(L=L))
+
+    # with conducting boundary conditions, the images of the unit dipole lower
+    # the energy by 2 pi / (3 V), up to higher multipoles
+    energy = ewald.energy + coulomb.energy
+    numpy.testing.assert_allclose(energy,
+                                  -1 - 2 * math.pi / (3 * L**3),
+                                  rtol=5e-5)
+
+    forces = ewald.forces + coulomb.forces
+    if sim.device.communicator.rank == 0:
+        force_x = 1 - 4 * math.pi / (3 * L**3)
+        numpy.testing.assert_allclose(forces,
+                                      [[force_x, 0, 0], [-force_x, 0, 0]],
+                                      rtol=1e-3,
+                                      atol=1e-4)
+
+
+def test_compare_pppm(simulation_factory, lattice_snapshot_factory):
+    """Test that the Ewald sum agrees with PPPM for a random system."""
+    snapshot = lattice_snapshot_factory(n=4, a=2.0)
+    if snapshot.communicator.rank == 0:
+        rng = numpy.random.default_rng(2)
+        snapshot.particles.position[:] += rng.uniform(
+            -0.3, 0.3, size=snapshot.particles.position.shape)
+        snapshot.particles.charge[:] = [
+            (-1)**i for i in range(snapshot.particles.N)
+        ]
+
+    sim, ewald, coulomb = _make_simulation(simulation_factory, snapshot,
+                                           k_max=(12, 12, 12))
+    energy = ewald.energy + coulomb.energy
+    forces = ewald.forces + coulomb.forces
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    pppm = hoomd.md.long_range.pppm
+    pppm_ewald, pppm_coulomb = pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=7, r_cut=3.0)
+    sim.operations.integrator.forces = [pppm_ewald, pppm_coulomb]
+    sim.run(0)
+
+    numpy.testing.assert_allclose(pppm_ewald.energy + pppm_coulomb.energy,
+                                  energy,
+                                  rtol=1e-3)
+    pppm_forces = pppm_ewald.forces + pppm_coulomb.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(pppm_forces, forces, atol=1e-2)
+
+
+def test_2d(simulation_factory, two_charged_particle_snapshot_factory):
+    """Test that md.long_range.ewald.Coulomb raises an error in 2D."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.ewald.make_ewald_coulomb_forces(
+        nlist=nlist, k_max=(8, 8, 8), r_cut=3.0)
+
+    sim = simulation_factory(
+        two_charged_particle_snapshot_factory(dimensions=2))
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[ewald, coulomb])
+    sim.operations.integrator = integrator
+
+    with pytest.raises(ValueError):
+        sim.run(0)
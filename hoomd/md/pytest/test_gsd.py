@@ -402,6 +402,195 @@ def test_write_gsd_log(create_md_sim, tmp_path):
                 assert e == kinetic_energy_list[s]
 
 
+def test_write_gsd_asynchronous(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    logger = hoomd.logging.Logger()
+    logger.add(thermo, quantities=['kinetic_energy'])
+
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'],
+                                 logger=logger)
+    gsd_writer.asynchronous = True
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.asynchronous
+
+    snap_list = []
+    kinetic_energy_list = []
+    for _ in range(5):
+        sim.run(1)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            snap_list.append(snap)
+        kinetic_energy_list.append(thermo.kinetic_energy)
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == 5
+            for s, (gsd_snap, hoomd_snap) in enumerate(zip(traj, snap_list)):
+                assert_equivalent_snapshots(gsd_snap, hoomd_snap)
+                e = gsd_snap.log[
+                    'md/compute/ThermodynamicQuantities/kinetic_energy']
+                assert e == kinetic_energy_list[s]
+
+    # switching to synchronous mode writes the queued frames
+    sim.run(3)
+    gsd_writer.asynchronous = False
+    sim.run(1)
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == 9
+            assert traj[-1].configuration.step == sim.timestep
+
+
+def test_write_gsd_collective(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum', 'attribute'])
+    gsd_writer.collective = True
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.collective
+
+    snap_list = []
+    for _ in range(5):
+        sim.run(1)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            snap_list.append(snap)
+
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            assert len(traj) == 5
+            for gsd_snap, hoomd_snap in zip(traj, snap_list):
+                assert_equivalent_snapshots(gsd_snap, hoomd_snap)
+
+
+def test_write_gsd_position_precision(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb')
+    gsd_writer.position_precision = 0.01
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.position_precision == 0.01
+
+    sim.run(1)
+    snap = sim.state.get_snapshot()
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='r') as traj:
+            position = traj[0].particles.position
+            # positions are rounded to multiples of 2**-7
+            quantum = 2**-7
+            np.testing.assert_allclose(position / quantum,
+                                       np.round(position / quantum))
+            np.testing.assert_allclose(position,
+                                       snap.particles.position,
+                                       atol=quantum / 2 + 1e-6)
+
+
+@pytest.mark.skipif(not hoomd.version.zstd_enabled,
+                    reason="zstd compression is not available")
+def test_write_gsd_compression(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'],
+                                 compression='zstd')
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.compression == 'zstd'
+
+    sim.run(1)
+    snap = sim.state.get_snapshot()
+    gsd_writer.flush()
+
+    new_sim = hoomd.Simulation(device=sim.device)
+    new_sim.create_state_from_gsd(filename=filename)
+    new_snap = new_sim.state.get_snapshot()
+
+    if new_snap.communicator.rank == 0:
+        assert new_snap.particles.N == snap.particles.N
+        np.testing.assert_allclose(new_snap.particles.position,
+                                   snap.particles.position)
+        np.testing.assert_allclose(new_snap.particles.velocity,
+                                   snap.particles.velocity)
+        np.testing.assert_equal(new_snap.particles.typeid,
+                                snap.particles.typeid)
+        np.testing.assert_equal(new_snap.particles.image, snap.particles.image)
+        np.testing.assert_allclose(new_snap.particles.mass,
+                                   snap.particles.mass)
+
+
+def test_write_gsd_keyframe(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 keyframe_interval=3)
+    gsd_writer.position_precision = 1 / 1024
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.keyframe_interval == 3
+
+    positions = []
+    for _ in range(5):
+        sim.run(1)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            positions.append(snap.particles.position)
+    gsd_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with gsd.fl.open(name=filename, mode='r') as f:
+            delta = 'hoomd/delta/particles/position'
+            assert [f.chunk_exists(frame=i, name=delta) for i in range(5)
+                   ] == [False, True, True, False, True]
+
+    for i in range(5):
+        new_sim = hoomd.Simulation(device=sim.device)
+        new_sim.create_state_from_gsd(filename=filename, frame=i)
+        new_snap = new_sim.state.get_snapshot()
+        if new_snap.communicator.rank == 0:
+            np.testing.assert_allclose(new_snap.particles.position,
+                                       positions[i],
+                                       atol=1 / 1024 + 1e-6)
+
+
+def test_write_gsd_compression_invalid(tmp_path):
+    with pytest.raises(ValueError):
+        hoomd.write.GSD(filename=tmp_path / "temporary_test_file.gsd",
+                        trigger=hoomd.trigger.Periodic(1),
+                        compression='lz4')
+
+
 dynamic_fields = [
     'particles/position',
     'particles/orientation',
@@ -88,6 +88,52 @@ def test_write(create_md_sim, tmp_path):
             assert np.allclose(fh[key], kinetic_energy_list)
 
 
+def test_write_buffered(create_md_sim, tmp_path):
+    filename = tmp_path / "temporary_test_file.h5"
+
+    sim = create_md_sim
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    logger = hoomd.logging.Logger(["scalar", "sequence"])
+    logger.add(thermo, quantities=["kinetic_energy", "pressure_tensor"])
+
+    hdf5_writer = hoomd.write.HDF5Log(filename=filename,
+                                      trigger=hoomd.trigger.Periodic(1),
+                                      mode='w',
+                                      logger=logger,
+                                      buffer_size=4)
+    assert hdf5_writer.buffer_size == 4
+    sim.operations.writers.append(hdf5_writer)
+
+    kinetic_energy_list = []
+    pressure_tensor_list = []
+    for _ in range(6):
+        sim.run(1)
+        kinetic_energy_list.append(thermo.kinetic_energy)
+        pressure_tensor_list.append(thermo.pressure_tensor)
+
+    key = 'hoomd-data/md/compute/ThermodynamicQuantities/'
+    if sim.device.communicator.rank == 0:
+        with h5py.File(filename, mode='r') as fh:
+            assert len(fh[key + 'kinetic_energy']) == 4
+
+    hdf5_writer.flush()
+
+    if sim.device.communicator.rank == 0:
+        with h5py.File(filename, mode='r') as fh:
+            assert fh['hoomd-data'].attrs['frames'] == 6
+            assert np.allclose(fh[key + 'kinetic_energy'], kinetic_energy_list)
+            assert np.allclose(fh[key + 'pressure_tensor'],
+                               pressure_tensor_list)
+
+
+def test_invalid_buffer_size(tmp_path):
+    logger = hoomd.logging.Logger(categories=['scalar'])
+    with pytest.raises(ValueError):
+        hoomd.write.HDF5Log(1, tmp_path / "eg.h5", logger, buffer_size=0)
+
+
 def test_write_method(create_md_sim, tmp_path):
     filename = tmp_path / "temporary_test_file.h5"
 
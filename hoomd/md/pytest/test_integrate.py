@@ -164,3 +164,104 @@ def test_logging():
             "category": hoomd.logging.LoggerCategories.sequence
         }
     })
+
+
+def test_force_interval(simulation_factory, two_particle_snapshot_factory):
+    constant = hoomd.md.force.Constant(filter=hoomd.filter.All())
+    constant.constant_force['A'] = (1.0, 0.0, 0.0)
+    assert constant.interval == 1
+
+    with pytest.raises(ValueError):
+        constant.interval = 0
+
+    constant.interval = 2
+    assert constant.interval == 2
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=8))
+    integrator = hoomd.md.Integrator(
+        dt=0.005,
+        methods=[hoomd.md.methods.ConstantVolume(hoomd.filter.All())],
+        forces=[constant])
+    sim.operations.integrator = integrator
+    sim.run(0)
+    assert constant._cpp_obj.interval == 2
+
+    # a constant force applied every 2 steps with weight 2 imparts the same
+    # momentum over 2 steps as when it is applied every step
+    sim.run(2)
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        numpy.testing.assert_allclose(snapshot.particles.velocity[:, 0],
+                                      [0.01, 0.01])
+
+    constant.interval = 1
+    assert constant._cpp_obj.interval == 1
+
+
+def test_constraint_interval():
+    distance = hoomd.md.constrain.Distance()
+    assert distance.interval == 1
+
+    with pytest.raises(ValueError):
+        distance.interval = 2
+
+
+def _run_split_methods(simulation_factory, snapshot, make_method, n_methods):
+    """Run with the particles split among ``n_methods`` methods."""
+    sim = simulation_factory(snapshot)
+    sim.seed = 4
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    constant = hoomd.md.force.Constant(filter=hoomd.filter.All())
+    constant.constant_force['A'] = (0.5, 0.0, 0.0)
+
+    tags = numpy.array_split(numpy.arange(sim.state.N_particles), n_methods)
+    methods = [make_method(hoomd.filter.Tags(t.tolist())) for t in tags]
+
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                    methods=methods,
+                                                    forces=[lj, constant])
+    thermo = hoomd.md.compute.ThermodynamicQuantities(hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+    sim.run(20)
+
+    snapshot = sim.state.get_snapshot()
+    return (snapshot, thermo.pressure_tensor)
+
+
+@pytest.mark.parametrize("make_method", [
+    lambda f: hoomd.md.methods.ConstantVolume(filter=f),
+    lambda f: hoomd.md.methods.Langevin(filter=f, kT=1.0),
+],
+                         ids=["ConstantVolume", "Langevin"])
+def test_single_method_matches_split_methods(simulation_factory,
+                                             lattice_snapshot_factory,
+                                             make_method):
+    """A single method on all particles integrates the same trajectory.
+
+    On the GPU, a single method on all particles sums the net force in its
+    second step kernel.
+    """
+    snapshot = lattice_snapshot_factory(n=6, a=1.2, r=0.1)
+
+    snapshot_one, pressure_one = _run_split_methods(simulation_factory,
+                                                    snapshot, make_method, 1)
+    snapshot_two, pressure_two = _run_split_methods(simulation_factory,
+                                                    snapshot, make_method, 2)
+
+    numpy.testing.assert_allclose(pressure_one, pressure_two, rtol=1e-5)
+    if snapshot_one.communicator.rank == 0:
+        numpy.testing.assert_allclose(snapshot_one.particles.position,
+                                      snapshot_two.particles.position,
+                                      rtol=1e-5,
+                                      atol=1e-5)
+        numpy.testing.assert_allclose(snapshot_one.particles.velocity,
+                                      snapshot_two.particles.velocity,
+                                      rtol=1e-5,
+                                      atol=1e-5)
+        numpy.testing.assert_allclose(snapshot_one.particles.acceleration,
+                                      snapshot_two.particles.acceleration,
+                                      rtol=1e-5,
+                                      atol=1e-5)
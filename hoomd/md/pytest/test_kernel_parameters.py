@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import pickle
 import pytest
 
 
@@ -43,3 +44,79 @@ def test_combined_kernel_parameters(simulation_factory,
 
     # langevin should remained tuned:
     assert langevin.is_tuning_complete
+
+
+def _make_lj_simulation(simulation_factory, snapshot):
+    sim = simulation_factory(snapshot)
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                    methods=[nve],
+                                                    forces=[lj])
+    sim.run(0)
+    return sim, nlist, lj, nve
+
+
+@pytest.mark.serial
+def test_kernel_parameter_cache(simulation_factory, lattice_snapshot_factory,
+                                tmp_path):
+    filename = tmp_path / 'kernel_parameters.json'
+    snap = lattice_snapshot_factory(particle_types=['A'], n=7, a=1.7, r=0.01)
+    sim, nlist, lj, nve = _make_lj_simulation(simulation_factory, snap)
+
+    assert not sim.operations.load_kernel_parameters(filename)
+
+    while not sim.operations.is_tuning_complete:
+        sim.run(1000)
+
+        # Prevent infinite loops:
+        if sim.timestep > 100_000:
+            raise RuntimeError("Tuning is not completing as expected.")
+
+    sim.operations.save_kernel_parameters(filename)
+    saved = [nlist.kernel_parameters, lj.kernel_parameters,
+             nve.kernel_parameters]
+
+    # A new simulation of the same system restores the tuned parameters.
+    sim, nlist, lj, nve = _make_lj_simulation(simulation_factory, snap)
+    assert sim.operations.load_kernel_parameters(filename)
+    assert [nlist.kernel_parameters, lj.kernel_parameters,
+            nve.kernel_parameters] == saved
+    assert nlist.is_tuning_complete
+    assert lj.is_tuning_complete
+    assert nve.is_tuning_complete
+
+    # A simulation of a different system does not match the saved entry.
+    snap = lattice_snapshot_factory(particle_types=['A'], n=5, a=1.7, r=0.01)
+    sim, nlist, lj, nve = _make_lj_simulation(simulation_factory, snap)
+    assert not sim.operations.load_kernel_parameters(filename)
+
+
+@pytest.mark.serial
+def test_pickled_kernel_parameters(simulation_factory,
+                                   lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(particle_types=['A'], n=7, a=1.7, r=0.01)
+    sim, nlist, lj, nve = _make_lj_simulation(simulation_factory, snap)
+
+    while not sim.operations.is_tuning_complete:
+        sim.run(1000)
+
+        # Prevent infinite loops:
+        if sim.timestep > 100_000:
+            raise RuntimeError("Tuning is not completing as expected.")
+
+    saved = [lj.kernel_parameters, lj.nlist.kernel_parameters]
+
+    # The unpickled force and its neighbor list attach with the tuned values.
+    lj = pickle.loads(pickle.dumps(lj))
+    sim = simulation_factory(snap)
+    nve = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                    methods=[nve],
+                                                    forces=[lj])
+    sim.run(0)
+    assert [lj.kernel_parameters, lj.nlist.kernel_parameters] == saved
+    assert lj.is_tuning_complete
+    assert lj.nlist.is_tuning_complete
@@ -0,0 +1,134 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import pytest
+
+import hoomd
+from hoomd.logging import LoggerCategories
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd import md
+
+
+def _make_lbfgs(**kwargs):
+    return md.minimize.LBFGS(max_displacement=0.05,
+                             force_tol=1e-2,
+                             energy_tol=1e-6,
+                             **kwargs)
+
+
+def test_constructor_validation():
+    """Make sure constructor validates arguments."""
+    with pytest.raises(ValueError):
+        _make_lbfgs(memory=-1)
+    with pytest.raises(ValueError):
+        _make_lbfgs(min_steps_conv=-5)
+
+
+def test_get_set_params(simulation_factory, two_particle_snapshot_factory):
+    """Assert we can get/set params when not attached and when attached."""
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+    lbfgs = _make_lbfgs(methods=[nve])
+    params = {
+        'max_displacement': 0.05,
+        'force_tol': 1e-2,
+        'energy_tol': 1e-6,
+        'memory': 5,
+        'min_steps_conv': 10
+    }
+    for param in params:
+        assert getattr(lbfgs, param) == params[param]
+
+    new_params = {
+        'max_displacement': 0.1,
+        'force_tol': 1e-3,
+        'energy_tol': 1e-7,
+        'memory': 8,
+        'min_steps_conv': 3
+    }
+    for param in new_params:
+        setattr(lbfgs, param, new_params[param])
+
+    sim = simulation_factory(two_particle_snapshot_factory(d=2.34))
+    sim.operations.integrator = lbfgs
+    sim.run(0)
+
+    for param in new_params:
+        assert getattr(lbfgs, param) == new_params[param]
+
+    lbfgs.memory = 3
+    assert lbfgs.memory == 3
+
+
+def test_run_minimization(lattice_snapshot_factory, simulation_factory):
+    """Minimize a compressed lattice and compare with FIRE."""
+
+    def minimize(integrator):
+        snap = lattice_snapshot_factory(a=1.5, n=6, r=0.1)
+        sim = simulation_factory(snap)
+        lj = md.pair.LJ(default_r_cut=2.5, nlist=md.nlist.Cell(buffer=0.4))
+        lj.params[('A', 'A')] = dict(sigma=1.0, epsilon=1.0)
+        integrator.forces.append(lj)
+        integrator.methods.append(
+            md.methods.ConstantVolume(hoomd.filter.All()))
+        sim.operations.integrator = integrator
+        sim.run(0)
+
+        initial_energy = integrator.energy
+        steps = 0
+        while not integrator.converged and steps < 20000:
+            sim.run(10)
+            steps += 10
+
+        assert integrator.converged
+        assert integrator.energy < initial_energy
+        return steps
+
+    lbfgs_steps = minimize(_make_lbfgs(min_steps_conv=3))
+    fire_steps = minimize(
+        md.minimize.FIRE(dt=0.0025,
+                         force_tol=1e-2,
+                         angmom_tol=1e-2,
+                         energy_tol=1e-6,
+                         min_steps_conv=3))
+
+    assert lbfgs_steps <= fire_steps
+
+
+def test_pickling(lattice_snapshot_factory, simulation_factory):
+    """Assert the minimizer can be pickled when attached/unattached."""
+    snap = lattice_snapshot_factory(a=1.5, n=5)
+    sim = simulation_factory(snap)
+
+    nve = md.methods.ConstantVolume(hoomd.filter.All())
+    lbfgs = _make_lbfgs(methods=[nve])
+
+    operation_pickling_check(lbfgs, sim)
+
+
+def test_validate_methods():
+    """Make sure only ConstantVolume methods can be added to LBFGS."""
+    lbfgs = _make_lbfgs()
+    lbfgs.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+
+    with pytest.raises(ValueError):
+        lbfgs.methods.append(
+            md.methods.ConstantPressure(hoomd.filter.All(),
+                                        S=1,
+                                        tauS=1,
+                                        couple='none'))
+    with pytest.raises(ValueError):
+        lbfgs.methods.append(md.methods.Brownian(hoomd.filter.All(), kT=1))
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.minimize.LBFGS, ('md', 'minimize', 'lbfgs'), {
+            'converged': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
+            'energy': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
@@ -62,6 +62,8 @@ def test_common_params(nlist_params):
         "exclusions": ('bond',),
         "rebuild_check_delay": 1,
         "check_dist": True,
+        "clusters": False,
+        "incremental": False,
     }
     _assert_nlist_params(nlist, default_params_dict)
     new_params_dict = {
@@ -76,6 +78,10 @@ def test_common_params(nlist_params):
             np.random.randint(8),
         "check_dist":
             False,
+        "clusters":
+            True,
+        "incremental":
+            True,
     }
     for param in new_params_dict.keys():
         setattr(nlist, param, new_params_dict[param])
@@ -92,12 +98,25 @@ def test_cell_specific_params():
 def test_stencil_specific_params():
     cell_width = np.random.uniform(12.1)
     nlist = Stencil(cell_width=cell_width, buffer=0.4)
-    _assert_nlist_params(nlist, dict(deterministic=False,
-                                     cell_width=cell_width))
+    _assert_nlist_params(
+        nlist, dict(deterministic=False, cell_width=cell_width,
+                    multilevel=False))
     nlist.deterministic = True
     x = np.random.uniform(25.5)
     nlist.cell_width = x
-    _assert_nlist_params(nlist, dict(deterministic=True, cell_width=x))
+    nlist.multilevel = True
+    _assert_nlist_params(nlist,
+                         dict(deterministic=True, cell_width=x,
+                              multilevel=True))
+
+
+def test_tree_specific_params():
+    nlist = Tree(buffer=0.4)
+    _assert_nlist_params(nlist, dict(max_refits=0))
+    nlist.max_refits = 10
+    _assert_nlist_params(nlist, dict(max_refits=10))
+    with pytest.raises(ValueError):
+        nlist.max_refits = -1
 
 
 def test_simple_simulation(nlist_params, simulation_factory,
@@ -124,6 +143,372 @@ def test_simple_simulation(nlist_params, simulation_factory,
                                      activate=lambda: sim.run(1))
 
 
+def test_cluster_pairs(nlist_params, simulation_factory,
+                       lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(n=6, a=1.1, r=0.1)
+
+    forces = []
+    energies = []
+    for clusters in (False, True):
+        nlist = nlist_cls(**required_args, buffer=0.4, clusters=clusters)
+        lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        integrator = hoomd.md.Integrator(0.005, forces=[lj])
+
+        sim = simulation_factory(snap)
+        sim.operations.integrator = integrator
+        sim.run(0)
+        assert nlist.clusters == clusters
+        forces.append(lj.forces)
+        energies.append(lj.energies)
+
+    if forces[0] is not None:
+        np.testing.assert_allclose(forces[0], forces[1], rtol=1e-5, atol=1e-5)
+        np.testing.assert_allclose(energies[0],
+                                   energies[1],
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_incremental(nlist_params, simulation_factory,
+                     lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+    sim = simulation_factory(snap)
+    if (sim.device.communicator.num_ranks > 1
+            or not isinstance(sim.device, hoomd.device.CPU)):
+        pytest.skip("Partial updates are only performed on a single CPU rank.")
+
+    nlist = nlist_cls(**required_args, buffer=0.4, incremental=True)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    reference_nlist = nlist_cls(**required_args, buffer=0.4)
+    reference_lj = hoomd.md.pair.LJ(reference_nlist, default_r_cut=1.5)
+    reference_lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    sim.operations.computes.extend([lj, reference_lj])
+
+    # build the list once after any particle sort, which forces a full update
+    sim.run(1)
+    nlist.pair_list
+    assert nlist.num_partial_updates == 0
+
+    # displace a few particles past half the buffer, leaving the others at
+    # their reference positions
+    with sim.state.cpu_local_snapshot as data:
+        for tag in (0, 100, 300):
+            i = data.particles.rtag[tag]
+            data.particles.position[i] = data.particles.position[i] + np.array(
+                [0.25, -0.1, 0.05])
+    sim.run(1)
+
+    # the partial update must produce the same pairs as a full rebuild of the
+    # same configuration
+    pairs = nlist.pair_list
+    assert nlist.incremental
+    assert nlist.num_partial_updates > 0
+    reference_pairs = reference_nlist.pair_list
+    assert set(map(tuple, np.sort(pairs, axis=1))) == set(
+        map(tuple, np.sort(reference_pairs, axis=1)))
+    np.testing.assert_allclose(lj.forces,
+                               reference_lj.forces,
+                               rtol=1e-5,
+                               atol=1e-5)
+
+
+def test_inner(nlist_params, simulation_factory, lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=8,
+                                    a=1.2,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = np.arange(snap.particles.N) % 2
+
+    # the long range force uses the outer list, the short range force filters
+    # its pairs from the outer list
+    outer = nlist_cls(**required_args, buffer=0.6)
+    yukawa = hoomd.md.pair.Yukawa(outer, default_r_cut=3.0)
+    yukawa.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=0.5, kappa=0.5)
+    yukawa.interval = 2
+
+    inner = hoomd.md.nlist.Inner(outer, buffer=0.3)
+    lj = hoomd.md.pair.LJ(inner, default_r_cut=1.5)
+    lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+    lj.r_cut[('A', 'B')] = 0
+
+    # forces computed with the inner list should match forces computed with a
+    # list built from the cell list
+    reference_lj = hoomd.md.pair.LJ(hoomd.md.nlist.Cell(buffer=0.3),
+                                    default_r_cut=1.5)
+    reference_lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+    reference_lj.r_cut[('A', 'B')] = 0
+
+    integrator = hoomd.md.Integrator(0.005, forces=[yukawa, lj])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(reference_lj)
+    sim.run(100)
+
+    assert inner.outer is outer
+    assert inner.num_builds > 0
+    forces = lj.forces
+    reference_forces = reference_lj.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+    # removing the forces detaches the inner list and its outer list
+    sim.operations.integrator = None
+    assert not inner._attached
+    assert not outer._attached
+
+
+def test_tree_refit(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=8,
+                                    a=1.2,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::3] = 1
+
+    # rebuild at every step so that most builds refit the trees, the forces
+    # should match those computed with trees built from scratch
+    nlist = Tree(buffer=0.3,
+                 check_dist=False,
+                 rebuild_check_delay=1,
+                 max_refits=4)
+    reference_nlist = Tree(buffer=0.3, check_dist=False, rebuild_check_delay=1)
+
+    forces = []
+    for nl in (nlist, reference_nlist):
+        lj = hoomd.md.pair.LJ(nl, default_r_cut=1.5)
+        lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+        forces.append(lj)
+
+    integrator = hoomd.md.Integrator(0.005, forces=[forces[0]])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(forces[1])
+    sim.run(50)
+
+    assert nlist.max_refits == 4
+    if forces[0].forces is not None:
+        np.testing.assert_allclose(forces[0].forces,
+                                   forces[1].forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_stencil_multilevel(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=10,
+                                    a=1.5,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::3] = 1
+
+    # the cutoffs differ by a factor of 10, so A and B are in different
+    # levels, the forces should match those of a single cell list
+    nlist = Stencil(cell_width=0.6, buffer=0.3, multilevel=True)
+    reference_nlist = Stencil(cell_width=0.6, buffer=0.3)
+
+    forces = []
+    for nl in (nlist, reference_nlist):
+        lj = hoomd.md.pair.LJ(nl)
+        lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+        lj.r_cut[('A', 'A')] = 0.6
+        lj.r_cut[('A', 'B')] = 3.0
+        lj.r_cut[('B', 'B')] = 6.0
+        forces.append(lj)
+
+    integrator = hoomd.md.Integrator(0.001, forces=[forces[0]])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(forces[1])
+    sim.run(20)
+
+    assert nlist.multilevel
+    if forces[0].forces is not None:
+        np.testing.assert_allclose(forces[0].forces,
+                                   forces[1].forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_compact_memory(nlist_params, simulation_factory,
+                        lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+
+    # a large buffer fills the list with many neighbors per particle
+    nlist = nlist_cls(**required_args, buffer=1.5)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    reference_nlist = nlist_cls(**required_args, buffer=0.3)
+    reference_lj = hoomd.md.pair.LJ(reference_nlist, default_r_cut=1.5)
+    reference_lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005, forces=[lj])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(reference_lj)
+    sim.run(1)
+    large_usage = nlist.memory_usage
+    assert large_usage > 0
+
+    # the list keeps its capacity after the buffer shrinks until compacted
+    nlist.buffer = 0.3
+    sim.run(1)
+    nlist.compact_memory()
+    sim.run(1)
+    assert nlist.memory_usage < large_usage
+
+    forces = lj.forces
+    reference_forces = reference_lj.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_pair_buffer(nlist_params, simulation_factory,
+                     lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=8,
+                                    a=1.2,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+
+    # forces computed with smaller pair buffers should match forces computed
+    # with the global buffer
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    assert nlist.pair_buffer[('A', 'B')] is None
+    nlist.pair_buffer[('A', 'A')] = 0.1
+    nlist.pair_buffer[('A', 'B')] = 0.2
+    assert nlist.pair_buffer[('B', 'A')] == 0.2
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+    reference_nlist = nlist_cls(**required_args, buffer=0.4)
+    reference_lj = hoomd.md.pair.LJ(reference_nlist, default_r_cut=1.5)
+    for potential in (lj, reference_lj):
+        potential.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005, forces=[lj])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.operations.computes.append(reference_lj)
+    sim.run(100)
+
+    assert nlist.pair_buffer[('A', 'A')] == 0.1
+    assert nlist.pair_buffer[('B', 'B')] is None
+    forces = lj.forces
+    reference_forces = reference_lj.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+def test_pair_buffer_ghost_layer(nlist_params, simulation_factory,
+                                 lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=8,
+                                    a=1.2,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+
+    # small pair buffers shrink the ghost layer when this is the only neighbor
+    # list in the simulation
+    nlist = nlist_cls(**required_args, buffer=0.4)
+    nlist.pair_buffer[('A', 'A')] = 0.1
+    nlist.pair_buffer[('A', 'B')] = 0.1
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+    lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+
+    integrator = hoomd.md.Integrator(0.005, forces=[lj])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=0.1))
+
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.run(100)
+    forces = lj.forces
+
+    # recompute the forces of the final configuration with the full buffer
+    reference_nlist = nlist_cls(**required_args, buffer=0.4)
+    reference_lj = hoomd.md.pair.LJ(reference_nlist, default_r_cut=1.5)
+    reference_lj.params[(['A', 'B'], ['A', 'B'])] = dict(epsilon=1, sigma=1)
+    reference_sim = simulation_factory(sim.state.get_snapshot())
+    reference_sim.operations.computes.append(reference_lj)
+    reference_sim.run(0)
+    reference_forces = reference_lj.forces
+
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+def test_exclusions(nlist_params, simulation_factory,
+                    lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    snap = lattice_snapshot_factory(n=6, a=1.0)
+
+    # exclude a random subset of the nearest neighbor pairs
+    truth_set = set()
+    if snap.communicator.rank == 0:
+        L = snap.configuration.box[0]
+        position = snap.particles.position
+        N = snap.particles.N
+        pairs = []
+        for i in range(N):
+            delta = position[i + 1:] - position[i]
+            delta -= L * np.round(delta / L)
+            for j in np.nonzero(np.sum(delta * delta, axis=1) < 1.1**2)[0]:
+                pairs.append((i, i + 1 + j))
+
+        rng = np.random.default_rng(11)
+        bonded = rng.random(len(pairs)) < 0.3
+        snap.bonds.types = ['A-A']
+        snap.bonds.N = np.sum(bonded)
+        snap.bonds.group[:] = np.array(pairs)[bonded]
+        truth_set = set(
+            frozenset(pair) for pair, b in zip(pairs, bonded) if not b)
+
+    nlist = nlist_cls(**required_args,
+                      buffer=0.0,
+                      default_r_cut=1.1,
+                      exclusions=('bond',))
+    sim = simulation_factory(snap)
+    sim.operations.computes.append(nlist)
+    sim.run(0)
+
+    _check_pair_set(sim, nlist, truth_set)
+
+
 def test_auto_detach_simulation(simulation_factory,
                                 two_particle_snapshot_factory):
     nlist = Cell(buffer=0.4)
@@ -191,6 +576,97 @@ def test_cell_properties(simulation_factory, lattice_snapshot_factory):
     assert nlist.allocated_particles_per_cell >= 1
 
 
+def test_cell_tiled_kernel(simulation_factory, lattice_snapshot_factory):
+    """The tiled GPU cell list kernel builds the same list as the default."""
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=8,
+                                    a=1.0,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+
+    forces = []
+    for tiled in (0, 1):
+        nlist = hoomd.md.nlist.Cell(buffer=0, exclusions=())
+        lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.5)
+        lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        lj.params[('A', 'B')] = dict(epsilon=1, sigma=1, r_cut=1.2)
+        lj.params[('B', 'B')] = dict(epsilon=1, sigma=1)
+        integrator = hoomd.md.Integrator(0.001, forces=[lj])
+        integrator.methods.append(
+            hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+        sim = simulation_factory(snap)
+        sim.seed = 5
+        sim.operations.integrator = integrator
+        sim.run(0)
+
+        if isinstance(sim.device, hoomd.device.CPU):
+            pytest.skip("The tiled kernel is only available on the GPU")
+
+        parameters = nlist.kernel_parameters
+        block_size = parameters['nlist_binned'][0]
+        nlist.kernel_parameters = {'nlist_binned': (block_size, 1, tiled)}
+        sim.run(10)
+        assert nlist.kernel_parameters['nlist_binned'][2] == tiled
+        forces.append(lj.forces)
+
+    if forces[0] is not None:
+        np.testing.assert_allclose(forces[0], forces[1], rtol=1e-4, atol=1e-4)
+
+
+def test_affine_box_deformation(simulation_factory, lattice_snapshot_factory):
+    """Shearing the box affinely does not trigger neighbor list rebuilds."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+
+    sim = simulation_factory(lattice_snapshot_factory(a=1.2, n=10))
+    sim.operations.integrator = integrator
+
+    # BoxResize displaces particles by up to 0.3, more than half the buffer
+    box_resize = hoomd.update.BoxResize(
+        trigger=hoomd.trigger.Periodic(1),
+        box1=sim.state.box,
+        box2=hoomd.Box(Lx=12, Ly=12, Lz=12, xy=0.05),
+        variant=hoomd.variant.Ramp(0, 1, 0, 100))
+    sim.operations.updaters.append(box_resize)
+
+    sim.run(100)
+
+    assert sim.state.box.xy == pytest.approx(0.05)
+    assert nlist.num_builds == 1
+
+
+def test_cell_compact_memory(simulation_factory, lattice_snapshot_factory):
+    nlist = hoomd.md.nlist.Cell(buffer=0)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=1.1)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    integrator = hoomd.md.Integrator(0.005, forces=[lj])
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1))
+
+    # crowd all particles into a few cells of a large box
+    snap = lattice_snapshot_factory(n=10, a=0.3)
+    if snap.communicator.rank == 0:
+        snap.configuration.box = [40, 40, 40, 0, 0, 0]
+    sim = simulation_factory(snap)
+    sim.operations.integrator = integrator
+    sim.run(0)
+    crowded_slots = nlist.allocated_particles_per_cell
+
+    # spread the particles out and release the slots
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.position[:] *= 10
+    sim.state.set_snapshot(snap)
+    nlist.compact_memory()
+    sim.run(1)
+    assert 1 <= nlist.allocated_particles_per_cell < crowded_slots
+
+
 def test_logging():
     base_loggables = {
         'shortest_rebuild': {
@@ -200,6 +676,14 @@ def test_logging():
         'num_builds': {
             'category': LoggerCategories.scalar,
             'default': False
+        },
+        'num_partial_updates': {
+            'category': LoggerCategories.scalar,
+            'default': False
+        },
+        'memory_usage': {
+            'category': LoggerCategories.scalar,
+            'default': False
         }
     }
     logging_check(hoomd.md.nlist.NeighborList, ('md', 'nlist'), base_loggables)
@@ -571,3 +1055,29 @@ void get_local_pairs(
         global_pairs = _check_local_pairs_with_mpi(local_pairs, broadcast=True)
 
         _check_local_pair_counts(sim, global_pairs, half_nlist)
+
+
+@pytest.mark.parametrize("setup", pair_setup_funcs)
+def test_cpu_local_pair_arrays(simulation_factory, lattice_snapshot_factory,
+                               setup):
+
+    sim, nlist, full = setup(simulation_factory, lattice_snapshot_factory)
+
+    local_pair_list = np.array(nlist.local_pair_list).reshape(-1, 2)
+
+    with nlist.cpu_local_nlist_arrays as data:
+        with sim.state.cpu_local_snapshot as snap_data:
+            pair_list = np.array(data.pair_list, copy=True)
+            pair_dr = np.array(data.pair_dr, copy=True)
+            positions = np.array(snap_data.particles.position_with_ghost,
+                                 copy=True)
+
+    np.testing.assert_array_equal(pair_list, local_pair_list)
+    assert pair_dr.shape == (len(pair_list), 3)
+
+    if len(pair_list) > 0:
+        box = sim.state.box
+        dr = positions[pair_list[:, 0]] - positions[pair_list[:, 1]]
+        L = np.array([box.Lx, box.Ly, box.Lz])
+        dr -= L * np.round(dr / L)
+        np.testing.assert_allclose(pair_dr, dr, atol=1e-5)
@@ -124,3 +124,38 @@ class TestMoveSize:
 
     def test_pickling(self, nlist_tuner, simulation):
         operation_pickling_check(nlist_tuner, simulation)
+
+
+class TestPairBuffer:
+
+    def test_valid_construction(self, nlist):
+        solver = hoomd.tune.GridOptimizer()
+        attrs = {
+            "solver": solver,
+            "nlist": nlist,
+            "trigger": 5,
+            "minimum_buffer": 0.1
+        }
+        tuner = md.tune.NeighborListPairBuffer(**attrs)
+        for attr, value in attrs.items():
+            tuner_attr = getattr(tuner, attr)
+            if attr == 'trigger':
+                assert tuner_attr.period == value
+            else:
+                assert tuner_attr is value or tuner_attr == value
+
+    def test_act(self, nlist, simulation):
+        tuner = md.tune.NeighborListPairBuffer.with_grid(trigger=5,
+                                                         nlist=nlist,
+                                                         n_bins=2)
+        simulation.operations.tuners.append(tuner)
+        simulation.run(1)
+        assert tuner._tunables[0].x == nlist.buffer
+        simulation.run(10)
+        assert nlist.pair_buffer[("A", "A")] is not None
+        assert nlist.pair_buffer[("A", "A")] <= nlist.buffer
+
+    def test_pickling(self, nlist, simulation):
+        tuner = md.tune.NeighborListPairBuffer.with_grid(trigger=5,
+                                                         nlist=nlist)
+        operation_pickling_check(tuner, simulation)
@@ -206,6 +206,13 @@ def _invalid_params():
     invalid_params_list.extend(
         _make_invalid_params(ewald_invalid_dicts, md.pair.Ewald, {}))
 
+    dispersion_ewald_valid_dict = {"c6": 4.0, "beta": 1}
+    dispersion_ewald_invalid_dicts = _make_invalid_param_dict(
+        dispersion_ewald_valid_dict)
+    invalid_params_list.extend(
+        _make_invalid_params(dispersion_ewald_invalid_dicts,
+                             md.pair.DispersionEwald, {}))
+
     morse_valid_dict = {"D0": 0.05, "alpha": 1, "r0": 0}
     morse_invalid_dicts = _make_invalid_param_dict(morse_valid_dict)
     invalid_params_list.extend(
@@ -436,6 +443,13 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(md.pair.Ewald, dict(zip(combos, ewald_valid_param_dicts)),
                    {}))
 
+    dispersion_ewald_arg_dict = {"c6": [1.0, 2.0, 4.0], "beta": [0.5, 1.0, 1.5]}
+    dispersion_ewald_valid_param_dicts = _make_valid_param_dicts(
+        dispersion_ewald_arg_dict)
+    valid_params_list.append(
+        paramtuple(md.pair.DispersionEwald,
+                   dict(zip(combos, dispersion_ewald_valid_param_dicts)), {}))
+
     morse_arg_dict = {
         "D0": [0.025, 0.05, 0.075],
         "alpha": [0.5, 1.0, 1.5],
@@ -648,6 +662,14 @@ def _valid_params(particle_types=['A', 'B']):
         paramtuple(hoomd.md.pair.LJGauss,
                    dict(zip(combos, ljgauss_valid_param_dicts)), {}))
 
+    lj_yukawa_valid_param_dicts = [
+        dict(lj=lj, yukawa=yukawa)
+        for lj, yukawa in zip(lj_valid_param_dicts, yukawa_valid_param_dicts)
+    ]
+    valid_params_list.append(
+        paramtuple(hoomd.md.pair.LJYukawa,
+                   dict(zip(combos, lj_yukawa_valid_param_dicts)), {}))
+
     rs = [
         np.arange(0, 2.6, 0.1),
         np.linspace(0.5, 2.5, 25),
@@ -1044,6 +1066,31 @@ def test_force_energy_accuracy(simulation_factory,
                                equal_nan=True)
 
 
+@pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
+def test_compute_energy(simulation_factory, lattice_snapshot_factory, mode):
+    """The energy only path matches the energy of the force computation."""
+    sim = simulation_factory(
+        lattice_snapshot_factory(n=6, a=1.2, r=0.1, particle_types=['A', 'B']))
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::2] = 1
+    sim.state.set_snapshot(snap)
+
+    lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4),
+                    default_r_cut=2.5,
+                    default_r_on=2.0,
+                    mode=mode)
+    lj.params[('A', 'A')] = {'sigma': 1, 'epsilon': 1.0}
+    lj.params[('A', 'B')] = {'sigma': 0.9, 'epsilon': 0.5}
+    lj.params[('B', 'B')] = {'sigma': 1.1, 'epsilon': 1.5}
+    sim.operations.integrator = md.Integrator(dt=0.005, forces=[lj])
+    sim.run(0)
+
+    energy = lj.energy
+    assert lj._cpp_obj.computeEnergy(sim.timestep) == pytest.approx(energy,
+                                                                    rel=1e-5)
+
+
 def populate_sim(sim):
     """Add an integrator for the following tests."""
     sim.operations.integrator = md.Integrator(
@@ -1377,3 +1424,213 @@ def test_shift(simulation_factory, two_particle_snapshot_factory,
     # is much closer to 0 than V.
     tolerance = max(math.fabs(V / 1e4), 1e-8)
     assert V_shifted == pytest.approx(expected=0, abs=tolerance)
+
+
+@pytest.mark.parametrize("mode", ['none', 'shift', 'xplor'])
+def test_lj_yukawa(simulation_factory, lattice_snapshot_factory, mode):
+    lj_params = dict(epsilon=1.0, sigma=1.0)
+    yukawa_params = dict(epsilon=0.5, kappa=1.5)
+
+    lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4),
+                    default_r_cut=2.5,
+                    default_r_on=2.0,
+                    mode=mode)
+    lj.params[('A', 'A')] = lj_params
+    yukawa = md.pair.Yukawa(nlist=md.nlist.Cell(buffer=0.4),
+                            default_r_cut=2.5,
+                            default_r_on=2.0,
+                            mode=mode)
+    yukawa.params[('A', 'A')] = yukawa_params
+    lj_yukawa = md.pair.LJYukawa(nlist=md.nlist.Cell(buffer=0.4),
+                                 default_r_cut=2.5,
+                                 default_r_on=2.0,
+                                 mode=mode)
+    lj_yukawa.params[('A', 'A')] = dict(lj=lj_params, yukawa=yukawa_params)
+
+    snap = lattice_snapshot_factory(n=6, a=1.2, r=0.05)
+    sim = simulation_factory(snap)
+    sim.operations.computes.extend([lj, yukawa, lj_yukawa])
+    sim.run(0)
+
+    np.testing.assert_allclose(lj_yukawa.lj_energy, lj.energy, rtol=1e-5)
+    np.testing.assert_allclose(lj_yukawa.yukawa_energy,
+                               yukawa.energy,
+                               rtol=1e-5)
+    np.testing.assert_allclose(lj_yukawa.energy,
+                               lj.energy + yukawa.energy,
+                               rtol=1e-5)
+
+    forces = lj_yukawa.forces
+    if forces is not None:
+        np.testing.assert_allclose(forces,
+                                   lj.forces + yukawa.forces,
+                                   rtol=1e-5,
+                                   atol=1e-6)
+
+
+@pytest.mark.parametrize("clusters", [False, True])
+def test_lj_yukawa_component_energies(simulation_factory,
+                                      lattice_snapshot_factory, clusters):
+    """Check the component energies tallied as the forces are computed.
+
+    The component energies are cached after each force computation, so they
+    must follow the energies of the separate potentials as the particles move.
+    """
+    lj_params = dict(epsilon=1.0, sigma=1.0)
+    yukawa_params = dict(epsilon=0.5, kappa=1.5)
+
+    lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    lj.params[('A', 'A')] = lj_params
+    yukawa = md.pair.Yukawa(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+    yukawa.params[('A', 'A')] = yukawa_params
+    lj_yukawa = md.pair.LJYukawa(nlist=md.nlist.Cell(buffer=0.4,
+                                                     clusters=clusters),
+                                 default_r_cut=2.5)
+    lj_yukawa.params[('A', 'A')] = dict(lj=lj_params, yukawa=yukawa_params)
+
+    snap = lattice_snapshot_factory(n=6, a=1.2, r=0.05)
+    sim = simulation_factory(snap)
+    integrator = md.Integrator(0.005, forces=[lj_yukawa])
+    integrator.methods.append(md.methods.ConstantVolume(hoomd.filter.All()))
+    sim.operations.integrator = integrator
+    sim.operations.computes.extend([lj, yukawa])
+
+    for _ in range(5):
+        sim.run(10)
+        lj_energy = lj_yukawa.lj_energy
+        yukawa_energy = lj_yukawa.yukawa_energy
+        np.testing.assert_allclose(lj_energy, lj.energy, rtol=1e-5)
+        np.testing.assert_allclose(yukawa_energy, yukawa.energy, rtol=1e-5)
+        np.testing.assert_allclose(lj_energy + yukawa_energy,
+                                   lj_yukawa.energy,
+                                   rtol=1e-5)
+
+
+def test_deferred_ghost_update(simulation_factory, lattice_snapshot_factory):
+    """Check pair forces computed while the ghost update is in flight.
+
+    With domain decomposition, the integrator computes the pair forces on the
+    interior particles before the ghost positions arrive. The forces after a run
+    must match those of a new simulation that exchanges the ghosts from scratch.
+    """
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+    sim = simulation_factory(snap)
+    if sim.device.communicator.num_ranks == 1:
+        pytest.skip("The ghost update is only deferred with MPI.")
+
+    def make_lj():
+        lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        return lj
+
+    lj = make_lj()
+    nve = md.methods.ConstantVolume(filter=hoomd.filter.All())
+    sim.operations.integrator = md.Integrator(dt=0.005,
+                                              methods=[nve],
+                                              forces=[lj])
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.0)
+    sim.run(50)
+    forces = lj.forces
+    energy = lj.energy
+
+    reference_lj = make_lj()
+    reference = simulation_factory(sim.state.get_snapshot())
+    reference.operations.integrator = md.Integrator(dt=0.005,
+                                                    forces=[reference_lj])
+    reference.run(0)
+
+    np.testing.assert_allclose(reference_lj.energy, energy, rtol=1e-5)
+    reference_forces = reference_lj.forces
+    if forces is not None:
+        np.testing.assert_allclose(reference_forces,
+                                   forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+@pytest.mark.gpu
+def test_gpu_aware_mpi_ghost_update(simulation_factory,
+                                    lattice_snapshot_factory):
+    """Check ghost updates that pass device pointers to MPI.
+
+    The communicator tunes between staging the ghost updates through host
+    memory (0) and passing the device buffers to a GPU-aware MPI (1). Both
+    must produce the same trajectory.
+    """
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+
+    def run(device_mpi):
+        sim = simulation_factory(snap)
+        lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        nve = md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.005,
+                                                  methods=[nve],
+                                                  forces=[lj])
+        sim.run(0)
+
+        communicator = sim._system_communicator
+        if communicator is None:
+            pytest.skip("Ghost updates require domain decomposition.")
+        key = 'comm_ghost_update_device_mpi'
+        if key not in communicator.getAutotunerParameters():
+            pytest.skip("MPI does not accept device pointers.")
+
+        communicator.setAutotunerParameters({key: (device_mpi,)})
+        sim.run(20)
+        assert communicator.getAutotunerParameters()[key] == (device_mpi,)
+        return lj.forces, lj.energy
+
+    host_forces, host_energy = run(0)
+    device_forces, device_energy = run(1)
+
+    np.testing.assert_allclose(device_energy, host_energy, rtol=1e-5)
+    if host_forces is not None:
+        np.testing.assert_allclose(device_forces,
+                                   host_forces,
+                                   rtol=1e-5,
+                                   atol=1e-5)
+
+
+@pytest.mark.cpu
+def test_shared_memory_ghost_update(simulation_factory,
+                                    lattice_snapshot_factory, monkeypatch):
+    """Check ghost updates through the MPI-3 shared memory window.
+
+    With HOOMD_MPI_SHARED_MEMORY=1, ranks on the same node exchange the ghost
+    positions and velocities through a shared memory window. The trajectory
+    must match the one with MPI messages.
+    """
+    snap = lattice_snapshot_factory(n=8, a=1.2, r=0.1)
+
+    def run(shared_memory):
+        monkeypatch.setenv('HOOMD_MPI_SHARED_MEMORY', shared_memory)
+        sim = simulation_factory(snap)
+        if sim.device.communicator.num_ranks == 1:
+            pytest.skip("Ghost updates require domain decomposition.")
+
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        # the DPD forces need the ghost velocities
+        dpd = md.pair.DPD(nlist=nlist, kT=1.0, default_r_cut=1.0)
+        dpd.params[('A', 'A')] = dict(A=0.0, gamma=1.0)
+        nve = md.methods.ConstantVolume(filter=hoomd.filter.All())
+        sim.operations.integrator = md.Integrator(dt=0.005,
+                                                  methods=[nve],
+                                                  forces=[lj, dpd])
+        sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(),
+                                              kT=1.0)
+        sim.run(20)
+        return lj.forces, dpd.forces, lj.energy
+
+    message_lj, message_dpd, message_energy = run('0')
+    shm_lj, shm_dpd, shm_energy = run('1')
+
+    np.testing.assert_allclose(shm_energy, message_energy, rtol=1e-5)
+    if message_lj is not None:
+        np.testing.assert_allclose(shm_lj, message_lj, rtol=1e-5, atol=1e-5)
+        np.testing.assert_allclose(shm_dpd,
+                                   message_dpd,
+                                   rtol=1e-5,
+                                   atol=1e-5)
@@ -69,6 +69,12 @@ def test_attach_detach(simulation_factory,
     coulomb.alpha = 1.5
     assert coulomb.alpha == 1.5
 
+    assert coulomb.box_tolerance == 0
+    coulomb.box_tolerance = 1e-3
+    assert coulomb.box_tolerance == 1e-3
+
+    assert not coulomb.pencil_fft
+
     # attached
     sim = simulation_factory(two_charged_particle_snapshot_factory())
     integrator = hoomd.md.Integrator(dt=0.005)
@@ -88,6 +94,10 @@ def test_attach_detach(simulation_factory,
     assert coulomb.alpha == 1.5
 
     assert ewald.params[('A', 'A')]['alpha'] == 1.5
+    assert coulomb.box_tolerance == 1e-3
+
+    coulomb.box_tolerance = 1e-2
+    assert coulomb.box_tolerance == 1e-2
 
     with pytest.raises(AttributeError):
         coulomb.resolution = (32, 32, 32)
@@ -163,3 +173,81 @@ def test_pppm_energy(simulation_factory, two_charged_particle_snapshot_factory):
     # The reference energy is from a LAMMPS simulation. The tolerance is large
     # as the PPPM parameters do not directly map between the two codes
     numpy.testing.assert_allclose(energy, -1.0021254, rtol=1e-2)
+
+
+def test_pppm_box_tolerance(simulation_factory,
+                            two_charged_particle_snapshot_factory):
+    """Test that rescaling the influence function reproduces the energy."""
+    energies = []
+    for box_tolerance in [0, 1e-2]:
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+            nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0)
+        coulomb.box_tolerance = box_tolerance
+
+        sim = simulation_factory(two_charged_particle_snapshot_factory())
+        integrator = hoomd.md.Integrator(dt=0.005)
+        integrator.forces.extend([ewald, coulomb])
+        sim.operations.integrator = integrator
+        sim.run(0)
+
+        box = sim.state.box
+        box.L = box.L * 1.002
+        sim.state.set_box(box)
+        sim.run(0)
+
+        energies.append(ewald.energy + coulomb.energy)
+
+    numpy.testing.assert_allclose(energies[1], energies[0], rtol=1e-4)
+
+
+def test_pppm_pencil_fft(simulation_factory,
+                         two_charged_particle_snapshot_factory):
+    """Test that the pencil decomposed FFT reproduces the default FFT."""
+    results = []
+    for pencil_fft in [False, True]:
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+            nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0)
+        coulomb.pencil_fft = pencil_fft
+
+        sim = simulation_factory(two_charged_particle_snapshot_factory())
+        integrator = hoomd.md.Integrator(dt=0.005)
+        integrator.forces.extend([ewald, coulomb])
+        sim.operations.integrator = integrator
+        sim.run(0)
+
+        assert coulomb.pencil_fft == pencil_fft
+        results.append((coulomb.energy, coulomb.forces))
+
+    numpy.testing.assert_allclose(results[1][0], results[0][0], rtol=1e-5)
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(results[1][1], results[0][1], atol=1e-5)
+
+
+def _pppm_forces(sim):
+    """Compute the PPPM forces, energies, and virials."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald, coulomb = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(32, 32, 32), order=5, r_cut=2.5, alpha=0)
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[ewald, coulomb])
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    return coulomb.forces, coulomb.energy, coulomb.virials
+
+
+def test_pppm_threads(compare_cpu_threads):
+    """Check that threaded PPPM forces match the serial evaluation."""
+    rng = numpy.random.default_rng(3)
+    snapshot = hoomd.Snapshot()
+    L = 12
+    N = 500
+    snapshot.configuration.box = [L, L, L, 0, 0, 0]
+    snapshot.particles.types = ['A']
+    snapshot.particles.N = N
+    snapshot.particles.position[:] = rng.uniform(-L / 2, L / 2, size=(N, 3))
+    snapshot.particles.charge[:] = numpy.tile([-1, 1], N // 2)
+
+    compare_cpu_threads(snapshot, _pppm_forces)
@@ -0,0 +1,174 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import pickling_check
+import itertools
+import math
+import pytest
+import numpy
+
+C6 = {'A': 4.0, 'B': 1.0}
+
+
+def _random_snapshot(N=20, L=6.0, d_min=1.0, seed=7):
+    """Place N particles of types A and B at least d_min apart."""
+    rng = numpy.random.default_rng(seed)
+    positions = []
+    while len(positions) < N:
+        trial = rng.uniform(-L / 2, L / 2, size=3)
+        dx = numpy.array(positions) - trial if positions else numpy.zeros(
+            (0, 3))
+        dx -= L * numpy.round(dx / L)
+        if numpy.all(numpy.linalg.norm(dx, axis=1) >= d_min):
+            positions.append(trial)
+
+    snapshot = hoomd.Snapshot()
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [L, L, L, 0, 0, 0]
+        snapshot.particles.types = ['A', 'B']
+        snapshot.particles.N = N
+        snapshot.particles.position[:] = positions
+        snapshot.particles.typeid[:] = numpy.arange(N) % 2
+        snapshot.bonds.types = ['b']
+        snapshot.bonds.N = 1
+        snapshot.bonds.group[0] = [0, 1]
+    return snapshot
+
+
+def _reference_forces(snapshot, r_cut, beta, n_images=3):
+    """Sum the long-range part beyond the cutoff directly over the images."""
+    L = snapshot.configuration.box[0]
+    pos = snapshot.particles.position
+    c = numpy.sqrt([C6[snapshot.particles.types[t]]
+                    for t in snapshot.particles.typeid])
+    N = len(pos)
+    r_max = (n_images - 0.5) * L
+
+    images = numpy.array(
+        list(itertools.product(range(-n_images, n_images + 1), repeat=3)))
+    energy = 0
+    forces = numpy.zeros((N, 3))
+    for i in range(N):
+        for j in range(N):
+            dx = pos[i] - pos[j]
+            dx -= L * numpy.round(dx / L)
+            dx = dx + L * images
+            rsq = numpy.sum(dx * dx, axis=1)
+            mask = (rsq >= r_cut * r_cut) & (rsq < r_max * r_max)
+            dx = dx[mask]
+            rsq = rsq[mask]
+
+            xsq = beta * beta * rsq
+            expfac = numpy.exp(-xsq)
+            u = (1 - expfac * (1 + xsq + 0.5 * xsq * xsq)) / rsq**3
+            force_divr = (6 * u - beta**6 * expfac) / rsq
+
+            # the pair potential is -c_i c_j u
+            energy -= 0.5 * c[i] * c[j] * numpy.sum(u)
+            forces[i] -= c[i] * c[j] * numpy.sum(force_divr[:, None] * dx,
+                                                 axis=0)
+
+    # homogeneous tail beyond r_max
+    energy -= 2 * math.pi / (3 * L**3 * r_max**3) * numpy.sum(c)**2
+    return energy, forces
+
+
+def _make_simulation(simulation_factory, snapshot, exclusions=('bond',)):
+    nlist = hoomd.md.nlist.Cell(buffer=0.4, exclusions=exclusions)
+    real_space, reciprocal_space = \
+        hoomd.md.long_range.pppm.make_pppm_dispersion_forces(
+            nlist=nlist, resolution=(32, 32, 32), order=5, r_cut=2.5)
+    reciprocal_space.c6.update(C6)
+
+    sim = simulation_factory(snapshot)
+    integrator = hoomd.md.Integrator(dt=0.005,
+                                     forces=[real_space, reciprocal_space])
+    sim.operations.integrator = integrator
+    sim.run(0)
+    return sim, real_space, reciprocal_space
+
+
+def test_attach(simulation_factory):
+    """Ensure that md.long_range.pppm.Dispersion can be attached."""
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    real_space, reciprocal_space = \
+        hoomd.md.long_range.pppm.make_pppm_dispersion_forces(
+            nlist=nlist, resolution=(16, 16, 16), order=5, r_cut=2.5)
+
+    assert real_space.nlist is nlist
+    assert reciprocal_space.nlist is nlist
+    assert reciprocal_space.resolution == (16, 16, 16)
+    assert reciprocal_space.order == 5
+    assert reciprocal_space.r_cut == 2.5
+
+    # the splitting parameter makes the real space term rtol at the cutoff
+    x = reciprocal_space.beta * 2.5
+    assert math.exp(-x * x) * (1 + x * x + x**4 / 2) == pytest.approx(1e-3)
+
+    reciprocal_space.c6.update(C6)
+    pickling_check(reciprocal_space)
+
+    sim = simulation_factory(_random_snapshot())
+    integrator = hoomd.md.Integrator(dt=0.005,
+                                     forces=[real_space, reciprocal_space])
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    assert reciprocal_space._attached
+    assert reciprocal_space.c6['A'] == pytest.approx(4.0)
+    assert real_space.params[('A', 'B')]['c6'] == pytest.approx(2.0)
+    assert real_space.params[('A', 'B')]['beta'] == pytest.approx(
+        reciprocal_space.beta)
+    assert real_space.r_cut[('A', 'B')] == 2.5
+
+    with pytest.raises(AttributeError):
+        reciprocal_space.order = 6
+
+
+@pytest.mark.serial
+def test_dispersion_direct_sum(simulation_factory):
+    """Compare the PPPM dispersion forces to a direct sum over the images."""
+    snapshot = _random_snapshot()
+    sim, real_space, reciprocal_space = _make_simulation(
+        simulation_factory, snapshot, exclusions=())
+
+    energy = real_space.energy + reciprocal_space.energy
+    forces = real_space.forces + reciprocal_space.forces
+
+    # the pair and mesh terms cancel inside the cutoff, what remains is the
+    # long-range part of the pairs beyond it
+    reference_energy, reference_forces = _reference_forces(
+        snapshot, r_cut=2.5, beta=reciprocal_space.beta)
+
+    numpy.testing.assert_allclose(energy, reference_energy, rtol=2e-3)
+    numpy.testing.assert_allclose(forces,
+                                  reference_forces,
+                                  atol=1e-2
+                                  * numpy.max(numpy.abs(reference_forces)))
+
+
+@pytest.mark.serial
+def test_dispersion_exclusions(simulation_factory):
+    """Excluded pairs inside the cutoff contribute nothing to the sum.
+
+    Particles 0 and 1 are bonded and closer than the cutoff. The mesh
+    correction for the excluded pair replaces the real space term, so the
+    result does not depend on the exclusion.
+    """
+    snapshot = _random_snapshot()
+    if snapshot.communicator.rank == 0:
+        L = snapshot.configuration.box[0]
+        position = snapshot.particles.position[0] + [1.1, 0, 0]
+        snapshot.particles.position[1] = position - L * numpy.round(
+            position / L)
+
+    results = []
+    for exclusions in [(), ('bond',)]:
+        sim, real_space, reciprocal_space = _make_simulation(
+            simulation_factory, snapshot, exclusions=exclusions)
+        results.append((real_space.energy + reciprocal_space.energy,
+                        real_space.forces + reciprocal_space.forces))
+
+    numpy.testing.assert_allclose(results[1][0], results[0][0], rtol=1e-6)
+    numpy.testing.assert_allclose(results[1][1], results[0][1], atol=1e-6)
@@ -0,0 +1,74 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import pytest
+
+import hoomd
+from hoomd import md
+
+
+@pytest.fixture
+def simulation(simulation_factory, lattice_snapshot_factory):
+    snapshot = lattice_snapshot_factory(a=1.5, n=6, r=0.05)
+    if snapshot.communicator.rank == 0:
+        N = snapshot.particles.N
+        snapshot.particles.charge[:] = [(-1)**i for i in range(N)]
+    return simulation_factory(snapshot)
+
+
+@pytest.fixture
+def pppm_forces():
+    nlist = md.nlist.Cell(buffer=0.4)
+    return md.long_range.pppm.make_pppm_coulomb_forces(nlist=nlist,
+                                                       resolution=(16, 16, 16),
+                                                       order=5,
+                                                       r_cut=2.0)
+
+
+def test_invalid_construction(pppm_forces):
+    ewald, coulomb = pppm_forces
+    with pytest.raises(ValueError):
+        md.tune.PPPMParameters(trigger=5,
+                               coulomb=coulomb,
+                               rms_error=1e-2,
+                               orders=[8])
+
+
+def test_tune(simulation, pppm_forces):
+    ewald, coulomb = pppm_forces
+    integrator = md.Integrator(
+        dt=0.001,
+        methods=[md.methods.ConstantVolume(hoomd.filter.All())],
+        forces=[ewald, coulomb])
+    simulation.operations.integrator = integrator
+
+    tuner = md.tune.PPPMParameters(trigger=2,
+                                   coulomb=coulomb,
+                                   rms_error=1e-2,
+                                   resolutions=[(8, 8, 8), (16, 16, 16)],
+                                   orders=[4, 5, 6])
+    assert tuner.rms_error == 1e-2
+    assert tuner.maximum_r_cut is None
+    assert tuner.candidates is None
+    simulation.operations.tuners.append(tuner)
+
+    assert not tuner.tuned
+    simulation.run(60)
+    assert tuner.tuned
+
+    candidates = tuner.candidates
+    assert len(candidates) > 0
+    for candidate in candidates:
+        assert candidate["tps"] is not None
+        assert candidate["r_cut"] <= 0.5 * 9 - 0.4
+
+    best = max(candidates, key=lambda c: c["tps"])
+    assert coulomb.resolution == best["resolution"]
+    assert coulomb.order == best["order"]
+    assert coulomb.r_cut == pytest.approx(best["r_cut"])
+    assert ewald.r_cut[("A", "A")] == pytest.approx(best["r_cut"])
+    assert ewald.params[("A", "A")]["kappa"] == pytest.approx(best["kappa"])
+    assert tuner.max_tps == pytest.approx(best["tps"])
+
+    # a tuned simulation continues to run
+    simulation.run(2)
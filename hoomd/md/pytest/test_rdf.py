@@ -0,0 +1,93 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd.error import DataAccessError
+from hoomd.logging import LoggerCategories
+import pytest
+import numpy as np
+
+
+def _make_rdf(r_max=2.55, bins=17):
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    return hoomd.md.compute.RadialDistributionFunction(
+        trigger=hoomd.trigger.Periodic(5), nlist=nlist, r_max=r_max, bins=bins)
+
+
+def test_before_attaching():
+    rdf = _make_rdf()
+    assert rdf.r_max == 2.55
+    assert rdf.bins == 17
+    np.testing.assert_allclose(rdf.bin_centers,
+                               np.arange(17) * 0.15 + 0.075,
+                               rtol=1e-6)
+
+    with pytest.raises(DataAccessError):
+        rdf.rdf
+    with pytest.raises(DataAccessError):
+        rdf.num_samples
+
+
+@pytest.mark.parametrize("dimensions", [2, 3])
+def test_lattice(simulation_factory, lattice_snapshot_factory, dimensions):
+    snapshot = lattice_snapshot_factory(dimensions=dimensions, a=2.0, n=6)
+    sim = simulation_factory(snapshot)
+    rdf = _make_rdf()
+    sim.operations.writers.append(rdf)
+
+    sim.run(10)
+    assert rdf.num_samples == 2
+
+    g = rdf.rdf
+    if sim.device.communicator.rank == 0:
+        # each particle has 2 * dimensions nearest neighbors at r = 2,
+        # which falls in bin 13
+        N = 6**dimensions
+        r_low = 13 * 0.15
+        r_high = 14 * 0.15
+        if dimensions == 2:
+            volume = 12.0**2
+            shell = np.pi * (r_high**2 - r_low**2)
+        else:
+            volume = 12.0**3
+            shell = 4 / 3 * np.pi * (r_high**3 - r_low**3)
+
+        expected = np.zeros(17)
+        expected[13] = 2 * dimensions * volume / ((N - 1) * shell)
+        np.testing.assert_allclose(g, expected, rtol=1e-5)
+    else:
+        assert g is None
+
+    # changing the parameters discards the samples
+    rdf.bins = 10
+    assert rdf.num_samples == 0
+    sim.run(5)
+    assert rdf.num_samples == 1
+
+    rdf.reset()
+    assert rdf.num_samples == 0
+
+
+def test_pickling(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    rdf = _make_rdf()
+    operation_pickling_check(rdf, sim)
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.RadialDistributionFunction, ('md', 'compute'), {
+            'rdf': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'bin_centers': {
+                'category': LoggerCategories.sequence,
+                'default': True
+            },
+            'num_samples': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            }
+        })
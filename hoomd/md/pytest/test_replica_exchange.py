@@ -0,0 +1,90 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import pytest
+
+
+def _make_simulation(device, replica_exchange):
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+        snapshot.particles.N = 2
+        snapshot.particles.types = ['A']
+        snapshot.particles.position[:] = [[0, 0, 0], [1.2, 0, 0]]
+        snapshot.particles.velocity[:] = [[1, 0, 0], [-1, 0, 0]]
+
+    sim = hoomd.Simulation(device=device, seed=device.communicator.partition)
+    sim.create_state_from_snapshot(snapshot)
+
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    lj.r_cut[('A', 'A')] = 2.5
+    bussi = hoomd.md.methods.thermostats.Bussi(
+        kT=replica_exchange.replica_kT)
+    nvt = hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All(),
+                                          thermostat=bussi)
+    sim.operations.integrator = hoomd.md.Integrator(dt=0.005,
+                                                    methods=[nvt],
+                                                    forces=[lj])
+    sim.operations.updaters.append(replica_exchange)
+    return sim
+
+
+def test_before_attaching():
+    trigger = hoomd.trigger.Periodic(100)
+    replica_exchange = hoomd.md.update.ReplicaExchange(trigger,
+                                                       kT=[1.0, 1.5])
+    assert replica_exchange.trigger is trigger
+    assert replica_exchange.kT == (1.0, 1.5)
+    assert replica_exchange.replica_kT.value == 1.0
+
+    with pytest.raises(hoomd.error.DataAccessError):
+        replica_exchange.replica_index
+
+    with pytest.raises(ValueError):
+        hoomd.md.update.ReplicaExchange(trigger, kT=[])
+
+
+def test_one_temperature_per_partition(device):
+    num_partitions = device.communicator.num_partitions
+    kT = [1.0 + 0.5 * i for i in range(num_partitions + 1)]
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        hoomd.trigger.Periodic(1), kT=kT)
+    sim = _make_simulation(device, replica_exchange)
+
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+
+def test_single_partition(device):
+    num_partitions = device.communicator.num_partitions
+    kT = [1.0 + 0.5 * i for i in range(num_partitions)]
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        hoomd.trigger.Periodic(1), kT=kT)
+    sim = _make_simulation(device, replica_exchange)
+    sim.run(10)
+
+    partition = device.communicator.partition
+    assert replica_exchange.replica_kT.value == kT[partition]
+    assert replica_exchange.replica_index == partition
+    assert replica_exchange.num_swaps_attempted == 10 * (num_partitions // 2)
+
+
+def test_swap_between_partitions():
+    world = hoomd.communicator.Communicator()
+    if world.num_ranks != 2:
+        pytest.skip("Requires 2 MPI ranks.")
+
+    communicator = hoomd.communicator.Communicator(ranks_per_partition=1)
+    device = hoomd.device.CPU(communicator=communicator)
+
+    # Equal temperatures accept every swap.
+    replica_exchange = hoomd.md.update.ReplicaExchange(
+        hoomd.trigger.Periodic(1), kT=[1.0, 1.0])
+    sim = _make_simulation(device, replica_exchange)
+    sim.run(3)
+
+    assert replica_exchange.num_swaps_attempted == 2
+    assert replica_exchange.num_swaps_accepted == 2
+    assert replica_exchange.replica_index == communicator.partition
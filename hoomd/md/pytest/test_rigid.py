@@ -413,3 +413,47 @@ def test_rigid_dof(lattice_snapshot_factory, simulation_factory,
     assert thermo_central_free.translational_degrees_of_freedom == (
         n_bodies + n_free) * 3
     assert thermo_constituent.translational_degrees_of_freedom == 0
+
+
+def _run_rigid_bodies(sim, body_definition):
+    """Run a rigid body simulation."""
+    rigid = md.constrain.Rigid()
+    rigid.body["A"] = body_definition
+    rigid.create_bodies(sim.state)
+
+    lj = hoomd.md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), mode="shift")
+    lj.params.default = {"epsilon": 1.0, "sigma": 1}
+    lj.r_cut.default = 2**(1.0 / 6.0)
+    nve = md.methods.ConstantVolume(filter=hoomd.filter.Rigid())
+    sim.operations.integrator = md.Integrator(dt=0.001,
+                                              methods=[nve],
+                                              forces=[lj],
+                                              integrate_rotational_dof=True,
+                                              rigid=rigid)
+    sim.always_compute_pressure = True
+    sim.run(5)
+
+    snapshot = sim.state.get_snapshot()
+    return (snapshot.particles.position, snapshot.particles.orientation,
+            rigid.forces, rigid.torques, rigid.virials)
+
+
+def test_threaded_rigid_bodies(lattice_snapshot_factory, valid_body_definition,
+                               compare_cpu_threads):
+    """Check that threaded rigid body updates match the serial code."""
+    snapshot = lattice_snapshot_factory(particle_types=["A", "B"],
+                                        a=4.0,
+                                        n=5,
+                                        r=0.1)
+    snapshot.particles.moment_inertia[:] = (2.0, 2.0, 2.0)
+    rng = np.random.default_rng(7)
+    orientation = rng.normal(size=(snapshot.particles.N, 4))
+    snapshot.particles.orientation[:] = (
+        orientation / np.linalg.norm(orientation, axis=1, keepdims=True))
+    snapshot.particles.velocity[:] = rng.normal(size=(snapshot.particles.N,
+                                                      3))
+
+    compare_cpu_threads(
+        snapshot,
+        lambda sim: _run_rigid_bodies(sim, valid_body_definition),
+        seed=2)
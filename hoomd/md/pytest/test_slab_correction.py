@@ -0,0 +1,83 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import math
+import numpy
+import pytest
+
+
+def _make_simulation(simulation_factory, two_particle_snapshot_factory, charge,
+                     L):
+    snapshot = two_particle_snapshot_factory(L=L)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.position[:] = [[0, 0, -1], [0, 0, 1]]
+        snapshot.particles.charge[:] = charge
+
+    sim = simulation_factory(snapshot)
+    correction = hoomd.md.long_range.slab.DipoleCorrection()
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[correction])
+    sim.operations.integrator = integrator
+    sim.run(0)
+    return sim, correction
+
+
+def test_neutral(simulation_factory, two_particle_snapshot_factory):
+    """Test the correction for a dipole along z."""
+    L = 20
+    sim, correction = _make_simulation(simulation_factory,
+                                       two_particle_snapshot_factory,
+                                       charge=[-1, 1],
+                                       L=L)
+    prefactor = 2 * math.pi / L**3
+
+    energies = correction.energies
+    forces = correction.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(energies, [2 * prefactor, 2 * prefactor],
+                                      rtol=1e-5)
+        numpy.testing.assert_allclose(
+            forces, [[0, 0, 4 * prefactor], [0, 0, -4 * prefactor]],
+            rtol=1e-5,
+            atol=1e-12)
+
+    assert correction.additional_energy == pytest.approx(0)
+    assert correction.energy == pytest.approx(4 * prefactor, rel=1e-5)
+
+
+def test_non_neutral(simulation_factory, two_particle_snapshot_factory):
+    """Test the net charge terms of the correction."""
+    L = 20
+    sim, correction = _make_simulation(simulation_factory,
+                                       two_particle_snapshot_factory,
+                                       charge=[1, 1],
+                                       L=L)
+    prefactor = 2 * math.pi / L**3
+
+    energies = correction.energies
+    forces = correction.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(energies,
+                                      [-2 * prefactor, -2 * prefactor],
+                                      rtol=1e-5)
+        numpy.testing.assert_allclose(
+            forces, [[0, 0, -4 * prefactor], [0, 0, 4 * prefactor]],
+            rtol=1e-5,
+            atol=1e-12)
+
+    additional_energy = -prefactor * 4 * L**2 / 12
+    assert correction.additional_energy == pytest.approx(additional_energy,
+                                                         rel=1e-5)
+    assert correction.energy == pytest.approx(-4 * prefactor
+                                              + additional_energy,
+                                              rel=1e-5)
+
+
+def test_2d(simulation_factory, two_particle_snapshot_factory):
+    """Test that the correction requires a 3D box."""
+    sim = simulation_factory(two_particle_snapshot_factory(dimensions=2))
+    correction = hoomd.md.long_range.slab.DipoleCorrection()
+    integrator = hoomd.md.Integrator(dt=0.005, forces=[correction])
+    sim.operations.integrator = integrator
+    with pytest.raises(ValueError):
+        sim.run(0)
@@ -0,0 +1,85 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+from hoomd.conftest import operation_pickling_check, logging_check
+from hoomd.error import DataAccessError
+from hoomd.logging import LoggerCategories
+import pytest
+import numpy as np
+
+
+def _make_steinhardt(r_max=2.5, l=6):  # noqa: E741 - allow l as a name
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    return hoomd.md.compute.Steinhardt(nlist=nlist, r_max=r_max, l=l)
+
+
+def test_before_attaching():
+    steinhardt = _make_steinhardt()
+    assert steinhardt.r_max == 2.5
+    assert steinhardt.l == 6
+
+    with pytest.raises(DataAccessError):
+        steinhardt.order
+    with pytest.raises(DataAccessError):
+        steinhardt.particle_order
+
+
+# q_l of the 6 nearest neighbors in the simple cubic lattice
+@pytest.mark.parametrize("l, q_l", [(4, 0.763763), (6, 0.353553)])
+def test_simple_cubic(simulation_factory, lattice_snapshot_factory, l, q_l):
+    snapshot = lattice_snapshot_factory(a=2.0, n=6)
+    sim = simulation_factory(snapshot)
+    steinhardt = _make_steinhardt(l=l)
+    sim.operations.computes.append(steinhardt)
+    sim.run(0)
+
+    np.testing.assert_allclose(steinhardt.order, q_l, rtol=1e-5)
+
+    particle_order = steinhardt.particle_order
+    num_neighbors = steinhardt.particle_num_neighbors
+    local_density = steinhardt.particle_local_density
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(particle_order, q_l, rtol=1e-5)
+        np.testing.assert_array_equal(num_neighbors, 6)
+        np.testing.assert_allclose(local_density,
+                                   6 / (4 / 3 * np.pi * 2.5**3),
+                                   rtol=1e-6)
+    else:
+        assert particle_order is None
+        assert num_neighbors is None
+        assert local_density is None
+
+    # include the second neighbor shell at sqrt(2) a
+    steinhardt.r_max = 3.0
+    num_neighbors = steinhardt.particle_num_neighbors
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_array_equal(num_neighbors, 18)
+
+
+def test_pickling(simulation_factory, two_particle_snapshot_factory):
+    sim = simulation_factory(two_particle_snapshot_factory())
+    steinhardt = _make_steinhardt()
+    operation_pickling_check(steinhardt, sim)
+
+
+def test_logging():
+    logging_check(
+        hoomd.md.compute.Steinhardt, ('md', 'compute'), {
+            'order': {
+                'category': LoggerCategories.scalar,
+                'default': True
+            },
+            'particle_order': {
+                'category': LoggerCategories.particle,
+                'default': True
+            },
+            'particle_num_neighbors': {
+                'category': LoggerCategories.particle,
+                'default': True
+            },
+            'particle_local_density': {
+                'category': LoggerCategories.particle,
+                'default': True
+            }
+        })
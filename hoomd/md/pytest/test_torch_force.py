@@ -0,0 +1,86 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import numpy as np
+import numpy.testing as npt
+import pytest
+
+import hoomd
+from hoomd import md
+
+try:
+    import torch
+    TORCH_IMPORTED = True
+except ImportError:
+    TORCH_IMPORTED = False
+
+K = 10.0
+R_CUT = 1.0
+
+
+def _save_harmonic_model(path, dtype):
+    """Save a soft harmonic repulsion as a TorchScript model."""
+
+    class Harmonic(torch.nn.Module):
+
+        def forward(self, types: torch.Tensor, pairs: torch.Tensor,
+                    dr: torch.Tensor, n_local: int) -> torch.Tensor:
+            r = torch.linalg.norm(dr, dim=1)
+            overlap = torch.clamp(R_CUT - r, min=0.0)
+            # each pair is listed once for each local particle
+            pair_energy = 0.5 * 0.5 * K * overlap * overlap
+            energy = torch.zeros(n_local, dtype=dr.dtype, device=dr.device)
+            return energy.index_add(0, pairs[:, 0], pair_energy)
+
+    torch.jit.script(Harmonic().to(dtype)).save(str(path))
+
+
+def test_unavailable(simulation_factory, two_particle_snapshot_factory,
+                     tmp_path):
+    if hoomd.version.torch_enabled:
+        pytest.skip("HOOMD-blue is built with ENABLE_TORCH=on")
+
+    force = md.force.Torch(nlist=md.nlist.Cell(buffer=0.4),
+                           filename=str(tmp_path / 'model.pt'),
+                           r_cut=R_CUT)
+    sim = simulation_factory(two_particle_snapshot_factory(d=0.5))
+    sim.operations.integrator = md.Integrator(dt=0.005, forces=[force])
+    with pytest.raises(RuntimeError):
+        sim.run(0)
+
+
+@pytest.mark.parametrize("d", [0.5, 0.8, 1.2])
+def test_harmonic_model(simulation_factory, two_particle_snapshot_factory,
+                        tmp_path, d):
+    if not hoomd.version.torch_enabled:
+        pytest.skip("HOOMD-blue is built without ENABLE_TORCH")
+    if not TORCH_IMPORTED:
+        pytest.skip("torch is not installed")
+
+    if hoomd.version.floating_point_precision[0] == 64:
+        dtype = torch.float64
+    else:
+        dtype = torch.float32
+    filename = tmp_path / 'model.pt'
+    sim = simulation_factory(two_particle_snapshot_factory(d=d))
+    _save_harmonic_model(filename, dtype)
+
+    force = md.force.Torch(nlist=md.nlist.Cell(buffer=0.4),
+                           filename=str(filename),
+                           r_cut=R_CUT)
+    sim.operations.integrator = md.Integrator(dt=0.005, forces=[force])
+    sim.run(0)
+
+    overlap = max(R_CUT - d, 0.0)
+    energies = force.energies
+    forces = force.forces
+    if sim.device.communicator.rank == 0:
+        npt.assert_allclose(energies, [0.25 * K * overlap**2] * 2, atol=1e-5)
+        # particle 0 is at -d/2 and is pushed in -x
+        npt.assert_allclose(forces, [[-K * overlap, 0, 0], [K * overlap, 0, 0]],
+                            atol=1e-5)
+        npt.assert_allclose(np.sum(energies), force.energy, atol=1e-5)
+
+    assert force.filename == str(filename)
+    force.r_cut = 2.0
+    assert force.r_cut == 2.0
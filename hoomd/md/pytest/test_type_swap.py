@@ -0,0 +1,136 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import hoomd
+import numpy
+import pytest
+
+
+def _make_simulation(simulation_factory, lattice_snapshot_factory, epsilon_ab):
+    snapshot = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                        a=1.2,
+                                        n=9,
+                                        r=0.05)
+    if snapshot.communicator.rank == 0:
+        snapshot.particles.typeid[::2] = 1
+    sim = simulation_factory(snapshot)
+
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    lj.params[('B', 'B')] = dict(epsilon=1, sigma=1)
+    lj.params[('A', 'B')] = dict(epsilon=epsilon_ab, sigma=1)
+    lj.r_cut[('A', 'A')] = 2.5
+    lj.r_cut[('B', 'B')] = 2.5
+    lj.r_cut[('A', 'B')] = 2.5
+    sim.operations.integrator = hoomd.md.Integrator(
+        dt=0.001,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())],
+        forces=[lj])
+    return sim, lj
+
+
+def _type_counts(sim):
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        return numpy.bincount(snapshot.particles.typeid, minlength=2)
+    return None
+
+
+def test_before_attaching():
+    lj = hoomd.md.pair.LJ(nlist=hoomd.md.nlist.Cell(buffer=0.4))
+    trigger = hoomd.trigger.Periodic(10)
+    type_swap = hoomd.md.update.TypeSwap(trigger,
+                                         forces=[lj],
+                                         types=['A', 'B'],
+                                         kT=1.5,
+                                         trials=20)
+    assert type_swap.trigger is trigger
+    assert type_swap.forces == (lj,)
+    assert type_swap.types == ('A', 'B')
+    assert type_swap.kT == hoomd.variant.Constant(1.5)
+    assert type_swap.trials == 20
+    assert type_swap.mu is None
+
+    type_swap.mu = {'A': 0, 'B': 1}
+    assert type_swap.mu == {'A': 0.0, 'B': 1.0}
+
+    with pytest.raises(hoomd.error.DataAccessError):
+        type_swap.num_accepted
+
+    with pytest.raises(ValueError):
+        hoomd.md.update.TypeSwap(trigger, forces=[lj], types=['A'], kT=1.0)
+
+
+def test_swap_keeps_composition(simulation_factory, lattice_snapshot_factory):
+    sim, lj = _make_simulation(simulation_factory,
+                               lattice_snapshot_factory,
+                               epsilon_ab=0.5)
+    type_swap = hoomd.md.update.TypeSwap(hoomd.trigger.Periodic(1),
+                                         forces=[lj],
+                                         types=['A', 'B'],
+                                         kT=1.0,
+                                         trials=10)
+    sim.operations.updaters.append(type_swap)
+
+    counts_before = _type_counts(sim)
+    sim.run(10)
+    counts_after = _type_counts(sim)
+
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_array_equal(counts_before, counts_after)
+    assert 0 <= type_swap.num_accepted <= type_swap.num_attempted
+    if sim.device.communicator.num_ranks == 1:
+        # the GPU attempts whole rounds of checkerboard moves
+        if isinstance(sim.device, hoomd.device.CPU):
+            assert type_swap.num_attempted == 100
+        else:
+            assert type_swap.num_attempted >= 100
+
+
+def test_identical_types_accept(simulation_factory, lattice_snapshot_factory):
+    sim, lj = _make_simulation(simulation_factory,
+                               lattice_snapshot_factory,
+                               epsilon_ab=1.0)
+    type_swap = hoomd.md.update.TypeSwap(hoomd.trigger.Periodic(1),
+                                         forces=[lj],
+                                         types=['A', 'B'],
+                                         kT=1.0,
+                                         trials=10,
+                                         mu={
+                                             'A': 0,
+                                             'B': 0
+                                         })
+    sim.operations.updaters.append(type_swap)
+    sim.run(5)
+
+    # the types interact identically, so no move changes the energy
+    assert type_swap.num_accepted == type_swap.num_attempted
+
+
+def test_semi_grand_composition(simulation_factory, lattice_snapshot_factory):
+    sim, lj = _make_simulation(simulation_factory,
+                               lattice_snapshot_factory,
+                               epsilon_ab=1.0)
+    type_swap = hoomd.md.update.TypeSwap(hoomd.trigger.Periodic(1),
+                                         forces=[lj],
+                                         types=['A', 'B'],
+                                         kT=1.0,
+                                         trials=50,
+                                         mu={
+                                             'A': 0,
+                                             'B': 20
+                                         })
+    sim.operations.updaters.append(type_swap)
+
+    counts_before = _type_counts(sim)
+    sim.run(10)
+    counts_after = _type_counts(sim)
+
+    # a large chemical potential of B converts A particles to B, ranks of a
+    # small decomposed box may have no particles far enough from the domain
+    # boundaries to attempt moves
+    if sim.device.communicator.rank == 0:
+        assert counts_after[1] >= counts_before[1]
+        assert counts_after.sum() == counts_before.sum()
+        if sim.device.communicator.num_ranks == 1:
+            assert counts_after[1] > counts_before[1]
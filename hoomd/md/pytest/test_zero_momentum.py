@@ -55,3 +55,27 @@ def test_momentum_is_zero(simulation_factory, two_particle_snapshot_factory):
         for i in range(3):
             pi = sum([m * v[i] for m, v in zip(masses, velocities)])
             np.testing.assert_allclose(pi, 0, atol=1e-5)
+
+
+def test_zero_momentum_values(simulation_factory, lattice_snapshot_factory):
+    snap = lattice_snapshot_factory(n=4, a=2)
+    if snap.communicator.rank == 0:
+        rng = np.random.default_rng(7)
+        snap.particles.velocity[:] = rng.normal(size=(snap.particles.N, 3))
+        snap.particles.mass[:] = rng.uniform(0.5, 2, size=snap.particles.N)
+        masses = np.array(snap.particles.mass)
+        velocities = np.array(snap.particles.velocity)
+        p = np.sum(masses[:, np.newaxis] * velocities, axis=0)
+        expected = velocities - p / snap.particles.N / masses[:, np.newaxis]
+    sim = simulation_factory(snap)
+
+    zm = hoomd.md.update.ZeroMomentum(hoomd.trigger.Periodic(1))
+    sim.operations.updaters.append(zm)
+    sim.run(1)
+
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        np.testing.assert_allclose(snap.particles.velocity,
+                                   expected,
+                                   rtol=1e-5,
+                                   atol=1e-5)
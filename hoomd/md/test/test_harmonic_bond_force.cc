@@ -451,6 +451,36 @@ void bond_force_comparison_tests(bondforce_creator bf_creator1,
         }
     }
 
+//! Compare computeEnergy() with the energy summed from the force computation
+void bond_energy_tests(bondforce_creator bf_creator,
+                       std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    const unsigned int N = 1000;
+
+    RandomInitializer rand_init(N, Scalar(0.2), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap = rand_init.getSnapshot();
+    snap->bond_data.type_mapping.push_back("A");
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    std::shared_ptr<PotentialBondHarmonic> fc = bf_creator(sysdef);
+    fc->setParams(0, harmonic_params(Scalar(300.0), Scalar(1.6)));
+    for (unsigned int i = 0; i < N - 1; i++)
+        {
+        sysdef->getBondData()->addBondedGroup(Bond(0, i, i + 1));
+        }
+
+    fc->compute(0);
+    Scalar energy = fc->calcEnergySum();
+    MY_CHECK_CLOSE(fc->computeEnergy(0), energy, tol);
+
+    // the energy only path evaluates the new bond, but does not modify the forces
+    sysdef->getBondData()->addBondedGroup(Bond(0, 0, N - 1));
+    Scalar new_energy = fc->computeEnergy(0);
+    MY_CHECK_CLOSE(fc->calcEnergySum(), energy, tol);
+    fc->compute(1);
+    MY_CHECK_CLOSE(new_energy, fc->calcEnergySum(), tol);
+    }
+
 //! PotentialBondHarmonic creator for bond_force_basic_tests()
 std::shared_ptr<PotentialBondHarmonic>
 base_class_bf_creator(std::shared_ptr<SystemDefinition> sysdef)
@@ -475,6 +505,15 @@ UP_TEST(PotentialBondHarmonic_basic)
                                new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! test case for the bond energy on the CPU
+UP_TEST(PotentialBondHarmonic_energy)
+    {
+    bondforce_creator bf_creator = bind(base_class_bf_creator, _1);
+    bond_energy_tests(bf_creator,
+                      std::shared_ptr<ExecutionConfiguration>(
+                          new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_HIP
 //! test case for bond forces on the GPU
 UP_TEST(PotentialBondHarmonicGPU_basic)
@@ -0,0 +1,139 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifdef ENABLE_MPI
+
+#include "hoomd/test/upp11_config.h"
+HOOMD_UP_MAIN()
+
+#include "hoomd/System.h"
+
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "hoomd/md/PencilFFT.h"
+
+using namespace hoomd;
+using namespace hoomd::md;
+
+//! Value of the test mesh at a global mesh point
+std::complex<double> mesh_value(unsigned int x, unsigned int y, unsigned int z)
+    {
+    return std::complex<double>(sin(0.3 * x + 0.7 * y) + 0.1 * z, cos(0.5 * z - 0.2 * x));
+    }
+
+//! Compare the pencil FFT to a direct transform, and the inverse to the input
+void test_pencil_fft_transform(std::shared_ptr<ExecutionConfiguration> exec_conf)
+    {
+    std::shared_ptr<SystemDefinition> sysdef(
+        new SystemDefinition(8, BoxDim(2.0), 1, 0, 0, 0, 0, exec_conf));
+    std::shared_ptr<ParticleData> pdata(sysdef->getParticleData());
+
+    std::shared_ptr<DomainDecomposition> decomposition(
+        new DomainDecomposition(exec_conf, pdata->getBox().getL()));
+    pdata->setDomainDecomposition(decomposition);
+
+    const Index3D& di = decomposition->getDomainIndexer();
+    uint3 pos = decomposition->getGridPos();
+
+    // a different number of points along every direction, with one ghost cell
+    uint3 dim = make_uint3(4, 2, 3);
+    uint3 embed = make_uint3(dim.x + 2, dim.y + 2, dim.z + 2);
+    unsigned int ghost_offset = (embed.y + 1) * embed.x + 1;
+    uint3 global_dim = make_uint3(dim.x * di.getW(), dim.y * di.getH(), dim.z * di.getD());
+
+    PencilFFT fft(sysdef, dim, embed);
+    uint2 pencil_grid = fft.getPencilGrid();
+    UP_ASSERT_EQUAL(pencil_grid.x * pencil_grid.y, exec_conf->getNRanks());
+
+    // fill the inner cells with the test mesh and the ghost cells with a marker value
+    std::vector<kiss_fft_cpx> mesh(embed.x * embed.y * embed.z);
+    for (auto& v : mesh)
+        {
+        v.r = -1234;
+        v.i = -1234;
+        }
+
+    for (unsigned int n = 0; n < dim.z; n++)
+        for (unsigned int m = 0; m < dim.y; m++)
+            for (unsigned int l = 0; l < dim.x; l++)
+                {
+                std::complex<double> v
+                    = mesh_value(pos.x * dim.x + l, pos.y * dim.y + m, pos.z * dim.z + n);
+                kiss_fft_cpx& c = mesh[ghost_offset + l + embed.x * (m + embed.y * n)];
+                c.r = float(v.real());
+                c.i = float(v.imag());
+                }
+
+    std::vector<kiss_fft_cpx> fourier(dim.x * dim.y * dim.z);
+    fft.forward(mesh.data(), fourier.data());
+
+    // the output is in the cyclic layout
+    for (unsigned int n = 0; n < dim.z; n++)
+        for (unsigned int m = 0; m < dim.y; m++)
+            for (unsigned int l = 0; l < dim.x; l++)
+                {
+                unsigned int kx = l * di.getW() + pos.x;
+                unsigned int ky = m * di.getH() + pos.y;
+                unsigned int kz = n * di.getD() + pos.z;
+
+                std::complex<double> ref(0.0, 0.0);
+                for (unsigned int z = 0; z < global_dim.z; z++)
+                    for (unsigned int y = 0; y < global_dim.y; y++)
+                        for (unsigned int x = 0; x < global_dim.x; x++)
+                            {
+                            double phase = -2.0 * M_PI
+                                           * (double(kx * x) / global_dim.x
+                                              + double(ky * y) / global_dim.y
+                                              + double(kz * z) / global_dim.z);
+                            ref += mesh_value(x, y, z)
+                                   * std::complex<double>(cos(phase), sin(phase));
+                            }
+
+                kiss_fft_cpx c = fourier[l + dim.x * (m + dim.y * n)];
+                MY_CHECK_SMALL(c.r - ref.real(), 1e-3);
+                MY_CHECK_SMALL(c.i - ref.imag(), 1e-3);
+                }
+
+    // the unnormalized inverse transform returns the input times the number of mesh points
+    std::vector<kiss_fft_cpx> mesh_back(mesh.size());
+    for (auto& v : mesh_back)
+        {
+        v.r = -1234;
+        v.i = -1234;
+        }
+    fft.inverse(fourier.data(), mesh_back.data() + ghost_offset);
+
+    double n_points = global_dim.x * global_dim.y * global_dim.z;
+    for (unsigned int n = 0; n < embed.z; n++)
+        for (unsigned int m = 0; m < embed.y; m++)
+            for (unsigned int l = 0; l < embed.x; l++)
+                {
+                kiss_fft_cpx c = mesh_back[l + embed.x * (m + embed.y * n)];
+                bool inner = l >= 1 && l <= dim.x && m >= 1 && m <= dim.y && n >= 1 && n <= dim.z;
+                if (inner)
+                    {
+                    std::complex<double> v = mesh_value(pos.x * dim.x + l - 1,
+                                                        pos.y * dim.y + m - 1,
+                                                        pos.z * dim.z + n - 1);
+                    MY_CHECK_SMALL(c.r / n_points - v.real(), 1e-4);
+                    MY_CHECK_SMALL(c.i / n_points - v.imag(), 1e-4);
+                    }
+                else
+                    {
+                    // ghost cells are not written
+                    UP_ASSERT_EQUAL(c.r, -1234);
+                    UP_ASSERT_EQUAL(c.i, -1234);
+                    }
+                }
+    }
+
+//! Test the pencil decomposed FFT on the CPU
+UP_TEST(PencilFFT_transform)
+    {
+    test_pencil_fft_transform(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
+#endif // ENABLE_MPI
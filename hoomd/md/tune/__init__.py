@@ -3,4 +3,5 @@
 
 """Tuners for the MD subpackage."""
 
-from .nlist_buffer import NeighborListBuffer
+from .nlist_buffer import NeighborListBuffer, NeighborListPairBuffer
+from .pppm import PPPMParameters
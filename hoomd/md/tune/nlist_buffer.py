@@ -1,7 +1,8 @@
 # Copyright (c) 2009-2024 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
-"""Provide a tuner for `hoomd.md.nlist.NeighborList.buffer`."""
+"""Provide tuners for `hoomd.md.nlist.NeighborList.buffer` and \
+`hoomd.md.nlist.NeighborList.pair_buffer`."""
 
 import copy
 import typing
@@ -338,3 +339,197 @@ class NeighborListBuffer(hoomd.tune.custom_tuner._InternalCustomTuner):
             hoomd.tune.GridOptimizer(n_bins, n_rounds, True),
             maximum_buffer=maximum_buffer,
         )
+
+
+class _NeighborListPairBufferInternal(hoomd.custom._InternalAction):
+    _skip_for_equality = {"_simulation", "_tunables"}
+
+    def __init__(
+        self,
+        nlist: NeighborList,
+        solver: hoomd.tune.solve.Optimizer,
+        minimum_buffer: float = 0.0,
+    ):
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            nlist=SetOnce(NeighborList),
+            solver=SetOnce(hoomd.tune.solve.Optimizer),
+            minimum_buffer=OnlyTypes(float))
+        param_dict.update({
+            "nlist": nlist,
+            "solver": solver,
+            "minimum_buffer": minimum_buffer
+        })
+        self._param_dict.update(param_dict)
+
+        self._simulation = None
+        self._tuned = 0
+        self._tunables = []
+        self._pairs = []
+        self._pair_index = 0
+
+        # Setup default log values
+        self._last_tps = 0.0
+        self._max_tps = 0.0
+        self._best_pair_buffers = {}
+
+    def act(self, timestep: int):
+        if self.tuned:
+            return
+
+        # tune one type pair at a time so that TPS changes can be attributed
+        # to a single buffer
+        tunable = self._tunables[self._pair_index]
+        pair = self._pairs[self._pair_index]
+        tps = tunable.y
+        if tps is not None:
+            self._last_tps = tps
+            if tps > self._max_tps:
+                self._best_pair_buffers[pair] = tunable.x
+                self._max_tps = tps
+        if self.solver.solve([tunable]):
+            self._tuned += 1
+        else:
+            self._tuned = 0
+
+        if self._tuned > 1:
+            self._tuned = 0
+            self._max_tps = 0.0
+            self._pair_index += 1
+
+    def attach(self, simulation):
+        self._simulation = simulation
+        types = simulation.state.particle_types
+        self._pairs = [(a, b) for i, a in enumerate(types) for b in types[i:]]
+        self._tunables = [self._make_tunable(pair) for pair in self._pairs]
+        self._pair_index = 0
+
+    def _make_tunable(self, pair):
+        return hoomd.tune.ManualTuneDefinition(
+            get_y=_IntervalTPS(self._simulation),
+            target=0.0,
+            get_x=lambda: self._get_pair_buffer(pair),
+            set_x=lambda x: self._set_pair_buffer(pair, x),
+            domain=(self.minimum_buffer, self.nlist.buffer),
+        )
+
+    def _get_pair_buffer(self, pair):
+        pair_buffer = self.nlist.pair_buffer[pair]
+        if pair_buffer is None:
+            return self.nlist.buffer
+        return min(pair_buffer, self.nlist.buffer)
+
+    def _set_pair_buffer(self, pair, new_buffer):
+        self.nlist.pair_buffer[pair] = new_buffer
+
+    def detach(self):
+        self._simulation = None
+        self._tunables = []
+
+    @property
+    def tuned(self):
+        """bool: Whether the pair buffers are considered tuned.
+
+        The tuner tunes one pair of particle types at a time. Each pair is
+        considered tuned when the specified solver returns ``True`` when
+        solving twice consecutively. See `hoomd.tune` for more information on
+        tuning criteria.
+        """
+        return self._pair_index >= len(self._tunables)
+
+    @hoomd.logging.log
+    def last_tps(self):
+        """int: The last TPS computed for the tuner."""
+        return self._last_tps
+
+    @property
+    def best_pair_buffers(self):
+        """dict[tuple[str, str], float]: The buffer of each tuned type pair \
+        that gave the maximum recorded TPS."""
+        return dict(self._best_pair_buffers)
+
+    def reset(self):
+        """Reset tuning.
+
+        Restart tuning from the first pair of particle types by calling
+        ``self.solver.reset``.
+        """
+        self._tuned = 0
+        self._max_tps = 0.0
+        self._pair_index = 0
+        self.solver.reset()
+
+    def __getstate__(self):
+        state = copy.copy(self.__dict__)
+        for attr in self._skip_for_equality:
+            state.pop(attr, None)
+        return state
+
+
+class NeighborListPairBuffer(hoomd.tune.custom_tuner._InternalCustomTuner):
+    """Optimize the per type pair neighbor list buffers for maximum TPS.
+
+    `NeighborListPairBuffer` tunes `hoomd.md.nlist.NeighborList.pair_buffer`
+    for each unique pair of particle types in turn. The TPS accounts for both
+    the cost of rebuilding the neighbor list, which increases as the buffer
+    decreases, and the cost of evaluating the pair forces, which increases with
+    the number of pairs in the list. Each pair buffer is tuned between
+    ``minimum_buffer`` and `hoomd.md.nlist.NeighborList.buffer`, which bounds
+    all pair buffers.
+
+    Tip:
+        Tune `hoomd.md.nlist.NeighborList.buffer` with `NeighborListBuffer`
+        first, then use `NeighborListPairBuffer` to reduce the buffers of the
+        type pairs that do not need the full buffer.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when to
+            run the tuner.
+        nlist (hoomd.md.nlist.NeighborList): Neighbor list instance to tune.
+        solver (`hoomd.tune.solve.Optimizer`): A solver that tunes each pair
+            buffer to maximize TPS.
+        minimum_buffer (`float`, optional): The smallest buffer value to allow
+            (defaults to 0).
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): ``Trigger`` to determine when to run
+            the tuner.
+        solver (`hoomd.tune.solve.Optimizer`): A solver that tunes each pair
+            buffer to maximize TPS.
+        minimum_buffer (float): The smallest buffer value to allow.
+
+    Note:
+        Only the CPU neighbor lists apply pair buffers.
+    """
+
+    _internal_class = _NeighborListPairBufferInternal
+    _wrap_methods = ("tuned", "best_pair_buffers")
+
+    @classmethod
+    def with_grid(
+        cls,
+        trigger: hoomd.trigger.trigger_like,
+        nlist: NeighborList,
+        minimum_buffer: float = 0.0,
+        n_bins: int = 5,
+        n_rounds: int = 1,
+    ):
+        """Create a `NeighborListPairBuffer` with a `hoomd.tune.GridOptimizer`.
+
+        Args:
+            trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when
+                to run the tuner.
+            nlist (hoomd.md.nlist.NeighborList): Neighbor list buffer to
+                maximize TPS.
+            minimum_buffer (`float`, optional): The smallest buffer value to
+                allow (defaults to 0).
+            n_bins (`int`, optional): The number of bins in the range to test
+                (defaults to 5).
+            n_rounds (`int`, optional): The number of rounds to perform the
+                optimization over (defaults to 1).
+        """
+        return cls(
+            trigger,
+            nlist,
+            hoomd.tune.GridOptimizer(n_bins, n_rounds, True),
+            minimum_buffer=minimum_buffer,
+        )
@@ -0,0 +1,287 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Provide a tuner for the parameters of `hoomd.md.long_range.pppm.Coulomb`."""
+
+import copy
+import math
+
+import hoomd.custom
+import hoomd.data
+from hoomd.data.typeconverter import OnlyTypes, SetOnce
+import hoomd.logging
+import hoomd.tune
+from hoomd.md.long_range.pppm import (Coulomb, _kspace_error,
+                                      _real_space_error)
+from hoomd.md.tune.nlist_buffer import _IntervalTPS
+
+
+def _bisect(f, lower, upper, n_iterations=60):
+    """Bracket the root of the increasing function f in [lower, upper].
+
+    Returns:
+        ``(lower, upper)`` with ``f(lower) <= 0 <= f(upper)``, ``None`` when
+        ``f(lower) > 0``, or ``(upper, upper)`` when ``f(upper) <= 0``.
+    """
+    if f(lower) > 0:
+        return None
+    if f(upper) <= 0:
+        return (upper, upper)
+
+    for i in range(n_iterations):
+        middle = 0.5 * (lower + upper)
+        if f(middle) <= 0:
+            lower = middle
+        else:
+            upper = middle
+
+    return (lower, upper)
+
+
+class _PPPMParametersInternal(hoomd.custom._InternalAction):
+    _skip_for_equality = {"_simulation", "_tps"}
+
+    def __init__(self,
+                 coulomb,
+                 rms_error,
+                 resolutions=((16, 16, 16), (32, 32, 32), (64, 64, 64),
+                              (128, 128, 128)),
+                 orders=(4, 5, 6, 7),
+                 maximum_r_cut=None):
+        param_dict = hoomd.data.parameterdicts.ParameterDict(
+            coulomb=SetOnce(Coulomb),
+            rms_error=float,
+            maximum_r_cut=OnlyTypes(float, allow_none=True))
+        param_dict.update({
+            "coulomb": coulomb,
+            "rms_error": rms_error,
+            "maximum_r_cut": maximum_r_cut
+        })
+        self._param_dict.update(param_dict)
+
+        self._resolutions = [tuple(int(n) for n in r) for r in resolutions]
+        self._orders = [int(order) for order in orders]
+        for order in self._orders:
+            if order < 1 or order > 7:
+                raise ValueError("PPPM orders must be between 1 and 7.")
+
+        self._simulation = None
+        self._tps = None
+        self._candidates = None
+        self._current = None
+        self._warmup = False
+        self._tuned = False
+
+        # Setup default log values
+        self._last_tps = 0.0
+        self._max_tps = 0.0
+
+    def act(self, timestep):
+        if self._tuned:
+            return
+
+        if self._candidates is None:
+            self._candidates = self._make_candidates()
+            if len(self._candidates) == 0:
+                raise RuntimeError("No PPPM parameters meet the requested "
+                                   "rms_error, increase maximum_r_cut or add "
+                                   "finer resolutions.")
+            self._tps = _IntervalTPS(self._simulation)
+            self._tps()
+            self._set_candidate(0)
+            return
+
+        tps = self._tps()
+        if tps is None:
+            return
+
+        # the first interval includes the setup of the new mesh
+        if self._warmup:
+            self._warmup = False
+            return
+
+        self._last_tps = tps
+        self._candidates[self._current]["tps"] = tps
+        if tps > self._max_tps:
+            self._max_tps = tps
+
+        if self._current + 1 < len(self._candidates):
+            self._set_candidate(self._current + 1)
+        else:
+            best = max(range(len(self._candidates)),
+                       key=lambda i: self._candidates[i]["tps"])
+            self._set_candidate(best)
+            self._tuned = True
+
+    def _make_candidates(self):
+        """Find the r_cut and kappa that meet rms_error for each candidate."""
+        state = self._simulation.state
+        box = state.box
+        N = state.N_particles
+        q2 = self.coulomb._cpp_obj.getQ2Sum()
+        L = (box.Lx, box.Ly, box.Lz)
+
+        maximum_r_cut = self.maximum_r_cut
+        if maximum_r_cut is None:
+            # the neighbor list requires r_cut + buffer < L / 2
+            maximum_r_cut = 0.49 * min(L) - self.coulomb.nlist.buffer
+
+        # split the error evenly between the real and reciprocal space terms
+        target = self.rms_error / math.sqrt(2.0)
+        n_ranks = self._simulation.device.communicator.num_ranks
+
+        candidates = []
+        for resolution in self._resolutions:
+            if n_ranks > 1 and any(n & (n - 1) for n in resolution):
+                continue
+
+            h = [L[i] / resolution[i] for i in range(3)]
+            for order in self._orders:
+                # the reciprocal space error increases with kappa, choose the
+                # largest kappa that meets the target
+                kappa = _bisect(
+                    lambda kappa: _kspace_error(*h, *L, N, order, kappa, q2) -
+                    target, 0.0, 10.0 / min(h))
+                if kappa is None or kappa[0] == 0.0:
+                    continue
+                kappa = kappa[0]
+
+                # the real space error decreases with r_cut, choose the
+                # smallest r_cut that meets the target
+                r_cut = _bisect(
+                    lambda r_cut: target - _real_space_error(
+                        *L, N, kappa, q2, r_cut), 1e-3 * maximum_r_cut,
+                    maximum_r_cut)
+                if r_cut is None or target < _real_space_error(
+                        *L, N, kappa, q2, r_cut[1]):
+                    continue
+
+                candidates.append(
+                    dict(resolution=resolution,
+                         order=order,
+                         r_cut=r_cut[1],
+                         kappa=kappa,
+                         tps=None))
+
+        return candidates
+
+    def _set_candidate(self, index):
+        candidate = self._candidates[index]
+        self.coulomb._set_parameters(candidate["resolution"],
+                                     candidate["order"], candidate["r_cut"],
+                                     self.coulomb.alpha, candidate["kappa"])
+        self._current = index
+        self._warmup = True
+
+    def attach(self, simulation):
+        self._simulation = simulation
+
+    def detach(self):
+        self._simulation = None
+        self._tps = None
+
+    @property
+    def tuned(self):
+        """bool: Whether the tuner has timed all candidates.
+
+        When tuned, `coulomb` uses the fastest candidate.
+        """
+        return self._tuned
+
+    @property
+    def candidates(self):
+        """list[dict]: The candidate parameters.
+
+        Each candidate is a `dict` with the keys ``resolution``, ``order``,
+        ``r_cut``, ``kappa``, and ``tps``. ``tps`` is `None` until the tuner
+        has timed the candidate. `candidates` is `None` until the tuner first
+        runs.
+        """
+        if self._candidates is None:
+            return None
+        return copy.deepcopy(self._candidates)
+
+    @hoomd.logging.log
+    def max_tps(self):
+        """float: The maximum recorded TPS during tuning."""
+        return self._max_tps
+
+    @hoomd.logging.log
+    def last_tps(self):
+        """float: The last TPS computed for the tuner."""
+        return self._last_tps
+
+    def reset(self):
+        """Reset tuning.
+
+        Recompute the candidates from the current state of the system and time
+        them again, e.g. after the density or the charges change.
+        """
+        self._candidates = None
+        self._current = None
+        self._tuned = False
+        self._max_tps = 0.0
+
+    def __getstate__(self):
+        state = copy.copy(self.__dict__)
+        for attr in self._skip_for_equality:
+            state.pop(attr, None)
+        return state
+
+
+class PPPMParameters(hoomd.tune.custom_tuner._InternalCustomTuner):
+    r"""Choose the fastest PPPM parameters that meet a target accuracy.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): ``Trigger`` to determine when to
+            run the tuner.
+        coulomb (hoomd.md.long_range.pppm.Coulomb): Reciprocal space force
+            created by `hoomd.md.long_range.pppm.make_pppm_coulomb_forces`.
+        rms_error (float): Target RMS error of the force
+            :math:`[\mathrm{force}]`.
+        resolutions (list[tuple[int, int, int]]): Candidate grid resolutions
+            (defaults to cubic grids of 16, 32, 64, and 128 points along each
+            direction).
+        orders (list[int]): Candidate interpolation orders (defaults to
+            ``[4, 5, 6, 7]``).
+        maximum_r_cut (float): Largest real space cutoff to consider
+            :math:`[\mathrm{length}]` (defaults to ``None``, which sets just
+            under half the shortest box length minus the neighbor list
+            buffer).
+
+    `PPPMParameters` trades the cost of the reciprocal space mesh against the
+    cost of the real space pair force `hoomd.md.pair.Ewald`. For each
+    combination of resolution and order, it splits ``rms_error`` evenly
+    between the estimated real and reciprocal space errors, chooses the
+    largest splitting parameter :math:`\kappa` that meets the reciprocal space
+    target, and then the smallest ``r_cut`` that meets the real space target.
+    Candidates that need a cutoff larger than ``maximum_r_cut`` are discarded.
+
+    Each time the trigger fires, the tuner measures the TPS since the last time
+    it ran, ignoring the first interval after it sets a new candidate (which
+    includes the setup of the mesh and the influence function). After timing
+    all candidates, it sets the parameters of the fastest one on ``coulomb``
+    and the paired `hoomd.md.pair.Ewald` force and sets `tuned` to ``True``.
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): ``Trigger`` to determine when to run
+            the tuner.
+        coulomb (hoomd.md.long_range.pppm.Coulomb): Reciprocal space force to
+            tune.
+        rms_error (float): Target RMS error of the force
+            :math:`[\mathrm{force}]`.
+        maximum_r_cut (float): Largest real space cutoff to consider
+            :math:`[\mathrm{length}]`.
+
+    Tip:
+        Use a trigger period of at least a few hundred steps so that the
+        measured TPS is representative. On the GPU, run the simulation long
+        enough for the kernel autotuners to complete before adding this tuner.
+
+    Important:
+        In MPI simulations with multiple ranks, the tuner only considers
+        resolutions that are a power of two in each dimension.
+    """
+
+    _internal_class = _PPPMParametersInternal
+    _wrap_methods = ("tuned", "candidates")
@@ -36,8 +36,8 @@ class ZeroMomentum(Updater):
     where the index :math:`i` includes only free and central particles (and
     excludes consitutent particles of rigid bodies).
 
-    Note:
-        `ZeroMomentum` executes on the CPU even when using a GPU device.
+    On GPU devices, `ZeroMomentum` sums the momentum and updates the
+    velocities on the GPU without copying the particle data to the host.
 
     Examples::
 
@@ -51,8 +51,13 @@ class ZeroMomentum(Updater):
 
     def _attach_hook(self):
         # create the c++ mirror class
-        self._cpp_obj = _md.ZeroMomentumUpdater(
-            self._simulation.state._cpp_sys_def, self.trigger)
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _md.ZeroMomentumUpdater
+        else:
+            cpp_class = _md.ZeroMomentumUpdaterGPU
+
+        self._cpp_obj = cpp_class(self._simulation.state._cpp_sys_def,
+                                  self.trigger)
 
 
 class ReversePerturbationFlow(Updater):
@@ -301,3 +306,258 @@ class ActiveRotationalDiffusion(Updater):
         if attr == "active_force":
             raise ValueError("active_force is not settable after construction.")
         super()._setattr_param(attr, value)
+
+
+class ReplicaExchange(Updater):
+    r"""Exchange temperatures between replicas in separate partitions.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to attempt
+            swaps.
+        kT (`list` [`float`]): Temperatures of the replicas
+            :math:`[\mathrm{energy}]`, one per partition in increasing order.
+
+    `ReplicaExchange` performs parallel tempering over the partitions of a
+    `hoomd.communicator.Communicator`. Each partition simulates one replica of
+    the system at one of the temperatures in `kT`. On the selected timesteps,
+    `ReplicaExchange` attempts to swap the temperatures of the replicas
+    :math:`a` and :math:`b` that hold neighboring temperatures
+    :math:`kT_s` and :math:`kT_{s+1}` with the probability:
+
+    .. math::
+
+        P = \min\left(1, \exp\left[\left(\frac{1}{kT_s}
+            - \frac{1}{kT_{s+1}}\right) (U_a - U_b)\right]\right)
+
+    where :math:`U` is the potential energy of the replica. Attempts alternate
+    between the even and the odd pairs of neighboring temperatures.
+
+    Only the potential energies pass between partitions. `ReplicaExchange`
+    never moves particle data and does not call into Python on the selected
+    timesteps. After a swap, it sets the new temperature in `replica_kT` and
+    rescales the velocities and angular momenta of the replica by
+    :math:`\sqrt{kT_\mathrm{new} / kT_\mathrm{old}}`. Pass `replica_kT` as the
+    temperature of the integration methods or thermostats of the simulation.
+
+    Note:
+        All partitions draw the swap decisions from the seed of partition 0,
+        so the replicas may use different seeds for their dynamics.
+
+    Note:
+        `ReplicaExchange` evaluates the potential energy from the forces
+        computed at the end of the previous timestep. It does not rescale the
+        internal degrees of freedom of thermostats such as
+        `hoomd.md.methods.thermostats.MTTK`.
+
+    Note:
+        `ReplicaExchange` executes on the CPU even when using a GPU device.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        replica_exchange = hoomd.md.update.ReplicaExchange(
+            trigger=hoomd.trigger.Periodic(500),
+            kT=[1.0, 1.2, 1.44, 1.73])
+        bussi = hoomd.md.methods.thermostats.Bussi(
+            kT=replica_exchange.replica_kT)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to attempt
+            swaps.
+    """
+
+    def __init__(self, trigger, kT):
+        super().__init__(trigger)
+        self._kT = tuple(float(value) for value in kT)
+        if len(self._kT) == 0:
+            raise ValueError("kT must have at least one temperature.")
+        self._replica_kT = hoomd.variant.Constant(self._kT[0])
+
+    def _attach_hook(self):
+        self._cpp_obj = _md.ReplicaExchangeUpdater(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            self._replica_kT, list(self._kT))
+
+    @property
+    def kT(self):
+        """tuple[float]: Temperatures of the replicas [read only]."""
+        return self._kT
+
+    @property
+    def replica_kT(self):
+        """hoomd.variant.Constant: Temperature of this partition's replica.
+
+        `ReplicaExchange` sets the value of `replica_kT` when it attaches and
+        after each swap.
+        """
+        return self._replica_kT
+
+    @log(requires_run=True)
+    def replica_index(self):
+        """int: Index in `kT` of the temperature this partition holds."""
+        return self._cpp_obj.replica_index
+
+    @log(requires_run=True)
+    def num_swaps_accepted(self):
+        """int: Number of accepted swaps since the updater was attached."""
+        return self._cpp_obj.num_swaps_accepted
+
+    @log(requires_run=True)
+    def num_swaps_attempted(self):
+        """int: Number of attempted swaps since the updater was attached."""
+        return self._cpp_obj.num_swaps_attempted
+
+
+class TypeSwap(Updater):
+    r"""Change particle types with Monte Carlo moves between MD steps.
+
+    Args:
+        trigger (hoomd.trigger.trigger_like): Select the timesteps to attempt
+            moves.
+        forces (`list` [`hoomd.md.pair.Pair`]): Pair potentials that evaluate
+            the energy change of a move.
+        types (`list` [`str`]): Particle types to change between.
+        kT (hoomd.variant.variant_like): Temperature
+            :math:`[\mathrm{energy}]`.
+        trials (int): Number of trial moves per MPI rank on each selected
+            timestep.
+        mu (`dict` [`str`, `float`]): Chemical potential of each type in
+            `types` :math:`[\mathrm{energy}]`. Set to `None` to attempt swap
+            moves.
+
+    `TypeSwap` performs hybrid MD/MC simulations of mixtures. On the selected
+    timesteps, it attempts moves that change the types of particles in
+    `types`. When `mu` is `None`, each move swaps the types of two randomly
+    chosen particles, which keeps the composition fixed. Otherwise, each move
+    changes the type of one randomly chosen particle from :math:`t` to one of
+    the other types :math:`t'` in the semi-grand canonical ensemble. `TypeSwap`
+    accepts a move with the probability:
+
+    .. math::
+
+        P = \min\left(1, \exp\left[-\frac{\Delta U - \Delta \mu}{kT}
+            \right]\right)
+
+    where :math:`\Delta U` is the change in the energy of `forces` and
+    :math:`\Delta \mu = \mu_{t'} - \mu_t` for semi-grand moves (0 for swaps).
+
+    `TypeSwap` evaluates the moves with the neighbor lists of `forces` instead
+    of building separate spatial data structures. It extends the cutoffs of
+    those neighbor lists to the largest cutoff among `types` and sets them to
+    store full neighbor lists, so the lists remain valid after a type change.
+    With domain decomposition, each rank attempts moves on its particles that
+    are farther than the largest cutoff from the neighboring domains.
+
+    Note:
+        Include all pair potentials that depend on the types in `forces`.
+        `TypeSwap` ignores changes in the energy of other forces, such as
+        bonds, and does not update the tail corrections of the pair potentials.
+
+    On GPU devices, `TypeSwap` attempts the moves in parallel on a
+    checkerboard of cells that are at least as wide as the largest cutoff.
+    Each round shifts the cells randomly and attempts one move in every cell
+    of one color, which do not interact with each other. A swap exchanges the
+    types of two particles in the same cell. The rounds continue until at
+    least `trials` moves are attempted, so one update may attempt somewhat
+    more than `trials` moves. The GPU implementation requires local boxes at
+    least twice as wide as the largest cutoff.
+
+    Tip:
+        Model a polydisperse system, such as a swap Monte Carlo glass former,
+        with one particle type per size and set `types` to all of them.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+        type_swap = hoomd.md.update.TypeSwap(
+            trigger=hoomd.trigger.Periodic(100),
+            forces=[lj],
+            types=['A', 'B'],
+            kT=1.0,
+            trials=100)
+
+    Attributes:
+        trigger (hoomd.trigger.Trigger): Select the timesteps to attempt
+            moves.
+        kT (hoomd.variant.Variant): Temperature :math:`[\mathrm{energy}]`.
+        trials (int): Number of trial moves per MPI rank on each selected
+            timestep.
+    """
+
+    def __init__(self, trigger, forces, types, kT, trials=1, mu=None):
+        super().__init__(trigger)
+        params = ParameterDict(kT=hoomd.variant.Variant, trials=int)
+        params.update(dict(kT=kT, trials=trials))
+        self._param_dict.update(params)
+        self._forces = tuple(forces)
+        self._types = tuple(types)
+        if len(self._types) < 2:
+            raise ValueError("types must have at least two types.")
+        self.mu = mu
+
+    def _attach_hook(self):
+        for force in self._forces:
+            if not force._attached or force._simulation is not self._simulation:
+                raise SimulationDefinitionError(
+                    "TypeSwap forces must belong to the simulation "
+                    "integrator.")
+
+        particle_types = self._simulation.state.particle_types
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _md.TypeSwapUpdater
+        else:
+            cpp_class = _md.TypeSwapUpdaterGPU
+        self._cpp_obj = cpp_class(
+            self._simulation.state._cpp_sys_def, self.trigger,
+            [force._cpp_obj for force in self._forces],
+            [particle_types.index(t) for t in self._types], self.kT,
+            self.trials)
+        self._set_cpp_mu()
+
+    def _set_cpp_mu(self):
+        if self._mu is None:
+            self._cpp_obj.clearChemicalPotentials()
+        else:
+            particle_types = self._simulation.state.particle_types
+            self._cpp_obj.setChemicalPotentials(
+                [self._mu.get(t, 0.0) for t in particle_types])
+
+    @property
+    def forces(self):
+        """tuple[hoomd.md.pair.Pair]: Pair potentials that evaluate the moves \
+        [read only]."""
+        return self._forces
+
+    @property
+    def types(self):
+        """tuple[str]: Particle types to change between [read only]."""
+        return self._types
+
+    @property
+    def mu(self):
+        """dict[str, float]: Chemical potential of each type in `types` \
+        :math:`[\\mathrm{energy}]`.
+
+        `None` selects swap moves.
+        """
+        return self._mu
+
+    @mu.setter
+    def mu(self, value):
+        if value is not None:
+            value = {t: float(value[t]) for t in self._types}
+        self._mu = value
+        if self._attached:
+            self._set_cpp_mu()
+
+    @log(requires_run=True)
+    def num_accepted(self):
+        """int: Number of accepted moves since the updater was attached."""
+        return self._cpp_obj.num_accepted
+
+    @log(requires_run=True)
+    def num_attempted(self):
+        """int: Number of attempted moves since the updater was attached."""
+        return self._cpp_obj.num_attempted
@@ -5,6 +5,12 @@
 
 #include <vector>
 
+#ifdef ENABLE_TBB
+#include "hoomd/ThreadBuffers.h"
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 #include <stdexcept>
@@ -327,13 +333,6 @@ void EAMForceCompute::computeForces(uint64_t timestep)
     ArrayHandle<Scalar4> h_rphi(m_rphi, access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_drphi(m_drphi, access_location::host, access_mode::read);
 
-    // index and remainder
-    Scalar position;           // look up position, scalar
-    unsigned int int_position; // look up index for position, integer
-    unsigned int idxs;         // look up index in F, rho, rphi array, considering shift, integer
-    Scalar remainder;          // look up remainder in array, integer
-    Scalar4 v, dv;             // value, d(value)
-
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
     assert(h_virial.data);
@@ -356,201 +355,321 @@ void EAMForceCompute::computeForces(uint64_t timestep)
     Scalar r_cut_sq = m_r_cut * m_r_cut;
 
     // parameters for each particle
-    vector<Scalar> atomElectronDensity;
-    atomElectronDensity.resize(m_pdata->getN());
-    vector<Scalar> atomDerivativeEmbeddingFunction;
-    atomDerivativeEmbeddingFunction.resize(m_pdata->getN());
-    vector<Scalar> atomEmbeddingFunction;
-    atomEmbeddingFunction.resize(m_pdata->getN());
+    const unsigned int N = m_pdata->getN();
+    vector<Scalar> atomElectronDensity(N, Scalar(0.0));
+    vector<Scalar> atomDerivativeEmbeddingFunction(N);
     unsigned int ntypes = m_pdata->getNTypes();
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // add the electron density at particles [begin, end) (and their neighbors with third_law) to
+    // density
+    auto compute_density = [&](unsigned int begin, unsigned int end, Scalar* density)
         {
-        // access the particle's position and type
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const size_t head_i = h_head_list.data[i];
+        for (unsigned int i = begin; i != end; i++)
+            {
+            // access the particle's position and type
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const size_t head_i = h_head_list.data[i];
 
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
 
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
 
-        for (unsigned int j = 0; j < size; j++)
-            {
-            // access the index of this neighbor
-            unsigned int k = h_nlist.data[head_i + j];
-            // sanity check
-            assert(k < m_pdata->getN());
+            for (unsigned int j = 0; j < size; j++)
+                {
+                // access the index of this neighbor
+                unsigned int k = h_nlist.data[head_i + j];
+                // sanity check
+                assert(k < m_pdata->getN());
 
-            // calculate dr
-            Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
-            Scalar3 dx = pi - pk;
+                // calculate dr
+                Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
+                Scalar3 dx = pi - pk;
 
-            // access the type of the neighbor particle
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
-            // sanity check
-            assert(typej < m_pdata->getNTypes());
+                // access the type of the neighbor particle
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                // sanity check
+                assert(typej < m_pdata->getNTypes());
 
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
 
-            // start computing the force
-            // calculate r squared
-            Scalar rsq = dot(dx, dx);
-            ;
-            // only compute the force if the particles are closer than the cut-off
-            if (rsq < r_cut_sq)
-                {
-                // calculate position r for rho(r)
-                position = sqrt(rsq) * rdr;
-                int_position = (unsigned int)position;
-                int_position = min(int_position, nr - 1);
-                remainder = position - int_position;
-                // calculate P = sum{rho}
-                idxs = int_position + nr * (typej * ntypes + typei);
-                v = h_rho.data[idxs];
-                atomElectronDensity[i] += v.w + v.z * remainder + v.y * remainder * remainder
-                                          + v.x * remainder * remainder * remainder;
-                // if third_law, pair it
-                if (third_law)
+                // calculate r squared
+                Scalar rsq = dot(dx, dx);
+
+                // only compute the density if the particles are closer than the cut-off
+                if (rsq < r_cut_sq)
                     {
-                    idxs = int_position + nr * (typei * ntypes + typej);
-                    v = h_rho.data[idxs];
-                    atomElectronDensity[k] += v.w + v.z * remainder + v.y * remainder * remainder
-                                              + v.x * remainder * remainder * remainder;
+                    // calculate position r for rho(r)
+                    Scalar position = sqrt(rsq) * rdr;
+                    unsigned int int_position = (unsigned int)position;
+                    int_position = min(int_position, nr - 1);
+                    Scalar remainder = position - int_position;
+                    // calculate P = sum{rho}
+                    unsigned int idxs = int_position + nr * (typej * ntypes + typei);
+                    Scalar4 v = h_rho.data[idxs];
+                    density[i] += v.w + v.z * remainder + v.y * remainder * remainder
+                                  + v.x * remainder * remainder * remainder;
+                    // if third_law, pair it
+                    if (third_law)
+                        {
+                        idxs = int_position + nr * (typei * ntypes + typej);
+                        v = h_rho.data[idxs];
+                        density[k] += v.w + v.z * remainder + v.y * remainder * remainder
+                                      + v.x * remainder * remainder * remainder;
+                        }
                     }
                 }
             }
-        }
+        };
 
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+    // compute the embedding energy F(P) and dF/dP of particles [begin, end)
+    auto compute_embedding = [&](unsigned int begin, unsigned int end)
         {
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        // calculate position rho for F(rho)
-        position = atomElectronDensity[i] * rdrho;
-        int_position = (unsigned int)position;
-        int_position = min(int_position, nrho - 1);
-        remainder = position - int_position;
-
-        idxs = int_position + typei * nrho;
-        v = h_F.data[idxs];
-        dv = h_dF.data[idxs];
-        // compute dF / dP
-        atomDerivativeEmbeddingFunction[i] = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-        // compute embedded energy F(P), sum up each particle
-        h_force.data[i].w += v.w + v.z * remainder + v.y * remainder * remainder
-                             + v.x * remainder * remainder * remainder;
-        }
-
-    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        for (unsigned int i = begin; i != end; i++)
+            {
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            // calculate position rho for F(rho)
+            Scalar position = atomElectronDensity[i] * rdrho;
+            unsigned int int_position = (unsigned int)position;
+            int_position = min(int_position, nrho - 1);
+            Scalar remainder = position - int_position;
+
+            unsigned int idxs = int_position + typei * nrho;
+            Scalar4 v = h_F.data[idxs];
+            Scalar4 dv = h_dF.data[idxs];
+            // compute dF / dP
+            atomDerivativeEmbeddingFunction[i]
+                = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+            // compute embedded energy F(P), sum up each particle
+            h_force.data[i].w += v.w + v.z * remainder + v.y * remainder * remainder
+                                 + v.x * remainder * remainder * remainder;
+            }
+        };
+
+    // add the forces, energies, and virials of particles [begin, end) (and their neighbors with
+    // third_law) to force and virial
+    auto compute_forces = [&](unsigned int begin,
+                              unsigned int end,
+                              Scalar4* force,
+                              Scalar* virial,
+                              size_t pitch)
         {
-        // access the particle's position and type
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const size_t head_i = h_head_list.data[i];
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar fxi = 0.0;
-        Scalar fyi = 0.0;
-        Scalar fzi = 0.0;
-        Scalar pei = 0.0;
-        Scalar viriali[6];
-        for (int k = 0; k < 6; k++)
-            viriali[k] = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int j = 0; j < size; j++)
+        for (unsigned int i = begin; i != end; i++)
             {
-            // access the index of this neighbor
-            unsigned int k = h_nlist.data[head_i + j];
-            // sanity check
-            assert(k < m_pdata->getN());
-
-            // calculate \Delta r
-            Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
-            Scalar3 dx = pi - pk;
-
-            // access the type of the neighbor particle
-            unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+            // access the particle's position and type
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const size_t head_i = h_head_list.data[i];
             // sanity check
-            assert(typej < m_pdata->getNTypes());
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // start computing the force
-            // calculate r squared
-            Scalar rsq = dot(dx, dx);
-
-            // calculate position r for phi(r)
-            if (rsq >= r_cut_sq)
-                continue;
-            Scalar r = sqrt(rsq);
-            Scalar inverseR = 1.0 / r;
-            position = r * rdr;
-            int_position = (unsigned int)position;
-            int_position = min(int_position, nr - 1);
-            remainder = position - int_position;
-            // calculate the shift position for type ij
-            int shift = (typei >= typej)
-                            ? (int)(0.5 * (2 * ntypes - typej - 1) * typej + typei) * nr
-                            : (int)(0.5 * (2 * ntypes - typei - 1) * typei + typej) * nr;
-
-            idxs = int_position + shift;
-            v = h_rphi.data[idxs];
-            dv = h_drphi.data[idxs];
-            // pair_eng = phi
-            Scalar pair_eng = (v.w + v.z * remainder + v.y * remainder * remainder
-                               + v.x * remainder * remainder * remainder)
-                              * inverseR;
-            // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
-            Scalar derivativePhi
-                = (dv.z + dv.y * remainder + dv.x * remainder * remainder - pair_eng) * inverseR;
-            // derivativeRhoI = drho / dr of i
-            idxs = int_position + typei * ntypes * nr + typej * nr;
-            dv = h_drho.data[idxs];
-            Scalar derivativeRhoI = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-            // derivativeRhoJ = drho / dr of j
-            idxs = int_position + typej * ntypes * nr + typei * nr;
-            dv = h_drho.data[idxs];
-            Scalar derivativeRhoJ = dv.z + dv.y * remainder + dv.x * remainder * remainder;
-            // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
-            Scalar fullDerivativePhi = atomDerivativeEmbeddingFunction[i] * derivativeRhoJ
-                                       + atomDerivativeEmbeddingFunction[k] * derivativeRhoI
-                                       + derivativePhi;
-            // compute forces
-            Scalar pairForce = -fullDerivativePhi * inverseR;
-            viriali[0] += dx.x * dx.x * pairForce;
-            viriali[1] += dx.x * dx.y * pairForce;
-            viriali[2] += dx.x * dx.z * pairForce;
-            viriali[3] += dx.y * dx.y * pairForce;
-            viriali[4] += dx.y * dx.z * pairForce;
-            viriali[5] += dx.z * dx.z * pairForce;
-            fxi += dx.x * pairForce;
-            fyi += dx.y * pairForce;
-            fzi += dx.z * pairForce;
-            pei += pair_eng * 0.5;
-
-            if (third_law)
+            assert(typei < m_pdata->getNTypes());
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar fxi = 0.0;
+            Scalar fyi = 0.0;
+            Scalar fzi = 0.0;
+            Scalar pei = 0.0;
+            Scalar viriali[6];
+            for (int k = 0; k < 6; k++)
+                viriali[k] = 0.0;
+
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int j = 0; j < size; j++)
                 {
-                h_force.data[k].x -= dx.x * pairForce;
-                h_force.data[k].y -= dx.y * pairForce;
-                h_force.data[k].z -= dx.z * pairForce;
-                h_force.data[k].w += pair_eng * 0.5;
+                // access the index of this neighbor
+                unsigned int k = h_nlist.data[head_i + j];
+                // sanity check
+                assert(k < m_pdata->getN());
+
+                // calculate \Delta r
+                Scalar3 pk = make_scalar3(h_pos.data[k].x, h_pos.data[k].y, h_pos.data[k].z);
+                Scalar3 dx = pi - pk;
+
+                // access the type of the neighbor particle
+                unsigned int typej = __scalar_as_int(h_pos.data[k].w);
+                // sanity check
+                assert(typej < m_pdata->getNTypes());
+
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
+
+                // calculate r squared
+                Scalar rsq = dot(dx, dx);
+
+                // calculate position r for phi(r)
+                if (rsq >= r_cut_sq)
+                    continue;
+                Scalar r = sqrt(rsq);
+                Scalar inverseR = 1.0 / r;
+                Scalar position = r * rdr;
+                unsigned int int_position = (unsigned int)position;
+                int_position = min(int_position, nr - 1);
+                Scalar remainder = position - int_position;
+                // calculate the shift position for type ij
+                int shift = (typei >= typej)
+                                ? (int)(0.5 * (2 * ntypes - typej - 1) * typej + typei) * nr
+                                : (int)(0.5 * (2 * ntypes - typei - 1) * typei + typej) * nr;
+
+                unsigned int idxs = int_position + shift;
+                Scalar4 v = h_rphi.data[idxs];
+                Scalar4 dv = h_drphi.data[idxs];
+                // pair_eng = phi
+                Scalar pair_eng = (v.w + v.z * remainder + v.y * remainder * remainder
+                                   + v.x * remainder * remainder * remainder)
+                                  * inverseR;
+                // derivativePhi = (phi + r * dphi/dr - phi) * 1/r = dphi / dr
+                Scalar derivativePhi
+                    = (dv.z + dv.y * remainder + dv.x * remainder * remainder - pair_eng)
+                      * inverseR;
+                // derivativeRhoI = drho / dr of i
+                idxs = int_position + typei * ntypes * nr + typej * nr;
+                dv = h_drho.data[idxs];
+                Scalar derivativeRhoI = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+                // derivativeRhoJ = drho / dr of j
+                idxs = int_position + typej * ntypes * nr + typei * nr;
+                dv = h_drho.data[idxs];
+                Scalar derivativeRhoJ = dv.z + dv.y * remainder + dv.x * remainder * remainder;
+                // fullDerivativePhi = dF/dP * drho / dr for j + dF/dP * drho / dr for j + phi
+                Scalar fullDerivativePhi = atomDerivativeEmbeddingFunction[i] * derivativeRhoJ
+                                           + atomDerivativeEmbeddingFunction[k] * derivativeRhoI
+                                           + derivativePhi;
+                // compute forces
+                Scalar pairForce = -fullDerivativePhi * inverseR;
+                viriali[0] += dx.x * dx.x * pairForce;
+                viriali[1] += dx.x * dx.y * pairForce;
+                viriali[2] += dx.x * dx.z * pairForce;
+                viriali[3] += dx.y * dx.y * pairForce;
+                viriali[4] += dx.y * dx.z * pairForce;
+                viriali[5] += dx.z * dx.z * pairForce;
+                fxi += dx.x * pairForce;
+                fyi += dx.y * pairForce;
+                fzi += dx.z * pairForce;
+                pei += pair_eng * 0.5;
+
+                if (third_law)
+                    {
+                    force[k].x -= dx.x * pairForce;
+                    force[k].y -= dx.y * pairForce;
+                    force[k].z -= dx.z * pairForce;
+                    force[k].w += pair_eng * 0.5;
+                    }
                 }
+            force[i].x += fxi;
+            force[i].y += fyi;
+            force[i].z += fzi;
+            force[i].w += pei;
+            for (int k = 0; k < 6; k++)
+                virial[k * pitch + i] += viriali[k];
             }
-        h_force.data[i].x += fxi;
-        h_force.data[i].y += fyi;
-        h_force.data[i].z += fzi;
-        h_force.data[i].w += pei;
-        for (int k = 0; k < 6; k++)
-            h_virial.data[k * virial_pitch + i] += viriali[k];
+        };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                if (third_law)
+                    {
+                    // Newton's third law writes to neighbor k, which may be processed by any
+                    // thread. Accumulate into thread-local arrays and reduce them afterwards.
+                    hoomd::detail::ThreadBuffers<Scalar> thread_density(m_exec_conf,
+                                                                        N,
+                                                                        Scalar(0.0));
+                    thread_density.parallel_for(
+                        0,
+                        N,
+                        [&](unsigned int begin, unsigned int end, unsigned int k)
+                        { compute_density(begin, end, thread_density[k].data()); });
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                              for (const auto& density : thread_density)
+                                                  atomElectronDensity[i] += density[i];
+                                      });
+                    }
+                else
+                    {
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          compute_density(r.begin(),
+                                                          r.end(),
+                                                          atomElectronDensity.data());
+                                      });
+                    }
+
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { compute_embedding(r.begin(), r.end()); });
+
+                if (third_law)
+                    {
+                    hoomd::detail::ThreadBuffers<Scalar4> thread_force(
+                        m_exec_conf,
+                        N,
+                        make_scalar4(0, 0, 0, 0));
+                    hoomd::detail::ThreadBuffers<Scalar> thread_virial(m_exec_conf,
+                                                                       6 * size_t(N),
+                                                                       Scalar(0.0));
+                    thread_force.parallel_for(
+                        0,
+                        N,
+                        [&](unsigned int begin, unsigned int end, unsigned int k)
+                        {
+                            compute_forces(begin,
+                                           end,
+                                           thread_force[k].data(),
+                                           thread_virial[k].data(),
+                                           size_t(N));
+                        });
+
+                    // add the per-thread contributions to the embedding energies
+                    tbb::parallel_for(
+                        tbb::blocked_range<unsigned int>(0, N),
+                        [&](const tbb::blocked_range<unsigned int>& r)
+                        {
+                            for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                for (const auto& force : thread_force)
+                                    {
+                                    h_force.data[i].x += force[i].x;
+                                    h_force.data[i].y += force[i].y;
+                                    h_force.data[i].z += force[i].z;
+                                    h_force.data[i].w += force[i].w;
+                                    }
+
+                            for (unsigned int k = 0; k < 6; k++)
+                                for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                    for (const auto& virial : thread_virial)
+                                        h_virial.data[k * virial_pitch + i]
+                                            += virial[k * size_t(N) + i];
+                        });
+                    }
+                else
+                    {
+                    // with a full neighbor list, each thread only writes to its own particles
+                    tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                      [&](const tbb::blocked_range<unsigned int>& r)
+                                      {
+                                          compute_forces(r.begin(),
+                                                         r.end(),
+                                                         h_force.data,
+                                                         h_virial.data,
+                                                         virial_pitch);
+                                      });
+                    }
+            });
+        return;
         }
+#endif
+
+    compute_density(0, N, atomElectronDensity.data());
+    compute_embedding(0, N);
+    compute_forces(0, N, h_force.data, h_virial.data, virial_pitch);
     }
 
 void EAMForceCompute::set_neighbor_list(std::shared_ptr<md::NeighborList> nlist)
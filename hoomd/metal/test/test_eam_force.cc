@@ -0,0 +1,171 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+// this include is necessary to get MPI included before anything else to support intel MPI
+#include "hoomd/ExecutionConfiguration.h"
+
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "hoomd/metal/EAMForceCompute.h"
+#include "hoomd/md/NeighborListTree.h"
+
+using namespace std;
+using namespace hoomd;
+using namespace hoomd::md;
+using namespace hoomd::metal;
+
+/*! \file test_eam_force.cc
+    \brief Implements unit tests for EAMForceCompute
+    \ingroup unit_tests
+*/
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+//! Name of the potential file written by the tests
+const string eam_filename = "test_eam_force.eam.alloy";
+
+//! Write a smooth single type EAM/Alloy potential to eam_filename
+void write_eam_file()
+    {
+    const unsigned int nrho = 500;
+    const Scalar drho = 0.05;
+    const unsigned int nr = 500;
+    const Scalar dr = 0.01;
+    const Scalar r_cut = 3.0;
+
+    ofstream f(eam_filename.c_str());
+    f << "test potential\n";
+    f << "smooth embedding, density, and pair terms\n";
+    f << "that go to zero at the cutoff\n";
+    f << "1 A\n";
+    f << nrho << " " << drho << " " << nr << " " << dr << " " << r_cut << "\n";
+    f << "1 1.0 1.0 fcc\n";
+
+    // embedding function F(rho)
+    for (unsigned int i = 0; i < nrho; i++)
+        {
+        const Scalar rho = i * drho;
+        f << -sqrt(rho) << "\n";
+        }
+
+    // electron density rho(r)
+    for (unsigned int i = 0; i < nr; i++)
+        {
+        const Scalar r = i * dr;
+        const Scalar taper = r < r_cut ? (1 - r / r_cut) * (1 - r / r_cut) : Scalar(0.0);
+        f << exp(-Scalar(2.0) * (r - Scalar(1.0))) * taper << "\n";
+        }
+
+    // r * phi(r)
+    for (unsigned int i = 0; i < nr; i++)
+        {
+        const Scalar r = i * dr;
+        const Scalar taper = r < r_cut ? (1 - r / r_cut) * (1 - r / r_cut) : Scalar(0.0);
+        const Scalar phi = exp(-Scalar(4.0) * (r - Scalar(1.1)))
+                           - Scalar(2.0) * exp(-Scalar(2.0) * (r - Scalar(1.1)));
+        f << r * phi * taper << "\n";
+        }
+    }
+
+//! Compute EAM forces on a perturbed simple cubic lattice
+/*! \param exec_conf Execution configuration to run on
+    \param mode Storage mode of the neighbor list
+    \returns The EAM force compute after computing the forces
+*/
+std::shared_ptr<EAMForceCompute> eam_compute(std::shared_ptr<ExecutionConfiguration> exec_conf,
+                                             NeighborList::storageMode mode)
+    {
+    const unsigned int n = 8;
+    const Scalar a = 1.2;
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(n * n * n,
+                                                                  std::make_shared<BoxDim>(n * a),
+                                                                  1,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  0,
+                                                                  exec_conf));
+    std::shared_ptr<ParticleData> pdata = sysdef->getParticleData();
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        mt19937 gen(3);
+        uniform_real_distribution<Scalar> displacement(-0.15, 0.15);
+        const Scalar origin = (Scalar(0.5) - Scalar(n) / Scalar(2.0)) * a;
+        for (unsigned int i = 0; i < pdata->getN(); i++)
+            {
+            h_pos.data[i].x = origin + Scalar(i % n) * a + displacement(gen);
+            h_pos.data[i].y = origin + Scalar(i / n % n) * a + displacement(gen);
+            h_pos.data[i].z = origin + Scalar(i / n / n) * a + displacement(gen);
+            }
+        }
+
+    std::vector<char> filename(eam_filename.begin(), eam_filename.end());
+    filename.push_back('\0');
+    std::shared_ptr<EAMForceCompute> eam(new EAMForceCompute(sysdef, filename.data(), 0));
+
+    std::shared_ptr<NeighborListTree> nlist(new NeighborListTree(sysdef, Scalar(0.4)));
+    auto r_cut
+        = std::make_shared<GlobalArray<Scalar>>(nlist->getTypePairIndexer().getNumElements(),
+                                                exec_conf);
+        {
+        ArrayHandle<Scalar> h_r_cut(*r_cut, access_location::host, access_mode::overwrite);
+        h_r_cut.data[0] = eam->get_r_cut();
+        }
+    nlist->addRCutMatrix(r_cut);
+    nlist->setStorageMode(mode);
+    eam->set_neighbor_list(nlist);
+
+    eam->compute(0);
+    return eam;
+    }
+
+//! Check that two force computes produced the same forces, energies, and virials
+void check_forces_match(std::shared_ptr<EAMForceCompute> a, std::shared_ptr<EAMForceCompute> b)
+    {
+    ArrayHandle<Scalar4> h_force_a(a->getForceArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_virial_a(a->getVirialArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_force_b(b->getForceArray(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_virial_b(b->getVirialArray(), access_location::host, access_mode::read);
+    const size_t pitch_a = a->getVirialArray().getPitch();
+    const size_t pitch_b = b->getVirialArray().getPitch();
+
+    UP_ASSERT_EQUAL(a->getForceArray().getNumElements(), b->getForceArray().getNumElements());
+    for (unsigned int i = 0; i < a->getForceArray().getNumElements(); i++)
+        {
+        MY_CHECK_SMALL(h_force_a.data[i].x - h_force_b.data[i].x, tol_small);
+        MY_CHECK_SMALL(h_force_a.data[i].y - h_force_b.data[i].y, tol_small);
+        MY_CHECK_SMALL(h_force_a.data[i].z - h_force_b.data[i].z, tol_small);
+        MY_CHECK_SMALL(h_force_a.data[i].w - h_force_b.data[i].w, tol_small);
+        for (unsigned int k = 0; k < 6; k++)
+            {
+            MY_CHECK_SMALL(h_virial_a.data[k * pitch_a + i] - h_virial_b.data[k * pitch_b + i],
+                           tol_small);
+            }
+        }
+    }
+
+#ifdef ENABLE_TBB
+//! Test that the forces on several CPU threads match one thread
+UP_TEST(eam_force_threads)
+    {
+    write_eam_file();
+    auto serial = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    auto threaded = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+    threaded->setNumThreads(4);
+
+    // the half list scatters into thread-local buffers, the full list does not
+    check_forces_match(eam_compute(serial, NeighborList::half),
+                       eam_compute(threaded, NeighborList::half));
+    check_forces_match(eam_compute(serial, NeighborList::full),
+                       eam_compute(threaded, NeighborList::full));
+    }
+#endif // ENABLE_TBB
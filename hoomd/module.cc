@@ -5,6 +5,7 @@
 #include "Analyzer.h"
 #include "BondedGroupData.h"
 #include "BoxResizeUpdater.h"
+#include "BufferedLogWriter.h"
 #include "CellList.h"
 #include "CellListStencil.h"
 #include "ClockSource.h"
@@ -23,6 +24,7 @@
 #include "MeshDefinition.h"
 #include "MeshGroupData.h"
 #include "Messenger.h"
+#include "OperationTimer.h"
 #include "ParticleData.h"
 #include "ParticleFilterUpdater.h"
 #include "PythonAnalyzer.h"
@@ -55,6 +57,7 @@
 #include "CellListGPU.h"
 #include "LoadBalancerGPU.h"
 #include "SFCPackTunerGPU.h"
+#include "UpdaterRemoveDriftGPU.h"
 #include <hip/hip_runtime.h>
 #endif
 
@@ -211,6 +214,9 @@ PYBIND11_MODULE(_hoomd, m)
         .def_static("getGPUPlatform", BuildInfo::getGPUPlatform)
         .def_static("getCXXCompiler", BuildInfo::getCXXCompiler)
         .def_static("getEnableTBB", BuildInfo::getEnableTBB)
+        .def_static("getEnableZstd", BuildInfo::getEnableZstd)
+        .def_static("getEnablePAPI", BuildInfo::getEnablePAPI)
+        .def_static("getEnableTorch", BuildInfo::getEnableTorch)
         .def_static("getEnableMPI", BuildInfo::getEnableMPI)
         .def_static("getSourceDir", BuildInfo::getSourceDir)
         .def_static("getInstallDir", BuildInfo::getInstallDir)
@@ -229,6 +235,7 @@ PYBIND11_MODULE(_hoomd, m)
     // utils
     export_hoomd_math_functions(m);
     export_ClockSource(m);
+    export_OperationTimer(m);
 
     // data structures
     export_HOOMDHostBuffer(m);
@@ -308,6 +315,7 @@ PYBIND11_MODULE(_hoomd, m)
     // analyzers
     export_Analyzer(m);
     export_PythonAnalyzer(m);
+    export_BufferedLogWriter(m);
     export_DCDDumpWriter(m);
     export_GSDDumpWriter(m);
     export_GSDDequeWriter(m);
@@ -320,6 +328,7 @@ PYBIND11_MODULE(_hoomd, m)
     export_UpdaterRemoveDrift(m);
 #ifdef ENABLE_HIP
     export_BoxResizeUpdaterGPU(m);
+    export_UpdaterRemoveDriftGPU(m);
 #endif
 
     // tuners
@@ -26,6 +26,16 @@ template cudaError_t
 nve_bounce_step_one<mpcd::detail::SlitPoreGeometry>(const bounce_args_t& args,
                                                     const mpcd::detail::SlitPoreGeometry& geom);
 
+//! Template instantiation of cylinder geometry streaming
+template cudaError_t
+nve_bounce_step_one<mpcd::detail::CylinderGeometry>(const bounce_args_t& args,
+                                                    const mpcd::detail::CylinderGeometry& geom);
+
+//! Template instantiation of sphere geometry streaming
+template cudaError_t
+nve_bounce_step_one<mpcd::detail::SphereGeometry>(const bounce_args_t& args,
+                                                  const mpcd::detail::SphereGeometry& geom);
+
 namespace kernel
     {
 //! Kernel for applying second step of velocity Verlet algorithm with bounce back
@@ -9,6 +9,11 @@
 #include "CellThermoCompute.h"
 #include "ReductionOperators.h"
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 /*!
@@ -409,45 +414,66 @@ void mpcd::CellThermoCompute::calcInnerCellProperties()
 
     // iterate over all of the inner cells and compute average velocity, energy, temperature
     const bool need_energy = m_flags[mpcd::detail::thermo_options::energy];
-    for (unsigned int k = lo.z; k < hi.z; ++k)
-        {
-        for (unsigned int j = lo.y; j < hi.y; ++j)
+    const unsigned int n_dimensions = m_sysdef->getNDimensions();
+    const uint3 n_inner = make_uint3(hi.x - lo.x, hi.y - lo.y, hi.z - lo.z);
+    const unsigned int num_inner = n_inner.x * n_inner.y * n_inner.z;
+    auto sum_cells = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int n = begin; n < end; ++n)
             {
-            for (unsigned int i = lo.x; i < hi.x; ++i)
+            const unsigned int i = lo.x + n % n_inner.x;
+            const unsigned int j = lo.y + (n / n_inner.x) % n_inner.y;
+            const unsigned int k = lo.z + n / (n_inner.x * n_inner.y);
+            const unsigned int cur_cell = ci(i, j, k);
+
+            // compute the cell properties
+            double4 momentum;
+            double ke(0.0);
+            unsigned int np(0);
+            summer.compute(momentum, ke, np, cur_cell, need_energy);
+
+            const double mass = momentum.w;
+            double3 vel_cm = make_double3(0.0, 0.0, 0.0);
+            if (mass > 0.)
                 {
-                const unsigned int cur_cell = ci(i, j, k);
-
-                // compute the cell properties
-                double4 momentum;
-                double ke(0.0);
-                unsigned int np(0);
-                summer.compute(momentum, ke, np, cur_cell, need_energy);
+                vel_cm.x = momentum.x / mass;
+                vel_cm.y = momentum.y / mass;
+                vel_cm.z = momentum.z / mass;
+                }
 
-                const double mass = momentum.w;
-                double3 vel_cm = make_double3(0.0, 0.0, 0.0);
-                if (mass > 0.)
+            h_cell_vel.data[cur_cell] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, mass);
+            if (need_energy)
+                {
+                double temp(0.0);
+                if (np > 1)
                     {
-                    vel_cm.x = momentum.x / mass;
-                    vel_cm.y = momentum.y / mass;
-                    vel_cm.z = momentum.z / mass;
+                    const double ke_cm
+                        = 0.5 * mass
+                          * (vel_cm.x * vel_cm.x + vel_cm.y * vel_cm.y + vel_cm.z * vel_cm.z);
+                    temp = 2. * (ke - ke_cm) / (n_dimensions * (np - 1));
                     }
+                h_cell_energy.data[cur_cell] = make_double3(ke, temp, __int_as_double(np));
+                }
+            }
+    };
 
-                h_cell_vel.data[cur_cell] = make_double4(vel_cm.x, vel_cm.y, vel_cm.z, mass);
-                if (need_energy)
-                    {
-                    double temp(0.0);
-                    if (np > 1)
-                        {
-                        const double ke_cm
-                            = 0.5 * mass
-                              * (vel_cm.x * vel_cm.x + vel_cm.y * vel_cm.y + vel_cm.z * vel_cm.z);
-                        temp = 2. * (ke - ke_cm) / (m_sysdef->getNDimensions() * (np - 1));
-                        }
-                    h_cell_energy.data[cur_cell] = make_double3(ke, temp, __int_as_double(np));
-                    }
-                } // i
-            }     // j
-        }         // k
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each cell only reads its own particles and writes its own properties
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, num_inner),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { sum_cells(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        sum_cells(0, num_inner);
+        }
     }
 
 void mpcd::CellThermoCompute::computeNetProperties()
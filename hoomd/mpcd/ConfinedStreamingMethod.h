@@ -16,6 +16,11 @@
 #include "StreamingMethod.h"
 #include <pybind11/pybind11.h>
 
+#ifdef ENABLE_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace hoomd
     {
 namespace mpcd
@@ -121,41 +126,63 @@ template<class Geometry> void ConfinedStreamingMethod<Geometry>::stream(uint64_t
     // acquire polymorphic pointer to the external field
     const mpcd::ExternalField* field = (m_field) ? m_field->get(access_location::host) : nullptr;
 
-    for (unsigned int cur_p = 0; cur_p < m_mpcd_pdata->getN(); ++cur_p)
-        {
-        const Scalar4 postype = h_pos.data[cur_p];
-        Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
-        const unsigned int type = __scalar_as_int(postype.w);
-
-        const Scalar4 vel_cell = h_vel.data[cur_p];
-        Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
-        // estimate next velocity based on current acceleration
-        if (field)
+    const unsigned int N = m_mpcd_pdata->getN();
+    auto stream_particles = [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int cur_p = begin; cur_p < end; ++cur_p)
             {
-            vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
-            }
+            const Scalar4 postype = h_pos.data[cur_p];
+            Scalar3 pos = make_scalar3(postype.x, postype.y, postype.z);
+            const unsigned int type = __scalar_as_int(postype.w);
 
-        // propagate the particle to its new position ballistically
-        Scalar dt_remain = m_mpcd_dt;
-        bool collide = true;
-        do
-            {
-            pos += dt_remain * vel;
-            collide = m_geom->detectCollision(pos, vel, dt_remain);
-            } while (dt_remain > 0 && collide);
-        // finalize velocity update
-        if (field)
-            {
-            vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
-            }
+            const Scalar4 vel_cell = h_vel.data[cur_p];
+            Scalar3 vel = make_scalar3(vel_cell.x, vel_cell.y, vel_cell.z);
+            // estimate next velocity based on current acceleration
+            if (field)
+                {
+                vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
+                }
+
+            // propagate the particle to its new position ballistically
+            Scalar dt_remain = m_mpcd_dt;
+            bool collide = true;
+            do
+                {
+                pos += dt_remain * vel;
+                collide = m_geom->detectCollision(pos, vel, dt_remain);
+                } while (dt_remain > 0 && collide);
+            // finalize velocity update
+            if (field)
+                {
+                vel += Scalar(0.5) * m_mpcd_dt * field->evaluate(pos) / mass;
+                }
 
-        // wrap and update the position
-        int3 image = make_int3(0, 0, 0);
-        box.wrap(pos, image);
+            // wrap and update the position
+            int3 image = make_int3(0, 0, 0);
+            box.wrap(pos, image);
 
-        h_pos.data[cur_p] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
-        h_vel.data[cur_p]
-            = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+            h_pos.data[cur_p] = make_scalar4(pos.x, pos.y, pos.z, __int_as_scalar(type));
+            h_vel.data[cur_p]
+                = make_scalar4(vel.x, vel.y, vel.z, __int_as_scalar(mpcd::detail::NO_CELL));
+            }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each particle only updates its own position and velocity
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(tbb::blocked_range<unsigned int>(0, N),
+                                  [&](const tbb::blocked_range<unsigned int>& r)
+                                  { stream_particles(r.begin(), r.end()); });
+            });
+        }
+    else
+#endif
+        {
+        stream_particles(0, N);
         }
 
     // particles have moved, so the cell cache is no longer valid
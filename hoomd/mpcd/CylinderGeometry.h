@@ -0,0 +1,195 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/CylinderGeometry.h
+ * \brief Definition of the MPCD cylindrical channel geometry
+ */
+
+#ifndef MPCD_CYLINDER_GEOMETRY_H_
+#define MPCD_CYLINDER_GEOMETRY_H_
+
+#include "BoundaryCondition.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#include <string>
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Cylindrical channel geometry
+/*!
+ * This class defines the geometry of an infinitely long cylindrical pipe of radius \a R. The axis
+ * of the pipe is the \a x axis, passing through the origin. The wall of the pipe may translate
+ * along its axis with velocity \a V, which drives plug flow for no-slip boundary conditions. If a
+ * uniform body force is applied to the fluid along \a x, the parabolic Poiseuille flow profile
+ * is created.
+ *
+ * The geometry enforces boundary conditions \b only on the MPCD solvent particles. Additional
+ * interactions are required with any embedded particles using appropriate wall potentials.
+ *
+ * \sa mpcd::detail::SlitGeometry for additional discussion of the boundary conditions, etc.
+ */
+class __attribute__((visibility("default"))) CylinderGeometry
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param R Channel radius
+     * \param V Velocity of the wall along the channel axis
+     * \param bc Boundary condition at the wall (slip or no-slip)
+     */
+    HOSTDEVICE CylinderGeometry(Scalar R, Scalar V, boundary bc)
+        : m_R(R), m_R2(R * R), m_V(V), m_bc(bc)
+        {
+        }
+
+    //! Detect collision between the particle and the boundary
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel
+     * is updated according to the appropriate bounce back rule, and the integration time \a dt is
+     * decreased to the amount of time remaining.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
+        {
+        // squared distance from the axis and squared velocity normal to the axis
+        const Scalar r2 = pos.y * pos.y + pos.z * pos.z;
+        const Scalar v2 = vel.y * vel.y + vel.z * vel.z;
+
+        // radial component of r.v, which is positive when the particle moves out of the channel
+        const Scalar rv = pos.y * vel.y + pos.z * vel.z;
+
+        // exit immediately if no collision is found or the particle is not moving out of the
+        // channel (since no new collision could have occurred without outward motion)
+        if (!(r2 > m_R2) || !(rv > Scalar(0)))
+            {
+            dt = Scalar(0);
+            return false;
+            }
+
+        /*
+         * Remaining integration time dt is the amount of time spent outside the channel. It is the
+         * smallest positive root of |r_perp - v_perp dt|^2 = R^2.
+         */
+        const Scalar disc = rv * rv - v2 * (r2 - m_R2);
+        dt = (rv - slow::sqrt((disc > Scalar(0)) ? disc : Scalar(0))) / v2;
+
+        // backtrack the particle for dt to get to point of contact, and place it on the wall
+        pos.x -= vel.x * dt;
+        pos.y -= vel.y * dt;
+        pos.z -= vel.z * dt;
+        const Scalar scale = m_R * fast::rsqrt(pos.y * pos.y + pos.z * pos.z);
+        pos.y *= scale;
+        pos.z *= scale;
+
+        // update velocity according to boundary conditions
+        if (m_bc == boundary::no_slip)
+            {
+            // no-slip requires reflection of all components relative to the moving wall
+            vel.x = -vel.x + Scalar(2) * m_V;
+            vel.y = -vel.y;
+            vel.z = -vel.z;
+            }
+        else
+            {
+            // slip only reflects the component normal to the surface
+            const Scalar vn = (pos.y * vel.y + pos.z * vel.z) / m_R2;
+            vel.y -= Scalar(2) * vn * pos.y;
+            vel.z -= Scalar(2) * vn * pos.z;
+            }
+
+        return true;
+        }
+
+    //! Check if a particle is out of bounds
+    /*!
+     * \param pos Current particle position
+     * \returns True if particle is out of bounds, and false otherwise
+     */
+    HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        {
+        return (pos.y * pos.y + pos.z * pos.z > m_R2);
+        }
+
+    //! Validate that the simulation box is large enough for the geometry
+    /*!
+     * \param box Global simulation box
+     * \param cell_size Size of MPCD cell
+     *
+     * The box is large enough for the cylinder if it is padded along the y and z directions so
+     * that the cells just outside the cylinder would not interact with each other through the
+     * boundary.
+     */
+    HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        {
+        const Scalar3 hi = box.getHi();
+        const Scalar3 lo = box.getLo();
+
+        return ((hi.y - m_R) >= cell_size && (-m_R - lo.y) >= cell_size
+                && (hi.z - m_R) >= cell_size && (-m_R - lo.z) >= cell_size);
+        }
+
+    //! Get channel radius
+    /*!
+     * \returns Channel radius
+     */
+    HOSTDEVICE Scalar getR() const
+        {
+        return m_R;
+        }
+
+    //! Get the wall velocity
+    /*!
+     * \returns Wall velocity
+     */
+    HOSTDEVICE Scalar getVelocity() const
+        {
+        return m_V;
+        }
+
+    //! Get the wall boundary condition
+    /*!
+     * \returns Boundary condition at wall
+     */
+    HOSTDEVICE boundary getBoundaryCondition() const
+        {
+        return m_bc;
+        }
+
+#ifndef __HIPCC__
+    //! Get the unique name of this geometry
+    static std::string getName()
+        {
+        return std::string("Cylinder");
+        }
+#endif // __HIPCC__
+
+    private:
+    const Scalar m_R;    //!< Channel radius
+    const Scalar m_R2;   //!< Squared channel radius
+    const Scalar m_V;    //!< Velocity of the wall
+    const boundary m_bc; //!< Boundary condition
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+
+#endif // MPCD_CYLINDER_GEOMETRY_H_
@@ -0,0 +1,169 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*!
+ * \file mpcd/SphereGeometry.h
+ * \brief Definition of the MPCD spherical cavity geometry
+ */
+
+#ifndef MPCD_SPHERE_GEOMETRY_H_
+#define MPCD_SPHERE_GEOMETRY_H_
+
+#include "BoundaryCondition.h"
+
+#include "hoomd/BoxDim.h"
+#include "hoomd/HOOMDMath.h"
+
+#ifdef __HIPCC__
+#define HOSTDEVICE __host__ __device__ inline
+#else
+#define HOSTDEVICE inline __attribute__((always_inline))
+#include <string>
+#endif // __HIPCC__
+
+namespace hoomd
+    {
+namespace mpcd
+    {
+namespace detail
+    {
+//! Spherical cavity geometry
+/*!
+ * This class defines the geometry of a fluid confined inside a stationary sphere of radius \a R
+ * centered at the origin.
+ *
+ * The geometry enforces boundary conditions \b only on the MPCD solvent particles. Additional
+ * interactions are required with any embedded particles using appropriate wall potentials.
+ *
+ * \sa mpcd::detail::SlitGeometry for additional discussion of the boundary conditions, etc.
+ */
+class __attribute__((visibility("default"))) SphereGeometry
+    {
+    public:
+    //! Constructor
+    /*!
+     * \param R Sphere radius
+     * \param bc Boundary condition at the wall (slip or no-slip)
+     */
+    HOSTDEVICE SphereGeometry(Scalar R, boundary bc) : m_R(R), m_R2(R * R), m_bc(bc) { }
+
+    //! Detect collision between the particle and the boundary
+    /*!
+     * \param pos Proposed particle position
+     * \param vel Proposed particle velocity
+     * \param dt Integration time remaining
+     *
+     * \returns True if a collision occurred, and false otherwise
+     *
+     * \post The particle position \a pos is moved to the point of reflection, the velocity \a vel
+     * is updated according to the appropriate bounce back rule, and the integration time \a dt is
+     * decreased to the amount of time remaining.
+     */
+    HOSTDEVICE bool detectCollision(Scalar3& pos, Scalar3& vel, Scalar& dt) const
+        {
+        const Scalar r2 = dot(pos, pos);
+        const Scalar v2 = dot(vel, vel);
+
+        // radial component of r.v, which is positive when the particle moves out of the sphere
+        const Scalar rv = dot(pos, vel);
+
+        // exit immediately if no collision is found or the particle is not moving out of the
+        // sphere (since no new collision could have occurred without outward motion)
+        if (!(r2 > m_R2) || !(rv > Scalar(0)))
+            {
+            dt = Scalar(0);
+            return false;
+            }
+
+        /*
+         * Remaining integration time dt is the amount of time spent outside the sphere. It is the
+         * smallest positive root of |r - v dt|^2 = R^2.
+         */
+        const Scalar disc = rv * rv - v2 * (r2 - m_R2);
+        dt = (rv - slow::sqrt((disc > Scalar(0)) ? disc : Scalar(0))) / v2;
+
+        // backtrack the particle for dt to get to point of contact, and place it on the wall
+        pos -= vel * dt;
+        pos *= m_R * fast::rsqrt(dot(pos, pos));
+
+        // update velocity according to boundary conditions
+        if (m_bc == boundary::no_slip)
+            {
+            // no-slip requires reflection of all components
+            vel = -vel;
+            }
+        else
+            {
+            // slip only reflects the component normal to the surface
+            vel -= (Scalar(2) * dot(pos, vel) / m_R2) * pos;
+            }
+
+        return true;
+        }
+
+    //! Check if a particle is out of bounds
+    /*!
+     * \param pos Current particle position
+     * \returns True if particle is out of bounds, and false otherwise
+     */
+    HOSTDEVICE bool isOutside(const Scalar3& pos) const
+        {
+        return (dot(pos, pos) > m_R2);
+        }
+
+    //! Validate that the simulation box is large enough for the geometry
+    /*!
+     * \param box Global simulation box
+     * \param cell_size Size of MPCD cell
+     *
+     * The box is large enough for the sphere if it is padded along all directions so that
+     * the cells just outside the sphere would not interact with each other through the boundary.
+     */
+    HOSTDEVICE bool validateBox(const BoxDim& box, Scalar cell_size) const
+        {
+        const Scalar3 hi = box.getHi();
+        const Scalar3 lo = box.getLo();
+
+        return ((hi.x - m_R) >= cell_size && (-m_R - lo.x) >= cell_size
+                && (hi.y - m_R) >= cell_size && (-m_R - lo.y) >= cell_size
+                && (hi.z - m_R) >= cell_size && (-m_R - lo.z) >= cell_size);
+        }
+
+    //! Get sphere radius
+    /*!
+     * \returns Sphere radius
+     */
+    HOSTDEVICE Scalar getR() const
+        {
+        return m_R;
+        }
+
+    //! Get the wall boundary condition
+    /*!
+     * \returns Boundary condition at wall
+     */
+    HOSTDEVICE boundary getBoundaryCondition() const
+        {
+        return m_bc;
+        }
+
+#ifndef __HIPCC__
+    //! Get the unique name of this geometry
+    static std::string getName()
+        {
+        return std::string("Sphere");
+        }
+#endif // __HIPCC__
+
+    private:
+    const Scalar m_R;    //!< Sphere radius
+    const Scalar m_R2;   //!< Squared sphere radius
+    const boundary m_bc; //!< Boundary condition
+    };
+
+    } // end namespace detail
+    } // end namespace mpcd
+    } // end namespace hoomd
+#undef HOSTDEVICE
+
+#endif // MPCD_SPHERE_GEOMETRY_H_
@@ -45,6 +45,23 @@ void export_SlitPoreGeometry(pybind11::module& m)
         .def("getBoundaryCondition", &SlitPoreGeometry::getBoundaryCondition);
     }
 
+void export_CylinderGeometry(pybind11::module& m)
+    {
+    pybind11::class_<CylinderGeometry, std::shared_ptr<CylinderGeometry>>(m, "CylinderGeometry")
+        .def(pybind11::init<Scalar, Scalar, boundary>())
+        .def("getR", &CylinderGeometry::getR)
+        .def("getVelocity", &CylinderGeometry::getVelocity)
+        .def("getBoundaryCondition", &CylinderGeometry::getBoundaryCondition);
+    }
+
+void export_SphereGeometry(pybind11::module& m)
+    {
+    pybind11::class_<SphereGeometry, std::shared_ptr<SphereGeometry>>(m, "SphereGeometry")
+        .def(pybind11::init<Scalar, boundary>())
+        .def("getR", &SphereGeometry::getR)
+        .def("getBoundaryCondition", &SphereGeometry::getBoundaryCondition);
+    }
+
     } // end namespace detail
     } // end namespace mpcd
     } // end namespace hoomd
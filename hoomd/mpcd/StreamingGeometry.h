@@ -11,8 +11,10 @@
 
 #include "BoundaryCondition.h"
 #include "BulkGeometry.h"
+#include "CylinderGeometry.h"
 #include "SlitGeometry.h"
 #include "SlitPoreGeometry.h"
+#include "SphereGeometry.h"
 
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
@@ -35,6 +37,12 @@ void export_SlitGeometry(pybind11::module& m);
 //! Export SlitPoreGeometry to python
 void export_SlitPoreGeometry(pybind11::module& m);
 
+//! Export CylinderGeometry to python
+void export_CylinderGeometry(pybind11::module& m);
+
+//! Export SphereGeometry to python
+void export_SphereGeometry(pybind11::module& m);
+
     }  // end namespace detail
     }  // end namespace mpcd
     }  // end namespace hoomd
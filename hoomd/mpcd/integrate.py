@@ -239,3 +239,139 @@ class slit_pore(_bounce_back):
 
         bc = self._process_boundary(self.boundary)
         self.cpp_method.geometry = _mpcd.SlitPoreGeometry(self.H, self.L, bc)
+
+
+class cylinder(_bounce_back):
+    """ NVE integration with bounce-back rules in a cylindrical channel.
+
+    Args:
+        group (``hoomd.group``): Group of particles on which to apply this method.
+        R (float): channel radius
+        V (float): wall speed along the channel axis (default: 0)
+        boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+    This integration method applies to particles in *group* in the cylindrical channel geometry.
+    This method is the MD analog of :py:class:`.stream.cylinder`, which documents additional
+    details about the geometry.
+
+    Examples::
+
+        all = group.all()
+        cylinder = mpcd.integrate.cylinder(group=all, R=5.0)
+        cylinder = mpcd.integrate.cylinder(group=all, R=10.0, V=1.0)
+
+    """
+
+    def __init__(self, group, R, V=0.0, boundary="no_slip"):
+        # initialize base class
+        _bounce_back.__init__(self, group)
+        self.metadata_fields += ['R', 'V']
+
+        # initialize the c++ class
+        if not hoomd.context.current.device.mode == 'gpu':
+            cpp_class = _mpcd.BounceBackNVECylinder
+        else:
+            cpp_class = _mpcd.BounceBackNVECylinderGPU
+
+        self.R = R
+        self.V = V
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+        geom = _mpcd.CylinderGeometry(R, V, bc)
+
+        self.cpp_method = cpp_class(hoomd.context.current.system_definition,
+                                    group.cpp_group, geom)
+        self.cpp_method.validateGroup()
+
+    def set_params(self, R=None, V=None, boundary=None):
+        """ Set parameters for the cylinder geometry.
+
+        Args:
+            R (float): channel radius
+            V (float): wall speed along the channel axis (default: 0)
+            boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+        Examples::
+
+            cylinder.set_params(R=8.)
+            cylinder.set_params(V=2.0)
+            cylinder.set_params(boundary='slip')
+
+        """
+
+        if R is not None:
+            self.R = R
+
+        if V is not None:
+            self.V = V
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self.cpp_method.geometry = _mpcd.CylinderGeometry(self.R, self.V, bc)
+
+
+class sphere(_bounce_back):
+    """ NVE integration with bounce-back rules in a spherical cavity.
+
+    Args:
+        group (``hoomd.group``): Group of particles on which to apply this method.
+        R (float): cavity radius
+        boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+    This integration method applies to particles in *group* in the spherical cavity geometry.
+    This method is the MD analog of :py:class:`.stream.sphere`, which documents additional
+    details about the geometry.
+
+    Examples::
+
+        all = group.all()
+        sphere = mpcd.integrate.sphere(group=all, R=5.0)
+
+    """
+
+    def __init__(self, group, R, boundary="no_slip"):
+        # initialize base class
+        _bounce_back.__init__(self, group)
+        self.metadata_fields += ['R']
+
+        # initialize the c++ class
+        if not hoomd.context.current.device.mode == 'gpu':
+            cpp_class = _mpcd.BounceBackNVESphere
+        else:
+            cpp_class = _mpcd.BounceBackNVESphereGPU
+
+        self.R = R
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+        geom = _mpcd.SphereGeometry(R, bc)
+
+        self.cpp_method = cpp_class(hoomd.context.current.system_definition,
+                                    group.cpp_group, geom)
+        self.cpp_method.validateGroup()
+
+    def set_params(self, R=None, boundary=None):
+        """ Set parameters for the sphere geometry.
+
+        Args:
+            R (float): cavity radius
+            boundary : 'slip' or 'no_slip' boundary condition at wall (default: 'no_slip')
+
+        Examples::
+
+            sphere.set_params(R=8.)
+            sphere.set_params(boundary='slip')
+
+        """
+
+        if R is not None:
+            self.R = R
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self.cpp_method.geometry = _mpcd.SphereGeometry(self.R, bc)
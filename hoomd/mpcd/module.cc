@@ -132,23 +132,33 @@ PYBIND11_MODULE(_mpcd, m)
     mpcd::detail::export_BulkGeometry(m);
     mpcd::detail::export_SlitGeometry(m);
     mpcd::detail::export_SlitPoreGeometry(m);
+    mpcd::detail::export_CylinderGeometry(m);
+    mpcd::detail::export_SphereGeometry(m);
 
     mpcd::detail::export_StreamingMethod(m);
     mpcd::detail::export_ExternalFieldPolymorph(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::BulkGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::CylinderGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethod<mpcd::detail::SphereGeometry>(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::BulkGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::CylinderGeometry>(m);
+    mpcd::detail::export_ConfinedStreamingMethodGPU<mpcd::detail::SphereGeometry>(m);
 #endif // ENABLE_HIP
 
     mpcd::detail::export_BounceBackNVE<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_BounceBackNVE<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_BounceBackNVE<mpcd::detail::CylinderGeometry>(m);
+    mpcd::detail::export_BounceBackNVE<mpcd::detail::SphereGeometry>(m);
 #ifdef ENABLE_HIP
     mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SlitGeometry>(m);
     mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SlitPoreGeometry>(m);
+    mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::CylinderGeometry>(m);
+    mpcd::detail::export_BounceBackNVEGPU<mpcd::detail::SphereGeometry>(m);
 #endif // ENABLE_HIP
 
     mpcd::detail::export_VirtualParticleFiller(m);
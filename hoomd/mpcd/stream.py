@@ -566,3 +566,152 @@ class slit_pore(_streaming_method):
         self._cpp.geometry = _mpcd.SlitPoreGeometry(self.H, self.L, bc)
         if self._filler is not None:
             self._filler.setGeometry(self._cpp.geometry)
+
+
+class cylinder(_streaming_method):
+    r"""Cylindrical channel streaming geometry.
+
+    Args:
+        R (float): channel radius
+        V (float): wall speed along the channel axis (default: 0)
+        boundary (str): boundary condition at wall ("slip" or "no_slip"")
+        period (int): Number of integration steps between collisions
+
+    The cylinder geometry represents a fluid confined inside an infinitely
+    long pipe of radius *R*. The axis of the pipe is the *x* axis, passing
+    through the origin. The wall may be put into motion with speed :math:`V`
+    along *x*, which drives plug flow when combined with a no-slip boundary
+    condition.
+
+    The "inside" of the :py:class:`cylinder` is the space where
+    :math:`y^2 + z^2 < R^2`. Virtual particle filling is not supported for
+    this geometry.
+
+    Examples::
+
+        stream.cylinder(period=10, R=20.)
+        stream.cylinder(period=1, R=15., V=0.1)
+
+    """
+
+    def __init__(self, R, V=0.0, boundary="no_slip", period=1):
+        _streaming_method.__init__(self, period)
+
+        self.R = R
+        self.V = V
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+
+        # create the base streaming class
+        if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+            stream_class = _mpcd.ConfinedStreamingMethodCylinder
+        else:
+            stream_class = _mpcd.ConfinedStreamingMethodGPUCylinder
+        self._cpp = stream_class(
+            hoomd.context.current.mpcd.data,
+            hoomd.context.current.system.getCurrentTimeStep(),
+            self.period,
+            0,
+            _mpcd.CylinderGeometry(R, V, bc),
+        )
+
+    def set_params(self, R=None, V=None, boundary=None):
+        """Set parameters for the cylinder geometry.
+
+        Args:
+            R (float): channel radius
+            V (float): wall speed along the channel axis (default: 0)
+            boundary (str): boundary condition at wall ("slip" or "no_slip"")
+
+        Changing any of these parameters will require the geometry to be
+        constructed and validated, so do not change these too often.
+
+        Examples::
+
+            cylinder.set_params(R=15.0)
+            cylinder.set_params(V=0.2, boundary="no_slip")
+
+        """
+
+        if R is not None:
+            self.R = R
+
+        if V is not None:
+            self.V = V
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self._cpp.geometry = _mpcd.CylinderGeometry(self.R, self.V, bc)
+
+
+class sphere(_streaming_method):
+    r"""Spherical cavity streaming geometry.
+
+    Args:
+        R (float): cavity radius
+        boundary (str): boundary condition at wall ("slip" or "no_slip"")
+        period (int): Number of integration steps between collisions
+
+    The sphere geometry represents a fluid confined inside a stationary
+    spherical cavity of radius *R* centered at the origin.
+
+    The "inside" of the :py:class:`sphere` is the space where
+    :math:`x^2 + y^2 + z^2 < R^2`. Virtual particle filling is not supported
+    for this geometry.
+
+    Examples::
+
+        stream.sphere(period=10, R=20.)
+        stream.sphere(period=1, R=15., boundary="slip")
+
+    """
+
+    def __init__(self, R, boundary="no_slip", period=1):
+        _streaming_method.__init__(self, period)
+
+        self.R = R
+        self.boundary = boundary
+
+        bc = self._process_boundary(boundary)
+
+        # create the base streaming class
+        if not hoomd.context.current.device.cpp_exec_conf.isCUDAEnabled():
+            stream_class = _mpcd.ConfinedStreamingMethodSphere
+        else:
+            stream_class = _mpcd.ConfinedStreamingMethodGPUSphere
+        self._cpp = stream_class(
+            hoomd.context.current.mpcd.data,
+            hoomd.context.current.system.getCurrentTimeStep(),
+            self.period,
+            0,
+            _mpcd.SphereGeometry(R, bc),
+        )
+
+    def set_params(self, R=None, boundary=None):
+        """Set parameters for the sphere geometry.
+
+        Args:
+            R (float): cavity radius
+            boundary (str): boundary condition at wall ("slip" or "no_slip"")
+
+        Changing any of these parameters will require the geometry to be
+        constructed and validated, so do not change these too often.
+
+        Examples::
+
+            sphere.set_params(R=15.0)
+            sphere.set_params(boundary="slip")
+
+        """
+
+        if R is not None:
+            self.R = R
+
+        if boundary is not None:
+            self.boundary = boundary
+
+        bc = self._process_boundary(self.boundary)
+        self._cpp.geometry = _mpcd.SphereGeometry(self.R, bc)
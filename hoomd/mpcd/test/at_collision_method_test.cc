@@ -2,6 +2,9 @@
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 #include "hoomd/mpcd/ATCollisionMethod.h"
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+#include "collision_method_threads.h"
 #include "utils.h"
 #ifdef ENABLE_HIP
 #include "hoomd/mpcd/ATCollisionMethodGPU.h"
@@ -177,6 +180,18 @@ UP_TEST(at_collision_method_embed)
     at_collision_method_embed_test<mpcd::ATCollisionMethod>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
     }
+#ifdef ENABLE_TBB
+//! test that the MPCD ATCollisionMethod class gives the same result on several CPU threads
+UP_TEST(at_collision_method_threads)
+    {
+    collision_method_threads_test(
+        [](std::shared_ptr<SystemDefinition> sysdef)
+        {
+            std::shared_ptr<Variant> T = std::make_shared<VariantConstant>(1.5);
+            return std::make_shared<mpcd::ATCollisionMethod>(sysdef, 0, 1, 0, T);
+        });
+    }
+#endif // ENABLE_TBB
 #ifdef ENABLE_HIP
 //! basic test case for MPCD ATCollisionMethodGPU class
 UP_TEST(at_collision_method_basic_gpu)
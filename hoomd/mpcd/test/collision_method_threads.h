@@ -0,0 +1,74 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef MPCD_TEST_COLLISION_METHOD_THREADS_H_
+#define MPCD_TEST_COLLISION_METHOD_THREADS_H_
+
+#include "hoomd/mpcd/CellList.h"
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+#include "utils.h"
+
+#include "hoomd/test/upp11_config.h"
+
+namespace hoomd
+    {
+//! Test that streaming and collisions on several CPU threads match one thread
+/*!
+ * \param make_collide Callable taking the SystemDefinition of a run and returning the collision
+ *                     method to test, fully configured except for its cell list.
+ *
+ * The same random MPCD fluid is streamed and collided for 10 steps on 1 and on 4 CPU threads.
+ * The particles and the net momentum, energy, and temperature of both runs must agree.
+ */
+template<class Factory> void collision_method_threads_test(const Factory& make_collide)
+    {
+    const unsigned int num_threads[] = {1, 4};
+    std::shared_ptr<mpcd::ParticleData> pdatas[2];
+    Scalar3 moms[2];
+    Scalar energies[2];
+    Scalar temps[2];
+    for (unsigned int run = 0; run < 2; ++run)
+        {
+        auto exec_conf = std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU);
+        exec_conf->setNumThreads(num_threads[run]);
+        std::shared_ptr<SystemDefinition> sysdef(
+            new SystemDefinition(make_random_mpcd_snapshot(2000, 10.0), exec_conf));
+        pdatas[run] = sysdef->getMPCDParticleData();
+
+        auto cl = std::make_shared<mpcd::CellList>(sysdef);
+        auto geom = std::make_shared<const mpcd::detail::BulkGeometry>();
+        typedef mpcd::ConfinedStreamingMethod<mpcd::detail::BulkGeometry> method;
+        auto stream = std::make_shared<method>(sysdef, 0, 1, 0, geom);
+        stream->setCellList(cl);
+        stream->setDeltaT(0.1);
+        auto collide = make_collide(sysdef);
+        collide->setCellList(cl);
+
+        auto thermo = std::make_shared<mpcd::CellThermoCompute>(sysdef, cl);
+        AllThermoRequest thermo_req(thermo);
+
+        // the grid shift and the random numbers are keyed on the timestep, not the thread
+        for (uint64_t timestep = 0; timestep < 10; ++timestep)
+            {
+            stream->stream(timestep);
+            collide->collide(timestep);
+            }
+
+        thermo->compute(10);
+        moms[run] = thermo->getNetMomentum();
+        energies[run] = thermo->getNetEnergy();
+        temps[run] = thermo->getTemperature();
+        }
+
+    CHECK_SMALL(max_mpcd_particle_difference(pdatas[0], pdatas[1]), tol_small);
+    CHECK_SMALL(moms[0].x - moms[1].x, tol_small);
+    CHECK_SMALL(moms[0].y - moms[1].y, tol_small);
+    CHECK_SMALL(moms[0].z - moms[1].z, tol_small);
+    CHECK_CLOSE(energies[0], energies[1], tol_small);
+    CHECK_CLOSE(temps[0], temps[1], tol_small);
+    }
+
+    } // end namespace hoomd
+
+#endif // MPCD_TEST_COLLISION_METHOD_THREADS_H_
@@ -0,0 +1,112 @@
+// Copyright (c) 2009-2024 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/mpcd/CylinderGeometry.h"
+#include "hoomd/mpcd/SphereGeometry.h"
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN()
+
+using namespace hoomd;
+
+//! Test for collisions with the cylinder wall
+UP_TEST(mpcd_cylinder_geometry_test)
+    {
+    // no-slip with a moving wall
+        {
+        mpcd::detail::CylinderGeometry geom(4.0, 1.0, mpcd::detail::boundary::no_slip);
+        UP_ASSERT(!geom.isOutside(make_scalar3(100.0, 3.0, 2.0)));
+        UP_ASSERT(geom.isOutside(make_scalar3(0.0, 3.0, 3.0)));
+
+        // particle inside is not reflected
+        Scalar3 pos = make_scalar3(1.0, 2.0, 0.0);
+        Scalar3 vel = make_scalar3(1.0, 1.0, 0.0);
+        Scalar dt = 0.5;
+        UP_ASSERT(!geom.detectCollision(pos, vel, dt));
+        CHECK_SMALL(dt, tol_small);
+
+        // particle outside moving outward spent 0.5 outside the wall
+        pos = make_scalar3(1.0, 4.5, 0.0);
+        dt = 1.0;
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(dt, 0.5, tol);
+        CHECK_CLOSE(pos.x, 0.5, tol);
+        CHECK_CLOSE(pos.y, 4.0, tol);
+        CHECK_SMALL(pos.z, tol_small);
+        CHECK_CLOSE(vel.x, 1.0, tol);
+        CHECK_CLOSE(vel.y, -1.0, tol);
+        CHECK_SMALL(vel.z, tol_small);
+
+        // particle outside moving inward is already reflected
+        pos = make_scalar3(0.0, 0.0, -4.5);
+        vel = make_scalar3(0.0, 0.0, 1.0);
+        UP_ASSERT(!geom.detectCollision(pos, vel, dt));
+        }
+
+    // slip only reflects the normal component
+        {
+        mpcd::detail::CylinderGeometry geom(4.0, 1.0, mpcd::detail::boundary::slip);
+        Scalar3 pos = make_scalar3(0.0, 0.0, -4.5);
+        Scalar3 vel = make_scalar3(2.0, 1.0, -3.0);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(pos.y * pos.y + pos.z * pos.z, 16.0, tol);
+        CHECK_CLOSE(vel.x, 2.0, tol);
+        CHECK_CLOSE(dot(vel, vel), 14.0, tol);
+        CHECK_CLOSE(pos.y * vel.y + pos.z * vel.z, -(pos.y * 1.0 - pos.z * 3.0), tol);
+        }
+
+    // box validation requires padding along y and z, but not along x
+        {
+        mpcd::detail::CylinderGeometry geom(4.0, 0.0, mpcd::detail::boundary::no_slip);
+        UP_ASSERT(geom.validateBox(BoxDim(2.0, 10.0, 10.0), 1.0));
+        UP_ASSERT(!geom.validateBox(BoxDim(10.0, 9.0, 10.0), 1.0));
+        UP_ASSERT(!geom.validateBox(BoxDim(10.0, 10.0, 9.0), 1.0));
+        }
+    }
+
+//! Test for collisions with the sphere wall
+UP_TEST(mpcd_sphere_geometry_test)
+    {
+    // no-slip reverses all components
+        {
+        mpcd::detail::SphereGeometry geom(2.0, mpcd::detail::boundary::no_slip);
+        UP_ASSERT(!geom.isOutside(make_scalar3(1.0, 1.0, 1.0)));
+        UP_ASSERT(geom.isOutside(make_scalar3(1.5, 1.5, 0.0)));
+
+        Scalar3 pos = make_scalar3(0.0, 0.0, 2.5);
+        Scalar3 vel = make_scalar3(0.0, 0.0, 1.0);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(dt, 0.5, tol);
+        CHECK_SMALL(pos.x, tol_small);
+        CHECK_SMALL(pos.y, tol_small);
+        CHECK_CLOSE(pos.z, 2.0, tol);
+        CHECK_SMALL(vel.x, tol_small);
+        CHECK_SMALL(vel.y, tol_small);
+        CHECK_CLOSE(vel.z, -1.0, tol);
+        }
+
+    // slip only reflects the normal component
+        {
+        mpcd::detail::SphereGeometry geom(2.0, mpcd::detail::boundary::slip);
+        Scalar3 pos = make_scalar3(0.0, 0.0, 2.5);
+        Scalar3 vel = make_scalar3(1.0, 0.0, 1.0);
+        Scalar dt = 1.0;
+        UP_ASSERT(geom.detectCollision(pos, vel, dt));
+        CHECK_CLOSE(dt, (2.5 - std::sqrt(1.75)) / 2.0, tol);
+        CHECK_CLOSE(dot(pos, pos), 4.0, tol);
+        CHECK_CLOSE(dot(vel, vel), 2.0, tol);
+        const Scalar3 vel_in = make_scalar3(1.0, 0.0, 1.0);
+        CHECK_CLOSE(dot(pos, vel), -dot(pos, vel_in), tol);
+        }
+
+    // box validation requires padding along all directions
+        {
+        mpcd::detail::SphereGeometry geom(4.0, mpcd::detail::boundary::no_slip);
+        UP_ASSERT(geom.validateBox(BoxDim(10.0), 1.0));
+        UP_ASSERT(!geom.validateBox(BoxDim(9.0, 10.0, 10.0), 1.0));
+        UP_ASSERT(!geom.validateBox(BoxDim(10.0, 10.0, 9.0), 1.0));
+        }
+    }
@@ -1,7 +1,10 @@
 // Copyright (c) 2009-2024 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/mpcd/ConfinedStreamingMethod.h"
 #include "hoomd/mpcd/SRDCollisionMethod.h"
+#include "hoomd/mpcd/StreamingGeometry.h"
+#include "collision_method_threads.h"
 #include "utils.h"
 #ifdef ENABLE_HIP
 #include "hoomd/mpcd/SRDCollisionMethodGPU.h"
@@ -403,6 +406,19 @@ UP_TEST(srd_collision_method_thermostat)
     srd_collision_method_thermostat_test<mpcd::SRDCollisionMethod>(
         std::make_shared<ExecutionConfiguration>(ExecutionConfiguration::CPU));
     }
+#ifdef ENABLE_TBB
+//! test that the MPCD SRDCollisionMethod class gives the same result on several CPU threads
+UP_TEST(srd_collision_method_threads)
+    {
+    collision_method_threads_test(
+        [](std::shared_ptr<SystemDefinition> sysdef)
+        {
+            auto collide = std::make_shared<mpcd::SRDCollisionMethod>(sysdef, 0, 1, 0, 42);
+            collide->setRotationAngle(2.2689280275926285);
+            return collide;
+        });
+    }
+#endif // ENABLE_TBB
 #ifdef ENABLE_HIP
 //! basic test case for MPCD SRDCollisionMethodGPU class
 UP_TEST(srd_collision_method_basic_gpu)
@@ -4,8 +4,14 @@
 #ifndef MPCD_TEST_UTILS_H_
 #define MPCD_TEST_UTILS_H_
 
+#include "hoomd/SnapshotSystemData.h"
 #include "hoomd/mpcd/CellThermoCompute.h"
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
 namespace hoomd
     {
 //! Request object for all available thermo flags
@@ -50,6 +56,83 @@ class AllThermoRequest
     std::shared_ptr<mpcd::CellThermoCompute> m_thermo;
     };
 
+//! Create a snapshot of randomly placed MPCD particles
+/*!
+ * \param N Number of MPCD particles.
+ * \param L Edge length of the cubic box.
+ *
+ * \returns A snapshot with \a N MPCD particles at uniform random positions in the box, with
+ * normally distributed velocities. The same snapshot is returned on every call.
+ */
+inline std::shared_ptr<SnapshotSystemData<Scalar>> make_random_mpcd_snapshot(unsigned int N,
+                                                                              Scalar L)
+    {
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap(new SnapshotSystemData<Scalar>());
+    snap->global_box = std::make_shared<BoxDim>(L);
+    snap->particle_data.type_mapping.push_back("A");
+    snap->mpcd_data.resize(N);
+    snap->mpcd_data.type_mapping.push_back("A");
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<Scalar> pos(-L / Scalar(2.0), L / Scalar(2.0));
+    std::normal_distribution<Scalar> vel(Scalar(0.0), Scalar(1.0));
+    for (unsigned int i = 0; i < N; ++i)
+        {
+        snap->mpcd_data.position[i] = vec3<Scalar>(pos(gen), pos(gen), pos(gen));
+        snap->mpcd_data.velocity[i] = vec3<Scalar>(vel(gen), vel(gen), vel(gen));
+        }
+    return snap;
+    }
+
+//! Largest difference between the MPCD particles of two runs
+/*!
+ * \param pdata_a MPCD particle data of the first run.
+ * \param pdata_b MPCD particle data of the second run.
+ *
+ * \returns The largest absolute difference of any position or velocity component, with particles
+ * matched by tag.
+ */
+inline Scalar max_mpcd_particle_difference(std::shared_ptr<mpcd::ParticleData> pdata_a,
+                                           std::shared_ptr<mpcd::ParticleData> pdata_b)
+    {
+    assert(pdata_a->getN() == pdata_b->getN());
+
+    ArrayHandle<Scalar4> h_pos_a(pdata_a->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel_a(pdata_a->getVelocities(),
+                                 access_location::host,
+                                 access_mode::read);
+    ArrayHandle<unsigned int> h_tag_a(pdata_a->getTags(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_pos_b(pdata_b->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_vel_b(pdata_b->getVelocities(),
+                                 access_location::host,
+                                 access_mode::read);
+    ArrayHandle<unsigned int> h_tag_b(pdata_b->getTags(), access_location::host, access_mode::read);
+
+    // index of each tag in the second run
+    std::vector<unsigned int> rtag_b(pdata_b->getN());
+    for (unsigned int i = 0; i < pdata_b->getN(); ++i)
+        {
+        rtag_b[h_tag_b.data[i]] = i;
+        }
+
+    Scalar max_diff(0.0);
+    for (unsigned int i = 0; i < pdata_a->getN(); ++i)
+        {
+        const unsigned int j = rtag_b[h_tag_a.data[i]];
+        const Scalar diffs[] = {h_pos_a.data[i].x - h_pos_b.data[j].x,
+                                h_pos_a.data[i].y - h_pos_b.data[j].y,
+                                h_pos_a.data[i].z - h_pos_b.data[j].z,
+                                h_vel_a.data[i].x - h_vel_b.data[j].x,
+                                h_vel_a.data[i].y - h_vel_b.data[j].y,
+                                h_vel_a.data[i].z - h_vel_b.data[j].z};
+        for (Scalar diff : diffs)
+            {
+            max_diff = std::max(max_diff, std::abs(diff));
+            }
+        }
+    return max_diff;
+    }
+
     } // end namespace hoomd
 
 #endif // MPCD_TEST_UTILS_H_
@@ -16,16 +16,18 @@ See Also:
 
     simulation = hoomd.util.make_example_simulation()
     operation = simulation.operations.tuners[0]
+    logger = hoomd.logging.Logger()
 """
 
 # Operation is a parent class of almost all other HOOMD objects.
 
 from copy import copy
 import itertools
+import warnings
 import weakref
 
 import hoomd
-from hoomd.logging import Loggable
+from hoomd.logging import log, Loggable
 from hoomd.data.parameterdicts import ParameterDict
 
 
@@ -424,8 +426,39 @@ class AutotunedObject(_HOOMDBaseObject):
     See Also:
         * `hoomd.Operations.is_tuning_complete`
         * `hoomd.Operations.tune_kernel_parameters`
+
+    Tip:
+        Pickling an attached `AutotunedObject` after tuning completes saves
+        `kernel_parameters`. The unpickled object applies them when it attaches
+        to a simulation, so a restarted simulation does not need to tune again.
+        The saved parameters are ignored (with a warning) when they are not
+        valid on the new device.
     """
 
+    _skip_for_equality = _HOOMDBaseObject._skip_for_equality | {
+        '_kernel_parameters'
+    }
+
+    def _attach(self, simulation):
+        super()._attach(simulation)
+        parameters = self.__dict__.pop('_kernel_parameters', None)
+        if parameters is None or not self._attached:
+            return
+        try:
+            self._cpp_obj.setAutotunerParameters(parameters)
+        except RuntimeError as error:
+            warnings.warn(
+                f"Ignoring saved kernel parameters for {type(self)}: {error}",
+                RuntimeWarning)
+
+    def __getstate__(self):
+        state = super().__getstate__()
+        # Tuned parameters stay with the object, partially tuned ones do not.
+        if self._attached and self._cpp_obj.isAutotuningComplete():
+            state['_kernel_parameters'] = dict(
+                self._cpp_obj.getAutotunerParameters())
+        return state
+
     @property
     def kernel_parameters(self):
         """dict[str, tuple[float]]: Kernel parameters.
@@ -524,8 +557,114 @@ class Operation(AutotunedObject):
 
     .. _file: https://github.com/glotzerlab/hoomd-blue/blob/trunk-minor/ \
         ARCHITECTURE.md
+
+    .. rubric:: Timing
+
+    Each operation accumulates the wall time it spends executing, the number
+    of times it executes, and an estimate of the bytes it moves. Log these
+    quantities (`timer_walltime`, `timer_calls`, and `timer_bytes`) to see
+    where the time of each step goes. When HOOMD-blue is built with
+    ``ENABLE_NVTOOLS``, each timed call is also marked by an NVTX range named
+    after the C++ class of the operation.
+
+    The counters accumulate from the time the operation is attached. Take
+    differences between two logged values to measure an interval.
+
+    When HOOMD-blue is built with ``ENABLE_PAPI``, each operation also
+    accumulates CPU hardware performance counters (`timer_hardware_counters`).
+    To collect GPU counters such as DRAM bytes and achieved occupancy, profile
+    with Nsight Compute and filter the kernels by the NVTX range of the
+    operation.
+
+    Note:
+        Times are measured on the host. GPU kernels execute asynchronously, so
+        some of the GPU time of an operation may be attributed to a later
+        operation that waits on the device.
     """
 
+    @log(requires_run=True, default=False)
+    def timer_walltime(self):
+        """float: Wall time spent executing this operation [seconds].
+
+        `timer_walltime` excludes the time spent in other timed operations that
+        this operation calls. For example, the time a pair force spends
+        building its neighbor list is reported by the neighbor list, not the
+        pair force.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=['timer_walltime'])
+        """
+        return self._cpp_obj.timer.walltime
+
+    @log(requires_run=True, default=False)
+    def timer_calls(self):
+        """int: Number of times this operation executed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=['timer_calls'])
+        """
+        return self._cpp_obj.timer.calls
+
+    @log(requires_run=True, default=False)
+    def timer_bytes(self):
+        """int: Estimated bytes of memory traffic of this operation.
+
+        Operations that report bytes count the minimum traffic of the per
+        particle arrays they read and write. Divide by `timer_walltime` to
+        estimate the achieved bandwidth. `timer_bytes` is 0 for operations that
+        do not estimate their memory traffic.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=['timer_bytes'])
+        """
+        return self._cpp_obj.timer.bytes
+
+    @log(category='sequence', requires_run=True, default=False)
+    def timer_hardware_counters(self):
+        """list[int]: CPU hardware performance counters of this operation.
+
+        One value for each name in `timer_hardware_counter_names`. Like
+        `timer_walltime`, the counters exclude other timed operations that this
+        operation calls. Counters are read only on the thread that runs the
+        simulation, so they do not include the work of TBB worker threads.
+
+        `timer_hardware_counters` is empty unless HOOMD-blue is built with
+        ``ENABLE_PAPI`` (see `hoomd.version.papi_enabled`) and the CPU provides
+        the counters.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation, quantities=['timer_hardware_counters'])
+        """
+        return self._cpp_obj.timer.hardware_counters
+
+    @log(category='strings', requires_run=True, default=False)
+    def timer_hardware_counter_names(self):
+        """list[str]: Names of the PAPI events in `timer_hardware_counters`.
+
+        The events are chosen from ``PAPI_TOT_CYC``, ``PAPI_TOT_INS``,
+        ``PAPI_L2_TCM``, and ``PAPI_L3_TCM``, among those available on the CPU.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=operation,
+                       quantities=['timer_hardware_counter_names'])
+        """
+        return list(self._cpp_obj.timer.hardware_counter_names)
+
 
 class TriggeredOperation(Operation):
     """Operations that include a trigger to determine when to run.
@@ -18,12 +18,17 @@ added and removed from a `Simulation`.
 # Operations also automatically handles attaching and detaching (creating and
 # destroying C++ objects) for all hoomd operations.
 
+import hoomd
+import json
+import math
+import os
 import weakref
 from collections.abc import Collection
 from copy import copy
 from itertools import chain
 from hoomd.data import syncedlist
-from hoomd.operation import Writer, Updater, Tuner, Compute, Integrator
+from hoomd.operation import (Writer, Updater, Tuner, Compute, Integrator,
+                             AutotunedObject)
 from hoomd.tune import ParticleSorter
 from hoomd.error import DataAccessError
 from hoomd import _hoomd
@@ -367,6 +372,9 @@ class Operations(Collection):
             raise DataAccessError("is_tuning_complete")
 
         result = all(op.is_tuning_complete for op in self)
+        communicator = self._simulation._system_communicator
+        if communicator is not None:
+            result = result and communicator.isAutotuningComplete()
         if self._simulation.device.communicator.num_ranks == 1:
             return result
         else:
@@ -392,6 +400,165 @@ class Operations(Collection):
         for op in self:
             op.tune_kernel_parameters()
 
+        communicator = self._simulation._system_communicator
+        if communicator is not None:
+            communicator.startAutotuning()
+
+    def save_kernel_parameters(self, filename):
+        """Save the kernel parameters of all children to a cache file.
+
+        Args:
+            filename (str): Path to the cache file.
+
+        The cache file stores the `kernel_parameters` of the operations, their
+        forces, methods, and neighbor lists under a key that identifies the
+        HOOMD-blue version, the active device, the number of MPI ranks, the
+        particle types, and the number of particles and number density rounded
+        to buckets (factors of 2 and :math:`\\sqrt{2}`, respectively). Entries
+        for other keys in an existing file are kept, so many different systems
+        may share one cache file. Use `load_kernel_parameters` to restore the
+        saved parameters in a later simulation of a similar system.
+
+        Call `save_kernel_parameters` after tuning completes.
+
+        Note:
+            In MPI parallel execution, the kernel parameters of rank 0 are
+            saved.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            while (not simulation.operations.is_tuning_complete):
+                simulation.run(1000)
+            simulation.operations.save_kernel_parameters(
+                filename=tmp_path / 'kernel_parameters.json')
+        """
+        if not self._scheduled:
+            raise RuntimeError("Call Simulation.run() before "
+                               "save_kernel_parameters.")
+
+        if self._simulation.device.communicator.rank != 0:
+            return
+
+        cache = {}
+        if os.path.exists(filename):
+            with open(filename) as f:
+                cache = json.load(f)
+
+        cache[self._kernel_parameter_signature()] = {
+            key: {
+                name: list(value)
+                for name, value in obj.kernel_parameters.items()
+            } for key, obj in self._autotuned_objects().items()
+        }
+
+        with open(filename, 'w') as f:
+            json.dump(cache, f, indent=1, sort_keys=True)
+
+    def load_kernel_parameters(self, filename):
+        """Load the kernel parameters of all children from a cache file.
+
+        Args:
+            filename (str): Path to the cache file.
+
+        Look up the entry that `save_kernel_parameters` wrote for a
+        simulation with the same signature and set the `kernel_parameters` of
+        the matching children, which stops their tuning. Children that do not
+        match an entry, or whose saved parameters are not valid for the
+        current kernels, continue to tune.
+
+        Returns:
+            bool: ``True`` when the file has an entry for this simulation.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.operations.load_kernel_parameters(
+                filename=tmp_path / 'kernel_parameters.json')
+        """
+        if not self._scheduled:
+            raise RuntimeError("Call Simulation.run() before "
+                               "load_kernel_parameters.")
+
+        if not os.path.exists(filename):
+            return False
+
+        with open(filename) as f:
+            cache = json.load(f)
+
+        entry = cache.get(self._kernel_parameter_signature())
+        if entry is None:
+            return False
+
+        for key, obj in self._autotuned_objects().items():
+            if key not in entry:
+                continue
+            try:
+                obj.kernel_parameters = {
+                    name: tuple(value) for name, value in entry[key].items()
+                }
+            except RuntimeError:
+                # the saved parameters do not match the current kernels
+                obj.tune_kernel_parameters()
+
+        return True
+
+    def _kernel_parameter_signature(self):
+        """Key identifying simulations that share kernel parameters."""
+        simulation = self._simulation
+        state = simulation.state
+        N = state.N_particles
+        density = N / state.box.volume
+        return json.dumps([
+            hoomd.version.version,
+            type(simulation.device).__name__,
+            simulation.device.device,
+            simulation.device.communicator.num_ranks,
+            state.particle_types,
+            N.bit_length(),
+            round(2 * math.log2(density)) if density > 0 else None,
+        ])
+
+    def _autotuned_objects(self):
+        """Attached autotuned objects reachable from the operations.
+
+        The keys combine the depth-first visit order with the class name so
+        that a script with the same structure maps each object to the same
+        key.
+        """
+        objects = {}
+        seen = set()
+
+        def visit(obj):
+            if id(obj) in seen:
+                return
+            seen.add(id(obj))
+            if obj._attached:
+                objects[f"{len(objects)}:{type(obj).__module__}."
+                        f"{type(obj).__qualname__}"] = obj
+
+            values = [
+                value for name, value in vars(obj).items()
+                if name not in ('_dependents', '_dependencies')
+            ]
+            param_dict = getattr(obj, '_param_dict', None)
+            if param_dict is not None:
+                values.extend(param_dict._dict.values())
+
+            for value in values:
+                if isinstance(value, AutotunedObject):
+                    visit(value)
+                elif isinstance(value, (syncedlist.SyncedList, list, tuple)):
+                    for item in value:
+                        if isinstance(item, AutotunedObject):
+                            visit(item)
+
+        for op in self:
+            visit(op)
+        return objects
+
     def __getstate__(self):
         """Get the current state of the operations container for pickling."""
         # ensure that top level changes to self.__dict__ are not propagated
@@ -37,6 +37,14 @@ def test_balance_properties():
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert not balance.time_weighted
+    balance.time_weighted = True
+    assert balance.time_weighted
+
+    assert balance.weight['A'] == 1.0
+    balance.weight['A'] = 2.5
+    assert balance.weight['A'] == 2.5
+
 
 def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -75,6 +83,10 @@ def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.weight['A'] == 1.0
+    balance.weight['A'] = 2.5
+    assert balance.weight['A'] == 2.5
+
     sim.operations.tuners.remove(balance)
 
 
@@ -91,7 +103,9 @@ def test_pickling(simulation_factory, two_particle_snapshot_factory):
     operation_pickling_check(balance, sim)
 
 
-def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
+@pytest.mark.parametrize("time_weighted", [False, True])
+def test_balance_action(device, simulation_factory, lattice_snapshot_factory,
+                        time_weighted):
     """Test that the load balancer does something."""
     if device.communicator.num_ranks != 2:
         pytest.skip("Test supports only 2 ranks")
@@ -108,9 +122,10 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
     sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
     assert sim.state.domain_decomposition_split_fractions == ([], [], [0.5])
 
-    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(1))
+    balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(1),
+                                      time_weighted=time_weighted)
     sim.operations.tuners.append(balance)
-    sim.run(1)
+    sim.run(2)
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
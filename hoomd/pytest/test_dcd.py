@@ -47,6 +47,38 @@ def test_write(simulation_factory, two_particle_snapshot_factory, tmp_path):
                 np.testing.assert_allclose(traj[i].position[j], positions[i][j])
 
 
+def test_write_group_unwrapped(simulation_factory,
+                               two_particle_snapshot_factory, tmp_path):
+    filename = tmp_path / "temporary_test_file.dcd"
+    snap = two_particle_snapshot_factory()
+    if snap.communicator.rank == 0:
+        snap.particles.image[1] = [1, -1, 2]
+    sim = simulation_factory(snap)
+    dcd_dump = hoomd.write.DCD(filename=filename,
+                               trigger=hoomd.trigger.Periodic(1),
+                               filter=hoomd.filter.Tags([1]),
+                               unwrap_full=True)
+    sim.operations.add(dcd_dump)
+    sim.run(2)
+
+    if sim.device.communicator.rank == 0:
+        box = sim.state.box
+        expected = (np.asarray(snap.particles.position[1])
+                    + np.array([1, -1, 2]) * [box.Lx, box.Ly, box.Lz])
+
+        # header: 84 byte record, 164 byte title record, 4 byte atom count
+        data = np.fromfile(filename, dtype=np.uint8)
+        header_size = (84 + 8) + (164 + 8) + (4 + 8)
+        assert data[header_size - 8:header_size - 4].view(np.uint32)[0] == 1
+
+        # each frame: 48 byte unit cell record, then x, y, and z records
+        frame_size = (48 + 8) + 3 * (4 + 8)
+        assert len(data) == header_size + 2 * frame_size
+        frame = data[header_size:header_size + frame_size]
+        coords = frame[48 + 8:].reshape(3, 12)[:, 4:8].copy().view(np.float32)
+        np.testing.assert_allclose(coords[:, 0], expected, rtol=1e-6)
+
+
 def test_pickling(simulation_factory, two_particle_snapshot_factory, tmp_path):
     filename = tmp_path / "temporary_test_file.dcd"
     sim = simulation_factory(two_particle_snapshot_factory())
@@ -40,6 +40,11 @@ def test_common_properties(device, tmp_path):
     device.num_cpu_threads = 5
     _assert_common_properties(device, 3, str(tmp_path / "example.txt"), 5)
 
+    assert not device.deterministic_reduction
+    device.deterministic_reduction = True
+    assert device.deterministic_reduction
+    device.deterministic_reduction = False
+
     # now make a device with non-default arguments
     device_type = type(device)
     dev = device_type(message_filename=str(tmp_path / "example2.txt"),
@@ -60,6 +65,18 @@ def test_gpu_specific_properties(device):
     device.gpu_error_checking = False
     assert not device.gpu_error_checking
 
+    assert not device.autotuner_successive_halving
+    device.autotuner_successive_halving = True
+    assert device.autotuner_successive_halving
+    device.autotuner_successive_halving = False
+
+    assert device.autotuner_retune_threshold == 0
+    device.autotuner_retune_threshold = 0.25
+    assert device.autotuner_retune_threshold == 0.25
+    with pytest.raises(ValueError):
+        device.autotuner_retune_threshold = -1
+    device.autotuner_retune_threshold = 0
+
     # make sure we can give a list of GPU ids to the constructor
     hoomd.device.GPU(gpu_ids=[0])
     hoomd.device.GPU(gpu_id=0)
@@ -210,6 +210,20 @@ def test_difference(make_filter_snapshot, simulation_factory, set_indices):
         assert difference_filter(sim.state) == combo_filter(sim.state)
 
 
+@pytest.mark.parametrize("tags_f, tags_g", [([3, 1, 2, 1], [2, 0]),
+                                            ([5, 1000000], [7, 5])])
+def test_set_operations_on_tags(make_filter_snapshot, simulation_factory,
+                                tags_f, tags_g):
+    """Cover the dense and sparse paths for combining tags."""
+    filter_snapshot = make_filter_snapshot(n=10, particle_types=['A'])
+    sim = simulation_factory(filter_snapshot)
+    f = Tags(tags_f)
+    g = Tags(tags_g)
+    assert Union(f, g)(sim.state) == sorted(set(tags_f) | set(tags_g))
+    assert Intersection(f, g)(sim.state) == sorted(set(tags_f) & set(tags_g))
+    assert SetDifference(f, g)(sim.state) == sorted(set(tags_f) - set(tags_g))
+
+
 _filter_classes = [
     All,
     Tags,
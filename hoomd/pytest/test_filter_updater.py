@@ -116,3 +116,30 @@ def test_pickling(simulation):
     ]
     hoomd.conftest.operation_pickling_check(
         hoomd.update.FilterUpdater(1, filters), simulation)
+
+
+@pytest.mark.skipif(not hoomd.version.md_built, reason="BUILD_MD=on required")
+def test_updating_dof(simulation):
+    type_filter = hoomd.filter.Type(["A"])
+    thermo = hoomd.md.compute.ThermodynamicQuantities(type_filter)
+    simulation.operations.computes.append(thermo)
+    simulation.operations.integrator = hoomd.md.Integrator(
+        0.005,
+        methods=[hoomd.md.methods.ConstantVolume(filter=hoomd.filter.All())])
+    simulation.operations += hoomd.update.FilterUpdater(1, [type_filter])
+    simulation.run(0)
+    N = simulation.state.N_particles
+
+    def expected_dof():
+        n_A = len(simulation.state._get_group(type_filter).member_tags)
+        return 3 * n_A - 3 * n_A / N
+
+    assert thermo.translational_degrees_of_freedom == pytest.approx(
+        expected_dof())
+
+    # Only the thermo group changes, and its degrees of freedom follow.
+    with simulation.state.cpu_local_snapshot as snapshot:
+        snapshot.particles.typeid[:] = 1
+    simulation.run(1)
+    assert thermo.translational_degrees_of_freedom == pytest.approx(
+        expected_dof())
@@ -0,0 +1,34 @@
+# Copyright (c) 2009-2024 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+import subprocess
+import sys
+
+import pytest
+
+import hoomd
+
+
+def run_python(code):
+    """Run code in a fresh interpreter to start from an unused hoomd import."""
+    subprocess.run([sys.executable, '-c', code], check=True)
+
+
+@pytest.mark.serial
+@pytest.mark.parametrize('subpackage', ['md', 'hpmc'])
+def test_lazy_subpackage(subpackage):
+    if not getattr(hoomd.version, subpackage + '_built'):
+        pytest.skip(f'hoomd.{subpackage} is not built.')
+
+    run_python(f"""import sys
+import hoomd
+assert 'hoomd.{subpackage}' not in sys.modules
+assert '{subpackage}' in dir(hoomd)
+assert hoomd.{subpackage}.__name__ == 'hoomd.{subpackage}'
+assert 'hoomd.{subpackage}' in sys.modules
+""")
+
+
+def test_missing_attribute():
+    with pytest.raises(AttributeError):
+        hoomd.not_a_subpackage
@@ -5,7 +5,7 @@
 
 from copy import deepcopy
 import hoomd
-from hoomd.data.array import HOOMDGPUArray
+from hoomd.data.array import HOOMDGPUArray, HOOMDArrayError
 import numpy as np
 import pytest
 try:
@@ -493,6 +493,30 @@ class TestLocalSnapshots:
                 tags = getattr(snapshot_section, tag_name)
                 property_check(hoomd_buffer, property_dict, tags)
 
+    @pytest.mark.cupy_optional
+    def test_gpu_stream_protocols(self, base_simulation):
+        sim = base_simulation()
+        if isinstance(sim.device, hoomd.device.CPU):
+            pytest.skip("GPU arrays are not available on the CPU.")
+
+        with sim.state.gpu_local_snapshot as data:
+            position = data.particles.position
+            interface = position.__cuda_array_interface__
+            assert interface['version'] == 3
+            assert interface['stream'] == 1
+            assert position.__dlpack_device__()[0] in (2, 10)
+            if CUPY_IMPORTED:
+                stream = cupy.cuda.Stream(non_blocking=True)
+                with stream:
+                    array = cupy.from_dlpack(position)
+                    array[:, 0] = 0.5
+                sim.device.wait_for_stream(stream.ptr)
+                assert cupy.allclose(
+                    cupy.array(data.particles.position, copy=False)[:, 0], 0.5)
+
+        with pytest.raises(HOOMDArrayError):
+            position.__dlpack__()
+
     def test_run_failure(self, base_simulation):
         sim = base_simulation()
         for lcl_snapshot_attr in self.get_snapshot_attr(sim):
@@ -498,6 +498,22 @@ class TestLogger:
         assert inner_dict['prop'] == (logged_obj.prop, 'scalar')
         assert inner_dict['proplist'] == (logged_obj.proplist, 'sequence')
 
+    def test_log_flat(self, logged_obj, base_namespace):
+        log = Logger()
+        log += logged_obj
+        logged = log._log_flat()
+        assert logged[base_namespace + ('prop',)] == (logged_obj.prop, 'scalar')
+        assert logged[base_namespace + ('proplist',)] == (logged_obj.proplist,
+                                                          'sequence')
+
+        # The cached entries follow additions and removals.
+        log[('a', 'b')] = (lambda: 4, 'scalar')
+        assert log._log_flat()[('a', 'b')] == (4, 'scalar')
+        log.remove(logged_obj, 'prop')
+        logged = log._log_flat()
+        assert base_namespace + ('prop',) not in logged
+        assert len(logged) == 2
+
     def test_pickling(self, blank_logger, logged_obj):
         blank_logger.add(logged_obj)
         pickling_check(blank_logger)
@@ -280,6 +280,31 @@ def test_state_from_gsd_box_dims(device, simulation_factory,
         assert sim.state.box.yz == 0.0
 
 
+@skip_gsd
+def test_state_from_gsd_distributed(device, simulation_factory,
+                                    lattice_snapshot_factory, tmp_path):
+    snap = lattice_snapshot_factory(n=10, particle_types=['A', 'B'])
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[::3] = 1
+        snap.bonds.N = 50
+        snap.bonds.types = ['b']
+        snap.bonds.group[:] = [[2 * i, 2 * i + 1] for i in range(50)]
+
+    d = tmp_path / "sub"
+    d.mkdir()
+    filename = d / "temporary_test_file.gsd"
+    if device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='w') as f:
+            f.append(make_gsd_frame(snap))
+
+    sim = simulation_factory()
+    sim.create_state_from_gsd(filename, distributed=True)
+    assert sim.state.N_particles == 1000
+    assert sim.state.N_bonds == 50
+
+    assert_equivalent_snapshots(snap, sim.state.get_snapshot())
+
+
 @skip_gsd
 def test_state_from_gsd_frame(simulation_factory, lattice_snapshot_factory,
                               device, state_args, tmp_path):
@@ -520,5 +545,45 @@ def test_logging():
             'walltime': {
                 'category': LoggerCategories.scalar,
                 'default': True
+            },
+            'communication_walltime': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
+            'communication_calls': {
+                'category': LoggerCategories.scalar,
+                'default': False
+            },
+            'communication_bytes': {
+                'category': LoggerCategories.scalar,
+                'default': False
             }
         })
+
+
+def test_operation_timers(simulation_factory, lattice_snapshot_factory):
+    sim = simulation_factory(lattice_snapshot_factory())
+    updater = hoomd.update.FilterUpdater(1, [hoomd.filter.All()])
+    sim.operations.updaters.append(updater)
+
+    with pytest.raises(hoomd.error.DataAccessError):
+        updater.timer_walltime
+
+    sim.run(10)
+    assert updater.timer_calls == 10
+    assert updater.timer_walltime >= 0
+    assert updater.timer_bytes == 0
+
+    # timers accumulate over calls to run
+    walltime = updater.timer_walltime
+    sim.run(5)
+    assert updater.timer_calls == 15
+    assert updater.timer_walltime >= walltime
+    assert sim.communication_walltime >= 0
+    assert sim.communication_bytes >= 0
+
+    names = updater.timer_hardware_counter_names
+    counters = updater.timer_hardware_counters
+    assert len(counters) == len(names)
+    if not hoomd.version.papi_enabled:
+        assert names == []
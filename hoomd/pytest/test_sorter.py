@@ -5,6 +5,7 @@
 
 from hoomd.conftest import operation_pickling_check
 import hoomd
+import numpy
 
 
 def test_attributes():
@@ -44,3 +45,31 @@ def test_pickling(simulation_factory, two_particle_snapshot_factory):
     # simulation
     sorter = sim.operations.tuners.pop()
     operation_pickling_check(sorter, sim)
+
+
+def test_sort_bonded_groups(simulation_factory):
+    """Test that sorting reorders bonds without changing the bond data."""
+    snapshot = hoomd.Snapshot()
+    N = 200
+    rng = numpy.random.default_rng(3)
+    if snapshot.communicator.rank == 0:
+        snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+        snapshot.particles.N = N
+        snapshot.particles.types = ['A']
+        snapshot.particles.position[:] = rng.uniform(-5, 5, size=(N, 3))
+        snapshot.bonds.types = ['A-A', 'B-B']
+        snapshot.bonds.N = N - 1
+        snapshot.bonds.group[:] = rng.permutation(
+            [[i, i + 1] for i in range(N - 1)])
+        snapshot.bonds.typeid[:] = rng.integers(0, 2, size=N - 1)
+
+    sim = simulation_factory(snapshot)
+    sim.operations.tuners[0].trigger = hoomd.trigger.Periodic(1)
+    sim.run(2)
+
+    new_snapshot = sim.state.get_snapshot()
+    if new_snapshot.communicator.rank == 0:
+        numpy.testing.assert_array_equal(new_snapshot.bonds.group,
+                                         snapshot.bonds.group)
+        numpy.testing.assert_array_equal(new_snapshot.bonds.typeid,
+                                         snapshot.bonds.typeid)
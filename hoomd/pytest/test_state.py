@@ -176,6 +176,32 @@ def test_modify_snapshot(simulation_factory, snap):
     assert_snapshots_equal(snap, snap2)
 
 
+def test_modify_snapshot_positions(simulation_factory, snap):
+    sim = simulation_factory()
+    sim.create_state_from_snapshot(snap)
+    type_a = hoomd.filter.Type(['A'])
+    n_typeid = sim.state.get_group(type_a).N_global
+
+    # a snapshot that changes the box, positions, and images
+    snap = sim.state.get_snapshot()
+    if snap.communicator.rank == 0:
+        snap.configuration.box = [22, 22, 22, 0, 0, 0]
+        snap.particles.position[:] *= 1.05
+        snap.particles.image[:] += 1
+
+    sim.state.set_snapshot(snap)
+    assert_snapshots_equal(snap, sim.state.get_snapshot())
+    assert sim.state.get_group(type_a).N_global == n_typeid
+
+    # a snapshot that changes other particle properties too
+    if snap.communicator.rank == 0:
+        snap.particles.position[:] *= 0.99
+        snap.particles.velocity[:] *= 2
+
+    sim.state.set_snapshot(snap)
+    assert_snapshots_equal(snap, sim.state.get_snapshot())
+
+
 def test_thermalize_particle_velocity(simulation_factory,
                                       lattice_snapshot_factory):
     snap = lattice_snapshot_factory()
@@ -271,6 +297,32 @@ def test_replicate(simulation_factory, lattice_snapshot_factory):
     assert_snapshots_equal(initial_snapshot, new_snapshot)
 
 
+def test_replicate_bonds(simulation_factory, lattice_snapshot_factory):
+    initial_snapshot = lattice_snapshot_factory(a=2, n=(3, 2, 2))
+    if initial_snapshot.communicator.rank == 0:
+        initial_snapshot.bonds.types = ['A']
+        initial_snapshot.bonds.N = 4
+        initial_snapshot.bonds.group[:] = [[0, 1], [1, 2], [4, 7], [8, 11]]
+        initial_snapshot.angles.types = ['A']
+        initial_snapshot.angles.N = 1
+        initial_snapshot.angles.group[:] = [[0, 1, 2]]
+
+    sim = simulation_factory(initial_snapshot)
+
+    # replicating the state distributes the images over the ranks, the tags
+    # must match those of a replicated snapshot
+    initial_snapshot.replicate(3, 2, 2)
+    sim.state.replicate(3, 2, 2)
+    new_snapshot = sim.state.get_snapshot()
+    assert_snapshots_equal(initial_snapshot, new_snapshot)
+    if new_snapshot.communicator.rank == 0:
+        assert new_snapshot.particles.N == 12 * 12
+        assert new_snapshot.bonds.N == 4 * 12
+        numpy.testing.assert_array_equal(new_snapshot.bonds.group[4:8],
+                                         [[12, 13], [13, 14], [16, 19],
+                                          [20, 23]])
+
+
 def test_domain_decomposition(device, simulation_factory,
                               lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -136,3 +136,42 @@ def test_custom():
     # test that the custom trigger can be called from c++
     assert hoomd._hoomd._test_trigger_call(c, 0)
     assert not hoomd._hoomd._test_trigger_call(c, 250000000001)
+
+
+@pytest.mark.parametrize('trigger, eval_func',
+                         zip(triggers(), _eval_funcs),
+                         ids=_test_name)
+def test_next_timestep(trigger, eval_func):
+    fires = [i for i in range(1100) if eval_func(i)]
+    for i in range(1000):
+        next_timestep = trigger._next_timestep(i)
+        assert next_timestep >= i
+        # the prediction is a lower bound on the next step that fires
+        upcoming = [j for j in fires if j >= i]
+        if upcoming:
+            assert next_timestep <= upcoming[0]
+
+
+class CountingTrigger(hoomd.trigger.Trigger):
+
+    def __init__(self):
+        hoomd.trigger.Trigger.__init__(self)
+        self.calls = 0
+
+    def compute(self, timestep):
+        self.calls += 1
+        return True
+
+
+def test_composite_skips_operands():
+    counting = CountingTrigger()
+    trigger = hoomd.trigger.And([counting, hoomd.trigger.Periodic(100)])
+    for i in range(1000):
+        assert hoomd._hoomd._test_trigger_call(trigger, i) == (i % 100 == 0)
+    assert counting.calls == 10
+
+    counting = CountingTrigger()
+    trigger = hoomd.trigger.Or([hoomd.trigger.On(10), counting])
+    for i in range(100):
+        assert hoomd._hoomd._test_trigger_call(trigger, i)
+    assert counting.calls == 99
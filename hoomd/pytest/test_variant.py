@@ -231,3 +231,58 @@ def test_custom():
     for i in range(0, 10000, 100):
         assert (hoomd._hoomd._test_variant_call(pkled_variant,
                                                 i) == float(i)**(1 / 2))
+
+
+def test_piecewise():
+    points = [(10, 1.0), (20, 3.0), (40, -1.0)]
+    variant = hoomd.variant.Piecewise(points)
+    assert variant.points == points
+    assert variant.min == -1.0
+    assert variant.max == 3.0
+
+    timesteps, values = zip(*points)
+    for i in range(60):
+        assert np.isclose(variant(i), np.interp(i, timesteps, values))
+        assert np.isclose(hoomd._hoomd._test_variant_call(variant, i),
+                          np.interp(i, timesteps, values))
+
+    pickling_check(variant)
+
+    with pytest.raises(ValueError):
+        hoomd.variant.Piecewise([])
+    with pytest.raises(ValueError):
+        hoomd.variant.Piecewise([(10, 1.0), (10, 2.0)])
+
+
+def test_sequence():
+    ramp = hoomd.variant.Ramp(A=1.0, B=2.0, t_start=0, t_ramp=100)
+    custom = CustomVariant()
+    variant = hoomd.variant.Sequence(variants=[ramp, 5.0, custom],
+                                     t_switch=[50, 100])
+    assert variant.t_switch == [50, 100]
+    assert variant.variants[0] is ramp
+    assert variant.variants[1] == hoomd.variant.Constant(5.0)
+    assert variant.variants[2] is custom
+    assert variant.min == 0.0
+    assert variant.max == 5.0
+
+    for i in range(200):
+        if i < 50:
+            expected = ramp(i)
+        elif i < 100:
+            expected = 5.0
+        else:
+            expected = custom(i)
+        assert np.isclose(hoomd._hoomd._test_variant_call(variant, i),
+                          expected)
+
+    variant.t_switch = [60, 100]
+    assert np.isclose(variant(55), ramp(55))
+
+    pickling_check(variant)
+
+    with pytest.raises(ValueError):
+        hoomd.variant.Sequence(variants=[ramp, custom], t_switch=[])
+    with pytest.raises(ValueError):
+        hoomd.variant.Sequence(variants=[ramp, ramp, ramp],
+                               t_switch=[100, 50])
@@ -188,7 +188,8 @@ class Simulation(metaclass=Loggable):
     def create_state_from_gsd(self,
                               filename,
                               frame=-1,
-                              domain_decomposition=(None, None, None)):
+                              domain_decomposition=(None, None, None),
+                              distributed=False):
         """Create the simulation state from a GSD file.
 
         Args:
@@ -205,9 +206,19 @@ class Simulation(metaclass=Loggable):
                 to include in each domain. The sum of each list of floats must
                 be 1.0 (e.g. ``([0.25, 0.75], [0.2, 0.8], [1.0])``).
 
+            distributed (bool): When `True`, every MPI rank reads a slice of
+                the particles and bonded groups from the file and sends them
+                directly to the ranks that own them.
+
         When `timestep` is `None` before calling, `create_state_from_gsd`
         sets `timestep` to the value in the selected GSD frame in the file.
 
+        By default, the root rank reads the whole frame and scatters it to the
+        other ranks. With ``distributed=True``, no rank reads or stores the
+        whole frame, which reduces the time and memory needed to initialize
+        large systems on many ranks. ``distributed`` has no effect on a single
+        rank.
+
         Note:
             Set any or all of the ``domain_decomposition`` tuple elements to
             `None` and `create_state_from_gsd` will select a value that
@@ -228,7 +239,7 @@ class Simulation(metaclass=Loggable):
         filename = _hoomd.mpi_bcast_str(filename, self.device._cpp_exec_conf)
         # Grab snapshot and timestep
         reader = _hoomd.GSDReader(self.device._cpp_exec_conf, filename,
-                                  abs(frame), frame < 0)
+                                  abs(frame), frame < 0, distributed)
         snapshot = Snapshot._from_cpp_snapshot(reader.getSnapshot(),
                                                self.device.communicator)
 
@@ -407,6 +418,60 @@ class Simulation(metaclass=Loggable):
         else:
             return self._cpp_sys.walltime
 
+    @log(default=False)
+    def communication_walltime(self):
+        """float: Wall time spent communicating between MPI ranks [seconds].
+
+        `communication_walltime` accumulates the time spent migrating particles
+        and exchanging ghost particles since the simulation state was created.
+        It excludes the time of operations that execute during communication
+        (see `hoomd.operation.Operation.timer_walltime`) and is 0 when the
+        simulation is not domain decomposed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['communication_walltime'])
+        """
+        if getattr(self, '_system_communicator', None) is None:
+            return 0.0
+        else:
+            return self._system_communicator.timer.walltime
+
+    @log(default=False)
+    def communication_calls(self):
+        """int: Number of times the simulation communicated between MPI ranks.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['communication_calls'])
+        """
+        if getattr(self, '_system_communicator', None) is None:
+            return 0
+        else:
+            return self._system_communicator.timer.calls
+
+    @log(default=False)
+    def communication_bytes(self):
+        """int: Bytes of particle data this rank sent to other ranks.
+
+        Only communication on the CPU counts bytes. `communication_bytes` is 0
+        with GPU devices and when the simulation is not domain decomposed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            logger.add(obj=simulation, quantities=['communication_bytes'])
+        """
+        if getattr(self, '_system_communicator', None) is None:
+            return 0
+        else:
+            return self._system_communicator.timer.bytes
+
     @log
     def final_timestep(self):
         """float: `run` will end at this timestep.
@@ -495,6 +560,14 @@ class Simulation(metaclass=Loggable):
         Note:
             Initialize the simulation's state before calling `run`.
 
+        Note:
+            `run` releases the Python global interpreter lock while it
+            advances the simulation and reacquires it only to call Python
+            code (custom actions, triggers, variants, loggers) and to check
+            for signals. Other Python threads may run concurrently, but they
+            must not modify the simulation's state or operations until `run`
+            returns.
+
         `Simulation` applies its `operations` to the
         state during each time step in the order: tuners, updaters, integrator,
         then writers following the logic in this pseudocode::
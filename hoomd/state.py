@@ -330,6 +330,13 @@ class State:
             \\ldots)` operation and is very expensive when the simulation device
             is a GPU.
 
+        Tip:
+            When the snapshot differs from the current state only in the box,
+            particle positions, and images (for example, a snapshot from
+            `get_snapshot` with modified positions), `set_snapshot` updates the
+            particles in place instead of reinitializing the state. This fast
+            path is not available with domain decomposition.
+
         See Also:
             `get_snapshot`
 
@@ -598,6 +605,14 @@ class State:
         second, and third box lattice vectors respectively and adjusts the
         particle positions to center them in the new box.
 
+        With more than one MPI rank, `replicate` sends the initial state to all
+        ranks and each rank builds a contiguous slice of the images, including
+        their bonded groups. The ranks then exchange the new particles with the
+        ranks that own their domains. No rank holds more than its slice of the
+        replicated system, so `replicate` can build systems that are too large
+        for the memory of a single rank. The result is the same as replicating
+        a `Snapshot` with `Snapshot.replicate`.
+
         .. rubric:: Example:
 
         .. code-block:: python
@@ -605,7 +620,11 @@ class State:
             simulation.state.replicate(nx=2, ny=2, nz=2)
         """
         snap = self.get_snapshot()
-        snap.replicate(nx, ny, nz)
+        if self._simulation.device.communicator.num_ranks > 1:
+            snap._cpp_obj._replicate_distributed(
+                nx, ny, nz, self._simulation.device._cpp_exec_conf)
+        else:
+            snap.replicate(nx, ny, nz)
         self.set_snapshot(snap)
 
     def _get_group(self, filter_):
@@ -655,6 +674,31 @@ class State:
         """
         self._simulation._cpp_sys.updateGroupDOFOnNextStep()
 
+    @property
+    def memory_usage(self):
+        """int: Bytes allocated for the particle data arrays on this rank.
+
+        The particle data arrays grow as needed, but do not shrink when the
+        number of local particles decreases. Call `compact_memory` to release
+        the unused capacity.
+        """
+        return self._cpp_sys_def.getParticleData().getMemoryUsage()
+
+    def compact_memory(self):
+        """Release particle data capacity that is not in use on this rank.
+
+        Call `compact_memory` between calls to `Simulation.run` after a
+        transient increase in the number of local particles. Arrays grow again
+        as needed.
+
+        .. rubric:: Example:
+
+        .. code-block:: python
+
+            simulation.state.compact_memory()
+        """
+        self._cpp_sys_def.getParticleData().compactMemory()
+
     @property
     def cpu_local_snapshot(self):
         """hoomd.data.LocalSnapshot: Expose simulation data on the CPU.
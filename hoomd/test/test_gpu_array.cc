@@ -207,6 +207,53 @@ UP_TEST(GPUArray_transfer_tests)
         }
     }
 
+//! test case for prefetching device data to the host on a stream
+UP_TEST(GPUArray_prefetch_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::GPU));
+    UP_ASSERT(exec_conf->isCUDAEnabled());
+
+    GPUArray<int> gpu_array(100, exec_conf);
+
+    hipStream_t stream;
+    hipStreamCreate(&stream);
+    hipEvent_t event;
+    hipEventCreateWithFlags(&event, hipEventDisableTiming);
+
+        {
+        ArrayHandle<int> d_handle(gpu_array, access_location::device, access_mode::overwrite);
+        gpu_fill_test_pattern(d_handle.data, gpu_array.getNumElements());
+        hipError_t err_sync = hipPeekAtLastError();
+        exec_conf->handleHIPError(err_sync, __FILE__, __LINE__);
+        }
+
+    // a blocking stream orders the copy after the kernel on the default stream
+    gpu_array.prefetchHost(stream, event);
+
+        // the host handle waits for the prefetched copy
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read);
+        for (int i = 0; i < (int)gpu_array.getNumElements(); i++)
+            UP_ASSERT_EQUAL(h_handle.data[i], i * i);
+        }
+
+    // the data is current on the host, so a second prefetch does not copy stale data back
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::readwrite);
+        h_handle.data[0] = -1;
+        }
+    gpu_array.prefetchHost(stream, event);
+
+        {
+        ArrayHandle<int> h_handle(gpu_array, access_location::host, access_mode::read);
+        UP_ASSERT_EQUAL(h_handle.data[0], -1);
+        }
+
+    hipEventDestroy(event);
+    hipStreamDestroy(stream);
+    }
+
 //! Tests operations on NULL GPUArrays
 UP_TEST(GPUArray_null_tests)
     {
@@ -347,6 +394,43 @@ UP_TEST(GPUArray_resize_tests)
         }
     }
 
+//! Tests that the write generation tracks writes, resizes, and swaps
+UP_TEST(GPUArray_write_generation_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    GPUArray<int> a(10, exec_conf);
+    GPUArray<int> b(10, exec_conf);
+    UP_ASSERT(a.getWriteGeneration() != b.getWriteGeneration());
+
+    uint64_t generation = a.getWriteGeneration();
+        {
+        ArrayHandle<int> h_a(a, access_location::host, access_mode::read);
+        }
+    UP_ASSERT_EQUAL(a.getWriteGeneration(), generation);
+
+        {
+        ArrayHandle<int> h_a(a, access_location::host, access_mode::readwrite);
+        }
+    UP_ASSERT(a.getWriteGeneration() != generation);
+
+    generation = a.getWriteGeneration();
+        {
+        ArrayHandle<int> h_a(a, access_location::host, access_mode::overwrite);
+        }
+    UP_ASSERT(a.getWriteGeneration() != generation);
+
+    generation = a.getWriteGeneration();
+    a.resize(20);
+    UP_ASSERT(a.getWriteGeneration() != generation);
+
+    generation = a.getWriteGeneration();
+    uint64_t generation_b = b.getWriteGeneration();
+    a.swap(b);
+    UP_ASSERT_EQUAL(a.getWriteGeneration(), generation_b);
+    UP_ASSERT_EQUAL(b.getWriteGeneration(), generation);
+    }
+
 //! Tests GPUVector
 UP_TEST(GPUVector_basic_tests)
     {
@@ -615,6 +615,197 @@ UP_TEST(ParticleData_test)
         }
     }
 
+//! Tests that the structure of arrays views follow writes to the particle data
+UP_TEST(ParticleData_soa_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(3, box, 1, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        ArrayHandle<Scalar4> h_vel(pdata.getVelocities(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        for (unsigned int i = 0; i < 3; i++)
+            {
+            h_pos.data[i] = make_scalar4(Scalar(i), Scalar(2 * i), Scalar(3 * i), 0);
+            h_vel.data[i] = make_scalar4(Scalar(-1.0 * i), 0, Scalar(0.5), Scalar(i + 1));
+            }
+        }
+
+    const detail::scalar4_soa& pos = pdata.getPositionsSoA();
+    UP_ASSERT_EQUAL(pos.x.size(), (size_t)3);
+    for (unsigned int i = 0; i < 3; i++)
+        {
+        MY_CHECK_CLOSE(pos.x[i], Scalar(i), tol);
+        MY_CHECK_CLOSE(pos.y[i], Scalar(2 * i), tol);
+        MY_CHECK_CLOSE(pos.z[i], Scalar(3 * i), tol);
+        }
+
+    const detail::scalar4_soa& vel = pdata.getVelocitiesSoA();
+    for (unsigned int i = 0; i < 3; i++)
+        {
+        MY_CHECK_CLOSE(vel.x[i], Scalar(-1.0 * i), tol);
+        MY_CHECK_CLOSE(vel.z[i], 0.5, tol);
+        MY_CHECK_CLOSE(vel.w[i], Scalar(i + 1), tol);
+        }
+
+        // writing the positions invalidates the cache
+        {
+        ArrayHandle<Scalar4> h_pos(pdata.getPositions(),
+                                   access_location::host,
+                                   access_mode::readwrite);
+        h_pos.data[1].x = Scalar(4.5);
+        }
+
+    MY_CHECK_CLOSE(pdata.getPositionsSoA().x[1], 4.5, tol);
+    MY_CHECK_CLOSE(pdata.getPositionsSoA().y[1], 2.0, tol);
+    }
+
+//! Tests adding and removing batches of particles
+UP_TEST(ParticleData_batch_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(4, box, 2, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+    for (unsigned int tag = 0; tag < 4; tag++)
+        pdata.setPosition(tag, make_scalar3(Scalar(tag), 0, 0));
+
+    // remove particles in the middle and at the end of the arrays
+    pdata.removeParticlesByTag(std::vector<unsigned int> {1, 3, 0});
+    UP_ASSERT_EQUAL(pdata.getN(), (unsigned int)1);
+    UP_ASSERT_EQUAL(pdata.getNGlobal(), (unsigned int)1);
+    UP_ASSERT_EQUAL(pdata.getRTag(2), (unsigned int)0);
+    UP_ASSERT_EQUAL(pdata.getRTag(1), NOT_LOCAL);
+    MY_CHECK_CLOSE(pdata.getPosition(2).x, 2.0, tol);
+
+    // removing a particle twice fails
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&] { pdata.removeParticlesByTag(std::vector<unsigned int> {2, 2}); });
+    UP_ASSERT_EXCEPTION(std::runtime_error,
+                        [&] { pdata.removeParticlesByTag(std::vector<unsigned int> {1}); });
+    UP_ASSERT_EQUAL(pdata.getNGlobal(), (unsigned int)1);
+
+    // the removed tags are recycled in the same order as by addParticle()
+    std::vector<unsigned int> tags = pdata.addParticlesByType(std::vector<unsigned int> {1, 0, 1});
+    UP_ASSERT_EQUAL(tags.size(), (size_t)3);
+    UP_ASSERT_EQUAL(tags[0], (unsigned int)0);
+    UP_ASSERT_EQUAL(tags[1], (unsigned int)3);
+    UP_ASSERT_EQUAL(tags[2], (unsigned int)1);
+    unsigned int new_tag = pdata.addParticle(0);
+    UP_ASSERT_EQUAL(new_tag, (unsigned int)4);
+
+    UP_ASSERT_EQUAL(pdata.getN(), (unsigned int)5);
+    UP_ASSERT_EQUAL(pdata.getNGlobal(), (unsigned int)5);
+    UP_ASSERT_EQUAL(pdata.getType(0), (unsigned int)1);
+    UP_ASSERT_EQUAL(pdata.getType(3), (unsigned int)0);
+    UP_ASSERT_EQUAL(pdata.getType(1), (unsigned int)1);
+    for (unsigned int i = 0; i < 3; i++)
+        UP_ASSERT_EQUAL(pdata.getRTag(tags[i]), i + 1);
+    MY_CHECK_CLOSE(pdata.getPosition(2).x, 2.0, tol);
+    }
+
+//! Counts the emissions of a particle data signal
+struct signal_counter
+    {
+    void count()
+        {
+        n++;
+        }
+    unsigned int n = 0;
+    };
+
+//! Tests updating the positions in place from a snapshot
+UP_TEST(ParticleData_update_positions_test)
+    {
+    auto box = std::make_shared<BoxDim>(10.0);
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    ParticleData pdata(4, box, 2, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+    for (unsigned int tag = 0; tag < 4; tag++)
+        {
+        pdata.setPosition(tag, make_scalar3(Scalar(tag), 0, 0));
+        pdata.setVelocity(tag, make_scalar3(0, Scalar(tag), 0));
+        }
+
+    // recycle tag 1 at the end of the arrays, so that the index differs from the tag
+    pdata.removeParticlesByTag(std::vector<unsigned int> {1});
+    UP_ASSERT_EQUAL(pdata.addParticle(0), (unsigned int)1);
+    pdata.setPosition(1, make_scalar3(1, 0, 0));
+    pdata.setVelocity(1, make_scalar3(0, 1, 0));
+    UP_ASSERT_EQUAL(pdata.getRTag(1), (unsigned int)3);
+
+    signal_counter sorts, number_changes;
+    pdata.getParticleSortSignal().connect<signal_counter, &signal_counter::count>(sorts);
+    pdata.getGlobalParticleNumberChangeSignal().connect<signal_counter, &signal_counter::count>(
+        number_changes);
+
+    SnapshotParticleData<Scalar> snap(4);
+    pdata.takeSnapshot(snap);
+
+    // an unchanged snapshot is applied in place
+    UP_ASSERT(pdata.updatePositionsFromSnapshot(snap));
+    UP_ASSERT_EQUAL(sorts.n, (unsigned int)1);
+
+    // new positions and images are written in place, keeping the particle order
+    for (unsigned int tag = 0; tag < 4; tag++)
+        {
+        snap.pos[tag] = vec3<Scalar>(Scalar(-1.0 * tag), Scalar(0.5), 0);
+        snap.image[tag] = make_int3(tag, 0, -1);
+        }
+    UP_ASSERT(pdata.updatePositionsFromSnapshot(snap));
+    UP_ASSERT_EQUAL(sorts.n, (unsigned int)2);
+    UP_ASSERT_EQUAL(number_changes.n, (unsigned int)0);
+    UP_ASSERT_EQUAL(pdata.getN(), (unsigned int)4);
+    UP_ASSERT_EQUAL(pdata.getRTag(1), (unsigned int)3);
+    for (unsigned int tag = 0; tag < 4; tag++)
+        {
+        MY_CHECK_CLOSE(pdata.getPosition(tag).x, -1.0 * tag, tol);
+        MY_CHECK_CLOSE(pdata.getPosition(tag).y, 0.5, tol);
+        UP_ASSERT_EQUAL(pdata.getImage(tag).x, (int)tag);
+        UP_ASSERT_EQUAL(pdata.getImage(tag).z, -1);
+        MY_CHECK_CLOSE(pdata.getVelocity(tag).y, Scalar(tag), tol);
+        }
+
+    // any other change is rejected and leaves the particle data unchanged
+    SnapshotParticleData<Scalar> vel_snap(snap);
+    vel_snap.pos[2] = vec3<Scalar>(3, 3, 3);
+    vel_snap.vel[2] = vec3<Scalar>(1, 0, 0);
+    UP_ASSERT(!pdata.updatePositionsFromSnapshot(vel_snap));
+
+    SnapshotParticleData<Scalar> type_snap(snap);
+    type_snap.pos[2] = vec3<Scalar>(3, 3, 3);
+    type_snap.type[2] = 1;
+    UP_ASSERT(!pdata.updatePositionsFromSnapshot(type_snap));
+
+    SnapshotParticleData<Scalar> size_snap(snap);
+    size_snap.resize(5);
+    UP_ASSERT(!pdata.updatePositionsFromSnapshot(size_snap));
+
+    UP_ASSERT_EQUAL(sorts.n, (unsigned int)2);
+    MY_CHECK_CLOSE(pdata.getPosition(2).x, -2.0, tol);
+    MY_CHECK_CLOSE(pdata.getPosition(2).y, 0.5, tol);
+    MY_CHECK_CLOSE(pdata.getVelocity(2).x, 0.0, tol);
+    UP_ASSERT_EQUAL(pdata.getType(2), (unsigned int)0);
+
+    pdata.getParticleSortSignal().disconnect<signal_counter, &signal_counter::count>(sorts);
+    pdata.getGlobalParticleNumberChangeSignal().disconnect<signal_counter, &signal_counter::count>(
+        number_changes);
+    }
+
 //! Tests the RandomParticleInitializer class
 UP_TEST(Random_test)
     {
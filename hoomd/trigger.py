@@ -290,6 +290,11 @@ class And(_hoomd.AndTrigger, Trigger):
 
         return all([f(t) for f in triggers])
 
+    `And` does not call any of the input triggers on steps where a built-in
+    trigger in ``triggers`` (`Periodic`, `Before`, `On`, `After`, or a
+    composite of them) does not fire, so custom triggers implemented in Python
+    are only evaluated on candidate steps.
+
     .. rubric:: Example:
 
     .. code-block:: python
@@ -3,7 +3,8 @@
 
 """Define LoadBalancer."""
 
-from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.parameterdicts import ParameterDict, TypeParameterDict
+from hoomd.data.typeparam import TypeParameter
 from hoomd.operation import Tuner
 from hoomd import _hoomd
 import hoomd
@@ -21,6 +22,8 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        time_weighted (bool): Weight each particle by the measured time per
+            particle of its rank when `True`.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -49,6 +52,28 @@ class LoadBalancer(Tuner):
     significantly more pair force neighbors than others, this estimate of the
     load imbalance may not produce the optimal results.
 
+    Set *time_weighted* to `True` to balance the measured work instead of the
+    number of particles. Each rank then weights its particles :math:`w_i`
+    by the wall time it spent outside of MPI communication since the previous
+    balancing step divided by its number of particles, normalized so that the
+    average weight is 1:
+
+    .. math::
+
+        I = \frac{N_i w_i}{N / P}
+
+    Time weighting balances systems where the cost per particle varies in
+    space, such as a dense droplet surrounded by vapor. The first balancing step
+    of each `Simulation.run` uses unit weights. The measurement includes all
+    work done on the rank, so other load (e.g. from other processes on the same
+    node) also shifts the domain boundaries.
+
+    When *time_weighted* is `False`, each particle counts with the *weight* of
+    its type instead. Set larger weights for types that cost more per particle,
+    such as charged particles or rigid body constituents. Then :math:`w_i` is the
+    average weight of the particles on rank :math:`i`, normalized so that the
+    average weight of all particles is 1.
+
     A load balancing adjustment is only performed when the maximum load
     imbalance exceeds a *tolerance*. The ideal load balance is 1.0, so setting
     *tolerance* less than 1.0 will force an adjustment every update. The load
@@ -83,6 +108,11 @@ class LoadBalancer(Tuner):
         tolerance (float): Load imbalance tolerance.
         max_iterations (int): Maximum number of iterations to
             attempt in a single step.
+        time_weighted (bool): Weight each particle by the measured time per
+            particle of its rank when `True`.
+        weight (`TypeParameter` [``particle_type``, `float`]): Relative cost of
+            a particle of each type when *time_weighted* is `False`. Must be
+            positive. Defaults to 1.0.
     """
 
     def __init__(self,
@@ -91,22 +121,30 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 time_weighted=False):
         super().__init__(trigger)
 
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
-                        max_iterations=max_iterations)
+                        max_iterations=max_iterations,
+                        time_weighted=time_weighted)
         load_balancer_params = ParameterDict(x=bool,
                                              y=bool,
                                              z=bool,
                                              max_iterations=int,
-                                             tolerance=float)
+                                             tolerance=float,
+                                             time_weighted=bool)
         self._param_dict.update(load_balancer_params)
         self._param_dict.update(defaults)
 
+        weight = TypeParameter('weight',
+                               type_kind='particle_types',
+                               param_dict=TypeParameterDict(1.0, len_keys=1))
+        self._extend_typeparam([weight])
+
     def _attach_hook(self):
         if isinstance(self._simulation.device, hoomd.device.GPU):
             cpp_cls = getattr(_hoomd, 'LoadBalancerGPU')
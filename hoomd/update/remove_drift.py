@@ -73,10 +73,11 @@ class RemoveDrift(Updater):
         self.reference_positions = reference_positions
 
     def _attach_hook(self):
-        if isinstance(self._simulation.device, hoomd.device.GPU):
-            self._simulation.device._cpp_msg.warning(
-                "Falling back on CPU. No GPU implementation available.\n")
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            cpp_class = _hoomd.UpdaterRemoveDrift
+        else:
+            cpp_class = _hoomd.UpdaterRemoveDriftGPU
 
-        self._cpp_obj = _hoomd.UpdaterRemoveDrift(
+        self._cpp_obj = cpp_class(
             self._simulation.state._cpp_sys_def, self.trigger,
             self.reference_positions)
@@ -12,5 +12,5 @@ provided subclasses.
 """
 
 from hoomd.variant.scalar import (Variant, Constant, Ramp, Cycle, Power,
-                                  variant_like)
+                                  Piecewise, Sequence, variant_like)
 from hoomd.variant import box
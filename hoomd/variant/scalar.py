@@ -5,6 +5,7 @@
 
 import typing
 
+import hoomd
 from hoomd import _hoomd
 
 
@@ -234,6 +235,113 @@ class Power(_hoomd.VariantPower, Variant):
     __eq__ = Variant._private_eq
 
 
+class Piecewise(_hoomd.VariantPiecewise, Variant):
+    """A piecewise linear function.
+
+    Args:
+        points (list[tuple[int, float]]): The ``(timestep, value)`` points in
+            strictly increasing time step order.
+
+    `Piecewise` holds the value of the first point until its time step. Then
+    it interpolates linearly between consecutive points and holds the value
+    of the last point after that.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+            variant = hoomd.variant.Piecewise(points=[(0, 1.0),
+                                                      (10_000, 2.0),
+                                                      (50_000, 2.0),
+                                                      (60_000, 0.5)])
+
+    Attributes:
+        points (list[tuple[int, float]]): The ``(timestep, value)`` points.
+    """
+    _eq_attrs = ("points",)
+
+    def __init__(self, points):
+        Variant.__init__(self)
+        _hoomd.VariantPiecewise.__init__(self, points)
+
+    __eq__ = Variant._private_eq
+
+
+class Sequence(_hoomd.VariantSequence, Variant):
+    """A sequence of variants.
+
+    Args:
+        variants (list[hoomd.variant.variant_like]): The variants in the
+            sequence.
+        t_switch (list[int]): The time steps at which the next variant in the
+            sequence becomes active. Must have one fewer element than
+            *variants* and be strictly increasing.
+
+    `Sequence` evaluates ``variants[0]`` until ``t_switch[0]``, then
+    ``variants[1]`` until ``t_switch[1]``, and so on. It evaluates the active
+    variant at the current time step (not the time since the switch). The
+    minimum and maximum of `Sequence` are the extremes over all the variants.
+
+    When all the variants in the sequence are built-in variants, HOOMD-blue
+    evaluates `Sequence` without calling back into Python.
+
+    .. rubric:: Example:
+
+    .. code-block:: python
+
+            variant = hoomd.variant.Sequence(
+                variants=[hoomd.variant.Ramp(A=1.0,
+                                             B=2.0,
+                                             t_start=0,
+                                             t_ramp=10_000),
+                          hoomd.variant.Cycle(A=2.0,
+                                              B=3.0,
+                                              t_start=20_000,
+                                              t_A=1_000,
+                                              t_AB=1_000,
+                                              t_B=1_000,
+                                              t_BA=1_000)],
+                t_switch=[20_000])
+    """
+    _eq_attrs = ("variants", "t_switch")
+
+    def __init__(self, variants, t_switch):
+        Variant.__init__(self)
+        _hoomd.VariantSequence.__init__(self, self._preprocess(variants),
+                                        t_switch)
+
+    @staticmethod
+    def _preprocess(variants):
+        return [
+            hoomd.data.typeconverter.variant_preprocessing(variant)
+            for variant in variants
+        ]
+
+    def __reduce__(self):
+        """Reduce values to picklable format."""
+        return (type(self), (self.variants, self.t_switch))
+
+    @property
+    def variants(self):
+        """list[hoomd.variant.Variant]: The variants in the sequence."""
+        return list(self._variants)
+
+    @variants.setter
+    def variants(self, variants):
+        self._set_sequence(self._preprocess(variants), self.t_switch)
+
+    @property
+    def t_switch(self):
+        """list[int]: The time steps at which the next variant activates."""
+        return list(self._t_switch)
+
+    @t_switch.setter
+    def t_switch(self, t_switch):
+        self._set_sequence(self.variants, t_switch)
+
+    __eq__ = Variant._private_eq
+
+
 variant_like = typing.Union[Variant, float]
 """
 Objects that are like a variant.
@@ -55,11 +55,20 @@ Attributes:
 
     mpi_enabled (bool): ``True`` when this build supports MPI parallel runs.
 
+    papi_enabled (bool): ``True`` when this build reads hardware performance
+        counters with PAPI.
+
     source_dir (str): The source directory.
 
     tbb_enabled (bool): ``True`` when this build supports TBB threads.
 
+    torch_enabled (bool): ``True`` when this build evaluates TorchScript models
+        with libtorch.
+
     version (str): HOOMD-blue package version, following semantic versioning.
+
+    zstd_enabled (bool): ``True`` when this build supports zstd compression of
+        GSD files.
 """
 from hoomd import _hoomd
 
@@ -84,6 +93,9 @@ gpu_api_version = _hoomd.BuildInfo.getGPUAPIVersion()
 gpu_platform = _hoomd.BuildInfo.getGPUPlatform()
 cxx_compiler = _hoomd.BuildInfo.getCXXCompiler()
 tbb_enabled = _hoomd.BuildInfo.getEnableTBB()
+zstd_enabled = _hoomd.BuildInfo.getEnableZstd()
+papi_enabled = _hoomd.BuildInfo.getEnablePAPI()
+torch_enabled = _hoomd.BuildInfo.getEnableTorch()
 mpi_enabled = _hoomd.BuildInfo.getEnableMPI()
 source_dir = _hoomd.BuildInfo.getSourceDir()
 install_dir = _hoomd.BuildInfo.getInstallDir()
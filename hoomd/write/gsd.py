@@ -12,7 +12,6 @@
 from collections.abc import Mapping, Collection
 from hoomd.trigger import Periodic
 from hoomd import _hoomd
-from hoomd.util import _dict_flatten
 from hoomd.data.typeconverter import OnlyFrom, RequiredArg
 from hoomd.filter import ParticleFilter, All
 from hoomd.data.parameterdicts import ParameterDict
@@ -71,6 +70,10 @@ class GSD(Writer):
             all frames. Defaults to ``['property']``.
         logger (hoomd.logging.Logger): Provide log quantities to write. Defaults
             to `None`.
+        compression (str): Codec that compresses the per-particle data:
+            ``'none'`` or ``'zstd'``. Defaults to ``'none'``.
+        keyframe_interval (int): Number of frames from one full position
+            frame to the next. Defaults to 1.
 
     `GSD` writes the simulation trajectory to the specified file in the GSD
     format. `GSD` can store all particle, bond, angle, dihedral, improper,
@@ -150,6 +153,25 @@ class GSD(Writer):
         that your scripts exit cleanly and call `flush()` as needed to write
         buffered frames to the file.
 
+    Note:
+        When `compression` is ``'zstd'``, `GSD` stores the byte shuffled and
+        compressed per-particle data in ``hoomd/compressed/*`` chunks and marks
+        the file with an incompatible hoomd schema version. Only
+        `hoomd.Simulation.create_state_from_gsd` reads compressed files.
+        `compression` requires a build with ``ENABLE_ZSTD=on``.
+        `hoomd.write.Burst` does not support compression.
+
+    Note:
+        When `keyframe_interval` is larger than 1 and `position_precision` is
+        non-zero, `GSD` writes the full positions only in every
+        `keyframe_interval`-th frame (the keyframes). The frames in between
+        store the displacements from the last keyframe as 16 bit multiples of
+        the rounding spacing, which are much smaller (and compress much better)
+        than the positions when particles move slowly. `GSD` writes an extra
+        keyframe when the box changes or a displacement is too large. Like
+        compressed files, only `hoomd.Simulation.create_state_from_gsd` reads
+        files with displacement frames.
+
     See Also:
         See the `GSD documentation <https://gsd.readthedocs.io/>`__, `GSD HOOMD
         Schema <https://gsd.readthedocs.io/en/stable/schema-hoomd.html>`__, and
@@ -251,6 +273,62 @@ class GSD(Writer):
             .. code-block:: python
 
                 gsd.maximum_write_buffer_size = 128 * 1024**2
+
+        compression (str): Codec that compresses the per-particle data
+            (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                compression = gsd.compression
+
+        keyframe_interval (int): Number of frames from one full position
+            frame to the next (*read-only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                keyframe_interval = gsd.keyframe_interval
+
+        position_precision (float): When non-zero, round the written particle
+            positions to multiples of the largest power of 2 that is no greater
+            than `position_precision` :math:`[\mathrm{length}]`. Rounded
+            positions differ from the exact positions by at most half of that
+            spacing and compress much better. Set to 0 to write exact positions.
+            Defaults to 0.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.position_precision = 1 / 1024
+
+        asynchronous (bool): When `True`, write frames to the file in a
+            background thread. `GSD` copies the frame data and returns, blocking
+            only when 2 frames are already waiting to be written. Frame 0 and
+            all frames written with ``truncate=True`` are written synchronously.
+            `hoomd.write.Burst` writes all frames synchronously.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.asynchronous = True
+
+        collective (bool): When `True` and the simulation runs on more than one
+            rank, each rank writes the per-particle data of its local particles
+            directly to the file with collective MPI-IO. When `False`, `GSD`
+            gathers each frame on rank 0 before writing. Collective writes
+            avoid storing the entire frame on rank 0 and produce a standard GSD
+            file. Frames are written synchronously when `collective` is `True`.
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                gsd.collective = True
     """
 
     def __init__(self,
@@ -260,7 +338,9 @@ class GSD(Writer):
                  mode='ab',
                  truncate=False,
                  dynamic=None,
-                 logger=None):
+                 logger=None,
+                 compression='none',
+                 keyframe_interval=1):
 
         super().__init__(trigger)
 
@@ -292,10 +372,16 @@ class GSD(Writer):
                           filter=ParticleFilter,
                           mode=str(mode),
                           truncate=bool(truncate),
+                          compression=OnlyFrom(['none', 'zstd']),
+                          keyframe_interval=int(keyframe_interval),
+                          position_precision=float(0),
                           dynamic=[dynamic_validation],
                           write_diameter=False,
                           maximum_write_buffer_size=64 * 1024 * 1024,
+                          asynchronous=False,
+                          collective=False,
                           _defaults=dict(filter=filter, dynamic=dynamic)))
+        self._param_dict["compression"] = compression
 
         self._logger = None if logger is None else _GSDLogWriter(logger)
 
@@ -303,7 +389,7 @@ class GSD(Writer):
         self._cpp_obj = _hoomd.GSDDumpWriter(
             self._simulation.state._cpp_sys_def, self.trigger, self.filename,
             self._simulation.state._get_group(self.filter), self.mode,
-            self.truncate)
+            self.truncate, self.compression, self.keyframe_interval)
 
         self._cpp_obj.log_writer = self.logger
 
@@ -429,11 +515,26 @@ class _GSDLogWriter:
 
     def __init__(self, logger):
         self.logger = logger
+        # GSD chunk names by (namespace, category), which do not change
+        # between frames.
+        self._chunk_names = {}
+
+    def _chunk_name(self, key, type_category):
+        """Get the GSD chunk name for a logged quantity."""
+        name = self._chunk_names.get((key, type_category))
+        if name is None:
+            if type_category in self._per_categories:
+                name = '/'.join((self._global_prepend, type_category.name
+                                 + 's') + key)
+            else:
+                name = '/'.join((self._global_prepend,) + key)
+            self._chunk_names[(key, type_category)] = name
+        return name
 
     def log(self):
         """Get the flattened dictionary for consumption by GSD object."""
         log = dict()
-        for key, value in _dict_flatten(self.logger.log()).items():
+        for key, value in self.logger._log_flat().items():
             if 'state' in key and _iterable_is_incomplete(value[0]):
                 pass
             log_value, type_category = value
@@ -452,16 +553,12 @@ class _GSDLogWriter:
                     # per-{particle,bond,...} into the correct GSD namespace
                     # log/particles/{remaining namespace}. This preserves OVITO
                     # intergration.
-                    if type_category in self._per_categories:
-                        log['/'.join((self._global_prepend, type_category.name
-                                      + 's') + key)] = log_value
-                    elif type_category in self._convert_categories:
-                        self._log_convert_value(
-                            log, '/'.join((self._global_prepend,) + key),
-                            type_category, log_value)
+                    name = self._chunk_name(key, type_category)
+                    if type_category in self._convert_categories:
+                        self._log_convert_value(log, name, type_category,
+                                                log_value)
                     else:
-                        log['/'.join((self._global_prepend,) + key)] = \
-                            log_value
+                        log[name] = log_value
             else:
                 pass
         return log
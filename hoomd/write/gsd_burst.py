@@ -48,6 +48,12 @@ class Burst(GSD):
         When analyzing files created by `Burst`, generally the first frame is
         not associated with the call to `Burst.dump`.
 
+    Note:
+        `Burst` stores only the fields selected by ``dynamic`` in each frame.
+        The frame buffers are allocated once and reused, so storing frames at
+        every step costs only the time needed to copy these fields. Set
+        ``max_burst_size`` to limit the memory used by the buffer.
+
     .. rubric:: Example:
 
     .. code-block:: python
@@ -98,6 +104,8 @@ class Burst(GSD):
                          dynamic=dynamic,
                          logger=logger)
         self._param_dict.pop("truncate")
+        self._param_dict.pop("compression")
+        self._param_dict.pop("keyframe_interval")
         self._param_dict.update(
             ParameterDict(max_burst_size=int, write_at_start=bool))
         self._param_dict.update({
@@ -33,7 +33,6 @@ import numpy as np
 import hoomd.custom as custom
 import hoomd.logging as logging
 import hoomd.data.typeconverter as typeconverter
-import hoomd.util as util
 
 from hoomd.write.custom_writer import _InternalCustomWriter
 from hoomd.data.parameterdicts import ParameterDict
@@ -88,21 +87,25 @@ class _HDF5LogInternal(custom._InternalAction):
     _SCALAR_CHUNK = 512
     _MULTIFRAME_ARRAY_CHUNK_MAXIMUM = 4096
 
-    def __init__(self, filename, logger, mode="a"):
+    def __init__(self, filename, logger, mode="a", buffer_size=1):
         if h5py is None:
             raise ImportError(f"{type(self)} requires the h5py pacakge.")
         param_dict = ParameterDict(filename=typeconverter.OnlyTypes(
             (str, PurePath)),
                                    logger=logging.Logger,
-                                   mode=str)
+                                   mode=str,
+                                   buffer_size=int)
         if (rejects := self._reject_categories
                 & logger.categories) != logging.LoggerCategories["NONE"]:
             reject_str = logging.LoggerCategories._get_string_list(rejects)
             raise ValueError(f"Cannot have {reject_str} in logger categories.")
+        if buffer_size < 1:
+            raise ValueError("buffer_size must be positive.")
         param_dict.update({
             "filename": filename,
             "logger": logger,
-            "mode": mode
+            "mode": mode,
+            "buffer_size": buffer_size
         })
         self._param_dict = param_dict
         self._fh = None
@@ -139,46 +142,46 @@ class _HDF5LogInternal(custom._InternalAction):
 
     def act(self, timestep):
         """Write a new frame of logger data to the HDF5 file."""
-        log_dict = util._dict_flatten(self.logger.log())
-        if self._fh is None:
-            return
+        columns = {
+            key: np.asarray(value)[np.newaxis, ...]
+            for key, value in self._log().items()
+        }
+        self._write_columns(columns, 1)
+
+    def _log(self):
+        """Get the logged quantities of the current frame by dataset key.
+
+        Called on all ranks by `hoomd._hoomd.BufferedLogWriter`.
+        """
+        log_dict = self.logger._log_flat()
+        return {
+            "/".join(("hoomd-data",) + key): value
+            for key, (value, category) in log_dict.items()
+            if value is not None and logging.LoggerCategories[category]
+            not in self._reject_categories
+        }
+
+    @_skip_fh
+    def _write_columns(self, columns, n_frames):
+        """Write buffered frames of logger data to the HDF5 file.
+
+        Each column holds the values of one quantity in ``n_frames`` frames.
+        """
         if self._frame == 0:
-            self._initialize_datasets(log_dict)
-        for key, (value, category) in log_dict.items():
-            if logging.LoggerCategories[category] in self._reject_categories:
-                continue
-            if value is None:
-                continue
-            str_key = "/".join(("hoomd-data",) + key)
-            if str_key not in self._fh:
+            self._initialize_datasets(columns)
+        for key, values in columns.items():
+            if key not in self._fh:
                 raise RuntimeError(
                     "The logged quantities cannot change within a file.")
-            dataset = self._fh[str_key]
-            dataset.resize(self._frame + 1, axis=0)
-            dataset[self._frame, ...] = value
-        self._frame += 1
+            dataset = self._fh[key]
+            dataset.resize(self._frame + n_frames, axis=0)
+            dataset[self._frame:self._frame + n_frames, ...] = values
+        self._frame += n_frames
         self._fh["hoomd-data"].attrs["frames"] = self._frame
 
     @_skip_fh
     def flush(self):
-        """Write out all data currently buffered in memory.
-
-        .. rubric:: Examples:
-
-        Flush one writer:
-
-        .. code-block:: python
-
-            hdf5_writer.flush()
-
-        Flush all write buffers:
-
-        .. code-block:: python
-
-            for writer in simulation.operations.writers:
-                if hasattr(writer, 'flush'):
-                    writer.flush()
-        """
+        """Flush the HDF5 file."""
         self._fh.flush()
 
     @_skip_fh
@@ -192,7 +195,7 @@ class _HDF5LogInternal(custom._InternalAction):
         )
 
     @_skip_fh
-    def _initialize_datasets(self, log_dict):
+    def _initialize_datasets(self, columns):
         """Create datasets setting shape, dtype, and chunk size.
 
         Chunk size does not seem to matter much to the write performance of the
@@ -203,27 +206,16 @@ class _HDF5LogInternal(custom._InternalAction):
         Tests were done on 1,000 frame files for writes and reads and tested for
         writing and reading speed.
         """
-        for key, (value, category) in log_dict.items():
-            chunk_size = None
-            if category == "scalar":
-                data_shape = (1,)
-                if isinstance(value, (np.number, np.bool_)):
-                    dtype = value.dtype
-                elif isinstance(value, int):
-                    dtype = np.dtype(bool) if isinstance(value, bool) else "i8"
-                else:
-                    dtype = "f8"
+        for key, values in columns.items():
+            value = values[0]
+            data_shape = (1,) + value.shape
+            if value.ndim == 0:
                 chunk_size = (self._SCALAR_CHUNK,)
             else:
-                if not isinstance(value, np.ndarray):
-                    value = np.asarray(value)
-                data_shape = (1,) + value.shape
-                dtype = value.dtype
                 chunk_size = (max(
                     self._MULTIFRAME_ARRAY_CHUNK_MAXIMUM // value.nbytes,
                     1),) + data_shape[1:]
-            self._create_dataset("/".join(("hoomd-data",) + key), data_shape,
-                                 dtype, chunk_size)
+            self._create_dataset(key, data_shape, values.dtype, chunk_size)
 
     @_skip_fh
     def _find_frame(self):
@@ -276,6 +268,14 @@ class HDF5Log(_InternalCustomWriter):
         mode (`str`, optional): The mode to open the file in. Available values
             are "w", "x" and "w-", "a", and "r+". Defaults to "a". See the
             h5py_ documentation for more details).
+        buffer_size (`int`, optional): The number of frames to store in memory
+            before writing them to the file. Defaults to 1.
+
+    `HDF5Log` stores the logged quantities of each frame in typed buffers in
+    C++ and writes ``buffer_size`` frames to each dataset at a time. Writing
+    many frames at once greatly reduces the cost of logging many quantities
+    often. Call `flush` to write the buffered frames early. `HDF5Log` also
+    writes the buffered frames when it is removed from the simulation.
 
     .. _h5py:
         https://docs.h5py.org/en/stable/high/file.html#opening-creating-files
@@ -328,9 +328,45 @@ class HDF5Log(_InternalCustomWriter):
             .. code-block:: python
 
                 mode = hdf5_log.mode
+
+        buffer_size (int): The number of frames to store in memory before
+            writing them to the file (*read only*).
+
+            .. rubric:: Example:
+
+            .. code-block:: python
+
+                buffer_size = hdf5_log.buffer_size
     """
     _internal_class = _HDF5LogInternal
-    _wrap_methods = ("flush",)
+    _cpp_class_name = "BufferedLogWriter"
+
+    def _detach_hook(self):
+        self._cpp_obj.flush()
+        super()._detach_hook()
+
+    def flush(self):
+        """Write out all data currently buffered in memory.
+
+        .. rubric:: Examples:
+
+        Flush one writer:
+
+        .. code-block:: python
+
+            hdf5_writer.flush()
+
+        Flush all write buffers:
+
+        .. code-block:: python
+
+            for writer in simulation.operations.writers:
+                if hasattr(writer, 'flush'):
+                    writer.flush()
+        """
+        if self._attached:
+            self._cpp_obj.flush()
+        self._action.flush()
 
     def write(self, timestep=None):
         """Write out data to the HDF5 file.
@@ -355,6 +391,8 @@ class HDF5Log(_InternalCustomWriter):
         warnings.warn(
             "`HDF5Log.writer` is deprecated,"
             "use `Simulation` to call the operation.", FutureWarning)
+        if self._attached:
+            self._cpp_obj.flush()
         self._action.act(timestep)
 
 